@@ -250,6 +250,9 @@ function(get_supported_backends _TARGETS)
     if(METAL_SUPPORTED)
 	    list(APPEND BACKENDS Diligent-GraphicsEngineMetal-${LIB_TYPE})
     endif()
+    if(NULL_SUPPORTED)
+	    list(APPEND BACKENDS Diligent-GraphicsEngineNull-${LIB_TYPE})
+    endif()
     # ${_TARGETS} == ENGINE_LIBRARIES
     # ${${_TARGETS}} == ${ENGINE_LIBRARIES}
     set(${_TARGETS} ${${_TARGETS}} ${BACKENDS} PARENT_SCOPE)
@@ -31,6 +31,7 @@
 #include <memory>
 #include <cstring>
 
+#include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/Errors.hpp"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -61,6 +62,26 @@ std::size_t ComputeHash(const ArgsType&... Args)
     return Seed;
 }
 
+/// Computes the hash of a raw memory range.
+inline std::size_t ComputeHashRaw(const void* pData, size_t Size)
+{
+    std::size_t Seed = 0;
+
+    const auto* pBytes   = static_cast<const Uint8*>(pData);
+    const auto  NumWords = Size / sizeof(std::size_t);
+    for (size_t i = 0; i < NumWords; ++i)
+    {
+        std::size_t Word;
+        memcpy(&Word, pBytes + i * sizeof(std::size_t), sizeof(Word));
+        HashCombine(Seed, Word);
+    }
+    for (size_t i = NumWords * sizeof(std::size_t); i < Size; ++i)
+        HashCombine(Seed, pBytes[i]);
+
+    HashCombine(Seed, Size);
+    return Seed;
+}
+
 template <typename CharType>
 struct CStringHash
 {
@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Implementation of the read-only memory-mapped file data blob
+
+#include <vector>
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "RefCntAutoPtr.hpp"
+#include "ObjectBase.hpp"
+
+namespace Diligent
+{
+
+/// File time stamp that is used to detect file modifications.
+struct FileTimeStamp
+{
+    /// File size, in bytes.
+    Uint64 Size = 0;
+
+    /// Last modification time, in platform-specific units.
+    Uint64 ModificationTime = 0;
+
+    bool operator==(const FileTimeStamp& rhs) const
+    {
+        return Size == rhs.Size && ModificationTime == rhs.ModificationTime;
+    }
+    bool operator!=(const FileTimeStamp& rhs) const
+    {
+        return !(*this == rhs);
+    }
+};
+
+/// Immutable data blob that exposes the contents of a file.
+
+/// On platforms that support it, the file is mapped into the process address space
+/// and its contents are never copied. Otherwise (e.g. Android assets), the file is read
+/// into an internal buffer once. The contents must never be modified through the pointer
+/// returned by GetDataPtr(), and Resize() is not supported.
+class MappedFileDataBlob final : public ObjectBase<IDataBlob>
+{
+public:
+    typedef ObjectBase<IDataBlob> TBase;
+
+    MappedFileDataBlob(IReferenceCounters* pRefCounters, const Char* Path, bool UseMemoryMapping = true);
+    ~MappedFileDataBlob();
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override;
+
+    /// Resizing is not supported for immutable file contents
+    virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override;
+
+    /// Returns the file size
+    virtual size_t DILIGENT_CALL_TYPE GetSize() const override;
+
+    /// Returns the pointer to the file contents. The contents must not be modified.
+    virtual void* DILIGENT_CALL_TYPE GetDataPtr() override;
+
+    /// Returns const pointer to the file contents
+    virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr() const override;
+
+    /// Returns true if the file has been successfully opened
+    bool IsValid() const { return m_IsValid; }
+
+    /// Returns true if the contents are memory-mapped rather than copied
+    bool IsMapped() const { return m_pMappedData != nullptr; }
+
+    /// Returns the time stamp of the file at the moment it was opened
+    const FileTimeStamp& GetTimeStamp() const { return m_TimeStamp; }
+
+    /// Opens the file and returns the data blob, or null if the file could not be opened.
+    static RefCntAutoPtr<MappedFileDataBlob> Create(const Char* Path, bool UseMemoryMapping = true);
+
+    /// Queries the size and modification time of the file.
+
+    /// \return     true if the time stamp was successfully retrieved, and false otherwise
+    ///             (e.g. the file does not exist or the platform does not support the query).
+    static bool GetFileTimeStamp(const Char* Path, FileTimeStamp& TimeStamp);
+
+private:
+    bool Map(const String& Path);
+    void Unmap();
+
+    void*              m_pMappedData = nullptr;
+    size_t             m_MappedSize  = 0;
+    std::vector<Uint8> m_DataBuff;
+    FileTimeStamp      m_TimeStamp;
+    bool               m_IsValid = false;
+
+#if PLATFORM_WIN32
+    void* m_hFile    = nullptr;
+    void* m_hMapping = nullptr;
+#endif
+};
+
+} // namespace Diligent
@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// A simple pool of worker threads that execute tasks in FIFO order.
+class ThreadPool
+{
+public:
+    using TaskType = std::function<void()>;
+
+    /// Starts NumThreads worker threads.
+    explicit ThreadPool(size_t NumThreads)
+    {
+        VERIFY(NumThreads > 0, "The number of threads must not be zero");
+        m_Threads.reserve(NumThreads);
+        for (size_t i = 0; i < NumThreads; ++i)
+            m_Threads.emplace_back([this]() { WorkerThreadFunc(); });
+    }
+
+    // clang-format off
+    ThreadPool           (const ThreadPool&)  = delete;
+    ThreadPool           (      ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&)  = delete;
+    ThreadPool& operator=(      ThreadPool&&) = delete;
+    // clang-format on
+
+    /// Executes all pending tasks and stops the worker threads.
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mutex};
+            m_Stop = true;
+        }
+        m_CondVar.notify_all();
+
+        for (auto& Thread : m_Threads)
+            Thread.join();
+
+        VERIFY(m_Tasks.empty(), "All tasks must have been executed");
+    }
+
+    /// Adds the task to the queue. The task will be executed by one of the worker threads.
+    void EnqueueTask(TaskType&& Task)
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mutex};
+            VERIFY(!m_Stop, "Enqueueing a task into the thread pool that is being destroyed");
+            m_Tasks.emplace_back(std::move(Task));
+        }
+        m_CondVar.notify_one();
+    }
+
+    size_t GetNumThreads() const { return m_Threads.size(); }
+
+private:
+    void WorkerThreadFunc()
+    {
+        while (true)
+        {
+            TaskType Task;
+            {
+                std::unique_lock<std::mutex> Lock{m_Mutex};
+                m_CondVar.wait(Lock, [this]() { return m_Stop || !m_Tasks.empty(); });
+
+                // Pending tasks are executed even when the pool is being destroyed
+                if (m_Tasks.empty())
+                    return;
+
+                Task = std::move(m_Tasks.front());
+                m_Tasks.pop_front();
+            }
+
+            Task();
+        }
+    }
+
+    std::mutex               m_Mutex;
+    std::condition_variable  m_CondVar;
+    std::deque<TaskType>     m_Tasks;
+    bool                     m_Stop = false;
+    std::vector<std::thread> m_Threads;
+};
+
+/// Calls Handler(First, Last) for the chunks of at most ChunkSize elements that cover the range [0, Count).
+
+/// The chunks are processed by the calling thread and the worker threads of the pool (if it is not null),
+/// and the function returns when all chunks have been processed. Since the calling thread takes part
+/// in the work, the function makes progress even when all worker threads are busy with other tasks.
+template <typename HandlerType>
+void ParallelFor(ThreadPool* pPool, size_t Count, size_t ChunkSize, HandlerType&& Handler)
+{
+    VERIFY(ChunkSize > 0, "Chunk size must not be zero");
+
+    const size_t NumChunks = (Count + ChunkSize - 1) / ChunkSize;
+    if (pPool == nullptr || NumChunks <= 1)
+    {
+        for (size_t First = 0; First < Count; First += ChunkSize)
+            Handler(First, std::min(First + ChunkSize, Count));
+        return;
+    }
+
+    // The state is shared with the worker tasks, some of which may only start after all
+    // chunks have been processed and this function has returned. Such tasks do not find
+    // any chunks left and never access the handler.
+    struct SharedState
+    {
+        std::function<void(size_t, size_t)> Handler;
+
+        size_t Count     = 0;
+        size_t ChunkSize = 0;
+        size_t NumChunks = 0;
+
+        std::atomic<size_t> NextChunk{0};
+        std::atomic<size_t> NumProcessedChunks{0};
+
+        std::mutex              Mtx;
+        std::condition_variable CondVar;
+
+        void ProcessChunks()
+        {
+            for (size_t Chunk = NextChunk.fetch_add(1); Chunk < NumChunks; Chunk = NextChunk.fetch_add(1))
+            {
+                const size_t First = Chunk * ChunkSize;
+                Handler(First, std::min(First + ChunkSize, Count));
+                if (NumProcessedChunks.fetch_add(1) + 1 == NumChunks)
+                {
+                    std::lock_guard<std::mutex> Lock{Mtx};
+                    CondVar.notify_all();
+                }
+            }
+        }
+    };
+
+    auto pState       = std::make_shared<SharedState>();
+    pState->Handler   = std::ref(Handler);
+    pState->Count     = Count;
+    pState->ChunkSize = ChunkSize;
+    pState->NumChunks = NumChunks;
+
+    const size_t NumTasks = std::min(pPool->GetNumThreads(), NumChunks - 1);
+    for (size_t i = 0; i < NumTasks; ++i)
+    {
+        pPool->EnqueueTask([pState]() {
+            pState->ProcessChunks();
+        });
+    }
+
+    pState->ProcessChunks();
+
+    std::unique_lock<std::mutex> Lock{pState->Mtx};
+    pState->CondVar.wait(Lock, [&pState]() { return pState->NumProcessedChunks.load() == pState->NumChunks; });
+}
+
+} // namespace Diligent
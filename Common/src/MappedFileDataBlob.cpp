@@ -0,0 +1,267 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "MappedFileDataBlob.hpp"
+
+#include "FileSystem.hpp"
+
+#if PLATFORM_WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <Windows.h>
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+String GetCorrectedPath(const Char* Path)
+{
+    String CorrectedPath{Path};
+    FileSystem::CorrectSlashes(CorrectedPath, FileSystem::GetSlashSymbol());
+    return CorrectedPath;
+}
+
+} // namespace
+
+RefCntAutoPtr<MappedFileDataBlob> MappedFileDataBlob::Create(const Char* Path, bool UseMemoryMapping)
+{
+    RefCntAutoPtr<MappedFileDataBlob> pBlob{MakeNewRCObj<MappedFileDataBlob>()(Path, UseMemoryMapping)};
+    if (!pBlob->IsValid())
+        pBlob.Release();
+    return pBlob;
+}
+
+MappedFileDataBlob::MappedFileDataBlob(IReferenceCounters* pRefCounters, const Char* Path, bool UseMemoryMapping) :
+    TBase{pRefCounters}
+{
+    VERIFY_EXPR(Path != nullptr);
+
+    const auto CorrectedPath = GetCorrectedPath(Path);
+
+    GetFileTimeStamp(Path, m_TimeStamp);
+
+    // Empty files can't be mapped
+    if (UseMemoryMapping && m_TimeStamp.Size > 0 && Map(CorrectedPath))
+    {
+        m_IsValid = true;
+        return;
+    }
+
+    // Fall back to reading the file, e.g. for Android assets
+    FileWrapper File{CorrectedPath.c_str(), EFileAccessMode::Read};
+    if (!File)
+        return;
+
+    m_DataBuff.resize(File->GetSize());
+    m_IsValid = m_DataBuff.empty() || File->Read(m_DataBuff.data(), m_DataBuff.size());
+    if (!m_IsValid)
+    {
+        LOG_ERROR_MESSAGE("Failed to read file '", Path, "'.");
+        m_DataBuff.clear();
+    }
+    else if (m_TimeStamp.Size == 0)
+    {
+        m_TimeStamp.Size = m_DataBuff.size();
+    }
+}
+
+MappedFileDataBlob::~MappedFileDataBlob()
+{
+    Unmap();
+}
+
+#if PLATFORM_WIN32
+
+bool MappedFileDataBlob::Map(const String& Path)
+{
+    HANDLE hFile = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER FileSize = {};
+    if (!GetFileSizeEx(hFile, &FileSize) || FileSize.QuadPart == 0)
+    {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    HANDLE hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hMapping == NULL)
+    {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    void* pData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    if (pData == nullptr)
+    {
+        CloseHandle(hMapping);
+        CloseHandle(hFile);
+        return false;
+    }
+
+    m_hFile       = hFile;
+    m_hMapping    = hMapping;
+    m_pMappedData = pData;
+    m_MappedSize  = static_cast<size_t>(FileSize.QuadPart);
+    return true;
+}
+
+void MappedFileDataBlob::Unmap()
+{
+    if (m_pMappedData != nullptr)
+        UnmapViewOfFile(m_pMappedData);
+    if (m_hMapping != nullptr)
+        CloseHandle(m_hMapping);
+    if (m_hFile != nullptr)
+        CloseHandle(m_hFile);
+
+    m_pMappedData = nullptr;
+    m_hMapping    = nullptr;
+    m_hFile       = nullptr;
+    m_MappedSize  = 0;
+}
+
+bool MappedFileDataBlob::GetFileTimeStamp(const Char* Path, FileTimeStamp& TimeStamp)
+{
+    const auto CorrectedPath = GetCorrectedPath(Path);
+
+    WIN32_FILE_ATTRIBUTE_DATA FileAttribs = {};
+    if (!GetFileAttributesExA(CorrectedPath.c_str(), GetFileExInfoStandard, &FileAttribs))
+        return false;
+
+    TimeStamp.Size             = (Uint64{FileAttribs.nFileSizeHigh} << 32u) | Uint64{FileAttribs.nFileSizeLow};
+    TimeStamp.ModificationTime = (Uint64{FileAttribs.ftLastWriteTime.dwHighDateTime} << 32u) | Uint64{FileAttribs.ftLastWriteTime.dwLowDateTime};
+    return true;
+}
+
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+
+bool MappedFileDataBlob::Map(const String& Path)
+{
+    int fd = open(Path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat FileStat = {};
+    if (fstat(fd, &FileStat) != 0 || FileStat.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    const auto Size  = static_cast<size_t>(FileStat.st_size);
+    void*      pData = mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (pData == MAP_FAILED)
+        return false;
+
+    m_pMappedData = pData;
+    m_MappedSize  = Size;
+    return true;
+}
+
+void MappedFileDataBlob::Unmap()
+{
+    if (m_pMappedData != nullptr)
+        munmap(m_pMappedData, m_MappedSize);
+
+    m_pMappedData = nullptr;
+    m_MappedSize  = 0;
+}
+
+bool MappedFileDataBlob::GetFileTimeStamp(const Char* Path, FileTimeStamp& TimeStamp)
+{
+    const auto CorrectedPath = GetCorrectedPath(Path);
+
+    struct stat FileStat = {};
+    if (stat(CorrectedPath.c_str(), &FileStat) != 0)
+        return false;
+
+    TimeStamp.Size = static_cast<Uint64>(FileStat.st_size);
+#    if PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+    TimeStamp.ModificationTime = static_cast<Uint64>(FileStat.st_mtimespec.tv_sec) * 1000000000ull + static_cast<Uint64>(FileStat.st_mtimespec.tv_nsec);
+#    else
+    TimeStamp.ModificationTime = static_cast<Uint64>(FileStat.st_mtim.tv_sec) * 1000000000ull + static_cast<Uint64>(FileStat.st_mtim.tv_nsec);
+#    endif
+    return true;
+}
+
+#else
+
+bool MappedFileDataBlob::Map(const String& Path)
+{
+    return false;
+}
+
+void MappedFileDataBlob::Unmap()
+{
+}
+
+bool MappedFileDataBlob::GetFileTimeStamp(const Char* Path, FileTimeStamp& TimeStamp)
+{
+    return false;
+}
+
+#endif
+
+void MappedFileDataBlob::Resize(size_t NewSize)
+{
+    UNEXPECTED("Memory-mapped file data blob can't be resized");
+}
+
+size_t MappedFileDataBlob::GetSize() const
+{
+    return m_pMappedData != nullptr ? m_MappedSize : m_DataBuff.size();
+}
+
+void* MappedFileDataBlob::GetDataPtr()
+{
+    return m_pMappedData != nullptr ? m_pMappedData : m_DataBuff.data();
+}
+
+const void* MappedFileDataBlob::GetConstDataPtr() const
+{
+    return m_pMappedData != nullptr ? m_pMappedData : m_DataBuff.data();
+}
+
+IMPLEMENT_QUERY_INTERFACE(MappedFileDataBlob, IID_DataBlob, TBase)
+
+} // namespace Diligent
@@ -369,6 +369,14 @@ public:
         return !m_FreeBlocksBySize.empty() ? m_FreeBlocksBySize.rbegin()->first : 0;
     }
 
+    // Calls Handler(Offset, Size) for every free block in the order of increasing offsets
+    template <typename HandlerType>
+    void ProcessFreeBlocks(HandlerType&& Handler) const
+    {
+        for (const auto& Block : m_FreeBlocksByOffset)
+            Handler(Block.first, Block.second.Size);
+    }
+
     void Extend(size_t ExtraSize)
     {
         size_t NewBlockOffset = m_MaxSize;
@@ -38,4 +38,39 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
                                             IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory);
 
+
+/// Default shader source stream factory create information
+struct DefaultShaderSourceStreamFactoryCreateInfo
+{
+    /// Semicolon-seprated list of search directories.
+    const Char* SearchDirectories DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to cache resolved file paths and file contents.
+
+    /// When the cache is enabled, every file is located in the search directories only once,
+    /// and its contents are loaded once and shared between all input streams and shader
+    /// compiler include handlers. The factory then also exposes the IShaderSourceFileCache interface.
+    Bool EnableCache DEFAULT_INITIALIZER(False);
+
+    /// Whether to memory-map cached files rather than read them into memory.
+
+    /// \note  Files must not be truncated while their mapped contents are in use.
+    Bool UseMemoryMapping DEFAULT_INITIALIZER(True);
+
+    /// Whether to check file time stamps every time a cached file is requested
+    /// and reload the files that have been modified.
+    Bool CheckFileTimeStamps DEFAULT_INITIALIZER(True);
+};
+typedef struct DefaultShaderSourceStreamFactoryCreateInfo DefaultShaderSourceStreamFactoryCreateInfo;
+
+#include "../../../Primitives/interface/DefineGlobalFuncHelperMacros.h"
+
+/// Creates a default shader source stream factory using the extended create information
+/// \param [in]  CreateInfo                  - Factory create information, see Diligent::DefaultShaderSourceStreamFactoryCreateInfo.
+/// \param [out] ppShaderSourceStreamFactory - Memory address where the pointer to the shader source stream factory will be written.
+void CreateDefaultShaderSourceStreamFactory2(const DefaultShaderSourceStreamFactoryCreateInfo REF CreateInfo,
+                                             IShaderSourceInputStreamFactory**                   ppShaderSourceStreamFactory);
+
+#include "../../../Primitives/interface/UndefGlobalFuncHelperMacros.h"
+
 DILIGENT_END_NAMESPACE // namespace Diligent
@@ -55,6 +55,8 @@ namespace Diligent
 // clang-format off
 bool VerifyDrawAttribs               (const DrawAttribs&                Attribs);
 bool VerifyDrawIndexedAttribs        (const DrawIndexedAttribs&         Attribs);
+bool VerifyMultiDrawAttribs          (const MultiDrawAttribs&           Attribs);
+bool VerifyMultiDrawIndexedAttribs   (const MultiDrawIndexedAttribs&    Attribs);
 bool VerifyDrawIndirectAttribs       (const DrawIndirectAttribs&        Attribs);
 bool VerifyDrawIndexedIndirectAttribs(const DrawIndexedIndirectAttribs& Attribs);
 
@@ -449,6 +451,18 @@ protected:
 
     inline bool SetStencilRef(Uint32 StencilRef, int Dummy);
 
+    /// Caches the dynamic cull mode and front face. Returns true if any value is different
+    /// from the cached value and false otherwise.
+    inline bool SetCullMode(CULL_MODE CullMode, bool FrontCounterClockwise, int Dummy);
+
+    /// Caches the dynamic depth-stencil state. Returns true if the state is different
+    /// from the cached value and false otherwise.
+    inline bool SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc, int Dummy);
+
+    /// Caches the dynamic primitive topology. Returns true if the topology is different
+    /// from the cached value and false otherwise.
+    inline bool SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology, int Dummy);
+
     inline void SetPipelineState(PipelineStateImplType* pPipelineState, int /*Dummy*/);
 
     /// Clears all cached resources
@@ -514,6 +528,8 @@ protected:
     // clang-format off
     void DvpVerifyDrawArguments                 (const DrawAttribs&                  Attribs) const;
     void DvpVerifyDrawIndexedArguments          (const DrawIndexedAttribs&           Attribs) const;
+    void DvpVerifyMultiDrawArguments            (const MultiDrawAttribs&             Attribs) const;
+    void DvpVerifyMultiDrawIndexedArguments     (const MultiDrawIndexedAttribs&      Attribs) const;
     void DvpVerifyDrawMeshArguments             (const DrawMeshAttribs&              Attribs) const;
     void DvpVerifyDrawIndirectArguments         (const DrawIndirectAttribs&          Attribs) const;
     void DvpVerifyDrawIndexedIndirectArguments  (const DrawIndexedIndirectAttribs&   Attribs) const;
@@ -540,6 +556,8 @@ protected:
     // clang-format off
     void DvpVerifyDrawArguments                 (const DrawAttribs&                  Attribs) const {}
     void DvpVerifyDrawIndexedArguments          (const DrawIndexedAttribs&           Attribs) const {}
+    void DvpVerifyMultiDrawArguments            (const MultiDrawAttribs&             Attribs) const {}
+    void DvpVerifyMultiDrawIndexedArguments     (const MultiDrawIndexedAttribs&      Attribs) const {}
     void DvpVerifyDrawMeshArguments             (const DrawMeshAttribs&              Attribs) const {}
     void DvpVerifyDrawIndirectArguments         (const DrawIndirectAttribs&          Attribs) const {}
     void DvpVerifyDrawIndexedIndirectArguments  (const DrawIndexedIndirectAttribs&   Attribs) const {}
@@ -610,6 +628,15 @@ protected:
     /// Current blend factors
     Float32 m_BlendFactors[4] = {-1, -1, -1, -1};
 
+    /// Current dynamic cull mode (only used with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE)
+    CULL_MODE m_CullMode = CULL_MODE_UNDEFINED;
+    /// Current dynamic front face (only used with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE)
+    bool m_FrontCounterClockwise = false;
+    /// Current dynamic depth-stencil state (only used with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE)
+    DepthStencilStateDesc m_DepthStencilState;
+    /// Current dynamic primitive topology (only used with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE)
+    PRIMITIVE_TOPOLOGY m_PrimitiveTopology = PRIMITIVE_TOPOLOGY_UNDEFINED;
+
     /// Current viewports
     Viewport m_Viewports[MAX_VIEWPORTS];
     /// Number of current viewports
@@ -756,8 +783,22 @@ inline void DeviceContextBase<ImplementationTraits>::SetPipelineState(
     DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_COMPUTE, "SetPipelineState");
     DEV_CHECK_ERR((pPipelineState->GetDesc().ImmediateContextMask & (Uint64{1} << GetExecutionCtxId())) != 0,
                   "PSO '", pPipelineState->GetDesc().Name, "' can't be used in device context '", m_Desc.Name, "'.");
+    DEV_CHECK_ERR(pPipelineState->GetStatus(false) == PIPELINE_STATE_STATUS_READY,
+                  "PSO '", pPipelineState->GetDesc().Name, "' is not ready. Use IPipelineState::GetStatus() to check the status of ",
+                  "pipelines created with PSO_CREATE_FLAG_ASYNCHRONOUS flag.");
 
     m_pPipelineState = pPipelineState;
+
+    if ((pPipelineState->GetCreateFlags() & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE) != 0)
+    {
+        // Dynamic states are reset to the values from the pipeline description every time the PSO is bound
+        const auto& GraphicsPipeline = pPipelineState->GetGraphicsPipelineDesc();
+
+        m_CullMode              = GraphicsPipeline.RasterizerDesc.CullMode;
+        m_FrontCounterClockwise = GraphicsPipeline.RasterizerDesc.FrontCounterClockwise;
+        m_DepthStencilState     = GraphicsPipeline.DepthStencilDesc;
+        m_PrimitiveTopology     = GraphicsPipeline.PrimitiveTopology;
+    }
 }
 
 template <typename ImplementationTraits>
@@ -855,6 +896,103 @@ inline bool DeviceContextBase<ImplementationTraits>::SetStencilRef(Uint32 Stenci
     return false;
 }
 
+#ifdef DILIGENT_DEVELOPMENT
+#    define DVP_CHECK_EXTENDED_DYNAMIC_STATE(MethodName)                                                                                \
+        do                                                                                                                               \
+        {                                                                                                                                \
+            DEV_CHECK_ERR(m_pDevice->GetFeatures().ExtendedDynamicState == DEVICE_FEATURE_STATE_ENABLED,                                \
+                          MethodName " requires ExtendedDynamicState device feature.");                                                  \
+            DEV_CHECK_ERR(m_pPipelineState, MethodName " requires a pipeline state to be bound.");                                      \
+            DEV_CHECK_ERR(!m_pPipelineState || (m_pPipelineState->GetCreateFlags() & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE) != 0,      \
+                          MethodName ": pipeline state '", m_pPipelineState->GetDesc().Name,                                             \
+                          "' was not created with PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag.");                                        \
+        } while (false)
+#else
+#    define DVP_CHECK_EXTENDED_DYNAMIC_STATE(...) \
+        do                                        \
+        {                                         \
+        } while (false)
+#endif
+
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::SetCullMode(CULL_MODE CullMode, bool FrontCounterClockwise, int)
+{
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "SetCullMode");
+    DVP_CHECK_EXTENDED_DYNAMIC_STATE("SetCullMode");
+    DEV_CHECK_ERR(CullMode > CULL_MODE_UNDEFINED && CullMode < CULL_MODE_NUM_MODES, "Invalid cull mode");
+
+    if (m_CullMode != CullMode || m_FrontCounterClockwise != FrontCounterClockwise)
+    {
+        m_CullMode              = CullMode;
+        m_FrontCounterClockwise = FrontCounterClockwise;
+        return true;
+    }
+    return false;
+}
+
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc, int)
+{
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "SetDepthStencilState");
+    DVP_CHECK_EXTENDED_DYNAMIC_STATE("SetDepthStencilState");
+    DEV_CHECK_ERR(DepthStencilDesc.DepthFunc != COMPARISON_FUNC_UNKNOWN, "Depth function must not be COMPARISON_FUNC_UNKNOWN");
+    DEV_CHECK_ERR(DepthStencilDesc.FrontFace.StencilFunc != COMPARISON_FUNC_UNKNOWN && DepthStencilDesc.BackFace.StencilFunc != COMPARISON_FUNC_UNKNOWN,
+                  "Stencil function must not be COMPARISON_FUNC_UNKNOWN");
+
+    if (!(m_DepthStencilState == DepthStencilDesc))
+    {
+        m_DepthStencilState = DepthStencilDesc;
+        return true;
+    }
+    return false;
+}
+
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology, int)
+{
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "SetPrimitiveTopology");
+    DVP_CHECK_EXTENDED_DYNAMIC_STATE("SetPrimitiveTopology");
+#ifdef DILIGENT_DEVELOPMENT
+    if (m_pPipelineState)
+    {
+        DEV_CHECK_ERR(m_pPipelineState->GetDesc().PipelineType == PIPELINE_TYPE_GRAPHICS,
+                      "SetPrimitiveTopology: primitive topology can only be set dynamically for graphics pipelines");
+        // Topology may only change within the same class (points, lines, triangles or patches
+        // with the same number of control points).
+        auto GetTopologyClass = [](PRIMITIVE_TOPOLOGY Topo) {
+            switch (Topo)
+            {
+                case PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+                case PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+                    return PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+                case PRIMITIVE_TOPOLOGY_LINE_LIST:
+                case PRIMITIVE_TOPOLOGY_LINE_STRIP:
+                    return PRIMITIVE_TOPOLOGY_LINE_LIST;
+
+                default:
+                    return Topo;
+            }
+        };
+
+        const auto PSOTopology = m_pPipelineState->GetGraphicsPipelineDesc().PrimitiveTopology;
+        DEV_CHECK_ERR(Topology > PRIMITIVE_TOPOLOGY_UNDEFINED && Topology < PRIMITIVE_TOPOLOGY_NUM_TOPOLOGIES, "Invalid primitive topology");
+        DEV_CHECK_ERR(GetTopologyClass(Topology) == GetTopologyClass(PSOTopology),
+                      "SetPrimitiveTopology: topology ", Uint32{Topology}, " is not in the same topology class as topology ",
+                      Uint32{PSOTopology}, " of pipeline state '", m_pPipelineState->GetDesc().Name, "'.");
+    }
+#endif
+
+    if (m_PrimitiveTopology != Topology)
+    {
+        m_PrimitiveTopology = Topology;
+        return true;
+    }
+    return false;
+}
+
+#undef DVP_CHECK_EXTENDED_DYNAMIC_STATE
+
 template <typename ImplementationTraits>
 inline void DeviceContextBase<ImplementationTraits>::SetViewports(
     Uint32          NumViewports,
@@ -1245,6 +1383,11 @@ inline void DeviceContextBase<ImplementationTraits>::ClearStateCache()
     for (int i = 0; i < 4; ++i)
         m_BlendFactors[i] = -1;
 
+    m_CullMode              = CULL_MODE_UNDEFINED;
+    m_FrontCounterClockwise = false;
+    m_DepthStencilState     = DepthStencilStateDesc{};
+    m_PrimitiveTopology     = PRIMITIVE_TOPOLOGY_UNDEFINED;
+
     for (Uint32 vp = 0; vp < m_NumViewports; ++vp)
         m_Viewports[vp] = Viewport();
     m_NumViewports = 0;
@@ -1825,6 +1968,8 @@ void DeviceContextBase<ImplementationTraits>::BuildTLAS(const BuildTLASAttribs&
     DEV_CHECK_ERR(m_pDevice->GetFeatures().RayTracing, "IDeviceContext::BuildTLAS: ray tracing is not supported by this device");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "IDeviceContext::BuildTLAS command must be performed outside of render pass");
     DEV_CHECK_ERR(VerifyBuildTLASAttribs(Attribs, m_pDevice->GetAdapterInfo().RayTracing), "BuildTLASAttribs are invalid");
+    DEV_CHECK_ERR(Attribs.pTLAS == nullptr || ClassPtrCast<TopLevelASType>(Attribs.pTLAS)->DvpValidateInstanceBuffer(Attribs),
+                  "IDeviceContext::BuildTLAS: instance buffer is not valid for the index-addressed update");
 }
 
 template <typename ImplementationTraits>
@@ -2112,6 +2257,41 @@ inline void DeviceContextBase<ImplementationTraits>::DvpVerifyDrawIndexedArgumen
     DEV_CHECK_ERR(VerifyDrawIndexedAttribs(Attribs), "DrawIndexedAttribs are invalid");
 }
 
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::DvpVerifyMultiDrawArguments(const MultiDrawAttribs& Attribs) const
+{
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) == 0)
+        return;
+
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "MultiDraw");
+
+    DEV_CHECK_ERR(m_pPipelineState, "MultiDraw command arguments are invalid: no pipeline state is bound.");
+
+    DEV_CHECK_ERR(m_pPipelineState->GetDesc().PipelineType == PIPELINE_TYPE_GRAPHICS,
+                  "MultiDraw command arguments are invalid: pipeline state '", m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+
+    DEV_CHECK_ERR(VerifyMultiDrawAttribs(Attribs), "MultiDrawAttribs are invalid");
+}
+
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::DvpVerifyMultiDrawIndexedArguments(const MultiDrawIndexedAttribs& Attribs) const
+{
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) == 0)
+        return;
+
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "MultiDrawIndexed");
+
+    DEV_CHECK_ERR(m_pPipelineState, "MultiDrawIndexed command arguments are invalid: no pipeline state is bound.");
+
+    DEV_CHECK_ERR(m_pPipelineState->GetDesc().PipelineType == PIPELINE_TYPE_GRAPHICS,
+                  "MultiDrawIndexed command arguments are invalid: pipeline state '",
+                  m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+
+    DEV_CHECK_ERR(m_pIndexBuffer, "MultiDrawIndexed command arguments are invalid: no index buffer is bound.");
+
+    DEV_CHECK_ERR(VerifyMultiDrawIndexedAttribs(Attribs), "MultiDrawIndexedAttribs are invalid");
+}
+
 template <typename ImplementationTraits>
 inline void DeviceContextBase<ImplementationTraits>::DvpVerifyDrawMeshArguments(const DrawMeshAttribs& Attribs) const
 {
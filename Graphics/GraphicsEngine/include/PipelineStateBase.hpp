@@ -35,6 +35,10 @@
 #include <unordered_set>
 #include <cstring>
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
 
 #include "PrivateConstants.h"
 #include "PipelineState.h"
@@ -45,6 +49,8 @@
 #include "FixedLinearAllocator.hpp"
 #include "HashUtils.hpp"
 #include "PipelineResourceSignatureBase.hpp"
+#include "PipelineStateCreateInfoCopy.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -176,7 +182,8 @@ public:
                       const PSOCreateInfoType& CreateInfo,
                       bool                     bIsDeviceInternal = false) :
         TDeviceObjectBase{pRefCounters, pDevice, CreateInfo.PSODesc, bIsDeviceInternal},
-        m_UsingImplicitSignature{CreateInfo.ppResourceSignatures == nullptr || CreateInfo.ResourceSignaturesCount == 0}
+        m_UsingImplicitSignature{CreateInfo.ppResourceSignatures == nullptr || CreateInfo.ResourceSignaturesCount == 0},
+        m_CreateFlags{CreateInfo.Flags}
     {
         try
         {
@@ -278,6 +285,17 @@ public:
         return m_pGraphicsPipelineData->pRenderPass;
     }
 
+    PSO_CREATE_FLAGS GetCreateFlags() const { return m_CreateFlags; }
+
+    /// Implementation of IPipelineState::GetStatus().
+    virtual PIPELINE_STATE_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final
+    {
+        if (WaitForCompletion)
+            this->WaitForAsyncInitialization();
+
+        return m_Status.load();
+    }
+
     virtual const GraphicsPipelineDesc& DILIGENT_CALL_TYPE GetGraphicsPipelineDesc() const override final
     {
         VERIFY_EXPR(this->m_Desc.IsAnyGraphicsPipeline());
@@ -1096,6 +1114,100 @@ private:
         }
     }
 
+protected:
+    /// Initializes the pipeline by calling PipelineStateImplType::InitializePipeline().
+
+    /// If the pipeline was created with PSO_CREATE_FLAG_ASYNCHRONOUS flag and the device
+    /// provides the asynchronous pipeline thread pool, the initialization is performed
+    /// by one of the pool threads. Otherwise, the pipeline is initialized immediately.
+    template <typename PSOCreateInfoType>
+    void Construct(const PSOCreateInfoType& CreateInfo)
+    {
+        auto* pThreadPool = (CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0 ?
+            this->GetDevice()->GetAsyncPipelineThreadPool() :
+            nullptr;
+
+        if (pThreadPool != nullptr)
+        {
+            InitializePipelineAsync(*pThreadPool, CreateInfo);
+        }
+        else
+        {
+            static_cast<PipelineStateImplType*>(this)->InitializePipeline(CreateInfo);
+            m_Status.store(PIPELINE_STATE_STATUS_READY);
+        }
+    }
+
+    /// Waits until the asynchronous initialization task, if any, has finished.
+
+    /// \note   Backend implementations must call this method in the destructor before
+    ///         releasing any resources, as the task may still be running.
+    void WaitForAsyncInitialization()
+    {
+        if (!m_pAsyncInitData)
+            return;
+
+        // The mutex must be acquired even if the status is not COMPILING, to make sure
+        // that the task has left the critical section where it updates the status.
+        std::unique_lock<std::mutex> Lock{m_pAsyncInitData->Mtx};
+        m_pAsyncInitData->CondVar.wait(Lock, [this]() { return m_Status.load() != PIPELINE_STATE_STATUS_COMPILING; });
+    }
+
+private:
+    void InitializePipelineAsync(ThreadPool& Pool, const GraphicsPipelineStateCreateInfo& CreateInfo)
+    {
+        EnqueueInitialization(Pool, CreateInfo);
+    }
+
+    void InitializePipelineAsync(ThreadPool& Pool, const ComputePipelineStateCreateInfo& CreateInfo)
+    {
+        EnqueueInitialization(Pool, CreateInfo);
+    }
+
+    template <typename PSOCreateInfoType>
+    void InitializePipelineAsync(ThreadPool&, const PSOCreateInfoType& CreateInfo)
+    {
+        UNEXPECTED("Asynchronous initialization is only supported for graphics and compute pipelines. "
+                   "This error should've been caught by ValidatePSOCreateFlags().");
+        static_cast<PipelineStateImplType*>(this)->InitializePipeline(CreateInfo);
+        m_Status.store(PIPELINE_STATE_STATUS_READY);
+    }
+
+    template <typename PSOCreateInfoType>
+    void EnqueueInitialization(ThreadPool& Pool, const PSOCreateInfoType& CreateInfo)
+    {
+        m_pAsyncInitData.reset(new AsyncInitData{});
+        m_Status.store(PIPELINE_STATE_STATUS_COMPILING);
+
+        // The original create info may go out of scope before the task is executed, so
+        // make a copy that also keeps strong references to shaders and resource signatures.
+        // The task keeps the raw pointer to the pipeline as the pipeline waits for the
+        // task to finish in its destructor.
+        auto pCreateInfoCopy = std::make_shared<PipelineStateCreateInfoCopy<PSOCreateInfoType>>(CreateInfo);
+        Pool.EnqueueTask(
+            [this, pCreateInfoCopy]() mutable //
+            {
+                auto Status = PIPELINE_STATE_STATUS_READY;
+                try
+                {
+                    static_cast<PipelineStateImplType*>(this)->InitializePipeline(pCreateInfoCopy->Get());
+                }
+                catch (...)
+                {
+                    LOG_ERROR_MESSAGE("Asynchronous initialization of pipeline state '", this->m_Desc.Name, "' has failed");
+                    Status = PIPELINE_STATE_STATUS_FAILED;
+                }
+                // Release shaders and signatures before the pipeline can be destroyed
+                pCreateInfoCopy.reset();
+
+                // Notify while holding the lock: the pipeline may be destroyed as soon as
+                // the waiting thread observes the new status.
+                std::lock_guard<std::mutex> Lock{m_pAsyncInitData->Mtx};
+                m_Status.store(Status);
+                m_pAsyncInitData->CondVar.notify_all();
+            });
+    }
+
 protected:
     /// Shader stages that are active in this PSO.
     SHADER_TYPE m_ActiveShaderStages = SHADER_TYPE_UNKNOWN;
@@ -1103,6 +1215,9 @@ protected:
     /// True if the pipeline was created using implicit root signature.
     const bool m_UsingImplicitSignature;
 
+    /// Flags the pipeline was created with, see Diligent::PSO_CREATE_FLAGS.
+    const PSO_CREATE_FLAGS m_CreateFlags;
+
     /// The number of signatures in m_Signatures array.
     /// Note that this is not necessarily the same as the number of signatures
     /// that were used to create the pipeline, because signatures are arranged
@@ -1156,6 +1271,17 @@ protected:
         void*                   m_pPipelineDataRawMem = nullptr;
     };
 
+    /// Pipeline initialization status, see Diligent::PIPELINE_STATE_STATUS.
+    std::atomic<PIPELINE_STATE_STATUS> m_Status{PIPELINE_STATE_STATUS_UNINITIALIZED};
+
+    struct AsyncInitData
+    {
+        std::mutex              Mtx;
+        std::condition_variable CondVar;
+    };
+    /// Synchronization objects that are only allocated for asynchronously initialized pipelines.
+    std::unique_ptr<AsyncInitData> m_pAsyncInitData;
+
 #ifdef DILIGENT_DEBUG
     bool m_IsDestructed = false;
 #endif
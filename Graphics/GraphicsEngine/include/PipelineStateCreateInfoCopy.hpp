@@ -0,0 +1,183 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::PipelineStateCreateInfoCopy class
+
+#include <deque>
+#include <vector>
+
+#include "PipelineState.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Base class that copies the members that are common to all pipeline state create info structures.
+class PipelineStateCreateInfoCopyBase
+{
+protected:
+    /// Replaces all pointers in the create info with pointers to the data owned by this object.
+    void CopyCommonMembers(PipelineStateCreateInfo& CreateInfo)
+    {
+        auto& PSODesc = CreateInfo.PSODesc;
+        PSODesc.Name  = CopyString(PSODesc.Name);
+
+        auto& ResLayout = PSODesc.ResourceLayout;
+        if (ResLayout.Variables != nullptr)
+        {
+            m_Variables.assign(ResLayout.Variables, ResLayout.Variables + ResLayout.NumVariables);
+            for (auto& Var : m_Variables)
+                Var.Name = CopyString(Var.Name);
+            ResLayout.Variables = m_Variables.data();
+        }
+
+        if (ResLayout.ImmutableSamplers != nullptr)
+        {
+            m_ImmutableSamplers.assign(ResLayout.ImmutableSamplers, ResLayout.ImmutableSamplers + ResLayout.NumImmutableSamplers);
+            for (auto& ImtblSam : m_ImmutableSamplers)
+            {
+                ImtblSam.SamplerOrTextureName = CopyString(ImtblSam.SamplerOrTextureName);
+                ImtblSam.Desc.Name            = CopyString(ImtblSam.Desc.Name);
+            }
+            ResLayout.ImmutableSamplers = m_ImmutableSamplers.data();
+        }
+
+        if (CreateInfo.ppResourceSignatures != nullptr)
+        {
+            m_Signatures.reserve(CreateInfo.ResourceSignaturesCount);
+            m_ppSignatures.reserve(CreateInfo.ResourceSignaturesCount);
+            for (Uint32 i = 0; i < CreateInfo.ResourceSignaturesCount; ++i)
+            {
+                m_Signatures.emplace_back(CreateInfo.ppResourceSignatures[i]);
+                m_ppSignatures.emplace_back(CreateInfo.ppResourceSignatures[i]);
+            }
+            CreateInfo.ppResourceSignatures = m_ppSignatures.data();
+        }
+    }
+
+    const Char* CopyString(const Char* Str)
+    {
+        if (Str == nullptr)
+            return nullptr;
+
+        m_Strings.emplace_back(Str);
+        return m_Strings.back().c_str();
+    }
+
+    void AddShader(IShader* pShader)
+    {
+        if (pShader != nullptr)
+            m_Shaders.emplace_back(pShader);
+    }
+
+private:
+    // Deque never moves its elements, so string pointers remain valid
+    std::deque<String>                                     m_Strings;
+    std::vector<ShaderResourceVariableDesc>                m_Variables;
+    std::vector<ImmutableSamplerDesc>                      m_ImmutableSamplers;
+    std::vector<RefCntAutoPtr<IPipelineResourceSignature>> m_Signatures;
+    std::vector<IPipelineResourceSignature*>               m_ppSignatures;
+    std::vector<RefCntAutoPtr<IShader>>                    m_Shaders;
+};
+
+
+/// Deep copy of the pipeline state create info.
+
+/// The copy owns all strings and arrays referenced by the create info and keeps strong
+/// references to the shaders, resource signatures and the render pass, so that the pipeline
+/// can be initialized after the original create info structure goes out of scope.
+template <typename PSOCreateInfoType>
+class PipelineStateCreateInfoCopy;
+
+template <>
+class PipelineStateCreateInfoCopy<GraphicsPipelineStateCreateInfo> : public PipelineStateCreateInfoCopyBase
+{
+public:
+    explicit PipelineStateCreateInfoCopy(const GraphicsPipelineStateCreateInfo& CreateInfo) :
+        m_CreateInfo{CreateInfo}
+    {
+        CopyCommonMembers(m_CreateInfo);
+
+        auto& GraphicsPipeline = m_CreateInfo.GraphicsPipeline;
+        auto& InputLayout      = GraphicsPipeline.InputLayout;
+        if (InputLayout.LayoutElements != nullptr)
+        {
+            m_LayoutElements.assign(InputLayout.LayoutElements, InputLayout.LayoutElements + InputLayout.NumElements);
+            for (auto& Elem : m_LayoutElements)
+                Elem.HLSLSemantic = CopyString(Elem.HLSLSemantic);
+            InputLayout.LayoutElements = m_LayoutElements.data();
+        }
+
+        m_pRenderPass = GraphicsPipeline.pRenderPass;
+
+        for (auto* pShader : {m_CreateInfo.pVS, m_CreateInfo.pPS, m_CreateInfo.pDS, m_CreateInfo.pHS, m_CreateInfo.pGS, m_CreateInfo.pAS, m_CreateInfo.pMS})
+            AddShader(pShader);
+    }
+
+    // clang-format off
+    PipelineStateCreateInfoCopy           (const PipelineStateCreateInfoCopy&)  = delete;
+    PipelineStateCreateInfoCopy           (      PipelineStateCreateInfoCopy&&) = delete;
+    PipelineStateCreateInfoCopy& operator=(const PipelineStateCreateInfoCopy&)  = delete;
+    PipelineStateCreateInfoCopy& operator=(      PipelineStateCreateInfoCopy&&) = delete;
+    // clang-format on
+
+    const GraphicsPipelineStateCreateInfo& Get() const { return m_CreateInfo; }
+
+private:
+    GraphicsPipelineStateCreateInfo m_CreateInfo;
+    std::vector<LayoutElement>      m_LayoutElements;
+    RefCntAutoPtr<IRenderPass>      m_pRenderPass;
+};
+
+template <>
+class PipelineStateCreateInfoCopy<ComputePipelineStateCreateInfo> : public PipelineStateCreateInfoCopyBase
+{
+public:
+    explicit PipelineStateCreateInfoCopy(const ComputePipelineStateCreateInfo& CreateInfo) :
+        m_CreateInfo{CreateInfo}
+    {
+        CopyCommonMembers(m_CreateInfo);
+        AddShader(m_CreateInfo.pCS);
+    }
+
+    // clang-format off
+    PipelineStateCreateInfoCopy           (const PipelineStateCreateInfoCopy&)  = delete;
+    PipelineStateCreateInfoCopy           (      PipelineStateCreateInfoCopy&&) = delete;
+    PipelineStateCreateInfoCopy& operator=(const PipelineStateCreateInfoCopy&)  = delete;
+    PipelineStateCreateInfoCopy& operator=(      PipelineStateCreateInfoCopy&&) = delete;
+    // clang-format on
+
+    const ComputePipelineStateCreateInfo& Get() const { return m_CreateInfo; }
+
+private:
+    ComputePipelineStateCreateInfo m_CreateInfo;
+};
+
+} // namespace Diligent
@@ -30,6 +30,9 @@
 /// \file
 /// Implementation of the Diligent::RenderDeviceBase template class and related structures
 
+#include <memory>
+#include <mutex>
+
 #include "RenderDevice.h"
 #include "DeviceObjectBase.hpp"
 #include "Defines.h"
@@ -44,6 +47,7 @@
 #include "EngineMemory.h"
 #include "STDAllocator.hpp"
 #include "IndexWrapper.hpp"
+#include "ThreadPool.hpp"
 
 namespace std
 {
@@ -248,6 +252,7 @@ public:
         m_pEngineFactory        {pEngineFactory},
         m_ValidationFlags       {EngineCI.ValidationFlags},
         m_AdapterInfo           {AdapterInfo},
+        m_NumAsyncPSOThreads    {EngineCI.NumAsyncPipelineCompilationThreads},
         m_SamplersRegistry      {RawMemAllocator, "sampler"},
         m_TextureFormatsInfo    (TEX_FORMAT_NUM_FORMATS, TextureFormatInfoExt(), STD_ALLOCATOR_RAW_MEM(TextureFormatInfoExt, RawMemAllocator, "Allocator for vector<TextureFormatInfoExt>")),
         m_TexFmtInfoInitFlags   (TEX_FORMAT_NUM_FORMATS, false, STD_ALLOCATOR_RAW_MEM(bool, RawMemAllocator, "Allocator for vector<bool>")),
@@ -446,6 +451,41 @@ public:
         return m_DeviceInfo.Features;
     }
 
+    /// Returns the thread pool that initializes pipelines created with PSO_CREATE_FLAG_ASYNCHRONOUS flag,
+    /// or null if asynchronous pipeline creation is disabled or not supported by the device.
+    /// The pool is created when this method is called for the first time.
+    ThreadPool* GetAsyncPipelineThreadPool()
+    {
+        if (m_NumAsyncPSOThreads == 0 || !GetFeatures().MultithreadedResourceCreation)
+            return nullptr;
+
+        std::call_once(m_AsyncPipelineThreadPoolFlag,
+                       [this]() //
+                       {
+                           const size_t NumThreads = m_NumAsyncPSOThreads != ~Uint32{0} ?
+                               size_t{m_NumAsyncPSOThreads} :
+                               std::max(size_t{std::thread::hardware_concurrency()}, size_t{1});
+                           m_pAsyncPipelineThreadPool.reset(new ThreadPool{NumThreads});
+                       });
+        return m_pAsyncPipelineThreadPool.get();
+    }
+
+    /// Returns the thread pool that helps the calling thread with short data-parallel tasks
+    /// (see Diligent::ParallelFor), or null if the system has a single hardware thread.
+    /// The pool is created when this method is called for the first time.
+    ThreadPool* GetWorkerThreadPool()
+    {
+        std::call_once(m_WorkerThreadPoolFlag,
+                       [this]() //
+                       {
+                           // The calling thread takes part in the work, so one thread less is needed
+                           const auto NumThreads = std::thread::hardware_concurrency();
+                           if (NumThreads > 1)
+                               m_pWorkerThreadPool.reset(new ThreadPool{size_t{NumThreads} - 1});
+                       });
+        return m_pWorkerThreadPool.get();
+    }
+
 protected:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) = 0;
 
@@ -659,6 +699,14 @@ protected:
     GraphicsAdapterInfo    m_AdapterInfo;
     RenderDeviceInfo       m_DeviceInfo;
 
+    /// The number of threads in the asynchronous pipeline thread pool, see EngineCreateInfo::NumAsyncPipelineCompilationThreads.
+    const Uint32                m_NumAsyncPSOThreads;
+    std::once_flag              m_AsyncPipelineThreadPoolFlag;
+    std::unique_ptr<ThreadPool> m_pAsyncPipelineThreadPool;
+
+    std::once_flag              m_WorkerThreadPoolFlag;
+    std::unique_ptr<ThreadPool> m_pWorkerThreadPool;
+
     // All state object registries hold raw pointers.
     // This is safe because every object unregisters itself
     // when it is deleted.
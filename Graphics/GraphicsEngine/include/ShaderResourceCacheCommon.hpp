@@ -57,16 +57,63 @@ public:
     }
 #endif
 
+    // Elements of bindless arrays may be changed after the cache has been committed
+    // (see PIPELINE_RESOURCE_FLAG_BINDLESS), so such changes do not update the revision
+    // while the scope is alive.
+    // The scope only affects the descriptor set (root table in Direct3D12) that contains
+    // the bindless array, so that regular resources that are concurrently bound to other sets
+    // of the same cache still update the revision.
+    class BindlessUpdateScope
+    {
+    public:
+#ifdef DILIGENT_DEVELOPMENT
+        BindlessUpdateScope(ShaderResourceCacheBase& Cache, bool IsBindless, Uint32 SetIndex) noexcept :
+            m_pCounter{IsBindless ? &Cache.GetBindlessUpdateCounter(SetIndex) : nullptr}
+        {
+            if (m_pCounter != nullptr)
+                m_pCounter->fetch_add(1);
+        }
+
+        ~BindlessUpdateScope()
+        {
+            if (m_pCounter != nullptr)
+                m_pCounter->fetch_add(-1);
+        }
+
+    private:
+        std::atomic<int32_t>* const m_pCounter;
+#else
+        BindlessUpdateScope(ShaderResourceCacheBase&, bool, Uint32) noexcept
+        {}
+#endif
+    };
+
 protected:
-    void UpdateRevision()
+    // SetIndex is the index of the descriptor set (root table) that contains the changed resource.
+    void UpdateRevision(Uint32 SetIndex = 0)
     {
 #ifdef DILIGENT_DEVELOPMENT
-        m_DvpRevision.fetch_add(1);
+        if (GetBindlessUpdateCounter(SetIndex).load() == 0)
+            m_DvpRevision.fetch_add(1);
 #endif
     }
 
 #ifdef DILIGENT_DEVELOPMENT
+private:
+    // Sets whose indices are equal modulo the counter count share the counter, which may
+    // only result in a missed revision update.
+    static constexpr Uint32 NumBindlessUpdateCounters = 4;
+
+    std::atomic<int32_t>& GetBindlessUpdateCounter(Uint32 SetIndex)
+    {
+        return m_DvpBindlessUpdateCounters[SetIndex % NumBindlessUpdateCounters];
+    }
+
+protected:
     std::atomic<uint32_t> m_DvpRevision{0};
+
+private:
+    std::atomic<int32_t> m_DvpBindlessUpdateCounters[NumBindlessUpdateCounters] = {};
 #endif
 };
 
@@ -123,6 +123,13 @@ inline Uint32 GetAllowedTypeBits(const SHADER_RESOURCE_VARIABLE_TYPE* AllowedVar
     return AllowedTypeBits;
 }
 
+// Returns true if a resource that is already bound to the variable may be replaced with
+// another resource or reset to null: this is the case for dynamic variables and bindless arrays.
+inline bool IsResourceRebindable(const PipelineResourceDesc& ResDesc) noexcept
+{
+    return ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC || (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0;
+}
+
 struct BindResourceInfo
 {
     IDeviceObject* const pObject;
@@ -176,7 +183,7 @@ bool VerifyResourceBinding(const char*                 ExpectedResourceTypeName,
         return false;
     }
 
-    if (ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC && pCachedObject != nullptr && pCachedObject != pResourceImpl)
+    if (!IsResourceRebindable(ResDesc) && pCachedObject != nullptr && pCachedObject != pResourceImpl)
     {
         auto VarTypeStr = GetShaderVariableTypeLiteralName(ResDesc.VarType);
 
@@ -271,7 +278,7 @@ bool VerifyConstantBufferBinding(const PipelineResourceDesc& ResDesc,
             BindingOK = false;
         }
 
-        if (!RangeIsOutOfBounds && ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC && pCachedBuffer != nullptr)
+        if (!RangeIsOutOfBounds && !IsResourceRebindable(ResDesc) && pCachedBuffer != nullptr)
         {
             if (CachedRangeSize == 0)
                 CachedRangeSize = BuffDesc.Size - CachedBaseOffset;
@@ -654,6 +661,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
     virtual void DILIGENT_CALL_TYPE Set(IDeviceObject* pObject) override final
     {
         static_cast<ThisImplType*>(this)->BindResource(BindResourceInfo{pObject});
+        static_cast<ThisImplType*>(this)->OnResourcesBound();
     }
 
     virtual void DILIGENT_CALL_TYPE SetArray(IDeviceObject* const* ppObjects,
@@ -668,6 +676,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
         for (Uint32 elem = 0; elem < NumElements; ++elem)
             static_cast<ThisImplType*>(this)->BindResource(BindResourceInfo{FirstElement + elem, ppObjects[elem]});
+        static_cast<ThisImplType*>(this)->OnResourcesBound();
     }
 
     virtual void DILIGENT_CALL_TYPE SetBufferRange(IDeviceObject* pObject,
@@ -677,6 +686,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
     {
         DEV_CHECK_ERR(GetDesc().ResourceType == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, "SetBufferRange() is only allowed for constant buffers.");
         static_cast<ThisImplType*>(this)->BindResource(BindResourceInfo{ArrayIndex, pObject, Offset, Size});
+        static_cast<ThisImplType*>(this)->OnResourcesBound();
     }
 
     virtual void DILIGENT_CALL_TYPE SetBufferOffset(Uint32 Offset,
@@ -714,6 +724,11 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
         return m_ParentManager.GetVariableIndex(*static_cast<const ThisImplType*>(this));
     }
 
+    // Called once after Set(), SetArray() or SetBufferRange() have bound all their resources.
+    // Implementations that defer descriptor writes may hide this method to flush them once per call
+    // rather than once per array element.
+    void OnResourcesBound() const {}
+
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
     {
         auto* const pThis   = static_cast<ThisImplType*>(this);
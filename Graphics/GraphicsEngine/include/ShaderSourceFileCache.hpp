@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the shader source file cache interface
+
+#include "../../GraphicsEngine/interface/Shader.h"
+
+namespace Diligent
+{
+
+// {5B8C7E0D-1F6A-4C3B-9E2D-7A41C6B3F920}
+static const INTERFACE_ID IID_ShaderSourceFileCache =
+    {0x5b8c7e0d, 0x1f6a, 0x4c3b, {0x9e, 0x2d, 0x7a, 0x41, 0xc6, 0xb3, 0xf9, 0x20}};
+
+/// Shader source file cache statistics.
+struct ShaderSourceFileCacheStats
+{
+    /// The total number of bytes loaded from disk (mapped or read).
+    Uint64 BytesRead = 0;
+
+    /// The total number of bytes served from the cache without accessing the disk.
+    Uint64 BytesServedFromCache = 0;
+
+    /// The number of files loaded from disk.
+    Uint32 NumFileLoads = 0;
+
+    /// The number of requests served from the cache.
+    Uint32 NumCacheHits = 0;
+
+    /// The number of cached files that were reloaded because their contents were modified on disk.
+    Uint32 NumInvalidations = 0;
+
+    /// The number of file names resolved by probing the search directories.
+    Uint32 NumPathResolutions = 0;
+
+    /// The number of file names resolved using the memoized search results.
+    Uint32 NumResolvedPathHits = 0;
+};
+
+/// Shader source stream factory that caches resolved file paths and
+/// shared immutable file contents.
+
+/// The interface is exposed by the default shader source stream factory
+/// when it is created with the cache enabled (see Diligent::DefaultShaderSourceStreamFactoryCreateInfo).
+/// Shader compilers query it to load #include files without copying their contents.
+/// All methods are thread-safe.
+struct IShaderSourceFileCache : public IShaderSourceInputStreamFactory
+{
+    /// Finds the file in the search directories and returns its contents.
+
+    /// \param [in]  Name       - File name.
+    /// \param [in]  Flags      - Flags that control the behavior, see Diligent::CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS.
+    /// \param [out] ppContents - Memory address where the pointer to the data blob will be written.
+    ///                           The blob is shared between all users and must not be modified.
+    /// \param [out] pHash      - Optional memory address where the hash of the file contents will be written.
+    ///
+    /// \remarks    If the file is not found, *ppContents is set to null.
+    ///             When the file time stamp changes, the file is reloaded, but the cached
+    ///             data blob is kept if the hash of the new contents matches the cached one.
+    virtual void DILIGENT_CALL_TYPE GetFileContents(const Char*                             Name,
+                                                    CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                    IDataBlob**                             ppContents,
+                                                    size_t*                                 pHash = nullptr) = 0;
+
+    /// Returns the cache statistics, see Diligent::ShaderSourceFileCacheStats.
+    virtual void DILIGENT_CALL_TYPE GetStats(ShaderSourceFileCacheStats& Stats) = 0;
+
+    /// Removes all resolved paths and file contents from the cache.
+
+    /// \remarks    Data blobs that are still referenced by the users remain valid.
+    virtual void DILIGENT_CALL_TYPE Clear() = 0;
+};
+
+} // namespace Diligent
@@ -31,6 +31,8 @@
 /// Implementation of the Diligent::TopLevelASBase template class
 
 #include <unordered_map>
+#include <vector>
+#include <algorithm>
 #include <atomic>
 
 #include "TopLevelAS.h"
@@ -39,6 +41,7 @@
 #include "RenderDeviceBase.hpp"
 #include "StringPool.hpp"
 #include "HashUtils.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -64,8 +67,8 @@ private:
 
     struct InstanceDesc
     {
+        const char*                          Name                        = nullptr;
         Uint32                               ContributionToHitGroupIndex = 0;
-        Uint32                               InstanceIndex               = 0;
         RefCntAutoPtr<BottomLevelASImplType> pBLAS;
 #ifdef DILIGENT_DEVELOPMENT
         Uint32 dvpVersion = 0;
@@ -75,6 +78,13 @@ private:
 public:
     using TDeviceObjectBase = DeviceObjectBase<BaseInterface, RenderDeviceImplType, TopLevelASDesc>;
 
+    /// Contiguous range of instance indices.
+    struct InstanceRange
+    {
+        Uint32 First = 0;
+        Uint32 Count = 0;
+    };
+
     /// \param pRefCounters      - Reference counters object that controls the lifetime of this TLAS.
     /// \param pDevice           - Pointer to the device.
     /// \param Desc              - TLAS description.
@@ -98,16 +108,16 @@ public:
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_TopLevelAS, TDeviceObjectBase)
 
-    bool SetInstanceData(const TLASBuildInstanceData* pInstances,
-                         const Uint32                 InstanceCount,
-                         const Uint32                 BaseContributionToHitGroupIndex,
-                         const Uint32                 HitGroupStride,
-                         const HIT_GROUP_BINDING_MODE BindingMode) noexcept
+    /// Initializes the instances from BuildTLASAttribs::pInstances and marks all of them dirty.
+    bool SetInstanceData(const BuildTLASAttribs& Attribs) noexcept
     {
         try
         {
             ClearInstanceData();
 
+            const auto* const pInstances    = Attribs.pInstances;
+            const Uint32      InstanceCount = Attribs.InstanceCount;
+
             size_t StringPoolSize = 0;
             for (Uint32 i = 0; i < InstanceCount; ++i)
             {
@@ -116,39 +126,42 @@ public:
             }
 
             this->m_StringPool.Reserve(StringPoolSize, GetRawAllocator());
+            this->m_Instances.resize(InstanceCount);
+            this->m_NameToIndex.reserve(InstanceCount);
 
-            Uint32 InstanceOffset = BaseContributionToHitGroupIndex;
+            Uint32 InstanceOffset = Attribs.BaseContributionToHitGroupIndex;
 
             for (Uint32 i = 0; i < InstanceCount; ++i)
             {
-                const auto&  Inst     = pInstances[i];
-                const char*  NameCopy = this->m_StringPool.CopyString(Inst.InstanceName);
-                InstanceDesc Desc     = {};
+                const auto& Inst = pInstances[i];
+                auto&       Desc = this->m_Instances[i];
 
+                Desc.Name                        = this->m_StringPool.CopyString(Inst.InstanceName);
                 Desc.pBLAS                       = ClassPtrCast<BottomLevelASImplType>(Inst.pBLAS);
                 Desc.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
-                Desc.InstanceIndex               = i;
-                CalculateHitGroupIndex(Desc, InstanceOffset, HitGroupStride, BindingMode);
+                CalculateHitGroupIndex(Desc, InstanceOffset, Attribs.HitGroupStride, Attribs.BindingMode);
 
 #ifdef DILIGENT_DEVELOPMENT
                 Desc.dvpVersion = Desc.pBLAS->DvpGetVersion();
 #endif
-                bool IsUniqueName = this->m_Instances.emplace(NameCopy, Desc).second;
+                bool IsUniqueName = this->m_NameToIndex.emplace(Desc.Name, i).second;
                 if (!IsUniqueName)
                     LOG_ERROR_AND_THROW("Instance name must be unique!");
             }
 
             VERIFY_EXPR(this->m_StringPool.GetRemainingSize() == 0);
 
-            InstanceOffset = InstanceOffset + (BindingMode == HIT_GROUP_BINDING_MODE_PER_TLAS ? HitGroupStride : 0) - 1;
+            InstanceOffset = InstanceOffset + (Attribs.BindingMode == HIT_GROUP_BINDING_MODE_PER_TLAS ? Attribs.HitGroupStride : 0) - 1;
 
-            this->m_BuildInfo.HitGroupStride                   = HitGroupStride;
-            this->m_BuildInfo.FirstContributionToHitGroupIndex = BaseContributionToHitGroupIndex;
+            this->m_BuildInfo.HitGroupStride                   = Attribs.HitGroupStride;
+            this->m_BuildInfo.FirstContributionToHitGroupIndex = Attribs.BaseContributionToHitGroupIndex;
             this->m_BuildInfo.LastContributionToHitGroupIndex  = InstanceOffset;
-            this->m_BuildInfo.BindingMode                      = BindingMode;
+            this->m_BuildInfo.BindingMode                      = Attribs.BindingMode;
             this->m_BuildInfo.InstanceCount                    = InstanceCount;
 
+            MarkAllInstancesDirty();
 #ifdef DILIGENT_DEVELOPMENT
+            DvpSetInstanceBuffer(Attribs);
             this->m_DvpVersion.fetch_add(1);
 #endif
             return true;
@@ -163,61 +176,20 @@ public:
         }
     }
 
-    bool UpdateInstances(const TLASBuildInstanceData* pInstances,
-                         const Uint32                 InstanceCount,
-                         const Uint32                 BaseContributionToHitGroupIndex,
-                         const Uint32                 HitGroupStride,
-                         const HIT_GROUP_BINDING_MODE BindingMode) noexcept
+    /// Updates the instances from BuildTLASAttribs::pInstances and marks the instances
+    /// that must be written to the instance buffer dirty.
+    bool UpdateInstances(const BuildTLASAttribs& Attribs) noexcept
     {
-        VERIFY_EXPR(this->m_BuildInfo.InstanceCount == InstanceCount);
-#ifdef DILIGENT_DEVELOPMENT
-        bool Changed = false;
-#endif
-        Uint32 InstanceOffset = BaseContributionToHitGroupIndex;
-
-        for (Uint32 i = 0; i < InstanceCount; ++i)
-        {
-            const auto& Inst = pInstances[i];
-            auto        Iter = this->m_Instances.find(Inst.InstanceName);
-
-            if (Iter == this->m_Instances.end())
-            {
-                UNEXPECTED("Failed to find instance with name '", Inst.InstanceName, "' in instances from the previous build");
-                return false;
-            }
-
-            auto&      Desc      = Iter->second;
-            const auto PrevIndex = Desc.ContributionToHitGroupIndex;
-            const auto pPrevBLAS = Desc.pBLAS;
-
-            Desc.pBLAS                       = ClassPtrCast<BottomLevelASImplType>(Inst.pBLAS);
-            Desc.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
-            //Desc.InstanceIndex             = i; // keep Desc.InstanceIndex unmodified
-            CalculateHitGroupIndex(Desc, InstanceOffset, HitGroupStride, BindingMode);
+        VERIFY_EXPR(this->m_BuildInfo.InstanceCount == Attribs.InstanceCount);
 
+        const bool Updated = Attribs.pDirtyInstanceIndices != nullptr ?
+            UpdateDirtyInstances(Attribs) :
+            UpdateAllInstances(Attribs);
 #ifdef DILIGENT_DEVELOPMENT
-            Changed         = Changed || (pPrevBLAS != Desc.pBLAS);
-            Changed         = Changed || (PrevIndex != Desc.ContributionToHitGroupIndex);
-            Desc.dvpVersion = Desc.pBLAS->DvpGetVersion();
+        if (Updated)
+            DvpSetInstanceBuffer(Attribs);
 #endif
-        }
-
-        InstanceOffset = InstanceOffset + (BindingMode == HIT_GROUP_BINDING_MODE_PER_TLAS ? HitGroupStride : 0) - 1;
-
-#ifdef DILIGENT_DEVELOPMENT
-        Changed = Changed || (this->m_BuildInfo.HitGroupStride != HitGroupStride);
-        Changed = Changed || (this->m_BuildInfo.FirstContributionToHitGroupIndex != BaseContributionToHitGroupIndex);
-        Changed = Changed || (this->m_BuildInfo.LastContributionToHitGroupIndex != InstanceOffset);
-        Changed = Changed || (this->m_BuildInfo.BindingMode != BindingMode);
-        if (Changed)
-            this->m_DvpVersion.fetch_add(1);
-#endif
-        this->m_BuildInfo.HitGroupStride                   = HitGroupStride;
-        this->m_BuildInfo.FirstContributionToHitGroupIndex = BaseContributionToHitGroupIndex;
-        this->m_BuildInfo.LastContributionToHitGroupIndex  = InstanceOffset;
-        this->m_BuildInfo.BindingMode                      = BindingMode;
-
-        return true;
+        return Updated;
     }
 
     void CopyInstancceData(const TopLevelASBase& Src) noexcept
@@ -226,11 +198,14 @@ public:
 
         this->m_StringPool.Reserve(Src.m_StringPool.GetReservedSize(), GetRawAllocator());
         this->m_BuildInfo = Src.m_BuildInfo;
+        this->m_Instances = Src.m_Instances;
+        this->m_NameToIndex.reserve(this->m_Instances.size());
 
-        for (auto& SrcInst : Src.m_Instances)
+        for (Uint32 i = 0; i < this->m_Instances.size(); ++i)
         {
-            const char* NameCopy = this->m_StringPool.CopyString(SrcInst.first.GetStr());
-            this->m_Instances.emplace(NameCopy, SrcInst.second);
+            auto& Inst = this->m_Instances[i];
+            Inst.Name  = this->m_StringPool.CopyString(Inst.Name);
+            this->m_NameToIndex.emplace(Inst.Name, i);
         }
 
         VERIFY_EXPR(this->m_StringPool.GetRemainingSize() == 0);
@@ -247,12 +222,12 @@ public:
 
         TLASInstanceDesc Result = {};
 
-        auto Iter = this->m_Instances.find(Name);
-        if (Iter != this->m_Instances.end())
+        auto Iter = this->m_NameToIndex.find(Name);
+        if (Iter != this->m_NameToIndex.end())
         {
-            const auto& Inst                   = Iter->second;
+            const auto& Inst                   = this->m_Instances[Iter->second];
             Result.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
-            Result.InstanceIndex               = Inst.InstanceIndex;
+            Result.InstanceIndex               = Iter->second;
             Result.pBLAS                       = Inst.pBLAS.template RawPtr<IBottomLevelAS>();
         }
         else
@@ -303,6 +278,90 @@ public:
         return (this->m_State & State) == State;
     }
 
+    Uint32 GetInstanceCount() const
+    {
+        return static_cast<Uint32>(this->m_Instances.size());
+    }
+
+    const InstanceDesc& GetInstance(Uint32 Index) const
+    {
+        VERIFY_EXPR(Index < this->m_Instances.size());
+        return this->m_Instances[Index];
+    }
+
+    /// Returns the index of the element in BuildTLASAttribs::pInstances array of the
+    /// last build that describes the instance with the given index.
+    Uint32 GetSrcInstanceIndex(Uint32 Index) const
+    {
+        VERIFY_EXPR(Index < this->m_Instances.size());
+        return this->m_SrcInstanceIndices.empty() ? Index : this->m_SrcInstanceIndices[Index];
+    }
+
+    /// Returns the ranges of indices of the instances that must be written to the instance buffer
+    /// by the current build. The ranges are sorted and do not overlap.
+    const std::vector<InstanceRange>& GetDirtyInstanceRanges() const
+    {
+        return this->m_DirtyRanges;
+    }
+
+    /// Returns the total number of instances in the dirty ranges.
+    Uint32 GetDirtyInstanceCount() const
+    {
+        return this->m_DirtyInstanceCount;
+    }
+
+    /// Calls Handler(InstIndex, DstIndex) for every dirty instance, where DstIndex is the position of the
+    /// instance in the tightly packed array of all dirty instances.
+    /// When all instances are dirty and there are many of them, the instances are processed in parallel
+    /// by the calling thread and the worker thread pool, so the handler must be thread-safe.
+    template <typename HandlerType>
+    void ProcessDirtyInstances(HandlerType&& Handler) const
+    {
+        // Every chunk of instances must take long enough to amortize the cost of waking up a worker thread
+        constexpr Uint32 MinInstancesPerChunk = 4096;
+
+        if (this->m_DirtyRanges.size() == 1 && this->m_DirtyInstanceCount >= 2 * MinInstancesPerChunk)
+        {
+            const auto& Range = this->m_DirtyRanges.front();
+            ParallelFor(this->GetDevice()->GetWorkerThreadPool(), Range.Count, MinInstancesPerChunk,
+                        [&](size_t First, size_t Last) //
+                        {
+                            for (auto i = static_cast<Uint32>(First); i < static_cast<Uint32>(Last); ++i)
+                                Handler(Range.First + i, i);
+                        });
+            return;
+        }
+
+        Uint32 DstIndex = 0;
+        for (const auto& Range : this->m_DirtyRanges)
+        {
+            for (Uint32 i = 0; i < Range.Count; ++i)
+                Handler(Range.First + i, DstIndex++);
+        }
+    }
+
+    /// Calls Handler(BLAS) for the bottom-level AS of every dirty instance. Consecutive
+    /// instances that use the same BLAS only result in a single call.
+    /// All instances are dirty after a full build or an update that addresses the instances by name,
+    /// while an index-addressed update only visits the instances it writes to the instance buffer.
+    template <typename HandlerType>
+    void ProcessBLASes(HandlerType&& Handler) const
+    {
+        const BottomLevelASImplType* pPrevBLAS = nullptr;
+        for (const auto& Range : this->m_DirtyRanges)
+        {
+            for (Uint32 i = Range.First; i < Range.First + Range.Count; ++i)
+            {
+                auto* pBLAS = this->m_Instances[i].pBLAS.template RawPtr<BottomLevelASImplType>();
+                if (pBLAS != pPrevBLAS)
+                {
+                    pPrevBLAS = pBLAS;
+                    Handler(*pBLAS);
+                }
+            }
+        }
+    }
+
 #ifdef DILIGENT_DEVELOPMENT
     bool ValidateContent() const
     {
@@ -315,20 +374,18 @@ public:
         }
 
         // Validate instances
-        for (const auto& NameAndInst : this->m_Instances)
+        for (const auto& Inst : this->m_Instances)
         {
-            const InstanceDesc& Inst = NameAndInst.second;
-
             if (Inst.dvpVersion != Inst.pBLAS->DvpGetVersion())
             {
-                LOG_ERROR_MESSAGE("Instance with name '", NameAndInst.first.GetStr(), "' contains BLAS with name '", Inst.pBLAS->GetDesc().Name,
+                LOG_ERROR_MESSAGE("Instance with name '", Inst.Name, "' contains BLAS with name '", Inst.pBLAS->GetDesc().Name,
                                   "' that was changed after TLAS build, you must rebuild TLAS");
                 result = false;
             }
 
             if (Inst.pBLAS->IsInKnownState() && Inst.pBLAS->GetState() != RESOURCE_STATE_BUILD_AS_READ)
             {
-                LOG_ERROR_MESSAGE("Instance with name '", NameAndInst.first.GetStr(), "' contains BLAS with name '", Inst.pBLAS->GetDesc().Name,
+                LOG_ERROR_MESSAGE("Instance with name '", Inst.Name, "' contains BLAS with name '", Inst.pBLAS->GetDesc().Name,
                                   "' that must be in BUILD_AS_READ state, but current state is ",
                                   GetResourceStateFlagString(Inst.pBLAS->GetState()));
                 result = false;
@@ -337,6 +394,24 @@ public:
         return result;
     }
 
+    /// Validates that the instance buffer region used by an index-addressed update
+    /// is the same as the one that holds the instance data from the previous build.
+    bool DvpValidateInstanceBuffer(const BuildTLASAttribs& Attribs) const
+    {
+        if (Attribs.pDirtyInstanceIndices == nullptr || Attribs.pInstanceBuffer == nullptr)
+            return true;
+
+        if (Attribs.pInstanceBuffer->GetUniqueID() != this->m_DvpInstanceBufferId ||
+            Attribs.InstanceBufferOffset != this->m_DvpInstanceBufferOffset)
+        {
+            LOG_ERROR_MESSAGE("TLAS '", this->m_Desc.Name, "' is updated with pDirtyInstanceIndices, but the instance buffer '", Attribs.pInstanceBuffer->GetDesc().Name,
+                              "' or the offset (", Attribs.InstanceBufferOffset, ") is not the same as in the previous build: only dirty instances are written "
+                                                                                 "to the buffer, so it must contain the data of all other instances");
+            return false;
+        }
+        return true;
+    }
+
     Uint32 GetVersion() const
     {
         return this->m_DvpVersion.load();
@@ -344,15 +419,227 @@ public:
 #endif // DILIGENT_DEVELOPMENT
 
 private:
+    // Updates the instances that are identified by name in pInstances array.
+    bool UpdateAllInstances(const BuildTLASAttribs& Attribs) noexcept
+    {
+#ifdef DILIGENT_DEVELOPMENT
+        bool Changed = false;
+#endif
+        const Uint32 HitGroupStride = Attribs.HitGroupStride;
+        const auto   BindingMode    = Attribs.BindingMode;
+        Uint32       InstanceOffset = Attribs.BaseContributionToHitGroupIndex;
+
+        // pInstances may list the instances in a different order than in the build that initialized them
+        this->m_SrcInstanceIndices.resize(Attribs.InstanceCount);
+
+        for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
+        {
+            const auto& Inst = Attribs.pInstances[i];
+            auto        Iter = this->m_NameToIndex.find(Inst.InstanceName);
+
+            if (Iter == this->m_NameToIndex.end())
+            {
+                UNEXPECTED("Failed to find instance with name '", Inst.InstanceName, "' in instances from the previous build");
+                return false;
+            }
+
+            this->m_SrcInstanceIndices[Iter->second] = i;
+
+            auto&      Desc      = this->m_Instances[Iter->second];
+            const auto PrevIndex = Desc.ContributionToHitGroupIndex;
+            const auto pPrevBLAS = Desc.pBLAS;
+
+            Desc.pBLAS                       = ClassPtrCast<BottomLevelASImplType>(Inst.pBLAS);
+            Desc.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
+            CalculateHitGroupIndex(Desc, InstanceOffset, HitGroupStride, BindingMode);
+
+#ifdef DILIGENT_DEVELOPMENT
+            Changed         = Changed || (pPrevBLAS != Desc.pBLAS);
+            Changed         = Changed || (PrevIndex != Desc.ContributionToHitGroupIndex);
+            Desc.dvpVersion = Desc.pBLAS->DvpGetVersion();
+#endif
+        }
+
+        InstanceOffset = InstanceOffset + (BindingMode == HIT_GROUP_BINDING_MODE_PER_TLAS ? HitGroupStride : 0) - 1;
+
+#ifdef DILIGENT_DEVELOPMENT
+        Changed = Changed || (this->m_BuildInfo.HitGroupStride != HitGroupStride);
+        Changed = Changed || (this->m_BuildInfo.FirstContributionToHitGroupIndex != Attribs.BaseContributionToHitGroupIndex);
+        Changed = Changed || (this->m_BuildInfo.LastContributionToHitGroupIndex != InstanceOffset);
+        Changed = Changed || (this->m_BuildInfo.BindingMode != BindingMode);
+        if (Changed)
+            this->m_DvpVersion.fetch_add(1);
+#endif
+        this->m_BuildInfo.HitGroupStride                   = HitGroupStride;
+        this->m_BuildInfo.FirstContributionToHitGroupIndex = Attribs.BaseContributionToHitGroupIndex;
+        this->m_BuildInfo.LastContributionToHitGroupIndex  = InstanceOffset;
+        this->m_BuildInfo.BindingMode                      = BindingMode;
+
+        MarkAllInstancesDirty();
+
+        return true;
+    }
+
+    // Updates the instances listed in pDirtyInstanceIndices array, where pInstances is addressed by the instance index.
+    // Besides the listed instances, only the instances whose hit group index changes are marked dirty.
+    bool UpdateDirtyInstances(const BuildTLASAttribs& Attribs) noexcept
+    {
+        VERIFY_EXPR(this->m_BuildInfo.BindingMode == Attribs.BindingMode);
+
+        const Uint32 InstanceCount  = Attribs.InstanceCount;
+        const Uint32 HitGroupStride = Attribs.HitGroupStride;
+        const auto   BindingMode    = Attribs.BindingMode;
+
+        this->m_SrcInstanceIndices.clear();
+        this->m_DirtyRanges.clear();
+        this->m_DirtyInstanceCount = 0;
+
+        auto& DirtyIndices = this->m_DirtyIndices;
+        DirtyIndices.assign(Attribs.pDirtyInstanceIndices, Attribs.pDirtyInstanceIndices + Attribs.DirtyInstanceCount);
+        std::sort(DirtyIndices.begin(), DirtyIndices.end());
+        DirtyIndices.erase(std::unique(DirtyIndices.begin(), DirtyIndices.end()), DirtyIndices.end());
+
+#ifdef DILIGENT_DEVELOPMENT
+        bool Changed = false;
+#endif
+        for (auto Idx : DirtyIndices)
+        {
+            VERIFY_EXPR(Idx < InstanceCount);
+
+            const auto& Inst  = Attribs.pInstances[Idx];
+            auto&       Desc  = this->m_Instances[Idx];
+            auto*       pBLAS = ClassPtrCast<BottomLevelASImplType>(Inst.pBLAS);
+#ifdef DILIGENT_DEVELOPMENT
+            Changed = Changed || (Desc.pBLAS.RawPtr() != pBLAS);
+#endif
+            Desc.pBLAS = pBLAS;
+            if (BindingMode == HIT_GROUP_BINDING_MODE_USER_DEFINED)
+            {
+#ifdef DILIGENT_DEVELOPMENT
+                Changed = Changed || (Desc.ContributionToHitGroupIndex != Inst.ContributionToHitGroupIndex);
+#endif
+                Desc.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
+            }
+#ifdef DILIGENT_DEVELOPMENT
+            Desc.dvpVersion = pBLAS->DvpGetVersion();
+#endif
+        }
+
+        Uint32 InstanceOffset  = Attribs.BaseContributionToHitGroupIndex;
+        bool   LastIndexIsKnown = BindingMode == HIT_GROUP_BINDING_MODE_USER_DEFINED;
+        auto   DirtyIt         = DirtyIndices.begin();
+        if (BindingMode != HIT_GROUP_BINDING_MODE_USER_DEFINED)
+        {
+            const bool LayoutChanged =
+                this->m_BuildInfo.HitGroupStride != HitGroupStride ||
+                this->m_BuildInfo.FirstContributionToHitGroupIndex != Attribs.BaseContributionToHitGroupIndex;
+
+            // With the same base index and stride, the hit group index of an instance in PER_INSTANCE and PER_TLAS modes
+            // only depends on the instance index. In PER_GEOMETRY mode, an instance affects the indices of all subsequent
+            // instances, but only until the first instance whose index did not change after the last dirty instance.
+            if (LayoutChanged || (BindingMode == HIT_GROUP_BINDING_MODE_PER_GEOMETRY && !DirtyIndices.empty()))
+            {
+                const Uint32 FirstIdx     = LayoutChanged ? 0 : DirtyIndices.front();
+                const Uint32 LastDirtyIdx = LayoutChanged ? InstanceCount : DirtyIndices.back();
+                if (!LayoutChanged)
+                    InstanceOffset = this->m_Instances[FirstIdx].ContributionToHitGroupIndex;
+
+                LastIndexIsKnown = true;
+                for (Uint32 Idx = FirstIdx; Idx < InstanceCount; ++Idx)
+                {
+                    auto&      Desc      = this->m_Instances[Idx];
+                    const auto PrevIndex = Desc.ContributionToHitGroupIndex;
+                    if (Idx > LastDirtyIdx && PrevIndex == InstanceOffset)
+                    {
+                        // The indices of the remaining instances do not change
+                        LastIndexIsKnown = false;
+                        break;
+                    }
+
+                    Desc.ContributionToHitGroupIndex = TLAS_INSTANCE_OFFSET_AUTO;
+                    CalculateHitGroupIndex(Desc, InstanceOffset, HitGroupStride, BindingMode);
+
+                    const bool IsDirty = DirtyIt != DirtyIndices.end() && *DirtyIt == Idx;
+                    if (IsDirty)
+                        ++DirtyIt;
+                    if (IsDirty || Desc.ContributionToHitGroupIndex != PrevIndex)
+                        AddDirtyInstance(Idx);
+#ifdef DILIGENT_DEVELOPMENT
+                    Changed = Changed || (Desc.ContributionToHitGroupIndex != PrevIndex);
+#endif
+                }
+            }
+        }
+
+        for (; DirtyIt != DirtyIndices.end(); ++DirtyIt)
+            AddDirtyInstance(*DirtyIt);
+
+        if (LastIndexIsKnown)
+        {
+            InstanceOffset = InstanceOffset + (BindingMode == HIT_GROUP_BINDING_MODE_PER_TLAS ? HitGroupStride : 0) - 1;
+#ifdef DILIGENT_DEVELOPMENT
+            Changed = Changed || (this->m_BuildInfo.LastContributionToHitGroupIndex != InstanceOffset);
+#endif
+            this->m_BuildInfo.LastContributionToHitGroupIndex = InstanceOffset;
+        }
+
+#ifdef DILIGENT_DEVELOPMENT
+        Changed = Changed || (this->m_BuildInfo.HitGroupStride != HitGroupStride);
+        Changed = Changed || (this->m_BuildInfo.FirstContributionToHitGroupIndex != Attribs.BaseContributionToHitGroupIndex);
+        if (Changed)
+            this->m_DvpVersion.fetch_add(1);
+#endif
+        this->m_BuildInfo.HitGroupStride                   = HitGroupStride;
+        this->m_BuildInfo.FirstContributionToHitGroupIndex = Attribs.BaseContributionToHitGroupIndex;
+
+        return true;
+    }
+
+    void AddDirtyInstance(Uint32 Idx)
+    {
+        if (!this->m_DirtyRanges.empty() && this->m_DirtyRanges.back().First + this->m_DirtyRanges.back().Count == Idx)
+            ++this->m_DirtyRanges.back().Count;
+        else
+            this->m_DirtyRanges.push_back({Idx, 1});
+        ++this->m_DirtyInstanceCount;
+    }
+
+    void MarkAllInstancesDirty()
+    {
+        const auto InstanceCount = static_cast<Uint32>(this->m_Instances.size());
+
+        this->m_DirtyRanges.clear();
+        if (InstanceCount > 0)
+            this->m_DirtyRanges.push_back({0, InstanceCount});
+        this->m_DirtyInstanceCount = InstanceCount;
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    void DvpSetInstanceBuffer(const BuildTLASAttribs& Attribs)
+    {
+        this->m_DvpInstanceBufferId     = Attribs.pInstanceBuffer->GetUniqueID();
+        this->m_DvpInstanceBufferOffset = Attribs.InstanceBufferOffset;
+    }
+#endif
+
     void ClearInstanceData()
     {
         this->m_Instances.clear();
+        this->m_NameToIndex.clear();
+        this->m_SrcInstanceIndices.clear();
+        this->m_DirtyRanges.clear();
+        this->m_DirtyInstanceCount = 0;
         this->m_StringPool.Clear();
 
         this->m_BuildInfo.BindingMode                      = HIT_GROUP_BINDING_MODE_LAST;
         this->m_BuildInfo.HitGroupStride                   = 0;
         this->m_BuildInfo.FirstContributionToHitGroupIndex = INVALID_INDEX;
         this->m_BuildInfo.LastContributionToHitGroupIndex  = INVALID_INDEX;
+
+#ifdef DILIGENT_DEVELOPMENT
+        this->m_DvpInstanceBufferId     = -1;
+        this->m_DvpInstanceBufferOffset = 0;
+#endif
     }
 
     static void CalculateHitGroupIndex(InstanceDesc& Desc, Uint32& InstanceOffset, const Uint32 HitGroupStride, const HIT_GROUP_BINDING_MODE BindingMode)
@@ -387,12 +674,29 @@ protected:
     TLASBuildInfo      m_BuildInfo;
     ScratchBufferSizes m_ScratchSize;
 
-    std::unordered_map<HashMapStringKey, InstanceDesc, HashMapStringKey::Hasher> m_Instances;
+    // Instances indexed by the instance index (TLASInstanceDesc::InstanceIndex)
+    std::vector<InstanceDesc> m_Instances;
+
+    std::unordered_map<HashMapStringKey, Uint32, HashMapStringKey::Hasher> m_NameToIndex;
+
+    // The index of the element in BuildTLASAttribs::pInstances array of the last build for every instance,
+    // or empty if pInstances was addressed by the instance index.
+    std::vector<Uint32> m_SrcInstanceIndices;
+
+    // Instances that must be written to the instance buffer by the current build
+    std::vector<InstanceRange> m_DirtyRanges;
+    Uint32                     m_DirtyInstanceCount = 0;
+
+    // Sorted indices from BuildTLASAttribs::pDirtyInstanceIndices, the vector is reused between the builds
+    std::vector<Uint32> m_DirtyIndices;
 
     StringPool m_StringPool;
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Uint32> m_DvpVersion{0};
+
+    Int32  m_DvpInstanceBufferId     = -1;
+    Uint64 m_DvpInstanceBufferOffset = 0;
 #endif
 };
 
@@ -372,6 +372,173 @@ struct DrawIndexedAttribs
 typedef struct DrawIndexedAttribs DrawIndexedAttribs;
 
 
+/// Defines a single draw range of the multi-draw command.
+
+/// This structure is used by Diligent::MultiDrawAttribs.
+struct MultiDrawItem
+{
+    /// The number of vertices to draw.
+    Uint32 NumVertices         DEFAULT_INITIALIZER(0);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) of the first vertex in the
+    /// vertex buffer to start reading vertices from.
+    Uint32 StartVertexLocation DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr MultiDrawItem() noexcept {}
+
+    constexpr MultiDrawItem(Uint32 _NumVertices,
+                            Uint32 _StartVertexLocation = 0) noexcept :
+        NumVertices        {_NumVertices        },
+        StartVertexLocation{_StartVertexLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawItem MultiDrawItem;
+
+
+/// Defines the multi-draw command attributes.
+
+/// This structure is used by IDeviceContext::MultiDraw().
+struct MultiDrawAttribs
+{
+    /// The number of draw ranges in pDrawItems array.
+    Uint32               DrawCount             DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the array of DrawCount draw ranges.
+    const MultiDrawItem* pDrawItems            DEFAULT_INITIALIZER(nullptr);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS           Flags                 DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+    /// The number of instances to draw for every draw range. If more than one
+    /// instance is specified, instanced draw calls will be performed.
+    Uint32               NumInstances          DEFAULT_INITIALIZER(1);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) in the vertex buffer to start
+    /// reading instance data from.
+    Uint32               FirstInstanceLocation DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values.
+
+    /// Default values:
+    ///
+    /// Member                                   | Default value
+    /// -----------------------------------------|--------------------------------------
+    /// DrawCount                                | 0
+    /// pDrawItems                               | nullptr
+    /// Flags                                    | DRAW_FLAG_NONE
+    /// NumInstances                             | 1
+    /// FirstInstanceLocation                    | 0
+    constexpr MultiDrawAttribs() noexcept {}
+
+    /// Initializes the structure with user-specified values.
+    constexpr MultiDrawAttribs(Uint32               _DrawCount,
+                               const MultiDrawItem* _pDrawItems,
+                               DRAW_FLAGS           _Flags,
+                               Uint32               _NumInstances          = 1,
+                               Uint32               _FirstInstanceLocation = 0) noexcept :
+        DrawCount            {_DrawCount            },
+        pDrawItems           {_pDrawItems           },
+        Flags                {_Flags                },
+        NumInstances         {_NumInstances         },
+        FirstInstanceLocation{_FirstInstanceLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawAttribs MultiDrawAttribs;
+
+
+/// Defines a single draw range of the indexed multi-draw command.
+
+/// This structure is used by Diligent::MultiDrawIndexedAttribs.
+struct MultiDrawIndexedItem
+{
+    /// The number of indices to draw.
+    Uint32 NumIndices         DEFAULT_INITIALIZER(0);
+
+    /// LOCATION (NOT the byte offset) of the first index in
+    /// the index buffer to start reading indices from.
+    Uint32 FirstIndexLocation DEFAULT_INITIALIZER(0);
+
+    /// A constant which is added to each index before accessing the vertex buffer.
+    Uint32 BaseVertex         DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr MultiDrawIndexedItem() noexcept {}
+
+    constexpr MultiDrawIndexedItem(Uint32 _NumIndices,
+                                   Uint32 _FirstIndexLocation = 0,
+                                   Uint32 _BaseVertex         = 0) noexcept :
+        NumIndices        {_NumIndices        },
+        FirstIndexLocation{_FirstIndexLocation},
+        BaseVertex        {_BaseVertex        }
+    {}
+#endif
+};
+typedef struct MultiDrawIndexedItem MultiDrawIndexedItem;
+
+
+/// Defines the indexed multi-draw command attributes.
+
+/// This structure is used by IDeviceContext::MultiDrawIndexed().
+struct MultiDrawIndexedAttribs
+{
+    /// The number of draw ranges in pDrawItems array.
+    Uint32                      DrawCount             DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the array of DrawCount draw ranges.
+    const MultiDrawIndexedItem* pDrawItems            DEFAULT_INITIALIZER(nullptr);
+
+    /// The type of elements in the index buffer.
+    /// Allowed values: VT_UINT16 and VT_UINT32.
+    VALUE_TYPE                  IndexType             DEFAULT_INITIALIZER(VT_UNDEFINED);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS                  Flags                 DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+    /// Number of instances to draw for every draw range. If more than one
+    /// instance is specified, instanced draw calls will be performed.
+    Uint32                      NumInstances          DEFAULT_INITIALIZER(1);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) in the vertex
+    /// buffer to start reading instance data from.
+    Uint32                      FirstInstanceLocation DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values.
+
+    /// Default values:
+    /// Member                                   | Default value
+    /// -----------------------------------------|--------------------------------------
+    /// DrawCount                                | 0
+    /// pDrawItems                               | nullptr
+    /// IndexType                                | VT_UNDEFINED
+    /// Flags                                    | DRAW_FLAG_NONE
+    /// NumInstances                             | 1
+    /// FirstInstanceLocation                    | 0
+    constexpr MultiDrawIndexedAttribs() noexcept {}
+
+    /// Initializes the structure members with user-specified values.
+    constexpr MultiDrawIndexedAttribs(Uint32                      _DrawCount,
+                                      const MultiDrawIndexedItem* _pDrawItems,
+                                      VALUE_TYPE                  _IndexType,
+                                      DRAW_FLAGS                  _Flags,
+                                      Uint32                      _NumInstances          = 1,
+                                      Uint32                      _FirstInstanceLocation = 0) noexcept :
+        DrawCount            {_DrawCount            },
+        pDrawItems           {_pDrawItems           },
+        IndexType            {_IndexType            },
+        Flags                {_Flags                },
+        NumInstances         {_NumInstances         },
+        FirstInstanceLocation{_FirstInstanceLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawIndexedAttribs MultiDrawIndexedAttribs;
+
+
 /// Defines the indirect draw command attributes.
 
 /// This structure is used by IDeviceContext::DrawIndirect().
@@ -1415,6 +1582,22 @@ struct BuildTLASAttribs
     /// pTLAS must be created with RAYTRACING_BUILD_AS_ALLOW_UPDATE flag.
     /// An update will be faster than building an acceleration structure from scratch.
     Bool                            Update                        DEFAULT_INITIALIZER(False);
+
+    /// An optional array of DirtyInstanceCount indices of the instances that changed since the previous build.
+    /// If not null, Update must be true and the instances are addressed by their index rather than by name:
+    ///     - pInstances must contain InstanceCount instances in the same order as in the build that
+    ///       initialized the TLAS (see TLASInstanceDesc::InstanceIndex); TLASBuildInstanceData::InstanceName is ignored.
+    ///     - Only the listed instances and the instances whose hit group index changed as a result
+    ///       are validated and written to the instance buffer.
+    ///     - pInstanceBuffer and InstanceBufferOffset must be the same as in the previous build,
+    ///       and the instance data in the buffer must be preserved since then.
+    ///     - BindingMode must be the same as in the previous build.
+    ///     - BLASTransitionMode only applies to the BLASes of the instances that are written to the instance
+    ///       buffer; the BLASes of other instances must already be in RESOURCE_STATE_BUILD_AS_READ state.
+    Uint32 const*                   pDirtyInstanceIndices         DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of elements in pDirtyInstanceIndices array.
+    Uint32                          DirtyInstanceCount            DEFAULT_INITIALIZER(0);
 };
 typedef struct BuildTLASAttribs BuildTLASAttribs;
 
@@ -1816,6 +1999,43 @@ struct StateTransitionDesc
 typedef struct StateTransitionDesc StateTransitionDesc;
 
 
+/// Command list flags, see IDeviceContext::Begin().
+DILIGENT_TYPED_ENUM(COMMAND_LIST_FLAGS, Uint8)
+{
+    /// No flags.
+    COMMAND_LIST_FLAG_NONE     = 0,
+
+    /// The command list can be executed by the immediate context any number of times, including
+    /// while its previous submissions are still in flight, until the command list is released.
+    ///
+    /// \remarks All resources used by the command list must be kept alive and must not be recreated or
+    ///          resized while the command list may be executed.
+    ///
+    ///          Resource states are only tracked when the command list is recorded. An application is responsible
+    ///          for bringing the resources into the same states every time the command list is executed.
+    ///
+    ///          Dynamic buffers must be mapped by the deferred context while recording the command list.
+    ///          Their contents as well as other dynamic memory and descriptors allocated by the context
+    ///          are owned by the command list and are not discarded at the end of the frame, so every execution
+    ///          reads the data written during recording. As a consequence, the deferred context must not contain
+    ///          any dynamic allocations from the current frame when the recording begins (i.e. the recording must
+    ///          begin after IDeviceContext::FinishFrame() or after another reusable command list was finished).
+    ///
+    ///          Queries can't be used in reusable command lists.
+    ///
+    ///          In Vulkan backend, buffers used by the command list keep their Vulkan handles for as long as the list
+    ///          may be replayed: they are permanently excluded from memory defragmentation when the list is recorded,
+    ///          see IDeviceContextVk::DefragmentMemory().
+    ///
+    ///          Direct3D11, Direct3D12 and Vulkan backends support reusable command lists. Direct3D11 command lists
+    ///          are always reusable.
+    COMMAND_LIST_FLAG_REUSABLE = 1u << 0,
+
+    COMMAND_LIST_FLAG_LAST     = COMMAND_LIST_FLAG_REUSABLE
+};
+DEFINE_FLAG_ENUM_OPERATORS(COMMAND_LIST_FLAGS);
+
+
 #define DILIGENT_INTERFACE_NAME IDeviceContext
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -1841,11 +2061,13 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
     /// \param [in] ImmediateContextId - the ID of the immediate context where commands from this
     ///                                  deferred context will be executed,
     ///                                  see Diligent::DeviceContextDesc::ContextId.
+    /// \param [in] Flags              - command list flags, see Diligent::COMMAND_LIST_FLAGS.
     ///
     /// \warning Command list recorded by the context must not be submitted to any other immediate context
     ///          other than one identified by ImmediateContextId.
     VIRTUAL void METHOD(Begin)(THIS_
-                               Uint32 ImmediateContextId) PURE;
+                               Uint32             ImmediateContextId,
+                               COMMAND_LIST_FLAGS Flags DEFAULT_VALUE(COMMAND_LIST_FLAG_NONE)) PURE;
 
     /// Sets the pipeline state.
 
@@ -1938,6 +2160,51 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                          const float* pBlendFactors DEFAULT_VALUE(nullptr)) PURE;
 
 
+    /// Sets the cull mode and the front face orientation.
+
+    /// \param [in] CullMode              - Cull mode, see Diligent::CULL_MODE.
+    /// \param [in] FrontCounterClockwise - Whether triangles with counter-clockwise vertex order are front-facing,
+    ///                                     see Diligent::RasterizerStateDesc::FrontCounterClockwise.
+    ///
+    /// \remarks Supported contexts: graphics.
+    ///
+    ///          The method requires Diligent::DeviceFeatures::ExtendedDynamicState feature and
+    ///          must be called after a pipeline created with Diligent::PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE
+    ///          flag has been bound. The state is reset to the pipeline's value every time
+    ///          such pipeline is bound by SetPipelineState().
+    VIRTUAL void METHOD(SetCullMode)(THIS_
+                                     CULL_MODE CullMode,
+                                     Bool      FrontCounterClockwise) PURE;
+
+
+    /// Sets the depth-stencil state.
+
+    /// \param [in] DepthStencilDesc - Depth-stencil state description, see Diligent::DepthStencilStateDesc.
+    ///
+    /// \remarks Supported contexts: graphics.
+    ///
+    ///          The method requires Diligent::DeviceFeatures::ExtendedDynamicState feature and
+    ///          must be called after a pipeline created with Diligent::PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE
+    ///          flag has been bound. The state is reset to the pipeline's value every time
+    ///          such pipeline is bound by SetPipelineState().
+    VIRTUAL void METHOD(SetDepthStencilState)(THIS_
+                                              const DepthStencilStateDesc REF DepthStencilDesc) PURE;
+
+
+    /// Sets the primitive topology.
+
+    /// \param [in] Topology - Primitive topology, see Diligent::PRIMITIVE_TOPOLOGY.
+    ///
+    /// \remarks Supported contexts: graphics.
+    ///
+    ///          The method requires Diligent::DeviceFeatures::ExtendedDynamicState feature and
+    ///          must be called after a graphics pipeline created with Diligent::PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE
+    ///          flag has been bound. The topology must be of the same class (points, lines, triangles)
+    ///          as the pipeline's topology. Patch list topologies can't be changed.
+    VIRTUAL void METHOD(SetPrimitiveTopology)(THIS_
+                                              PRIMITIVE_TOPOLOGY Topology) PURE;
+
+
     /// Binds vertex buffers to the pipeline.
 
     /// \param [in] StartSlot           - The first input slot for binding. The first vertex buffer is
@@ -2170,6 +2437,44 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                      const DrawIndexedAttribs REF Attribs) PURE;
 
 
+    /// Executes a multi-draw command.
+
+    /// \param [in] Attribs - Multi-draw command attributes, see Diligent::MultiDrawAttribs for details.
+    ///
+    /// \remarks  The command is equivalent to a sequence of IDeviceContext::Draw() calls, one for every
+    ///           draw range, but the pipeline state, shader resources and vertex buffers are validated
+    ///           and committed only once. If Diligent::DeviceFeatures::NativeMultiDraw feature is enabled,
+    ///           the command is executed natively (e.g. vkCmdDrawMultiEXT or glMultiDrawArrays),
+    ///           otherwise it is emulated by a loop over the draw ranges.
+    ///
+    ///           If Diligent::DRAW_FLAG_VERIFY_STATES flag is set, the method reads the state of vertex
+    ///           buffers, so no other threads are allowed to alter the states of the same resources.
+    ///           It is OK to read these states.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(MultiDraw)(THIS_
+                                   const MultiDrawAttribs REF Attribs) PURE;
+
+
+    /// Executes an indexed multi-draw command.
+
+    /// \param [in] Attribs - Multi-draw command attributes, see Diligent::MultiDrawIndexedAttribs for details.
+    ///
+    /// \remarks  The command is equivalent to a sequence of IDeviceContext::DrawIndexed() calls, one for every
+    ///           draw range, but the pipeline state, shader resources, vertex and index buffers are validated
+    ///           and committed only once. If Diligent::DeviceFeatures::NativeMultiDraw feature is enabled,
+    ///           the command is executed natively (e.g. vkCmdDrawMultiIndexedEXT or glMultiDrawElementsBaseVertex),
+    ///           otherwise it is emulated by a loop over the draw ranges.
+    ///
+    ///           If Diligent::DRAW_FLAG_VERIFY_STATES flag is set, the method reads the state of vertex/index
+    ///           buffers, so no other threads are allowed to alter the states of the same resources.
+    ///           It is OK to read these states.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(MultiDrawIndexed)(THIS_
+                                          const MultiDrawIndexedAttribs REF Attribs) PURE;
+
+
     /// Executes an indirect draw command.
 
     /// \param [in] Attribs - Structure describing the command attributes, see Diligent::DrawIndirectAttribs for details.
@@ -2401,7 +2706,8 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
 
     /// \param [in] NumCommandLists - The number of command lists to execute.
     /// \param [in] ppCommandLists  - Pointer to the array of NumCommandLists command lists to execute.
-    /// \remarks After a command list is executed, it is no longer valid and must be released.
+    /// \remarks After a command list is executed, it is no longer valid and must be released,
+    ///          unless it was recorded with COMMAND_LIST_FLAG_REUSABLE flag.
     VIRTUAL void METHOD(ExecuteCommandLists)(THIS_
                                              Uint32               NumCommandLists,
                                              ICommandList* const* ppCommandLists) PURE;
@@ -2975,6 +3281,9 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_CommitShaderResources(This, ...)         CALL_IFACE_METHOD(DeviceContext, CommitShaderResources,     This, __VA_ARGS__)
 #    define IDeviceContext_SetStencilRef(This, ...)                 CALL_IFACE_METHOD(DeviceContext, SetStencilRef,             This, __VA_ARGS__)
 #    define IDeviceContext_SetBlendFactors(This, ...)               CALL_IFACE_METHOD(DeviceContext, SetBlendFactors,           This, __VA_ARGS__)
+#    define IDeviceContext_SetCullMode(This, ...)                   CALL_IFACE_METHOD(DeviceContext, SetCullMode,               This, __VA_ARGS__)
+#    define IDeviceContext_SetDepthStencilState(This, ...)          CALL_IFACE_METHOD(DeviceContext, SetDepthStencilState,      This, __VA_ARGS__)
+#    define IDeviceContext_SetPrimitiveTopology(This, ...)          CALL_IFACE_METHOD(DeviceContext, SetPrimitiveTopology,      This, __VA_ARGS__)
 #    define IDeviceContext_SetVertexBuffers(This, ...)              CALL_IFACE_METHOD(DeviceContext, SetVertexBuffers,          This, __VA_ARGS__)
 #    define IDeviceContext_InvalidateState(This)                    CALL_IFACE_METHOD(DeviceContext, InvalidateState,           This)
 #    define IDeviceContext_SetIndexBuffer(This, ...)                CALL_IFACE_METHOD(DeviceContext, SetIndexBuffer,            This, __VA_ARGS__)
@@ -2987,6 +3296,8 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_EndRenderPass(This)                      CALL_IFACE_METHOD(DeviceContext, EndRenderPass,             This)
 #    define IDeviceContext_Draw(This, ...)                          CALL_IFACE_METHOD(DeviceContext, Draw,                      This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndexed(This, ...)                   CALL_IFACE_METHOD(DeviceContext, DrawIndexed,               This, __VA_ARGS__)
+#    define IDeviceContext_MultiDraw(This, ...)                     CALL_IFACE_METHOD(DeviceContext, MultiDraw,                 This, __VA_ARGS__)
+#    define IDeviceContext_MultiDrawIndexed(This, ...)              CALL_IFACE_METHOD(DeviceContext, MultiDrawIndexed,          This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndirect(This, ...)                  CALL_IFACE_METHOD(DeviceContext, DrawIndirect,              This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndexedIndirect(This, ...)           CALL_IFACE_METHOD(DeviceContext, DrawIndexedIndirect,       This, __VA_ARGS__)
 #    define IDeviceContext_DrawMesh(This, ...)                      CALL_IFACE_METHOD(DeviceContext, DrawMesh,                  This, __VA_ARGS__)
@@ -1013,7 +1013,10 @@ DILIGENT_TYPED_ENUM(MISC_TEXTURE_FLAGS, Uint8)
 
     /// Allow automatic mipmap generation with ITextureView::GenerateMips()
 
-    /// \note A texture must be created with BIND_RENDER_TARGET bind flag
+    /// \note A texture must be created with BIND_RENDER_TARGET bind flag.
+    ///       In Vulkan backend, mipmaps of a texture that is also created with BIND_UNORDERED_ACCESS
+    ///       bind flag are generated by a compute shader if the texture format supports storage images.
+    ///       Otherwise, mipmaps are generated by blit commands.
     MISC_TEXTURE_FLAG_GENERATE_MIPS = 0x01,
 
     /// The texture will be used as a transient framebuffer attachment.
@@ -1566,6 +1569,7 @@ enum RENDER_DEVICE_TYPE
     RENDER_DEVICE_TYPE_GLES,           ///< OpenGLES device
     RENDER_DEVICE_TYPE_VULKAN,         ///< Vulkan device
     RENDER_DEVICE_TYPE_METAL,          ///< Metal device
+    RENDER_DEVICE_TYPE_NULL,           ///< Null device that emits no GPU work
     RENDER_DEVICE_TYPE_COUNT           ///< The total number of device types
 };
 
@@ -1743,6 +1747,15 @@ struct DeviceFeatures
     /// Indicates if device supports variable rate shading.
     DEVICE_FEATURE_STATE VariableRateShading              DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates if device natively supports multi-draw commands (IDeviceContext::MultiDraw and
+    /// IDeviceContext::MultiDrawIndexed). When the feature is disabled, the commands are emulated.
+    DEVICE_FEATURE_STATE NativeMultiDraw                  DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates if device supports extended dynamic state: cull mode, front face, primitive topology
+    /// and depth-stencil states may be set through the device context for pipelines created
+    /// with Diligent::PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag.
+    DEVICE_FEATURE_STATE ExtendedDynamicState             DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeatures() noexcept {}
 
@@ -1784,10 +1797,12 @@ struct DeviceFeatures
         NativeFence                       {State},
         TileShaders                       {State},
         TransferQueueTimestampQueries     {State},
-        VariableRateShading               {State}
+        VariableRateShading               {State},
+        NativeMultiDraw                   {State},
+        ExtendedDynamicState              {State}
     {
 #   if defined(_MSC_VER) && defined(_WIN64)
-        static_assert(sizeof(*this) == 38, "Did you add a new feature to DeviceFeatures? Please handle its status above.");
+        static_assert(sizeof(*this) == 40, "Did you add a new feature to DeviceFeatures? Please handle its status above.");
 #   endif
     }
 #endif
@@ -2185,6 +2200,10 @@ struct RenderDeviceInfo
     {
         return Type == RENDER_DEVICE_TYPE_METAL;
     }
+    bool IsNullDevice()const
+    {
+        return Type == RENDER_DEVICE_TYPE_NULL;
+    }
 
     // for backward compatibility
     const NDCAttribs& GetNDCAttribs()const
@@ -2728,6 +2747,15 @@ struct EngineCreateInfo
     ///           deferred contexts to let the engine release stale resources.
     Uint32                   NumDeferredContexts    DEFAULT_INITIALIZER(0);
 
+    /// The number of worker threads that initialize pipelines created with
+    /// Diligent::PSO_CREATE_FLAG_ASYNCHRONOUS flag.
+
+    /// \remarks   If the value is 0xFFFFFFFF (default), the number of threads is determined
+    ///            by the number of hardware threads. If the value is 0, all pipelines are
+    ///            created synchronously.
+    ///            The threads are started when the first asynchronous pipeline is created.
+    Uint32                   NumAsyncPipelineCompilationThreads DEFAULT_INITIALIZER(0xFFFFFFFF);
+
     /// Requested device features.
 
     /// \remarks    If a feature is requested to be enabled, but is not supported
@@ -3119,6 +3147,18 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 #endif
     ;
 
+    /// Size of the descriptor pool that is used to allocate update-after-bind descriptor sets
+    /// for static and mutable variables of resource signatures that contain bindless resources
+    /// (see Diligent::PIPELINE_RESOURCE_FLAG_BINDLESS). Every such set must fit into a single pool.
+    /// The pool is not created until the first bindless descriptor set is allocated.
+    /// Dynamic buffers can't be used in update-after-bind sets and are not allocated from this pool.
+    VulkanDescriptorPoolSize BindlessDescriptorPoolSize
+#if DILIGENT_CPP_INTERFACE
+        //Max  SepSm  CmbSm  SmpImg StrImg   UB     SB    UTxB   StTxB  InptAtt  AccelSt
+        {  64,  2048, 16384, 16384,  4096,  1024, 16384,  4096,  4096,    64,     256}
+#endif
+    ;
+
     /// Allocation granularity for device-local memory
     Uint32 DeviceLocalMemoryPageSize        DEFAULT_INITIALIZER(16 << 20);
 
@@ -3150,6 +3190,12 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// the global dynamic heap to perform lock-free dynamic suballocations
     Uint32 DynamicHeapPageSize              DEFAULT_INITIALIZER(256 << 10);
 
+    /// Whether command lists executed by IDeviceContext::ExecuteCommandLists() should
+    /// be accumulated in a pending batch rather than submitted to the queue right away.
+    /// The pending batch is submitted by a single vkQueueSubmit call the next time the
+    /// queue is flushed (e.g. by IDeviceContext::Flush() or IDeviceContext::FinishFrame()).
+    Bool   BatchQueueSubmissions            DEFAULT_INITIALIZER(False);
+
     /// Query pool size for each query type.
     Uint32 QueryPoolSizes[QUERY_TYPE_NUM_TYPES]
 #if DILIGENT_CPP_INTERFACE
@@ -3238,6 +3284,35 @@ struct EngineMtlCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 typedef struct EngineMtlCreateInfo EngineMtlCreateInfo;
 
 
+/// Attributes of the null engine implementation
+
+/// Null backend creates all device objects and performs the same state tracking
+/// and validation as other backends, but never submits any work to the GPU.
+/// It is primarily intended for measuring CPU overhead of the engine.
+struct EngineNullCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
+
+    /// Indicates if buffers and textures should allocate CPU memory
+    /// to back their contents.
+
+    /// When set to false, resources never allocate storage, initial data
+    /// and updates are ignored, and mapping returns a pointer to the scratch
+    /// memory owned by the device context whose contents are undefined.
+    /// This keeps the memory footprint minimal when only the API overhead is measured.
+    Bool AllocateResourceMemory DEFAULT_INITIALIZER(True);
+
+#if DILIGENT_CPP_INTERFACE
+    EngineNullCreateInfo() noexcept :
+        EngineNullCreateInfo{EngineCreateInfo{}}
+    {}
+
+    explicit EngineNullCreateInfo(const EngineCreateInfo &EngineCI) noexcept :
+        EngineCreateInfo{EngineCI}
+    {}
+#endif
+};
+typedef struct EngineNullCreateInfo EngineNullCreateInfo;
+
+
 /// Box
 struct Box
 {
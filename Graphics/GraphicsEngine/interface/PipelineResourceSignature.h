@@ -111,7 +111,26 @@ DILIGENT_TYPED_ENUM(PIPELINE_RESOURCE_FLAGS, Uint8)
     /// Indicates that resource is a run-time sized shader array (e.g. an array without a specific size).
     PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY      = 0x08,
 
-    PIPELINE_RESOURCE_FLAG_LAST               = PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY
+    /// Indicates that the resource is a bindless resource table: a large array that is indexed
+    /// in the shader and whose elements may be set after the shader resource binding has been committed.
+    ///
+    /// \remarks    The array may be partially bound: only the elements that are accessed by the shader
+    ///             must be initialized. Elements may be set, replaced or reset to null at any time, provided
+    ///             that they are not accessed by commands that are being executed by the GPU.
+    ///             An application may use BindlessResourceTable helper class to manage array slots.
+    ///
+    ///             The flag requires BindlessResources device feature, must be used together with
+    ///             PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY, and may only be used with mutable variables.
+    ///             Bindless buffers must also be labeled with PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS.
+    ///             ArraySize defines the maximum number of elements in the array.
+    ///
+    ///             In Vulkan backend, the resource uses partially-bound, update-after-bind descriptors.
+    ///             Since update-after-bind descriptor sets can't contain dynamic buffers, all static and
+    ///             mutable buffers in a signature with bindless resources must use
+    ///             PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS flag.
+    PIPELINE_RESOURCE_FLAG_BINDLESS           = 0x10,
+
+    PIPELINE_RESOURCE_FLAG_LAST               = PIPELINE_RESOURCE_FLAG_BINDLESS
 };
 DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_RESOURCE_FLAGS);
 
@@ -162,6 +181,28 @@ struct PipelineResourceDesc
 typedef struct PipelineResourceDesc PipelineResourceDesc;
 
 
+/// Pipeline resource signature flags.
+DILIGENT_TYPED_ENUM(PIPELINE_RESOURCE_SIGNATURE_FLAGS, Uint8)
+{
+    /// No special properties
+    PIPELINE_RESOURCE_SIGNATURE_FLAG_NONE                    = 0x00,
+
+    /// Write dynamic shader variables directly into the command buffer instead of
+    /// allocating a new descriptor set every time the shader resource binding is committed.
+    ///
+    /// \remarks   In Vulkan backend, the dynamic descriptor set is pushed with VK_KHR_push_descriptor.
+    ///             The flag is ignored (and regular descriptor sets are used) if the extension
+    ///             is not supported by the device or if the number of dynamic descriptors
+    ///             exceeds the device's maxPushDescriptors limit.
+    ///             At most one resource signature in a pipeline may use push descriptors.
+    ///             Other backends ignore this flag.
+    PIPELINE_RESOURCE_SIGNATURE_FLAG_PUSH_DYNAMIC_RESOURCES  = 0x01,
+
+    PIPELINE_RESOURCE_SIGNATURE_FLAG_LAST                    = PIPELINE_RESOURCE_SIGNATURE_FLAG_PUSH_DYNAMIC_RESOURCES
+};
+DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_RESOURCE_SIGNATURE_FLAGS);
+
+
 /// Pipeline resource signature description.
 struct PipelineResourceSignatureDesc DILIGENT_DERIVE(DeviceObjectAttribs)
 
@@ -205,6 +246,9 @@ struct PipelineResourceSignatureDesc DILIGENT_DERIVE(DeviceObjectAttribs)
     /// This member defines the allocation granularity for internal resources required by
     /// the shader resource binding object instances.
     Uint32 SRBAllocationGranularity DEFAULT_INITIALIZER(1);
+
+    /// Resource signature flags, see Diligent::PIPELINE_RESOURCE_SIGNATURE_FLAGS.
+    PIPELINE_RESOURCE_SIGNATURE_FLAGS Flags DEFAULT_INITIALIZER(PIPELINE_RESOURCE_SIGNATURE_FLAG_NONE);
 };
 typedef struct PipelineResourceSignatureDesc PipelineResourceSignatureDesc;
 
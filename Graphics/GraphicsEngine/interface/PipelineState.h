@@ -431,10 +431,82 @@ DILIGENT_TYPED_ENUM(PSO_CREATE_FLAGS, Uint32)
     /// that is not found in any of the designated shader stages.
     /// Use this flag to silence these warnings.
     PSO_CREATE_FLAG_IGNORE_MISSING_IMMUTABLE_SAMPLERS = 0x02,
+
+    /// Make cull mode, front face, primitive topology and depth-stencil states dynamic.
+
+    /// Graphics and mesh pipelines created with this flag do not bake
+    /// RasterizerStateDesc::CullMode, RasterizerStateDesc::FrontCounterClockwise,
+    /// GraphicsPipelineDesc::PrimitiveTopology and GraphicsPipelineDesc::DepthStencilDesc
+    /// into the pipeline. Instead, the states are set through IDeviceContext::SetCullMode(),
+    /// IDeviceContext::SetPrimitiveTopology() and IDeviceContext::SetDepthStencilState().
+    /// This allows using a single pipeline in place of multiple pipelines that only
+    /// differ in these states.
+    ///
+    /// \remarks   The values in the pipeline description are used as initial states
+    ///            every time the pipeline is bound by IDeviceContext::SetPipelineState()
+    ///            (setting the pipeline that is already bound has no effect).
+    ///
+    ///            Primitive topology may only be changed within the same topology class
+    ///            (points, lines, triangles) and is not dynamic in mesh pipelines.
+    ///
+    ///            The flag requires Diligent::DeviceFeatures::ExtendedDynamicState feature.
+    PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE            = 0x04,
+
+    /// Create the pipeline by linking separately compiled pipeline parts.
+
+    /// In Vulkan backend, the vertex input, pre-rasterization shaders, fragment shader and
+    /// fragment output parts of the pipeline are compiled as graphics pipeline libraries
+    /// (VK_EXT_graphics_pipeline_library) that are cached by the render device.
+    /// Pipelines that share any of the parts with previously created pipelines reuse the
+    /// libraries, and the pipeline is linked without link-time optimization, which is
+    /// significantly faster than creating a monolithic pipeline, but the resulting
+    /// pipeline may be slightly less efficient.
+    ///
+    /// \remarks   The flag is only allowed for graphics and mesh pipelines. It is a hint,
+    ///            and the pipeline is created as usual if the device does not support
+    ///            graphics pipeline libraries, by other backends, by mesh pipelines and by
+    ///            pipelines that use explicit render passes.
+    PSO_CREATE_FLAG_FAST_LINK                         = 0x08,
+
+    /// Create the pipeline asynchronously.
+
+    /// The pipeline creation method returns immediately and the pipeline is initialized
+    /// (including shader reflection, resource signature creation and pipeline compilation)
+    /// by one of the worker threads of the render device, see
+    /// Diligent::EngineCreateInfo::NumAsyncPipelineCompilationThreads.
+    /// The status of the pipeline can be queried with IPipelineState::GetStatus().
+    ///
+    /// \remarks   The flag is only allowed for graphics, mesh and compute pipelines.
+    ///            No methods of the pipeline other than IPipelineState::GetStatus() may be
+    ///            called until the status is Diligent::PIPELINE_STATE_STATUS_READY.
+    ///            If the pipeline fails to initialize, the status is Diligent::PIPELINE_STATE_STATUS_FAILED,
+    ///            and the pipeline must not be used.
+    ///
+    ///            If the device does not support Diligent::DeviceFeatures::MultithreadedResourceCreation
+    ///            (e.g. OpenGL) or asynchronous compilation is disabled, the pipeline is created
+    ///            synchronously and the flag is ignored.
+    PSO_CREATE_FLAG_ASYNCHRONOUS                      = 0x10,
 };
 DEFINE_FLAG_ENUM_OPERATORS(PSO_CREATE_FLAGS);
 
 
+/// Pipeline state status, see IPipelineState::GetStatus().
+DILIGENT_TYPED_ENUM(PIPELINE_STATE_STATUS, Uint8)
+{
+    /// The pipeline state has not been initialized.
+    PIPELINE_STATE_STATUS_UNINITIALIZED = 0,
+
+    /// The pipeline state is being initialized by a worker thread.
+    PIPELINE_STATE_STATUS_COMPILING,
+
+    /// The pipeline state is ready to be used.
+    PIPELINE_STATE_STATUS_READY,
+
+    /// The pipeline state initialization has failed.
+    PIPELINE_STATE_STATUS_FAILED
+};
+
+
 /// Pipeline state creation attributes
 struct PipelineStateCreateInfo
 {
@@ -784,6 +856,19 @@ DILIGENT_BEGIN_INTERFACE(IPipelineState, IDeviceObject)
     /// \return     Pointer to pipeline resource signature interface.
     VIRTUAL IPipelineResourceSignature* METHOD(GetResourceSignature)(THIS_
                                                                      Uint32 Index) CONST PURE;
+
+
+    /// Returns the pipeline state status, see Diligent::PIPELINE_STATE_STATUS.
+
+    /// \param [in] WaitForCompletion - If true, the method blocks until the asynchronous
+    ///                                 initialization of the pipeline is complete.
+    /// \return     Pipeline state status.
+    ///
+    /// \remarks    Pipelines created without Diligent::PSO_CREATE_FLAG_ASYNCHRONOUS flag
+    ///             are always in Diligent::PIPELINE_STATE_STATUS_READY state.
+    ///             This method is thread-safe.
+    VIRTUAL PIPELINE_STATE_STATUS METHOD(GetStatus)(THIS_
+                                                    bool WaitForCompletion DEFAULT_VALUE(false)) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -806,6 +891,7 @@ DILIGENT_END_INTERFACE
 #    define IPipelineState_IsCompatibleWith(This, ...)             CALL_IFACE_METHOD(PipelineState, IsCompatibleWith,             This, __VA_ARGS__)
 #    define IPipelineState_GetResourceSignatureCount(This)         CALL_IFACE_METHOD(PipelineState, GetResourceSignatureCount,    This)
 #    define IPipelineState_GetResourceSignature(This, ...)         CALL_IFACE_METHOD(PipelineState, GetResourceSignature,         This, __VA_ARGS__)
+#    define IPipelineState_GetStatus(This, ...)                    CALL_IFACE_METHOD(PipelineState, GetStatus,                    This, __VA_ARGS__)
 
 // clang-format on
 
@@ -98,6 +98,30 @@ DILIGENT_TYPED_ENUM(SHADER_COMPILER, Uint32)
 };
 
 
+/// Describes the optimization profile that is used when SPIR-V bytecode is generated
+DILIGENT_TYPED_ENUM(SHADER_OPTIMIZATION_PROFILE, Uint8)
+{
+    /// Default optimization profile (SHADER_OPTIMIZATION_PROFILE_PERFORMANCE).
+    SHADER_OPTIMIZATION_PROFILE_DEFAULT = 0,
+
+    /// Do not run optimization passes to minimize the compilation time.
+    /// SPIR-V generated from HLSL is still legalized.
+    SHADER_OPTIMIZATION_PROFILE_NONE,
+
+    /// Optimize the bytecode for the runtime performance.
+    SHADER_OPTIMIZATION_PROFILE_PERFORMANCE,
+
+    /// Optimize the bytecode for the size and strip debug instructions
+    /// that are not required by the shader reflection.
+    SHADER_OPTIMIZATION_PROFILE_SIZE,
+
+    /// Run the optimization passes listed in ShaderCreateInfo::OptimizationPasses.
+    SHADER_OPTIMIZATION_PROFILE_CUSTOM,
+
+    SHADER_OPTIMIZATION_PROFILE_LAST = SHADER_OPTIMIZATION_PROFILE_CUSTOM
+};
+
+
 /// Describes the flags that can be passed over to IShaderSourceInputStreamFactory::CreateInputStream2() function.
 DILIGENT_TYPED_ENUM(CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS, Uint32)
 {
@@ -302,6 +326,18 @@ struct ShaderCreateInfo
     /// Shader compile flags (see Diligent::SHADER_COMPILE_FLAGS).
     SHADER_COMPILE_FLAGS CompileFlags DEFAULT_INITIALIZER(SHADER_COMPILE_FLAG_NONE);
 
+    /// SPIR-V optimization profile (see Diligent::SHADER_OPTIMIZATION_PROFILE).
+
+    /// This member is used by Vulkan backend and is ignored if ByteCode is not null.
+    SHADER_OPTIMIZATION_PROFILE OptimizationProfile DEFAULT_INITIALIZER(SHADER_OPTIMIZATION_PROFILE_DEFAULT);
+
+    /// Space-separated list of SPIR-V optimizer passes that are used with SHADER_OPTIMIZATION_PROFILE_CUSTOM,
+    /// e.g. "--eliminate-dead-code-aggressive --merge-blocks".
+
+    /// The passes use the spirv-opt command line flag syntax. -O and -Os flags select
+    /// the performance and size pass sets respectively.
+    const Char* OptimizationPasses DEFAULT_INITIALIZER(nullptr);
+
     /// Memory address where pointer to the compiler messages data blob will be written
 
     /// The buffer contains two null-terminated strings. The first one is the compiler
@@ -27,18 +27,29 @@
 
 #include "DefaultShaderSourceStreamFactory.h"
 
+#include <mutex>
+#include <unordered_map>
+
+#include "ShaderSourceFileCache.hpp"
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "EngineMemory.h"
 #include "BasicFileStream.hpp"
+#include "MemoryFileStream.hpp"
+#include "MappedFileDataBlob.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
 
-class DefaultShaderSourceStreamFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+class DefaultShaderSourceStreamFactory final : public ObjectBase<IShaderSourceFileCache>
 {
 public:
-    DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories);
+    using TBase = ObjectBase<IShaderSourceFileCache>;
+
+    DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const DefaultShaderSourceStreamFactoryCreateInfo& CreateInfo);
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
 
     virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final;
 
@@ -46,15 +57,58 @@ public:
                                                        CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
                                                        IFileStream**                           ppStream) override final;
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>);
+    virtual void DILIGENT_CALL_TYPE GetFileContents(const Char*                             Name,
+                                                    CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                    IDataBlob**                             ppContents,
+                                                    size_t*                                 pHash) override final;
+
+    virtual void DILIGENT_CALL_TYPE GetStats(ShaderSourceFileCacheStats& Stats) override final;
+
+    virtual void DILIGENT_CALL_TYPE Clear() override final;
 
 private:
+    static const Char* SkipLeadingSlash(const Char* Name)
+    {
+        return (Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name;
+    }
+
+    String FindFile(const Char* RelativePath) const;
+
+    void CreateUncachedInputStream(const Char*                             Name,
+                                   CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                   IFileStream**                           ppStream);
+
     std::vector<String> m_SearchDirectories;
+
+    const bool m_EnableCache;
+    const bool m_UseMemoryMapping;
+    const bool m_CheckFileTimeStamps;
+
+    struct CachedFile
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        FileTimeStamp            TimeStamp;
+        size_t                   Hash = 0;
+    };
+
+    std::mutex m_CacheMtx;
+    // Maps the file name to the full path found in the search directories
+    std::unordered_map<String, String> m_ResolvedPaths;
+    // Maps the full path to the file contents
+    std::unordered_map<String, CachedFile> m_Files;
+    ShaderSourceFileCacheStats             m_Stats;
 };
 
-DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories) :
-    ObjectBase<IShaderSourceInputStreamFactory>(pRefCounters)
+DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCounters*                               pRefCounters,
+                                                                   const DefaultShaderSourceStreamFactoryCreateInfo& CreateInfo) :
+    TBase{pRefCounters},
+    // clang-format off
+    m_EnableCache        {CreateInfo.EnableCache        },
+    m_UseMemoryMapping   {CreateInfo.UseMemoryMapping   },
+    m_CheckFileTimeStamps{CreateInfo.CheckFileTimeStamps}
+// clang-format on
 {
+    const auto* SearchDirectories = CreateInfo.SearchDirectories;
     while (SearchDirectories)
     {
         const char* Semicolon = strchr(SearchDirectories, ';');
@@ -80,6 +134,22 @@ DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCou
     m_SearchDirectories.push_back("");
 }
 
+void DefaultShaderSourceStreamFactory::QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface)
+{
+    if (ppInterface == nullptr)
+        return;
+
+    if (IID == IID_IShaderSourceInputStreamFactory || (m_EnableCache && IID == IID_ShaderSourceFileCache))
+    {
+        *ppInterface = this;
+        (*ppInterface)->AddRef();
+    }
+    else
+    {
+        TBase::QueryInterface(IID, ppInterface);
+    }
+}
+
 void DefaultShaderSourceStreamFactory::CreateInputStream(const Char*   Name,
                                                          IFileStream** ppStream)
 {
@@ -89,12 +159,33 @@ void DefaultShaderSourceStreamFactory::CreateInputStream(const Char*   Name,
 void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*                             Name,
                                                           CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
                                                           IFileStream**                           ppStream)
+{
+    if (!m_EnableCache)
+    {
+        CreateUncachedInputStream(Name, Flags, ppStream);
+        return;
+    }
+
+    *ppStream = nullptr;
+
+    RefCntAutoPtr<IDataBlob> pContents;
+    GetFileContents(Name, Flags, &pContents, nullptr);
+    if (pContents)
+    {
+        RefCntAutoPtr<MemoryFileStream> pMemStream{MakeNewRCObj<MemoryFileStream>()(pContents)};
+        pMemStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+    }
+}
+
+void DefaultShaderSourceStreamFactory::CreateUncachedInputStream(const Char*                             Name,
+                                                                 CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                                 IFileStream**                           ppStream)
 {
     bool                                     bFileCreated = false;
     Diligent::RefCntAutoPtr<BasicFileStream> pBasicFileStream;
     for (const auto& SearchDir : m_SearchDirectories)
     {
-        String FullPath = SearchDir + ((Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name);
+        String FullPath = SearchDir + SkipLeadingSlash(Name);
         if (!FileSystem::FileExists(FullPath.c_str()))
             continue;
         pBasicFileStream = MakeNewRCObj<BasicFileStream>()(FullPath.c_str(), EFileAccessMode::Read);
@@ -122,13 +213,169 @@ void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*
     }
 }
 
+String DefaultShaderSourceStreamFactory::FindFile(const Char* RelativePath) const
+{
+    for (const auto& SearchDir : m_SearchDirectories)
+    {
+        String FullPath = SearchDir + RelativePath;
+        if (FileSystem::FileExists(FullPath.c_str()))
+            return FullPath;
+    }
+    return String{};
+}
+
+void DefaultShaderSourceStreamFactory::GetFileContents(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IDataBlob**                             ppContents,
+                                                       size_t*                                 pHash)
+{
+    DEV_CHECK_ERR(Name != nullptr, "File name must not be null");
+    DEV_CHECK_ERR(ppContents != nullptr && *ppContents == nullptr, "ppContents must not be null and must point to null");
+    VERIFY(m_EnableCache, "This method must only be called when the cache is enabled");
+
+    const auto* RelativePath = SkipLeadingSlash(Name);
+
+    String FullPath;
+    {
+        std::lock_guard<std::mutex> Lock{m_CacheMtx};
+
+        auto path_it = m_ResolvedPaths.find(RelativePath);
+        if (path_it != m_ResolvedPaths.end())
+        {
+            FullPath = path_it->second;
+            ++m_Stats.NumResolvedPathHits;
+        }
+    }
+
+    // Try the memoized path first. If the file was removed since then, search again.
+    for (Uint32 Attempt = 0; Attempt < 2; ++Attempt)
+    {
+        if (FullPath.empty())
+        {
+            FullPath = FindFile(RelativePath);
+            if (FullPath.empty())
+                break;
+
+            std::lock_guard<std::mutex> Lock{m_CacheMtx};
+            m_ResolvedPaths[RelativePath] = FullPath;
+            ++m_Stats.NumPathResolutions;
+        }
+
+        FileTimeStamp TimeStamp;
+        const auto    HasTimeStamp = m_CheckFileTimeStamps && MappedFileDataBlob::GetFileTimeStamp(FullPath.c_str(), TimeStamp);
+        if (m_CheckFileTimeStamps && !HasTimeStamp && !FileSystem::FileExists(FullPath.c_str()))
+        {
+            // The file has been removed - forget the cached data and search again
+            std::lock_guard<std::mutex> Lock{m_CacheMtx};
+            m_ResolvedPaths.erase(RelativePath);
+            m_Files.erase(FullPath);
+            FullPath.clear();
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock{m_CacheMtx};
+
+            auto file_it = m_Files.find(FullPath);
+            if (file_it != m_Files.end())
+            {
+                auto& File = file_it->second;
+                if (!HasTimeStamp || File.TimeStamp == TimeStamp)
+                {
+                    ++m_Stats.NumCacheHits;
+                    m_Stats.BytesServedFromCache += File.pData->GetSize();
+
+                    *ppContents = File.pData;
+                    (*ppContents)->AddRef();
+                    if (pHash != nullptr)
+                        *pHash = File.Hash;
+                    return;
+                }
+                // The file time stamp has changed. The cached entry is kept until the new contents
+                // are loaded so that the hashes can be compared.
+            }
+        }
+
+        auto pFileData = MappedFileDataBlob::Create(FullPath.c_str(), m_UseMemoryMapping);
+        if (!pFileData)
+        {
+            // The file was probably removed - forget the resolved path and search again
+            std::lock_guard<std::mutex> Lock{m_CacheMtx};
+            m_ResolvedPaths.erase(RelativePath);
+            m_Files.erase(FullPath);
+            FullPath.clear();
+            continue;
+        }
+
+        CachedFile NewFile;
+        NewFile.TimeStamp = pFileData->GetTimeStamp();
+        NewFile.Hash      = ComputeHashRaw(pFileData->GetConstDataPtr(), pFileData->GetSize());
+        NewFile.pData     = pFileData;
+
+        if (pHash != nullptr)
+            *pHash = NewFile.Hash;
+
+        std::lock_guard<std::mutex> Lock{m_CacheMtx};
+        ++m_Stats.NumFileLoads;
+        m_Stats.BytesRead += pFileData->GetSize();
+
+        auto file_it = m_Files.find(FullPath);
+        if (file_it != m_Files.end())
+        {
+            auto& File = file_it->second;
+            if (File.Hash == NewFile.Hash && File.pData->GetSize() == NewFile.pData->GetSize())
+            {
+                // The file was touched, but its contents did not change - keep sharing the cached data
+                File.TimeStamp = NewFile.TimeStamp;
+                *ppContents    = File.pData;
+                (*ppContents)->AddRef();
+                return;
+            }
+
+            // The file has been modified since it was loaded
+            ++m_Stats.NumInvalidations;
+        }
+
+        *ppContents = NewFile.pData;
+        (*ppContents)->AddRef();
+        // If another thread has loaded the file in the meantime, keep the latest version
+        m_Files[FullPath] = std::move(NewFile);
+        return;
+    }
+
+    if ((Flags & CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT) == 0)
+    {
+        LOG_ERROR("Failed to find shader source file ", Name);
+    }
+}
+
+void DefaultShaderSourceStreamFactory::GetStats(ShaderSourceFileCacheStats& Stats)
+{
+    std::lock_guard<std::mutex> Lock{m_CacheMtx};
+    Stats = m_Stats;
+}
+
+void DefaultShaderSourceStreamFactory::Clear()
+{
+    std::lock_guard<std::mutex> Lock{m_CacheMtx};
+    m_ResolvedPaths.clear();
+    m_Files.clear();
+}
+
 void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
                                             IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory)
 {
+    DefaultShaderSourceStreamFactoryCreateInfo CreateInfo;
+    CreateInfo.SearchDirectories = SearchDirectories;
+    CreateDefaultShaderSourceStreamFactory2(CreateInfo, ppShaderSourceStreamFactory);
+}
 
+void CreateDefaultShaderSourceStreamFactory2(const DefaultShaderSourceStreamFactoryCreateInfo& CreateInfo,
+                                             IShaderSourceInputStreamFactory**                 ppShaderSourceStreamFactory)
+{
     auto&                             Allocator = GetRawAllocator();
     DefaultShaderSourceStreamFactory* pStreamFactory =
-        NEW_RC_OBJ(Allocator, "DefaultShaderSourceStreamFactory instance", DefaultShaderSourceStreamFactory)(SearchDirectories);
+        NEW_RC_OBJ(Allocator, "DefaultShaderSourceStreamFactory instance", DefaultShaderSourceStreamFactory)(CreateInfo);
     pStreamFactory->QueryInterface(IID_IShaderSourceInputStreamFactory, reinterpret_cast<IObject**>(ppShaderSourceStreamFactory));
 }
 
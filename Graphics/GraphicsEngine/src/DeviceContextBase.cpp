@@ -77,6 +77,43 @@ bool VerifyDrawIndexedAttribs(const DrawIndexedAttribs& Attribs)
     return true;
 }
 
+bool VerifyMultiDrawAttribs(const MultiDrawAttribs& Attribs)
+{
+#define CHECK_MULTI_DRAW_ATTRIBS(Expr, ...) CHECK_PARAMETER(Expr, "Multi-draw attribs are invalid: ", __VA_ARGS__)
+
+    CHECK_MULTI_DRAW_ATTRIBS(Attribs.DrawCount == 0 || Attribs.pDrawItems != nullptr,
+                             "DrawCount is ", Attribs.DrawCount, ", but pDrawItems is null.");
+
+    if (Attribs.DrawCount == 0)
+        LOG_INFO_MESSAGE("MultiDrawAttribs.DrawCount is 0. This is OK as the draw command will be ignored, but may be unintentional.");
+    if (Attribs.NumInstances == 0)
+        LOG_INFO_MESSAGE("MultiDrawAttribs.NumInstances is 0. This is OK as the draw command will be ignored, but may be unintentional.");
+
+#undef CHECK_MULTI_DRAW_ATTRIBS
+
+    return true;
+}
+
+bool VerifyMultiDrawIndexedAttribs(const MultiDrawIndexedAttribs& Attribs)
+{
+#define CHECK_MULTI_DRAW_INDEXED_ATTRIBS(Expr, ...) CHECK_PARAMETER(Expr, "Multi-draw indexed attribs are invalid: ", __VA_ARGS__)
+
+    CHECK_MULTI_DRAW_INDEXED_ATTRIBS(Attribs.IndexType == VT_UINT16 || Attribs.IndexType == VT_UINT32,
+                                     "IndexType (", GetValueTypeString(Attribs.IndexType), ") must be VT_UINT16 or VT_UINT32.");
+
+    CHECK_MULTI_DRAW_INDEXED_ATTRIBS(Attribs.DrawCount == 0 || Attribs.pDrawItems != nullptr,
+                                     "DrawCount is ", Attribs.DrawCount, ", but pDrawItems is null.");
+
+    if (Attribs.DrawCount == 0)
+        LOG_INFO_MESSAGE("MultiDrawIndexedAttribs.DrawCount is 0. This is OK as the draw command will be ignored, but may be unintentional.");
+    if (Attribs.NumInstances == 0)
+        LOG_INFO_MESSAGE("MultiDrawIndexedAttribs.NumInstances is 0. This is OK as the draw command will be ignored, but may be unintentional.");
+
+#undef CHECK_MULTI_DRAW_INDEXED_ATTRIBS
+
+    return true;
+}
+
 bool VerifyDrawMeshAttribs(Uint32 MaxDrawMeshTasksCount, const DrawMeshAttribs& Attribs)
 {
 #define CHECK_DRAW_MESH_ATTRIBS(Expr, ...) CHECK_PARAMETER(Expr, "Draw mesh attribs are invalid: ", __VA_ARGS__)
@@ -714,12 +751,24 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
                                  "Update is true, but InstanceCount (", Attribs.InstanceCount, ") does not match the previous value (", PrevInstanceCount, ").");
     }
 
+    const bool IndexAddressed = Attribs.pDirtyInstanceIndices != nullptr;
+    if (IndexAddressed)
+    {
+        CHECK_BUILD_TLAS_ATTRIBS(Attribs.Update, "pDirtyInstanceIndices is not null, but Update is false.");
+
+        CHECK_BUILD_TLAS_ATTRIBS(Attribs.BindingMode == Attribs.pTLAS->GetBuildInfo().BindingMode,
+                                 "pDirtyInstanceIndices is not null, but BindingMode does not match the value used in the previous build.");
+    }
+    else
+    {
+        CHECK_BUILD_TLAS_ATTRIBS(Attribs.DirtyInstanceCount == 0, "DirtyInstanceCount (", Attribs.DirtyInstanceCount, ") must be 0 when pDirtyInstanceIndices is null.");
+    }
+
     const auto& InstDesc          = Attribs.pInstanceBuffer->GetDesc();
     const auto  InstDataSize      = size_t{Attribs.InstanceCount} * size_t{TLAS_INSTANCE_DATA_SIZE};
     Uint32      AutoOffsetCounter = 0;
 
-    // Calculate instance data size
-    for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
+    const auto VerifyInstance = [&](Uint32 i) //
     {
         constexpr Uint32 BitMask = (1u << 24) - 1;
         const auto&      Inst    = Attribs.pInstances[i];
@@ -730,13 +779,17 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
                    (Inst.ContributionToHitGroupIndex & ~BitMask) == 0,
                "Only the lower 24 bits are used.");
 
-        CHECK_BUILD_TLAS_ATTRIBS(Inst.InstanceName != nullptr, "pInstances[", i, "].InstanceName must not be null.");
         CHECK_BUILD_TLAS_ATTRIBS(Inst.pBLAS != nullptr, "pInstances[", i, "].pBLAS must not be null.");
 
-        if (Attribs.Update)
+        if (!IndexAddressed)
         {
-            const TLASInstanceDesc IDesc = Attribs.pTLAS->GetInstanceDesc(Inst.InstanceName);
-            CHECK_BUILD_TLAS_ATTRIBS(IDesc.InstanceIndex != INVALID_INDEX, "Update is true, but pInstances[", i, "].InstanceName does not exists.");
+            CHECK_BUILD_TLAS_ATTRIBS(Inst.InstanceName != nullptr, "pInstances[", i, "].InstanceName must not be null.");
+
+            if (Attribs.Update)
+            {
+                const TLASInstanceDesc IDesc = Attribs.pTLAS->GetInstanceDesc(Inst.InstanceName);
+                CHECK_BUILD_TLAS_ATTRIBS(IDesc.InstanceIndex != INVALID_INDEX, "Update is true, but pInstances[", i, "].InstanceName does not exists.");
+            }
         }
 
         if (Inst.ContributionToHitGroupIndex == TLAS_INSTANCE_OFFSET_AUTO)
@@ -746,10 +799,35 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
                                  "pInstances[", i,
                                  "].ContributionToHitGroupIndex must be TLAS_INSTANCE_OFFSET_AUTO "
                                  "if BindingMode is not HIT_GROUP_BINDING_MODE_USER_DEFINED.");
+        return true;
+    };
+
+    if (IndexAddressed)
+    {
+        // Only the instances that changed since the previous build are validated
+        for (Uint32 i = 0; i < Attribs.DirtyInstanceCount; ++i)
+        {
+            const auto InstIdx = Attribs.pDirtyInstanceIndices[i];
+            CHECK_BUILD_TLAS_ATTRIBS(InstIdx < Attribs.InstanceCount,
+                                     "pDirtyInstanceIndices[", i, "] (", InstIdx, ") must be less than InstanceCount (", Attribs.InstanceCount, ").");
+            if (!VerifyInstance(InstIdx))
+                return false;
+        }
+
+        CHECK_BUILD_TLAS_ATTRIBS(AutoOffsetCounter == 0 || AutoOffsetCounter == Attribs.DirtyInstanceCount,
+                                 "all pInstances[pDirtyInstanceIndices[i]].ContributionToHitGroupIndex must be TLAS_INSTANCE_OFFSET_AUTO, or none of them should.");
     }
+    else
+    {
+        for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
+        {
+            if (!VerifyInstance(i))
+                return false;
+        }
 
-    CHECK_BUILD_TLAS_ATTRIBS(AutoOffsetCounter == 0 || AutoOffsetCounter == Attribs.InstanceCount,
-                             "all pInstances[i].ContributionToHitGroupIndex must be TLAS_INSTANCE_OFFSET_AUTO, or none of them should.");
+        CHECK_BUILD_TLAS_ATTRIBS(AutoOffsetCounter == 0 || AutoOffsetCounter == Attribs.InstanceCount,
+                                 "all pInstances[i].ContributionToHitGroupIndex must be TLAS_INSTANCE_OFFSET_AUTO, or none of them should.");
+    }
 
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.InstanceBufferOffset <= InstDesc.Size,
                              "InstanceBufferOffset (", Attribs.InstanceBufferOffset, ") is greater than the buffer size (", InstDesc.Size, ").");
@@ -104,6 +104,30 @@ void ValidatePipelineResourceSignatureDesc(const PipelineResourceSignatureDesc&
             LOG_PRS_ERROR_AND_THROW("Incorrect Desc.Resources[", i, "].Flags (RUNTIME_ARRAY). The flag can only be used if ShaderResourceRuntimeArray device feature is enabled.");
         }
 
+        if ((Res.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0)
+        {
+            if (!Features.BindlessResources)
+                LOG_PRS_ERROR_AND_THROW("Incorrect Desc.Resources[", i, "].Flags (BINDLESS). The flag can only be used if BindlessResources device feature is enabled.");
+
+            if ((Res.Flags & PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY) == 0)
+                LOG_PRS_ERROR_AND_THROW("Incorrect Desc.Resources[", i, "].Flags (", GetPipelineResourceFlagsString(Res.Flags), "). BINDLESS flag must be used together with RUNTIME_ARRAY flag.");
+
+            if (Res.VarType != SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE)
+            {
+                LOG_PRS_ERROR_AND_THROW("Incorrect Desc.Resources[", i, "].VarType (", GetShaderVariableTypeLiteralName(Res.VarType),
+                                        "). Bindless resources must be mutable.");
+            }
+
+            if ((Res.ResourceType == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER ||
+                 Res.ResourceType == SHADER_RESOURCE_TYPE_BUFFER_SRV ||
+                 Res.ResourceType == SHADER_RESOURCE_TYPE_BUFFER_UAV) &&
+                (Res.Flags & PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS) == 0)
+            {
+                LOG_PRS_ERROR_AND_THROW("Incorrect Desc.Resources[", i, "].Flags (", GetPipelineResourceFlagsString(Res.Flags),
+                                        "). Bindless buffers must be labeled with NO_DYNAMIC_BUFFERS flag.");
+            }
+        }
+
         if (Res.ResourceType == SHADER_RESOURCE_TYPE_ACCEL_STRUCT && !Features.RayTracing)
         {
             LOG_PRS_ERROR_AND_THROW("Incorrect Desc.Resources[", i, "].ResourceType (ACCEL_STRUCT): ray tracing is not supported by device.");
@@ -359,6 +383,9 @@ bool PipelineResourceSignaturesCompatible(const PipelineResourceSignatureDesc& D
     if (Desc0.BindingIndex != Desc1.BindingIndex)
         return false;
 
+    if (Desc0.Flags != Desc1.Flags)
+        return false;
+
     if (Desc0.NumResources != Desc1.NumResources)
         return false;
 
@@ -389,7 +416,7 @@ size_t CalculatePipelineResourceSignatureDescHash(const PipelineResourceSignatur
     if (Desc.NumResources == 0 && Desc.NumImmutableSamplers == 0)
         return 0;
 
-    size_t Hash = ComputeHash(Desc.NumResources, Desc.NumImmutableSamplers, Desc.BindingIndex);
+    size_t Hash = ComputeHash(Desc.NumResources, Desc.NumImmutableSamplers, Desc.BindingIndex, Uint32{Desc.Flags});
 
     for (Uint32 i = 0; i < Desc.NumResources; ++i)
     {
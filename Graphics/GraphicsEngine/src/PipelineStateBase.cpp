@@ -393,6 +393,25 @@ void ValidatePipelineResourceLayoutDesc(const PipelineStateDesc& PSODesc, const
         LOG_ERROR_AND_THROW(GetShaderTypeLiteralName(Shader->GetDesc().ShaderType), " is not a valid type for ", ShaderName, " shader"); \
     }
 
+void ValidatePSOCreateFlags(const PipelineStateCreateInfo& CreateInfo, const DeviceFeatures& Features) noexcept(false)
+{
+    const auto& PSODesc = CreateInfo.PSODesc;
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE) != 0)
+    {
+        if (!PSODesc.IsAnyGraphicsPipeline())
+            LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag is only allowed for graphics and mesh pipelines.");
+
+        if (!Features.ExtendedDynamicState)
+            LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE flag requires ExtendedDynamicState feature.");
+    }
+
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_FAST_LINK) != 0 && !PSODesc.IsAnyGraphicsPipeline())
+        LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_FAST_LINK flag is only allowed for graphics and mesh pipelines.");
+
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0 && !PSODesc.IsAnyGraphicsPipeline() && !PSODesc.IsComputePipeline())
+        LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_ASYNCHRONOUS flag is only allowed for graphics, mesh and compute pipelines.");
+}
+
 void ValidateGraphicsPipelineCreateInfo(const GraphicsPipelineStateCreateInfo& CreateInfo,
                                         const DeviceFeatures&                  Features,
                                         const GraphicsAdapterInfo&             AdapterInfo) noexcept(false)
@@ -401,6 +420,7 @@ void ValidateGraphicsPipelineCreateInfo(const GraphicsPipelineStateCreateInfo& C
     if (PSODesc.PipelineType != PIPELINE_TYPE_GRAPHICS && PSODesc.PipelineType != PIPELINE_TYPE_MESH)
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be GRAPHICS or MESH.");
 
+    ValidatePSOCreateFlags(CreateInfo, Features);
     ValidatePipelineResourceSignatures(CreateInfo, Features);
 
     const auto& GraphicsPipeline = CreateInfo.GraphicsPipeline;
@@ -489,6 +509,7 @@ void ValidateComputePipelineCreateInfo(const ComputePipelineStateCreateInfo& Cre
     if (PSODesc.PipelineType != PIPELINE_TYPE_COMPUTE)
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be COMPUTE.");
 
+    ValidatePSOCreateFlags(CreateInfo, Features);
     ValidatePipelineResourceSignatures(CreateInfo, Features);
     ValidatePipelineResourceLayoutDesc(PSODesc, Features);
 
@@ -510,6 +531,7 @@ void ValidateRayTracingPipelineCreateInfo(IRenderDevice*
     if (!DeviceInfo.Features.RayTracing || (RTProps.CapFlags & RAY_TRACING_CAP_FLAG_STANDALONE_SHADERS) == 0)
         LOG_PSO_ERROR_AND_THROW("Standalone ray tracing shaders are not supported");
 
+    ValidatePSOCreateFlags(CreateInfo, DeviceInfo.Features);
     ValidatePipelineResourceSignatures(CreateInfo, DeviceInfo.Features);
     ValidatePipelineResourceLayoutDesc(PSODesc, DeviceInfo.Features);
 
@@ -595,6 +617,7 @@ void ValidateTilePipelineCreateInfo(const TilePipelineStateCreateInfo& CreateInf
     if (PSODesc.PipelineType != PIPELINE_TYPE_TILE)
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be TILE.");
 
+    ValidatePSOCreateFlags(CreateInfo, Features);
     ValidatePipelineResourceSignatures(CreateInfo, Features);
     ValidatePipelineResourceLayoutDesc(PSODesc, Features);
 
@@ -109,11 +109,13 @@ DeviceFeatures EnableDeviceFeatures(const DeviceFeatures& SupportedFeatures,
     ENABLE_FEATURE(TileShaders,                       "Tile shaders are");
     ENABLE_FEATURE(TransferQueueTimestampQueries,     "Timestamp queries in transfer queues are");
     ENABLE_FEATURE(VariableRateShading,               "Variable shading rate is");
+    ENABLE_FEATURE(NativeMultiDraw,                   "Native multi-draw is");
+    ENABLE_FEATURE(ExtendedDynamicState,              "Extended dynamic state is");
     // clang-format on
 #undef ENABLE_FEATURE
 
 #if defined(_MSC_VER) && defined(_WIN64)
-    static_assert(sizeof(Diligent::DeviceFeatures) == 38, "Did you add a new feature to DeviceFeatures? Please handle its satus here (if necessary).");
+    static_assert(sizeof(Diligent::DeviceFeatures) == 40, "Did you add a new feature to DeviceFeatures? Please handle its satus here (if necessary).");
 #endif
     return EnabledFeatures;
 }
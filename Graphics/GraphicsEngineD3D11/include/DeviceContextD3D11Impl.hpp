@@ -63,7 +63,8 @@ public:
     virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
 
     /// Implementation of IDeviceContext::Begin() in Direct3D11 backend.
-    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32             ImmediateContextId,
+                                          COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -82,6 +83,15 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise) override final;
+
+    /// Implementation of IDeviceContext::SetDepthStencilState() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -126,6 +136,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw(const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed(const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw(const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect(const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Direct3D11 backend.
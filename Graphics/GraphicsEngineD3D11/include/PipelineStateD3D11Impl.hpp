@@ -109,6 +109,12 @@ public:
 #endif
 
 private:
+    friend TPipelineStateBase;
+
+    // Called by TPipelineStateBase::Construct(), possibly from a worker thread
+    void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo);
+    void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
+
     template <typename PSOCreateInfoType>
     void InitInternalObjects(const PSOCreateInfoType& CreateInfo,
                              CComPtr<ID3DBlob>&       pVSByteCode);
@@ -68,9 +68,11 @@ DeviceContextD3D11Impl::DeviceContextD3D11Impl(IReferenceCounters*          pRef
 IMPLEMENT_QUERY_INTERFACE(DeviceContextD3D11Impl, IID_DeviceContextD3D11, TDeviceContextBase)
 
 
-void DeviceContextD3D11Impl::Begin(Uint32 ImmediateContextId)
+void DeviceContextD3D11Impl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     DEV_CHECK_ERR(ImmediateContextId == 0, "Direct3D11 supports only one immediate context");
+    // ID3D11CommandList can be executed any number of times, so all command lists are reusable
+    (void)Flags;
     TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
 }
 
@@ -499,6 +501,23 @@ void DeviceContextD3D11Impl::SetBlendFactors(const float* pBlendFactors)
     }
 }
 
+// ExtendedDynamicState feature is never enabled by Direct3D11 backend, so the methods below
+// only validate the calls.
+void DeviceContextD3D11Impl::SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise)
+{
+    TDeviceContextBase::SetCullMode(CullMode, FrontCounterClockwise, 0);
+}
+
+void DeviceContextD3D11Impl::SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc)
+{
+    TDeviceContextBase::SetDepthStencilState(DepthStencilDesc, 0);
+}
+
+void DeviceContextD3D11Impl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    TDeviceContextBase::SetPrimitiveTopology(Topology, 0);
+}
+
 void DeviceContextD3D11Impl::CommitD3D11IndexBuffer(VALUE_TYPE IndexType)
 {
     DEV_CHECK_ERR(m_pIndexBuffer, "Index buffer is not set up for indexed draw command");
@@ -685,6 +704,53 @@ void DeviceContextD3D11Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     }
 }
 
+void DeviceContextD3D11Impl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+
+    PrepareForDraw(Attribs.Flags);
+
+    if (Attribs.NumInstances == 0)
+        return;
+
+    // Direct3D11 has no native multi-draw, but the states are committed only once
+    const bool IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumVertices == 0)
+            continue;
+
+        if (IsInstanced)
+            m_pd3d11DeviceContext->DrawInstanced(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+        else
+            m_pd3d11DeviceContext->Draw(Item.NumVertices, Item.StartVertexLocation);
+    }
+}
+
+void DeviceContextD3D11Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    if (Attribs.NumInstances == 0)
+        return;
+
+    const bool IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumIndices == 0)
+            continue;
+
+        if (IsInstanced)
+            m_pd3d11DeviceContext->DrawIndexedInstanced(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+        else
+            m_pd3d11DeviceContext->DrawIndexed(Item.NumIndices, Item.FirstIndexLocation, Item.BaseVertex);
+    }
+}
+
 void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndirectArguments(Attribs);
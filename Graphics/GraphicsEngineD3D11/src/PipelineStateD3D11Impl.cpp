@@ -239,40 +239,7 @@ PipelineStateD3D11Impl::PipelineStateD3D11Impl(IReferenceCounters*
 {
     try
     {
-        CComPtr<ID3DBlob> pVSByteCode;
-        InitInternalObjects(CreateInfo, pVSByteCode);
-
-        if (GetD3D11VertexShader() == nullptr)
-            LOG_ERROR_AND_THROW("Vertex shader is null");
-
-        const auto& GraphicsPipeline = GetGraphicsPipelineDesc();
-        auto* const pDeviceD3D11     = pRenderDeviceD3D11->GetD3D11Device();
-
-        D3D11_BLEND_DESC D3D11BSDesc = {};
-        BlendStateDesc_To_D3D11_BLEND_DESC(GraphicsPipeline.BlendDesc, D3D11BSDesc);
-        CHECK_D3D_RESULT_THROW(pDeviceD3D11->CreateBlendState(&D3D11BSDesc, &m_pd3d11BlendState),
-                               "Failed to create D3D11 blend state object");
-
-        D3D11_RASTERIZER_DESC D3D11RSDesc = {};
-        RasterizerStateDesc_To_D3D11_RASTERIZER_DESC(GraphicsPipeline.RasterizerDesc, D3D11RSDesc);
-        CHECK_D3D_RESULT_THROW(pDeviceD3D11->CreateRasterizerState(&D3D11RSDesc, &m_pd3d11RasterizerState),
-                               "Failed to create D3D11 rasterizer state");
-
-        D3D11_DEPTH_STENCIL_DESC D3D11DSSDesc = {};
-        DepthStencilStateDesc_To_D3D11_DEPTH_STENCIL_DESC(GraphicsPipeline.DepthStencilDesc, D3D11DSSDesc);
-        CHECK_D3D_RESULT_THROW(pDeviceD3D11->CreateDepthStencilState(&D3D11DSSDesc, &m_pd3d11DepthStencilState),
-                               "Failed to create D3D11 depth stencil state");
-
-        // Create input layout
-        const auto& InputLayout = GraphicsPipeline.InputLayout;
-        if (InputLayout.NumElements > 0)
-        {
-            std::vector<D3D11_INPUT_ELEMENT_DESC, STDAllocatorRawMem<D3D11_INPUT_ELEMENT_DESC>> d311InputElements(STD_ALLOCATOR_RAW_MEM(D3D11_INPUT_ELEMENT_DESC, GetRawAllocator(), "Allocator for vector<D3D11_INPUT_ELEMENT_DESC>"));
-            LayoutElements_To_D3D11_INPUT_ELEMENT_DESCs(InputLayout, d311InputElements);
-
-            CHECK_D3D_RESULT_THROW(pDeviceD3D11->CreateInputLayout(d311InputElements.data(), static_cast<UINT>(d311InputElements.size()), pVSByteCode->GetBufferPointer(), pVSByteCode->GetBufferSize(), &m_pd3d11InputLayout),
-                                   "Failed to create the Direct3D11 input layout");
-        }
+        Construct(CreateInfo);
     }
     catch (...)
     {
@@ -288,9 +255,7 @@ PipelineStateD3D11Impl::PipelineStateD3D11Impl(IReferenceCounters*
 {
     try
     {
-        CComPtr<ID3DBlob> pVSByteCode;
-        InitInternalObjects(CreateInfo, pVSByteCode);
-        VERIFY(!pVSByteCode, "There must be no VS in a compute pipeline.");
+        Construct(CreateInfo);
     }
     catch (...)
     {
@@ -299,8 +264,54 @@ PipelineStateD3D11Impl::PipelineStateD3D11Impl(IReferenceCounters*
     }
 }
 
+void PipelineStateD3D11Impl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
+{
+    CComPtr<ID3DBlob> pVSByteCode;
+    InitInternalObjects(CreateInfo, pVSByteCode);
+
+    if (GetD3D11VertexShader() == nullptr)
+        LOG_ERROR_AND_THROW("Vertex shader is null");
+
+    const auto& GraphicsPipeline = GetGraphicsPipelineDesc();
+    auto* const pDeviceD3D11     = GetDevice()->GetD3D11Device();
+
+    D3D11_BLEND_DESC D3D11BSDesc = {};
+    BlendStateDesc_To_D3D11_BLEND_DESC(GraphicsPipeline.BlendDesc, D3D11BSDesc);
+    CHECK_D3D_RESULT_THROW(pDeviceD3D11->CreateBlendState(&D3D11BSDesc, &m_pd3d11BlendState),
+                           "Failed to create D3D11 blend state object");
+
+    D3D11_RASTERIZER_DESC D3D11RSDesc = {};
+    RasterizerStateDesc_To_D3D11_RASTERIZER_DESC(GraphicsPipeline.RasterizerDesc, D3D11RSDesc);
+    CHECK_D3D_RESULT_THROW(pDeviceD3D11->CreateRasterizerState(&D3D11RSDesc, &m_pd3d11RasterizerState),
+                           "Failed to create D3D11 rasterizer state");
+
+    D3D11_DEPTH_STENCIL_DESC D3D11DSSDesc = {};
+    DepthStencilStateDesc_To_D3D11_DEPTH_STENCIL_DESC(GraphicsPipeline.DepthStencilDesc, D3D11DSSDesc);
+    CHECK_D3D_RESULT_THROW(pDeviceD3D11->CreateDepthStencilState(&D3D11DSSDesc, &m_pd3d11DepthStencilState),
+                           "Failed to create D3D11 depth stencil state");
+
+    // Create input layout
+    const auto& InputLayout = GraphicsPipeline.InputLayout;
+    if (InputLayout.NumElements > 0)
+    {
+        std::vector<D3D11_INPUT_ELEMENT_DESC, STDAllocatorRawMem<D3D11_INPUT_ELEMENT_DESC>> d311InputElements(STD_ALLOCATOR_RAW_MEM(D3D11_INPUT_ELEMENT_DESC, GetRawAllocator(), "Allocator for vector<D3D11_INPUT_ELEMENT_DESC>"));
+        LayoutElements_To_D3D11_INPUT_ELEMENT_DESCs(InputLayout, d311InputElements);
+
+        CHECK_D3D_RESULT_THROW(pDeviceD3D11->CreateInputLayout(d311InputElements.data(), static_cast<UINT>(d311InputElements.size()), pVSByteCode->GetBufferPointer(), pVSByteCode->GetBufferSize(), &m_pd3d11InputLayout),
+                               "Failed to create the Direct3D11 input layout");
+    }
+}
+
+void PipelineStateD3D11Impl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
+{
+    CComPtr<ID3DBlob> pVSByteCode;
+    InitInternalObjects(CreateInfo, pVSByteCode);
+    VERIFY(!pVSByteCode, "There must be no VS in a compute pipeline.");
+}
+
 PipelineStateD3D11Impl::~PipelineStateD3D11Impl()
 {
+    WaitForAsyncInitialization();
     Destruct();
 }
 
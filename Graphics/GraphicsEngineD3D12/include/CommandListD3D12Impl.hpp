@@ -30,8 +30,13 @@
 /// \file
 /// Declaration of Diligent::CommandListD3D12Impl class
 
+#include <memory>
+#include <vector>
+
 #include "EngineD3D12ImplTraits.hpp"
 #include "CommandListBase.hpp"
+#include "D3D12DynamicHeap.hpp"
+#include "DescriptorHeap.hpp"
 
 namespace Diligent
 {
@@ -42,10 +47,30 @@ class CommandListD3D12Impl final : public CommandListBase<EngineD3D12ImplTraits>
 public:
     using TCommandListBase = CommandListBase<EngineD3D12ImplTraits>;
 
+    // Closed command list and the memory that a reusable command list references after the end of the frame
+    // in which it was recorded. The resources are released when the command list is destroyed.
+    struct ReusableResources
+    {
+        SoftwareQueueIndex CmdQueue{0};
+
+        // Fence value of the last submission of the command list
+        Uint64 LastSubmittedFenceValue = 0;
+
+        // The command list is owned by the command context
+        ID3D12CommandList*              pd3d12CmdList = nullptr;
+        CComPtr<ID3D12CommandAllocator> pCmdAllocator;
+
+        std::vector<D3D12DynamicPage>         DynamicPages;
+        std::vector<DescriptorHeapAllocation> DynamicDescriptors[2]; // D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV == 0
+                                                                     // D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER     == 1
+    };
+
+    // pReusableRes is only provided for command lists recorded with COMMAND_LIST_FLAG_REUSABLE flag.
     CommandListD3D12Impl(IReferenceCounters*                           pRefCounters,
                          RenderDeviceD3D12Impl*                        pDevice,
                          DeviceContextD3D12Impl*                       pDeferredCtx,
-                         RenderDeviceD3D12Impl::PooledCommandContext&& pCmdContext) :
+                         RenderDeviceD3D12Impl::PooledCommandContext&& pCmdContext,
+                         std::unique_ptr<ReusableResources>            pReusableRes = nullptr) :
         // clang-format off
         TCommandListBase
         {
@@ -53,8 +78,9 @@ public:
             pDevice,
             pDeferredCtx
         },
-        m_pDeferredCtx{pDeferredCtx          },
-        m_pCmdContext {std::move(pCmdContext)}
+        m_pDeferredCtx{pDeferredCtx           },
+        m_pCmdContext {std::move(pCmdContext) },
+        m_pReusableRes{std::move(pReusableRes)}
     // clang-format on
     {
         VERIFY_EXPR(m_pCmdContext);
@@ -62,7 +88,24 @@ public:
 
     ~CommandListD3D12Impl()
     {
-        if (m_pCmdContext != nullptr)
+        if (m_pReusableRes)
+        {
+            // The command list may still be pending execution. The memory it references is released
+            // through the release queue once the last submission is complete.
+            const auto CmdQueue   = m_pReusableRes->CmdQueue;
+            const auto FenceValue = m_pReusableRes->LastSubmittedFenceValue;
+            const auto QueueMask  = Uint64{1} << Uint64{CmdQueue};
+
+            m_pDevice->DisposeReusableCommandContext(CmdQueue, std::move(m_pCmdContext), std::move(m_pReusableRes->pCmdAllocator), FenceValue);
+            m_pDevice->GetDynamicMemoryManager().ReleasePages(m_pReusableRes->DynamicPages, QueueMask);
+            for (Uint32 HeapType = 0; HeapType < _countof(m_pReusableRes->DynamicDescriptors); ++HeapType)
+            {
+                auto& GPUHeap = m_pDevice->GetGPUDescriptorHeap(static_cast<D3D12_DESCRIPTOR_HEAP_TYPE>(HeapType));
+                for (auto& Allocation : m_pReusableRes->DynamicDescriptors[HeapType])
+                    GPUHeap.Free(std::move(Allocation), QueueMask);
+            }
+        }
+        else if (m_pCmdContext != nullptr)
         {
             LOG_WARNING_MESSAGE("Destroying command list that has not been executed");
             m_pDevice->DisposeCommandContext(std::move(m_pCmdContext));
@@ -75,13 +118,40 @@ public:
 
     RenderDeviceD3D12Impl::PooledCommandContext Close(RefCntAutoPtr<DeviceContextD3D12Impl>& pDeferredCtx)
     {
+        VERIFY(!IsReusable(), "Reusable command lists keep their command contexts until they are destroyed");
         pDeferredCtx = std::move(m_pDeferredCtx);
         return std::move(m_pCmdContext);
     }
 
+    bool IsReusable() const { return m_pReusableRes != nullptr; }
+
+    ID3D12CommandList* GetReusableD3D12CommandList() const
+    {
+        VERIFY_EXPR(IsReusable());
+        return m_pReusableRes->pd3d12CmdList;
+    }
+
+    SoftwareQueueIndex GetReusableCmdQueue() const
+    {
+        VERIFY_EXPR(IsReusable());
+        return m_pReusableRes->CmdQueue;
+    }
+
+    DeviceContextD3D12Impl* GetDeferredContext() const { return m_pDeferredCtx; }
+
+    // Records the fence value that will be signaled when the submission of the reusable command list is complete.
+    void OnReusableCmdListSubmitted(Uint64 FenceValue)
+    {
+        VERIFY_EXPR(IsReusable());
+        VERIFY_EXPR(FenceValue >= m_pReusableRes->LastSubmittedFenceValue);
+        m_pReusableRes->LastSubmittedFenceValue = FenceValue;
+    }
+
 private:
     RefCntAutoPtr<DeviceContextD3D12Impl>       m_pDeferredCtx;
     RenderDeviceD3D12Impl::PooledCommandContext m_pCmdContext;
+
+    std::unique_ptr<ReusableResources> m_pReusableRes;
 };
 
 } // namespace Diligent
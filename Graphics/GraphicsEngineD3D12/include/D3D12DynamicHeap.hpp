@@ -182,6 +182,10 @@ public:
     D3D12DynamicAllocation Allocate(Uint64 SizeInBytes, Uint64 Alignment, Uint64 DvpCtxFrameNumber);
     void                   ReleaseAllocatedPages(Uint64 QueueMask);
 
+    // Moves all allocated pages to the end of Pages. The caller takes ownership of the pages and
+    // must return them to the global memory manager with D3D12DynamicMemoryManager::ReleasePages().
+    void ExtractAllocatedPages(std::vector<D3D12DynamicPage>& Pages);
+
     static constexpr Uint64 InvalidOffset = static_cast<Uint64>(-1);
 
     size_t GetAllocatedPagesCount() const { return m_AllocatedPages.size(); }
@@ -561,6 +561,10 @@ public:
 
     void ReleaseAllocations(Uint64 CmdQueueMask);
 
+    // Moves all chunks to the end of Allocations. The caller takes ownership of the chunks and
+    // must return them to the parent GPU descriptor heap.
+    void ExtractAllocations(std::vector<DescriptorHeapAllocation>& Allocations);
+
     virtual DescriptorHeapAllocation Allocate(Uint32 Count) override final;
     virtual void                     Free(DescriptorHeapAllocation&& Allocation, Uint64 CmdQueueMask) override final
     {
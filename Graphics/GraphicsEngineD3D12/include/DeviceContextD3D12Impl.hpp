@@ -70,7 +70,8 @@ public:
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceContextD3D12, TDeviceContextBase)
 
     /// Implementation of IDeviceContext::Begin() in Direct3D12 backend.
-    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32             ImmediateContextId,
+                                          COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -89,6 +90,15 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise) override final;
+
+    /// Implementation of IDeviceContext::SetDepthStencilState() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -134,6 +144,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Direct3D12 backend.
@@ -506,6 +520,9 @@ private:
 
     Int32 m_ActiveQueriesCounter = 0;
 
+    // Whether the deferred context records a command list begun with COMMAND_LIST_FLAG_REUSABLE flag.
+    bool m_RecordingReusableCmdList = false;
+
     std::vector<OptimizedClearValue> m_AttachmentClearValues;
 
     std::vector<D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS> m_AttachmentResolveInfo;
@@ -76,6 +76,13 @@ public:
 #endif
 
 private:
+    friend TPipelineStateBase;
+
+    // Called by TPipelineStateBase::Construct(), possibly from a worker thread
+    void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo);
+    void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
+    void InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo);
+
     struct ShaderStageInfo
     {
         ShaderStageInfo() {}
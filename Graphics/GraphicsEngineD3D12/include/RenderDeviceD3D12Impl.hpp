@@ -200,12 +200,15 @@ public:
 
     void CloseAndExecuteTransientCommandContext(SoftwareQueueIndex CommandQueueId, PooledCommandContext&& Ctx);
 
+    // If ppClosedCmdLists is not null, null contexts are substituted with the command lists
+    // at the same positions of the array. These command lists must already be closed and are not disposed.
     Uint64 CloseAndExecuteCommandContexts(SoftwareQueueIndex                                     CommandQueueId,
                                           Uint32                                                 NumContexts,
                                           PooledCommandContext                                   pContexts[],
                                           bool                                                   DiscardStaleObjects,
                                           std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>>* pSignalFences,
-                                          std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>>* pWaitFences);
+                                          std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>>* pWaitFences,
+                                          ID3D12CommandList* const*                              ppClosedCmdLists = nullptr);
 
     void SignalFences(SoftwareQueueIndex CommandQueueId, std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>>& SignalFences);
     void WaitFences(SoftwareQueueIndex CommandQueueId, std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>>& WaitFences);
@@ -213,6 +216,13 @@ public:
     // Disposes an unused command context
     void DisposeCommandContext(PooledCommandContext&& Ctx);
 
+    // Disposes a closed command context of a reusable command list. The allocator is
+    // released once the last submission of the command list, identified by FenceValue, is complete.
+    void DisposeReusableCommandContext(SoftwareQueueIndex                CommandQueueId,
+                                       PooledCommandContext&&            Ctx,
+                                       CComPtr<ID3D12CommandAllocator>&& pAllocator,
+                                       Uint64                            FenceValue);
+
     void FlushStaleResources(SoftwareQueueIndex CommandQueueId);
 
     /// Implementation of IRenderDevice::() in Direct3D12 backend.
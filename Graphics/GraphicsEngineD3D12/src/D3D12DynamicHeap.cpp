@@ -261,4 +261,18 @@ void D3D12DynamicHeap::ReleaseAllocatedPages(Uint64 QueueMask)
     m_CurrAlignedSize   = 0;
 }
 
+void D3D12DynamicHeap::ExtractAllocatedPages(std::vector<D3D12DynamicPage>& Pages)
+{
+    Pages.reserve(Pages.size() + m_AllocatedPages.size());
+    for (auto& Page : m_AllocatedPages)
+        Pages.emplace_back(std::move(Page));
+    m_AllocatedPages.clear();
+
+    m_CurrOffset        = InvalidOffset;
+    m_AvailableSize     = 0;
+    m_CurrAllocatedSize = 0;
+    m_CurrUsedSize      = 0;
+    m_CurrAlignedSize   = 0;
+}
+
 } // namespace Diligent
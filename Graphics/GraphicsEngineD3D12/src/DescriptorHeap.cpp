@@ -536,6 +536,16 @@ void DynamicSuballocationsManager::ReleaseAllocations(Uint64 CmdQueueMask)
     m_CurrSuballocationsTotalSize = 0;
 }
 
+void DynamicSuballocationsManager::ExtractAllocations(std::vector<DescriptorHeapAllocation>& Allocations)
+{
+    Allocations.reserve(Allocations.size() + m_Suballocations.size());
+    for (auto& Allocation : m_Suballocations)
+        Allocations.emplace_back(std::move(Allocation));
+    m_Suballocations.clear();
+    m_CurrDescriptorCount         = 0;
+    m_CurrSuballocationsTotalSize = 0;
+}
+
 DescriptorHeapAllocation DynamicSuballocationsManager::Allocate(Uint32 Count)
 {
     // This method is intentionally lock-free as it is expected to
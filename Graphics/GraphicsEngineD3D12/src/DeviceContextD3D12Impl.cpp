@@ -248,15 +248,26 @@ ID3D12CommandSignature* DeviceContextD3D12Impl::GetDrawIndexedIndirectSignature(
     return Sig;
 }
 
-void DeviceContextD3D12Impl::Begin(Uint32 ImmediateContextId)
+void DeviceContextD3D12Impl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     DEV_CHECK_ERR(ImmediateContextId < m_pDevice->GetCommandQueueCount(), "ImmediateContextId is out of range");
+    if ((Flags & COMMAND_LIST_FLAG_REUSABLE) != 0)
+    {
+        // Dynamic memory and descriptors allocated by the context are transferred to the command list when the
+        // recording is finished, so there must be no allocations that may still be referenced by other command lists.
+        DEV_CHECK_ERR(m_DynamicHeap.GetAllocatedPagesCount() == 0 &&
+                          m_DynamicGPUDescriptorAllocator[0].GetSuballocationCount() == 0 &&
+                          m_DynamicGPUDescriptorAllocator[1].GetSuballocationCount() == 0,
+                      "Deferred context has dynamic allocations from the current frame. Reusable command lists must be recorded "
+                      "after FinishFrame() is called or after another reusable command list is finished.");
+    }
     SoftwareQueueIndex CommandQueueId{ImmediateContextId};
     const auto         d3d12CmdListType = m_pDevice->GetCommandQueueType(CommandQueueId);
     const auto         QueueType        = D3D12CommandListTypeToCmdQueueType(d3d12CmdListType);
     TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, QueueType);
     RequestCommandContext();
-    m_QueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
+    m_QueryMgr                 = &m_pDevice->GetQueryMgr(CommandQueueId);
+    m_RecordingReusableCmdList = (Flags & COMMAND_LIST_FLAG_REUSABLE) != 0;
 }
 
 void DeviceContextD3D12Impl::SetPipelineState(IPipelineState* pPipelineState)
@@ -500,6 +511,23 @@ void DeviceContextD3D12Impl::SetBlendFactors(const float* pBlendFactors)
     }
 }
 
+// ExtendedDynamicState feature is never enabled by Direct3D12 backend, so the methods below
+// only validate the calls.
+void DeviceContextD3D12Impl::SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise)
+{
+    TDeviceContextBase::SetCullMode(CullMode, FrontCounterClockwise, 0);
+}
+
+void DeviceContextD3D12Impl::SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc)
+{
+    TDeviceContextBase::SetDepthStencilState(DepthStencilDesc, 0);
+}
+
+void DeviceContextD3D12Impl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    TDeviceContextBase::SetPrimitiveTopology(Topology, 0);
+}
+
 void DeviceContextD3D12Impl::CommitD3D12IndexBuffer(GraphicsContext& GraphCtx, VALUE_TYPE IndexType)
 {
     DEV_CHECK_ERR(m_pIndexBuffer != nullptr, "Index buffer is not set up for indexed draw command");
@@ -686,6 +714,47 @@ void DeviceContextD3D12Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     }
 }
 
+void DeviceContextD3D12Impl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+
+    auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+    PrepareForDraw(GraphCtx, Attribs.Flags);
+    if (Attribs.NumInstances == 0)
+        return;
+
+    // Direct3D12 has no native multi-draw, but the states are committed only once
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumVertices > 0)
+        {
+            GraphCtx.Draw(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+            ++m_State.NumCommands;
+        }
+    }
+}
+
+void DeviceContextD3D12Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+
+    auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+    PrepareForIndexedDraw(GraphCtx, Attribs.Flags, Attribs.IndexType);
+    if (Attribs.NumInstances == 0)
+        return;
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumIndices > 0)
+        {
+            GraphCtx.DrawIndexed(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+            ++m_State.NumCommands;
+        }
+    }
+}
+
 void DeviceContextD3D12Impl::PrepareIndirectAttribsBuffer(CommandContext&                CmdCtx,
                                                           IBuffer*                       pAttribsBuffer,
                                                           RESOURCE_STATE_TRANSITION_MODE BufferStateTransitionMode,
@@ -947,6 +1016,8 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     // TODO: use small_vector
     std::vector<RenderDeviceD3D12Impl::PooledCommandContext> Contexts;
     Contexts.reserve(NumCommandLists + 1);
+    // Closed command lists of reusable command lists, at the same positions as the null entries in Contexts
+    std::vector<ID3D12CommandList*> ClosedCmdLists;
 
     // First, execute current context
     if (m_CurrCmdCtx)
@@ -962,6 +1033,17 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     for (Uint32 i = 0; i < NumCommandLists; ++i)
     {
         auto* const pCmdListD3D12 = ClassPtrCast<CommandListD3D12Impl>(ppCommandLists[i]);
+        if (pCmdListD3D12->IsReusable())
+        {
+            DEV_CHECK_ERR(pCmdListD3D12->GetReusableCmdQueue() == GetCommandQueueId(), "Reusable command list was recorded for immediate context #",
+                          Uint32{pCmdListD3D12->GetReusableCmdQueue()}, ", but executed by immediate context #", Uint32{GetCommandQueueId()}, ".");
+            // Reusable command list keeps its command context until it is destroyed
+            ClosedCmdLists.resize(Contexts.size() + 1);
+            ClosedCmdLists.back() = pCmdListD3D12->GetReusableD3D12CommandList();
+            Contexts.emplace_back();
+            pCmdListD3D12->GetDeferredContext()->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+            continue;
+        }
 
         RefCntAutoPtr<DeviceContextD3D12Impl> pDeferredCtx;
         Contexts.emplace_back(pCmdListD3D12->Close(pDeferredCtx));
@@ -972,9 +1054,21 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
 
     if (!Contexts.empty())
     {
-        m_pDevice->CloseAndExecuteCommandContexts(GetCommandQueueId(), static_cast<Uint32>(Contexts.size()), Contexts.data(), true, &m_SignalFences, &m_WaitFences);
+        const auto SubmittedFenceValue =
+            m_pDevice->CloseAndExecuteCommandContexts(GetCommandQueueId(), static_cast<Uint32>(Contexts.size()), Contexts.data(), true, &m_SignalFences, &m_WaitFences,
+                                                      !ClosedCmdLists.empty() ? ClosedCmdLists.data() : nullptr);
         m_SignalFences.clear();
 
+        if (!ClosedCmdLists.empty())
+        {
+            for (Uint32 i = 0; i < NumCommandLists; ++i)
+            {
+                auto* const pCmdListD3D12 = ClassPtrCast<CommandListD3D12Impl>(ppCommandLists[i]);
+                if (pCmdListD3D12->IsReusable())
+                    pCmdListD3D12->OnReusableCmdListSubmitted(SubmittedFenceValue);
+            }
+        }
+
 #ifdef DILIGENT_DEBUG
         for (Uint32 i = 0; i < NumCommandLists; ++i)
             VERIFY(!Contexts[i], "All contexts must be disposed by CloseAndExecuteCommandContexts");
@@ -2144,7 +2238,8 @@ void DeviceContextD3D12Impl::MapTextureSubresource(ITexture*                 pTe
             }
 
             DEV_CHECK_ERR((TexDesc.CPUAccessFlags & CPU_ACCESS_READ), "Texture '", TexDesc.Name, "' was not created with CPU_ACCESS_READ flag and can't be mapped for reading");
-            // Resources on D3D12_HEAP_TYPE_READBACK heaps do not support persistent map.
+            // Resources on D3D12_HEAP_TYPE_READBACK heaps may remain mapped, but the range the CPU reads must
+            // still be passed to Map() so that the CPU cache is invalidated after the GPU writes the data.
             InvalidateRange.Begin     = StaticCast<SIZE_T>(Footprint.Offset);
             const auto& NextFootprint = TextureD3D12.GetStagingFootprint(Subres + 1);
             InvalidateRange.End       = StaticCast<SIZE_T>(NextFootprint.Offset);
@@ -2267,7 +2362,23 @@ void DeviceContextD3D12Impl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
-    CommandListD3D12Impl* pCmdListD3D12(NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D12Impl instance", CommandListD3D12Impl)(m_pDevice, this, std::move(m_CurrCmdCtx)));
+    std::unique_ptr<CommandListD3D12Impl::ReusableResources> pReusableRes;
+    if (m_RecordingReusableCmdList)
+    {
+        // The command list is closed once and is submitted as is every time it is executed. The memory
+        // it references is owned by the command list until it is destroyed.
+        pReusableRes = std::make_unique<CommandListD3D12Impl::ReusableResources>();
+
+        pReusableRes->CmdQueue      = GetCommandQueueId();
+        pReusableRes->pd3d12CmdList = m_CurrCmdCtx->Close(pReusableRes->pCmdAllocator);
+        m_DynamicHeap.ExtractAllocatedPages(pReusableRes->DynamicPages);
+        for (size_t i = 0; i < _countof(m_DynamicGPUDescriptorAllocator); ++i)
+            m_DynamicGPUDescriptorAllocator[i].ExtractAllocations(pReusableRes->DynamicDescriptors[i]);
+
+        m_RecordingReusableCmdList = false;
+    }
+
+    CommandListD3D12Impl* pCmdListD3D12(NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D12Impl instance", CommandListD3D12Impl)(m_pDevice, this, std::move(m_CurrCmdCtx), std::move(pReusableRes)));
     pCmdListD3D12->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
     // We can't request new cmd context because we don't know the command queue type
@@ -2316,6 +2427,7 @@ void DeviceContextD3D12Impl::WaitForIdle()
 void DeviceContextD3D12Impl::BeginQuery(IQuery* pQuery)
 {
     TDeviceContextBase::BeginQuery(pQuery, 0);
+    DEV_CHECK_ERR(!m_RecordingReusableCmdList, "Queries can't be used in reusable command lists");
 
     auto*      pQueryD3D12Impl = ClassPtrCast<QueryD3D12Impl>(pQuery);
     const auto QueryType       = pQueryD3D12Impl->GetDesc().Type;
@@ -2334,6 +2446,7 @@ void DeviceContextD3D12Impl::BeginQuery(IQuery* pQuery)
 void DeviceContextD3D12Impl::EndQuery(IQuery* pQuery)
 {
     TDeviceContextBase::EndQuery(pQuery, 0);
+    DEV_CHECK_ERR(!m_RecordingReusableCmdList, "Queries can't be used in reusable command lists");
 
     auto*      pQueryD3D12Impl = ClassPtrCast<QueryD3D12Impl>(pQuery);
     const auto QueryType       = pQueryD3D12Impl->GetDesc().Type;
@@ -2678,46 +2791,55 @@ void DeviceContextD3D12Impl::BuildTLAS(const BuildTLASAttribs& Attribs)
 
     if (Attribs.Update)
     {
-        if (!pTLASD3D12->UpdateInstances(Attribs.pInstances, Attribs.InstanceCount, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
+        if (!pTLASD3D12->UpdateInstances(Attribs))
             return;
     }
     else
     {
-        if (!pTLASD3D12->SetInstanceData(Attribs.pInstances, Attribs.InstanceCount, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
+        if (!pTLASD3D12->SetInstanceData(Attribs))
             return;
     }
 
-    // copy instance data into instance buffer
+    if (Attribs.BLASTransitionMode != RESOURCE_STATE_TRANSITION_MODE_NONE)
     {
-        size_t Size     = Attribs.InstanceCount * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
-        auto   TmpSpace = m_DynamicHeap.Allocate(Size, 16, m_FrameNumber);
+        pTLASD3D12->ProcessBLASes([&](BottomLevelASD3D12Impl& BLAS) {
+            TransitionOrVerifyBLASState(CmdCtx, BLAS, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+        });
+    }
 
-        for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
-        {
-            const auto& Inst     = Attribs.pInstances[i];
-            const auto  InstDesc = pTLASD3D12->GetInstanceDesc(Inst.InstanceName);
+    // Copy the data of dirty instances into the instance buffer. The data of other instances is left intact.
+    if (const auto DirtyInstanceCount = pTLASD3D12->GetDirtyInstanceCount())
+    {
+        const size_t Size     = size_t{DirtyInstanceCount} * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+        auto         TmpSpace = m_DynamicHeap.Allocate(Size, 16, m_FrameNumber);
+        auto* const  pDstInst = static_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(TmpSpace.CPUAddress);
 
-            if (InstDesc.InstanceIndex >= Attribs.InstanceCount)
+        pTLASD3D12->ProcessDirtyInstances(
+            [&](Uint32 InstIndex, Uint32 DstIndex) //
             {
-                UNEXPECTED("Failed to find instance by name");
-                return;
-            }
-
-            auto& d3d12Inst  = static_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(TmpSpace.CPUAddress)[InstDesc.InstanceIndex];
-            auto* pBLASD3D12 = ClassPtrCast<BottomLevelASD3D12Impl>(Inst.pBLAS);
-
-            static_assert(sizeof(d3d12Inst.Transform) == sizeof(Inst.Transform), "size mismatch");
-            std::memcpy(&d3d12Inst.Transform, Inst.Transform.data, sizeof(d3d12Inst.Transform));
-
-            d3d12Inst.InstanceID                          = Inst.CustomId;
-            d3d12Inst.InstanceContributionToHitGroupIndex = InstDesc.ContributionToHitGroupIndex;
-            d3d12Inst.InstanceMask                        = Inst.Mask;
-            d3d12Inst.Flags                               = InstanceFlagsToD3D12RTInstanceFlags(Inst.Flags);
-            d3d12Inst.AccelerationStructure               = pBLASD3D12->GetGPUAddress();
-
-            TransitionOrVerifyBLASState(CmdCtx, *pBLASD3D12, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+                const auto& Inst      = Attribs.pInstances[pTLASD3D12->GetSrcInstanceIndex(InstIndex)];
+                const auto& InstDesc  = pTLASD3D12->GetInstance(InstIndex);
+                auto&       d3d12Inst = pDstInst[DstIndex];
+
+                static_assert(sizeof(d3d12Inst.Transform) == sizeof(Inst.Transform), "size mismatch");
+                std::memcpy(&d3d12Inst.Transform, Inst.Transform.data, sizeof(d3d12Inst.Transform));
+
+                d3d12Inst.InstanceID                          = Inst.CustomId;
+                d3d12Inst.InstanceContributionToHitGroupIndex = InstDesc.ContributionToHitGroupIndex;
+                d3d12Inst.InstanceMask                        = Inst.Mask;
+                d3d12Inst.Flags                               = InstanceFlagsToD3D12RTInstanceFlags(Inst.Flags);
+                d3d12Inst.AccelerationStructure               = InstDesc.pBLAS.RawPtr<BottomLevelASD3D12Impl>()->GetGPUAddress();
+            });
+
+        // Copy every range of dirty instances from its location in the packed upload data
+        auto RangeSpace = TmpSpace;
+        for (const auto& Range : pTLASD3D12->GetDirtyInstanceRanges())
+        {
+            const auto RangeSize = Uint64{Range.Count} * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+            const auto DstOffset = Attribs.InstanceBufferOffset + Uint64{Range.First} * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+            UpdateBufferRegion(pInstancesD3D12, RangeSpace, DstOffset, RangeSize, Attribs.InstanceBufferTransitionMode);
+            RangeSpace.Offset += RangeSize;
         }
-        UpdateBufferRegion(pInstancesD3D12, TmpSpace, Attribs.InstanceBufferOffset, Size, Attribs.InstanceBufferTransitionMode);
     }
     TransitionOrVerifyBufferState(CmdCtx, *pInstancesD3D12, Attribs.InstanceBufferTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
 
@@ -715,6 +715,10 @@ bool PipelineResourceSignatureD3D12Impl::DvpValidateCommittedResource(const Devi
         const auto& CachedRes = RootTable.GetResource(OffsetFromTableStart + ArrIndex);
         if (CachedRes.IsNull())
         {
+            // Bindless arrays are partially bound
+            if ((ResDesc.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0)
+                continue;
+
             LOG_ERROR_MESSAGE("No resource is bound to variable '", GetShaderResourcePrintName(D3DAttribs.Name, D3DAttribs.BindCount, ArrIndex),
                               "' in shader '", ShaderName, "' of PSO '", PSOName, "'.");
             BindingsOK = false;
@@ -249,6 +249,18 @@ void RenderDeviceD3D12Impl::DisposeCommandContext(PooledCommandContext&& Ctx)
     FreeCommandContext(std::move(Ctx));
 }
 
+void RenderDeviceD3D12Impl::DisposeReusableCommandContext(SoftwareQueueIndex                CommandQueueId,
+                                                          PooledCommandContext&&            Ctx,
+                                                          CComPtr<ID3D12CommandAllocator>&& pAllocator,
+                                                          Uint64                            FenceValue)
+{
+    auto& CmdListMngr = GetCmdListManager(CommandQueueId);
+    VERIFY_EXPR(CmdListMngr.GetCommandListType() == Ctx->GetCommandListType());
+    CmdListMngr.ReleaseAllocator(std::move(pAllocator), CommandQueueId, FenceValue);
+    // The command list may still be executed, but unlike the allocator it can be reset right away
+    FreeCommandContext(std::move(Ctx));
+}
+
 void RenderDeviceD3D12Impl::FreeCommandContext(PooledCommandContext&& Ctx)
 {
     std::lock_guard<std::mutex> LockGuard(m_ContextPoolMutex);
@@ -282,7 +294,8 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
                                                              PooledCommandContext                                   pContexts[],
                                                              bool                                                   DiscardStaleObjects,
                                                              std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>>* pSignalFences,
-                                                             std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>>* pWaitFences)
+                                                             std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>>* pWaitFences,
+                                                             ID3D12CommandList* const*                              ppClosedCmdLists)
 {
     VERIFY_EXPR(NumContexts > 0 && pContexts != 0);
 
@@ -296,7 +309,13 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
     for (Uint32 i = 0; i < NumContexts; ++i)
     {
         auto& pCtx = pContexts[i];
-        VERIFY_EXPR(pCtx);
+        if (!pCtx)
+        {
+            VERIFY(ppClosedCmdLists != nullptr && ppClosedCmdLists[i] != nullptr, "Either the context or the closed command list must not be null");
+            d3d12CmdLists.emplace_back(ppClosedCmdLists[i]);
+            CmdAllocators.emplace_back();
+            continue;
+        }
         VERIFY_EXPR(CmdListMngr.GetCommandListType() == pCtx->GetCommandListType());
         CComPtr<ID3D12CommandAllocator> pAllocator;
         d3d12CmdLists.emplace_back(pCtx->Close(pAllocator));
@@ -333,6 +352,8 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
 
     for (Uint32 i = 0; i < NumContexts; ++i)
     {
+        if (!pContexts[i])
+            continue;
         CmdListMngr.ReleaseAllocator(std::move(CmdAllocators[i]), CommandQueueId, FenceValue);
         FreeCommandContext(std::move(pContexts[i]));
     }
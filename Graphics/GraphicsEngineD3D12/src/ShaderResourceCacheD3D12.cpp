@@ -369,7 +369,7 @@ const ShaderResourceCacheD3D12::Resource& ShaderResourceCacheD3D12::SetResource(
     // Make sure dynamic offset is reset
     DstRes.BufferDynamicOffset = 0;
 
-    UpdateRevision();
+    UpdateRevision(RootIndex);
 
     return DstRes;
 }
@@ -224,7 +224,7 @@ private:
         if (m_DstTableCPUDescriptorHandle.ptr != 0)
         {
             VERIFY(CPUDescriptorHandle.ptr != 0, "CPU descriptor handle must not be null for resources allocated in descriptor tables");
-            DEV_CHECK_ERR(m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC || m_DstRes.pObject == nullptr, "Static and mutable resource descriptors should only be copied once");
+            DEV_CHECK_ERR(IsResourceRebindable(m_ResDesc) || m_DstRes.pObject == nullptr, "Static and mutable resource descriptors should only be copied once");
             const auto d3d12HeapType = m_ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER ?
                 D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER :
                 D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
@@ -332,7 +332,7 @@ void BindResourceHelper::CacheCB(const BindResourceInfo& BindInfo) const
 #endif
     if (pBuffD3D12)
     {
-        if (m_ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC && m_DstRes.pObject != nullptr)
+        if (!IsResourceRebindable(m_ResDesc) && m_DstRes.pObject != nullptr)
         {
             // Do not update resource if one is already bound unless it is dynamic. This may be
             // dangerous as CopyDescriptorsSimple() may interfere with GPU reading the same descriptor.
@@ -358,7 +358,7 @@ void BindResourceHelper::CacheCB(const BindResourceInfo& BindInfo) const
 
         if (m_DstTableCPUDescriptorHandle.ptr != 0)
         {
-            DEV_CHECK_ERR(m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC || m_DstRes.pObject == nullptr, "Static and mutable resource descriptors should only be copied once");
+            DEV_CHECK_ERR(IsResourceRebindable(m_ResDesc) || m_DstRes.pObject == nullptr, "Static and mutable resource descriptors should only be copied once");
             if (RangeSize == BuffDesc.Size)
             {
                 GetD3D12Device()->CopyDescriptorsSimple(1, m_DstTableCPUDescriptorHandle, CPUDescriptorHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
@@ -391,7 +391,7 @@ void BindResourceHelper::CacheSampler(const BindResourceInfo& BindInfo) const
 #endif
     if (pSamplerD3D12)
     {
-        if (m_ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC && m_DstRes.pObject != nullptr)
+        if (!IsResourceRebindable(m_ResDesc) && m_DstRes.pObject != nullptr)
         {
             // Do not update resource if one is already bound unless it is dynamic. This may be
             // dangerous as CopyDescriptorsSimple() may interfere with GPU reading the same descriptor.
@@ -418,7 +418,7 @@ void BindResourceHelper::CacheAccelStruct(const BindResourceInfo& BindInfo) cons
 #endif
     if (pTLASD3D12)
     {
-        if (m_ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC && m_DstRes.pObject != nullptr)
+        if (!IsResourceRebindable(m_ResDesc) && m_DstRes.pObject != nullptr)
         {
             // Do not update resource if one is already bound unless it is dynamic. This may be
             // dangerous as CopyDescriptorsSimple() may interfere with GPU reading the same descriptor.
@@ -500,7 +500,7 @@ void BindResourceHelper::CacheResourceView(const BindResourceInfo& BindInfo,
 #endif
     if (pViewD3D12)
     {
-        if (m_ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC && m_DstRes.pObject != nullptr)
+        if (!IsResourceRebindable(m_ResDesc) && m_DstRes.pObject != nullptr)
         {
             // Do not update resource if one is already bound unless it is dynamic. This may be
             // dangerous as CopyDescriptorsSimple() may interfere with GPU reading the same descriptor.
@@ -601,7 +601,7 @@ void BindResourceHelper::operator()(const BindResourceInfo& BindInfo) const
     }
     else
     {
-        DEV_CHECK_ERR(m_DstRes.pObject == nullptr || m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC,
+        DEV_CHECK_ERR(m_DstRes.pObject == nullptr || IsResourceRebindable(m_ResDesc),
                       "Shader variable '", m_ResDesc.Name, "' is not dynamic, but is being reset to null. This is an error and may cause unpredicted behavior. ",
                       "Use another shader resource binding instance or label the variable as dynamic if you need to bind another resource.");
 
@@ -619,7 +619,7 @@ void BindResourceHelper::operator()(const BindResourceInfo& BindInfo) const
                 const auto  SamOffsetFromTableStart = SamplerAttribs.OffsetFromTableStart(m_CacheType) + SamplerArrInd;
                 const auto& DstSam                  = const_cast<const ShaderResourceCacheD3D12&>(m_ResourceCache).GetRootTable(SamRootIndex).GetResource(SamOffsetFromTableStart);
 
-                DEV_CHECK_ERR(DstSam.pObject == nullptr || SamplerResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC,
+                DEV_CHECK_ERR(DstSam.pObject == nullptr || IsResourceRebindable(SamplerResDesc),
                               "Sampler variable '", SamplerResDesc.Name, "' is not dynamic, but is being reset to null. This is an error and may cause unpredicted behavior. ",
                               "Use another shader resource binding instance or label the variable as dynamic if you need to bind another sampler.");
 
@@ -637,6 +637,11 @@ void ShaderVariableManagerD3D12::BindResource(Uint32 ResIndex, const BindResourc
     VERIFY(m_pSignature->IsUsingSeparateSamplers() || GetResourceDesc(ResIndex).ResourceType != SHADER_RESOURCE_TYPE_SAMPLER,
            "Samplers should not be set directly when using combined texture samplers");
     BindResourceHelper BindResHelper{*m_pSignature, m_ResourceCache, ResIndex, BindInfo.ArrayIndex};
+
+    ShaderResourceCacheBase::BindlessUpdateScope BindlessScope{
+        m_ResourceCache,
+        (GetResourceDesc(ResIndex).Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0,
+        GetResourceAttribs(ResIndex).RootIndex(m_ResourceCache.GetContentType())};
     BindResHelper(BindInfo);
 }
 
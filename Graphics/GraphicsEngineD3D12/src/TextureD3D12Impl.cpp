@@ -338,9 +338,9 @@ TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
         BufferDesc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
         BufferDesc.Flags              = D3D12_RESOURCE_FLAG_NONE;
 
-        // Resources on D3D12_HEAP_TYPE_READBACK heaps do not support persistent map. Map() and Unmap() must be
-        // called between CPU and GPU accesses to the same memory address on some system architectures, when the
-        // page caching behavior is write-back. Map() and Unmap() invalidate and flush the last level CPU cache
+        // Resources on D3D12_HEAP_TYPE_READBACK heaps may be persistently mapped. However, Map() and Unmap() must
+        // still be called between CPU and GPU accesses to the same memory address on some system architectures,
+        // when the page caching behavior is write-back. Map() and Unmap() invalidate and flush the last level CPU cache
         // on some ARM systems, to marshal data between the CPU and GPU through memory addresses with write-back behavior.
         // https://docs.microsoft.com/en-us/windows/desktop/api/d3d12/nf-d3d12-id3d12resource-map
         auto hr = pd3d12Device->CreateCommittedResource(&StaginHeapProps, D3D12_HEAP_FLAG_NONE, &BufferDesc, d3d12State,
@@ -43,6 +43,7 @@
 #include "ShaderD3DBase.hpp"
 #include "DXCompiler.hpp"
 #include "HLSLUtils.hpp"
+#include "ShaderToolsCommon.hpp"
 #include "BasicMath.hpp"
 
 #ifndef D3DCOMPILE_ENABLE_UNBOUNDED_DESCRIPTOR_TABLES
@@ -63,20 +64,18 @@ public:
     STDMETHOD(Open)
     (THIS_ D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID* ppData, UINT* pBytes)
     {
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pStreamFactory->CreateInputStream(pFileName, &pSourceStream);
-        if (pSourceStream == nullptr)
+        auto pFileData = LoadShaderSourceFile(m_pStreamFactory, pFileName);
+        if (pFileData == nullptr)
         {
             LOG_ERROR("Failed to open shader include file ", pFileName, ". Check that the file exists");
             return E_FAIL;
         }
 
-        RefCntAutoPtr<IDataBlob> pFileData(MakeNewRCObj<DataBlobImpl>{}(0));
-        pSourceStream->ReadBlob(pFileData);
-        *ppData = pFileData->GetDataPtr();
+        *ppData = pFileData->GetConstDataPtr();
         *pBytes = StaticCast<UINT>(pFileData->GetSize());
 
-        m_DataBlobs.insert(std::make_pair(*ppData, pFileData));
+        // The same cached file may be opened several times
+        m_DataBlobs.emplace(*ppData, std::move(pFileData));
 
         return S_OK;
     }
@@ -84,13 +83,15 @@ public:
     STDMETHOD(Close)
     (THIS_ LPCVOID pData)
     {
-        m_DataBlobs.erase(pData);
+        auto it = m_DataBlobs.find(pData);
+        if (it != m_DataBlobs.end())
+            m_DataBlobs.erase(it);
         return S_OK;
     }
 
 private:
-    IShaderSourceInputStreamFactory*                      m_pStreamFactory;
-    std::unordered_map<LPCVOID, RefCntAutoPtr<IDataBlob>> m_DataBlobs;
+    IShaderSourceInputStreamFactory*                           m_pStreamFactory;
+    std::unordered_multimap<LPCVOID, RefCntAutoPtr<IDataBlob>> m_DataBlobs;
 };
 
 static HRESULT CompileShader(const char*             Source,
@@ -197,6 +197,18 @@ public:
     };
     template <typename... SubmitDataType>
     SubmittedCommandBufferInfo SubmitCommandBuffer(SoftwareQueueIndex QueueInd, bool DiscardStaleResources, const SubmitDataType&... SubmitData)
+    {
+        return SubmitCommandBufferWithFunc(QueueInd, DiscardStaleResources,
+                                           [&](CommandQueueType& CmdQueue) //
+                                           {
+                                               return CmdQueue.Submit(SubmitData...);
+                                           });
+    }
+
+    // Same as SubmitCommandBuffer(), but calls SubmitFunc(CommandQueueType&) to submit the work
+    // to the queue. SubmitFunc must return the fence value associated with the submitted work.
+    template <typename SubmitFuncType>
+    SubmittedCommandBufferInfo SubmitCommandBufferWithFunc(SoftwareQueueIndex QueueInd, bool DiscardStaleResources, SubmitFuncType&& SubmitFunc)
     {
         SubmittedCommandBufferInfo CmdBuffInfo;
         VERIFY_EXPR(QueueInd < m_CmdQueueCount);
@@ -211,7 +223,7 @@ public:
             CmdBuffInfo.CmdBufferNumber = Queue.NextCmdBufferNumber.fetch_add(1);
             // fetch_add returns the original value immediately preceding the addition.
 
-            CmdBuffInfo.FenceValue = Queue.CmdQueue->Submit(SubmitData...);
+            CmdBuffInfo.FenceValue = SubmitFunc(*Queue.CmdQueue);
         }
 
         if (DiscardStaleResources)
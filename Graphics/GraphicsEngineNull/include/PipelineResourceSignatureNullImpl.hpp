@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineResourceSignatureNullImpl class
+
+#include "EngineNullImplTraits.hpp"
+#include "PipelineResourceSignatureBase.hpp"
+
+// ShaderVariableManagerNull, ShaderResourceCacheNull, and ShaderResourceBindingNullImpl
+// are required by PipelineResourceSignatureBase
+#include "ShaderResourceCacheNull.hpp"
+#include "ShaderVariableManagerNull.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+
+#include "PipelineResourceAttribsNull.hpp"
+#include "SRBMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+/// Implementation of the Diligent::PipelineResourceSignatureNullImpl class
+class PipelineResourceSignatureNullImpl final : public PipelineResourceSignatureBase<EngineNullImplTraits>
+{
+public:
+    using TPipelineResourceSignatureBase = PipelineResourceSignatureBase<EngineNullImplTraits>;
+
+    using ResourceAttribs = TPipelineResourceSignatureBase::PipelineResourceAttribsType;
+
+    PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                      RenderDeviceNullImpl*                pDevice,
+                                      const PipelineResourceSignatureDesc& Desc,
+                                      SHADER_TYPE                          ShaderStages      = SHADER_TYPE_UNKNOWN,
+                                      bool                                 bIsDeviceInternal = false);
+    ~PipelineResourceSignatureNullImpl();
+
+    struct ImmutableSamplerAttribs
+    {
+        RefCntAutoPtr<ISampler> Ptr;
+    };
+
+    const ImmutableSamplerAttribs& GetImmutableSamplerAttribs(Uint32 SampIndex) const
+    {
+        VERIFY_EXPR(SampIndex < m_Desc.NumImmutableSamplers);
+        return m_ImmutableSamplers[SampIndex];
+    }
+
+    void InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache);
+
+    // Copies static resources from the static resource cache to the destination cache
+    void CopyStaticResources(ShaderResourceCacheNull& ResourceCache) const;
+
+private:
+    void Destruct();
+
+    void CreateLayout();
+
+private:
+    // The total number of resources in the SRB cache, accounting for array sizes.
+    Uint32 m_SRBCacheSize = 0;
+
+    ImmutableSamplerAttribs* m_ImmutableSamplers = nullptr; // [m_Desc.NumImmutableSamplers]
+};
+
+} // namespace Diligent
@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineStateNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "PipelineStateBase.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp" // Required by PipelineStateBase
+
+namespace Diligent
+{
+
+/// Pipeline state object implementation in Null backend.
+class PipelineStateNullImpl final : public PipelineStateBase<EngineNullImplTraits>
+{
+public:
+    using TPipelineStateBase = PipelineStateBase<EngineNullImplTraits>;
+
+    PipelineStateNullImpl(IReferenceCounters* pRefCounters, RenderDeviceNullImpl* pDeviceNull, const GraphicsPipelineStateCreateInfo& CreateInfo);
+    PipelineStateNullImpl(IReferenceCounters* pRefCounters, RenderDeviceNullImpl* pDeviceNull, const ComputePipelineStateCreateInfo& CreateInfo);
+    PipelineStateNullImpl(IReferenceCounters* pRefCounters, RenderDeviceNullImpl* pDeviceNull, const RayTracingPipelineStateCreateInfo& CreateInfo);
+    ~PipelineStateNullImpl();
+
+    struct ShaderStageInfo
+    {
+        ShaderStageInfo() {}
+        ShaderStageInfo(const ShaderNullImpl* pShader);
+
+        void   Append(const ShaderNullImpl* pShader);
+        size_t Count() const;
+
+        // Shader stage type. All shaders in the stage must have the same type.
+        SHADER_TYPE Type = SHADER_TYPE_UNKNOWN;
+
+        std::vector<const ShaderNullImpl*> Shaders;
+
+        friend SHADER_TYPE GetShaderStageType(const ShaderStageInfo& Stage) { return Stage.Type; }
+    };
+    using TShaderStages = std::vector<ShaderStageInfo>;
+
+private:
+    friend TPipelineStateBase;
+
+    // Called by TPipelineStateBase::Construct(), possibly from a worker thread
+    void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo);
+    void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
+    void InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo);
+
+    template <typename PSOCreateInfoType>
+    TShaderStages InitInternalObjects(const PSOCreateInfoType& CreateInfo);
+
+    void InitShaderGroupHandles();
+
+    void Destruct();
+};
+
+} // namespace Diligent
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::SwapChainNullImpl class
+
+#include "SwapChain.h"
+#include "SwapChainBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceNullImpl;
+class DeviceContextNullImpl;
+
+/// Swap chain implementation in Null backend.
+
+/// The swap chain is not associated with any window: its back buffer and depth buffer
+/// are regular textures, and Present() only finishes the frame in the immediate context.
+class SwapChainNullImpl final : public SwapChainBase<ISwapChain>
+{
+public:
+    using TSwapChainBase = SwapChainBase<ISwapChain>;
+
+    SwapChainNullImpl(IReferenceCounters*    pRefCounters,
+                      const SwapChainDesc&   SCDesc,
+                      RenderDeviceNullImpl*  pRenderDeviceNull,
+                      DeviceContextNullImpl* pDeviceContextNull);
+    ~SwapChainNullImpl();
+
+    /// Implementation of ISwapChain::Present() in Null backend.
+    virtual void DILIGENT_CALL_TYPE Present(Uint32 SyncInterval) override final;
+
+    /// Implementation of ISwapChain::Resize() in Null backend.
+    virtual void DILIGENT_CALL_TYPE Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFORM NewPreTransform) override final;
+
+    /// Implementation of ISwapChain::SetFullscreenMode() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetFullscreenMode(const DisplayModeAttribs& DisplayMode) override final {}
+
+    /// Implementation of ISwapChain::SetWindowedMode() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetWindowedMode() override final {}
+
+    /// Implementation of ISwapChain::GetCurrentBackBufferRTV() in Null backend.
+    virtual ITextureView* DILIGENT_CALL_TYPE GetCurrentBackBufferRTV() override final { return m_pRenderTargetView; }
+
+    /// Implementation of ISwapChain::GetDepthBufferDSV() in Null backend.
+    virtual ITextureView* DILIGENT_CALL_TYPE GetDepthBufferDSV() override final { return m_pDepthStencilView; }
+
+private:
+    void CreateBuffers();
+
+    RefCntAutoPtr<ITextureView> m_pRenderTargetView;
+    RefCntAutoPtr<ITextureView> m_pDepthStencilView;
+};
+
+} // namespace Diligent
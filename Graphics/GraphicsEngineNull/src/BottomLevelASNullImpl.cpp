@@ -0,0 +1,69 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "BottomLevelASNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+BottomLevelASNullImpl::BottomLevelASNullImpl(IReferenceCounters*      pRefCounters,
+                                             RenderDeviceNullImpl*    pDeviceNull,
+                                             const BottomLevelASDesc& Desc) :
+    TBottomLevelASBase{pRefCounters, pDeviceNull, Desc}
+{
+    const auto& RTProps = pDeviceNull->GetAdapterInfo().RayTracing;
+
+    if (m_Desc.CompactedSize == 0)
+    {
+        Uint64 MaxPrimitiveCount = 0;
+        for (Uint32 i = 0; i < m_Desc.TriangleCount; ++i)
+            MaxPrimitiveCount += m_Desc.pTriangles[i].MaxPrimitiveCount;
+        for (Uint32 i = 0; i < m_Desc.BoxCount; ++i)
+            MaxPrimitiveCount += m_Desc.pBoxes[i].MaxBoxCount;
+
+        DEV_CHECK_ERR(MaxPrimitiveCount <= RTProps.MaxPrimitivesPerBLAS,
+                      "Max primitive count (", MaxPrimitiveCount, ") exceeds device limit (", RTProps.MaxPrimitivesPerBLAS, ")");
+        DEV_CHECK_ERR(m_Desc.TriangleCount + m_Desc.BoxCount <= RTProps.MaxGeometriesPerBLAS,
+                      "Geometry count (", m_Desc.TriangleCount + m_Desc.BoxCount, ") exceeds device limit (", RTProps.MaxGeometriesPerBLAS, ").");
+
+        // Report non-zero scratch buffer sizes so that applications exercise the same
+        // code paths as with other backends.
+        m_ScratchSize.Build  = std::max(MaxPrimitiveCount * RenderDeviceNullImpl::ASScratchBytesPerPrimitive, Uint64{RTProps.ScratchBufferAlignment});
+        m_ScratchSize.Update = (m_Desc.Flags & RAYTRACING_BUILD_AS_ALLOW_UPDATE) != 0 ? m_ScratchSize.Build : 0;
+    }
+
+    SetState(RESOURCE_STATE_BUILD_AS_READ);
+}
+
+BottomLevelASNullImpl::~BottomLevelASNullImpl()
+{
+}
+
+} // namespace Diligent
@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "BufferNullImpl.hpp"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+
+#include "GraphicsAccessories.hpp"
+#include "EngineMemory.h"
+
+namespace Diligent
+{
+
+BufferNullImpl::BufferNullImpl(IReferenceCounters*        pRefCounters,
+                               FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                               RenderDeviceNullImpl*      pDeviceNull,
+                               const BufferDesc&          BuffDesc,
+                               const BufferData*          pBuffData /*= nullptr*/) :
+    // clang-format off
+    TBufferBase
+    {
+        pRefCounters,
+        BuffViewObjMemAllocator,
+        pDeviceNull,
+        BuffDesc,
+        false
+    }
+// clang-format on
+{
+    ValidateBufferInitData(BuffDesc, pBuffData);
+
+    if (pDeviceNull->AllocateResourceMemory())
+    {
+        m_Memory.resize(StaticCast<size_t>(m_Desc.Size));
+        if (pBuffData != nullptr && pBuffData->pData != nullptr)
+        {
+            VERIFY_EXPR(pBuffData->DataSize <= m_Desc.Size);
+            memcpy(m_Memory.data(), pBuffData->pData, StaticCast<size_t>(pBuffData->DataSize));
+        }
+    }
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+
+    // Buffer memory is plain system memory and is always coherent
+    m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
+}
+
+BufferNullImpl::~BufferNullImpl()
+{
+}
+
+void BufferNullImpl::CreateViewInternal(const BufferViewDesc& OrigViewDesc, IBufferView** ppView, bool bIsDefaultView)
+{
+    VERIFY(ppView != nullptr, "Null pointer provided");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        auto* pDeviceNullImpl   = GetDevice();
+        auto& BuffViewAllocator = pDeviceNullImpl->GetBuffViewObjAllocator();
+        VERIFY(&BuffViewAllocator == &m_dbgBuffViewAllocator, "Buff view allocator does not match allocator provided at buffer initialization");
+
+        BufferViewDesc ViewDesc = OrigViewDesc;
+        ValidateAndCorrectBufferViewDesc(m_Desc, ViewDesc, pDeviceNullImpl->GetAdapterInfo().Buffer.StructuredBufferOffsetAlignment);
+
+        *ppView = NEW_RC_OBJ(BuffViewAllocator, "BufferViewNullImpl instance", BufferViewNullImpl, bIsDefaultView ? this : nullptr)(pDeviceNullImpl, ViewDesc, this, bIsDefaultView);
+
+        if (!bIsDefaultView && *ppView)
+            (*ppView)->AddRef();
+    }
+    catch (const std::runtime_error&)
+    {
+        const auto* ViewTypeName = GetBufferViewTypeLiteralName(OrigViewDesc.ViewType);
+        LOG_ERROR("Failed to create view \"", OrigViewDesc.Name ? OrigViewDesc.Name : "", "\" (", ViewTypeName, ") for buffer \"", m_Desc.Name, "\"");
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,1449 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "DeviceContextNullImpl.hpp"
+
+#include <cstring>
+
+#include "RenderDeviceNullImpl.hpp"
+#include "CommandListNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+NODISCARD inline bool ResourceStateHasWriteAccess(RESOURCE_STATE State)
+{
+    static_assert(RESOURCE_STATE_MAX_BIT == (1u << 21), "This function must be updated to handle new resource state flag");
+    constexpr RESOURCE_STATE WriteAccessStates =
+        RESOURCE_STATE_RENDER_TARGET |
+        RESOURCE_STATE_UNORDERED_ACCESS |
+        RESOURCE_STATE_COPY_DEST |
+        RESOURCE_STATE_RESOLVE_DEST |
+        RESOURCE_STATE_BUILD_AS_WRITE;
+
+    return State & WriteAccessStates;
+}
+
+// Resolves the old resource state of a state transition and checks that it is consistent with the
+// state tracked by the resource. Returns false if the transition can't be performed.
+template <typename ResourceImplType>
+bool ResolveOldResourceState(const ResourceImplType& Resource, RESOURCE_STATE& OldState, const char* ResourceTypeName)
+{
+    if (OldState == RESOURCE_STATE_UNKNOWN)
+    {
+        if (Resource.IsInKnownState())
+        {
+            OldState = Resource.GetState();
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to transition the state of ", ResourceTypeName, " '", Resource.GetDesc().Name,
+                              "' because the state is unknown and is not explicitly specified.");
+            return false;
+        }
+    }
+    else
+    {
+        if (Resource.IsInKnownState() && Resource.GetState() != OldState)
+        {
+            LOG_ERROR_MESSAGE("The state ", GetResourceStateString(Resource.GetState()), " of ", ResourceTypeName, " '",
+                              Resource.GetDesc().Name, "' does not match the old state ", GetResourceStateString(OldState),
+                              " specified by the barrier");
+        }
+    }
+    return true;
+}
+
+// Updates the resource state the same way other backends do: the state only changes
+// when a barrier would be required.
+template <typename ResourceImplType>
+void UpdateResourceState(ResourceImplType& Resource, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateState)
+{
+    // Always add barrier after writes.
+    const bool AfterWrite = ResourceStateHasWriteAccess(OldState);
+    if (((OldState & NewState) != NewState || AfterWrite) && UpdateState)
+    {
+        Resource.SetState(NewState);
+    }
+}
+
+} // namespace
+
+DeviceContextNullImpl::DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                                             RenderDeviceNullImpl*    pDevice,
+                                             const DeviceContextDesc& Desc) :
+    // clang-format off
+    TDeviceContextBase{pRefCounters, pDevice, Desc},
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListNullImpl), 64}
+// clang-format on
+{
+}
+
+DeviceContextNullImpl::~DeviceContextNullImpl()
+{
+    if (m_NumCommands != 0)
+    {
+        if (IsDeferred())
+            LOG_ERROR_MESSAGE("There are outstanding commands in deferred context #", GetContextId(), " being destroyed, which indicates that FinishCommandList() has not been called.");
+        else
+            LOG_ERROR_MESSAGE("There are outstanding commands in the immediate context being destroyed, which indicates the context has not been Flush()'ed.");
+    }
+}
+
+void DeviceContextNullImpl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
+{
+    DEV_CHECK_ERR(ImmediateContextId == 0, "Null backend supports only one immediate context");
+    (void)Flags;
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+}
+
+DeviceContextNullImpl::ResourceBindInfo& DeviceContextNullImpl::GetBindInfo(PIPELINE_TYPE Type)
+{
+    VERIFY_EXPR(Type != PIPELINE_TYPE_INVALID);
+
+    // clang-format off
+    static_assert(PIPELINE_TYPE_GRAPHICS    == 0, "PIPELINE_TYPE_GRAPHICS == 0 is expected");
+    static_assert(PIPELINE_TYPE_COMPUTE     == 1, "PIPELINE_TYPE_COMPUTE == 1 is expected");
+    static_assert(PIPELINE_TYPE_MESH        == 2, "PIPELINE_TYPE_MESH == 2 is expected");
+    static_assert(PIPELINE_TYPE_RAY_TRACING == 3, "PIPELINE_TYPE_RAY_TRACING == 3 is expected");
+    static_assert(PIPELINE_TYPE_TILE        == 4, "PIPELINE_TYPE_TILE == 4 is expected");
+    // clang-format on
+    constexpr size_t Indices[] = {
+        0, // PIPELINE_TYPE_GRAPHICS
+        1, // PIPELINE_TYPE_COMPUTE
+        0, // PIPELINE_TYPE_MESH
+        2, // PIPELINE_TYPE_RAY_TRACING
+        0, // PIPELINE_TYPE_TILE
+    };
+    static_assert(_countof(Indices) == Uint32{PIPELINE_TYPE_LAST} + 1, "Please add the new pipeline type to the list above");
+
+    return m_BindInfo[Indices[Uint32{Type}]];
+}
+
+void DeviceContextNullImpl::SetPipelineState(IPipelineState* pPipelineState)
+{
+    auto* pPipelineStateNull = ClassPtrCast<PipelineStateNullImpl>(pPipelineState);
+    if (PipelineStateNullImpl::IsSameObject(m_pPipelineState, pPipelineStateNull))
+        return;
+
+    TDeviceContextBase::SetPipelineState(pPipelineStateNull, 0 /*Dummy*/);
+
+    DEV_CHECK_ERR(pPipelineStateNull->GetDesc().PipelineType != PIPELINE_TYPE_TILE, "Tile pipeline is not supported by Null backend");
+
+    auto& BindInfo = GetBindInfo(pPipelineStateNull->GetDesc().PipelineType);
+
+    Uint32 DvpCompatibleSRBCount = 0;
+    PrepareCommittedResources(BindInfo, DvpCompatibleSRBCount);
+}
+
+void DeviceContextNullImpl::CommitShaderResourceCaches(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
+    while (CommitSRBMask != 0)
+    {
+        const Uint32 sign = PlatformMisc::GetLSB(CommitSRBMask);
+        VERIFY_EXPR(sign < m_pPipelineState->GetResourceSignatureCount());
+        CommitSRBMask &= ~(Uint32{1} << sign);
+
+        DEV_CHECK_ERR(BindInfo.ResourceCaches[sign] != nullptr, "Resource cache at index ", sign, " is null");
+        // There are no descriptors to write, so committing the cache only makes it up-to-date.
+    }
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void DeviceContextNullImpl::DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo)
+{
+    if (BindInfo.ResourcesValidated)
+        return;
+
+    DvpVerifySRBCompatibility(BindInfo);
+
+    const auto SignCount = m_pPipelineState->GetResourceSignatureCount();
+    for (Uint32 i = 0; i < SignCount; ++i)
+    {
+        const auto* pSign = m_pPipelineState->GetResourceSignature(i);
+        if (pSign == nullptr || pSign->GetTotalResourceCount() == 0)
+            continue; // Skip null and empty signatures
+
+        DEV_CHECK_ERR(BindInfo.ResourceCaches[i] != nullptr,
+                      "No SRB is committed for resource signature '", pSign->GetDesc().Name, "', binding index ", i, ".");
+    }
+
+    BindInfo.ResourcesValidated = true;
+}
+#endif
+
+void DeviceContextNullImpl::TransitionShaderResources(IPipelineState*, IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(!m_pActiveRenderPass, "State transitions are not allowed inside a render pass.");
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "pShaderResourceBinding must not be null");
+
+    auto* pResBindingNullImpl = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    auto& ResourceCache       = pResBindingNullImpl->GetResourceCache();
+
+    ResourceCache.TransitionResources<false>(this);
+}
+
+void DeviceContextNullImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
+
+    auto* pResBindingNullImpl = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    auto& ResourceCache       = pResBindingNullImpl->GetResourceCache();
+    if (ResourceCache.GetSize() == 0)
+    {
+        // Ignore SRBs that contain no resources
+        return;
+    }
+
+#ifdef DILIGENT_DEBUG
+    ResourceCache.DbgVerifyResourceInitialization();
+#endif
+
+    if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        ResourceCache.TransitionResources<false>(this);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        ResourceCache.TransitionResources<true>(this);
+    }
+#endif
+
+    const auto SRBIndex = pResBindingNullImpl->GetBindingIndex();
+    auto&      BindInfo = GetBindInfo(pResBindingNullImpl->GetPipelineType());
+    BindInfo.Set(SRBIndex, pResBindingNullImpl);
+}
+
+void DeviceContextNullImpl::SetStencilRef(Uint32 StencilRef)
+{
+    TDeviceContextBase::SetStencilRef(StencilRef, 0);
+}
+
+void DeviceContextNullImpl::SetBlendFactors(const float* pBlendFactors)
+{
+    TDeviceContextBase::SetBlendFactors(pBlendFactors, 0);
+}
+
+void DeviceContextNullImpl::SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise)
+{
+    TDeviceContextBase::SetCullMode(CullMode, FrontCounterClockwise, 0);
+}
+
+void DeviceContextNullImpl::SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc)
+{
+    TDeviceContextBase::SetDepthStencilState(DepthStencilDesc, 0);
+}
+
+void DeviceContextNullImpl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    TDeviceContextBase::SetPrimitiveTopology(Topology, 0);
+}
+
+void DeviceContextNullImpl::SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer**                      ppBuffers,
+                                             const Uint64*                  pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+    for (Uint32 Buff = 0; Buff < m_NumVertexStreams; ++Buff)
+    {
+        auto& CurrStream = m_VertexStreams[Buff];
+        if (auto* pBufferNull = CurrStream.pBuffer.RawPtr())
+        {
+            TransitionOrVerifyBufferState(*pBufferNull, StateTransitionMode, RESOURCE_STATE_VERTEX_BUFFER,
+                                          "Setting vertex buffers (DeviceContextNullImpl::SetVertexBuffers)");
+        }
+    }
+}
+
+void DeviceContextNullImpl::InvalidateState()
+{
+    TDeviceContextBase::InvalidateState();
+    m_BindInfo = {};
+}
+
+void DeviceContextNullImpl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+    if (m_pIndexBuffer)
+    {
+        TransitionOrVerifyBufferState(*m_pIndexBuffer, StateTransitionMode, RESOURCE_STATE_INDEX_BUFFER,
+                                      "Binding buffer as index buffer (DeviceContextNullImpl::SetIndexBuffer)");
+    }
+}
+
+void DeviceContextNullImpl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    VERIFY(NumViewports == m_NumViewports, "Unexpected number of viewports");
+}
+
+void DeviceContextNullImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    VERIFY(NumRects == m_NumScissorRects, "Unexpected number of scissor rects");
+}
+
+void DeviceContextNullImpl::TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    VERIFY(StateTransitionMode != RESOURCE_STATE_TRANSITION_MODE_TRANSITION || m_pActiveRenderPass == nullptr,
+           "State transitions are not allowed inside a render pass.");
+
+    if (m_pBoundDepthStencil)
+    {
+        auto* pDepthBufferNull = m_pBoundDepthStencil->GetTexture<TextureNullImpl>();
+        TransitionOrVerifyTextureState(*pDepthBufferNull, StateTransitionMode, RESOURCE_STATE_DEPTH_WRITE,
+                                       "Binding depth-stencil buffer (DeviceContextNullImpl::TransitionRenderTargets)");
+    }
+
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        if (auto& pRTVNull = m_pBoundRenderTargets[rt])
+        {
+            auto* pRenderTargetNull = pRTVNull->GetTexture<TextureNullImpl>();
+            TransitionOrVerifyTextureState(*pRenderTargetNull, StateTransitionMode, RESOURCE_STATE_RENDER_TARGET,
+                                           "Binding render targets (DeviceContextNullImpl::TransitionRenderTargets)");
+        }
+    }
+
+    if (m_pBoundShadingRateMap)
+    {
+        auto* pShadingRateMapNull = ClassPtrCast<TextureNullImpl>(m_pBoundShadingRateMap->GetTexture());
+        TransitionOrVerifyTextureState(*pShadingRateMapNull, StateTransitionMode, RESOURCE_STATE_SHADING_RATE,
+                                       "Binding shading rate map (DeviceContextNullImpl::TransitionRenderTargets)");
+    }
+}
+
+void DeviceContextNullImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Calling SetRenderTargets inside active render pass is invalid. End the render pass first");
+
+    if (TDeviceContextBase::SetRenderTargets(Attribs))
+    {
+        // Set the viewport to match the render target size
+        SetViewports(1, nullptr, 0, 0);
+    }
+
+    TransitionRenderTargets(Attribs.StateTransitionMode);
+}
+
+void DeviceContextNullImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    TDeviceContextBase::BeginRenderPass(Attribs);
+
+    VERIFY_EXPR(m_pActiveRenderPass != nullptr);
+    VERIFY_EXPR(m_pBoundFramebuffer != nullptr);
+
+    // Set the viewport to match the framebuffer size
+    SetViewports(1, nullptr, 0, 0);
+}
+
+void DeviceContextNullImpl::NextSubpass()
+{
+    TDeviceContextBase::NextSubpass();
+}
+
+void DeviceContextNullImpl::EndRenderPass()
+{
+    TDeviceContextBase::EndRenderPass();
+}
+
+void DeviceContextNullImpl::PrepareForDraw(DRAW_FLAGS Flags)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
+        DvpVerifyRenderTargets();
+
+    if (m_NumVertexStreams < m_pPipelineState->GetNumBufferSlotsUsed())
+        LOG_ERROR("Currently bound pipeline state '", m_pPipelineState->GetDesc().Name, "' expects ", m_pPipelineState->GetNumBufferSlotsUsed(), " input buffer slots, but only ", m_NumVertexStreams, " is bound");
+
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        for (Uint32 slot = 0; slot < m_NumVertexStreams; ++slot)
+        {
+            if (auto* pBufferNull = m_VertexStreams[slot].pBuffer.RawPtr())
+            {
+                DvpVerifyBufferState(*pBufferNull, RESOURCE_STATE_VERTEX_BUFFER, "Using vertex buffers (DeviceContextNullImpl::Draw)");
+            }
+        }
+
+        if (m_pActiveRenderPass == nullptr)
+            TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+    }
+#endif
+
+    auto& BindInfo = GetBindInfo(PIPELINE_TYPE_GRAPHICS);
+    if (Uint32 CommitMask = BindInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT))
+    {
+        CommitShaderResourceCaches(BindInfo, CommitMask);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources(BindInfo);
+#endif
+}
+
+void DeviceContextNullImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType)
+{
+    PrepareForDraw(Flags);
+
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        DvpVerifyBufferState(*m_pIndexBuffer, RESOURCE_STATE_INDEX_BUFFER, "Indexed draw call (DeviceContextNullImpl::Draw)");
+    }
+#endif
+    DEV_CHECK_ERR(IndexType == VT_UINT16 || IndexType == VT_UINT32, "Unsupported index format. Only R16_UINT and R32_UINT are allowed.");
+}
+
+BufferNullImpl* DeviceContextNullImpl::PrepareIndirectAttribsBuffer(IBuffer*                       pAttribsBuffer,
+                                                                    RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                                    const char*                    OpName)
+{
+    DEV_CHECK_ERR(pAttribsBuffer, "Indirect draw attribs buffer must not be null");
+    auto* pIndirectDrawAttribsNull = ClassPtrCast<BufferNullImpl>(pAttribsBuffer);
+
+    TransitionOrVerifyBufferState(*pIndirectDrawAttribsNull, TransitionMode, RESOURCE_STATE_INDIRECT_ARGUMENT, OpName);
+    return pIndirectDrawAttribsNull;
+}
+
+void DeviceContextNullImpl::Draw(const DrawAttribs& Attribs)
+{
+    DvpVerifyDrawArguments(Attribs);
+
+    PrepareForDraw(Attribs.Flags);
+
+    if (Attribs.NumVertices > 0 && Attribs.NumInstances > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    DvpVerifyDrawIndexedArguments(Attribs);
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    if (Attribs.NumIndices > 0 && Attribs.NumInstances > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+
+    PrepareForDraw(Attribs.Flags);
+
+    // Null device reports native multi-draw support, so the whole batch is recorded as one command
+    if (Attribs.DrawCount > 0 && Attribs.NumInstances > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    if (Attribs.DrawCount > 0 && Attribs.NumInstances > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    DvpVerifyDrawIndirectArguments(Attribs);
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Indirect draw (DeviceContextNullImpl::DrawIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+        PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Count buffer (DeviceContextNullImpl::DrawIndirect)");
+
+    PrepareForDraw(Attribs.Flags);
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    DvpVerifyDrawIndexedIndirectArguments(Attribs);
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Indirect draw (DeviceContextNullImpl::DrawIndexedIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+        PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Count buffer (DeviceContextNullImpl::DrawIndexedIndirect)");
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    DvpVerifyDrawMeshArguments(Attribs);
+
+    PrepareForDraw(Attribs.Flags);
+
+    if (Attribs.ThreadGroupCount > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
+{
+    DvpVerifyDrawMeshIndirectArguments(Attribs);
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Indirect draw (DeviceContextNullImpl::DrawMeshIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+        PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Counter buffer (DeviceContextNullImpl::DrawMeshIndirect)");
+
+    PrepareForDraw(Attribs.Flags);
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::PrepareForDispatchCompute()
+{
+    auto& BindInfo = GetBindInfo(PIPELINE_TYPE_COMPUTE);
+    if (Uint32 CommitMask = BindInfo.GetCommitMask())
+    {
+        CommitShaderResourceCaches(BindInfo, CommitMask);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources(BindInfo);
+#endif
+}
+
+void DeviceContextNullImpl::PrepareForRayTracing()
+{
+    auto& BindInfo = GetBindInfo(PIPELINE_TYPE_RAY_TRACING);
+    if (Uint32 CommitMask = BindInfo.GetCommitMask())
+    {
+        CommitShaderResourceCaches(BindInfo, CommitMask);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources(BindInfo);
+#endif
+}
+
+void DeviceContextNullImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    DvpVerifyDispatchArguments(Attribs);
+
+    PrepareForDispatchCompute();
+
+    if (Attribs.ThreadGroupCountX > 0 && Attribs.ThreadGroupCountY > 0 && Attribs.ThreadGroupCountZ > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    DvpVerifyDispatchIndirectArguments(Attribs);
+
+    PrepareForDispatchCompute();
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Indirect dispatch (DeviceContextNullImpl::DispatchComputeIndirect)");
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          fDepth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearDepthStencil(pView);
+
+    auto* pDSVNull = ClassPtrCast<TextureViewNullImpl>(pView);
+    if (pDSVNull != m_pBoundDepthStencil)
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "DSV was not found in the framebuffer. This is unexpected because TDeviceContextBase::ClearDepthStencil "
+                                               "checks if the DSV is bound as a framebuffer attachment and triggers an assert otherwise (in development mode).");
+        TransitionOrVerifyTextureState(*pDSVNull->GetTexture<TextureNullImpl>(), StateTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                       "Clearing depth-stencil buffer outside of render pass (DeviceContextNullImpl::ClearDepthStencil)");
+    }
+    else if (m_pActiveRenderPass == nullptr)
+    {
+        TransitionRenderTargets(StateTransitionMode);
+    }
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::ClearRenderTarget(ITextureView* pView, const float* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearRenderTarget(pView);
+
+    auto* pRTVNull = ClassPtrCast<TextureViewNullImpl>(pView);
+
+    bool IsBound = false;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets && !IsBound; ++rt)
+        IsBound = m_pBoundRenderTargets[rt] == pRTVNull;
+
+    if (!IsBound)
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "Render target was not found in the framebuffer. This is unexpected because TDeviceContextBase::ClearRenderTarget "
+                                               "checks if the RTV is bound as a framebuffer attachment and triggers an assert otherwise (in development mode).");
+        TransitionOrVerifyTextureState(*pRTVNull->GetTexture<TextureNullImpl>(), StateTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                       "Clearing render target outside of render pass (DeviceContextNullImpl::ClearRenderTarget)");
+    }
+    else if (m_pActiveRenderPass == nullptr)
+    {
+        TransitionRenderTargets(StateTransitionMode);
+    }
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::FinishFrame()
+{
+#ifdef DILIGENT_DEBUG
+    for (const auto& MappedBuffIt : m_DbgMappedBuffers)
+    {
+        const auto& BuffDesc = MappedBuffIt.first->GetDesc();
+        if (BuffDesc.Usage == USAGE_DYNAMIC)
+        {
+            LOG_WARNING_MESSAGE("Dynamic buffer '", BuffDesc.Name, "' is still mapped when finishing the frame. The contents of the buffer and mapped address will become invalid");
+        }
+    }
+#endif
+
+    if (m_NumCommands != 0)
+    {
+        if (IsDeferred())
+        {
+            LOG_ERROR_MESSAGE("There are outstanding commands in deferred device context #", GetContextId(),
+                              " when finishing the frame. This is an error and may cause unpredicted behaviour."
+                              " Close all deferred contexts and execute them before finishing the frame.");
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("There are outstanding commands in the immediate device context when finishing the frame."
+                              " This is an error and may cause unpredicted behaviour. Call Flush() to submit all commands"
+                              " for execution before finishing the frame.");
+        }
+    }
+
+    if (m_ActiveQueriesCounter > 0)
+    {
+        LOG_ERROR_MESSAGE("There are ", m_ActiveQueriesCounter,
+                          " active queries in the device context when finishing the frame. "
+                          "All queries must be ended before the frame is finished.");
+    }
+
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Finishing frame inside an active render pass.");
+    }
+
+    EndFrame();
+}
+
+void DeviceContextNullImpl::Flush()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
+
+    DEV_CHECK_ERR(m_ActiveQueriesCounter == 0,
+                  "Flushing device context that has ", m_ActiveQueriesCounter, " active queries.");
+
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
+                  "Flushing device context inside an active render pass.");
+
+#ifdef DILIGENT_DEVELOPMENT
+    DEV_CHECK_ERR(m_DvpDebugGroupCount == 0, "Not all debug groups have been ended");
+    m_DvpDebugGroupCount = 0;
+#endif
+
+    // All commands complete immediately
+    for (auto& val_fence : m_SignalFences)
+        val_fence.second->EnqueueSignal(val_fence.first);
+    m_SignalFences.clear();
+
+    m_NumCommands = 0;
+
+    m_BindInfo          = {};
+    m_pPipelineState    = nullptr;
+    m_pActiveRenderPass = nullptr;
+    m_pBoundFramebuffer = nullptr;
+}
+
+void DeviceContextNullImpl::UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint64                         Offset,
+                                         Uint64                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
+
+    auto* pBuffNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    DEV_CHECK_ERR(pBuffNull->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers must be updated via Map()");
+
+    TransitionOrVerifyBufferState(*pBuffNull, StateTransitionMode, RESOURCE_STATE_COPY_DEST, "Updating buffer (DeviceContextNullImpl::UpdateBuffer)");
+
+    if (auto* pDstData = pBuffNull->GetCPUAddress())
+        memcpy(pDstData + Offset, pData, StaticCast<size_t>(Size));
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint64                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint64                         DstOffset,
+                                       Uint64                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+
+    auto* pSrcBuffNull = ClassPtrCast<BufferNullImpl>(pSrcBuffer);
+    auto* pDstBuffNull = ClassPtrCast<BufferNullImpl>(pDstBuffer);
+
+    DEV_CHECK_ERR(pDstBuffNull->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers cannot be copy destinations");
+
+    TransitionOrVerifyBufferState(*pSrcBuffNull, SrcBufferTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using buffer as copy source (DeviceContextNullImpl::CopyBuffer)");
+    TransitionOrVerifyBufferState(*pDstBuffNull, DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, "Using buffer as copy destination (DeviceContextNullImpl::CopyBuffer)");
+
+    const auto* pSrcData = pSrcBuffNull->GetCPUAddress();
+    auto*       pDstData = pDstBuffNull->GetCPUAddress();
+    if (pSrcData != nullptr && pDstData != nullptr)
+        memmove(pDstData + DstOffset, pSrcData + SrcOffset, StaticCast<size_t>(Size));
+
+    ++m_NumCommands;
+}
+
+Uint8* DeviceContextNullImpl::GetScratchMemory(size_t Size)
+{
+    if (m_ScratchMemory.size() < Size)
+        m_ScratchMemory.resize(Size);
+    return m_ScratchMemory.data();
+}
+
+void DeviceContextNullImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
+{
+    TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+    auto* const pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    const auto& BuffDesc    = pBufferNull->GetDesc();
+
+    if (MapType == MAP_READ)
+    {
+        DEV_CHECK_ERR(BuffDesc.Usage == USAGE_STAGING || BuffDesc.Usage == USAGE_UNIFIED,
+                      "Buffer must be created as USAGE_STAGING or USAGE_UNIFIED to be mapped for reading");
+    }
+    else if (MapType == MAP_WRITE)
+    {
+        if (BuffDesc.Usage == USAGE_DYNAMIC)
+        {
+            DEV_CHECK_ERR((MapFlags & (MAP_FLAG_DISCARD | MAP_FLAG_NO_OVERWRITE)) != 0, "Failed to map buffer '",
+                          BuffDesc.Name, "': dynamic buffer must be mapped for writing with MAP_FLAG_DISCARD or MAP_FLAG_NO_OVERWRITE flag. Context Id: ", GetContextId());
+        }
+        else if (BuffDesc.Usage != USAGE_STAGING && BuffDesc.Usage != USAGE_UNIFIED)
+        {
+            LOG_ERROR("Only USAGE_DYNAMIC, USAGE_STAGING and USAGE_UNIFIED buffers can be mapped for writing");
+            pMappedData = nullptr;
+            return;
+        }
+    }
+    else if (MapType == MAP_READ_WRITE)
+    {
+        LOG_ERROR("MAP_READ_WRITE is not supported in Null backend");
+        pMappedData = nullptr;
+        return;
+    }
+    else
+    {
+        UNEXPECTED("Unknown map type");
+    }
+
+    pMappedData = pBufferNull->GetCPUAddress();
+    if (pMappedData == nullptr)
+        pMappedData = GetScratchMemory(StaticCast<size_t>(BuffDesc.Size));
+}
+
+void DeviceContextNullImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+    // Buffer memory is always coherent
+}
+
+void DeviceContextNullImpl::UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferStateTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE TextureStateTransitionMode)
+{
+    TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferStateTransitionMode, TextureStateTransitionMode);
+
+    auto* pTexNull = ClassPtrCast<TextureNullImpl>(pTexture);
+    DEV_CHECK_ERR(pTexNull->GetDesc().Usage == USAGE_DEFAULT, "Only USAGE_DEFAULT textures should be updated with UpdateData()");
+
+    if (SubresData.pSrcBuffer != nullptr)
+    {
+        TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(SubresData.pSrcBuffer), SrcBufferStateTransitionMode, RESOURCE_STATE_COPY_SOURCE,
+                                      "Using buffer as copy source (DeviceContextNullImpl::UpdateTexture)");
+    }
+    TransitionOrVerifyTextureState(*pTexNull, TextureStateTransitionMode, RESOURCE_STATE_COPY_DEST, "Updating texture (DeviceContextNullImpl::UpdateTexture)");
+
+    // Default textures are not backed by memory
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    TDeviceContextBase::CopyTexture(CopyAttribs);
+
+    auto* pSrcTexNull = ClassPtrCast<TextureNullImpl>(CopyAttribs.pSrcTexture);
+    auto* pDstTexNull = ClassPtrCast<TextureNullImpl>(CopyAttribs.pDstTexture);
+
+    // Unbind the textures from framebuffer because their states are transitioned.
+    UnbindTextureFromFramebuffer(pSrcTexNull, true);
+    UnbindTextureFromFramebuffer(pDstTexNull, true);
+
+    const auto& SrcTexDesc = pSrcTexNull->GetDesc();
+    const auto& DstTexDesc = pDstTexNull->GetDesc();
+
+    if (SrcTexDesc.Usage == USAGE_STAGING)
+    {
+        DEV_CHECK_ERR((SrcTexDesc.CPUAccessFlags & CPU_ACCESS_WRITE), "Attempting to copy from staging texture that was not created with CPU_ACCESS_WRITE flag");
+        DEV_CHECK_ERR(pSrcTexNull->GetState() == RESOURCE_STATE_COPY_SOURCE, "Source staging texture must permanently be in RESOURCE_STATE_COPY_SOURCE state");
+    }
+    else
+    {
+        TransitionOrVerifyTextureState(*pSrcTexNull, CopyAttribs.SrcTextureTransitionMode, RESOURCE_STATE_COPY_SOURCE,
+                                       "Using texture as copy source (DeviceContextNullImpl::CopyTexture)");
+    }
+
+    if (DstTexDesc.Usage == USAGE_STAGING)
+    {
+        DEV_CHECK_ERR((DstTexDesc.CPUAccessFlags & CPU_ACCESS_READ), "Attempting to copy to staging texture that was not created with CPU_ACCESS_READ flag");
+        DEV_CHECK_ERR(pDstTexNull->GetState() == RESOURCE_STATE_COPY_DEST, "Destination staging texture must permanently be in RESOURCE_STATE_COPY_DEST state");
+    }
+    else
+    {
+        TransitionOrVerifyTextureState(*pDstTexNull, CopyAttribs.DstTextureTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                       "Using texture as copy destination (DeviceContextNullImpl::CopyTexture)");
+    }
+
+    // Copy the data if both textures are backed by memory
+    const auto* pSrcData = pSrcTexNull->GetCPUAddress();
+    auto*       pDstData = pDstTexNull->GetCPUAddress();
+    if (pSrcData != nullptr && pDstData != nullptr)
+    {
+        Box SrcBox;
+        if (CopyAttribs.pSrcBox != nullptr)
+        {
+            SrcBox = *CopyAttribs.pSrcBox;
+        }
+        else
+        {
+            const auto MipLevelAttribs = GetMipLevelProperties(SrcTexDesc, CopyAttribs.SrcMipLevel);
+
+            SrcBox.MaxX = MipLevelAttribs.LogicalWidth;
+            SrcBox.MaxY = MipLevelAttribs.LogicalHeight;
+            SrcBox.MaxZ = MipLevelAttribs.Depth;
+        }
+
+        const auto& FmtAttribs     = GetTextureFormatAttribs(SrcTexDesc.Format);
+        const auto  SrcMipAttribs  = GetMipLevelProperties(SrcTexDesc, CopyAttribs.SrcMipLevel);
+        const auto  DstMipAttribs  = GetMipLevelProperties(DstTexDesc, CopyAttribs.DstMipLevel);
+        const auto  BlockAlignedW  = AlignUp(SrcBox.Width(), Uint32{FmtAttribs.BlockWidth});
+        const auto  BlockAlignedH  = AlignUp(std::max(SrcBox.Height(), 1u), Uint32{FmtAttribs.BlockHeight});
+        const auto  RowSize        = BlockAlignedW / FmtAttribs.BlockWidth * FmtAttribs.GetElementSize();
+        const auto  NumRows        = BlockAlignedH / FmtAttribs.BlockHeight;
+        const auto  SrcStartOffset = GetStagingTextureLocationOffset(SrcTexDesc, CopyAttribs.SrcSlice, CopyAttribs.SrcMipLevel,
+                                                                    TextureNullImpl::SubresourceAlignment, SrcBox.MinX, SrcBox.MinY, SrcBox.MinZ);
+        const auto  DstStartOffset = GetStagingTextureLocationOffset(DstTexDesc, CopyAttribs.DstSlice, CopyAttribs.DstMipLevel,
+                                                                    TextureNullImpl::SubresourceAlignment, CopyAttribs.DstX, CopyAttribs.DstY, CopyAttribs.DstZ);
+
+        for (Uint32 z = 0; z < std::max(SrcBox.Depth(), 1u); ++z)
+        {
+            for (Uint32 row = 0; row < NumRows; ++row)
+            {
+                memcpy(pDstData + DstStartOffset + z * DstMipAttribs.DepthSliceSize + row * DstMipAttribs.RowSize,
+                       pSrcData + SrcStartOffset + z * SrcMipAttribs.DepthSliceSize + row * SrcMipAttribs.RowSize,
+                       StaticCast<size_t>(RowSize));
+            }
+        }
+    }
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData)
+{
+    TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    auto&       TextureNull = *ClassPtrCast<TextureNullImpl>(pTexture);
+    const auto& TexDesc     = TextureNull.GetDesc();
+
+    if (TexDesc.Usage == USAGE_DYNAMIC)
+    {
+        if (MapType != MAP_WRITE)
+        {
+            LOG_ERROR("Dynamic textures can be mapped for writing only");
+            MappedData = MappedTextureSubresource{};
+            return;
+        }
+    }
+    else if (TexDesc.Usage == USAGE_STAGING)
+    {
+        if (MapType == MAP_READ)
+            DEV_CHECK_ERR((TexDesc.CPUAccessFlags & CPU_ACCESS_READ), "Texture '", TexDesc.Name, "' was not created with CPU_ACCESS_READ flag and can't be mapped for reading");
+        else if (MapType == MAP_WRITE)
+            DEV_CHECK_ERR((TexDesc.CPUAccessFlags & CPU_ACCESS_WRITE), "Texture '", TexDesc.Name, "' was not created with CPU_ACCESS_WRITE flag and can't be mapped for writing");
+    }
+    else
+    {
+        UNSUPPORTED(GetUsageString(TexDesc.Usage), " textures cannot be mapped");
+        MappedData = MappedTextureSubresource{};
+        return;
+    }
+
+    Box FullExtentBox;
+    if (pMapRegion == nullptr)
+    {
+        auto MipLevelAttribs = GetMipLevelProperties(TexDesc, MipLevel);
+        FullExtentBox.MaxX   = MipLevelAttribs.LogicalWidth;
+        FullExtentBox.MaxY   = MipLevelAttribs.LogicalHeight;
+        FullExtentBox.MaxZ   = MipLevelAttribs.Depth;
+        pMapRegion           = &FullExtentBox;
+    }
+
+    const auto MipLevelAttribs = GetMipLevelProperties(TexDesc, MipLevel);
+
+    MappedData.Stride      = MipLevelAttribs.RowSize;
+    MappedData.DepthStride = MipLevelAttribs.DepthSliceSize;
+    if (auto* pTexData = TextureNull.GetCPUAddress())
+    {
+        const auto MapStartOffset = GetStagingTextureLocationOffset(TexDesc, ArraySlice, MipLevel, TextureNullImpl::SubresourceAlignment,
+                                                                    pMapRegion->MinX, pMapRegion->MinY, pMapRegion->MinZ);
+        MappedData.pData          = pTexData + MapStartOffset;
+    }
+    else
+    {
+        MappedData.pData = GetScratchMemory(StaticCast<size_t>(MipLevelAttribs.MipSize));
+    }
+}
+
+void DeviceContextNullImpl::UnmapTextureSubresource(ITexture* pTexture,
+                                                    Uint32    MipLevel,
+                                                    Uint32    ArraySlice)
+{
+    TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+    // Texture memory is always coherent
+}
+
+void DeviceContextNullImpl::GenerateMips(ITextureView* pTexView)
+{
+    TDeviceContextBase::GenerateMips(pTexView);
+
+    auto* pTexNull = ClassPtrCast<TextureViewNullImpl>(pTexView)->GetTexture<TextureNullImpl>();
+    TransitionOrVerifyTextureState(*pTexNull, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_SHADER_RESOURCE,
+                                   "Generating mipmaps (DeviceContextNullImpl::GenerateMips)");
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+
+    auto* pSrcTexNull = ClassPtrCast<TextureNullImpl>(pSrcTexture);
+    auto* pDstTexNull = ClassPtrCast<TextureNullImpl>(pDstTexture);
+
+    TransitionOrVerifyTextureState(*pSrcTexNull, ResolveAttribs.SrcTextureTransitionMode, RESOURCE_STATE_RESOLVE_SOURCE,
+                                   "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+    TransitionOrVerifyTextureState(*pDstTexNull, ResolveAttribs.DstTextureTransitionMode, RESOURCE_STATE_RESOLVE_DEST,
+                                   "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::FinishCommandList(ICommandList** ppCommandList)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+    CommandListNullImpl* pCmdListNull{NEW_RC_OBJ(m_CmdListAllocator, "CommandListNullImpl instance", CommandListNullImpl)(m_pDevice, this)};
+    pCmdListNull->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    m_NumCommands = 0;
+
+    InvalidateState();
+
+    TDeviceContextBase::FinishCommandList();
+}
+
+void DeviceContextNullImpl::ExecuteCommandLists(Uint32               NumCommandLists,
+                                                ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+#ifdef DILIGENT_DEVELOPMENT
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+        DEV_CHECK_ERR(ppCommandLists[i] != nullptr, "Command list ", i, " must not be null");
+#endif
+
+    Flush();
+
+    InvalidateState();
+}
+
+void DeviceContextNullImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
+    m_SignalFences.emplace_back(Value, ClassPtrCast<FenceNullImpl>(pFence));
+}
+
+void DeviceContextNullImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::DeviceWaitForFence(pFence, Value, 0);
+    ClassPtrCast<FenceNullImpl>(pFence)->DvpDeviceWait(Value);
+}
+
+void DeviceContextNullImpl::WaitForIdle()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
+    Flush();
+}
+
+void DeviceContextNullImpl::BeginQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::BeginQuery(pQuery, 0);
+
+    const auto QueryType = pQuery->GetDesc().Type;
+    if (QueryType != QUERY_TYPE_TIMESTAMP && QueryType != QUERY_TYPE_DURATION)
+        ++m_ActiveQueriesCounter;
+}
+
+void DeviceContextNullImpl::EndQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::EndQuery(pQuery, 0);
+
+    const auto QueryType = pQuery->GetDesc().Type;
+    if (QueryType != QUERY_TYPE_TIMESTAMP && QueryType != QUERY_TYPE_DURATION)
+    {
+        VERIFY(m_ActiveQueriesCounter > 0, "Active query counter is 0 which means there was a mismatch between BeginQuery() / EndQuery() calls");
+        --m_ActiveQueriesCounter;
+    }
+}
+
+void DeviceContextNullImpl::TransitionTextureState(TextureNullImpl& Texture, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateTextureState)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (ResolveOldResourceState(Texture, OldState, "texture"))
+        UpdateResourceState(Texture, OldState, NewState, UpdateTextureState);
+}
+
+void DeviceContextNullImpl::TransitionBufferState(BufferNullImpl& Buffer, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateBufferState)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (ResolveOldResourceState(Buffer, OldState, "buffer"))
+        UpdateResourceState(Buffer, OldState, NewState, UpdateBufferState);
+}
+
+void DeviceContextNullImpl::TransitionBLASState(BottomLevelASNullImpl& BLAS, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateInternalState)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (ResolveOldResourceState(BLAS, OldState, "BLAS"))
+        UpdateResourceState(BLAS, OldState, NewState, UpdateInternalState);
+}
+
+void DeviceContextNullImpl::TransitionTLASState(TopLevelASNullImpl& TLAS, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateInternalState)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (ResolveOldResourceState(TLAS, OldState, "TLAS"))
+        UpdateResourceState(TLAS, OldState, NewState, UpdateInternalState);
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyTextureState(TextureNullImpl&               Texture,
+                                                           RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                           RESOURCE_STATE                 RequiredState,
+                                                           const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        if (Texture.IsInKnownState())
+            TransitionTextureState(Texture, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyTextureState(Texture, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyBufferState(BufferNullImpl&                Buffer,
+                                                          RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                          RESOURCE_STATE                 RequiredState,
+                                                          const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        if (Buffer.IsInKnownState())
+            TransitionBufferState(Buffer, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyBufferState(Buffer, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyBLASState(BottomLevelASNullImpl&         BLAS,
+                                                        RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                        RESOURCE_STATE                 RequiredState,
+                                                        const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        if (BLAS.IsInKnownState())
+            TransitionBLASState(BLAS, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyBLASState(BLAS, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyTLASState(TopLevelASNullImpl&            TLAS,
+                                                        RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                        RESOURCE_STATE                 RequiredState,
+                                                        const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        if (TLAS.IsInKnownState())
+            TransitionTLASState(TLAS, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyTLASState(TLAS, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        const auto& Barrier = pResourceBarriers[i];
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyStateTransitionDesc(Barrier);
+#endif
+        if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
+        {
+            // Skip begin-split barriers
+            VERIFY((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0, "Resource state can't be updated in begin-split barrier");
+            continue;
+        }
+        VERIFY(Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE || Barrier.TransitionType == STATE_TRANSITION_TYPE_END, "Unexpected barrier type");
+
+        const bool UpdateState = (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0;
+        if (RefCntAutoPtr<TextureNullImpl> pTexture{Barrier.pResource, IID_Texture})
+        {
+            TransitionTextureState(*pTexture, Barrier.OldState, Barrier.NewState, UpdateState);
+        }
+        else if (RefCntAutoPtr<BufferNullImpl> pBuffer{Barrier.pResource, IID_Buffer})
+        {
+            TransitionBufferState(*pBuffer, Barrier.OldState, Barrier.NewState, UpdateState);
+        }
+        else if (RefCntAutoPtr<BottomLevelASNullImpl> pBottomLevelAS{Barrier.pResource, IID_BottomLevelAS})
+        {
+            TransitionBLASState(*pBottomLevelAS, Barrier.OldState, Barrier.NewState, UpdateState);
+        }
+        else if (RefCntAutoPtr<TopLevelASNullImpl> pTopLevelAS{Barrier.pResource, IID_TopLevelAS})
+        {
+            TransitionTLASState(*pTopLevelAS, Barrier.OldState, Barrier.NewState, UpdateState);
+        }
+        else
+        {
+            UNEXPECTED("unsupported resource type");
+        }
+    }
+}
+
+void DeviceContextNullImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    TDeviceContextBase::BuildBLAS(Attribs, 0);
+
+    auto* pBLASNull    = ClassPtrCast<BottomLevelASNullImpl>(Attribs.pBLAS);
+    auto* pScratchNull = ClassPtrCast<BufferNullImpl>(Attribs.pScratchBuffer);
+
+    const char* OpName = "Build BottomLevelAS (DeviceContextNullImpl::BuildBLAS)";
+    TransitionOrVerifyBLASState(*pBLASNull, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
+    TransitionOrVerifyBufferState(*pScratchNull, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
+
+    for (Uint32 i = 0; i < Attribs.TriangleDataCount; ++i)
+    {
+        const auto& SrcTris = Attribs.pTriangleData[i];
+        TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(SrcTris.pVertexBuffer), Attribs.GeometryTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+        if (SrcTris.pIndexBuffer != nullptr)
+            TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(SrcTris.pIndexBuffer), Attribs.GeometryTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+        if (SrcTris.pTransformBuffer != nullptr)
+            TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(SrcTris.pTransformBuffer), Attribs.GeometryTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+    }
+
+    for (Uint32 i = 0; i < Attribs.BoxDataCount; ++i)
+    {
+        const auto& SrcBoxes = Attribs.pBoxData[i];
+        TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(SrcBoxes.pBoxBuffer), Attribs.GeometryTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+    }
+
+    pBLASNull->SetActualGeometryCount(Attribs.TriangleDataCount + Attribs.BoxDataCount);
+    ++m_NumCommands;
+
+#ifdef DILIGENT_DEVELOPMENT
+    pBLASNull->DvpUpdateVersion();
+#endif
+}
+
+void DeviceContextNullImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    TDeviceContextBase::BuildTLAS(Attribs, 0);
+
+    auto* pTLASNull      = ClassPtrCast<TopLevelASNullImpl>(Attribs.pTLAS);
+    auto* pScratchNull   = ClassPtrCast<BufferNullImpl>(Attribs.pScratchBuffer);
+    auto* pInstancesNull = ClassPtrCast<BufferNullImpl>(Attribs.pInstanceBuffer);
+
+    const char* OpName = "Build TopLevelAS (DeviceContextNullImpl::BuildTLAS)";
+    TransitionOrVerifyTLASState(*pTLASNull, Attribs.TLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
+    TransitionOrVerifyBufferState(*pScratchNull, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
+
+    if (Attribs.Update)
+    {
+        if (!pTLASNull->UpdateInstances(Attribs))
+            return;
+    }
+    else
+    {
+        if (!pTLASNull->SetInstanceData(Attribs))
+            return;
+    }
+
+    if (Attribs.BLASTransitionMode != RESOURCE_STATE_TRANSITION_MODE_NONE)
+    {
+        pTLASNull->ProcessBLASes([&](BottomLevelASNullImpl& BLAS) {
+            TransitionOrVerifyBLASState(BLAS, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+        });
+    }
+
+    TransitionOrVerifyBufferState(*pInstancesNull, Attribs.InstanceBufferTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    TDeviceContextBase::CopyBLAS(Attribs, 0);
+
+    auto* pSrcNull = ClassPtrCast<BottomLevelASNullImpl>(Attribs.pSrc);
+    auto* pDstNull = ClassPtrCast<BottomLevelASNullImpl>(Attribs.pDst);
+
+    // Geometries must be copied because they are required for SBT to map geometry name to hit group.
+    pDstNull->CopyGeometryDescription(*pSrcNull);
+    pDstNull->SetActualGeometryCount(pSrcNull->GetActualGeometryCount());
+
+    const char* OpName = "Copy BottomLevelAS (DeviceContextNullImpl::CopyBLAS)";
+    TransitionOrVerifyBLASState(*pSrcNull, Attribs.SrcTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+    TransitionOrVerifyBLASState(*pDstNull, Attribs.DstTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
+
+    ++m_NumCommands;
+
+#ifdef DILIGENT_DEVELOPMENT
+    pDstNull->DvpUpdateVersion();
+#endif
+}
+
+void DeviceContextNullImpl::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    TDeviceContextBase::CopyTLAS(Attribs, 0);
+
+    auto* pSrcNull = ClassPtrCast<TopLevelASNullImpl>(Attribs.pSrc);
+    auto* pDstNull = ClassPtrCast<TopLevelASNullImpl>(Attribs.pDst);
+
+    // Instances must be copied because they are required for SBT to map instance name to hit group.
+    pDstNull->CopyInstancceData(*pSrcNull);
+
+    const char* OpName = "Copy TopLevelAS (DeviceContextNullImpl::CopyTLAS)";
+    TransitionOrVerifyTLASState(*pSrcNull, Attribs.SrcTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+    TransitionOrVerifyTLASState(*pDstNull, Attribs.DstTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    TDeviceContextBase::WriteBLASCompactedSize(Attribs, 0);
+
+    auto* pBLASNull     = ClassPtrCast<BottomLevelASNullImpl>(Attribs.pBLAS);
+    auto* pDestBuffNull = ClassPtrCast<BufferNullImpl>(Attribs.pDestBuffer);
+
+    const char* OpName = "Write AS compacted size (DeviceContextNullImpl::WriteBLASCompactedSize)";
+    TransitionOrVerifyBLASState(*pBLASNull, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+    TransitionOrVerifyBufferState(*pDestBuffNull, Attribs.BufferTransitionMode, RESOURCE_STATE_COPY_DEST, OpName);
+
+    // Acceleration structures have no actual storage, so report the build scratch size as the compacted size.
+    if (auto* pDstData = pDestBuffNull->GetCPUAddress())
+    {
+        const Uint64 CompactedSize = pBLASNull->GetScratchBufferSizes().Build;
+        memcpy(pDstData + Attribs.DestBufferOffset, &CompactedSize, sizeof(CompactedSize));
+    }
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    TDeviceContextBase::WriteTLASCompactedSize(Attribs, 0);
+
+    auto* pTLASNull     = ClassPtrCast<TopLevelASNullImpl>(Attribs.pTLAS);
+    auto* pDestBuffNull = ClassPtrCast<BufferNullImpl>(Attribs.pDestBuffer);
+
+    const char* OpName = "Write AS compacted size (DeviceContextNullImpl::WriteTLASCompactedSize)";
+    TransitionOrVerifyTLASState(*pTLASNull, Attribs.TLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+    TransitionOrVerifyBufferState(*pDestBuffNull, Attribs.BufferTransitionMode, RESOURCE_STATE_COPY_DEST, OpName);
+
+    if (auto* pDstData = pDestBuffNull->GetCPUAddress())
+    {
+        const Uint64 CompactedSize = pTLASNull->GetScratchBufferSizes().Build;
+        memcpy(pDstData + Attribs.DestBufferOffset, &CompactedSize, sizeof(CompactedSize));
+    }
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    TDeviceContextBase::TraceRays(Attribs, 0);
+
+    PrepareForRayTracing();
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::TraceRaysIndirect(Attribs, 0);
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Trace rays indirect (DeviceContextNullImpl::TraceRaysIndirect)");
+
+    PrepareForRayTracing();
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs)
+{
+    TDeviceContextBase::UpdateSBT(pSBT, pUpdateIndirectBufferAttribs, 0);
+
+    auto*           pSBTNull       = ClassPtrCast<ShaderBindingTableNullImpl>(pSBT);
+    BufferNullImpl* pSBTBufferNull = nullptr;
+
+    ShaderBindingTableNullImpl::BindingTable RayGenShaderRecord  = {};
+    ShaderBindingTableNullImpl::BindingTable MissShaderTable     = {};
+    ShaderBindingTableNullImpl::BindingTable HitGroupTable       = {};
+    ShaderBindingTableNullImpl::BindingTable CallableShaderTable = {};
+
+    pSBTNull->GetData(pSBTBufferNull, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable);
+
+    const char* OpName = "Update shader binding table (DeviceContextNullImpl::UpdateSBT)";
+
+    if (RayGenShaderRecord.pData || MissShaderTable.pData || HitGroupTable.pData || CallableShaderTable.pData)
+    {
+        TransitionOrVerifyBufferState(*pSBTBufferNull, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_COPY_DEST, OpName);
+
+        // Buffer ranges do not intersect, so we don't need to add barriers between them
+        if (RayGenShaderRecord.pData)
+            UpdateBuffer(pSBTBufferNull, RayGenShaderRecord.Offset, RayGenShaderRecord.Size, RayGenShaderRecord.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        if (MissShaderTable.pData)
+            UpdateBuffer(pSBTBufferNull, MissShaderTable.Offset, MissShaderTable.Size, MissShaderTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        if (HitGroupTable.pData)
+            UpdateBuffer(pSBTBufferNull, HitGroupTable.Offset, HitGroupTable.Size, HitGroupTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        if (CallableShaderTable.pData)
+            UpdateBuffer(pSBTBufferNull, CallableShaderTable.Offset, CallableShaderTable.Size, CallableShaderTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        TransitionOrVerifyBufferState(*pSBTBufferNull, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_RAY_TRACING, OpName);
+    }
+    else
+    {
+        // Ray tracing command can be used in parallel with the same SBT, so internal buffer state must be RESOURCE_STATE_RAY_TRACING to allow it.
+        VERIFY(pSBTBufferNull->CheckState(RESOURCE_STATE_RAY_TRACING), "SBT buffer must always be in RESOURCE_STATE_RAY_TRACING state");
+    }
+}
+
+void DeviceContextNullImpl::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
+}
+
+void DeviceContextNullImpl::EndDebugGroup()
+{
+    TDeviceContextBase::EndDebugGroup(0);
+}
+
+void DeviceContextNullImpl::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
+}
+
+void DeviceContextNullImpl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COMBINER PrimitiveCombiner, SHADING_RATE_COMBINER TextureCombiner)
+{
+    TDeviceContextBase::SetShadingRate(BaseRate, PrimitiveCombiner, TextureCombiner, 0);
+}
+
+} // namespace Diligent
@@ -0,0 +1,379 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+/// \file
+/// Routines that initialize the null engine implementation
+
+#include "pch.h"
+
+#include "EngineFactoryNull.h"
+
+#include <cstring>
+#include <algorithm>
+
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "SwapChainNullImpl.hpp"
+#include "EngineFactoryBase.hpp"
+#include "EngineMemory.h"
+
+#if PLATFORM_ANDROID
+#    include "FileSystem.hpp"
+#endif
+
+namespace Diligent
+{
+
+/// Engine factory for Null implementation
+class EngineFactoryNullImpl : public EngineFactoryBase<IEngineFactoryNull>
+{
+public:
+    static EngineFactoryNullImpl* GetInstance()
+    {
+        static EngineFactoryNullImpl TheFactory;
+        return &TheFactory;
+    }
+
+    using TBase = EngineFactoryBase<IEngineFactoryNull>;
+    EngineFactoryNullImpl() :
+        TBase{IID_EngineFactoryNull}
+    {}
+
+    virtual void DILIGENT_CALL_TYPE CreateDeviceAndContextsNull(const EngineNullCreateInfo& EngineCI,
+                                                                IRenderDevice**             ppDevice,
+                                                                IDeviceContext**            ppContexts) override final;
+
+    virtual void DILIGENT_CALL_TYPE CreateSwapChainNull(IRenderDevice*       pDevice,
+                                                        IDeviceContext*      pImmediateContext,
+                                                        const SwapChainDesc& SCDesc,
+                                                        ISwapChain**         ppSwapChain) override final;
+
+    virtual void DILIGENT_CALL_TYPE EnumerateAdapters(Version              MinVersion,
+                                                      Uint32&              NumAdapters,
+                                                      GraphicsAdapterInfo* Adapters) const override final;
+
+#if PLATFORM_ANDROID
+    virtual void InitAndroidFileSystem(struct ANativeActivity* NativeActivity,
+                                       const char*             NativeActivityClassName,
+                                       struct AAssetManager*   AssetManager) const override final;
+#endif
+};
+
+static void SetNullGraphicsAdapterInfo(GraphicsAdapterInfo& AdapterInfo)
+{
+    AdapterInfo = GraphicsAdapterInfo{};
+
+    static constexpr char AdapterDescription[] = "Null adapter";
+    static_assert(sizeof(AdapterDescription) <= sizeof(AdapterInfo.Description), "Adapter description is too long");
+    memcpy(AdapterInfo.Description, AdapterDescription, sizeof(AdapterDescription));
+
+    AdapterInfo.Type   = ADAPTER_TYPE_SOFTWARE;
+    AdapterInfo.Vendor = ADAPTER_VENDOR_UNKNOWN;
+
+    // Null backend supports everything that does not require shader reflection or
+    // backend-specific hardware properties.
+    AdapterInfo.Features                       = DeviceFeatures{DEVICE_FEATURE_STATE_ENABLED};
+    AdapterInfo.Features.ShaderResourceQueries = DEVICE_FEATURE_STATE_DISABLED;
+    AdapterInfo.Features.TileShaders           = DEVICE_FEATURE_STATE_DISABLED;
+    AdapterInfo.Features.VariableRateShading   = DEVICE_FEATURE_STATE_DISABLED;
+
+    {
+        auto& TexProps{AdapterInfo.Texture};
+        TexProps.MaxTexture1DDimension     = 16384;
+        TexProps.MaxTexture1DArraySlices   = 2048;
+        TexProps.MaxTexture2DDimension     = 16384;
+        TexProps.MaxTexture2DArraySlices   = 2048;
+        TexProps.MaxTexture3DDimension     = 2048;
+        TexProps.MaxTextureCubeDimension   = 16384;
+        TexProps.Texture2DMSSupported      = True;
+        TexProps.Texture2DMSArraySupported = True;
+        TexProps.TextureViewSupported      = True;
+        TexProps.CubemapArraysSupported    = True;
+    }
+
+    {
+        auto& SamProps{AdapterInfo.Sampler};
+        SamProps.BorderSamplingModeSupported   = True;
+        SamProps.AnisotropicFilteringSupported = True;
+        SamProps.LODBiasSupported              = True;
+    }
+
+    {
+        auto& BufferProps{AdapterInfo.Buffer};
+        BufferProps.ConstantBufferOffsetAlignment   = 256;
+        BufferProps.StructuredBufferOffsetAlignment = 16;
+    }
+
+    {
+        auto& RayTracingProps{AdapterInfo.RayTracing};
+        RayTracingProps.MaxRecursionDepth        = 31;
+        RayTracingProps.ShaderGroupHandleSize    = 32;
+        RayTracingProps.MaxShaderRecordStride    = 4096;
+        RayTracingProps.ShaderGroupBaseAlignment = 64;
+        RayTracingProps.MaxRayGenThreads         = 1u << 30;
+        RayTracingProps.MaxInstancesPerTLAS      = 1u << 24;
+        RayTracingProps.MaxPrimitivesPerBLAS     = 1u << 29;
+        RayTracingProps.MaxGeometriesPerBLAS     = 1u << 24;
+        RayTracingProps.VertexBufferAlignmnent   = 1;
+        RayTracingProps.IndexBufferAlignment     = 1;
+        RayTracingProps.TransformBufferAlignment = 16;
+        RayTracingProps.BoxBufferAlignment       = 8;
+        RayTracingProps.ScratchBufferAlignment   = 256;
+        RayTracingProps.InstanceBufferAlignment  = 16;
+        RayTracingProps.CapFlags =
+            RAY_TRACING_CAP_FLAG_STANDALONE_SHADERS |
+            RAY_TRACING_CAP_FLAG_INLINE_RAY_TRACING |
+            RAY_TRACING_CAP_FLAG_INDIRECT_RAY_TRACING;
+    }
+
+    {
+        auto& WaveOpProps{AdapterInfo.WaveOp};
+        WaveOpProps.MinSize         = 32;
+        WaveOpProps.MaxSize         = 32;
+        WaveOpProps.SupportedStages = SHADER_TYPE_ALL_GRAPHICS | SHADER_TYPE_COMPUTE;
+        WaveOpProps.Features        = WAVE_FEATURE_BASIC | WAVE_FEATURE_VOTE | WAVE_FEATURE_ARITHMETIC |
+            WAVE_FEATURE_BALLOUT | WAVE_FEATURE_SHUFFLE | WAVE_FEATURE_SHUFFLE_RELATIVE | WAVE_FEATURE_CLUSTERED | WAVE_FEATURE_QUAD;
+    }
+
+    {
+        auto& MeshProps{AdapterInfo.MeshShader};
+        MeshProps.MaxTaskCount = 65535;
+    }
+
+    {
+        auto& CompProps{AdapterInfo.ComputeShader};
+        CompProps.SharedMemorySize          = 32768;
+        CompProps.MaxThreadGroupInvocations = 1024;
+        CompProps.MaxThreadGroupSizeX       = 1024;
+        CompProps.MaxThreadGroupSizeY       = 1024;
+        CompProps.MaxThreadGroupSizeZ       = 64;
+        CompProps.MaxThreadGroupCountX      = 65535;
+        CompProps.MaxThreadGroupCountY      = 65535;
+        CompProps.MaxThreadGroupCountZ      = 65535;
+    }
+
+    {
+        auto& DrawCommandProps{AdapterInfo.DrawCommand};
+        DrawCommandProps.CapFlags =
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_FIRST_INSTANCE |
+            DRAW_COMMAND_CAP_FLAG_NATIVE_MULTI_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER;
+        DrawCommandProps.MaxIndexValue        = ~0u;
+        DrawCommandProps.MaxDrawIndirectCount = ~0u;
+    }
+
+    AdapterInfo.NumQueues = 1;
+
+    AdapterInfo.Queues[0].QueueType                 = COMMAND_QUEUE_TYPE_GRAPHICS;
+    AdapterInfo.Queues[0].MaxDeviceContexts         = 1;
+    AdapterInfo.Queues[0].TextureCopyGranularity[0] = 1;
+    AdapterInfo.Queues[0].TextureCopyGranularity[1] = 1;
+    AdapterInfo.Queues[0].TextureCopyGranularity[2] = 1;
+}
+
+void EngineFactoryNullImpl::EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const
+{
+    if (Adapters == nullptr)
+    {
+        NumAdapters = 1;
+        return;
+    }
+
+    NumAdapters = std::min(1u, NumAdapters);
+    if (NumAdapters > 0)
+    {
+        SetNullGraphicsAdapterInfo(*Adapters);
+    }
+}
+
+/// Creates render device and device contexts for the null engine implementation
+
+/// \param [in]  EngineCI   - Engine creation attributes.
+/// \param [out] ppDevice   - Address of the memory location where pointer to
+///                           the created device will be written.
+/// \param [out] ppContexts - Address of the memory location where pointers to
+///                           the contexts will be written. Immediate context goes at
+///                           position 0. If EngineCI.NumDeferredContexts > 0,
+///                           pointers to the deferred contexts are written afterwards.
+void EngineFactoryNullImpl::CreateDeviceAndContextsNull(const EngineNullCreateInfo& EngineCI,
+                                                        IRenderDevice**             ppDevice,
+                                                        IDeviceContext**            ppContexts)
+{
+    if (EngineCI.DebugMessageCallback != nullptr)
+        SetDebugMessageCallback(EngineCI.DebugMessageCallback);
+
+    if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
+    {
+        LOG_ERROR_MESSAGE("Diligent Engine runtime (", DILIGENT_API_VERSION, ") is not compatible with the client API version (", EngineCI.EngineAPIVersion, ")");
+        return;
+    }
+
+    VERIFY(ppDevice && ppContexts, "Null pointer provided");
+    if (!ppDevice || !ppContexts)
+        return;
+
+    const auto NumImmediateContexts = std::max(1u, EngineCI.NumImmediateContexts);
+
+    *ppDevice = nullptr;
+    memset(ppContexts, 0, sizeof(*ppContexts) * (NumImmediateContexts + EngineCI.NumDeferredContexts));
+
+    if (NumImmediateContexts > 1)
+    {
+        LOG_ERROR_MESSAGE("Null backend does not support multiple immediate contexts");
+        return;
+    }
+
+    try
+    {
+        GraphicsAdapterInfo AdapterInfo;
+        SetNullGraphicsAdapterInfo(AdapterInfo);
+        VerifyEngineCreateInfo(EngineCI, AdapterInfo);
+
+        SetRawAllocator(EngineCI.pRawMemAllocator);
+        auto& RawMemAllocator = GetRawAllocator();
+
+        RenderDeviceNullImpl* pRenderDeviceNull{
+            NEW_RC_OBJ(RawMemAllocator, "RenderDeviceNullImpl instance", RenderDeviceNullImpl)(
+                RawMemAllocator, this, EngineCI, AdapterInfo) //
+        };
+        pRenderDeviceNull->QueryInterface(IID_RenderDevice, reinterpret_cast<IObject**>(ppDevice));
+
+        RefCntAutoPtr<DeviceContextNullImpl> pDeviceContextNull{
+            NEW_RC_OBJ(RawMemAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                pRenderDeviceNull,
+                DeviceContextDesc{
+                    EngineCI.pImmediateContextInfo ? EngineCI.pImmediateContextInfo[0].Name : nullptr,
+                    COMMAND_QUEUE_TYPE_GRAPHICS,
+                    False, // IsDeferred
+                    0,     // Context id
+                    0      // Queue id
+                }          //
+                )};
+        // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+        // keep a weak reference to the context
+        pDeviceContextNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts));
+        pRenderDeviceNull->SetImmediateContext(0, pDeviceContextNull);
+
+        for (Uint32 DeferredCtx = 0; DeferredCtx < EngineCI.NumDeferredContexts; ++DeferredCtx)
+        {
+            RefCntAutoPtr<DeviceContextNullImpl> pDeferredCtxNull{
+                NEW_RC_OBJ(RawMemAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                    pRenderDeviceNull,
+                    DeviceContextDesc{
+                        nullptr,
+                        COMMAND_QUEUE_TYPE_UNKNOWN,
+                        True,           // IsDeferred
+                        1 + DeferredCtx // Context id
+                    }                   //
+                    )};
+            // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+            // keep a weak reference to the context
+            pDeferredCtxNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + 1 + DeferredCtx));
+            pRenderDeviceNull->SetDeferredContext(DeferredCtx, pDeferredCtxNull);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppDevice)
+        {
+            (*ppDevice)->Release();
+            *ppDevice = nullptr;
+        }
+        for (Uint32 ctx = 0; ctx < NumImmediateContexts + EngineCI.NumDeferredContexts; ++ctx)
+        {
+            if (ppContexts[ctx] != nullptr)
+            {
+                ppContexts[ctx]->Release();
+                ppContexts[ctx] = nullptr;
+            }
+        }
+
+        LOG_ERROR("Failed to initialize Null device and contexts");
+    }
+}
+
+void EngineFactoryNullImpl::CreateSwapChainNull(IRenderDevice*       pDevice,
+                                                IDeviceContext*      pImmediateContext,
+                                                const SwapChainDesc& SCDesc,
+                                                ISwapChain**         ppSwapChain)
+{
+    VERIFY(ppSwapChain, "Null pointer provided");
+    if (!ppSwapChain)
+        return;
+
+    *ppSwapChain = nullptr;
+
+    try
+    {
+        auto* pDeviceNull        = ClassPtrCast<RenderDeviceNullImpl>(pDevice);
+        auto* pDeviceContextNull = ClassPtrCast<DeviceContextNullImpl>(pImmediateContext);
+        auto& RawMemAllocator    = GetRawAllocator();
+
+        auto* pSwapChainNull = NEW_RC_OBJ(RawMemAllocator, "SwapChainNullImpl instance", SwapChainNullImpl)(SCDesc, pDeviceNull, pDeviceContextNull);
+        pSwapChainNull->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppSwapChain)
+        {
+            (*ppSwapChain)->Release();
+            *ppSwapChain = nullptr;
+        }
+
+        LOG_ERROR("Failed to create the swap chain");
+    }
+}
+
+#if PLATFORM_ANDROID
+void EngineFactoryNullImpl::InitAndroidFileSystem(struct ANativeActivity* NativeActivity,
+                                                  const char*             NativeActivityClassName,
+                                                  struct AAssetManager*   AssetManager) const
+{
+    AndroidFileSystem::Init(NativeActivity, NativeActivityClassName, AssetManager);
+}
+#endif
+
+API_QUALIFIER
+IEngineFactoryNull* GetEngineFactoryNull()
+{
+    return EngineFactoryNullImpl::GetInstance();
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    API_QUALIFIER
+    Diligent::IEngineFactoryNull* Diligent_GetEngineFactoryNull()
+    {
+        return Diligent::GetEngineFactoryNull();
+    }
+}
@@ -0,0 +1,227 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "PipelineResourceSignatureNullImpl.hpp"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                                                     RenderDeviceNullImpl*                pDevice,
+                                                                     const PipelineResourceSignatureDesc& Desc,
+                                                                     SHADER_TYPE                          ShaderStages,
+                                                                     bool                                 bIsDeviceInternal) :
+    TPipelineResourceSignatureBase{pRefCounters, pDevice, Desc, ShaderStages, bIsDeviceInternal}
+{
+    try
+    {
+        Initialize(
+            GetRawAllocator(), Desc, m_ImmutableSamplers,
+            [this]() //
+            {
+                CreateLayout();
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_SRBCacheSize);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+void PipelineResourceSignatureNullImpl::CreateLayout()
+{
+    // Initialize static resource cache first
+    if (GetNumStaticResStages() > 0)
+    {
+        Uint32 StaticResourceCount = 0; // The total number of static resources in all stages
+                                        // accounting for array sizes.
+        for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+        {
+            const auto& ResDesc = m_Desc.Resources[i];
+            if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+                StaticResourceCount += ResDesc.ArraySize;
+        }
+        m_pStaticResCache->Initialize(GetRawAllocator(), StaticResourceCount);
+    }
+
+    // Immutable samplers are created up front, whether or not they are referenced by a resource.
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+        GetDevice()->CreateSampler(m_Desc.ImmutableSamplers[i].Desc, &m_ImmutableSamplers[i].Ptr);
+
+    // Current offsets in the SRB and static resource caches
+    Uint32 SRBCacheOffset    = 0;
+    Uint32 StaticCacheOffset = 0;
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const auto& ResDesc = m_Desc.Resources[i];
+        VERIFY(i == 0 || ResDesc.VarType >= m_Desc.Resources[i - 1].VarType, "Resources must be sorted by variable type");
+
+        const bool IsCombinedSampler = (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER) != 0;
+
+        // The sampler may not be yet initialized, but this is OK as all resources are initialized
+        // in the same order as in m_Desc.Resources
+        const auto AssignedSamplerInd = (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV && !IsCombinedSampler) ?
+            FindAssignedSampler(ResDesc, ResourceAttribs::InvalidSamplerInd) :
+            ResourceAttribs::InvalidSamplerInd;
+
+        bool ImtblSamplerAssigned = false;
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER ||
+            (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV && IsCombinedSampler))
+        {
+            // Separate samplers use the combined sampler suffix. If HLSL-style combined image samplers
+            // are not used, the suffix is null and we will be looking for the sampler itself.
+            const char* SamplerSuffix = ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER ? GetCombinedSamplerSuffix() : nullptr;
+
+            const auto SrcImmutableSamplerInd = Diligent::FindImmutableSampler(m_Desc.ImmutableSamplers, m_Desc.NumImmutableSamplers,
+                                                                               ResDesc.ShaderStages, ResDesc.Name, SamplerSuffix);
+            ImtblSamplerAssigned = SrcImmutableSamplerInd != InvalidImmutableSamplerIndex;
+        }
+
+        const auto* const pAttribs = new (m_pResourceAttribs + i) ResourceAttribs //
+            {
+                AssignedSamplerInd,
+                ImtblSamplerAssigned,
+                SRBCacheOffset,
+                ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC ? StaticCacheOffset : ~0u //
+            };
+        SRBCacheOffset += ResDesc.ArraySize;
+
+        if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+        {
+            m_pStaticResCache->InitializeResources(StaticCacheOffset, ResDesc.ArraySize, ResDesc.ResourceType, pAttribs->IsImmutableSamplerAssigned());
+            StaticCacheOffset += ResDesc.ArraySize;
+        }
+    }
+    m_SRBCacheSize = SRBCacheOffset;
+
+#ifdef DILIGENT_DEBUG
+    if (m_pStaticResCache != nullptr)
+    {
+        m_pStaticResCache->DbgVerifyResourceInitialization();
+    }
+#endif
+
+    VERIFY_EXPR(m_pStaticResCache == nullptr || m_pStaticResCache->GetSize() == StaticCacheOffset);
+}
+
+PipelineResourceSignatureNullImpl::~PipelineResourceSignatureNullImpl()
+{
+    Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::Destruct()
+{
+    if (m_ImmutableSamplers != nullptr)
+    {
+        for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+        {
+            m_ImmutableSamplers[i].~ImmutableSamplerAttribs();
+        }
+        m_ImmutableSamplers = nullptr;
+    }
+
+    TPipelineResourceSignatureBase::Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache)
+{
+    auto& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
+    ResourceCache.Initialize(CacheMemAllocator, m_SRBCacheSize);
+
+    const auto TotalResources = GetTotalResourceCount();
+    const auto CacheType      = ResourceCache.GetContentType();
+    for (Uint32 r = 0; r < TotalResources; ++r)
+    {
+        const auto& ResDesc = GetResourceDesc(r);
+        const auto& Attr    = GetResourceAttribs(r);
+        ResourceCache.InitializeResources(Attr.CacheOffset(CacheType), ResDesc.ArraySize,
+                                          ResDesc.ResourceType, Attr.IsImmutableSamplerAssigned());
+    }
+
+#ifdef DILIGENT_DEBUG
+    ResourceCache.DbgVerifyResourceInitialization();
+#endif
+}
+
+void PipelineResourceSignatureNullImpl::CopyStaticResources(ShaderResourceCacheNull& DstResourceCache) const
+{
+    if (m_pStaticResCache == nullptr)
+        return;
+
+    // SrcResourceCache contains only static resources.
+    // DstResourceCache contains static, mutable and dynamic resources.
+    const auto& SrcResourceCache = *m_pStaticResCache;
+    const auto  ResIdxRange      = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    const auto  SrcCacheType     = SrcResourceCache.GetContentType();
+    const auto  DstCacheType     = DstResourceCache.GetContentType();
+
+    for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+    {
+        const auto& ResDesc = GetResourceDesc(r);
+        const auto& Attr    = GetResourceAttribs(r);
+        VERIFY_EXPR(ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+            continue; // Skip immutable separate samplers
+
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        {
+            const auto     SrcCacheOffset = Attr.CacheOffset(SrcCacheType) + ArrInd;
+            const auto&    SrcCachedRes   = SrcResourceCache.GetResource(SrcCacheOffset);
+            IDeviceObject* pObject        = SrcCachedRes.pObject.RawPtr<IDeviceObject>();
+            if (!pObject)
+                LOG_ERROR_MESSAGE("No resource is assigned to static shader variable '", GetShaderResourcePrintName(ResDesc, ArrInd), "' in pipeline resource signature '", m_Desc.Name, "'.");
+
+            const auto  DstCacheOffset = Attr.CacheOffset(DstCacheType) + ArrInd;
+            const auto& DstCachedRes   = const_cast<const ShaderResourceCacheNull&>(DstResourceCache).GetResource(DstCacheOffset);
+            VERIFY_EXPR(SrcCachedRes.Type == DstCachedRes.Type);
+
+            const IDeviceObject* pCachedResource = DstCachedRes.pObject;
+            if (pCachedResource != pObject)
+            {
+                VERIFY(pCachedResource == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
+                DstResourceCache.SetResource(DstCacheOffset,
+                                             RefCntAutoPtr<IDeviceObject>{SrcCachedRes.pObject},
+                                             SrcCachedRes.BufferBaseOffset,
+                                             SrcCachedRes.BufferRangeSize);
+            }
+        }
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,190 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include <algorithm>
+
+#include "PipelineStateNullImpl.hpp"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineStateNullImpl::ShaderStageInfo::ShaderStageInfo(const ShaderNullImpl* pShader) :
+    Type{pShader->GetDesc().ShaderType},
+    Shaders{pShader}
+{
+}
+
+void PipelineStateNullImpl::ShaderStageInfo::Append(const ShaderNullImpl* pShader)
+{
+    VERIFY_EXPR(pShader != nullptr);
+    VERIFY(std::find(Shaders.begin(), Shaders.end(), pShader) == Shaders.end(),
+           "Shader '", pShader->GetDesc().Name, "' already exists in the stage. Shaders must be deduplicated.");
+
+    const auto NewShaderType = pShader->GetDesc().ShaderType;
+    if (Type == SHADER_TYPE_UNKNOWN)
+    {
+        VERIFY_EXPR(Shaders.empty());
+        Type = NewShaderType;
+    }
+    else
+    {
+        VERIFY(Type == NewShaderType, "The type (", GetShaderTypeLiteralName(NewShaderType),
+               ") of shader '", pShader->GetDesc().Name, "' being added to the stage is inconsistent with the stage type (",
+               GetShaderTypeLiteralName(Type), ").");
+    }
+    Shaders.push_back(pShader);
+}
+
+size_t PipelineStateNullImpl::ShaderStageInfo::Count() const
+{
+    return Shaders.size();
+}
+
+template <typename PSOCreateInfoType>
+PipelineStateNullImpl::TShaderStages PipelineStateNullImpl::InitInternalObjects(const PSOCreateInfoType& CreateInfo)
+{
+    TShaderStages ShaderStages;
+    ExtractShaders<ShaderNullImpl>(CreateInfo, ShaderStages);
+
+    FixedLinearAllocator MemPool{GetRawAllocator()};
+
+    ReserveSpaceForPipelineDesc(CreateInfo, MemPool);
+
+    MemPool.Reserve();
+
+    InitializePipelineDesc(CreateInfo, MemPool);
+
+    if (m_UsingImplicitSignature)
+    {
+        // Null shaders are not reflected, so the implicit signature only contains
+        // immutable samplers from the resource layout.
+        VERIFY_EXPR(m_SignatureCount == 1);
+        constexpr bool                  bIsDeviceInternal  = false;
+        constexpr ImmutableSamplerDesc* pImmutableSamplers = nullptr;
+        m_Signatures[0] = CreateDefaultSignature({}, nullptr, pImmutableSamplers, GetActiveShaderStages(), bIsDeviceInternal);
+        VERIFY_EXPR(!m_Signatures[0] || m_Signatures[0]->GetDesc().BindingIndex == 0);
+    }
+
+    return ShaderStages;
+}
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters* pRefCounters, RenderDeviceNullImpl* pDeviceNull, const GraphicsPipelineStateCreateInfo& CreateInfo) :
+    TPipelineStateBase{pRefCounters, pDeviceNull, CreateInfo}
+{
+    try
+    {
+        Construct(CreateInfo);
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters* pRefCounters, RenderDeviceNullImpl* pDeviceNull, const ComputePipelineStateCreateInfo& CreateInfo) :
+    TPipelineStateBase{pRefCounters, pDeviceNull, CreateInfo}
+{
+    try
+    {
+        Construct(CreateInfo);
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters* pRefCounters, RenderDeviceNullImpl* pDeviceNull, const RayTracingPipelineStateCreateInfo& CreateInfo) :
+    TPipelineStateBase{pRefCounters, pDeviceNull, CreateInfo}
+{
+    try
+    {
+        Construct(CreateInfo);
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+void PipelineStateNullImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
+{
+    InitInternalObjects(CreateInfo);
+}
+
+void PipelineStateNullImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
+{
+    InitInternalObjects(CreateInfo);
+}
+
+void PipelineStateNullImpl::InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo)
+{
+    InitInternalObjects(CreateInfo);
+    InitShaderGroupHandles();
+}
+
+void PipelineStateNullImpl::InitShaderGroupHandles()
+{
+    auto& RTData = *m_pRayTracingPipelineData;
+    VERIFY_EXPR(RTData.ShaderHandleSize >= sizeof(Uint32));
+
+    // There is no driver to query the handles from, so every group gets a unique
+    // deterministic handle that starts with its one-based group index.
+    for (const auto& NameAndIndex : RTData.NameToGroupIndex)
+    {
+        const Uint32 GroupIndex = NameAndIndex.second;
+        VERIFY_EXPR(RTData.ShaderHandleSize * (GroupIndex + 1) <= RTData.ShaderDataSize);
+
+        auto* pHandle = &RTData.ShaderHandles[RTData.ShaderHandleSize * GroupIndex];
+        memset(pHandle, 0, RTData.ShaderHandleSize);
+
+        const Uint32 HandleValue = GroupIndex + 1;
+        memcpy(pHandle, &HandleValue, sizeof(HandleValue));
+    }
+}
+
+PipelineStateNullImpl::~PipelineStateNullImpl()
+{
+    WaitForAsyncInitialization();
+    Destruct();
+}
+
+void PipelineStateNullImpl::Destruct()
+{
+    TPipelineStateBase::Destruct();
+}
+
+} // namespace Diligent
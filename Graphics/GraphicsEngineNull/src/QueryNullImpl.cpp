@@ -0,0 +1,96 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include <new>
+
+#include "QueryNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+
+namespace Diligent
+{
+
+QueryNullImpl::QueryNullImpl(IReferenceCounters*   pRefCounters,
+                             RenderDeviceNullImpl* pDevice,
+                             const QueryDesc&      Desc) :
+    TQueryBase{pRefCounters, pDevice, Desc}
+{
+}
+
+QueryNullImpl::~QueryNullImpl()
+{
+}
+
+bool QueryNullImpl::GetData(void* pData, Uint32 DataSize, bool AutoInvalidate)
+{
+    TQueryBase::CheckQueryDataPtr(pData, DataSize);
+
+    if (pData != nullptr)
+    {
+        // Timestamps are reported in nanoseconds
+        static constexpr Uint64 Frequency = 1000000000;
+
+        static_assert(QUERY_TYPE_NUM_TYPES == 6, "Not all QUERY_TYPE enum values are handled below");
+        switch (m_Desc.Type)
+        {
+            case QUERY_TYPE_OCCLUSION:
+                new (pData) QueryDataOcclusion{};
+                break;
+
+            case QUERY_TYPE_BINARY_OCCLUSION:
+                new (pData) QueryDataBinaryOcclusion{};
+                break;
+
+            case QUERY_TYPE_TIMESTAMP:
+                new (pData) QueryDataTimestamp{}; // Counter is zero
+                reinterpret_cast<QueryDataTimestamp*>(pData)->Frequency = Frequency;
+                break;
+
+            case QUERY_TYPE_PIPELINE_STATISTICS:
+                new (pData) QueryDataPipelineStatistics{};
+                break;
+
+            case QUERY_TYPE_DURATION:
+                new (pData) QueryDataDuration{}; // Duration is zero
+                reinterpret_cast<QueryDataDuration*>(pData)->Frequency = Frequency;
+                break;
+
+            default:
+                UNEXPECTED("Unexpected query type");
+        }
+
+        if (AutoInvalidate)
+            Invalidate();
+    }
+
+    return true;
+}
+
+} // namespace Diligent
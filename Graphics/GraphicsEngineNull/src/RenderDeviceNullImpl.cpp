@@ -0,0 +1,216 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "RenderDeviceNullImpl.hpp"
+
+#include "DeviceContextNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+#include "BottomLevelASNullImpl.hpp"
+#include "TopLevelASNullImpl.hpp"
+#include "ShaderBindingTableNullImpl.hpp"
+
+#include "EngineMemory.h"
+
+namespace Diligent
+{
+
+RenderDeviceNullImpl::RenderDeviceNullImpl(IReferenceCounters*         pRefCounters,
+                                           IMemoryAllocator&           RawMemAllocator,
+                                           IEngineFactory*             pEngineFactory,
+                                           const EngineNullCreateInfo& EngineCI,
+                                           const GraphicsAdapterInfo&  AdapterInfo) :
+    // clang-format off
+    TRenderDeviceBase
+    {
+        pRefCounters,
+        RawMemAllocator,
+        pEngineFactory,
+        EngineCI,
+        AdapterInfo
+    },
+    m_AllocateResourceMemory{EngineCI.AllocateResourceMemory != False}
+// clang-format on
+{
+    m_DeviceInfo.Type       = RENDER_DEVICE_TYPE_NULL;
+    m_DeviceInfo.APIVersion = Version{1, 0};
+    m_DeviceInfo.Features   = EnableDeviceFeatures(m_AdapterInfo.Features, EngineCI.Features);
+    m_DeviceInfo.NDC        = NDCAttribs{0.0f, 1.0f, -0.5f};
+
+    for (Uint32 fmt = 1; fmt < m_TextureFormatsInfo.size(); ++fmt)
+        m_TextureFormatsInfo[fmt].Supported = true; // Capabilities of every format are reported by TestTextureFormat()
+}
+
+RenderDeviceNullImpl::~RenderDeviceNullImpl()
+{
+}
+
+void RenderDeviceNullImpl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
+{
+    auto& TexFormatInfo = m_TextureFormatsInfo[TexFormat];
+    VERIFY(TexFormatInfo.Supported, "Texture format is not supported");
+
+    // There is no device to query, so every format is reported with the widest
+    // capabilities that make sense for its component type.
+    TexFormatInfo.Filterable = TexFormatInfo.ComponentType != COMPONENT_TYPE_SINT && TexFormatInfo.ComponentType != COMPONENT_TYPE_UINT;
+    TexFormatInfo.Dimensions =
+        RESOURCE_DIMENSION_SUPPORT_TEX_1D | RESOURCE_DIMENSION_SUPPORT_TEX_1D_ARRAY |
+        RESOURCE_DIMENSION_SUPPORT_TEX_2D | RESOURCE_DIMENSION_SUPPORT_TEX_2D_ARRAY |
+        RESOURCE_DIMENSION_SUPPORT_TEX_3D |
+        RESOURCE_DIMENSION_SUPPORT_TEX_CUBE | RESOURCE_DIMENSION_SUPPORT_TEX_CUBE_ARRAY;
+
+    switch (TexFormatInfo.ComponentType)
+    {
+        case COMPONENT_TYPE_DEPTH:
+        case COMPONENT_TYPE_DEPTH_STENCIL:
+            TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE | BIND_DEPTH_STENCIL;
+            TexFormatInfo.SampleCounts = 0x01 | 0x02 | 0x04 | 0x08;
+            break;
+
+        case COMPONENT_TYPE_COMPRESSED:
+            TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE;
+            TexFormatInfo.SampleCounts = 0x01;
+            break;
+
+        default:
+            TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET | BIND_UNORDERED_ACCESS;
+            TexFormatInfo.SampleCounts = 0x01 | 0x02 | 0x04 | 0x08;
+    }
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc, const BufferData* pBuffData, IBuffer** ppBuffer)
+{
+    CreateBufferImpl(ppBuffer, BuffDesc, pBuffData);
+}
+
+void RenderDeviceNullImpl::CreateShader(const ShaderCreateInfo& ShaderCI, IShader** ppShader)
+{
+    CreateShaderImpl(ppShader, ShaderCI);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc, const TextureData* pData, ITexture** ppTexture)
+{
+    CreateTextureImpl(ppTexture, TexDesc, pData);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc, ISampler** ppSampler)
+{
+    CreateSamplerImpl(ppSampler, SamplerDesc);
+}
+
+void RenderDeviceNullImpl::CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateFence(const FenceDesc& Desc, IFence** ppFence)
+{
+    CreateFenceImpl(ppFence, Desc);
+}
+
+void RenderDeviceNullImpl::CreateQuery(const QueryDesc& Desc, IQuery** ppQuery)
+{
+    CreateQueryImpl(ppQuery, Desc);
+}
+
+void RenderDeviceNullImpl::CreateRenderPass(const RenderPassDesc& Desc, IRenderPass** ppRenderPass)
+{
+    CreateRenderPassImpl(ppRenderPass, Desc);
+}
+
+void RenderDeviceNullImpl::CreateFramebuffer(const FramebufferDesc& Desc, IFramebuffer** ppFramebuffer)
+{
+    CreateFramebufferImpl(ppFramebuffer, Desc);
+}
+
+void RenderDeviceNullImpl::CreateBLAS(const BottomLevelASDesc& Desc,
+                                      IBottomLevelAS**         ppBLAS)
+{
+    CreateBLASImpl(ppBLAS, Desc);
+}
+
+void RenderDeviceNullImpl::CreateTLAS(const TopLevelASDesc& Desc,
+                                      ITopLevelAS**         ppTLAS)
+{
+    CreateTLASImpl(ppTLAS, Desc);
+}
+
+void RenderDeviceNullImpl::CreateSBT(const ShaderBindingTableDesc& Desc,
+                                     IShaderBindingTable**         ppSBT)
+{
+    CreateSBTImpl(ppSBT, Desc);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature)
+{
+    CreatePipelineResourceSignature(Desc, ppSignature, SHADER_TYPE_UNKNOWN, false);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature,
+                                                           SHADER_TYPE                          ShaderStages,
+                                                           bool                                 IsDeviceInternal)
+{
+    CreatePipelineResourceSignatureImpl(ppSignature, Desc, ShaderStages, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::IdleGPU()
+{
+    VERIFY_EXPR(m_wpImmediateContexts.size() == 1);
+
+    if (auto pImmediateCtx = m_wpImmediateContexts[0].Lock())
+    {
+        pImmediateCtx->WaitForIdle();
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,246 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "ShaderResourceCacheNull.hpp"
+
+#include "DeviceContextNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "TopLevelASNullImpl.hpp"
+
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+size_t ShaderResourceCacheNull::GetRequiredMemorySize(Uint32 NumResources)
+{
+    return NumResources * sizeof(Resource);
+}
+
+void ShaderResourceCacheNull::Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources)
+{
+    VERIFY(!m_pMemory, "Memory has already been allocated");
+
+    m_NumResources = NumResources;
+
+    const auto MemorySize = GetRequiredMemorySize(NumResources);
+#ifdef DILIGENT_DEBUG
+    m_DbgInitializedResources.resize(m_NumResources);
+#endif
+    if (MemorySize > 0)
+    {
+        m_pMemory = decltype(m_pMemory){
+            ALLOCATE_RAW(MemAllocator, "Memory for shader resource cache data", MemorySize),
+            STDDeleter<void, IMemoryAllocator>(MemAllocator) //
+        };
+        m_pResources = reinterpret_cast<Resource*>(m_pMemory.get());
+    }
+}
+
+void ShaderResourceCacheNull::InitializeResources(Uint32 Offset, Uint32 ArraySize, SHADER_RESOURCE_TYPE Type, bool HasImmutableSampler)
+{
+    VERIFY_EXPR(Offset + ArraySize <= m_NumResources);
+    for (Uint32 res = 0; res < ArraySize; ++res)
+    {
+        new (&m_pResources[Offset + res]) Resource{Type, HasImmutableSampler};
+#ifdef DILIGENT_DEBUG
+        m_DbgInitializedResources[Offset + res] = true;
+#endif
+    }
+}
+
+#ifdef DILIGENT_DEBUG
+void ShaderResourceCacheNull::DbgVerifyResourceInitialization() const
+{
+    for (auto ResInitialized : m_DbgInitializedResources)
+        VERIFY(ResInitialized, "Not all resources in the cache have been initialized. This is a bug.");
+}
+#endif
+
+ShaderResourceCacheNull::~ShaderResourceCacheNull()
+{
+    if (m_pMemory)
+    {
+        for (Uint32 res = 0; res < m_NumResources; ++res)
+            m_pResources[res].~Resource();
+    }
+}
+
+const ShaderResourceCacheNull::Resource& ShaderResourceCacheNull::SetResource(Uint32                         CacheOffset,
+                                                                              RefCntAutoPtr<IDeviceObject>&& pObject,
+                                                                              Uint64                         BufferBaseOffset,
+                                                                              Uint64                         BufferRangeSize)
+{
+    auto& DstRes = GetResource(CacheOffset);
+
+    VERIFY(DstRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER || (BufferBaseOffset == 0 && BufferRangeSize == 0),
+           "Buffer range can only be specified for constant buffers");
+
+    DstRes.pObject             = std::move(pObject);
+    DstRes.BufferBaseOffset    = BufferBaseOffset;
+    DstRes.BufferRangeSize     = BufferRangeSize;
+    DstRes.BufferDynamicOffset = 0;
+
+    UpdateRevision();
+
+    return DstRes;
+}
+
+void ShaderResourceCacheNull::SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset)
+{
+    auto& DstRes = GetResource(CacheOffset);
+    VERIFY(DstRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER ||
+               DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV ||
+               DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV,
+           "Dynamic offsets can only be set for constant or structured buffers");
+
+    DEV_CHECK_ERR(DstRes.pObject, "Setting dynamic offset when no object is bound");
+    const auto* pBufferNull = DstRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER ?
+        DstRes.pObject.RawPtr<const BufferNullImpl>() :
+        DstRes.pObject.RawPtr<const BufferViewNullImpl>()->GetBuffer<const BufferNullImpl>();
+    DEV_CHECK_ERR(DstRes.BufferBaseOffset + DstRes.BufferRangeSize + DynamicBufferOffset <= pBufferNull->GetDesc().Size,
+                  "Specified offset is out of buffer bounds");
+
+    DstRes.BufferDynamicOffset = DynamicBufferOffset;
+}
+
+namespace
+{
+
+template <bool VerifyOnly, typename ResourceImplType, typename TransitionHandlerType>
+void TransitionResource(ResourceImplType*     pResource,
+                        RESOURCE_STATE        RequiredState,
+                        const char*           ResourceTypeName,
+                        TransitionHandlerType Transition)
+{
+    if (pResource == nullptr || !pResource->IsInKnownState())
+        return;
+
+    const bool IsInRequiredState = pResource->CheckState(RequiredState);
+    if (VerifyOnly)
+    {
+        if (!IsInRequiredState)
+        {
+            LOG_ERROR_MESSAGE("State of ", ResourceTypeName, " '", pResource->GetDesc().Name, "' is incorrect. Required state: ",
+                              GetResourceStateString(RequiredState), ". Actual state: ",
+                              GetResourceStateString(pResource->GetState()),
+                              ". Call IDeviceContext::TransitionShaderResources(), use RESOURCE_STATE_TRANSITION_MODE_TRANSITION "
+                              "when calling IDeviceContext::CommitShaderResources() or explicitly transition the ", ResourceTypeName,
+                              " state with IDeviceContext::TransitionResourceStates().");
+        }
+    }
+    else
+    {
+        if (!IsInRequiredState)
+            Transition(*pResource, RequiredState);
+    }
+}
+
+} // namespace
+
+template <bool VerifyOnly>
+void ShaderResourceCacheNull::TransitionResources(DeviceContextNullImpl* pCtxNullImpl)
+{
+    const auto TransitionBuffer = [pCtxNullImpl](BufferNullImpl& Buffer, RESOURCE_STATE RequiredState) {
+        pCtxNullImpl->TransitionBufferState(Buffer, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+    };
+    const auto TransitionTexture = [pCtxNullImpl](TextureNullImpl& Texture, RESOURCE_STATE RequiredState) {
+        pCtxNullImpl->TransitionTextureState(Texture, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+    };
+    const auto TransitionTLAS = [pCtxNullImpl](TopLevelASNullImpl& TLAS, RESOURCE_STATE RequiredState) {
+        pCtxNullImpl->TransitionTLASState(TLAS, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+    };
+
+    for (Uint32 res = 0; res < m_NumResources; ++res)
+    {
+        auto& Res = m_pResources[res];
+        switch (Res.Type)
+        {
+            case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+                TransitionResource<VerifyOnly>(Res.pObject.RawPtr<BufferNullImpl>(), RESOURCE_STATE_CONSTANT_BUFFER, "buffer", TransitionBuffer);
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+            case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+            {
+                auto* pBuffViewNull = Res.pObject.RawPtr<BufferViewNullImpl>();
+                auto* pBufferNull   = pBuffViewNull != nullptr ? pBuffViewNull->GetBuffer<BufferNullImpl>() : nullptr;
+                TransitionResource<VerifyOnly>(pBufferNull,
+                                               Res.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV ? RESOURCE_STATE_SHADER_RESOURCE : RESOURCE_STATE_UNORDERED_ACCESS,
+                                               "buffer", TransitionBuffer);
+            }
+            break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+            case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+            {
+                auto* pTexViewNull = Res.pObject.RawPtr<TextureViewNullImpl>();
+                auto* pTextureNull = pTexViewNull != nullptr ? pTexViewNull->GetTexture<TextureNullImpl>() : nullptr;
+                TransitionResource<VerifyOnly>(pTextureNull,
+                                               Res.Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV ? RESOURCE_STATE_SHADER_RESOURCE : RESOURCE_STATE_UNORDERED_ACCESS,
+                                               "texture", TransitionTexture);
+            }
+            break;
+
+            case SHADER_RESOURCE_TYPE_SAMPLER:
+            {
+                // Nothing to do with samplers
+            }
+            break;
+
+            case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT:
+            {
+                // Nothing to do with input attachments - they are transitioned by the render pass.
+            }
+            break;
+
+            case SHADER_RESOURCE_TYPE_ACCEL_STRUCT:
+            {
+                auto* pTLASNull = Res.pObject.RawPtr<TopLevelASNullImpl>();
+                TransitionResource<VerifyOnly>(pTLASNull, RESOURCE_STATE_RAY_TRACING, "TLAS", TransitionTLAS);
+#ifdef DILIGENT_DEVELOPMENT
+                if (pTLASNull != nullptr)
+                    pTLASNull->ValidateContent();
+#endif
+            }
+            break;
+
+            default: UNEXPECTED("Unexpected resource type");
+        }
+    }
+}
+
+template void ShaderResourceCacheNull::TransitionResources<false>(DeviceContextNullImpl* pCtxNullImpl);
+template void ShaderResourceCacheNull::TransitionResources<true>(DeviceContextNullImpl* pCtxNullImpl);
+
+} // namespace Diligent
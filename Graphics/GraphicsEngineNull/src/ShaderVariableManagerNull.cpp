@@ -0,0 +1,512 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "ShaderVariableManagerNull.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "TopLevelASNullImpl.hpp"
+
+namespace Diligent
+{
+
+template <typename HandlerType>
+void ProcessSignatureResources(const PipelineResourceSignatureNullImpl& Signature,
+                               const SHADER_RESOURCE_VARIABLE_TYPE*     AllowedVarTypes,
+                               Uint32                                   NumAllowedTypes,
+                               SHADER_TYPE                              ShaderStages,
+                               HandlerType                              Handler)
+{
+    const bool UsingSeparateSamplers = Signature.IsUsingSeparateSamplers();
+    Signature.ProcessResources(AllowedVarTypes, NumAllowedTypes, ShaderStages,
+                               [&](const PipelineResourceDesc& ResDesc, Uint32 Index) //
+                               {
+                                   const auto& ResAttr = Signature.GetResourceAttribs(Index);
+
+                                   // When using HLSL-style combined image samplers, we need to skip separate samplers.
+                                   // Also always skip immutable separate samplers.
+                                   if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER &&
+                                       (!UsingSeparateSamplers || ResAttr.IsImmutableSamplerAssigned()))
+                                       return;
+
+                                   Handler(Index);
+                               });
+}
+
+size_t ShaderVariableManagerNull::GetRequiredMemorySize(const PipelineResourceSignatureNullImpl& Signature,
+                                                        const SHADER_RESOURCE_VARIABLE_TYPE*     AllowedVarTypes,
+                                                        Uint32                                   NumAllowedTypes,
+                                                        SHADER_TYPE                              ShaderStages,
+                                                        Uint32*                                  pNumVariables)
+{
+    Uint32 NumVariables = 0;
+    if (pNumVariables == nullptr)
+        pNumVariables = &NumVariables;
+    *pNumVariables = 0;
+    ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderStages,
+                              [pNumVariables](Uint32) //
+                              {
+                                  ++(*pNumVariables);
+                              });
+
+    return (*pNumVariables) * sizeof(ShaderVariableNullImpl);
+}
+
+// Creates shader variable for every resource from SrcLayout whose type is one AllowedVarTypes
+void ShaderVariableManagerNull::Initialize(const PipelineResourceSignatureNullImpl& Signature,
+                                           IMemoryAllocator&                        Allocator,
+                                           const SHADER_RESOURCE_VARIABLE_TYPE*     AllowedVarTypes,
+                                           Uint32                                   NumAllowedTypes,
+                                           SHADER_TYPE                              ShaderType)
+{
+    VERIFY_EXPR(m_NumVariables == 0);
+    const auto MemSize = GetRequiredMemorySize(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType, &m_NumVariables);
+
+    if (m_NumVariables == 0)
+        return;
+
+    TBase::Initialize(Signature, Allocator, MemSize);
+
+    Uint32 VarInd = 0;
+    ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
+                              [this, &VarInd](Uint32 ResIndex) //
+                              {
+                                  ::new (m_pVariables + VarInd) ShaderVariableNullImpl{*this, ResIndex};
+                                  ++VarInd;
+                              });
+    VERIFY_EXPR(VarInd == m_NumVariables);
+}
+
+void ShaderVariableManagerNull::Destroy(IMemoryAllocator& Allocator)
+{
+    if (m_pVariables != nullptr)
+    {
+        for (Uint32 v = 0; v < m_NumVariables; ++v)
+            m_pVariables[v].~ShaderVariableNullImpl();
+    }
+    TBase::Destroy(Allocator);
+}
+
+ShaderVariableNullImpl* ShaderVariableManagerNull::GetVariable(const Char* Name) const
+{
+    for (Uint32 v = 0; v < m_NumVariables; ++v)
+    {
+        auto& Var = m_pVariables[v];
+        if (strcmp(Var.GetDesc().Name, Name) == 0)
+            return &Var;
+    }
+    return nullptr;
+}
+
+
+ShaderVariableNullImpl* ShaderVariableManagerNull::GetVariable(Uint32 Index) const
+{
+    if (Index >= m_NumVariables)
+    {
+        LOG_ERROR("Index ", Index, " is out of range");
+        return nullptr;
+    }
+
+    return m_pVariables + Index;
+}
+
+Uint32 ShaderVariableManagerNull::GetVariableIndex(const ShaderVariableNullImpl& Variable)
+{
+    if (m_pVariables == nullptr)
+    {
+        LOG_ERROR("This shader variable manager has no variables");
+        return ~0u;
+    }
+
+    const auto Offset = reinterpret_cast<const Uint8*>(&Variable) - reinterpret_cast<Uint8*>(m_pVariables);
+    DEV_CHECK_ERR(Offset % sizeof(ShaderVariableNullImpl) == 0, "Offset is not multiple of ShaderVariableNullImpl class size");
+    const auto Index = static_cast<Uint32>(Offset / sizeof(ShaderVariableNullImpl));
+    if (Index < m_NumVariables)
+        return Index;
+    else
+    {
+        LOG_ERROR("Failed to get variable index. The variable ", &Variable, " does not belong to this shader variable manager");
+        return ~0u;
+    }
+}
+
+const PipelineResourceDesc& ShaderVariableManagerNull::GetResourceDesc(Uint32 Index) const
+{
+    VERIFY_EXPR(m_pSignature);
+    return m_pSignature->GetResourceDesc(Index);
+}
+
+const ShaderVariableManagerNull::ResourceAttribs& ShaderVariableManagerNull::GetResourceAttribs(Uint32 Index) const
+{
+    VERIFY_EXPR(m_pSignature);
+    return m_pSignature->GetResourceAttribs(Index);
+}
+
+void ShaderVariableManagerNull::BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+{
+    TBase::BindResources(pResourceMapping, Flags);
+}
+
+void ShaderVariableManagerNull::CheckResources(IResourceMapping*                    pResourceMapping,
+                                               BIND_SHADER_RESOURCES_FLAGS          Flags,
+                                               SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
+{
+    TBase::CheckResources(pResourceMapping, Flags, StaleVarTypes);
+}
+
+
+namespace
+{
+
+struct BindResourceHelper
+{
+    BindResourceHelper(const PipelineResourceSignatureNullImpl& Signature,
+                       ShaderResourceCacheNull&                 ResourceCache,
+                       Uint32                                   ResIndex,
+                       Uint32                                   ArrayIndex);
+
+    void operator()(const BindResourceInfo& BindInfo) const;
+
+private:
+    // clang-format off
+    void CacheConstantBuffer       (const BindResourceInfo& BindInfo) const;
+    void CacheBufferView           (const BindResourceInfo& BindInfo) const;
+    void CacheTextureView          (const BindResourceInfo& BindInfo) const;
+    void CacheSeparateSampler      (const BindResourceInfo& BindInfo) const;
+    void CacheInputAttachment      (const BindResourceInfo& BindInfo) const;
+    void CacheAccelerationStructure(const BindResourceInfo& BindInfo) const;
+    // clang-format on
+
+    template <typename ObjectType>
+    bool UpdateCachedResource(RefCntAutoPtr<ObjectType>&& pObject,
+                              Uint64                      BufferBaseOffset = 0,
+                              Uint64                      BufferRangeSize  = 0) const;
+
+private:
+    using ResourceAttribs = PipelineResourceSignatureNullImpl::ResourceAttribs;
+
+    const PipelineResourceSignatureNullImpl& m_Signature;
+    ShaderResourceCacheNull&                 m_ResourceCache;
+    const Uint32                             m_ArrayIndex;
+    const ResourceCacheContentType           m_CacheType;
+    const PipelineResourceDesc&              m_ResDesc;
+    const ResourceAttribs&                   m_Attribs;
+    const Uint32                             m_DstResCacheOffset;
+    const ShaderResourceCacheNull::Resource& m_DstRes;
+};
+
+BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureNullImpl& Signature,
+                                       ShaderResourceCacheNull&                 ResourceCache,
+                                       Uint32                                   ResIndex,
+                                       Uint32                                   ArrayIndex) :
+    // clang-format off
+    m_Signature         {Signature},
+    m_ResourceCache     {ResourceCache},
+    m_ArrayIndex        {ArrayIndex},
+    m_CacheType         {ResourceCache.GetContentType()},
+    m_ResDesc           {Signature.GetResourceDesc(ResIndex)},
+    m_Attribs           {Signature.GetResourceAttribs(ResIndex)},
+    m_DstResCacheOffset {m_Attribs.CacheOffset(m_CacheType) + ArrayIndex},
+    m_DstRes            {const_cast<const ShaderResourceCacheNull&>(ResourceCache).GetResource(m_DstResCacheOffset)}
+// clang-format on
+{
+    VERIFY(ArrayIndex < m_ResDesc.ArraySize, "Array index is out of range, but it should've been corrected by ShaderVariableBase::SetArray()");
+    VERIFY(m_DstRes.Type == m_ResDesc.ResourceType, "Inconsistent types");
+}
+
+void BindResourceHelper::operator()(const BindResourceInfo& BindInfo) const
+{
+    VERIFY_EXPR(m_ArrayIndex == BindInfo.ArrayIndex);
+
+    if (BindInfo.pObject != nullptr)
+    {
+        static_assert(SHADER_RESOURCE_TYPE_LAST == 8, "Please update the switch below to handle the new shader resource type");
+        switch (m_DstRes.Type)
+        {
+            case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+                CacheConstantBuffer(BindInfo);
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+            case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+                CacheBufferView(BindInfo);
+                break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+            case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+                CacheTextureView(BindInfo);
+                break;
+
+            case SHADER_RESOURCE_TYPE_SAMPLER:
+                if (!m_Attribs.IsImmutableSamplerAssigned())
+                {
+                    CacheSeparateSampler(BindInfo);
+                }
+                else
+                {
+                    UNEXPECTED("Attempting to assign a sampler to an immutable sampler '", m_ResDesc.Name, '\'');
+                }
+                break;
+
+            case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT:
+                CacheInputAttachment(BindInfo);
+                break;
+
+            case SHADER_RESOURCE_TYPE_ACCEL_STRUCT:
+                CacheAccelerationStructure(BindInfo);
+                break;
+
+            default: UNEXPECTED("Unknown resource type ", static_cast<Uint32>(m_DstRes.Type));
+        }
+    }
+    else
+    {
+        DEV_CHECK_ERR(m_DstRes.pObject == nullptr || IsResourceRebindable(m_ResDesc),
+                      "Shader variable '", m_ResDesc.Name, "' is not dynamic, but is being reset to null. This is an error and may cause unpredicted behavior. ",
+                      "Use another shader resource binding instance or label the variable as dynamic if you need to bind another resource.");
+
+        m_ResourceCache.ResetResource(m_DstResCacheOffset);
+    }
+}
+
+template <typename ObjectType>
+bool BindResourceHelper::UpdateCachedResource(RefCntAutoPtr<ObjectType>&& pObject,
+                                              Uint64                      BufferBaseOffset,
+                                              Uint64                      BufferRangeSize) const
+{
+    if (pObject)
+    {
+        if (!IsResourceRebindable(m_ResDesc) && m_DstRes.pObject != nullptr)
+        {
+            DEV_CHECK_ERR(m_DstRes.pObject == pObject, "Binding another object to a non-dynamic variable is not allowed");
+            // Do not update resource if one is already bound unless it is dynamic to
+            // match the behavior of other backends.
+            return false;
+        }
+
+        m_ResourceCache.SetResource(m_DstResCacheOffset, std::move(pObject), BufferBaseOffset, BufferRangeSize);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void BindResourceHelper::CacheConstantBuffer(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting constant buffer to null is handled by BindResourceHelper::operator()");
+
+    // We cannot use ClassPtrCast<> here as the resource can have wrong type
+    RefCntAutoPtr<BufferNullImpl> pBufferNull{BindInfo.pObject, IID_Buffer};
+#ifdef DILIGENT_DEVELOPMENT
+    VerifyConstantBufferBinding(m_ResDesc, BindInfo, pBufferNull.RawPtr(), m_DstRes.pObject.RawPtr(),
+                                m_DstRes.BufferBaseOffset, m_DstRes.BufferRangeSize, m_Signature.GetDesc().Name);
+#endif
+
+    UpdateCachedResource(std::move(pBufferNull), BindInfo.BufferBaseOffset, BindInfo.BufferRangeSize);
+}
+
+void BindResourceHelper::CacheBufferView(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting buffer view to null is handled by BindResourceHelper::operator()");
+
+    RefCntAutoPtr<BufferViewNullImpl> pBufferViewNull{BindInfo.pObject, IID_BufferView};
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        const auto RequiredViewType = m_DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV ? BUFFER_VIEW_SHADER_RESOURCE : BUFFER_VIEW_UNORDERED_ACCESS;
+        VerifyResourceViewBinding(m_ResDesc, BindInfo, pBufferViewNull.RawPtr(),
+                                  {RequiredViewType},
+                                  RESOURCE_DIM_BUFFER, // Expected resource dim
+                                  false,               // IsMultisample (ignored when resource dim is buffer)
+                                  m_DstRes.pObject.RawPtr(),
+                                  m_Signature.GetDesc().Name);
+        ValidateBufferMode(m_ResDesc, m_ArrayIndex, pBufferViewNull.RawPtr());
+    }
+#endif
+
+    UpdateCachedResource(std::move(pBufferViewNull));
+}
+
+void BindResourceHelper::CacheTextureView(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting texture view to null is handled by BindResourceHelper::operator()");
+
+    RefCntAutoPtr<TextureViewNullImpl> pTexViewNull0{BindInfo.pObject, IID_TextureView};
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        const auto RequiredViewType = m_DstRes.Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV ? TEXTURE_VIEW_SHADER_RESOURCE : TEXTURE_VIEW_UNORDERED_ACCESS;
+        VerifyResourceViewBinding(m_ResDesc, BindInfo, pTexViewNull0.RawPtr(),
+                                  {RequiredViewType},
+                                  RESOURCE_DIM_UNDEFINED, // Required resource dimension is not known
+                                  false,                  // IsMultisample (ignored when resource dim is unknown)
+                                  m_DstRes.pObject.RawPtr(),
+                                  m_Signature.GetDesc().Name);
+    }
+#endif
+
+    TextureViewNullImpl* pTexViewNull = pTexViewNull0;
+    if (UpdateCachedResource(std::move(pTexViewNull0)))
+    {
+        if (m_Attribs.IsCombinedWithSampler())
+        {
+            VERIFY(m_DstRes.Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV,
+                   "Only texture SRVs can be assigned separate samplers when using HLSL-style combined samplers.");
+            VERIFY(!m_Attribs.IsImmutableSamplerAssigned(), "Separate image can't be assigned an immutable sampler.");
+
+            const auto& SamplerResDesc = m_Signature.GetResourceDesc(m_Attribs.SamplerInd);
+            const auto& SamplerAttribs = m_Signature.GetResourceAttribs(m_Attribs.SamplerInd);
+            VERIFY_EXPR(SamplerResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER);
+
+            if (!SamplerAttribs.IsImmutableSamplerAssigned())
+            {
+                auto* pSampler = pTexViewNull->GetSampler();
+                if (pSampler != nullptr)
+                {
+                    DEV_CHECK_ERR(SamplerResDesc.ArraySize == 1 || SamplerResDesc.ArraySize == m_ResDesc.ArraySize,
+                                  "Array size (", SamplerResDesc.ArraySize,
+                                  ") of separate sampler variable '",
+                                  SamplerResDesc.Name,
+                                  "' must be one or the same as the array size (", m_ResDesc.ArraySize,
+                                  ") of separate image variable '", m_ResDesc.Name, "' it is assigned to");
+
+                    BindResourceHelper BindSeparateSamler{
+                        m_Signature,
+                        m_ResourceCache,
+                        m_Attribs.SamplerInd,
+                        SamplerResDesc.ArraySize == 1 ? 0 : m_ArrayIndex};
+                    BindSeparateSamler(BindResourceInfo{BindSeparateSamler.m_ArrayIndex, pSampler});
+                }
+                else
+                {
+                    LOG_ERROR_MESSAGE("Failed to bind sampler to sampler variable '", SamplerResDesc.Name,
+                                      "' assigned to separate image '", GetShaderResourcePrintName(m_ResDesc, m_ArrayIndex),
+                                      "': no sampler is set in texture view '", pTexViewNull->GetDesc().Name, '\'');
+                }
+            }
+        }
+    }
+}
+
+void BindResourceHelper::CacheSeparateSampler(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting separate sampler to null is handled by BindResourceHelper::operator()");
+    VERIFY(m_DstRes.Type == SHADER_RESOURCE_TYPE_SAMPLER, "Separate sampler resource is expected");
+    VERIFY(!m_Attribs.IsImmutableSamplerAssigned(), "This separate sampler is assigned an immutable sampler");
+
+    RefCntAutoPtr<SamplerNullImpl> pSamplerNull{BindInfo.pObject, IID_Sampler};
+#ifdef DILIGENT_DEVELOPMENT
+    VerifySamplerBinding(m_ResDesc, BindInfo, pSamplerNull.RawPtr(), m_DstRes.pObject, m_Signature.GetDesc().Name);
+#endif
+
+    UpdateCachedResource(std::move(pSamplerNull));
+}
+
+void BindResourceHelper::CacheInputAttachment(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting input attachment to null is handled by BindResourceHelper::operator()");
+    VERIFY(m_DstRes.Type == SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT, "Input attachment resource is expected");
+    RefCntAutoPtr<TextureViewNullImpl> pTexViewNull{BindInfo.pObject, IID_TextureView};
+#ifdef DILIGENT_DEVELOPMENT
+    VerifyResourceViewBinding(m_ResDesc, BindInfo, pTexViewNull.RawPtr(),
+                              {TEXTURE_VIEW_SHADER_RESOURCE},
+                              RESOURCE_DIM_UNDEFINED,
+                              false, // IsMultisample
+                              m_DstRes.pObject.RawPtr(),
+                              m_Signature.GetDesc().Name);
+#endif
+
+    UpdateCachedResource(std::move(pTexViewNull));
+}
+
+void BindResourceHelper::CacheAccelerationStructure(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting acceleration structure to null is handled by BindResourceHelper::operator()");
+    VERIFY(m_DstRes.Type == SHADER_RESOURCE_TYPE_ACCEL_STRUCT, "Acceleration Structure resource is expected");
+    RefCntAutoPtr<TopLevelASNullImpl> pTLASNull{BindInfo.pObject, IID_TopLevelAS};
+#ifdef DILIGENT_DEVELOPMENT
+    VerifyTLASResourceBinding(m_ResDesc, BindInfo, pTLASNull.RawPtr(), m_DstRes.pObject.RawPtr(), m_Signature.GetDesc().Name);
+#endif
+
+    UpdateCachedResource(std::move(pTLASNull));
+}
+
+} // namespace
+
+
+void ShaderVariableManagerNull::BindResource(Uint32 ResIndex, const BindResourceInfo& BindInfo)
+{
+    BindResourceHelper BindHelper{
+        *m_pSignature,
+        m_ResourceCache,
+        ResIndex,
+        BindInfo.ArrayIndex};
+
+    ShaderResourceCacheBase::BindlessUpdateScope BindlessScope{m_ResourceCache, (GetResourceDesc(ResIndex).Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0, 0};
+    BindHelper(BindInfo);
+}
+
+void ShaderVariableManagerNull::SetBufferDynamicOffset(Uint32 ResIndex,
+                                                       Uint32 ArrayIndex,
+                                                       Uint32 BufferDynamicOffset)
+{
+    const auto& Attribs           = m_pSignature->GetResourceAttribs(ResIndex);
+    const auto  DstResCacheOffset = Attribs.CacheOffset(m_ResourceCache.GetContentType()) + ArrayIndex;
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        const auto& ResDesc = m_pSignature->GetResourceDesc(ResIndex);
+        const auto& DstRes  = const_cast<const ShaderResourceCacheNull&>(m_ResourceCache).GetResource(DstResCacheOffset);
+        VerifyDynamicBufferOffset<BufferNullImpl, BufferViewNullImpl>(ResDesc, DstRes.pObject, DstRes.BufferBaseOffset, DstRes.BufferRangeSize, BufferDynamicOffset);
+    }
+#endif
+    m_ResourceCache.SetDynamicBufferOffset(DstResCacheOffset, BufferDynamicOffset);
+}
+
+IDeviceObject* ShaderVariableManagerNull::Get(Uint32 ArrayIndex, Uint32 ResIndex) const
+{
+    const auto&  ResDesc     = GetResourceDesc(ResIndex);
+    const auto&  Attribs     = GetResourceAttribs(ResIndex);
+    const Uint32 CacheOffset = Attribs.CacheOffset(m_ResourceCache.GetContentType());
+
+    VERIFY_EXPR(ArrayIndex < ResDesc.ArraySize);
+
+    if (CacheOffset + ArrayIndex < m_ResourceCache.GetSize())
+    {
+        const auto& CachedRes = const_cast<const ShaderResourceCacheNull&>(m_ResourceCache).GetResource(CacheOffset + ArrayIndex);
+        return CachedRes.pObject.RawPtr<IDeviceObject>();
+    }
+
+    return nullptr;
+}
+
+} // namespace Diligent
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "SwapChainNullImpl.hpp"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+
+namespace Diligent
+{
+
+SwapChainNullImpl::SwapChainNullImpl(IReferenceCounters*    pRefCounters,
+                                     const SwapChainDesc&   SCDesc,
+                                     RenderDeviceNullImpl*  pRenderDeviceNull,
+                                     DeviceContextNullImpl* pDeviceContextNull) :
+    // clang-format off
+    TSwapChainBase
+    {
+        pRefCounters,
+        pRenderDeviceNull,
+        pDeviceContextNull,
+        SCDesc
+    }
+// clang-format on
+{
+    if (m_SwapChainDesc.Width == 0 || m_SwapChainDesc.Height == 0)
+        LOG_ERROR_AND_THROW("Null swap chain is not associated with a window, so its width and height must be specified explicitly");
+
+    if (m_SwapChainDesc.PreTransform == SURFACE_TRANSFORM_OPTIMAL)
+        m_SwapChainDesc.PreTransform = SURFACE_TRANSFORM_IDENTITY;
+
+    CreateBuffers();
+}
+
+SwapChainNullImpl::~SwapChainNullImpl()
+{
+}
+
+void SwapChainNullImpl::CreateBuffers()
+{
+    m_pRenderTargetView.Release();
+    m_pDepthStencilView.Release();
+
+    TextureDesc BackBufferDesc;
+    BackBufferDesc.Name      = "Main back buffer";
+    BackBufferDesc.Type      = RESOURCE_DIM_TEX_2D;
+    BackBufferDesc.Width     = m_SwapChainDesc.Width;
+    BackBufferDesc.Height    = m_SwapChainDesc.Height;
+    BackBufferDesc.Format    = m_SwapChainDesc.ColorBufferFormat;
+    BackBufferDesc.BindFlags = BIND_RENDER_TARGET;
+    if (m_SwapChainDesc.Usage & SWAP_CHAIN_USAGE_SHADER_INPUT)
+        BackBufferDesc.BindFlags |= BIND_SHADER_RESOURCE;
+
+    RefCntAutoPtr<ITexture> pBackBuffer;
+    m_pRenderDevice->CreateTexture(BackBufferDesc, nullptr, &pBackBuffer);
+    if (!pBackBuffer)
+        LOG_ERROR_AND_THROW("Failed to create the back buffer");
+    m_pRenderTargetView = pBackBuffer->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+
+    if (m_SwapChainDesc.DepthBufferFormat != TEX_FORMAT_UNKNOWN)
+    {
+        TextureDesc DepthBufferDesc;
+        DepthBufferDesc.Name      = "Main depth buffer";
+        DepthBufferDesc.Type      = RESOURCE_DIM_TEX_2D;
+        DepthBufferDesc.Width     = m_SwapChainDesc.Width;
+        DepthBufferDesc.Height    = m_SwapChainDesc.Height;
+        DepthBufferDesc.Format    = m_SwapChainDesc.DepthBufferFormat;
+        DepthBufferDesc.BindFlags = BIND_DEPTH_STENCIL;
+
+        RefCntAutoPtr<ITexture> pDepthBuffer;
+        m_pRenderDevice->CreateTexture(DepthBufferDesc, nullptr, &pDepthBuffer);
+        if (!pDepthBuffer)
+            LOG_ERROR_AND_THROW("Failed to create the depth buffer");
+        m_pDepthStencilView = pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+    }
+}
+
+void SwapChainNullImpl::Present(Uint32 SyncInterval)
+{
+    auto pDeviceContext = m_wpDeviceContext.Lock();
+    if (!pDeviceContext)
+    {
+        LOG_ERROR_MESSAGE("Immediate context has been released");
+        return;
+    }
+
+    auto* pImmediateCtxNull = pDeviceContext.RawPtr<DeviceContextNullImpl>();
+    pImmediateCtxNull->Flush();
+
+    if (m_SwapChainDesc.IsPrimary)
+    {
+        pImmediateCtxNull->FinishFrame();
+        m_pRenderDevice.RawPtr<RenderDeviceNullImpl>()->ReleaseStaleResources();
+    }
+}
+
+void SwapChainNullImpl::Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFORM NewPreTransform)
+{
+    if (NewPreTransform == SURFACE_TRANSFORM_OPTIMAL)
+        NewPreTransform = SURFACE_TRANSFORM_IDENTITY;
+
+    if (TSwapChainBase::Resize(NewWidth, NewHeight, NewPreTransform))
+    {
+        m_SwapChainDesc.PreTransform = NewPreTransform;
+
+        if (auto pDeviceContext = m_wpDeviceContext.Lock())
+        {
+            auto* pImmediateCtxNull  = pDeviceContext.RawPtr<DeviceContextNullImpl>();
+            auto* pCurrentBackBuffer = ClassPtrCast<TextureNullImpl>(m_pRenderTargetView->GetTexture());
+            if (pImmediateCtxNull->UnbindTextureFromFramebuffer(pCurrentBackBuffer, false))
+            {
+                LOG_INFO_MESSAGE_ONCE("Resizing the swap chain requires back and depth-stencil buffers to be unbound from the device context. "
+                                      "An application should use SetRenderTargets() to restore them.");
+            }
+            if (m_pDepthStencilView)
+                pImmediateCtxNull->UnbindTextureFromFramebuffer(ClassPtrCast<TextureNullImpl>(m_pDepthStencilView->GetTexture()), false);
+        }
+
+        try
+        {
+            CreateBuffers();
+        }
+        catch (const std::runtime_error&)
+        {
+            LOG_ERROR("Failed to resize the swap chain");
+        }
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "TextureNullImpl.hpp"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+
+#include "GraphicsAccessories.hpp"
+#include "EngineMemory.h"
+
+namespace Diligent
+{
+
+TextureNullImpl::TextureNullImpl(IReferenceCounters*        pRefCounters,
+                                 FixedBlockMemoryAllocator& TexViewObjAllocator,
+                                 RenderDeviceNullImpl*      pDeviceNull,
+                                 const TextureDesc&         TexDesc,
+                                 const TextureData*         pInitData /*= nullptr*/) :
+    // clang-format off
+    TTextureBase
+    {
+        pRefCounters,
+        TexViewObjAllocator,
+        pDeviceNull,
+        TexDesc
+    }
+// clang-format on
+{
+    if (m_Desc.Usage == USAGE_IMMUTABLE && (pInitData == nullptr || pInitData->pSubResources == nullptr))
+        LOG_ERROR_AND_THROW("Immutable textures must be initialized with data at creation time: pInitData can't be null");
+
+    const Uint32 ArraySlices = m_Desc.Type == RESOURCE_DIM_TEX_3D ? 1 : m_Desc.ArraySize;
+    if (pInitData != nullptr && pInitData->pSubResources != nullptr)
+    {
+        const Uint32 ExpectedSubresCount = m_Desc.MipLevels * ArraySlices;
+        if (pInitData->NumSubresources != ExpectedSubresCount)
+        {
+            LOG_ERROR_AND_THROW("Incorrect number of subresources in init data. ", ExpectedSubresCount, " expected, while ",
+                                pInitData->NumSubresources, " provided");
+        }
+    }
+
+    // Only the textures whose contents can be observed by the CPU need memory.
+    // Initial data of other textures is validated, but otherwise ignored.
+    if ((m_Desc.Usage == USAGE_STAGING || m_Desc.Usage == USAGE_DYNAMIC) && pDeviceNull->AllocateResourceMemory())
+    {
+        const auto MemorySize = GetStagingTextureSubresourceOffset(m_Desc, m_Desc.ArraySize, 0, SubresourceAlignment);
+        m_Memory.resize(StaticCast<size_t>(MemorySize));
+
+        if (pInitData != nullptr && pInitData->pSubResources != nullptr)
+        {
+            const auto& FmtAttribs = GetTextureFormatAttribs(m_Desc.Format);
+
+            Uint32 subres = 0;
+            for (Uint32 slice = 0; slice < ArraySlices; ++slice)
+            {
+                for (Uint32 mip = 0; mip < m_Desc.MipLevels; ++mip)
+                {
+                    const auto& SubResData = pInitData->pSubResources[subres++];
+                    const auto  MipProps   = GetMipLevelProperties(m_Desc, mip);
+
+                    const auto DstSubresOffset = GetStagingTextureSubresourceOffset(m_Desc, slice, mip, SubresourceAlignment);
+
+                    CopyTextureSubresource(SubResData,
+                                           MipProps.StorageHeight / FmtAttribs.BlockHeight, // NumRows
+                                           MipProps.Depth,
+                                           MipProps.RowSize,
+                                           m_Memory.data() + DstSubresOffset,
+                                           MipProps.RowSize,       // DstRowStride
+                                           MipProps.DepthSliceSize // DstDepthStride
+                    );
+                }
+            }
+        }
+    }
+
+    if (m_Desc.Usage == USAGE_STAGING)
+    {
+        // Similar to other backends, staging textures permanently stay in the copy state
+        SetState((m_Desc.CPUAccessFlags & CPU_ACCESS_READ) != 0 ? RESOURCE_STATE_COPY_DEST : RESOURCE_STATE_COPY_SOURCE);
+    }
+    else
+    {
+        SetState(RESOURCE_STATE_UNDEFINED);
+    }
+}
+
+TextureNullImpl::~TextureNullImpl()
+{
+}
+
+void TextureNullImpl::CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView)
+{
+    VERIFY(ppView != nullptr, "View pointer address is null");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        auto UpdatedViewDesc = ViewDesc;
+        ValidatedAndCorrectTextureViewDesc(m_Desc, UpdatedViewDesc);
+
+        auto* pDeviceNullImpl  = GetDevice();
+        auto& TexViewAllocator = pDeviceNullImpl->GetTexViewObjAllocator();
+        VERIFY(&TexViewAllocator == &m_dbgTexViewObjAllocator, "Texture view allocator does not match allocator provided during texture initialization");
+
+        auto pViewNull = NEW_RC_OBJ(TexViewAllocator, "TextureViewNullImpl instance", TextureViewNullImpl, bIsDefaultView ? this : nullptr)(pDeviceNullImpl, UpdatedViewDesc, this, bIsDefaultView);
+        VERIFY(pViewNull->GetDesc().ViewType == ViewDesc.ViewType, "Incorrect view type");
+
+        if (bIsDefaultView)
+            *ppView = pViewNull;
+        else
+            pViewNull->QueryInterface(IID_TextureView, reinterpret_cast<IObject**>(ppView));
+    }
+    catch (const std::runtime_error&)
+    {
+        const auto* ViewTypeName = GetTexViewTypeLiteralName(ViewDesc.ViewType);
+        LOG_ERROR("Failed to create view \"", ViewDesc.Name ? ViewDesc.Name : "", "\" (", ViewTypeName, ") for texture \"", m_Desc.Name ? m_Desc.Name : "", "\"");
+    }
+}
+
+} // namespace Diligent
@@ -61,7 +61,8 @@ public:
     virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
 
     /// Implementation of IDeviceContext::Begin() in OpenGL backend.
-    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32             ImmediateContextId,
+                                          COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -79,6 +80,15 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise) override final;
+
+    /// Implementation of IDeviceContext::SetDepthStencilState() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -125,6 +135,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in OpenGL backend.
@@ -349,6 +363,14 @@ private:
     GLObjectWrappers::GLFrameBufferObj m_DefaultFBO;
 
     std::vector<OptimizedClearValue> m_AttachmentClearValues;
+
+    // Scratch arrays reused by MultiDraw() and MultiDrawIndexed() to avoid per-call allocations
+    struct MultiDrawScratch
+    {
+        std::vector<GLsizei>       Counts;
+        std::vector<GLint>         Firsts; // First vertices or base vertices
+        std::vector<GLvoid*>       IndexOffsets;
+    } m_MultiDrawScratch;
 };
 
 } // namespace Diligent
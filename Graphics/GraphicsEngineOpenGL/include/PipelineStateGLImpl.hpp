@@ -77,6 +77,13 @@ public:
 #endif
 
 private:
+    friend TPipelineStateBase;
+
+    // Called by TPipelineStateBase::Construct(). OpenGL backend does not support multithreaded
+    // resource creation, so pipelines are always initialized synchronously.
+    void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo);
+    void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
+
     using TShaderStages = std::vector<ShaderGLImpl*>;
 
     GLObjectWrappers::GLPipelineObj& GetGLProgramPipeline(GLContext::NativeGLContextType Context);
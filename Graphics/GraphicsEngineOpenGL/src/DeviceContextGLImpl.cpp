@@ -79,10 +79,11 @@ DeviceContextGLImpl::DeviceContextGLImpl(IReferenceCounters*      pRefCounters,
 IMPLEMENT_QUERY_INTERFACE(DeviceContextGLImpl, IID_DeviceContextGL, TDeviceContextBase)
 
 
-void DeviceContextGLImpl::Begin(Uint32 ImmediateContextId)
+void DeviceContextGLImpl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     UNEXPECTED("OpenGL does not support deferred contexts");
     (void)(ImmediateContextId);
+    (void)(Flags);
 }
 
 void DeviceContextGLImpl::SetPipelineState(IPipelineState* pPipelineState)
@@ -204,6 +205,23 @@ void DeviceContextGLImpl::SetBlendFactors(const float* pBlendFactors)
     }
 }
 
+// ExtendedDynamicState feature is never enabled by OpenGL backend, so the methods below
+// only validate the calls.
+void DeviceContextGLImpl::SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise)
+{
+    TDeviceContextBase::SetCullMode(CullMode, FrontCounterClockwise, 0);
+}
+
+void DeviceContextGLImpl::SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc)
+{
+    TDeviceContextBase::SetDepthStencilState(DepthStencilDesc, 0);
+}
+
+void DeviceContextGLImpl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    TDeviceContextBase::SetPrimitiveTopology(Topology, 0);
+}
+
 void DeviceContextGLImpl::SetVertexBuffers(Uint32                         StartSlot,
                                            Uint32                         NumBuffersSet,
                                            IBuffer**                      ppBuffers,
@@ -794,26 +812,65 @@ void DeviceContextGLImpl::PostDraw()
     m_CommittedResourcesTentativeBarriers = MEMORY_BARRIER_NONE;
 }
 
-void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
+namespace
 {
-    DvpVerifyDrawArguments(Attribs);
 
-    GLenum GlTopology;
-    PrepareForDraw(Attribs.Flags, false, GlTopology);
+__forceinline void DrawArraysGL(GLenum GlTopology, Uint32 NumVertices, Uint32 StartVertex, Uint32 NumInstances, Uint32 FirstInstance)
+{
+    if (NumInstances > 1 || FirstInstance != 0)
+    {
+        if (FirstInstance != 0)
+            glDrawArraysInstancedBaseInstance(GlTopology, StartVertex, NumVertices, NumInstances, FirstInstance);
+        else
+            glDrawArraysInstanced(GlTopology, StartVertex, NumVertices, NumInstances);
+    }
+    else
+    {
+        glDrawArrays(GlTopology, StartVertex, NumVertices);
+    }
+}
 
-    if (Attribs.NumVertices > 0 && Attribs.NumInstances > 0)
+__forceinline void DrawElementsGL(GLenum GlTopology, Uint32 NumIndices, GLenum GLIndexType, size_t FirstIndexByteOffset, Uint32 BaseVertex, Uint32 NumInstances, Uint32 FirstInstance)
+{
+    auto* pIndices = reinterpret_cast<GLvoid*>(FirstIndexByteOffset);
+    if (NumInstances > 1 || FirstInstance != 0)
     {
-        if (Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0)
+        if (BaseVertex > 0)
         {
-            if (Attribs.FirstInstanceLocation != 0)
-                glDrawArraysInstancedBaseInstance(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+            if (FirstInstance != 0)
+                glDrawElementsInstancedBaseVertexBaseInstance(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, BaseVertex, FirstInstance);
             else
-                glDrawArraysInstanced(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices, Attribs.NumInstances);
+                glDrawElementsInstancedBaseVertex(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, BaseVertex);
         }
         else
         {
-            glDrawArrays(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices);
+            if (FirstInstance != 0)
+                glDrawElementsInstancedBaseInstance(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, FirstInstance);
+            else
+                glDrawElementsInstanced(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances);
         }
+    }
+    else
+    {
+        if (BaseVertex > 0)
+            glDrawElementsBaseVertex(GlTopology, NumIndices, GLIndexType, pIndices, BaseVertex);
+        else
+            glDrawElements(GlTopology, NumIndices, GLIndexType, pIndices);
+    }
+}
+
+} // namespace
+
+void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
+{
+    DvpVerifyDrawArguments(Attribs);
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, false, GlTopology);
+
+    if (Attribs.NumVertices > 0 && Attribs.NumInstances > 0)
+    {
+        DrawArraysGL(GlTopology, Attribs.NumVertices, Attribs.StartVertexLocation, Attribs.NumInstances, Attribs.FirstInstanceLocation);
         DEV_CHECK_GL_ERROR("OpenGL draw command failed");
     }
 
@@ -837,31 +894,107 @@ void DeviceContextGLImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 
     if (Attribs.NumIndices > 0 && Attribs.NumInstances > 0)
     {
-        if (Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0)
+        DrawElementsGL(GlTopology, Attribs.NumIndices, GLIndexType, FirstIndexByteOffset, Attribs.BaseVertex, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+        DEV_CHECK_GL_ERROR("OpenGL draw command failed");
+    }
+
+    PostDraw();
+}
+
+void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, false, GlTopology);
+
+    if (Attribs.DrawCount > 0 && Attribs.NumInstances > 0)
+    {
+        // There is no instanced version of glMultiDrawArrays
+        bool NativeMultiDrawExecuted = false;
+#if GL_ARB_draw_elements_base_vertex
+        if (Attribs.NumInstances == 1 && Attribs.FirstInstanceLocation == 0 && m_pDevice->GetFeatures().NativeMultiDraw)
         {
-            if (Attribs.BaseVertex > 0)
+            auto& Counts = m_MultiDrawScratch.Counts;
+            auto& Firsts = m_MultiDrawScratch.Firsts;
+            Counts.resize(Attribs.DrawCount);
+            Firsts.resize(Attribs.DrawCount);
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
             {
-                if (Attribs.FirstInstanceLocation != 0)
-                    glDrawElementsInstancedBaseVertexBaseInstance(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.BaseVertex, Attribs.FirstInstanceLocation);
-                else
-                    glDrawElementsInstancedBaseVertex(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.BaseVertex);
+                Counts[i] = static_cast<GLsizei>(Attribs.pDrawItems[i].NumVertices);
+                Firsts[i] = static_cast<GLint>(Attribs.pDrawItems[i].StartVertexLocation);
             }
-            else
+            glMultiDrawArrays(GlTopology, Firsts.data(), Counts.data(), static_cast<GLsizei>(Attribs.DrawCount));
+            DEV_CHECK_GL_ERROR("glMultiDrawArrays() failed");
+            NativeMultiDrawExecuted = true;
+        }
+#endif
+
+        if (!NativeMultiDrawExecuted)
+        {
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
             {
-                if (Attribs.FirstInstanceLocation != 0)
-                    glDrawElementsInstancedBaseInstance(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.FirstInstanceLocation);
-                else
-                    glDrawElementsInstanced(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances);
+                const auto& Item = Attribs.pDrawItems[i];
+                if (Item.NumVertices > 0)
+                    DrawArraysGL(GlTopology, Item.NumVertices, Item.StartVertexLocation, Attribs.NumInstances, Attribs.FirstInstanceLocation);
             }
+            DEV_CHECK_GL_ERROR("OpenGL draw command failed");
         }
-        else
+    }
+
+    PostDraw();
+}
+
+void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, true, GlTopology);
+    GLenum GLIndexType;
+    size_t IndexDataByteOffset;
+    PrepareForIndexedDraw(Attribs.IndexType, 0, GLIndexType, IndexDataByteOffset);
+    const auto IndexSize = GetValueSize(Attribs.IndexType);
+
+    if (Attribs.DrawCount > 0 && Attribs.NumInstances > 0)
+    {
+        // There is no instanced version of glMultiDrawElementsBaseVertex
+        bool NativeMultiDrawExecuted = false;
+#if GL_ARB_draw_elements_base_vertex
+        if (Attribs.NumInstances == 1 && Attribs.FirstInstanceLocation == 0 && m_pDevice->GetFeatures().NativeMultiDraw)
         {
-            if (Attribs.BaseVertex > 0)
-                glDrawElementsBaseVertex(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.BaseVertex);
-            else
-                glDrawElements(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)));
+            auto& Counts       = m_MultiDrawScratch.Counts;
+            auto& BaseVertices = m_MultiDrawScratch.Firsts;
+            auto& IndexOffsets = m_MultiDrawScratch.IndexOffsets;
+            Counts.resize(Attribs.DrawCount);
+            BaseVertices.resize(Attribs.DrawCount);
+            IndexOffsets.resize(Attribs.DrawCount);
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+            {
+                const auto& Item = Attribs.pDrawItems[i];
+                Counts[i]        = static_cast<GLsizei>(Item.NumIndices);
+                BaseVertices[i]  = static_cast<GLint>(Item.BaseVertex);
+                IndexOffsets[i]  = reinterpret_cast<GLvoid*>(IndexDataByteOffset + size_t{IndexSize} * Item.FirstIndexLocation);
+            }
+            glMultiDrawElementsBaseVertex(GlTopology, Counts.data(), GLIndexType, IndexOffsets.data(), static_cast<GLsizei>(Attribs.DrawCount), BaseVertices.data());
+            DEV_CHECK_GL_ERROR("glMultiDrawElementsBaseVertex() failed");
+            NativeMultiDrawExecuted = true;
+        }
+#endif
+
+        if (!NativeMultiDrawExecuted)
+        {
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+            {
+                const auto& Item = Attribs.pDrawItems[i];
+                if (Item.NumIndices > 0)
+                {
+                    DrawElementsGL(GlTopology, Item.NumIndices, GLIndexType, IndexDataByteOffset + size_t{IndexSize} * Item.FirstIndexLocation,
+                                   Item.BaseVertex, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+                }
+            }
+            DEV_CHECK_GL_ERROR("OpenGL draw command failed");
         }
-        DEV_CHECK_GL_ERROR("OpenGL draw command failed");
     }
 
     PostDraw();
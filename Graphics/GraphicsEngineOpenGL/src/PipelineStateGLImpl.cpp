@@ -296,25 +296,7 @@ PipelineStateGLImpl::PipelineStateGLImpl(IReferenceCounters*
 {
     try
     {
-        TShaderStages Shaders;
-        ExtractShaders<ShaderGLImpl>(CreateInfo, Shaders);
-
-        RefCntAutoPtr<ShaderGLImpl> pTempPS;
-        if (CreateInfo.pPS == nullptr)
-        {
-            // Some OpenGL implementations fail if fragment shader is not present, so
-            // create a dummy one.
-            ShaderCreateInfo ShaderCI;
-            ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
-            ShaderCI.Source          = "void main(){}";
-            ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
-            ShaderCI.Desc.Name       = "Dummy fragment shader";
-            pDeviceGL->CreateShader(ShaderCI, pTempPS.DblPtr<IShader>());
-
-            Shaders.emplace_back(pTempPS);
-        }
-
-        InitInternalObjects(CreateInfo, Shaders);
+        Construct(CreateInfo);
     }
     catch (...)
     {
@@ -339,10 +321,7 @@ PipelineStateGLImpl::PipelineStateGLImpl(IReferenceCounters*                   p
 {
     try
     {
-        TShaderStages Shaders;
-        ExtractShaders<ShaderGLImpl>(CreateInfo, Shaders);
-
-        InitInternalObjects(CreateInfo, Shaders);
+        Construct(CreateInfo);
     }
     catch (...)
     {
@@ -351,8 +330,40 @@ PipelineStateGLImpl::PipelineStateGLImpl(IReferenceCounters*                   p
     }
 }
 
+void PipelineStateGLImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
+{
+    TShaderStages Shaders;
+    ExtractShaders<ShaderGLImpl>(CreateInfo, Shaders);
+
+    RefCntAutoPtr<ShaderGLImpl> pTempPS;
+    if (CreateInfo.pPS == nullptr)
+    {
+        // Some OpenGL implementations fail if fragment shader is not present, so
+        // create a dummy one.
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
+        ShaderCI.Source          = "void main(){}";
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.Desc.Name       = "Dummy fragment shader";
+        GetDevice()->CreateShader(ShaderCI, pTempPS.DblPtr<IShader>());
+
+        Shaders.emplace_back(pTempPS);
+    }
+
+    InitInternalObjects(CreateInfo, Shaders);
+}
+
+void PipelineStateGLImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
+{
+    TShaderStages Shaders;
+    ExtractShaders<ShaderGLImpl>(CreateInfo, Shaders);
+
+    InitInternalObjects(CreateInfo, Shaders);
+}
+
 PipelineStateGLImpl::~PipelineStateGLImpl()
 {
+    WaitForAsyncInitialization();
     Destruct();
 }
 
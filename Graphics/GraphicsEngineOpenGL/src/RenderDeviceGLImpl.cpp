@@ -708,6 +708,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             const bool IsGL42OrAbove = GLVersion >= Version{4, 2};
             const bool IsGL41OrAbove = GLVersion >= Version{4, 1};
             const bool IsGL40OrAbove = GLVersion >= Version{4, 0};
+            const bool IsGL32OrAbove = GLVersion >= Version{3, 2};
 
             // Separable programs may be disabled
             Features.SeparablePrograms = DEVICE_FEATURE_STATE_OPTIONAL;
@@ -738,6 +739,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             ENABLE_FEATURE(ShaderInt8,                    CheckExtension("GL_EXT_shader_explicit_arithmetic_types_int8"));
             ENABLE_FEATURE(ResourceBuffer8BitAccess,      CheckExtension("GL_EXT_shader_8bit_storage"));
             ENABLE_FEATURE(UniformBuffer8BitAccess,       CheckExtension("GL_EXT_shader_8bit_storage"));
+            ENABLE_FEATURE(NativeMultiDraw,               IsGL32OrAbove || CheckExtension("GL_ARB_draw_elements_base_vertex"));
             // clang-format on
 
             TexProps.MaxTexture1DDimension     = MaxTextureSize;
@@ -807,6 +809,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             ENABLE_FEATURE(ShaderInt8,                strstr(Extensions, "shader_explicit_arithmetic_types_int8"));
             ENABLE_FEATURE(ResourceBuffer8BitAccess,  strstr(Extensions, "shader_8bit_storage"));
             ENABLE_FEATURE(UniformBuffer8BitAccess,   strstr(Extensions, "shader_8bit_storage"));
+            ENABLE_FEATURE(NativeMultiDraw,           false); // glMultiDrawElementsBaseVertex is not available in GLES
             // clang-format on
 
             TexProps.MaxTexture1DDimension     = 0; // Not supported in GLES 3.2
@@ -965,7 +968,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
     }
 
 #if defined(_MSC_VER) && defined(_WIN64)
-    static_assert(sizeof(DeviceFeatures) == 38, "Did you add a new feature to DeviceFeatures? Please handle its satus here.");
+    static_assert(sizeof(DeviceFeatures) == 40, "Did you add a new feature to DeviceFeatures? Please handle its satus here.");
 #endif
 }
 
@@ -30,6 +30,8 @@
 /// \file
 /// Declaration of Diligent::BufferVkImpl class
 
+#include <atomic>
+
 #include "EngineVkImplTraits.hpp"
 #include "BufferBase.hpp"
 #include "BufferViewVkImpl.hpp" // Required by BufferBase
@@ -123,6 +125,16 @@ public:
         return reinterpret_cast<Uint8*>(m_MemoryAllocation.Page->GetCPUMemory()) + m_BufferMemoryAlignedOffset;
     }
 
+    /// Returns true if the buffer may be moved to another memory page by the defragmentation pass.
+    bool IsRelocatable() const { return m_IsRelocatable.load(); }
+
+    /// Permanently excludes the buffer from the defragmentation pass.
+    /// Called when the buffer is referenced by a deferred context as the command list may be
+    /// executed or, if it is reusable, replayed after the buffer has been moved.
+    void DisableRelocation();
+
+    const VulkanUtilities::VulkanMemoryPage* GetMemoryPage() const { return m_MemoryAllocation.Page; }
+
 private:
     friend class DeviceContextVkImpl;
 
@@ -130,8 +142,21 @@ private:
 
     VulkanUtilities::BufferViewWrapper CreateView(struct BufferViewDesc& ViewDesc);
 
-    Uint32       m_DynamicOffsetAlignment    = 0;
-    VkDeviceSize m_BufferMemoryAlignedOffset = 0;
+    // Creates a new Vulkan buffer with the same properties and binds it to memory in a page
+    // that is denser than the current one. Returns false if there is no suitable space.
+    bool CreateRelocatedBuffer(VulkanUtilities::BufferWrapper&          NewBuffer,
+                               VulkanUtilities::VulkanMemoryAllocation& NewAllocation,
+                               VkDeviceSize&                            NewAlignedOffset) const;
+
+    // Replaces the Vulkan buffer and its memory with the new ones after the contents have been
+    // copied. The old objects are released through the release queue.
+    void CompleteRelocation(VulkanUtilities::BufferWrapper&&          NewBuffer,
+                            VulkanUtilities::VulkanMemoryAllocation&& NewAllocation,
+                            VkDeviceSize                              NewAlignedOffset);
+
+    Uint32            m_DynamicOffsetAlignment    = 0;
+    VkDeviceSize      m_BufferMemoryAlignedOffset = 0;
+    std::atomic<bool> m_IsRelocatable{false};
 
     // TODO (assiduous): move dynamic allocations to device context.
     static constexpr size_t CacheLineSize = 64;
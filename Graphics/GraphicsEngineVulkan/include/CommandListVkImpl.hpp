@@ -30,9 +30,15 @@
 /// \file
 /// Declaration of Diligent::CommandListVkImpl class
 
+#include <memory>
+#include <vector>
+
 #include "EngineVkImplTraits.hpp"
 #include "VulkanUtilities/VulkanHeaders.h"
 #include "CommandListBase.hpp"
+#include "VulkanUploadHeap.hpp"
+#include "VulkanDynamicHeap.hpp"
+#include "DescriptorPoolManager.hpp"
 
 namespace Diligent
 {
@@ -43,33 +49,85 @@ class CommandListVkImpl final : public CommandListBase<EngineVkImplTraits>
 public:
     using TCommandListBase = CommandListBase<EngineVkImplTraits>;
 
-    CommandListVkImpl(IReferenceCounters*  pRefCounters,
-                      RenderDeviceVkImpl*  pDevice,
-                      DeviceContextVkImpl* pDeferredCtx,
-                      VkCommandBuffer      vkCmdBuff) :
+    // Memory that a reusable command list references after the end of the frame in which it was recorded.
+    // The memory is released through the release queue of the immediate context when the command list is destroyed.
+    struct ReusableResources
+    {
+        SoftwareQueueIndex CmdQueue{0};
+
+        // Fence value of the last submission of the command list
+        Uint64 LastSubmittedFenceValue = 0;
+
+        std::vector<VulkanUploadHeap::UploadPageInfo>       UploadPages;
+        std::vector<VulkanDynamicHeap::MasterBlock>         DynamicMasterBlocks;
+        std::vector<VulkanUtilities::DescriptorPoolWrapper> DynamicDescriptorPools;
+    };
+
+    // For secondary command lists, vkRenderPass and SubpassIndex identify the
+    // subpass of the render pass the command list continues.
+    // pReusableRes is only provided for command lists recorded with COMMAND_LIST_FLAG_REUSABLE flag.
+    CommandListVkImpl(IReferenceCounters*                pRefCounters,
+                      RenderDeviceVkImpl*                pDevice,
+                      DeviceContextVkImpl*               pDeferredCtx,
+                      VkCommandBuffer                    vkCmdBuff,
+                      VkRenderPass                       vkRenderPass = VK_NULL_HANDLE,
+                      Uint32                             SubpassIndex = 0,
+                      std::unique_ptr<ReusableResources> pReusableRes = nullptr) :
         // clang-format off
         TCommandListBase {pRefCounters, pDevice, pDeferredCtx},
-        m_pDeferredCtx   {pDeferredCtx},
-        m_vkCmdBuff      {vkCmdBuff   }
+        m_pDeferredCtx   {pDeferredCtx           },
+        m_vkCmdBuff      {vkCmdBuff              },
+        m_vkRenderPass   {vkRenderPass           },
+        m_SubpassIndex   {SubpassIndex           },
+        m_pReusableRes   {std::move(pReusableRes)}
     // clang-format on
     {
     }
 
-    ~CommandListVkImpl()
-    {
-        VERIFY(m_vkCmdBuff == VK_NULL_HANDLE && !m_pDeferredCtx, "Destroying command list that was never executed");
-    }
+    ~CommandListVkImpl();
 
     void Close(RefCntAutoPtr<IDeviceContext>& outDeferredCtx, VkCommandBuffer& outVkCmdBuff)
     {
+        VERIFY(!IsReusable(), "Reusable command lists keep their command buffers until they are destroyed");
         outVkCmdBuff   = m_vkCmdBuff;
         outDeferredCtx = std::move(m_pDeferredCtx);
         m_vkCmdBuff    = VK_NULL_HANDLE;
     }
 
+    bool IsSecondary() const { return m_vkRenderPass != VK_NULL_HANDLE; }
+    bool IsReusable() const { return m_pReusableRes != nullptr; }
+
+    VkRenderPass GetVkRenderPass() const { return m_vkRenderPass; }
+    Uint32       GetSubpassIndex() const { return m_SubpassIndex; }
+
+    VkCommandBuffer GetReusableVkCmdBuffer() const
+    {
+        VERIFY_EXPR(IsReusable());
+        return m_vkCmdBuff;
+    }
+
+    SoftwareQueueIndex GetReusableCmdQueue() const
+    {
+        VERIFY_EXPR(IsReusable());
+        return m_pReusableRes->CmdQueue;
+    }
+
+    // Records the fence value that will be signaled when the submission of the reusable command list is complete.
+    void OnReusableCmdBufferSubmitted(Uint64 FenceValue)
+    {
+        VERIFY_EXPR(IsReusable());
+        VERIFY_EXPR(FenceValue >= m_pReusableRes->LastSubmittedFenceValue);
+        m_pReusableRes->LastSubmittedFenceValue = FenceValue;
+    }
+
 private:
     RefCntAutoPtr<IDeviceContext> m_pDeferredCtx;
     VkCommandBuffer               m_vkCmdBuff;
+
+    const VkRenderPass m_vkRenderPass;
+    const Uint32       m_SubpassIndex;
+
+    std::unique_ptr<ReusableResources> m_pReusableRes;
 };
 
 } // namespace Diligent
@@ -139,6 +139,15 @@ public:
     /// Implementation of ICommandQueueVk::EnqueueSignal().
     virtual void DILIGENT_CALL_TYPE EnqueueSignal(VkSemaphore vkTimelineSemaphore, Uint64 Value) override final;
 
+    /// Implementation of ICommandQueueVk::EnqueueSubmit().
+    virtual Uint64 DILIGENT_CALL_TYPE EnqueueSubmit(const VkSubmitInfo& SubmitInfo) override final;
+
+    /// Implementation of ICommandQueueVk::FlushPendingSubmits().
+    virtual void DILIGENT_CALL_TYPE FlushPendingSubmits() override final;
+
+    /// Implementation of ICommandQueueVk::GetSubmitStats().
+    virtual QueueSubmitStatsVk DILIGENT_CALL_TYPE GetSubmitStats() const override final;
+
     void SetFence(RefCntAutoPtr<FenceVkImpl> pFence)
     {
         VERIFY_EXPR(pFence->GetDesc().Type == FENCE_TYPE_CPU_WAIT_ONLY);
@@ -146,17 +155,26 @@ public:
         m_pFence = std::move(pFence);
     }
 
-    SyncPointVkPtr GetLastSyncPoint()
-    {
-        ThreadingTools::LockHelper Lock{m_LastSyncPointGuard};
-        return m_LastSyncPoint;
-    }
+    // Submits the pending batch, if any, and returns the sync point of the last submission,
+    // so that the sync point covers all work enqueued to the queue.
+    SyncPointVkPtr GetLastSyncPoint();
 
 private:
     SyncPointVkPtr CreateSyncPoint(Uint64 dbgValue);
 
     void InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore, Uint64 Value);
 
+    // Copies the submit info and all arrays it references to the end of the pending batch.
+    void AddPendingSubmit(const VkSubmitInfo& SubmitInfo);
+
+    // Submits the pending batch with a single vkQueueSubmit call and associates
+    // the new sync point with FenceValue. Must be called with m_QueueMutex locked.
+    void SubmitPendingBatch(Uint64 FenceValue);
+
+    // Submits work batches with a single vkQueueSubmit call and associates the sync point
+    // with FenceValue. Must be called with m_QueueMutex locked.
+    void SubmitToVkQueue(const VkSubmitInfo* pSubmits, Uint32 SubmitCount, SyncPointVkPtr NewSyncPoint, Uint64 FenceValue);
+
     std::shared_ptr<VulkanUtilities::VulkanLogicalDevice> m_LogicalDevice;
 
     const VkQueue            m_VkQueue;
@@ -180,6 +198,33 @@ private:
     // Array used to merge semaphores from SubmitInfo and from SyncPointVk
     std::vector<VkSemaphore> m_TempSignalSemaphores;
 
+    // A work batch added by EnqueueSubmit() that has not been submitted to the queue yet.
+    // All arrays are owned by the batch.
+    struct PendingSubmit
+    {
+        std::vector<VkSemaphore>          WaitSemaphores;
+        std::vector<VkPipelineStageFlags> WaitDstStageMasks;
+        std::vector<Uint64>               WaitSemaphoreValues;
+        std::vector<VkCommandBuffer>      CmdBuffers;
+        std::vector<VkSemaphore>          SignalSemaphores;
+        std::vector<Uint64>               SignalSemaphoreValues;
+        bool                              UseTimelineSemaphores = false;
+    };
+    // Elements past m_NumPendingSubmits are kept to reuse the memory of their arrays.
+    std::vector<PendingSubmit> m_PendingSubmits;
+    size_t                     m_NumPendingSubmits = 0;
+
+    // The largest fence value associated with a pending work batch
+    Uint64 m_LastPendingFenceValue = 0;
+
+    // Arrays used to build the submit infos for the pending batch
+    std::vector<VkSubmitInfo>                  m_TempSubmitInfos;
+    std::vector<VkTimelineSemaphoreSubmitInfo> m_TempTimelineSubmitInfos;
+
+    std::atomic<Uint64> m_NumSubmissions{0};
+    std::atomic<Uint64> m_NumBatchedSubmissions{0};
+    std::atomic<Uint64> m_NumQueueSubmitCalls{0};
+
     // Protects access to the m_LastSyncPoint
     ThreadingTools::LockFlag m_LastSyncPointGuard;
 
@@ -138,7 +138,8 @@ public:
                           std::string                       PoolName,
                           std::vector<VkDescriptorPoolSize> PoolSizes,
                           uint32_t                          MaxSets,
-                          bool                              AllowFreeing) noexcept;
+                          bool                              AllowFreeing,
+                          bool                              UpdateAfterBind = false) noexcept;
     ~DescriptorPoolManager();
 
     DescriptorPoolManager             (const DescriptorPoolManager&) = delete;
@@ -169,6 +170,8 @@ protected:
     const std::vector<VkDescriptorPoolSize> m_PoolSizes;
     const uint32_t                          m_MaxSets;
     const bool                              m_AllowFreeing;
+    // Pools are created with VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT
+    const bool m_UpdateAfterBind;
 
     std::mutex                                         m_Mutex;
     std::deque<VulkanUtilities::DescriptorPoolWrapper> m_Pools;
@@ -192,7 +195,8 @@ public:
                            std::string                       PoolName,
                            std::vector<VkDescriptorPoolSize> PoolSizes,
                            uint32_t                          MaxSets,
-                           bool                              AllowFreeing) noexcept :
+                           bool                              AllowFreeing,
+                           bool                              UpdateAfterBind = false) noexcept :
         // clang-format off
         DescriptorPoolManager
         {
@@ -200,7 +204,8 @@ public:
             std::move(PoolName),
             std::move(PoolSizes),
             MaxSets,
-            AllowFreeing
+            AllowFreeing,
+            UpdateAfterBind
         }
     // clang-format on
     {
@@ -268,6 +273,9 @@ public:
     // be destroyed before the pools are actually returned to the global pool manager.
     void ReleasePools(Uint64 QueueMask);
 
+    // Moves all allocated pools to Pools. The caller becomes responsible for disposing the pools.
+    void ExtractPools(std::vector<VulkanUtilities::DescriptorPoolWrapper>& Pools);
+
     size_t GetAllocatedPoolCount() const { return m_AllocatedPools.size(); }
 
 private:
@@ -79,7 +79,8 @@ public:
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceContextVk, TDeviceContextBase)
 
     /// Implementation of IDeviceContext::Begin() in Vulkan backend.
-    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32             ImmediateContextId,
+                                          COMMAND_LIST_FLAGS Flags) override final;
 
     /// Implementation of IDeviceContext::SetPipelineState() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
@@ -98,6 +99,15 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetCullMode() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise) override final;
+
+    /// Implementation of IDeviceContext::SetDepthStencilState() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc) override final;
+
+    /// Implementation of IDeviceContext::SetPrimitiveTopology() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -143,6 +153,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Vulkan backend.
@@ -320,6 +334,15 @@ public:
     /// Implementation of IDeviceContextVk::GetVkCommandBuffer().
     virtual VkCommandBuffer DILIGENT_CALL_TYPE GetVkCommandBuffer() override final;
 
+    /// Implementation of IDeviceContextVk::DefragmentMemory().
+    virtual void DILIGENT_CALL_TYPE DefragmentMemory(Uint64 MaxBytesToMove, MemoryDefragmentationStatsVk* pStats) override final;
+
+    /// Implementation of IDeviceContextVk::BeginRenderPassWithSecondaryCommandLists().
+    virtual void DILIGENT_CALL_TYPE BeginRenderPassWithSecondaryCommandLists(const BeginRenderPassAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContextVk::BeginSecondaryCommandList().
+    virtual void DILIGENT_CALL_TYPE BeginSecondaryCommandList(IDeviceContext* pImmediateContext) override final;
+
     // Transitions BLAS state from OldState to NewState, and optionally updates internal state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal BLAS state is used as old state.
     void TransitionBLASState(BottomLevelASVkImpl& BLAS,
@@ -405,16 +428,26 @@ public:
 
     QueryManagerVk* GetQueryManager() { return m_pQueryMgr; }
 
+    // Returns the command buffer allocated by this context to the pool once the GPU is done with it.
+    // It is OK to call this method from another thread.
+    void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue, VkCommandBufferLevel Level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
 private:
     void               TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
     __forceinline void CommitRenderPassAndFramebuffer(bool VerifyStates);
     void               CommitVkVertexBuffers();
     void               CommitViewports();
     void               CommitScissorRects();
+    void               CommitExtendedDynamicState(bool CommitTopology);
 
     void Flush(Uint32               NumCommandLists,
                ICommandList* const* ppCommandLists);
 
+    void ExecuteSecondaryCommandLists(Uint32               NumCommandLists,
+                                      ICommandList* const* ppCommandLists);
+
+    void BeginRenderPass(const BeginRenderPassAttribs& Attribs, VkSubpassContents Contents);
+
     __forceinline void TransitionOrVerifyBufferState(BufferVkImpl&                  Buffer,
                                                      RESOURCE_STATE_TRANSITION_MODE TransitionMode,
                                                      RESOURCE_STATE                 RequiredState,
@@ -437,6 +470,9 @@ private:
                                                    RESOURCE_STATE                 RequiredState,
                                                    const char*                    OperationName);
 
+    // Moves the buffer to a denser memory page. Returns false if there is no suitable space.
+    bool RelocateBuffer(BufferVkImpl& BufferVk);
+
     __forceinline void EnsureVkCmdBuffer()
     {
         VERIFY_EXPR(m_CmdPool != nullptr);
@@ -446,12 +482,15 @@ private:
         m_State.NumCommands = m_State.NumCommands != 0 ? m_State.NumCommands : 1;
         if (m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE)
         {
-            auto vkCmdBuff = m_CmdPool->GetCommandBuffer();
+            // Reusable command lists may be submitted again while previous submissions are pending
+            auto vkCmdBuff = m_CmdPool->GetCommandBuffer("", nullptr,
+                                                         m_RecordingReusableCmdList ?
+                                                             VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT :
+                                                             VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
             m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask());
         }
     }
 
-    inline void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue);
     inline void DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue);
 
     void CopyBufferToTexture(VkBuffer                       vkSrcBuffer,
@@ -485,6 +524,7 @@ private:
     void PrepareCommandPool(SoftwareQueueIndex CommandQueueId);
 
     void ChooseRenderPassAndFramebuffer();
+    void BeginDynamicRendering();
 
     VulkanUtilities::VulkanCommandBuffer m_CommandBuffer;
 
@@ -559,6 +599,23 @@ private:
     /// This framebuffer may or may not be currently set in the command buffer
     VkFramebuffer m_vkFramebuffer = VK_NULL_HANDLE;
 
+    /// Whether currently bound render targets are rendered using dynamic rendering (VK_KHR_dynamic_rendering).
+    /// In this case, m_vkRenderPass and m_vkFramebuffer are null.
+    bool m_UseDynamicRendering = false;
+
+    /// Contents of the subpasses of the active render pass. If VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS,
+    /// the render pass was begun by BeginRenderPassWithSecondaryCommandLists().
+    VkSubpassContents m_vkSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
+
+    /// Whether the deferred context records a secondary command list started by BeginSecondaryCommandList().
+    bool m_RecordingSecondaryCmdList = false;
+
+    /// Whether the deferred context records a command list begun with COMMAND_LIST_FLAG_REUSABLE flag.
+    bool m_RecordingReusableCmdList = false;
+
+    /// Secondary command buffers executed by this immediate context that will be disposed after the next submission.
+    std::vector<std::pair<RefCntAutoPtr<IDeviceContext>, VkCommandBuffer>> m_PendingSecondaryCmdBuffs;
+
     FixedBlockMemoryAllocator m_CmdListAllocator;
 
     // Semaphores are not owned by the command context
@@ -624,6 +681,10 @@ private:
 
     std::vector<VkClearValue> m_vkClearValues;
 
+    // Scratch arrays reused by MultiDraw() and MultiDrawIndexed() to avoid per-call allocations
+    std::vector<VkMultiDrawInfoEXT>        m_vkMultiDrawInfos;
+    std::vector<VkMultiDrawIndexedInfoEXT> m_vkMultiDrawIndexedInfos;
+
     VulkanUtilities::QueryPoolWrapper m_ASQueryPool;
 };
 
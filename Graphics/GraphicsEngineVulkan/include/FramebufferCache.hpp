@@ -76,6 +76,16 @@ public:
     void          OnDestroyImageView(VkImageView ImgView);
     void          OnDestroyRenderPass(VkRenderPass Pass);
 
+    struct Statistics
+    {
+        /// The number of times an existing framebuffer was found in the cache.
+        Uint32 HitCount = 0;
+
+        /// The number of framebuffers created by the cache.
+        Uint32 CreationCount = 0;
+    };
+    Statistics GetStatistics();
+
 private:
     RenderDeviceVkImpl& m_DeviceVk;
 
@@ -92,6 +102,8 @@ private:
 
     std::unordered_multimap<VkImageView, FramebufferCacheKey>  m_ViewToKeyMap;
     std::unordered_multimap<VkRenderPass, FramebufferCacheKey> m_RenderPassToKeyMap;
+
+    Statistics m_Stats;
 };
 
 } // namespace Diligent
@@ -30,15 +30,64 @@
 /// \file
 /// Implementation of mipmap generation routines
 
+#include <array>
+#include <mutex>
+
+#include "Texture.h"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
 namespace Diligent
 {
 
+class RenderDeviceVkImpl;
 class TextureViewVkImpl;
 class DeviceContextVkImpl;
 
-namespace GenerateMipsVkHelper
+// Generates mipmaps in Vulkan backend.
+//
+// Textures that are created with BIND_UNORDERED_ACCESS flag and whose format can be used as a storage image
+// are processed by a compute shader that computes up to 12 mip levels of every array slice in a single dispatch:
+// every work group reduces a 64x64 tile of the source mip to a single texel in shared memory, and the last
+// work group to finish processing the slice reduces the 6th mip level further.
+// All other textures are processed by a chain of vkCmdBlitImage commands.
+class GenerateMipsVkHelper
 {
-void GenerateMips(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx);
-}
+public:
+    static constexpr Uint32 MaxMipsPerDispatch = 12;
+
+    GenerateMipsVkHelper(RenderDeviceVkImpl& DeviceVk);
+
+    // clang-format off
+    GenerateMipsVkHelper             (const GenerateMipsVkHelper&) = delete;
+    GenerateMipsVkHelper             (GenerateMipsVkHelper&&)      = delete;
+    GenerateMipsVkHelper& operator = (const GenerateMipsVkHelper&) = delete;
+    GenerateMipsVkHelper& operator = (GenerateMipsVkHelper&&)      = delete;
+    // clang-format on
+
+    // Returns true if mipmaps of the texture can be generated by the compute shader.
+    // The texture must be created with VK_IMAGE_USAGE_STORAGE_BIT, and the views that
+    // allow mipmap generation must provide per-mip storage views, see TextureViewVkImpl::GetMipLevelView().
+    bool IsComputeSupported(const TextureDesc& TexDesc);
+
+    void GenerateMips(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx);
+
+private:
+    VkPipeline GetComputePipeline(TEXTURE_FORMAT Format);
+
+    void GenerateMipsCS(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx, VkPipeline vkPipeline);
+    void GenerateMipsBlit(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx);
+
+    RenderDeviceVkImpl& m_DeviceVk;
+
+    std::mutex m_PipelinesMtx;
+
+    VulkanUtilities::DescriptorSetLayoutWrapper m_SetLayout;
+    VulkanUtilities::PipelineLayoutWrapper      m_PipelineLayout;
+
+    // Compute pipelines for every texture format, created on first use. Null pipeline of an initialized
+    // format indicates that the pipeline failed to compile, in which case blits are used instead.
+    std::array<VulkanUtilities::PipelineWrapper, TEX_FORMAT_NUM_FORMATS> m_Pipelines;
+    std::array<bool, TEX_FORMAT_NUM_FORMATS>                             m_PipelineInitialized = {};
+};
 
 } // namespace Diligent
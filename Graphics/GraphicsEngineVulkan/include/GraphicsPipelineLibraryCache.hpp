@@ -0,0 +1,260 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GraphicsPipelineLibraryCache class
+
+#include <array>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+#include <vector>
+
+#include "GraphicsTypes.h"
+#include "PipelineState.h"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+
+// Graphics pipeline library cache keeps the parts of graphics pipelines that were compiled
+// separately using VK_EXT_graphics_pipeline_library. New pipelines that share parts with the
+// previously created ones only need to compile the missing parts and link them together,
+// which is much faster than creating a monolithic pipeline.
+// The cache keeps at most MaxLibrariesPerPart libraries for every part and evicts the least
+// recently used ones.
+class GraphicsPipelineLibraryCache
+{
+public:
+    static constexpr size_t DefaultMaxLibrariesPerPart = 1024;
+
+    GraphicsPipelineLibraryCache(RenderDeviceVkImpl& DeviceVk, size_t MaxLibrariesPerPart = DefaultMaxLibrariesPerPart) noexcept :
+        m_DeviceVk{DeviceVk},
+        m_MaxLibrariesPerPart{MaxLibrariesPerPart}
+    {}
+
+    // clang-format off
+    GraphicsPipelineLibraryCache             (const GraphicsPipelineLibraryCache&) = delete;
+    GraphicsPipelineLibraryCache             (GraphicsPipelineLibraryCache&&)      = delete;
+    GraphicsPipelineLibraryCache& operator = (const GraphicsPipelineLibraryCache&) = delete;
+    GraphicsPipelineLibraryCache& operator = (GraphicsPipelineLibraryCache&&)      = delete;
+    // clang-format on
+
+    // Graphics pipeline parts that are compiled separately
+    enum PIPELINE_PART : Uint32
+    {
+        PIPELINE_PART_VERTEX_INPUT_INTERFACE = 0,
+        PIPELINE_PART_PRE_RASTERIZATION_SHADERS,
+        PIPELINE_PART_FRAGMENT_SHADER,
+        PIPELINE_PART_FRAGMENT_OUTPUT_INTERFACE,
+        PIPELINE_PART_COUNT
+    };
+
+    // Shader stage compiled into a library
+    struct ShaderKey
+    {
+        SHADER_TYPE           Type = SHADER_TYPE_UNKNOWN;
+        std::vector<uint32_t> SPIRV;
+        String                EntryPoint;
+
+        bool operator==(const ShaderKey& rhs) const
+        {
+            return Type == rhs.Type && EntryPoint == rhs.EntryPoint && SPIRV == rhs.SPIRV;
+        }
+    };
+
+    // Resource signature state that defines the descriptor set layouts
+    struct SignatureKey
+    {
+        struct Resource
+        {
+            SHADER_TYPE                   ShaderStages = SHADER_TYPE_UNKNOWN;
+            Uint32                        ArraySize    = 0;
+            SHADER_RESOURCE_TYPE          ResourceType = SHADER_RESOURCE_TYPE_UNKNOWN;
+            SHADER_RESOURCE_VARIABLE_TYPE VarType      = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+            PIPELINE_RESOURCE_FLAGS       Flags        = PIPELINE_RESOURCE_FLAG_NONE;
+
+            // Members of PipelineResourceAttribsVk that are compared by PipelineResourceAttribsVk::IsCompatibleWith()
+            Uint32 BindingIndex         = 0;
+            Uint32 DescrArraySize       = 0;
+            Uint32 DescrType            = 0;
+            Uint32 DescrSet             = 0;
+            bool   ImtblSamplerAssigned = false;
+
+            bool operator==(const Resource& rhs) const
+            {
+                // clang-format off
+                return ShaderStages         == rhs.ShaderStages   &&
+                       ArraySize            == rhs.ArraySize      &&
+                       ResourceType         == rhs.ResourceType   &&
+                       VarType              == rhs.VarType        &&
+                       Flags                == rhs.Flags          &&
+                       BindingIndex         == rhs.BindingIndex   &&
+                       DescrArraySize       == rhs.DescrArraySize &&
+                       DescrType            == rhs.DescrType      &&
+                       DescrSet             == rhs.DescrSet       &&
+                       ImtblSamplerAssigned == rhs.ImtblSamplerAssigned;
+                // clang-format on
+            }
+        };
+
+        struct ImmutableSampler
+        {
+            SHADER_TYPE ShaderStages = SHADER_TYPE_UNKNOWN;
+            SamplerDesc Desc;
+
+            bool operator==(const ImmutableSampler& rhs) const
+            {
+                return ShaderStages == rhs.ShaderStages && Desc == rhs.Desc;
+            }
+        };
+
+        Uint8                             BindingIndex = 0;
+        PIPELINE_RESOURCE_SIGNATURE_FLAGS Flags        = PIPELINE_RESOURCE_SIGNATURE_FLAG_NONE;
+        std::vector<Resource>             Resources;
+        std::vector<ImmutableSampler>     ImmutableSamplers;
+
+        // Hash of the resource signature
+        size_t Hash = 0;
+
+        bool operator==(const SignatureKey& rhs) const
+        {
+            // clang-format off
+            return Hash              == rhs.Hash         &&
+                   BindingIndex      == rhs.BindingIndex &&
+                   Flags             == rhs.Flags        &&
+                   Resources         == rhs.Resources    &&
+                   ImmutableSamplers == rhs.ImmutableSamplers;
+            // clang-format on
+        }
+    };
+
+    // The full state that defines a pipeline part. Only the members that are used by
+    // the part are initialized, the others keep their default values.
+    // The key is compared on lookup, so hash collisions never return a wrong library.
+    struct PartKey
+    {
+        PSO_CREATE_FLAGS CreateFlags = PSO_CREATE_FLAG_NONE;
+
+        // Vertex input interface
+        PRIMITIVE_TOPOLOGY         PrimitiveTopology = PRIMITIVE_TOPOLOGY_UNDEFINED;
+        std::vector<LayoutElement> LayoutElements;
+
+        // Pre-rasterization and fragment shaders
+        std::vector<ShaderKey>    Shaders;
+        std::vector<SignatureKey> Signatures;
+
+        RasterizerStateDesc         RasterizerDesc;
+        Uint8                       NumViewports     = 0;
+        PIPELINE_SHADING_RATE_FLAGS ShadingRateFlags = PIPELINE_SHADING_RATE_FLAG_NONE;
+        DepthStencilStateDesc       DepthStencilDesc;
+        Uint32                      SampleMask = 0;
+
+        // Fragment output interface
+        BlendStateDesc BlendDesc;
+
+        // Render pass or attachment formats when dynamic rendering is used.
+        // Implicit render passes live as long as the device, so the handle identifies the render pass.
+        VkRenderPass                                   vkRenderPass     = VK_NULL_HANDLE;
+        Uint8                                          SubpassIndex     = 0;
+        Uint8                                          NumRenderTargets = 0;
+        std::array<TEXTURE_FORMAT, MAX_RENDER_TARGETS> RTVFormats       = {};
+        TEXTURE_FORMAT                                 DSVFormat        = TEX_FORMAT_UNKNOWN;
+        Uint8                                          SampleCount      = 0;
+        Uint8                                          SampleQuality    = 0;
+
+        // Hash of all members above
+        size_t Hash = 0;
+
+        bool operator==(const PartKey& rhs) const;
+
+        struct Hasher
+        {
+            size_t operator()(const PartKey& Key) const
+            {
+                return Key.Hash;
+            }
+        };
+    };
+    using PartKeys = std::array<PartKey, PIPELINE_PART_COUNT>;
+
+    // Creates the graphics pipeline by linking the libraries for every part of the pipeline
+    // described by PipelineCI. The libraries that are not found in the cache are created.
+    // Link-time optimization is not performed to minimize the linking time.
+    VulkanUtilities::PipelineWrapper LinkPipeline(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                                  const PartKeys&                     Keys,
+                                                  const char*                         Name);
+
+    struct Statistics
+    {
+        /// The number of times an existing library was found in the cache.
+        Uint32 HitCount = 0;
+
+        /// The number of libraries created by the cache.
+        Uint32 CreationCount = 0;
+
+        /// The number of pipelines linked from the libraries.
+        Uint32 LinkCount = 0;
+
+        /// The number of libraries evicted from the cache.
+        Uint32 EvictionCount = 0;
+    };
+    Statistics GetStatistics();
+
+private:
+    // Pipeline libraries may be destroyed once the pipelines that link them have been created,
+    // so a library that is evicted while another thread links it stays alive until the link is complete.
+    using LibraryPtr = std::shared_ptr<VulkanUtilities::PipelineWrapper>;
+
+    LibraryPtr GetLibrary(PIPELINE_PART Part, const PartKey& Key, const VkGraphicsPipelineCreateInfo& PipelineCI);
+
+    // m_Mutex must be locked
+    void EvictLibraries(PIPELINE_PART Part);
+
+    RenderDeviceVkImpl& m_DeviceVk;
+
+    const size_t m_MaxLibrariesPerPart;
+
+    using LRUListType = std::list<const PartKey*>;
+    struct LibraryEntry
+    {
+        LibraryPtr            pLibrary;
+        LRUListType::iterator LRUPos;
+    };
+
+    std::mutex                                                 m_Mutex;
+    std::unordered_map<PartKey, LibraryEntry, PartKey::Hasher> m_Libraries[PIPELINE_PART_COUNT];
+    LRUListType                                                m_LRULists[PIPELINE_PART_COUNT];
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
@@ -51,6 +51,11 @@ namespace Diligent
 struct SPIRVShaderResourceAttribs;
 class DeviceContextVkImpl;
 
+namespace VulkanUtilities
+{
+class VulkanCommandBuffer;
+}
+
 /// Implementation of the Diligent::PipelineResourceSignatureVkImpl class
 class PipelineResourceSignatureVkImpl final : public PipelineResourceSignatureBase<EngineVkImplTraits>
 {
@@ -74,6 +79,10 @@ public:
     // Static/mutable and dynamic descriptor sets
     static constexpr Uint32 MAX_DESCRIPTOR_SETS = DESCRIPTOR_SET_ID_NUM_SETS;
 
+    // The maximum number of descriptors in the dynamic set that may use push descriptors.
+    // Vulkan guarantees that maxPushDescriptors is at least 32.
+    static constexpr Uint32 MaxPushDescriptors = 32;
+
     static_assert(ResourceAttribs::MaxDescriptorSets >= MAX_DESCRIPTOR_SETS, "Not enough bits to store descriptor set index");
 
     PipelineResourceSignatureVkImpl(IReferenceCounters*                  pRefCounters,
@@ -110,6 +119,14 @@ public:
 
     bool HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
 
+    // Returns true if the dynamic descriptor set is written with vkCmdPushDescriptorSetKHR
+    // instead of being allocated and written every time the SRB is committed.
+    bool UsesPushDescriptors() const { return m_UsePushDescriptors; }
+
+    // Returns true if the static/mutable descriptor set contains bindless resources and
+    // uses update-after-bind layout (see PIPELINE_RESOURCE_FLAG_BINDLESS).
+    bool HasBindlessResources() const { return m_HasBindlessResources; }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -119,6 +136,15 @@ public:
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                 VkDescriptorSet              vkDynamicDescriptorSet) const;
 
+    // Pushes dynamic resources from ResourceCache to the command buffer.
+    // Dynamic buffer offsets are applied directly to the descriptors.
+    void PushDynamicResources(const ShaderResourceCacheVk&          ResourceCache,
+                              VulkanUtilities::VulkanCommandBuffer& CmdBuffer,
+                              VkPipelineBindPoint                   vkBindPoint,
+                              VkPipelineLayout                      vkPipelineLayout,
+                              Uint32                                SetIndex,
+                              DeviceContextIndex                    CtxId) const;
+
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
     bool DvpValidateCommittedResource(const DeviceContextVkImpl*        pDeviceCtx,
@@ -161,6 +187,15 @@ private:
 
     void CreateSetLayouts();
 
+    // Verifies that the device supports partially-bound update-after-bind descriptors for the resource
+    void VerifyBindlessResource(const PipelineResourceDesc& ResDesc) const;
+
+    template <bool PushDescriptors, typename FlushWritesType>
+    void WriteDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                               VkDescriptorSet              vkDynamicDescriptorSet,
+                               DeviceContextIndex           CtxId,
+                               FlushWritesType              FlushWrites) const;
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
@@ -171,12 +206,19 @@ private:
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
     // The total number of uniform buffers with dynamic offsets in both descriptor sets,
-    // accounting for array size.
+    // accounting for array size. Push descriptor sets are not counted as they
+    // do not use dynamic offsets.
     Uint16 m_DynamicUniformBufferCount = 0;
     // The total number storage buffers with dynamic offsets in both descriptor sets,
-    // accounting for array size.
+    // accounting for array size. Push descriptor sets are not counted.
     Uint16 m_DynamicStorageBufferCount = 0;
 
+    // Indicates that the dynamic descriptor set uses VK_KHR_push_descriptor
+    bool m_UsePushDescriptors = false;
+
+    // Indicates that the static/mutable descriptor set contains bindless resources
+    bool m_HasBindlessResources = false;
+
     ImmutableSamplerAttribs* m_ImmutableSamplers = nullptr; // [m_Desc.NumImmutableSamplers]
 };
 
@@ -30,7 +30,9 @@
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "EngineVkImplTraits.hpp"
@@ -50,8 +52,10 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "GraphicsPipelineLibraryCache.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
+#include "GenerateMipsVkHelper.hpp"
 
 namespace Diligent
 {
@@ -186,12 +190,32 @@ public:
                                                                   const FenceDesc& Desc,
                                                                   IFence**         ppFence) override final;
 
+    /// Implementation of IRenderDeviceVk::GetRenderPassCacheStats().
+    virtual RenderPassCacheStatsVk DILIGENT_CALL_TYPE GetRenderPassCacheStats() override final;
+
+    /// Implementation of IRenderDeviceVk::GetPipelineLibraryCacheStats().
+    virtual PipelineLibraryCacheStatsVk DILIGENT_CALL_TYPE GetPipelineLibraryCacheStats() override final;
+
+    /// Implementation of IRenderDeviceVk::GetMemoryHeapStats().
+    virtual MemoryHeapStatsVk DILIGENT_CALL_TYPE GetMemoryHeapStats(Uint32 HeapIndex) const override final;
+
+    /// Implementation of IRenderDeviceVk::SetMemoryBudgetCallback().
+    virtual void DILIGENT_CALL_TYPE SetMemoryBudgetCallback(MemoryBudgetCallbackVkType Callback, void* pUserData) override final;
+
     /// Implementation of IRenderDevice::IdleGPU() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
     // pImmediateCtx parameter is only used to make sure the command buffer is submitted from the immediate context
     // The method returns fence value associated with the submitted command buffer
-    Uint64 ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueId, const VkSubmitInfo& SubmitInfo, std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences);
+    // If DeferSubmission is true, the work is added to the pending batch of the queue, see ICommandQueueVk::EnqueueSubmit().
+    Uint64 ExecuteCommandBuffer(SoftwareQueueIndex                                          CommandQueueId,
+                                const VkSubmitInfo&                                         SubmitInfo,
+                                std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences,
+                                bool                                                        DeferSubmission = false);
+
+    // Returns true if command lists executed by immediate contexts should be added to
+    // the pending batch of the queue, see EngineVkCreateInfo::BatchQueueSubmissions.
+    bool IsQueueSubmitBatchingEnabled() const { return m_BatchQueueSubmissions; }
 
     void AllocateTransientCmdPool(SoftwareQueueIndex                   CommandQueueId,
                                   VulkanUtilities::CommandPoolWrapper& CmdPool,
@@ -206,6 +230,11 @@ public:
     {
         return m_DescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, DebugName);
     }
+    // Allocates a descriptor set with VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT layout
+    DescriptorSetAllocation AllocateBindlessDescriptorSet(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "")
+    {
+        return m_BindlessDescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, DebugName);
+    }
     DescriptorPoolManager& GetDynamicDescriptorPool() { return m_DynamicDescriptorPool; }
 
     std::shared_ptr<const VulkanUtilities::VulkanInstance> GetVulkanInstance() const { return m_VulkanInstance; }
@@ -216,6 +245,10 @@ public:
     FramebufferCache& GetFramebufferCache() { return m_FramebufferCache; }
     RenderPassCache&  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache; }
 
+    GraphicsPipelineLibraryCache& GetPipelineLibraryCache() { return m_PipelineLibraryCache; }
+
+    GenerateMipsVkHelper& GetMipsGenerator() { return m_MipsGenerator; }
+
     VulkanUtilities::VulkanMemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
     {
         return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags);
@@ -227,10 +260,36 @@ public:
         const auto MemoryFlags = MemoryProps.memoryTypes[MemoryTypeIndex].propertyFlags;
         return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags);
     }
+    VulkanUtilities::VulkanMemoryAllocation AllocateImageMemory(VkImage vkImage, const VkMemoryRequirements& MemReqs, bool PrefersDedicatedAllocation, VkMemoryPropertyFlags MemoryProperties)
+    {
+        return m_MemoryMgr.AllocateImageMemory(vkImage, MemReqs, PrefersDedicatedAllocation, MemoryProperties);
+    }
     VulkanUtilities::VulkanMemoryManager& GetGlobalMemoryManager() { return m_MemoryMgr; }
 
     VulkanDynamicMemoryManager& GetDynamicMemoryManager() { return m_DynamicMemoryManager; }
 
+    // Buffers that can be moved to another memory page by the defragmentation pass
+    // (see DeviceContextVkImpl::DefragmentMemory).
+    void RegisterRelocatableBuffer(BufferVkImpl* pBuffer)
+    {
+        std::lock_guard<std::mutex> Lock{m_RelocatableBuffersMtx};
+        m_RelocatableBuffers.insert(pBuffer);
+    }
+    void UnregisterRelocatableBuffer(BufferVkImpl* pBuffer)
+    {
+        std::lock_guard<std::mutex> Lock{m_RelocatableBuffersMtx};
+        m_RelocatableBuffers.erase(pBuffer);
+    }
+
+    // Calls the handler with the set of relocatable buffers. The set is locked while the
+    // handler runs, so buffers that are being destroyed wait until the handler returns.
+    template <typename HandlerType>
+    void ProcessRelocatableBuffers(HandlerType&& Handler)
+    {
+        std::lock_guard<std::mutex> Lock{m_RelocatableBuffersMtx};
+        Handler(m_RelocatableBuffers);
+    }
+
     void FlushStaleResources(SoftwareQueueIndex CmdQueueIndex);
 
     IDXCompiler* GetDxCompiler() const { return m_pDxCompiler.get(); }
@@ -269,7 +328,8 @@ private:
                              const VkSubmitInfo&                                         SubmitInfo,
                              Uint64&                                                     SubmittedCmdBuffNumber,
                              Uint64&                                                     SubmittedFenceValue,
-                             std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pFences);
+                             std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pFences,
+                             bool                                                        DeferSubmission);
 
     std::shared_ptr<VulkanUtilities::VulkanInstance>       m_VulkanInstance;
     std::unique_ptr<VulkanUtilities::VulkanPhysicalDevice> m_PhysicalDevice;
@@ -277,8 +337,12 @@ private:
 
     FramebufferCache       m_FramebufferCache;
     RenderPassCache        m_ImplicitRenderPassCache;
+
+    GraphicsPipelineLibraryCache m_PipelineLibraryCache;
+
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
+    DescriptorSetAllocator m_BindlessDescriptorSetAllocator;
 
     // These one-time command pools are used by buffer and texture constructors to
     // issue copy commands. Vulkan requires that every command pool is used by one thread
@@ -292,7 +356,14 @@ private:
 
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
+    std::mutex                        m_RelocatableBuffersMtx;
+    std::unordered_set<BufferVkImpl*> m_RelocatableBuffers;
+
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
+    const bool m_BatchQueueSubmissions;
+
+    GenerateMipsVkHelper m_MipsGenerator;
 };
 
 } // namespace Diligent
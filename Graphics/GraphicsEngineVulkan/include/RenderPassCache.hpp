@@ -124,6 +124,16 @@ public:
 
     RenderPassVkImpl* GetRenderPass(const RenderPassCacheKey& Key);
 
+    struct Statistics
+    {
+        /// The number of times an existing render pass was found in the cache.
+        Uint32 HitCount = 0;
+
+        /// The number of render passes created by the cache.
+        Uint32 CreationCount = 0;
+    };
+    Statistics GetStatistics();
+
     void Destroy();
 
 private:
@@ -139,6 +149,8 @@ private:
 
     std::mutex                                                                                      m_Mutex;
     std::unordered_map<RenderPassCacheKey, RefCntAutoPtr<RenderPassVkImpl>, RenderPassCacheKeyHash> m_Cache;
+
+    Statistics m_Stats;
 };
 
 } // namespace Diligent
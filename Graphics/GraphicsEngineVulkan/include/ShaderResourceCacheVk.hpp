@@ -52,9 +52,14 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// Descriptor writes to the static/mutable set are not issued immediately when a resource is set.
+// Instead, they are recorded in the pending write list and flushed in batches by FlushDescriptorWrites()
+// when the resource binding is committed.
 
 #include <vector>
 #include <memory>
+#include <atomic>
 
 #include "DescriptorPoolManager.hpp"
 #include "SPIRVShaderResources.hpp"
@@ -62,13 +67,14 @@
 #include "ShaderResourceCacheCommon.hpp"
 #include "PipelineResourceAttribsVk.hpp"
 #include "VulkanUtilities/VulkanLogicalDevice.hpp"
+#include "LockHelper.hpp"
 
 namespace Diligent
 {
 
 class DeviceContextVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 56 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -132,6 +138,10 @@ public:
         template <DescriptorType DescrType>
         auto GetDescriptorWriteInfo() const;
 
+        // Returns the total dynamic offset (the buffer's dynamic allocation offset plus BufferDynamicOffset)
+        // of a uniform or storage buffer with dynamic offset.
+        __forceinline Uint32 GetDynamicBufferOffset(DeviceContextIndex CtxId) const;
+
         void SetUniformBuffer(RefCntAutoPtr<IDeviceObject>&& _pBuffer, Uint64 _RangeOffset, Uint64 _RangeSize);
         void SetStorageBuffer(RefCntAutoPtr<IDeviceObject>&& _pBufferView);
 
@@ -229,18 +239,27 @@ public:
         {
         }
     };
-    // Sets the resource at the given descriptor set index and offset
-    const Resource& SetResource(const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice,
-                                Uint32                                      DescrSetIndex,
-                                Uint32                                      CacheOffset,
-                                SetResourceInfo&&                           SrcRes);
+    // Sets the resource at the given descriptor set index and offset.
+    // If the set has a Vulkan descriptor set assigned, the descriptor write is deferred
+    // until FlushDescriptorWrites() is called.
+    const Resource& SetResource(Uint32            DescrSetIndex,
+                                Uint32            CacheOffset,
+                                SetResourceInfo&& SrcRes);
 
     const Resource& ResetResource(Uint32 SetIndex,
                                   Uint32 Offset)
     {
-        return SetResource(nullptr, SetIndex, Offset, {});
+        return SetResource(SetIndex, Offset, {});
+    }
+
+    bool HasPendingDescriptorWrites() const
+    {
+        return m_HasPendingWrites.load(std::memory_order_acquire);
     }
 
+    // Writes all pending descriptors to the Vulkan descriptor sets using batched vkUpdateDescriptorSets calls.
+    void FlushDescriptorWrites(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice);
+
     void SetDynamicBufferOffset(Uint32 DescrSetIndex,
                                 Uint32 CacheOffset,
                                 Uint32 DynamicBufferOffset);
@@ -260,7 +279,9 @@ public:
     template <bool VerifyOnly>
     void TransitionResources(DeviceContextVkImpl* pCtxVkImpl);
 
-    __forceinline Uint32 GetDynamicBufferOffsets(DeviceContextIndex CtxId, std::vector<uint32_t>& Offsets) const;
+    // Writes dynamic buffer offsets for the first NumSets descriptor sets.
+    // The push descriptor set, if any, is always the last one and does not use dynamic offsets.
+    __forceinline Uint32 GetDynamicBufferOffsets(DeviceContextIndex CtxId, std::vector<uint32_t>& Offsets, Uint32 NumSets) const;
 
 private:
     Resource* GetFirstResourcePtr()
@@ -290,6 +311,19 @@ private:
     // Indicates what types of resources are stored in the cache
     const Uint32 m_ContentType : 1;
 
+    struct PendingDescriptorWrite
+    {
+        Uint16 SetIndex     = 0;
+        Uint16 BindingIndex = 0;
+        Uint32 CacheOffset  = 0;
+        Uint32 ArrayIndex   = 0;
+    };
+    // Descriptor writes that have not yet been flushed to the Vulkan descriptor sets
+    std::vector<PendingDescriptorWrite> m_PendingWrites;
+
+    std::atomic<bool>        m_HasPendingWrites{false};
+    ThreadingTools::LockFlag m_PendingWritesLockFlag;
+
 #ifdef DILIGENT_DEBUG
     // Debug array that stores flags indicating if resources in the cache have been initialized
     std::vector<std::vector<bool>> m_DbgInitializedResources;
@@ -313,8 +347,35 @@ template <>
 __forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<DescriptorType::AccelerationStructure>() const { return GetAccelerationStructureWriteInfo(); }
 
 
+__forceinline Uint32 ShaderResourceCacheVk::Resource::GetDynamicBufferOffset(DeviceContextIndex CtxId) const
+{
+    VERIFY_EXPR(Type == DescriptorType::UniformBufferDynamic ||
+                Type == DescriptorType::StorageBufferDynamic ||
+                Type == DescriptorType::StorageBufferDynamic_ReadOnly);
+
+    const BufferVkImpl* pBufferVk = nullptr;
+    if (Type == DescriptorType::UniformBufferDynamic)
+    {
+        pBufferVk = pObject.RawPtr<const BufferVkImpl>();
+    }
+    else
+    {
+        const auto* pBufferVkView = pObject.RawPtr<const BufferViewVkImpl>();
+        pBufferVk                 = pBufferVkView != nullptr ? pBufferVkView->GetBuffer<const BufferVkImpl>() : nullptr;
+    }
+    // Do not verify dynamic allocation here as there may be some buffers that are not used by the PSO.
+    // The allocations of the buffers that are actually used will be verified by
+    // PipelineResourceSignatureVkImpl::DvpValidateCommittedResource().
+    const auto Offset = pBufferVk != nullptr ? pBufferVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/) : 0;
+    // The effective offset used for dynamic uniform and storage buffer bindings is the sum of the relative
+    // offset taken from pDynamicOffsets, and the base address of the buffer plus base offset in the descriptor set.
+    // The range of the dynamic uniform and storage buffer bindings is the buffer range as specified in the descriptor set.
+    return StaticCast<Uint32>(BufferDynamicOffset + Offset);
+}
+
 __forceinline Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextIndex     CtxId,
-                                                                    std::vector<uint32_t>& Offsets) const
+                                                                    std::vector<uint32_t>& Offsets,
+                                                                    Uint32                 NumSets) const
 {
     // If any of the sets being bound include dynamic uniform or storage buffers, then
     // pDynamicOffsets includes one element for each array element in each dynamic descriptor
@@ -327,8 +388,9 @@ __forceinline Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContex
     // for every shader stage come first, followed by all storage buffers with dynamic offsets
     // (DescriptorType::StorageBufferDynamic and DescriptorType::StorageBufferDynamic_ReadOnly) for every shader stage,
     // followed by all other resources.
+    VERIFY_EXPR(NumSets <= m_NumSets);
     Uint32 OffsetInd = 0;
-    for (Uint32 set = 0; set < m_NumSets; ++set)
+    for (Uint32 set = 0; set < NumSets; ++set)
     {
         const auto& DescrSet = GetDescriptorSet(set);
         const auto  SetSize  = DescrSet.GetSize();
@@ -339,15 +401,7 @@ __forceinline Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContex
             const auto& Res = DescrSet.GetResource(res);
             if (Res.Type == DescriptorType::UniformBufferDynamic)
             {
-                const auto* pBufferVk = Res.pObject.RawPtr<const BufferVkImpl>();
-                // Do not verify dynamic allocation here as there may be some buffers that are not used by the PSO.
-                // The allocations of the buffers that are actually used will be verified by
-                // PipelineResourceSignatureVkImpl::DvpValidateCommittedResource().
-                const auto Offset = pBufferVk != nullptr ? pBufferVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/) : 0;
-                // The effective offset used for dynamic uniform and storage buffer bindings is the sum of the relative
-                // offset taken from pDynamicOffsets, and the base address of the buffer plus base offset in the descriptor set.
-                // The range of the dynamic uniform and storage buffer bindings is the buffer range as specified in the descriptor set.
-                Offsets[OffsetInd++] = StaticCast<Uint32>(Res.BufferDynamicOffset + Offset);
+                Offsets[OffsetInd++] = Res.GetDynamicBufferOffset(CtxId);
                 ++res;
             }
             else
@@ -360,16 +414,7 @@ __forceinline Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContex
             if (Res.Type == DescriptorType::StorageBufferDynamic ||
                 Res.Type == DescriptorType::StorageBufferDynamic_ReadOnly)
             {
-                const auto* pBufferVkView = Res.pObject.RawPtr<const BufferViewVkImpl>();
-                const auto* pBufferVk     = pBufferVkView != nullptr ? pBufferVkView->GetBuffer<const BufferVkImpl>() : nullptr;
-                // Do not verify dynamic allocation here as there may be some buffers that are not used by the PSO.
-                // The allocations of the buffers that are actually used will be verified by
-                // PipelineResourceSignatureVkImpl::DvpValidateCommittedResource().
-                const auto Offset = pBufferVk != nullptr ? pBufferVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/) : 0;
-                // The effective offset used for dynamic uniform and storage buffer bindings is the sum of the relative
-                // offset taken from pDynamicOffsets, and the base address of the buffer plus base offset in the descriptor set.
-                // The range of the dynamic uniform and storage buffer bindings is the buffer range as specified in the descriptor set.
-                Offsets[OffsetInd++] = StaticCast<Uint32>(Res.BufferDynamicOffset + Offset);
+                Offsets[OffsetInd++] = Res.GetDynamicBufferOffset(CtxId);
                 ++res;
             }
             else
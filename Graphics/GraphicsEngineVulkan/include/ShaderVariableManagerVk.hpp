@@ -95,6 +95,9 @@ public:
     // Binds object pObj to resource with index ResIndex and array index ArrayIndex.
     void BindResource(Uint32 ResIndex, const BindResourceInfo& BindInfo);
 
+    // Writes the descriptors of the bindless resource with index ResIndex that were recorded by BindResource().
+    void FlushBindlessWrites(Uint32 ResIndex);
+
     void SetBufferDynamicOffset(Uint32 ResIndex,
                                 Uint32 ArrayIndex,
                                 Uint32 BufferDynamicOffset);
@@ -163,6 +166,11 @@ public:
         m_ParentManager.BindResource(m_ResIndex, BindInfo);
     }
 
+    void OnResourcesBound() const
+    {
+        m_ParentManager.FlushBindlessWrites(m_ResIndex);
+    }
+
     void SetDynamicOffset(Uint32 ArrayIndex,
                           Uint32 BufferDynamicOffset) const
     {
@@ -30,6 +30,8 @@
 /// \file
 /// Declaration of Diligent::TextureViewVkImpl class
 
+#include <vector>
+
 #include "EngineVkImplTraits.hpp"
 #include "TextureViewBase.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
@@ -43,12 +45,13 @@ class TextureViewVkImpl final : public TextureViewBase<EngineVkImplTraits>
 public:
     using TTextureViewBase = TextureViewBase<EngineVkImplTraits>;
 
-    TextureViewVkImpl(IReferenceCounters*                 pRefCounters,
-                      RenderDeviceVkImpl*                 pDevice,
-                      const TextureViewDesc&              ViewDesc,
-                      ITexture*                           pTexture,
-                      VulkanUtilities::ImageViewWrapper&& ImgView,
-                      bool                                bIsDefaultView);
+    TextureViewVkImpl(IReferenceCounters*                              pRefCounters,
+                      RenderDeviceVkImpl*                              pDevice,
+                      const TextureViewDesc&                           ViewDesc,
+                      ITexture*                                        pTexture,
+                      VulkanUtilities::ImageViewWrapper&&              ImgView,
+                      std::vector<VulkanUtilities::ImageViewWrapper>&& MipLevelViews,
+                      bool                                             bIsDefaultView);
     ~TextureViewVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_TextureViewVk, TTextureViewBase)
@@ -56,9 +59,22 @@ public:
     /// Implementation of ITextureViewVk::GetVulkanImageView().
     virtual VkImageView DILIGENT_CALL_TYPE GetVulkanImageView() const override final { return m_ImageView; }
 
+    /// Returns true if the view has single-mip storage views used to generate mipmaps in a compute shader.
+    bool HasMipLevelViews() const { return !m_MipLevelViews.empty(); }
+
+    /// Returns the storage image view of the given mip level, relative to the most detailed mip of this view.
+    VkImageView GetMipLevelView(Uint32 MipLevel) const
+    {
+        VERIFY_EXPR(MipLevel < m_MipLevelViews.size());
+        return m_MipLevelViews[MipLevel];
+    }
+
 protected:
     /// Vulkan image view descriptor handle
     VulkanUtilities::ImageViewWrapper m_ImageView;
+
+    /// Storage image views of individual mip levels for the views created with TEXTURE_VIEW_FLAG_ALLOW_MIP_MAP_GENERATION flag
+    std::vector<VulkanUtilities::ImageViewWrapper> m_MipLevelViews;
 };
 
 } // namespace Diligent
@@ -114,6 +114,9 @@ protected:
     VulkanUtilities::BufferWrapper          m_StagingBuffer;
     VulkanUtilities::VulkanMemoryAllocation m_MemoryAllocation;
     VkDeviceSize                            m_StagingDataAlignedOffset;
+
+    // Whether mipmaps are generated by the compute shader, see GenerateMipsVkHelper
+    bool m_GenerateMipsInCS = false;
 };
 
 } // namespace Diligent
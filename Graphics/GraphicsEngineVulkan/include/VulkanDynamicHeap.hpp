@@ -209,6 +209,11 @@ public:
     using OffsetType  = VulkanDynamicMemoryManager::OffsetType;
     using MasterBlock = VulkanDynamicMemoryManager::MasterBlock;
 
+    // Moves all master blocks to Blocks. The caller becomes responsible for returning the blocks
+    // to the global dynamic memory manager. This is used by reusable command lists that reference
+    // the dynamic memory after the end of the frame.
+    void ExtractMasterBlocks(std::vector<MasterBlock>& Blocks);
+
     static constexpr OffsetType InvalidOffset = static_cast<OffsetType>(-1);
 
     size_t GetAllocatedMasterBlockCount() const { return m_MasterBlocks.size(); }
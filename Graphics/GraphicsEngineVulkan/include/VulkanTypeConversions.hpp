@@ -62,6 +62,7 @@ void PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(PRIMITIVE_TOPOLOGY
                                                              VkPrimitiveTopology& VkPrimTopology,
                                                              uint32_t&            PatchControlPoints);
 
+VkCullModeFlagBits   CullModeToVkCullMode(CULL_MODE CullMode);
 VkCompareOp          ComparisonFuncToVkCompareOp(COMPARISON_FUNCTION CmpFunc);
 VkFilter             FilterTypeToVkFilter(FILTER_TYPE FilterType);
 VkSamplerMipmapMode  FilterTypeToVkMipmapMode(FILTER_TYPE FilterType);
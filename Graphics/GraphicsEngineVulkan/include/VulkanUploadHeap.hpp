@@ -100,23 +100,6 @@ public:
 
     ~VulkanUploadHeap();
 
-    VulkanUploadAllocation Allocate(VkDeviceSize SizeInBytes, VkDeviceSize Alignment);
-
-    // Releases all allocated pages that are later returned to the global memory manager by the release queues.
-    // As global memory manager is hosted by the render device, the upload heap can be destroyed before the
-    // pages are actually returned to the manager.
-    void ReleaseAllocatedPages(Uint64 CmdQueueMask);
-
-    size_t GetStalePagesCount() const
-    {
-        return m_Pages.size();
-    }
-
-private:
-    RenderDeviceVkImpl& m_RenderDevice;
-    std::string         m_HeapName;
-    const VkDeviceSize  m_PageSize;
-
     struct UploadPageInfo
     {
         // clang-format off
@@ -134,6 +117,28 @@ private:
         VulkanUtilities::BufferWrapper          Buffer;
         Uint8* const                            CPUAddress = nullptr;
     };
+
+    VulkanUploadAllocation Allocate(VkDeviceSize SizeInBytes, VkDeviceSize Alignment);
+
+    // Releases all allocated pages that are later returned to the global memory manager by the release queues.
+    // As global memory manager is hosted by the render device, the upload heap can be destroyed before the
+    // pages are actually returned to the manager.
+    void ReleaseAllocatedPages(Uint64 CmdQueueMask);
+
+    // Moves all allocated pages to Pages. The caller becomes responsible for releasing the pages.
+    // This is used by reusable command lists that reference the upload memory after the end of the frame.
+    void ExtractAllocatedPages(std::vector<UploadPageInfo>& Pages);
+
+    size_t GetStalePagesCount() const
+    {
+        return m_Pages.size();
+    }
+
+private:
+    RenderDeviceVkImpl& m_RenderDevice;
+    std::string         m_HeapName;
+    const VkDeviceSize  m_PageSize;
+
     std::vector<UploadPageInfo> m_Pages;
 
     struct CurrPageInfo
@@ -51,7 +51,7 @@ public:
                                        const VkImageSubresourceRange& Subresource)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdClearColorImage() must be called outside of render pass (17.1)");
+        VERIFY(!IsInsideRenderPass(), "vkCmdClearColorImage() must be called outside of render pass (17.1)");
         VERIFY(Subresource.aspectMask == VK_IMAGE_ASPECT_COLOR_BIT, "The aspectMask of all image subresource ranges must only include VK_IMAGE_ASPECT_COLOR_BIT (17.1)");
 
         DILIGENT_VK_CALL(CmdClearColorImage(
@@ -68,7 +68,7 @@ public:
                                               const VkImageSubresourceRange&  Subresource)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdClearDepthStencilImage() must be called outside of render pass (17.1)");
+        VERIFY(!IsInsideRenderPass(), "vkCmdClearDepthStencilImage() must be called outside of render pass (17.1)");
         // clang-format off
         VERIFY((Subresource.aspectMask &  (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) != 0 &&
                (Subresource.aspectMask & ~(VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) == 0,
@@ -87,7 +87,7 @@ public:
     __forceinline void ClearAttachment(const VkClearAttachment& Attachment, const VkClearRect& ClearRect)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdClearAttachments() must be called inside render pass (17.2)");
+        VERIFY(IsInsideRenderPass(), "vkCmdClearAttachments() must be called inside render pass (17.2)");
 
         DILIGENT_VK_CALL(CmdClearAttachments(
             m_VkCmdBuffer,
@@ -102,7 +102,7 @@ public:
     __forceinline void Draw(uint32_t VertexCount, uint32_t InstanceCount, uint32_t FirstVertex, uint32_t FirstInstance)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDraw() must be called inside render pass (19.3)");
+        VERIFY(IsInsideRenderPass(), "vkCmdDraw() must be called inside render pass (19.3)");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
 
         DILIGENT_VK_CALL(CmdDraw(m_VkCmdBuffer, VertexCount, InstanceCount, FirstVertex, FirstInstance));
@@ -111,17 +111,37 @@ public:
     __forceinline void DrawIndexed(uint32_t IndexCount, uint32_t InstanceCount, uint32_t FirstIndex, int32_t VertexOffset, uint32_t FirstInstance)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndexed() must be called inside render pass (19.3)");
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawIndexed() must be called inside render pass (19.3)");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
         VERIFY(m_State.IndexBuffer != VK_NULL_HANDLE, "No index buffer bound");
 
         DILIGENT_VK_CALL(CmdDrawIndexed(m_VkCmdBuffer, IndexCount, InstanceCount, FirstIndex, VertexOffset, FirstInstance));
     }
 
+    __forceinline void DrawMulti(uint32_t DrawCount, const VkMultiDrawInfoEXT* pVertexInfo, uint32_t InstanceCount, uint32_t FirstInstance)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawMultiEXT() must be called inside render pass (19.3)");
+        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+
+        DILIGENT_VK_CALL(CmdDrawMultiEXT(m_VkCmdBuffer, DrawCount, pVertexInfo, InstanceCount, FirstInstance, sizeof(VkMultiDrawInfoEXT)));
+    }
+
+    __forceinline void DrawMultiIndexed(uint32_t DrawCount, const VkMultiDrawIndexedInfoEXT* pIndexInfo, uint32_t InstanceCount, uint32_t FirstInstance)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawMultiIndexedEXT() must be called inside render pass (19.3)");
+        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IndexBuffer != VK_NULL_HANDLE, "No index buffer bound");
+
+        // pVertexOffset is null, so vertexOffset of every VkMultiDrawIndexedInfoEXT is used
+        DILIGENT_VK_CALL(CmdDrawMultiIndexedEXT(m_VkCmdBuffer, DrawCount, pIndexInfo, InstanceCount, FirstInstance, sizeof(VkMultiDrawIndexedInfoEXT), nullptr));
+    }
+
     __forceinline void DrawIndirect(VkBuffer Buffer, VkDeviceSize Offset, uint32_t DrawCount, uint32_t Stride)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndirect() must be called inside render pass (19.3)");
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawIndirect() must be called inside render pass (19.3)");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
 
         DILIGENT_VK_CALL(CmdDrawIndirect(m_VkCmdBuffer, Buffer, Offset, DrawCount, Stride));
@@ -130,7 +150,7 @@ public:
     __forceinline void DrawIndexedIndirect(VkBuffer Buffer, VkDeviceSize Offset, uint32_t DrawCount, uint32_t Stride)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndirect() must be called inside render pass (19.3)");
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawIndirect() must be called inside render pass (19.3)");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
         VERIFY(m_State.IndexBuffer != VK_NULL_HANDLE, "No index buffer bound");
 
@@ -141,7 +161,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndirectCountKHR() must be called inside render pass (19.3)");
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawIndirectCountKHR() must be called inside render pass (19.3)");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
 
         DILIGENT_VK_CALL(CmdDrawIndirectCountKHR(m_VkCmdBuffer, Buffer, Offset, CountBuffer, CountBufferOffset, MaxDrawCount, Stride));
@@ -154,7 +174,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndirect() must be called inside render pass (19.3)");
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawIndirect() must be called inside render pass (19.3)");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
         VERIFY(m_State.IndexBuffer != VK_NULL_HANDLE, "No index buffer bound");
 
@@ -168,7 +188,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawMeshTasksNV() must be called inside render pass");
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawMeshTasksNV() must be called inside render pass");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
 
         DILIGENT_VK_CALL(CmdDrawMeshTasksNV(m_VkCmdBuffer, TaskCount, FirstTask));
@@ -181,7 +201,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawMeshTasksNV() must be called inside render pass");
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawMeshTasksNV() must be called inside render pass");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
 
         DILIGENT_VK_CALL(CmdDrawMeshTasksIndirectNV(m_VkCmdBuffer, Buffer, Offset, DrawCount, Stride));
@@ -194,7 +214,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawMeshTasksIndirectCountNV() must be called inside render pass");
+        VERIFY(IsInsideRenderPass(), "vkCmdDrawMeshTasksIndirectCountNV() must be called inside render pass");
         VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
 
         DILIGENT_VK_CALL(CmdDrawMeshTasksIndirectCountNV(m_VkCmdBuffer, Buffer, Offset, CountBuffer, CountBufferOffset, MaxDrawCount, Stride));
@@ -206,7 +226,7 @@ public:
     __forceinline void Dispatch(uint32_t GroupCountX, uint32_t GroupCountY, uint32_t GroupCountZ)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdDispatch() must be called outside of render pass (27)");
+        VERIFY(!IsInsideRenderPass(), "vkCmdDispatch() must be called outside of render pass (27)");
         VERIFY(m_State.ComputePipeline != VK_NULL_HANDLE, "No compute pipeline bound");
 
         DILIGENT_VK_CALL(CmdDispatch(m_VkCmdBuffer, GroupCountX, GroupCountY, GroupCountZ));
@@ -215,7 +235,7 @@ public:
     __forceinline void DispatchIndirect(VkBuffer Buffer, VkDeviceSize Offset)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdDispatchIndirect() must be called outside of render pass (27)");
+        VERIFY(!IsInsideRenderPass(), "vkCmdDispatchIndirect() must be called outside of render pass (27)");
         VERIFY(m_State.ComputePipeline != VK_NULL_HANDLE, "No compute pipeline bound");
 
         DILIGENT_VK_CALL(CmdDispatchIndirect(m_VkCmdBuffer, Buffer, Offset));
@@ -226,10 +246,11 @@ public:
                                        uint32_t            FramebufferWidth,
                                        uint32_t            FramebufferHeight,
                                        uint32_t            ClearValueCount = 0,
-                                       const VkClearValue* pClearValues    = nullptr)
+                                       const VkClearValue* pClearValues    = nullptr,
+                                       VkSubpassContents   Contents        = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Current pass has not been ended");
+        VERIFY(!IsInsideRenderPass(), "Current pass has not been ended");
 
         if (m_State.RenderPass != RenderPass || m_State.Framebuffer != Framebuffer)
         {
@@ -249,9 +270,10 @@ public:
                                                       // ignored (7.4)
 
             DILIGENT_VK_CALL(CmdBeginRenderPass(m_VkCmdBuffer, &BeginInfo,
-                                 VK_SUBPASS_CONTENTS_INLINE // the contents of the subpass will be recorded inline in the
-                                                            // primary command buffer, and secondary command buffers must not
-                                                            // be executed within the subpass
+                                 Contents // VK_SUBPASS_CONTENTS_INLINE means that the contents of the subpass will be recorded
+                                          // inline in the primary command buffer, and secondary command buffers must not
+                                          // be executed within the subpass. VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+                                          // means that the contents are recorded in secondary command buffers only.
             ));
             m_State.RenderPass        = RenderPass;
             m_State.Framebuffer       = Framebuffer;
@@ -260,11 +282,58 @@ public:
         }
     }
 
+    __forceinline void BeginRendering(const VkRenderingInfoKHR& RenderingInfo)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(!IsInsideRenderPass(), "Current pass has not been ended");
+
+        DILIGENT_VK_CALL(CmdBeginRenderingKHR(m_VkCmdBuffer, &RenderingInfo));
+        m_State.DynamicRendering  = true;
+        m_State.FramebufferWidth  = RenderingInfo.renderArea.extent.width;
+        m_State.FramebufferHeight = RenderingInfo.renderArea.extent.height;
+#else
+        UNSUPPORTED("Dynamic rendering is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    // Marks the render pass as active in the secondary command buffer that was begun with
+    // VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT. No commands are recorded.
+    __forceinline void InheritRenderPass(VkRenderPass  RenderPass,
+                                         VkFramebuffer Framebuffer,
+                                         uint32_t      FramebufferWidth,
+                                         uint32_t      FramebufferHeight)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(!IsInsideRenderPass(), "Current pass has not been ended");
+
+        m_State.RenderPass          = RenderPass;
+        m_State.Framebuffer         = Framebuffer;
+        m_State.FramebufferWidth    = FramebufferWidth;
+        m_State.FramebufferHeight   = FramebufferHeight;
+        m_State.RenderPassInherited = true;
+    }
+
+    // Ends the current render pass instance started by either BeginRenderPass() or BeginRendering()
     __forceinline void EndRenderPass()
     {
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Render pass has not been started");
+        VERIFY(IsInsideRenderPass(), "Render pass has not been started");
+        VERIFY(!m_State.RenderPassInherited, "Render pass inherited by a secondary command buffer can't be ended. "
+                                             "Commands that must be recorded outside of a render pass are not allowed in secondary command buffers.");
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        DILIGENT_VK_CALL(CmdEndRenderPass(m_VkCmdBuffer));
+        if (m_State.DynamicRendering)
+        {
+#if DILIGENT_USE_VOLK
+            DILIGENT_VK_CALL(CmdEndRenderingKHR(m_VkCmdBuffer));
+#else
+            UNSUPPORTED("Dynamic rendering is not supported when vulkan library is linked statically");
+#endif
+            m_State.DynamicRendering = false;
+        }
+        else
+        {
+            DILIGENT_VK_CALL(CmdEndRenderPass(m_VkCmdBuffer));
+        }
         m_State.RenderPass        = VK_NULL_HANDLE;
         m_State.Framebuffer       = VK_NULL_HANDLE;
         m_State.FramebufferWidth  = 0;
@@ -278,11 +347,32 @@ public:
         }
     }
 
-    __forceinline void NextSubpass()
+    __forceinline void NextSubpass(VkSubpassContents Contents = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Render pass has not been started");
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        DILIGENT_VK_CALL(CmdNextSubpass(m_VkCmdBuffer, VK_SUBPASS_CONTENTS_INLINE));
+        DILIGENT_VK_CALL(CmdNextSubpass(m_VkCmdBuffer, Contents));
+    }
+
+    __forceinline void ExecuteCommands(uint32_t               CommandBufferCount,
+                                       const VkCommandBuffer* pCommandBuffers)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR(CommandBufferCount > 0 && pCommandBuffers != nullptr);
+        FlushBarriers();
+        DILIGENT_VK_CALL(CmdExecuteCommands(m_VkCmdBuffer, CommandBufferCount, pCommandBuffers));
+
+        // After vkCmdExecuteCommands, the state of the primary command buffer that was set
+        // before is undefined, except for the render pass instance and queries (6.7)
+        StateCache NewState;
+        NewState.RenderPass         = m_State.RenderPass;
+        NewState.Framebuffer        = m_State.Framebuffer;
+        NewState.FramebufferWidth   = m_State.FramebufferWidth;
+        NewState.FramebufferHeight  = m_State.FramebufferHeight;
+        NewState.InsidePassQueries  = m_State.InsidePassQueries;
+        NewState.OutsidePassQueries = m_State.OutsidePassQueries;
+        NewState.DynamicRendering   = m_State.DynamicRendering;
+        m_State                     = NewState;
     }
 
     __forceinline void EndCommandBuffer()
@@ -308,7 +398,7 @@ public:
         }
     }
 
-    __forceinline void BindGraphicsPipeline(VkPipeline GraphicsPipeline)
+    __forceinline void BindGraphicsPipeline(VkPipeline GraphicsPipeline, bool ExtendedDynamicState = false)
     {
         // 9.8
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
@@ -316,6 +406,11 @@ public:
         {
             DILIGENT_VK_CALL(CmdBindPipeline(m_VkCmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, GraphicsPipeline));
             m_State.GraphicsPipeline = GraphicsPipeline;
+
+            // Binding a pipeline that does not use the extended dynamic state makes
+            // the corresponding dynamic state undefined (10.11).
+            if (!ExtendedDynamicState)
+                m_State.DynamicState = DynamicStateCache{};
         }
     }
 
@@ -354,6 +449,74 @@ public:
         DILIGENT_VK_CALL(CmdSetBlendConstants(m_VkCmdBuffer, BlendConstants));
     }
 
+    __forceinline void SetCullMode(VkCullModeFlags CullMode, VkFrontFace FrontFace)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        auto& DynState = m_State.DynamicState;
+        if (DynState.CullMode != CullMode)
+        {
+            DILIGENT_VK_CALL(CmdSetCullModeEXT(m_VkCmdBuffer, CullMode));
+            DynState.CullMode = CullMode;
+        }
+        if (DynState.FrontFace != FrontFace)
+        {
+            DILIGENT_VK_CALL(CmdSetFrontFaceEXT(m_VkCmdBuffer, FrontFace));
+            DynState.FrontFace = FrontFace;
+        }
+#else
+        UNSUPPORTED("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPrimitiveTopology(VkPrimitiveTopology Topology)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (m_State.DynamicState.PrimitiveTopology != Topology)
+        {
+            DILIGENT_VK_CALL(CmdSetPrimitiveTopologyEXT(m_VkCmdBuffer, Topology));
+            m_State.DynamicState.PrimitiveTopology = Topology;
+        }
+#else
+        UNSUPPORTED("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    // Sets all depth-stencil states that are dynamic in pipelines created with the extended dynamic state.
+    // Only the states that differ from the ones previously set are recorded.
+    __forceinline void SetDepthStencilState(const VkPipelineDepthStencilStateCreateInfo& DSStateCI)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        auto& DynState = m_State.DynamicState;
+        if (DynState.DepthTestEnable != DSStateCI.depthTestEnable)
+        {
+            DILIGENT_VK_CALL(CmdSetDepthTestEnableEXT(m_VkCmdBuffer, DSStateCI.depthTestEnable));
+            DynState.DepthTestEnable = DSStateCI.depthTestEnable;
+        }
+        if (DynState.DepthWriteEnable != DSStateCI.depthWriteEnable)
+        {
+            DILIGENT_VK_CALL(CmdSetDepthWriteEnableEXT(m_VkCmdBuffer, DSStateCI.depthWriteEnable));
+            DynState.DepthWriteEnable = DSStateCI.depthWriteEnable;
+        }
+        if (DynState.DepthCompareOp != DSStateCI.depthCompareOp)
+        {
+            DILIGENT_VK_CALL(CmdSetDepthCompareOpEXT(m_VkCmdBuffer, DSStateCI.depthCompareOp));
+            DynState.DepthCompareOp = DSStateCI.depthCompareOp;
+        }
+        if (DynState.StencilTestEnable != DSStateCI.stencilTestEnable)
+        {
+            DILIGENT_VK_CALL(CmdSetStencilTestEnableEXT(m_VkCmdBuffer, DSStateCI.stencilTestEnable));
+            DynState.StencilTestEnable = DSStateCI.stencilTestEnable;
+        }
+        SetStencilFaceState(VK_STENCIL_FACE_FRONT_BIT, DSStateCI.front, DynState.Front);
+        SetStencilFaceState(VK_STENCIL_FACE_BACK_BIT, DSStateCI.back, DynState.Back);
+#else
+        UNSUPPORTED("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void BindIndexBuffer(VkBuffer Buffer, VkDeviceSize Offset, VkIndexType IndexType)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
@@ -393,7 +556,7 @@ public:
                                              VkPipelineStageFlags           DestStages = 0)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Image layout transitions within a render pass execute
             // dependencies between attachments
@@ -418,7 +581,7 @@ public:
                                            VkPipelineStageFlags DestStages = 0)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Image layout transitions within a render pass execute
             // dependencies between attachments
@@ -442,7 +605,7 @@ public:
                                        VkPipelineStageFlags DestStages = 0)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Image layout transitions within a render pass execute
             // dependencies between attachments
@@ -463,13 +626,24 @@ public:
         DILIGENT_VK_CALL(CmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets));
     }
 
+    __forceinline void PushDescriptorSet(VkPipelineBindPoint         pipelineBindPoint,
+                                         VkPipelineLayout            layout,
+                                         uint32_t                    set,
+                                         uint32_t                    descriptorWriteCount,
+                                         const VkWriteDescriptorSet* pDescriptorWrites)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        // Requires VK_KHR_push_descriptor extension
+        DILIGENT_VK_CALL(CmdPushDescriptorSetKHR(m_VkCmdBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites));
+    }
+
     __forceinline void CopyBuffer(VkBuffer            srcBuffer,
                                   VkBuffer            dstBuffer,
                                   uint32_t            regionCount,
                                   const VkBufferCopy* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Copy buffer operation must be performed outside of render pass.
             EndRenderPass();
@@ -485,7 +659,7 @@ public:
                                  const VkImageCopy* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Copy operations must be performed outside of render pass.
             EndRenderPass();
@@ -501,7 +675,7 @@ public:
                                          const VkBufferImageCopy* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Copy operations must be performed outside of render pass.
             EndRenderPass();
@@ -517,7 +691,7 @@ public:
                                          const VkBufferImageCopy* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Copy operations must be performed outside of render pass.
             EndRenderPass();
@@ -535,7 +709,7 @@ public:
                                  VkFilter           filter)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Blit must be performed outside of render pass.
             EndRenderPass();
@@ -552,7 +726,7 @@ public:
                                     const VkImageResolve* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Resolve must be performed outside of render pass.
             EndRenderPass();
@@ -581,7 +755,7 @@ public:
 
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         DILIGENT_VK_CALL(CmdBeginQuery(m_VkCmdBuffer, queryPool, query, flags));
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
             m_State.InsidePassQueries |= queryFlag;
         else
             m_State.OutsidePassQueries |= queryFlag;
@@ -593,7 +767,7 @@ public:
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         DILIGENT_VK_CALL(CmdEndQuery(m_VkCmdBuffer, queryPool, query));
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             VERIFY((m_State.InsidePassQueries & queryFlag) != 0, "No active inside-pass queries found.");
             m_State.InsidePassQueries &= ~queryFlag;
@@ -618,7 +792,7 @@ public:
                                       uint32_t    queryCount)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Query pool reset must be performed outside of render pass (17.2).
             EndRenderPass();
@@ -635,7 +809,7 @@ public:
                                             VkQueryResultFlags flags)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Copy query results must be performed outside of render pass (17.2).
             EndRenderPass();
@@ -650,7 +824,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Build AS operations must be performed outside of render pass.
             EndRenderPass();
@@ -665,7 +839,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Copy AS operations must be performed outside of render pass.
             EndRenderPass();
@@ -680,7 +854,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (IsInsideRenderPass())
         {
             // Write AS properties operations must be performed outside of render pass.
             EndRenderPass();
@@ -787,25 +961,78 @@ public:
 
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_SupportedStagesMask; }
 
+    // Extended dynamic state values, see BindGraphicsPipeline(). Invalid values force the state to be set.
+    struct DynamicStateCache
+    {
+        VkCullModeFlags     CullMode          = VK_CULL_MODE_FLAG_BITS_MAX_ENUM;
+        VkFrontFace         FrontFace         = VK_FRONT_FACE_MAX_ENUM;
+        VkPrimitiveTopology PrimitiveTopology = VK_PRIMITIVE_TOPOLOGY_MAX_ENUM;
+        VkBool32            DepthTestEnable   = ~0u;
+        VkBool32            DepthWriteEnable  = ~0u;
+        VkCompareOp         DepthCompareOp    = VK_COMPARE_OP_MAX_ENUM;
+        VkBool32            StencilTestEnable = ~0u;
+        VkStencilOpState    Front             = InvalidStencilOpState();
+        VkStencilOpState    Back              = InvalidStencilOpState();
+
+        static constexpr VkStencilOpState InvalidStencilOpState()
+        {
+            return VkStencilOpState{VK_STENCIL_OP_MAX_ENUM, VK_STENCIL_OP_MAX_ENUM, VK_STENCIL_OP_MAX_ENUM, VK_COMPARE_OP_MAX_ENUM, ~0u, ~0u, 0};
+        }
+    };
+
     struct StateCache
     {
-        VkRenderPass  RenderPass         = VK_NULL_HANDLE;
-        VkFramebuffer Framebuffer        = VK_NULL_HANDLE;
-        VkPipeline    GraphicsPipeline   = VK_NULL_HANDLE;
-        VkPipeline    ComputePipeline    = VK_NULL_HANDLE;
-        VkPipeline    RayTracingPipeline = VK_NULL_HANDLE;
-        VkBuffer      IndexBuffer        = VK_NULL_HANDLE;
-        VkDeviceSize  IndexBufferOffset  = 0;
-        VkIndexType   IndexType          = VK_INDEX_TYPE_MAX_ENUM;
-        uint32_t      FramebufferWidth   = 0;
-        uint32_t      FramebufferHeight  = 0;
-        uint32_t      InsidePassQueries  = 0;
-        uint32_t      OutsidePassQueries = 0;
+        VkRenderPass  RenderPass          = VK_NULL_HANDLE;
+        VkFramebuffer Framebuffer         = VK_NULL_HANDLE;
+        VkPipeline    GraphicsPipeline    = VK_NULL_HANDLE;
+        VkPipeline    ComputePipeline     = VK_NULL_HANDLE;
+        VkPipeline    RayTracingPipeline  = VK_NULL_HANDLE;
+        VkBuffer      IndexBuffer         = VK_NULL_HANDLE;
+        VkDeviceSize  IndexBufferOffset   = 0;
+        VkIndexType   IndexType           = VK_INDEX_TYPE_MAX_ENUM;
+        uint32_t      FramebufferWidth    = 0;
+        uint32_t      FramebufferHeight   = 0;
+        uint32_t      InsidePassQueries   = 0;
+        uint32_t      OutsidePassQueries  = 0;
+        bool          DynamicRendering    = false; // Whether a dynamic render pass instance (VK_KHR_dynamic_rendering) is active
+        bool          RenderPassInherited = false; // Whether the render pass is inherited by the secondary command buffer
+
+        DynamicStateCache DynamicState;
     };
 
     const StateCache& GetState() const { return m_State; }
 
+    // Returns true if either a render pass or a dynamic rendering instance is active
+    bool IsInsideRenderPass() const { return m_State.RenderPass != VK_NULL_HANDLE || m_State.DynamicRendering; }
+
 private:
+    __forceinline void SetStencilFaceState(VkStencilFaceFlags FaceMask, const VkStencilOpState& NewState, VkStencilOpState& CurrState)
+    {
+#if DILIGENT_USE_VOLK
+        if (CurrState.failOp != NewState.failOp ||
+            CurrState.passOp != NewState.passOp ||
+            CurrState.depthFailOp != NewState.depthFailOp ||
+            CurrState.compareOp != NewState.compareOp)
+        {
+            DILIGENT_VK_CALL(CmdSetStencilOpEXT(m_VkCmdBuffer, FaceMask, NewState.failOp, NewState.passOp, NewState.depthFailOp, NewState.compareOp));
+            CurrState.failOp      = NewState.failOp;
+            CurrState.passOp      = NewState.passOp;
+            CurrState.depthFailOp = NewState.depthFailOp;
+            CurrState.compareOp   = NewState.compareOp;
+        }
+#endif
+        if (CurrState.compareMask != NewState.compareMask)
+        {
+            DILIGENT_VK_CALL(CmdSetStencilCompareMask(m_VkCmdBuffer, FaceMask, NewState.compareMask));
+            CurrState.compareMask = NewState.compareMask;
+        }
+        if (CurrState.writeMask != NewState.writeMask)
+        {
+            DILIGENT_VK_CALL(CmdSetStencilWriteMask(m_VkCmdBuffer, FaceMask, NewState.writeMask));
+            CurrState.writeMask = NewState.writeMask;
+        }
+    }
+
     StateCache           m_State;
     VkCommandBuffer      m_VkCmdBuffer         = VK_NULL_HANDLE;
     VkPipelineStageFlags m_SupportedStagesMask = ~0u;
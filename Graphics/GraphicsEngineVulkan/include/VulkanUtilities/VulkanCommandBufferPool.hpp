@@ -27,10 +27,11 @@
 
 #pragma once
 
-#include <deque>
+#include <array>
 #include <memory>
 #include <mutex>
-#include <atomic>
+#include <unordered_map>
+#include <vector>
 #include "VulkanHeaders.h"
 #include "VulkanLogicalDevice.hpp"
 #include "VulkanObjectWrappers.hpp"
@@ -38,6 +39,13 @@
 namespace VulkanUtilities
 {
 
+// Command buffers are allocated from per-frame command pools. All buffers allocated from the
+// pool during the frame are returned to it by the release queues when the GPU is done with them,
+// after which the whole pool is reset with vkResetCommandPool. This is cheaper than resetting
+// every buffer individually, and memory of all buffers is recycled at once.
+// Command buffers begun with VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT belong to reusable command
+// lists that may be kept for any number of frames and would prevent frame pools from being reset.
+// They are allocated from a separate pool whose buffers are reset individually when they are begun again.
 class VulkanCommandBufferPool
 {
 public:
@@ -54,25 +62,71 @@ public:
 
     ~VulkanCommandBufferPool();
 
-    VkCommandBuffer GetCommandBuffer(const char* DebugName = "");
+    // Returns the command buffer in the recording state. If pInheritanceInfo is not null, the buffer
+    // is a secondary command buffer that continues the render pass specified by the inheritance info.
+    // UsageFlags are passed to vkBeginCommandBuffer. If they contain VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT,
+    // the buffer is allocated from the pool of reusable command buffers.
+    VkCommandBuffer GetCommandBuffer(const char*                           DebugName        = "",
+                                     const VkCommandBufferInheritanceInfo* pInheritanceInfo = nullptr,
+                                     VkCommandBufferUsageFlags             UsageFlags       = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
     // The GPU must have finished with the command buffer being returned to the pool
-    void RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer);
+    void RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer, VkCommandBufferLevel Level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    // Retires the command pool of the current frame. The pool is reset as soon as all of its
+    // command buffers are returned, and new command buffers are allocated from another pool.
+    void FinishFrame();
 
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_SupportedStagesMask; }
 
 private:
-    // Shared point to logical device must be defined before the command pool
+    struct FramePool
+    {
+        CommandPoolWrapper CmdPool;
+        // Primary and secondary command buffers allocated from the pool
+        std::array<std::vector<VkCommandBuffer>, 2> CmdBuffers;
+        // The number of buffers at the front of each list that have been used since the pool was last reset
+        std::array<size_t, 2> NumUsedBuffers = {};
+        // The number of buffers that have not been returned to the pool
+        uint32_t NumOutstandingBuffers = 0;
+
+        bool IsUnused() const { return NumUsedBuffers[0] == 0 && NumUsedBuffers[1] == 0; }
+    };
+
+    struct ReusablePool
+    {
+        CommandPoolWrapper CmdPool;
+        // Primary and secondary command buffers that have been returned to the pool
+        std::array<std::vector<VkCommandBuffer>, 2> FreeCmdBuffers;
+        // The number of buffers that have not been returned to the pool
+        uint32_t NumOutstandingBuffers = 0;
+    };
+
+    // All methods below require m_Mutex to be locked
+    FramePool*      AcquireFramePool();
+    void            ResetFramePool(FramePool& Pool) const;
+    VkCommandBuffer GetReusableCommandBuffer(VkCommandBufferLevel Level);
+    VkCommandBuffer AllocateCommandBuffer(VkCommandPool vkCmdPool, VkCommandBufferLevel Level) const;
+
+    // Shared point to logical device must be defined before the command pools
     std::shared_ptr<const VulkanLogicalDevice> m_LogicalDevice;
 
-    CommandPoolWrapper m_CmdPool;
+    const HardwareQueueIndex       m_QueueFamilyIndex;
+    const VkCommandPoolCreateFlags m_Flags;
+
+    std::mutex m_Mutex;
+
+    std::vector<std::unique_ptr<FramePool>> m_FramePools;
+    // The pool that command buffers are currently allocated from
+    FramePool* m_pCurrPool = nullptr;
+    // Pools that have been reset and can become current. Pools that are neither current nor
+    // free are retired and wait for their command buffers to be returned.
+    std::vector<FramePool*> m_FreePools;
+    // The pool every command buffer was allocated from. Reusable command buffers are mapped to null.
+    std::unordered_map<VkCommandBuffer, FramePool*> m_CmdBufferPools;
 
-    std::mutex                  m_Mutex;
-    std::deque<VkCommandBuffer> m_CmdBuffers;
-    const VkPipelineStageFlags  m_SupportedStagesMask;
+    ReusablePool m_ReusablePool;
 
-#ifdef DILIGENT_DEVELOPMENT
-    std::atomic<int32_t> m_BuffCounter{0};
-#endif
+    const VkPipelineStageFlags m_SupportedStagesMask;
 };
 
 } // namespace VulkanUtilities
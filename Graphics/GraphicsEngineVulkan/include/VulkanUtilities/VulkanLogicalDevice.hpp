@@ -177,6 +177,8 @@ public:
 
     VkMemoryRequirements GetBufferMemoryRequirements(VkBuffer vkBuffer) const;
     VkMemoryRequirements GetImageMemoryRequirements (VkImage  vkImage ) const;
+    // Also returns whether the implementation requires or prefers a dedicated allocation for the image
+    VkMemoryRequirements GetImageMemoryRequirements (VkImage  vkImage, bool& PrefersDedicatedAllocation) const;
     VkDeviceAddress      GetAccelerationStructureDeviceAddress(VkAccelerationStructureKHR AS) const;
 
     VkResult BindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const;
@@ -29,9 +29,12 @@
 
 #include <mutex>
 #include <array>
+#include <vector>
+#include <memory>
 #include <unordered_map>
 #include <atomic>
 #include <string>
+#include <functional>
 #include "MemoryAllocator.h"
 #include "VariableSizeAllocationsManager.hpp"
 #include "VulkanUtilities/VulkanPhysicalDevice.hpp"
@@ -95,32 +98,37 @@ struct VulkanMemoryAllocation
 class VulkanMemoryPage
 {
 public:
-    VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                     VkDeviceSize          PageSize,
-                     uint32_t              MemoryTypeIndex,
-                     bool                  IsHostVisible,
-                     VkMemoryAllocateFlags AllocateFlags) noexcept;
+    // Standalone pages contain exactly one allocation and are destroyed as soon as the
+    // allocation is released. If pDedicatedInfo is not null, the page is a dedicated
+    // allocation for the image or buffer (VK_KHR_dedicated_allocation).
+    VulkanMemoryPage(VulkanMemoryManager&                    ParentMemoryMgr,
+                     VkDeviceSize                            PageSize,
+                     uint32_t                                MemoryTypeIndex,
+                     bool                                    IsHostVisible,
+                     VkMemoryAllocateFlags                   AllocateFlags,
+                     bool                                    IsStandalone,
+                     const VkMemoryDedicatedAllocateInfoKHR* pDedicatedInfo = nullptr);
     ~VulkanMemoryPage();
 
     // clang-format off
-    VulkanMemoryPage(VulkanMemoryPage&& rhs)noexcept :
-        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
-        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
-        m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
-    {
-        rhs.m_CPUMemory = nullptr;
-    }
-
-    VulkanMemoryPage            (const VulkanMemoryPage&) = delete;
-    VulkanMemoryPage& operator= (VulkanMemoryPage&)       = delete;
-    VulkanMemoryPage& operator= (VulkanMemoryPage&& rhs)  = delete;
+    VulkanMemoryPage            (const VulkanMemoryPage&)  = delete;
+    VulkanMemoryPage            (      VulkanMemoryPage&&) = delete;
+    VulkanMemoryPage& operator= (const VulkanMemoryPage&)  = delete;
+    VulkanMemoryPage& operator= (      VulkanMemoryPage&&) = delete;
 
     bool IsEmpty() const { return m_AllocationMgr.IsEmpty(); }
     bool IsFull()  const { return m_AllocationMgr.IsFull();  }
     VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
-    VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
 
+    // Used size and the size of the largest free block are updated after every allocation
+    // and deallocation and can be read without locking the page.
+    VkDeviceSize GetUsedSize()         const { return m_UsedSize.load();         }
+    VkDeviceSize GetMaxFreeBlockSize() const { return m_MaxFreeBlockSize.load(); }
+
+    uint32_t              GetMemoryTypeIndex() const { return m_MemoryTypeIndex; }
+    VkMemoryAllocateFlags GetAllocateFlags()   const { return m_AllocateFlags;   }
+    bool                  IsStandalone()       const { return m_IsStandalone;    }
+    bool                  IsDedicated()        const { return m_IsDedicated;     }
     // clang-format on
 
     VulkanMemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
@@ -132,6 +140,7 @@ private:
     using AllocationsMgrOffsetType = Diligent::VariableSizeAllocationsManager::OffsetType;
 
     friend struct VulkanMemoryAllocation;
+    friend class VulkanMemoryManager;
 
     // Memory is reclaimed immediately. The application is responsible to ensure it is not in use by the GPU
     void Free(VulkanMemoryAllocation&& Allocation);
@@ -141,6 +150,15 @@ private:
     Diligent::VariableSizeAllocationsManager m_AllocationMgr;
     VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
     void*                                    m_CPUMemory = nullptr;
+    std::atomic<VkDeviceSize>                m_UsedSize{0};
+    std::atomic<VkDeviceSize>                m_MaxFreeBlockSize{0};
+    // Set when an allocation is moved out of the page by the defragmentation pass and
+    // reset when a new allocation is made from the page.
+    std::atomic<bool>                        m_IsEvacuated{false};
+    const uint32_t                           m_MemoryTypeIndex;
+    const VkMemoryAllocateFlags              m_AllocateFlags;
+    const bool                               m_IsStandalone;
+    const bool                               m_IsDedicated;
 };
 
 class VulkanMemoryManager
@@ -164,44 +182,69 @@ public:
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
         m_HostVisibleReserveSize{HostVisibleReserveSize}
     {}
-
-
-    // We have to write this constructor because on msvc default
-    // constructor is not labeled with noexcept, which makes all
-    // std containers use copy instead of move
-    VulkanMemoryManager(VulkanMemoryManager&& rhs)noexcept :
-        m_MgrName         {std::move(rhs.m_MgrName)},
-        m_LogicalDevice   {rhs.m_LogicalDevice     },
-        m_PhysicalDevice  {rhs.m_PhysicalDevice    },
-        m_Allocator       {rhs.m_Allocator         },
-        m_Pages           {std::move(rhs.m_Pages)  },
-
-        m_DeviceLocalPageSize    {rhs.m_DeviceLocalPageSize   },
-        m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
-        m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
-        m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
-
-        //m_CurrUsedSize      {rhs.m_CurrUsedSize},
-        m_PeakUsedSize      {rhs.m_PeakUsedSize     },
-        m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
-    {
-        // clang-format on
-        for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
-            m_CurrUsedSize[i].store(rhs.m_CurrUsedSize[i].load());
-    }
+    // clang-format on
 
     ~VulkanMemoryManager();
 
     // clang-format off
     VulkanMemoryManager            (const VulkanMemoryManager&) = delete;
+    VulkanMemoryManager            (VulkanMemoryManager&&)      = delete;
     VulkanMemoryManager& operator= (const VulkanMemoryManager&) = delete;
     VulkanMemoryManager& operator= (VulkanMemoryManager&&)      = delete;
     // clang-format on
 
     VulkanMemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags);
     VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
-    void                   ShrinkMemory();
+
+    // Allocates memory for the image. Large images and images for which the implementation
+    // prefers a dedicated allocation get their own device memory object.
+    VulkanMemoryAllocation AllocateImageMemory(VkImage vkImage, const VkMemoryRequirements& MemReqs, bool PrefersDedicatedAllocation, VkMemoryPropertyFlags MemoryProps);
+
+    void ShrinkMemory();
+
+    // Returns true if the page is a regular page that is used by less than SparsePageMaxUsedPercent percent.
+    // Allocations from such pages are candidates for relocation by the defragmentation pass.
+    bool IsSparsePage(const VulkanMemoryPage& Page) const;
+
+    // Allocates memory for an allocation that is being moved out of SrcPage. Only regular pages
+    // that are used more than SrcPage are considered, and no new pages are created.
+    // Returns an empty allocation if there is no suitable space.
+    // SrcPage is marked as evacuated and is released by ShrinkMemory() as soon as it becomes
+    // empty, regardless of the reserve size.
+    VulkanMemoryAllocation AllocateForRelocation(VulkanMemoryPage& SrcPage, VkDeviceSize Size, VkDeviceSize Alignment);
+
+    // Returns the total size of the pages released by ShrinkMemory()
+    VkDeviceSize GetReleasedMemorySize() const { return m_ReleasedMemorySize.load(); }
+
+    struct HeapStatistics
+    {
+        // Heap budget reported by VK_EXT_memory_budget extension.
+        // If the extension is not supported, 80% of the heap size.
+        VkDeviceSize Budget = 0;
+
+        // Heap usage by the process reported by VK_EXT_memory_budget extension.
+        // If the extension is not supported, the same as AllocatedSize.
+        VkDeviceSize Usage = 0;
+
+        // Total size of device memory objects allocated by this manager.
+        VkDeviceSize AllocatedSize = 0;
+
+        // Total size of all outstanding allocations.
+        VkDeviceSize UsedSize = 0;
+
+        // The number of device memory objects allocated by this manager.
+        uint32_t MemoryObjectCount = 0;
+
+        // The number of device memory objects that are dedicated allocations.
+        uint32_t DedicatedMemoryObjectCount = 0;
+    };
+    HeapStatistics GetHeapStatistics(uint32_t HeapIndex) const;
+
+    // The callback is called when allocating a new device memory object makes the heap usage
+    // exceed the budget. It is called from the allocating thread after all internal locks have
+    // been released. If no callback is set, the manager logs a warning.
+    using BudgetCallbackType = std::function<void(uint32_t HeapIndex, const HeapStatistics& Stats)>;
+    void SetBudgetCallback(BudgetCallbackType Callback);
 
 protected:
     friend class VulkanMemoryPage;
@@ -209,6 +252,56 @@ protected:
     virtual void OnNewPageCreated(VulkanMemoryPage& NewPage) {}
     virtual void OnPageDestroy(VulkanMemoryPage& Page) {}
 
+    enum SIZE_CLASS : uint8_t
+    {
+        // Allocations that are not larger than 1/SmallAllocationRatio of the page size
+        // are suballocated from small pages to keep them away from large resources.
+        SIZE_CLASS_SMALL = 0,
+
+        // All other allocations that are not larger than half of the page size.
+        SIZE_CLASS_MEDIUM,
+
+        // Larger allocations are placed in standalone pages.
+        SIZE_CLASS_LARGE
+    };
+    static constexpr VkDeviceSize SmallAllocationRatio = 64;
+    static constexpr VkDeviceSize SmallPageRatio       = 4;
+
+    static constexpr VkDeviceSize SparsePageMaxUsedPercent = 50;
+
+    SIZE_CLASS GetSizeClass(VkDeviceSize Size, bool HostVisible) const;
+
+    uint32_t FindMemoryTypeIndex(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps) const;
+
+    std::unique_ptr<VulkanMemoryPage> CreatePage(VkDeviceSize                            PageSize,
+                                                 uint32_t                                MemoryTypeIndex,
+                                                 bool                                    HostVisible,
+                                                 VkMemoryAllocateFlags                   AllocateFlags,
+                                                 bool                                    IsStandalone,
+                                                 const VkMemoryDedicatedAllocateInfoKHR* pDedicatedInfo,
+                                                 bool&                                   ExceedsBudget);
+    void DestroyPage(std::unique_ptr<VulkanMemoryPage> pPage);
+
+    VulkanMemoryAllocation AllocateStandalone(VkDeviceSize                            Size,
+                                              VkDeviceSize                            Alignment,
+                                              uint32_t                                MemoryTypeIndex,
+                                              bool                                    HostVisible,
+                                              VkMemoryAllocateFlags                   AllocateFlags,
+                                              const VkMemoryDedicatedAllocateInfoKHR* pDedicatedInfo);
+
+    // Called by the page when its only allocation is released
+    void OnStandalonePageReleased(VulkanMemoryPage& Page);
+
+    void OnNewAllocation(const VulkanMemoryAllocation& Allocation, bool HostVisible);
+    void OnFreeAllocation(VkDeviceSize Size, uint32_t MemoryTypeIndex, bool IsHostVisble);
+
+    uint32_t GetHeapIndex(uint32_t MemoryTypeIndex) const
+    {
+        return m_PhysicalDevice.GetMemoryProperties().memoryTypes[MemoryTypeIndex].heapIndex;
+    }
+
+    void NotifyBudgetExceeded(uint32_t HeapIndex);
+
     std::string m_MgrName;
 
     const VulkanLogicalDevice&  m_LogicalDevice;
@@ -216,27 +309,30 @@ protected:
 
     Diligent::IMemoryAllocator& m_Allocator;
 
-    std::mutex m_PagesMtx;
     struct MemoryPageIndex
     {
         const uint32_t              MemoryTypeIndex;
         const VkMemoryAllocateFlags AllocateFlags;
         const bool                  IsHostVisible;
+        const SIZE_CLASS            SizeClass;
 
         // clang-format off
         MemoryPageIndex(uint32_t              _MemoryTypeIndex,
                         bool                  _IsHostVisible,
-                        VkMemoryAllocateFlags _AllocateFlags) :
+                        VkMemoryAllocateFlags _AllocateFlags,
+                        SIZE_CLASS            _SizeClass) :
             MemoryTypeIndex{_MemoryTypeIndex},
             AllocateFlags  {_AllocateFlags},
-            IsHostVisible  {_IsHostVisible}
+            IsHostVisible  {_IsHostVisible},
+            SizeClass      {_SizeClass}
         {}
 
         bool operator == (const MemoryPageIndex& rhs)const
         {
             return MemoryTypeIndex == rhs.MemoryTypeIndex &&
                    AllocateFlags   == rhs.AllocateFlags   &&
-                   IsHostVisible   == rhs.IsHostVisible;
+                   IsHostVisible   == rhs.IsHostVisible   &&
+                   SizeClass       == rhs.SizeClass;
         }
         // clang-format on
 
@@ -244,26 +340,57 @@ protected:
         {
             size_t operator()(const MemoryPageIndex& PageIndex) const
             {
-                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible);
+                return Diligent::ComputeHash(PageIndex.MemoryTypeIndex, PageIndex.AllocateFlags, PageIndex.IsHostVisible, PageIndex.SizeClass);
             }
         };
     };
-    std::unordered_multimap<MemoryPageIndex, VulkanMemoryPage, MemoryPageIndex::Hasher> m_Pages;
+
+    // Pages of the same memory type, allocation flags and size class.
+    // Every bucket has its own mutex, so that allocations from different buckets do not contend.
+    struct PageBucket
+    {
+        std::mutex                                     Mtx;
+        std::vector<std::unique_ptr<VulkanMemoryPage>> Pages;
+
+        // Index of the page that served the last allocation. The search for a free block
+        // starts from this page (next-fit).
+        size_t LastUsedPage = 0;
+    };
+    PageBucket& GetBucket(const MemoryPageIndex& PageIdx);
+
+    // Protects the bucket map only. Buckets are never removed.
+    std::mutex m_BucketsMtx;
+
+    std::unordered_map<MemoryPageIndex, std::unique_ptr<PageBucket>, MemoryPageIndex::Hasher> m_Buckets;
+
+    std::mutex m_StandalonePagesMtx;
+
+    std::unordered_map<const VulkanMemoryPage*, std::unique_ptr<VulkanMemoryPage>> m_StandalonePages;
 
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
     const VkDeviceSize m_DeviceLocalReserveSize;
     const VkDeviceSize m_HostVisibleReserveSize;
 
-    void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisble);
+    std::mutex         m_BudgetCallbackMtx;
+    BudgetCallbackType m_BudgetCallback;
 
     // 0 == Device local, 1 == Host-visible
-    std::array<std::atomic<int64_t>, 2> m_CurrUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_PeakUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
-    std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
+    std::array<std::atomic<int64_t>, 2>      m_CurrUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_CurrAllocatedSize = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakAllocatedSize = {};
+
+    // Per-heap statistics
+    std::array<std::atomic<int64_t>, VK_MAX_MEMORY_HEAPS>      m_HeapUsedSize          = {};
+    std::array<std::atomic<VkDeviceSize>, VK_MAX_MEMORY_HEAPS> m_HeapAllocatedSize     = {};
+    std::array<std::atomic<uint32_t>, VK_MAX_MEMORY_HEAPS>     m_HeapMemoryObjectCount = {};
+    std::array<std::atomic<uint32_t>, VK_MAX_MEMORY_HEAPS>     m_HeapDedicatedCount    = {};
+
+    std::atomic<VkDeviceSize> m_ReleasedMemorySize{0};
 
-    // If adding new member, do not forget to update move ctor
+    // Indicates that there may be evacuated pages that have not been released yet
+    std::atomic<bool> m_HasEvacuatedPages{false};
 };
 
 } // namespace VulkanUtilities
@@ -57,6 +57,11 @@ public:
         VkPhysicalDeviceFragmentShadingRateFeaturesKHR    ShadingRate            = {};
         VkPhysicalDeviceFragmentDensityMapFeaturesEXT     FragmentDensityMap     = {}; // Only for desktop devices
         VkPhysicalDeviceMultiviewFeaturesKHR              Multiview              = {}; // Required for RenderPass2
+        VkPhysicalDeviceMultiDrawFeaturesEXT              MultiDraw              = {};
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT   ExtendedDynamicState   = {};
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR       DynamicRendering       = {};
+
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT GraphicsPipelineLibrary = {};
 
         bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
         bool Spirv15              = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
@@ -64,6 +69,9 @@ public:
         bool HasPortabilitySubset = false;
         bool RenderPass2          = false;
         bool DrawIndirectCount    = false;
+        bool PushDescriptor       = false;
+        bool DedicatedAllocation  = false; // VK_KHR_dedicated_allocation with VK_KHR_get_memory_requirements2
+        bool MemoryBudget         = false;
     };
 
     struct ExtensionProperties
@@ -79,6 +87,8 @@ public:
         VkPhysicalDeviceFragmentShadingRatePropertiesKHR    ShadingRate            = {};
         VkPhysicalDeviceFragmentDensityMapPropertiesEXT     FragmentDensityMap     = {};
         VkPhysicalDeviceMultiviewPropertiesKHR              Multiview              = {};
+        VkPhysicalDeviceMultiDrawPropertiesEXT              MultiDraw              = {};
+        VkPhysicalDevicePushDescriptorPropertiesKHR         PushDescriptor         = {};
     };
 
 public:
@@ -109,6 +119,10 @@ public:
     const ExtensionProperties&                  GetExtProperties() const { return m_ExtProperties; }
     const VkPhysicalDeviceMemoryProperties&     GetMemoryProperties() const { return m_MemoryProperties; }
     VkFormatProperties                          GetPhysicalDeviceFormatProperties(VkFormat imageFormat) const;
+
+    // Queries the current memory budget and usage of every memory heap.
+    // Returns false if VK_EXT_memory_budget extension is not supported.
+    bool GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const;
     const std::vector<VkQueueFamilyProperties>& GetQueueProperties() const { return m_QueueFamilyProperties; }
 
 private:
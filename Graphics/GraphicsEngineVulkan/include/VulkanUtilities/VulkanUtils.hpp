@@ -738,6 +738,10 @@ public:
         VkPtr<PFN_vkCmdDrawIndexedIndirectCountKHR> fCmdDrawIndexedIndirectCountKHR;
         VkPtr<PFN_vkCmdDrawIndirectCountKHR>        fCmdDrawIndirectCountKHR;
 #endif /* defined(VK_KHR_draw_indirect_count) */
+#if defined(VK_KHR_dynamic_rendering)
+        VkPtr<PFN_vkCmdBeginRenderingKHR> fCmdBeginRenderingKHR;
+        VkPtr<PFN_vkCmdEndRenderingKHR>   fCmdEndRenderingKHR;
+#endif /* defined(VK_KHR_dynamic_rendering) */
 #if defined(VK_KHR_external_fence_fd)
         VkPtr<PFN_vkGetFenceFdKHR>    fGetFenceFdKHR;
         VkPtr<PFN_vkImportFenceFdKHR> fImportFenceFdKHR;
@@ -38,6 +38,21 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_CommandQueueVk =
     {0x9fbf582f, 0x3069, 0x41b9, {0xac, 0x5, 0x34, 0x4d, 0x5a, 0xf5, 0xce, 0x8c}};
 
+/// Queue submission statistics returned by ICommandQueueVk::GetSubmitStats().
+struct QueueSubmitStatsVk
+{
+    /// The total number of work batches submitted to the queue with Submit(), SubmitCmdBuffer()
+    /// or EnqueueSubmit().
+    Uint64 NumSubmissions DEFAULT_INITIALIZER(0);
+
+    /// The number of work batches that were added to the pending batch by EnqueueSubmit().
+    Uint64 NumBatchedSubmissions DEFAULT_INITIALIZER(0);
+
+    /// The number of vkQueueSubmit calls issued by the queue.
+    Uint64 NumQueueSubmitCalls DEFAULT_INITIALIZER(0);
+};
+typedef struct QueueSubmitStatsVk QueueSubmitStatsVk;
+
 #define DILIGENT_INTERFACE_NAME ICommandQueueVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -86,6 +101,28 @@ DILIGENT_BEGIN_INTERFACE(ICommandQueueVk, ICommandQueue)
     VIRTUAL void METHOD(EnqueueSignal)(THIS_
                                        VkSemaphore vkTimelineSemaphore,
                                        Uint64      Value) PURE;
+
+    /// Adds a given work batch to the pending batch without submitting it to the Vulkan queue
+
+    /// \return Fence value associated with the work batch.
+    ///
+    /// \remarks  The pending batch is submitted by a single vkQueueSubmit call before any other
+    ///           work is submitted to the queue, when the queue is idled or presents an image,
+    ///           or when FlushPendingSubmits() is called. The order of the work batches is preserved.
+    ///           The fence value associated with the work batch is not signaled until the pending
+    ///           batch is submitted.
+    ///
+    ///           All arrays referenced by SubmitInfo are copied, and the caller does not need
+    ///           to keep them alive. The only structure allowed in the pNext chain is
+    ///           VkTimelineSemaphoreSubmitInfo.
+    VIRTUAL Uint64 METHOD(EnqueueSubmit)(THIS_
+                                         const VkSubmitInfo REF SubmitInfo) PURE;
+
+    /// Submits all work batches added to the pending batch by EnqueueSubmit() to the Vulkan queue
+    VIRTUAL void METHOD(FlushPendingSubmits)(THIS) PURE;
+
+    /// Returns the queue submission statistics
+    VIRTUAL QueueSubmitStatsVk METHOD(GetSubmitStats)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -102,6 +139,9 @@ DILIGENT_END_INTERFACE
 #    define ICommandQueueVk_GetQueueFamilyIndex(This)         CALL_IFACE_METHOD(CommandQueueVk, GetQueueFamilyIndex,    This)
 #    define ICommandQueueVk_EnqueueSignalFence(This, ...)     CALL_IFACE_METHOD(CommandQueueVk, EnqueueSignalFence,     This, __VA_ARGS__)
 #    define ICommandQueueVk_EnqueueSignal(This, ...)          CALL_IFACE_METHOD(CommandQueueVk, EnqueueSignal,          This, __VA_ARGS__)
+#    define ICommandQueueVk_EnqueueSubmit(This, ...)          CALL_IFACE_METHOD(CommandQueueVk, EnqueueSubmit,          This, __VA_ARGS__)
+#    define ICommandQueueVk_FlushPendingSubmits(This)         CALL_IFACE_METHOD(CommandQueueVk, FlushPendingSubmits,    This)
+#    define ICommandQueueVk_GetSubmitStats(This)              CALL_IFACE_METHOD(CommandQueueVk, GetSubmitStats,         This)
 
 // clang-format on
 
@@ -39,6 +39,26 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_DeviceContextVk =
     {0x72aeb1ba, 0xc6ad, 0x42ec, {0x88, 0x11, 0x7e, 0xd9, 0xc7, 0x21, 0x76, 0xbb}};
 
+/// Memory defragmentation statistics returned by IDeviceContextVk::DefragmentMemory().
+struct MemoryDefragmentationStatsVk
+{
+    /// The number of buffers moved to other memory pages by this call.
+    Uint32 NumBuffersMoved DEFAULT_INITIALIZER(0);
+
+    /// The number of buffers in sparsely used pages that were not moved by this call
+    /// because of the budget or because there was no space in denser pages.
+    Uint32 NumBuffersRemaining DEFAULT_INITIALIZER(0);
+
+    /// The total size of the buffers moved by this call, in bytes.
+    Uint64 BytesMoved DEFAULT_INITIALIZER(0);
+
+    /// The total size of device memory pages released since the device was created, in bytes.
+    /// Pages that are evacuated by the defragmentation are released regardless of the reserve size
+    /// as soon as the GPU is done with the moved buffers.
+    Uint64 TotalReleasedMemorySize DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryDefragmentationStatsVk MemoryDefragmentationStatsVk;
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -84,6 +104,70 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
     ///           calling IDeviceContext::InvalidateState() and then manually restore all required states via
     ///           appropriate Diligent API calls.
     VIRTUAL VkCommandBuffer METHOD(GetVkCommandBuffer)(THIS) PURE;
+
+    /// Moves buffers from sparsely used device memory pages to denser pages to reduce fragmentation
+
+    /// \param [in]  MaxBytesToMove - the maximum total size of the buffers to move, in bytes.
+    /// \param [out] pStats         - optional pointer to the structure that receives defragmentation statistics.
+    ///
+    /// \remarks  The method is intended to be called once per frame with a small budget, so that
+    ///           the cost of defragmentation is spread over multiple frames.
+    ///
+    ///           Only buffers created with USAGE_DEFAULT or USAGE_IMMUTABLE that are used as vertex, index
+    ///           or indirect draw arguments buffers only, are in a known state and are used by this context only
+    ///           can be moved. Vulkan handles of other resources may be stored in descriptor sets.
+    ///
+    ///           The contents are copied by the commands recorded into this context, and the moved buffers
+    ///           are transitioned back to the states they were in before the move. Moving a buffer changes
+    ///           its Vulkan handle, so an application must not cache the handles returned by IBufferVk::GetVkBuffer().
+    ///           Old buffers are released through the release queue when the GPU is done with them.
+    ///
+    ///           Command lists recorded by deferred contexts reference Vulkan handles that are current at
+    ///           the time of recording and may be executed after the move. Therefore, a buffer that has
+    ///           been used by any command recorded in a deferred context, including state transitions,
+    ///           is permanently excluded from defragmentation. This in particular applies to the buffers
+    ///           used by command lists recorded with COMMAND_LIST_FLAG_REUSABLE, which may be replayed
+    ///           any number of times: such buffers are never moved, even after the list is released.
+    ///
+    ///           The method must only be called for an immediate context outside of a render pass.
+    VIRTUAL void METHOD(DefragmentMemory)(THIS_
+                                          Uint64                        MaxBytesToMove,
+                                          MemoryDefragmentationStatsVk* pStats DEFAULT_VALUE(nullptr)) PURE;
+
+    /// Begins a render pass whose subpasses are recorded into secondary command lists
+
+    /// \param [in] Attribs - The command attributes, see Diligent::BeginRenderPassAttribs for details.
+    ///
+    /// \remarks  The method works the same way as IDeviceContext::BeginRenderPass(), but the contents of every
+    ///           subpass of the render pass must be recorded into secondary command lists by deferred contexts
+    ///           (see IDeviceContextVk::BeginSecondaryCommandList()) and executed with IDeviceContext::ExecuteCommandLists().
+    ///           Draw commands must not be recorded into the immediate context until the render pass ends.
+    ///           The pipeline state must be set again after the render pass ends.
+    ///
+    ///           The method must only be called for an immediate context.
+    VIRTUAL void METHOD(BeginRenderPassWithSecondaryCommandLists)(THIS_
+                                                                  const BeginRenderPassAttribs REF Attribs) PURE;
+
+    /// Begins recording a secondary command list that continues the current subpass of the immediate context
+
+    /// \param [in] pImmediateContext - the immediate context that is inside a render pass begun by
+    ///                                 IDeviceContextVk::BeginRenderPassWithSecondaryCommandLists().
+    ///
+    /// \remarks  The method must be called for a deferred context in place of IDeviceContext::Begin().
+    ///           The deferred context inherits the render pass, the subpass and the framebuffer of the
+    ///           immediate context and may only record commands that are allowed inside a render pass.
+    ///           Resource state transitions are not allowed.
+    ///
+    ///           The immediate context must not change the subpass or end the render pass while secondary
+    ///           command lists are being recorded. The command list returned by IDeviceContext::FinishCommandList()
+    ///           must be executed by the same immediate context in the same subpass. Unlike primary command lists,
+    ///           secondary command lists are not submitted by IDeviceContext::ExecuteCommandLists(), but are
+    ///           executed by the command buffer of the immediate context when it is flushed.
+    ///
+    ///           Every deferred context allocates command buffers from its own command pools, so multiple
+    ///           deferred contexts can record secondary command lists in parallel.
+    VIRTUAL void METHOD(BeginSecondaryCommandList)(THIS_
+                                                   IDeviceContext* pImmediateContext) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -93,8 +177,11 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
-#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
+#    define IDeviceContextVk_TransitionImageLayout(This, ...)                    CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout,                    This, __VA_ARGS__)
+#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)                      CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,                      This, __VA_ARGS__)
+#    define IDeviceContextVk_DefragmentMemory(This, ...)                         CALL_IFACE_METHOD(DeviceContextVk, DefragmentMemory,                         This, __VA_ARGS__)
+#    define IDeviceContextVk_BeginRenderPassWithSecondaryCommandLists(This, ...) CALL_IFACE_METHOD(DeviceContextVk, BeginRenderPassWithSecondaryCommandLists, This, __VA_ARGS__)
+#    define IDeviceContextVk_BeginSecondaryCommandList(This, ...)                CALL_IFACE_METHOD(DeviceContextVk, BeginSecondaryCommandList,                This, __VA_ARGS__)
 
 // clang-format on
 
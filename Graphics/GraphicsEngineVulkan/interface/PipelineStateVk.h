@@ -50,6 +50,13 @@ static const INTERFACE_ID IID_PipelineStateVk =
 DILIGENT_BEGIN_INTERFACE(IPipelineStateVk, IPipelineState)
 {
     /// Returns a pointer to the internal render pass object.
+
+    /// \remarks   If the pipeline was created without an explicit render pass and the device
+    ///            supports dynamic rendering (VK_KHR_dynamic_rendering), no implicit render pass
+    ///            is created and the method returns null. Pipelines that use texture-based
+    ///            shading rate always have a render pass.
+    ///            An application that needs a Vulkan render pass compatible with the pipeline
+    ///            should create the pipeline with an explicit render pass (GraphicsPipelineDesc::pRenderPass).
     VIRTUAL IRenderPassVk* METHOD(GetRenderPass)(THIS) CONST PURE;
 
     /// Returns a Vulkan handle of the internal pipeline state object.
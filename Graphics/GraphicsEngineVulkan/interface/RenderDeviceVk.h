@@ -38,6 +38,87 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_RenderDeviceVk =
     {0xab8cf3a6, 0xd959, 0x41c1, {0xae, 0x0, 0xa5, 0x8a, 0xe9, 0x82, 0xe, 0x6a}};
 
+/// Implicit render pass and framebuffer cache statistics returned by IRenderDeviceVk::GetRenderPassCacheStats().
+
+/// The caches are used by IDeviceContext::SetRenderTargets() when dynamic rendering is not available,
+/// and by pipelines that are created without an explicit render pass.
+struct RenderPassCacheStatsVk
+{
+    /// The number of times an existing implicit render pass was found in the cache.
+    Uint32 RenderPassHitCount DEFAULT_INITIALIZER(0);
+
+    /// The number of implicit render passes created by the cache.
+    Uint32 RenderPassCreationCount DEFAULT_INITIALIZER(0);
+
+    /// The number of times an existing framebuffer was found in the cache.
+    Uint32 FramebufferHitCount DEFAULT_INITIALIZER(0);
+
+    /// The number of framebuffers created by the cache.
+    Uint32 FramebufferCreationCount DEFAULT_INITIALIZER(0);
+};
+typedef struct RenderPassCacheStatsVk RenderPassCacheStatsVk;
+
+/// Graphics pipeline library cache statistics returned by IRenderDeviceVk::GetPipelineLibraryCacheStats().
+
+/// The cache is used by pipelines created with Diligent::PSO_CREATE_FLAG_FAST_LINK flag when
+/// VK_EXT_graphics_pipeline_library extension is supported.
+struct PipelineLibraryCacheStatsVk
+{
+    /// The number of times an existing pipeline library was found in the cache.
+    Uint32 HitCount DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline libraries created by the cache.
+    Uint32 CreationCount DEFAULT_INITIALIZER(0);
+
+    /// The number of pipelines linked from the libraries.
+    Uint32 LinkCount DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline libraries evicted from the cache.
+    Uint32 EvictionCount DEFAULT_INITIALIZER(0);
+};
+typedef struct PipelineLibraryCacheStatsVk PipelineLibraryCacheStatsVk;
+
+/// Memory heap statistics returned by IRenderDeviceVk::GetMemoryHeapStats().
+struct MemoryHeapStatsVk
+{
+    /// Heap budget reported by VK_EXT_memory_budget extension.
+    /// If the extension is not supported, 80% of the heap size.
+    Uint64 Budget DEFAULT_INITIALIZER(0);
+
+    /// Heap usage by the process reported by VK_EXT_memory_budget extension.
+    /// If the extension is not supported, the same as AllocatedSize.
+    Uint64 Usage DEFAULT_INITIALIZER(0);
+
+    /// Total size of the device memory objects allocated by the engine from the heap.
+    Uint64 AllocatedSize DEFAULT_INITIALIZER(0);
+
+    /// Total size of the resources placed in the device memory objects.
+    Uint64 UsedSize DEFAULT_INITIALIZER(0);
+
+    /// The number of device memory objects allocated by the engine from the heap.
+
+    /// Small resources are suballocated from pages that are a quarter of the memory page size
+    /// (see Diligent::EngineVkCreateInfo::DeviceLocalMemoryPageSize and
+    /// Diligent::EngineVkCreateInfo::HostVisibleMemoryPageSize), resources that are not
+    /// larger than half of the page size are suballocated from full-size pages, and larger
+    /// resources get their own memory objects.
+    Uint32 MemoryObjectCount DEFAULT_INITIALIZER(0);
+
+    /// The number of device memory objects that are dedicated allocations (VK_KHR_dedicated_allocation).
+
+    /// Dedicated allocations are used for large images and for images for which
+    /// the implementation prefers a separate memory object.
+    Uint32 DedicatedMemoryObjectCount DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryHeapStatsVk MemoryHeapStatsVk;
+
+/// Callback that is called when allocating a new device memory object makes the heap usage exceed the budget.
+
+/// \param[in] HeapIndex - Index of the memory heap.
+/// \param[in] pStats    - Statistics of the heap after the allocation.
+/// \param[in] pUserData - User data that was passed to IRenderDeviceVk::SetMemoryBudgetCallback().
+typedef void (*MemoryBudgetCallbackVkType)(Uint32 HeapIndex, const MemoryHeapStatsVk* pStats, void* pUserData);
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -157,6 +238,36 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
                                                        VkSemaphore         vkTimelineSemaphore,
                                                        const FenceDesc REF Desc,
                                                        IFence**            ppFence) PURE;
+
+    /// Returns the statistics of the implicit render pass and framebuffer caches.
+
+    /// \note The counters are accumulated over the lifetime of the device.
+    VIRTUAL RenderPassCacheStatsVk METHOD(GetRenderPassCacheStats)(THIS) PURE;
+
+    /// Returns the statistics of the graphics pipeline library cache.
+
+    /// \note The counters are accumulated over the lifetime of the device.
+    ///       Every pipeline created from the libraries looks up one library
+    ///       for each of the four parts of the graphics pipeline.
+    VIRTUAL PipelineLibraryCacheStatsVk METHOD(GetPipelineLibraryCacheStats)(THIS) PURE;
+
+    /// Returns the statistics of the memory heap.
+
+    /// \param [in] HeapIndex - Index of the memory heap. Must be less than the memoryHeapCount member
+    ///                         of VkPhysicalDeviceMemoryProperties struct of the physical device.
+    VIRTUAL MemoryHeapStatsVk METHOD(GetMemoryHeapStats)(THIS_
+                                                         Uint32 HeapIndex) CONST PURE;
+
+    /// Sets the callback that is called when the memory usage of a heap exceeds its budget.
+
+    /// \param [in] Callback  - Callback function, or null to reset the callback.
+    /// \param [in] pUserData - User data that is passed to the callback.
+    ///
+    /// \remarks   The callback is called by the thread that allocates device memory after all internal
+    ///            locks have been released. If no callback is set, the engine logs a warning.
+    VIRTUAL void METHOD(SetMemoryBudgetCallback)(THIS_
+                                                 MemoryBudgetCallbackVkType Callback,
+                                                 void*                      pUserData) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -174,6 +285,10 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateBLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateBLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetRenderPassCacheStats(This)             CALL_IFACE_METHOD(RenderDeviceVk, GetRenderPassCacheStats,        This)
+#    define IRenderDeviceVk_GetPipelineLibraryCacheStats(This)        CALL_IFACE_METHOD(RenderDeviceVk, GetPipelineLibraryCacheStats,   This)
+#    define IRenderDeviceVk_GetMemoryHeapStats(This, ...)             CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryHeapStats,             This, __VA_ARGS__)
+#    define IRenderDeviceVk_SetMemoryBudgetCallback(This, ...)        CALL_IFACE_METHOD(RenderDeviceVk, SetMemoryBudgetCallback,        This, __VA_ARGS__)
 
 // clang-format on
 
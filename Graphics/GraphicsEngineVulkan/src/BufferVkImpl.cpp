@@ -435,6 +435,20 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         }
 
         SetState(InitialState);
+
+        // Vulkan handles of vertex, index and indirect argument buffers are never written to
+        // descriptor sets, so such buffers can be moved to another memory page by the defragmentation
+        // pass. The buffer must be used by a single immediate context that records the copy.
+        constexpr BIND_FLAGS RelocatableBindFlags = BIND_VERTEX_BUFFER | BIND_INDEX_BUFFER | BIND_INDIRECT_DRAW_ARGS;
+
+        const bool IsRelocatable =
+            (m_Desc.Usage == USAGE_DEFAULT || m_Desc.Usage == USAGE_IMMUTABLE) &&
+            (m_Desc.BindFlags & ~RelocatableBindFlags) == 0 &&
+            PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) == 1 &&
+            !m_MemoryAllocation.Page->IsStandalone();
+        m_IsRelocatable.store(IsRelocatable);
+        if (IsRelocatable)
+            pRenderDeviceVk->RegisterRelocatableBuffer(this);
     }
 
     VERIFY_EXPR(IsInKnownState());
@@ -465,6 +479,10 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
 BufferVkImpl::~BufferVkImpl()
 {
+    // This must be done first as the defragmentation pass may be moving the buffer right now
+    if (m_IsRelocatable)
+        m_pDevice->UnregisterRelocatableBuffer(this);
+
     // Vk object can only be destroyed when it is no longer used by the GPU
     if (m_VulkanBuffer != VK_NULL_HANDLE)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_VulkanBuffer), m_Desc.ImmediateContextMask);
@@ -472,6 +490,88 @@ BufferVkImpl::~BufferVkImpl()
         m_pDevice->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.ImmediateContextMask);
 }
 
+void BufferVkImpl::DisableRelocation()
+{
+    if (!m_IsRelocatable.load())
+        return;
+
+    // Unregistering the buffer waits for the defragmentation pass that may be moving it right now,
+    // so the caller that reads the Vulkan handle afterwards always sees the final one.
+    m_pDevice->UnregisterRelocatableBuffer(this);
+    m_IsRelocatable.store(false);
+}
+
+bool BufferVkImpl::CreateRelocatedBuffer(VulkanUtilities::BufferWrapper&          NewBuffer,
+                                         VulkanUtilities::VulkanMemoryAllocation& NewAllocation,
+                                         VkDeviceSize&                            NewAlignedOffset) const
+{
+    VERIFY_EXPR(m_IsRelocatable && m_MemoryAllocation.Page != nullptr);
+
+    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    VkBufferCreateInfo VkBuffCI{};
+    VkBuffCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    VkBuffCI.pNext = nullptr;
+    VkBuffCI.flags = 0;
+    VkBuffCI.size  = m_Desc.Size;
+    VkBuffCI.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    // Relocatable buffers may only have vertex, index and indirect draw args bind flags
+    if ((m_Desc.BindFlags & BIND_VERTEX_BUFFER) != 0)
+        VkBuffCI.usage |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    if ((m_Desc.BindFlags & BIND_INDEX_BUFFER) != 0)
+        VkBuffCI.usage |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    if ((m_Desc.BindFlags & BIND_INDIRECT_DRAW_ARGS) != 0)
+        VkBuffCI.usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    VkBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    VkBuffCI.queueFamilyIndexCount = 0;
+    VkBuffCI.pQueueFamilyIndices   = nullptr;
+
+    NewBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
+
+    const auto  MemReqs = LogicalDevice.GetBufferMemoryRequirements(NewBuffer);
+    const auto& SrcPage = *m_MemoryAllocation.Page;
+    if ((MemReqs.memoryTypeBits & (1u << SrcPage.GetMemoryTypeIndex())) == 0)
+    {
+        UNEXPECTED("The memory type of the original buffer is not compatible with the new buffer");
+        return false;
+    }
+
+    NewAllocation = GetDevice()->GetGlobalMemoryManager().AllocateForRelocation(SrcPage, MemReqs.size, MemReqs.alignment);
+    if (NewAllocation.Page == nullptr)
+        return false;
+
+    NewAlignedOffset = AlignUp(VkDeviceSize{NewAllocation.UnalignedOffset}, MemReqs.alignment);
+    VERIFY(NewAllocation.Size >= MemReqs.size + (NewAlignedOffset - NewAllocation.UnalignedOffset), "Size of memory allocation is too small");
+
+    auto err = LogicalDevice.BindBufferMemory(NewBuffer, NewAllocation.Page->GetVkMemory(), NewAlignedOffset);
+    if (err != VK_SUCCESS)
+    {
+        LOG_ERROR_MESSAGE("Failed to bind memory of the relocated buffer '", m_Desc.Name, '\'');
+        return false;
+    }
+
+    return true;
+}
+
+void BufferVkImpl::CompleteRelocation(VulkanUtilities::BufferWrapper&&          NewBuffer,
+                                      VulkanUtilities::VulkanMemoryAllocation&& NewAllocation,
+                                      VkDeviceSize                              NewAlignedOffset)
+{
+    VERIFY_EXPR(m_IsRelocatable && NewBuffer != VK_NULL_HANDLE && NewAllocation.Page != nullptr);
+
+    // The old buffer may still be used by the GPU
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_VulkanBuffer), m_Desc.ImmediateContextMask);
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.ImmediateContextMask);
+
+    m_VulkanBuffer              = std::move(NewBuffer);
+    m_MemoryAllocation          = std::move(NewAllocation);
+    m_BufferMemoryAlignedOffset = NewAlignedOffset;
+
+    // The contents of the new buffer have just been written by the copy command.
+    // The context transitions the buffer back to its original state.
+    SetState(RESOURCE_STATE_COPY_DEST);
+}
+
 void BufferVkImpl::CreateViewInternal(const BufferViewDesc& OrigViewDesc, IBufferView** ppView, bool bIsDefaultView)
 {
     VERIFY(ppView != nullptr, "Null pointer provided");
@@ -0,0 +1,66 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including neVkigence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly neVkigent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "CommandListVkImpl.hpp"
+#include "RenderDeviceVkImpl.hpp"
+#include "DeviceContextVkImpl.hpp"
+
+namespace Diligent
+{
+
+CommandListVkImpl::~CommandListVkImpl()
+{
+    if (!m_pReusableRes)
+    {
+        VERIFY(m_vkCmdBuff == VK_NULL_HANDLE && !m_pDeferredCtx, "Destroying command list that was never executed");
+        return;
+    }
+
+    // The command buffer of a reusable command list may still be pending execution. It is returned to the pool
+    // of the deferred context once the last submission is complete, while the memory it references is released
+    // after the next submission of the immediate context.
+    const auto CmdQueue  = m_pReusableRes->CmdQueue;
+    const auto QueueMask = Uint64{1} << Uint64{CmdQueue};
+
+    VERIFY_EXPR(m_vkCmdBuff != VK_NULL_HANDLE && m_pDeferredCtx);
+    m_pDeferredCtx.RawPtr<DeviceContextVkImpl>()->DisposeVkCmdBuffer(CmdQueue, m_vkCmdBuff, m_pReusableRes->LastSubmittedFenceValue);
+    m_vkCmdBuff = VK_NULL_HANDLE;
+
+    auto* pDeviceVk = GetDevice();
+    for (auto& Page : m_pReusableRes->UploadPages)
+    {
+        pDeviceVk->SafeReleaseDeviceObject(std::move(Page.MemAllocation), QueueMask);
+        pDeviceVk->SafeReleaseDeviceObject(std::move(Page.Buffer), QueueMask);
+    }
+    pDeviceVk->GetDynamicMemoryManager().ReleaseMasterBlocks(m_pReusableRes->DynamicMasterBlocks, *pDeviceVk, QueueMask);
+    for (auto& Pool : m_pReusableRes->DynamicDescriptorPools)
+        pDeviceVk->GetDynamicDescriptorPool().DisposePool(std::move(Pool), QueueMask);
+}
+
+} // namespace Diligent
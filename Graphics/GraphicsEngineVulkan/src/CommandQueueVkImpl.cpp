@@ -66,6 +66,8 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
 
 CommandQueueVkImpl::~CommandQueueVkImpl()
 {
+    VERIFY(m_NumPendingSubmits == 0, "The queue is destroyed with ", m_NumPendingSubmits, " pending work batches that have never been submitted");
+
     // Fence have resources that will be added to release queue.
     // But release queue will be destroyed after command queue and it will not release new resources.
     if (m_pFence)
@@ -154,6 +156,15 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
 
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
+    m_NumSubmissions.fetch_add(1);
+
+    if (m_NumPendingSubmits != 0)
+    {
+        // Submit the work batch together with the pending ones to preserve the submission order
+        AddPendingSubmit(InSubmitInfo);
+        SubmitPendingBatch(FenceValue);
+        return FenceValue;
+    }
 
     auto NewSyncPoint = CreateSyncPoint(FenceValue);
 
@@ -186,10 +197,18 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
          SubmitInfo.signalSemaphoreCount != 0) ?
         1 :
         0;
-    
-    auto err = DILIGENT_VK_CALL(QueueSubmit(m_VkQueue, SubmitCount, &SubmitInfo, NewSyncPoint->GetFence()));
+
+    SubmitToVkQueue(&SubmitInfo, SubmitCount, std::move(NewSyncPoint), FenceValue);
+
+    return FenceValue;
+}
+
+void CommandQueueVkImpl::SubmitToVkQueue(const VkSubmitInfo* pSubmits, Uint32 SubmitCount, SyncPointVkPtr NewSyncPoint, Uint64 FenceValue)
+{
+    auto err = DILIGENT_VK_CALL(QueueSubmit(m_VkQueue, SubmitCount, pSubmits, NewSyncPoint->GetFence()));
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
     (void)err;
+    m_NumQueueSubmitCalls.fetch_add(1);
 
     VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
     m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
@@ -199,10 +218,151 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
         ThreadingTools::LockHelper Lock2(m_LastSyncPointGuard);
         m_LastSyncPoint = std::move(NewSyncPoint);
     }
+}
+
+Uint64 CommandQueueVkImpl::EnqueueSubmit(const VkSubmitInfo& SubmitInfo)
+{
+    std::lock_guard<std::mutex> Lock{m_QueueMutex};
+
+    const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
+    m_NumSubmissions.fetch_add(1);
+    m_NumBatchedSubmissions.fetch_add(1);
+
+    AddPendingSubmit(SubmitInfo);
+    m_LastPendingFenceValue = FenceValue;
 
     return FenceValue;
 }
 
+void CommandQueueVkImpl::FlushPendingSubmits()
+{
+    std::lock_guard<std::mutex> Lock{m_QueueMutex};
+    if (m_NumPendingSubmits != 0)
+        SubmitPendingBatch(m_LastPendingFenceValue);
+}
+
+SyncPointVkPtr CommandQueueVkImpl::GetLastSyncPoint()
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_QueueMutex};
+        if (m_NumPendingSubmits != 0)
+            SubmitPendingBatch(m_LastPendingFenceValue);
+    }
+
+    ThreadingTools::LockHelper Lock{m_LastSyncPointGuard};
+    return m_LastSyncPoint;
+}
+
+void CommandQueueVkImpl::AddPendingSubmit(const VkSubmitInfo& SubmitInfo)
+{
+    if (m_NumPendingSubmits == m_PendingSubmits.size())
+        m_PendingSubmits.emplace_back();
+
+    auto& Pending = m_PendingSubmits[m_NumPendingSubmits++];
+
+    // clang-format off
+    Pending.WaitSemaphores   .assign(SubmitInfo.pWaitSemaphores,   SubmitInfo.pWaitSemaphores   + SubmitInfo.waitSemaphoreCount);
+    Pending.WaitDstStageMasks.assign(SubmitInfo.pWaitDstStageMask, SubmitInfo.pWaitDstStageMask + SubmitInfo.waitSemaphoreCount);
+    Pending.CmdBuffers       .assign(SubmitInfo.pCommandBuffers,   SubmitInfo.pCommandBuffers   + SubmitInfo.commandBufferCount);
+    Pending.SignalSemaphores .assign(SubmitInfo.pSignalSemaphores, SubmitInfo.pSignalSemaphores + SubmitInfo.signalSemaphoreCount);
+    // clang-format on
+
+    Pending.UseTimelineSemaphores = false;
+    Pending.WaitSemaphoreValues.clear();
+    Pending.SignalSemaphoreValues.clear();
+
+    const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(SubmitInfo.pNext);
+    for (; pStruct != nullptr; pStruct = pStruct->pNext)
+    {
+        if (pStruct->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+        {
+            const auto& TimelineInfo = *reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(pStruct);
+
+            Pending.UseTimelineSemaphores = true;
+            Pending.WaitSemaphoreValues.assign(TimelineInfo.pWaitSemaphoreValues, TimelineInfo.pWaitSemaphoreValues + TimelineInfo.waitSemaphoreValueCount);
+            Pending.SignalSemaphoreValues.assign(TimelineInfo.pSignalSemaphoreValues, TimelineInfo.pSignalSemaphoreValues + TimelineInfo.signalSemaphoreValueCount);
+        }
+        else
+        {
+            DEV_ERROR("Only VkTimelineSemaphoreSubmitInfo is allowed in the pNext chain of the work batch added to the pending batch");
+        }
+    }
+}
+
+void CommandQueueVkImpl::SubmitPendingBatch(Uint64 FenceValue)
+{
+    VERIFY_EXPR(m_NumPendingSubmits != 0);
+    VERIFY_EXPR(FenceValue >= m_LastPendingFenceValue);
+
+    m_TempSubmitInfos.clear();
+    m_TempTimelineSubmitInfos.clear();
+    // Reserve the space to keep the pointers to timeline submit infos valid
+    m_TempSubmitInfos.reserve(m_NumPendingSubmits + 1);
+    m_TempTimelineSubmitInfos.reserve(m_NumPendingSubmits);
+
+    for (size_t i = 0; i < m_NumPendingSubmits; ++i)
+    {
+        const auto& Pending = m_PendingSubmits[i];
+        if (Pending.WaitSemaphores.empty() && Pending.CmdBuffers.empty() && Pending.SignalSemaphores.empty())
+            continue;
+
+        VkSubmitInfo SubmitInfo{};
+        SubmitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        SubmitInfo.pNext                = nullptr;
+        SubmitInfo.waitSemaphoreCount   = static_cast<uint32_t>(Pending.WaitSemaphores.size());
+        SubmitInfo.pWaitSemaphores      = Pending.WaitSemaphores.data();
+        SubmitInfo.pWaitDstStageMask    = Pending.WaitDstStageMasks.data();
+        SubmitInfo.commandBufferCount   = static_cast<uint32_t>(Pending.CmdBuffers.size());
+        SubmitInfo.pCommandBuffers      = Pending.CmdBuffers.data();
+        SubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(Pending.SignalSemaphores.size());
+        SubmitInfo.pSignalSemaphores    = Pending.SignalSemaphores.data();
+
+        if (Pending.UseTimelineSemaphores)
+        {
+            m_TempTimelineSubmitInfos.emplace_back();
+            auto& TimelineInfo                     = m_TempTimelineSubmitInfos.back();
+            TimelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            TimelineInfo.pNext                     = nullptr;
+            TimelineInfo.waitSemaphoreValueCount   = static_cast<uint32_t>(Pending.WaitSemaphoreValues.size());
+            TimelineInfo.pWaitSemaphoreValues      = Pending.WaitSemaphoreValues.data();
+            TimelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(Pending.SignalSemaphoreValues.size());
+            TimelineInfo.pSignalSemaphoreValues    = Pending.SignalSemaphoreValues.data();
+
+            SubmitInfo.pNext = &TimelineInfo;
+        }
+
+        m_TempSubmitInfos.push_back(SubmitInfo);
+    }
+    m_NumPendingSubmits = 0;
+
+    auto NewSyncPoint = CreateSyncPoint(FenceValue);
+
+    m_TempSignalSemaphores.clear();
+    NewSyncPoint->GetSemaphores(m_TempSignalSemaphores);
+    if (!m_TempSignalSemaphores.empty())
+    {
+        // Binary semaphores that synchronize with other queues can not be appended to a work batch
+        // that uses timeline semaphores, so they are signaled by a separate batch. Semaphore signal
+        // operations wait for all commands that occur earlier in submission order.
+        VkSubmitInfo SubmitInfo{};
+        SubmitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        SubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(m_TempSignalSemaphores.size());
+        SubmitInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
+        m_TempSubmitInfos.push_back(SubmitInfo);
+    }
+
+    SubmitToVkQueue(m_TempSubmitInfos.data(), static_cast<Uint32>(m_TempSubmitInfos.size()), std::move(NewSyncPoint), FenceValue);
+}
+
+QueueSubmitStatsVk CommandQueueVkImpl::GetSubmitStats() const
+{
+    QueueSubmitStatsVk Stats;
+    Stats.NumSubmissions        = m_NumSubmissions.load();
+    Stats.NumBatchedSubmissions = m_NumBatchedSubmissions.load();
+    Stats.NumQueueSubmitCalls   = m_NumQueueSubmitCalls.load();
+    return Stats;
+}
+
 Uint64 CommandQueueVkImpl::SubmitCmdBuffer(VkCommandBuffer cmdBuffer)
 {
     VkSubmitInfo SubmitInfo{};
@@ -226,6 +386,9 @@ Uint64 CommandQueueVkImpl::WaitForIdle()
 {
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
 
+    if (m_NumPendingSubmits != 0)
+        SubmitPendingBatch(m_LastPendingFenceValue);
+
     // Update last completed fence value to unlock all waiting events.
     const auto FenceValue = m_NextFenceValue.fetch_add(1);
 
@@ -248,14 +411,22 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
 
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
 
+    if (m_NumPendingSubmits != 0)
+        SubmitPendingBatch(m_LastPendingFenceValue);
+
     auto err = DILIGENT_VK_CALL(QueueSubmit(m_VkQueue, 0, nullptr, vkFence));
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit fence signal command to the command queue");
     (void)err;
+    m_NumQueueSubmitCalls.fetch_add(1);
 }
 
 void CommandQueueVkImpl::EnqueueSignal(VkSemaphore vkTimelineSemaphore, Uint64 Value)
 {
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
+
+    if (m_NumPendingSubmits != 0)
+        SubmitPendingBatch(m_LastPendingFenceValue);
+
     InternalSignalSemaphore(vkTimelineSemaphore, Value);
 }
 
@@ -283,11 +454,16 @@ void CommandQueueVkImpl::InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore
     auto err = DILIGENT_VK_CALL(QueueSubmit(m_VkQueue, 1, &SubmitInfo, VK_NULL_HANDLE));
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit timeline semaphore signal command to the command queue");
     (void)err;
+    m_NumQueueSubmitCalls.fetch_add(1);
 }
 
 VkResult CommandQueueVkImpl::Present(const VkPresentInfoKHR& PresentInfo)
 {
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
+
+    if (m_NumPendingSubmits != 0)
+        SubmitPendingBatch(m_LastPendingFenceValue);
+
     return DILIGENT_VK_CALL(QueuePresentKHR(m_VkQueue, &PresentInfo));
 }
 
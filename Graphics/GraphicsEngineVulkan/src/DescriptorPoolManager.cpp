@@ -53,6 +53,10 @@ VulkanUtilities::DescriptorPoolWrapper DescriptorPoolManager::CreateDescriptorPo
     // return their individual allocations to the pool, i.e. all of vkAllocateDescriptorSets,
     // vkFreeDescriptorSets, and vkResetDescriptorPool are allowed. (13.2.3)
     PoolCI.flags         = m_AllowFreeing ? VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT : 0;
+    // Descriptor sets with layouts that use VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT
+    // must be allocated from pools created with VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT.
+    if (m_UpdateAfterBind)
+        PoolCI.flags |= VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
     PoolCI.maxSets       = m_MaxSets;
     PoolCI.poolSizeCount = static_cast<uint32_t>(m_PoolSizes.size());
     PoolCI.pPoolSizes    = m_PoolSizes.data();
@@ -64,6 +68,13 @@ static std::vector<VkDescriptorPoolSize> PrunePoolSizes(RenderDeviceVkImpl& Devi
     const auto& Feats = DeviceVkImpl.GetLogicalDevice().GetEnabledExtFeatures();
     for (auto iter = PoolSizes.begin(); iter != PoolSizes.end();)
     {
+        // descriptorCount must be greater than 0
+        if (iter->descriptorCount == 0)
+        {
+            iter = PoolSizes.erase(iter);
+            continue;
+        }
+
         switch (iter->type)
         {
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
@@ -83,13 +94,15 @@ DescriptorPoolManager::DescriptorPoolManager(RenderDeviceVkImpl&               D
                                              std::string                       PoolName,
                                              std::vector<VkDescriptorPoolSize> PoolSizes,
                                              uint32_t                          MaxSets,
-                                             bool                              AllowFreeing) noexcept :
+                                             bool                              AllowFreeing,
+                                             bool                              UpdateAfterBind) noexcept :
     // clang-format off
-    m_DeviceVkImpl{DeviceVkImpl        },
-    m_PoolName    {std::move(PoolName) },
-    m_PoolSizes   (PrunePoolSizes(DeviceVkImpl, std::move(PoolSizes))),
-    m_MaxSets     {MaxSets             },
-    m_AllowFreeing{AllowFreeing        }
+    m_DeviceVkImpl   {DeviceVkImpl        },
+    m_PoolName       {std::move(PoolName) },
+    m_PoolSizes      (PrunePoolSizes(DeviceVkImpl, std::move(PoolSizes))),
+    m_MaxSets        {MaxSets             },
+    m_AllowFreeing   {AllowFreeing        },
+    m_UpdateAfterBind{UpdateAfterBind     }
 // clang-format on
 {
 #ifdef DILIGENT_DEVELOPMENT
@@ -315,6 +328,14 @@ void DynamicDescriptorSetAllocator::ReleasePools(Uint64 QueueMask)
     m_AllocatedPools.clear();
 }
 
+void DynamicDescriptorSetAllocator::ExtractPools(std::vector<VulkanUtilities::DescriptorPoolWrapper>& Pools)
+{
+    m_PeakPoolCount = std::max(m_PeakPoolCount, m_AllocatedPools.size());
+    for (auto& Pool : m_AllocatedPools)
+        Pools.emplace_back(std::move(Pool));
+    m_AllocatedPools.clear();
+}
+
 DynamicDescriptorSetAllocator::~DynamicDescriptorSetAllocator()
 {
     DEV_CHECK_ERR(m_AllocatedPools.empty(), "All allocated pools must be returned to the parent descriptor pool manager");
@@ -29,6 +29,9 @@
 
 #include "DeviceContextVkImpl.hpp"
 
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <sstream>
 #include <vector>
 
@@ -184,11 +187,12 @@ void DeviceContextVkImpl::PrepareCommandPool(SoftwareQueueIndex CommandQueueId)
     if (!Pool)
     {
         // Command pools must be thread-safe because command buffers are returned into pools by release queues
-        // potentially running in another thread
+        // potentially running in another thread.
+        // Command buffers are never reset individually as the pools are reset once per frame.
         Pool = std::make_unique<VulkanUtilities::VulkanCommandBufferPool>(
             m_pDevice->GetLogicalDevice().GetSharedPtr(),
             QueueFamilyIndex,
-            VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+            VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
     }
     m_CmdPool = Pool.get();
 
@@ -201,29 +205,94 @@ void DeviceContextVkImpl::PrepareCommandPool(SoftwareQueueIndex CommandQueueId)
     m_Desc.TextureCopyGranularity[2] = QueueInfo.minImageTransferGranularity.depth;
 }
 
-void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId)
+void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId, COMMAND_LIST_FLAGS Flags)
 {
     DEV_CHECK_ERR(IsDeferred(), "Begin() should only be called for deferred contexts.");
     DEV_CHECK_ERR(!IsRecordingDeferredCommands(), "This context is already recording commands. Call FinishCommandList() before beginning new recording.");
+    if ((Flags & COMMAND_LIST_FLAG_REUSABLE) != 0)
+    {
+        // Dynamic memory allocated by the context is transferred to the command list when the recording is finished,
+        // so there must be no allocations that may still be referenced by other command lists.
+        DEV_CHECK_ERR(m_UploadHeap.GetStalePagesCount() == 0 && m_DynamicHeap.GetAllocatedMasterBlockCount() == 0 && m_DynamicDescrSetAllocator.GetAllocatedPoolCount() == 0,
+                      "Deferred context has dynamic allocations from the current frame. Reusable command lists must be recorded "
+                      "after FinishFrame() is called or after another reusable command list is finished.");
+    }
     const SoftwareQueueIndex CommandQueueId{ImmediateContextId};
     PrepareCommandPool(CommandQueueId);
     m_DstImmediateContextId = static_cast<Uint8>(ImmediateContextId);
     VERIFY_EXPR(m_DstImmediateContextId == ImmediateContextId);
     m_pQueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
+
+    if ((Flags & COMMAND_LIST_FLAG_REUSABLE) != 0)
+    {
+        m_RecordingReusableCmdList = true;
+        // Allocate the command buffer now as it must be begun with the simultaneous use flag
+        EnsureVkCmdBuffer();
+    }
+}
+
+void DeviceContextVkImpl::BeginSecondaryCommandList(IDeviceContext* pImmediateContext)
+{
+    DEV_CHECK_ERR(pImmediateContext != nullptr, "Immediate context must not be null");
+    auto* pImmediateCtxVk = ClassPtrCast<DeviceContextVkImpl>(pImmediateContext);
+    DEV_CHECK_ERR(!pImmediateCtxVk->IsDeferred(), "Secondary command lists can only continue render passes of immediate contexts");
+    DEV_CHECK_ERR(pImmediateCtxVk->m_pActiveRenderPass != nullptr && pImmediateCtxVk->m_vkSubpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS,
+                  "The immediate context must be inside a render pass begun by BeginRenderPassWithSecondaryCommandLists()");
+
+    Begin(pImmediateCtxVk->GetContextId(), COMMAND_LIST_FLAG_NONE);
+
+    // Attachment states are managed by the immediate context. The deferred context only needs the render pass
+    // and the framebuffer to bind the subpass render targets and verify pipeline compatibility.
+    m_pActiveRenderPass                   = pImmediateCtxVk->m_pActiveRenderPass;
+    m_pBoundFramebuffer                   = pImmediateCtxVk->m_pBoundFramebuffer;
+    m_SubpassIndex                        = pImmediateCtxVk->m_SubpassIndex;
+    m_RenderPassAttachmentsTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+    SetSubpassRenderTargets();
+
+    m_vkRenderPass              = m_pActiveRenderPass->GetVkRenderPass();
+    m_vkFramebuffer             = m_pBoundFramebuffer->GetVkFramebuffer();
+    m_RecordingSecondaryCmdList = true;
+
+    VkCommandBufferInheritanceInfo InheritanceInfo{};
+    InheritanceInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    InheritanceInfo.pNext                = nullptr;
+    InheritanceInfo.renderPass           = m_vkRenderPass;
+    InheritanceInfo.subpass              = m_SubpassIndex;
+    InheritanceInfo.framebuffer          = m_vkFramebuffer; // Specifying the framebuffer may result in better performance
+    InheritanceInfo.occlusionQueryEnable = VK_FALSE;
+    InheritanceInfo.queryFlags           = 0;
+    InheritanceInfo.pipelineStatistics   = 0;
+
+    VERIFY(m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE, "Deferred context must not have a command buffer at this point");
+    auto vkCmdBuff = m_CmdPool->GetCommandBuffer("", &InheritanceInfo);
+    m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask());
+    m_CommandBuffer.InheritRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+    m_State.NumCommands = 1;
+
+    // Dynamic states are not inherited from the primary command buffer
+    SetViewports(1, nullptr, 0, 0);
 }
 
-void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
+void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue, VkCommandBufferLevel Level)
 {
     VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
-    VERIFY_EXPR(m_CmdPool != nullptr);
+
+    // Note that m_CmdPool can't be used here as a deferred context may already be
+    // recording commands for another queue when its command list is executed.
+    const auto QueueFamilyIndex = HardwareQueueIndex{m_pDevice->GetCommandQueue(CmdQueue).GetQueueFamilyIndex()};
+    auto*      pCmdPool         = m_QueueFamilyCmdPools[QueueFamilyIndex].get();
+    VERIFY_EXPR(pCmdPool != nullptr);
+
     class CmdBufferRecycler
     {
     public:
         // clang-format off
         CmdBufferRecycler(VkCommandBuffer                           _vkCmdBuff,
-                         VulkanUtilities::VulkanCommandBufferPool& _Pool) noexcept :
+                          VulkanUtilities::VulkanCommandBufferPool& _Pool,
+                          VkCommandBufferLevel                      _Level) noexcept :
             vkCmdBuff {_vkCmdBuff},
-            Pool      {&_Pool    }
+            Pool      {&_Pool    },
+            Level     {_Level    }
         {
             VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
         }
@@ -234,7 +303,8 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
 
         CmdBufferRecycler(CmdBufferRecycler&& rhs) noexcept :
             vkCmdBuff {rhs.vkCmdBuff},
-            Pool      {rhs.Pool     }
+            Pool      {rhs.Pool     },
+            Level     {rhs.Level    }
         {
             rhs.vkCmdBuff = VK_NULL_HANDLE;
             rhs.Pool      = nullptr;
@@ -245,24 +315,25 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
         {
             if (Pool != nullptr)
             {
-                Pool->RecycleCommandBuffer(std::move(vkCmdBuff));
+                Pool->RecycleCommandBuffer(std::move(vkCmdBuff), Level);
             }
         }
 
     private:
         VkCommandBuffer                           vkCmdBuff = VK_NULL_HANDLE;
         VulkanUtilities::VulkanCommandBufferPool* Pool      = nullptr;
+        VkCommandBufferLevel                      Level     = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     };
 
     // Discard command buffer directly to the release queue since we know exactly which queue it was submitted to
     // as well as the associated FenceValue.
     auto& ReleaseQueue = m_pDevice->GetReleaseQueue(CmdQueue);
-    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool}, FenceValue);
+    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *pCmdPool, Level}, FenceValue);
 }
 
 inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
 {
-    VERIFY(m_CommandBuffer.GetState().RenderPass == VK_NULL_HANDLE, "Disposing command buffer with unifinished render pass");
+    VERIFY(!m_CommandBuffer.IsInsideRenderPass(), "Disposing command buffer with unifinished render pass");
     auto vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     if (vkCmdBuff != VK_NULL_HANDLE)
     {
@@ -314,7 +385,18 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
         case PIPELINE_TYPE_MESH:
         {
             auto& GraphicsPipeline = pPipelineStateVk->GetGraphicsPipelineDesc();
-            m_CommandBuffer.BindGraphicsPipeline(vkPipeline);
+
+            // Primitive topology is not dynamic in mesh pipelines, so we let the command buffer
+            // invalidate the cached dynamic states in this case.
+            const bool ExtDynamicState = (pPipelineStateVk->GetCreateFlags() & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE) != 0;
+            m_CommandBuffer.BindGraphicsPipeline(vkPipeline, ExtDynamicState && PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS);
+
+            if (ExtDynamicState)
+            {
+                // The base class has reset the dynamic states to the values from the pipeline description.
+                // Only the states that differ from the ones previously recorded will be set.
+                CommitExtendedDynamicState(PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS);
+            }
 
             if (CommitStates)
             {
@@ -415,32 +497,48 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
         const auto* pResourceCache = BindInfo.ResourceCaches[sign];
         DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at index ", sign, " is null");
 
+        const auto* pSignature     = m_pPipelineState->GetResourceSignature(sign);
+        const bool  PushDynamicSet = pSignature->UsesPushDescriptors();
+
         auto& SetInfo = BindInfo.SetInfo[sign];
-        VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE,
+        VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE || PushDynamicSet,
                "At least one descriptor set in the stale SRB must not be NULL. Empty SRBs should not be marked as stale by CommitShaderResources()");
-        const Uint32 SetCount = 1 + (SetInfo.vkSets[1] != VK_NULL_HANDLE ? 1 : 0);
+        // The push descriptor set, if any, is always the last one
+        const Uint32 SetCount = (SetInfo.vkSets[0] != VK_NULL_HANDLE ? 1 : 0) + (SetInfo.vkSets[1] != VK_NULL_HANDLE ? 1 : 0);
 
-        VERIFY_EXPR(SetCount == pResourceCache->GetNumDescriptorSets());
+        VERIFY_EXPR(SetCount + (PushDynamicSet ? 1 : 0) == pResourceCache->GetNumDescriptorSets());
+        VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
 
-        if (SetInfo.DynamicOffsetCount > 0)
+        if (SetCount > 0)
         {
-            VERIFY(m_DynamicBufferOffsets.size() >= SetInfo.DynamicOffsetCount,
-                   "m_DynamicBufferOffsets must've been resized by CommitShaderResources() to have enough space");
+            if (SetInfo.DynamicOffsetCount > 0)
+            {
+                VERIFY(m_DynamicBufferOffsets.size() >= SetInfo.DynamicOffsetCount,
+                       "m_DynamicBufferOffsets must've been resized by CommitShaderResources() to have enough space");
 
-            auto NumOffsetsWritten = pResourceCache->GetDynamicBufferOffsets(GetContextId(), m_DynamicBufferOffsets);
-            VERIFY_EXPR(NumOffsetsWritten == SetInfo.DynamicOffsetCount);
-        }
+                auto NumOffsetsWritten = pResourceCache->GetDynamicBufferOffsets(GetContextId(), m_DynamicBufferOffsets, SetCount);
+                VERIFY_EXPR(NumOffsetsWritten == SetInfo.DynamicOffsetCount);
+            }
 
-        // Note that there is one global dynamic buffer from which all dynamic resources are suballocated in Vulkan back-end,
-        // and this buffer is not resizable, so the buffer handle can never change.
+            // Note that there is one global dynamic buffer from which all dynamic resources are suballocated in Vulkan back-end,
+            // and this buffer is not resizable, so the buffer handle can never change.
 
-        // vkCmdBindDescriptorSets causes the sets numbered [firstSet .. firstSet+descriptorSetCount-1] to use the
-        // bindings stored in pDescriptorSets[0 .. descriptorSetCount-1] for subsequent rendering commands
-        // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
-        // applied via these sets are no longer valid (13.2.5)
-        VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
-        m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, SetCount,
-                                           SetInfo.vkSets.data(), SetInfo.DynamicOffsetCount, m_DynamicBufferOffsets.data());
+            // vkCmdBindDescriptorSets causes the sets numbered [firstSet .. firstSet+descriptorSetCount-1] to use the
+            // bindings stored in pDescriptorSets[0 .. descriptorSetCount-1] for subsequent rendering commands
+            // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
+            // applied via these sets are no longer valid (13.2.5)
+            m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, SetCount,
+                                               SetInfo.vkSets.data(), SetInfo.DynamicOffsetCount, m_DynamicBufferOffsets.data());
+        }
+
+        if (PushDynamicSet)
+        {
+            // Dynamic resources are written directly into the command buffer. Since dynamic buffer offsets
+            // are applied to the descriptors, SRBs with dynamic buffers are pushed again for every draw.
+            pSignature->PushDynamicResources(*pResourceCache, m_CommandBuffer, m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout,
+                                             SetInfo.BaseInd + SetCount, GetContextId());
+            ++m_State.NumCommands;
+        }
 
 #ifdef DILIGENT_DEVELOPMENT
         SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
@@ -469,7 +567,8 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
         DEV_CHECK_ERR((BindInfo.StaleSRBMask & BindInfo.ActiveSRBMask) == 0, "CommitDescriptorSets() must be called before validation.");
 
         const auto& SetInfo = BindInfo.SetInfo[i];
-        const auto  DSCount = pSign->GetNumDescriptorSets();
+        // The push descriptor set is always the last one and has no descriptor set handle
+        const auto DSCount = pSign->GetNumDescriptorSets() - (pSign->UsesPushDescriptors() ? 1 : 0);
         for (Uint32 s = 0; s < DSCount; ++s)
         {
             DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
@@ -527,6 +626,10 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     }
 #endif
 
+    // Write all static and mutable descriptors that were set since the last commit
+    if (ResourceCache.HasPendingDescriptorWrites())
+        ResourceCache.FlushDescriptorWrites(m_pDevice->GetLogicalDevice());
+
     const auto  SRBIndex   = pResBindingVkImpl->GetBindingIndex();
     const auto* pSignature = pResBindingVkImpl->GetSignature();
     auto&       BindInfo   = GetBindInfo(pResBindingVkImpl->GetPipelineType());
@@ -552,24 +655,28 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
 
-        const auto vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
+        // With push descriptors, dynamic resources are written into the command buffer by CommitDescriptorSets()
+        if (!pSignature->UsesPushDescriptors())
+        {
+            const auto vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
 
-        VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
-        const char*     DynamicDescrSetName = "Dynamic Descriptor Set";
+            VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
+            const char*     DynamicDescrSetName = "Dynamic Descriptor Set";
 #ifdef DILIGENT_DEVELOPMENT
-        String _DynamicDescrSetName{DynamicDescrSetName};
-        _DynamicDescrSetName.append(" (");
-        _DynamicDescrSetName.append(pSignature->GetDesc().Name);
-        _DynamicDescrSetName += ')';
-        DynamicDescrSetName = _DynamicDescrSetName.c_str();
+            String _DynamicDescrSetName{DynamicDescrSetName};
+            _DynamicDescrSetName.append(" (");
+            _DynamicDescrSetName.append(pSignature->GetDesc().Name);
+            _DynamicDescrSetName += ')';
+            DynamicDescrSetName = _DynamicDescrSetName.c_str();
 #endif
-        // Allocate vulkan descriptor set for dynamic resources
-        vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
+            // Allocate vulkan descriptor set for dynamic resources
+            vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
 
-        // Write all dynamic resource descriptors
-        pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
+            // Write all dynamic resource descriptors
+            pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
 
-        SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
+            SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
+        }
         ++DSIndex;
     }
 
@@ -596,6 +703,52 @@ void DeviceContextVkImpl::SetBlendFactors(const float* pBlendFactors)
     }
 }
 
+void DeviceContextVkImpl::SetCullMode(CULL_MODE CullMode, Bool FrontCounterClockwise)
+{
+    if (TDeviceContextBase::SetCullMode(CullMode, FrontCounterClockwise, 0))
+    {
+        EnsureVkCmdBuffer();
+        m_CommandBuffer.SetCullMode(CullModeToVkCullMode(m_CullMode), m_FrontCounterClockwise ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE);
+    }
+}
+
+void DeviceContextVkImpl::SetDepthStencilState(const DepthStencilStateDesc& DepthStencilDesc)
+{
+    if (TDeviceContextBase::SetDepthStencilState(DepthStencilDesc, 0))
+    {
+        EnsureVkCmdBuffer();
+        m_CommandBuffer.SetDepthStencilState(DepthStencilStateDesc_To_VkDepthStencilStateCI(m_DepthStencilState));
+    }
+}
+
+void DeviceContextVkImpl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    if (TDeviceContextBase::SetPrimitiveTopology(Topology, 0))
+    {
+        EnsureVkCmdBuffer();
+
+        VkPrimitiveTopology vkTopology         = VK_PRIMITIVE_TOPOLOGY_MAX_ENUM;
+        uint32_t            PatchControlPoints = 0;
+        PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(m_PrimitiveTopology, vkTopology, PatchControlPoints);
+        m_CommandBuffer.SetPrimitiveTopology(vkTopology);
+    }
+}
+
+void DeviceContextVkImpl::CommitExtendedDynamicState(bool CommitTopology)
+{
+    VERIFY_EXPR(m_pPipelineState && (m_pPipelineState->GetCreateFlags() & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE) != 0);
+
+    m_CommandBuffer.SetCullMode(CullModeToVkCullMode(m_CullMode), m_FrontCounterClockwise ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE);
+    m_CommandBuffer.SetDepthStencilState(DepthStencilStateDesc_To_VkDepthStencilStateCI(m_DepthStencilState));
+    if (CommitTopology)
+    {
+        VkPrimitiveTopology vkTopology         = VK_PRIMITIVE_TOPOLOGY_MAX_ENUM;
+        uint32_t            PatchControlPoints = 0;
+        PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(m_PrimitiveTopology, vkTopology, PatchControlPoints);
+        m_CommandBuffer.SetPrimitiveTopology(vkTopology);
+    }
+}
+
 void DeviceContextVkImpl::CommitVkVertexBuffers()
 {
 #ifdef DILIGENT_DEVELOPMENT
@@ -697,8 +850,11 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
         DvpVerifyRenderTargets();
 
-    VERIFY(m_vkRenderPass != VK_NULL_HANDLE, "No render pass is active while executing draw command");
-    VERIFY(m_vkFramebuffer != VK_NULL_HANDLE, "No framebuffer is bound while executing draw command");
+    VERIFY(m_vkRenderPass != VK_NULL_HANDLE || m_UseDynamicRendering, "No render pass is active while executing draw command");
+    VERIFY(m_vkFramebuffer != VK_NULL_HANDLE || m_UseDynamicRendering, "No framebuffer is bound while executing draw command");
+    DEV_CHECK_ERR(m_vkSubpassContents == VK_SUBPASS_CONTENTS_INLINE,
+                  "Draw commands must not be recorded into the immediate context inside a render pass begun by "
+                  "BeginRenderPassWithSecondaryCommandLists(). Record them into secondary command lists instead.");
 #endif
 
     EnsureVkCmdBuffer();
@@ -737,7 +893,9 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     if (m_pPipelineState->GetGraphicsPipelineDesc().pRenderPass == nullptr)
     {
 #ifdef DILIGENT_DEVELOPMENT
-        if (m_pPipelineState->GetRenderPass()->GetVkRenderPass() != m_vkRenderPass)
+        // PSOs that use dynamic rendering have no render pass
+        const auto* pPSORenderPass = m_pPipelineState->GetRenderPass();
+        if ((pPSORenderPass != nullptr ? pPSORenderPass->GetVkRenderPass() : VK_NULL_HANDLE) != m_vkRenderPass)
         {
             // Note that different Vulkan render passes may still be compatible,
             // so we should only verify implicit render passes
@@ -808,6 +966,96 @@ void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     }
 }
 
+void DeviceContextVkImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+
+    PrepareForDraw(Attribs.Flags);
+
+    if (Attribs.DrawCount == 0 || Attribs.NumInstances == 0)
+        return;
+
+    if (m_pDevice->GetFeatures().NativeMultiDraw)
+    {
+        m_vkMultiDrawInfos.resize(Attribs.DrawCount);
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            auto&       Info = m_vkMultiDrawInfos[i];
+
+            Info.firstVertex = Item.StartVertexLocation;
+            Info.vertexCount = Item.NumVertices;
+        }
+
+        // The number of draws in a single command must not exceed maxMultiDrawCount
+        const Uint32 MaxMultiDrawCount = m_pDevice->GetPhysicalDevice().GetExtProperties().MultiDraw.maxMultiDrawCount;
+        VERIFY_EXPR(MaxMultiDrawCount > 0);
+        for (Uint32 FirstDraw = 0; FirstDraw < Attribs.DrawCount; FirstDraw += MaxMultiDrawCount)
+        {
+            const Uint32 DrawCount = std::min(Attribs.DrawCount - FirstDraw, MaxMultiDrawCount);
+            m_CommandBuffer.DrawMulti(DrawCount, &m_vkMultiDrawInfos[FirstDraw], Attribs.NumInstances, Attribs.FirstInstanceLocation);
+            ++m_State.NumCommands;
+        }
+    }
+    else
+    {
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            if (Item.NumVertices > 0)
+            {
+                m_CommandBuffer.Draw(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+                ++m_State.NumCommands;
+            }
+        }
+    }
+}
+
+void DeviceContextVkImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    if (Attribs.DrawCount == 0 || Attribs.NumInstances == 0)
+        return;
+
+    if (m_pDevice->GetFeatures().NativeMultiDraw)
+    {
+        m_vkMultiDrawIndexedInfos.resize(Attribs.DrawCount);
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            auto&       Info = m_vkMultiDrawIndexedInfos[i];
+
+            Info.firstIndex   = Item.FirstIndexLocation;
+            Info.indexCount   = Item.NumIndices;
+            Info.vertexOffset = static_cast<int32_t>(Item.BaseVertex);
+        }
+
+        const Uint32 MaxMultiDrawCount = m_pDevice->GetPhysicalDevice().GetExtProperties().MultiDraw.maxMultiDrawCount;
+        VERIFY_EXPR(MaxMultiDrawCount > 0);
+        for (Uint32 FirstDraw = 0; FirstDraw < Attribs.DrawCount; FirstDraw += MaxMultiDrawCount)
+        {
+            const Uint32 DrawCount = std::min(Attribs.DrawCount - FirstDraw, MaxMultiDrawCount);
+            m_CommandBuffer.DrawMultiIndexed(DrawCount, &m_vkMultiDrawIndexedInfos[FirstDraw], Attribs.NumInstances, Attribs.FirstInstanceLocation);
+            ++m_State.NumCommands;
+        }
+    }
+    else
+    {
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            if (Item.NumIndices > 0)
+            {
+                m_CommandBuffer.DrawIndexed(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+                ++m_State.NumCommands;
+            }
+        }
+    }
+}
+
 void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndirectArguments(Attribs);
@@ -932,7 +1180,7 @@ void DeviceContextVkImpl::PrepareForDispatchCompute()
     EnsureVkCmdBuffer();
 
     // Dispatch commands must be executed outside of render pass
-    if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    if (m_CommandBuffer.IsInsideRenderPass())
         m_CommandBuffer.EndRenderPass();
 
     auto& BindInfo = GetBindInfo(PIPELINE_TYPE_COMPUTE);
@@ -1035,7 +1283,7 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
            "checks if the DSV is bound as a framebuffer attachment and triggers an assert otherwise (in development mode).");
     if (ClearAsAttachment)
     {
-        VERIFY_EXPR(m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_UseDynamicRendering);
         if (m_pActiveRenderPass == nullptr)
         {
             // Render pass may not be currently committed
@@ -1067,7 +1315,7 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
     else
     {
         // End render pass to clear the buffer with vkCmdClearDepthStencilImage
-        if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+        if (m_CommandBuffer.IsInsideRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         auto* pTexture   = pVkDSV->GetTexture();
@@ -1153,7 +1401,7 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const float* RG
 
     if (attachmentIndex != InvalidAttachmentIndex)
     {
-        VERIFY_EXPR(m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_UseDynamicRendering);
         if (m_pActiveRenderPass == nullptr)
         {
             // Render pass may not be currently committed
@@ -1187,7 +1435,7 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const float* RG
         VERIFY(m_pActiveRenderPass == nullptr, "This branch should never execute inside a render pass.");
 
         // End current render pass and clear the image with vkCmdClearColorImage
-        if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+        if (m_CommandBuffer.IsInsideRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         auto* pTexture   = pVkRTV->GetTexture();
@@ -1258,6 +1506,18 @@ void DeviceContextVkImpl::FinishFrame()
     if (!m_MappedTextures.empty())
         LOG_ERROR_MESSAGE("There are mapped textures in the device context when finishing the frame. All dynamic resources must be used in the same frame in which they are mapped.");
 
+    if (!IsDeferred())
+    {
+        // Submit command lists that were added to the pending batch of the queue by ExecuteCommandLists()
+        m_pDevice->LockCmdQueueAndRun(
+            GetCommandQueueId(),
+            [](ICommandQueueVk* pCmdQueueVk) //
+            {
+                pCmdQueueVk->FlushPendingSubmits();
+            } //
+        );
+    }
+
     const Uint64 QueueMask = GetSubmittedBuffersCmdQueueMask();
     VERIFY_EXPR(IsDeferred() || QueueMask == (Uint64{1} << GetCommandQueueId()));
 
@@ -1278,6 +1538,14 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    // Command pools used during this frame are reset when the GPU is done with their command buffers
+    const auto NumQueueFamilies = m_pDevice->GetPhysicalDevice().GetQueueProperties().size();
+    for (size_t i = 0; i < NumQueueFamilies; ++i)
+    {
+        if (auto& Pool = m_QueueFamilyCmdPools[i])
+            Pool->FinishFrame();
+    }
+
     EndFrame();
 }
 
@@ -1317,7 +1585,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
 
         if (m_State.NumCommands != 0)
         {
-            if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+            if (m_CommandBuffer.IsInsideRenderPass())
             {
                 m_CommandBuffer.EndRenderPass();
             }
@@ -1340,6 +1608,16 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         auto* pCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[i]);
         DEV_CHECK_ERR(pCmdListVk != nullptr, "Command list must not be null");
         DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+        DEV_CHECK_ERR(!pCmdListVk->IsSecondary(), "Secondary command lists must be executed inside the render pass they were recorded for");
+        if (pCmdListVk->IsReusable())
+        {
+            DEV_CHECK_ERR(pCmdListVk->GetReusableCmdQueue() == GetCommandQueueId(), "Reusable command list was recorded for immediate context #",
+                          Uint32{pCmdListVk->GetReusableCmdQueue()}, ", but executed by immediate context #", Uint32{GetCommandQueueId()}, ".");
+            // Reusable command list keeps its command buffer until it is destroyed
+            DeferredCtxs.emplace_back();
+            vkCmdBuffs.emplace_back(pCmdListVk->GetReusableVkCmdBuffer());
+            continue;
+        }
         DeferredCtxs.emplace_back();
         vkCmdBuffs.emplace_back();
         pCmdListVk->Close(DeferredCtxs.back(), vkCmdBuffs.back());
@@ -1427,8 +1705,13 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         TimelineSemaphoreSubmitInfo.pSignalSemaphoreValues    = SubmitInfo.signalSemaphoreCount ? m_SignalSemaphoreValues.data() : nullptr;
     }
 
+    // Command lists may be added to the pending batch of the queue that is submitted by the next
+    // explicit flush or FinishFrame(). Fences are signaled by the sync point of the submission,
+    // so the work must be submitted right away when there are fences to signal.
+    const bool DeferSubmission = NumCommandLists != 0 && m_SignalFences.empty() && m_pDevice->IsQueueSubmitBatchingEnabled();
+
     // Submit command buffer even if there are no commands to release stale resources.
-    auto SubmittedFenceValue = m_pDevice->ExecuteCommandBuffer(GetCommandQueueId(), SubmitInfo, &m_SignalFences);
+    auto SubmittedFenceValue = m_pDevice->ExecuteCommandBuffer(GetCommandQueueId(), SubmitInfo, &m_SignalFences, DeferSubmission);
 
     // Recycle semaphores
     {
@@ -1461,6 +1744,15 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
 
     for (Uint32 i = 0; i < NumCommandLists; ++i, ++buff_idx)
     {
+        if (DeferredCtxs[i] == nullptr)
+        {
+            auto* pCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[i]);
+            VERIFY_EXPR(pCmdListVk->IsReusable());
+            // The command buffer is disposed when the command list is destroyed
+            pCmdListVk->OnReusableCmdBufferSubmitted(SubmittedFenceValue);
+            continue;
+        }
+
         auto pDeferredCtxVkImpl = DeferredCtxs[i].RawPtr<DeviceContextVkImpl>();
         // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context
         pDeferredCtxVkImpl->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
@@ -1470,6 +1762,14 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     }
     VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
 
+    // Secondary command buffers have been executed by the command buffer of this context
+    for (auto& SecondaryCmdBuff : m_PendingSecondaryCmdBuffs)
+    {
+        auto pDeferredCtxVkImpl = SecondaryCmdBuff.first.RawPtr<DeviceContextVkImpl>();
+        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), SecondaryCmdBuff.second, SubmittedFenceValue, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    }
+    m_PendingSecondaryCmdBuffs.clear();
+
     m_State    = {};
     m_BindInfo = {};
     m_CommandBuffer.Reset();
@@ -1504,12 +1804,13 @@ void DeviceContextVkImpl::InvalidateState()
         LOG_WARNING_MESSAGE("Invalidating context that has outstanding commands in it. Call Flush() to submit commands for execution");
 
     TDeviceContextBase::InvalidateState();
-    m_State         = {};
-    m_BindInfo      = {};
-    m_vkRenderPass  = VK_NULL_HANDLE;
-    m_vkFramebuffer = VK_NULL_HANDLE;
+    m_State               = {};
+    m_BindInfo            = {};
+    m_vkRenderPass        = VK_NULL_HANDLE;
+    m_vkFramebuffer       = VK_NULL_HANDLE;
+    m_UseDynamicRendering = false;
 
-    VERIFY(m_CommandBuffer.GetState().RenderPass == VK_NULL_HANDLE, "Invalidating context with unifinished render pass");
+    VERIFY(!m_CommandBuffer.IsInsideRenderPass(), "Invalidating context with unifinished render pass");
     m_CommandBuffer.Reset();
 }
 
@@ -1655,9 +1956,24 @@ void DeviceContextVkImpl::CommitRenderPassAndFramebuffer(bool VerifyStates)
     VERIFY(m_pActiveRenderPass == nullptr, "This method must not be called inside an active render pass.");
 
     const auto& CmdBufferState = m_CommandBuffer.GetState();
-    if (CmdBufferState.Framebuffer != m_vkFramebuffer)
+    if (m_UseDynamicRendering)
     {
-        if (CmdBufferState.RenderPass != VK_NULL_HANDLE)
+        if (!CmdBufferState.DynamicRendering)
+        {
+            if (m_CommandBuffer.IsInsideRenderPass())
+                m_CommandBuffer.EndRenderPass();
+#ifdef DILIGENT_DEVELOPMENT
+            if (VerifyStates)
+            {
+                TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            }
+#endif
+            BeginDynamicRendering();
+        }
+    }
+    else if (CmdBufferState.Framebuffer != m_vkFramebuffer)
+    {
+        if (m_CommandBuffer.IsInsideRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         if (m_vkFramebuffer != VK_NULL_HANDLE)
@@ -1674,8 +1990,71 @@ void DeviceContextVkImpl::CommitRenderPassAndFramebuffer(bool VerifyStates)
     }
 }
 
+void DeviceContextVkImpl::BeginDynamicRendering()
+{
+    VERIFY_EXPR(m_UseDynamicRendering && m_pActiveRenderPass == nullptr);
+
+    // Attachments are loaded and stored the same way as in implicit render passes
+    // (see RenderPassCache::GetRenderPass)
+    auto InitAttachment = [](VkRenderingAttachmentInfoKHR& Attachment, VkImageView vkView, VkImageLayout vkLayout) {
+        Attachment.sType              = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        Attachment.pNext              = nullptr;
+        Attachment.imageView          = vkView;
+        Attachment.imageLayout        = vkLayout;
+        Attachment.resolveMode        = VK_RESOLVE_MODE_NONE;
+        Attachment.resolveImageView   = VK_NULL_HANDLE;
+        Attachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        Attachment.loadOp             = VK_ATTACHMENT_LOAD_OP_LOAD;
+        Attachment.storeOp            = VK_ATTACHMENT_STORE_OP_STORE;
+        Attachment.clearValue         = {};
+    };
+
+    // Do not zero-initialize the array
+    std::array<VkRenderingAttachmentInfoKHR, MAX_RENDER_TARGETS> ColorAttachments;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        // Null image view means that the attachment is unused
+        auto* pRTVVk = m_pBoundRenderTargets[rt].RawPtr();
+        InitAttachment(ColorAttachments[rt], pRTVVk != nullptr ? pRTVVk->GetVulkanImageView() : VK_NULL_HANDLE, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    }
+
+    VkRenderingInfoKHR RenderingInfo{};
+    RenderingInfo.sType                = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+    RenderingInfo.renderArea           = {{0, 0}, {m_FramebufferWidth, m_FramebufferHeight}};
+    RenderingInfo.layerCount           = m_FramebufferSlices;
+    RenderingInfo.colorAttachmentCount = m_NumBoundRenderTargets;
+    RenderingInfo.pColorAttachments    = m_NumBoundRenderTargets > 0 ? ColorAttachments.data() : nullptr;
+
+    VkRenderingAttachmentInfoKHR DepthStencilAttachment;
+    if (m_pBoundDepthStencil)
+    {
+        InitAttachment(DepthStencilAttachment, m_pBoundDepthStencil->GetVulkanImageView(), VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+        RenderingInfo.pDepthAttachment = &DepthStencilAttachment;
+        if (GetTextureFormatAttribs(m_pBoundDepthStencil->GetDesc().Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL)
+            RenderingInfo.pStencilAttachment = &DepthStencilAttachment;
+    }
+
+    m_CommandBuffer.BeginRendering(RenderingInfo);
+}
+
 void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
 {
+    // Dynamic rendering does not need render pass and framebuffer objects. Shading rate
+    // attachments are not supported by this path, so caches are used in this case.
+    if (m_pBoundShadingRateMap == nullptr &&
+        m_pDevice->GetLogicalDevice().GetEnabledExtFeatures().DynamicRendering.dynamicRendering != VK_FALSE)
+    {
+        m_vkRenderPass        = VK_NULL_HANDLE;
+        m_vkFramebuffer       = VK_NULL_HANDLE;
+        m_UseDynamicRendering = true;
+
+        // Render targets have changed, so the current rendering instance must be restarted
+        if (m_CommandBuffer.GetState().DynamicRendering)
+            m_CommandBuffer.EndRenderPass();
+        return;
+    }
+    m_UseDynamicRendering = false;
+
     FramebufferCache::FramebufferCacheKey FBKey;
     RenderPassCache::RenderPassCacheKey   RenderPassKey;
     if (m_pBoundDepthStencil)
@@ -1755,14 +2134,27 @@ void DeviceContextVkImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Att
 void DeviceContextVkImpl::ResetRenderTargets()
 {
     TDeviceContextBase::ResetRenderTargets();
-    m_vkRenderPass  = VK_NULL_HANDLE;
-    m_vkFramebuffer = VK_NULL_HANDLE;
-    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    m_vkRenderPass        = VK_NULL_HANDLE;
+    m_vkFramebuffer       = VK_NULL_HANDLE;
+    m_UseDynamicRendering = false;
+    m_vkSubpassContents   = VK_SUBPASS_CONTENTS_INLINE;
+    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.IsInsideRenderPass())
         m_CommandBuffer.EndRenderPass();
     m_State.ShadingRateIsSet = false;
 }
 
 void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    BeginRenderPass(Attribs, VK_SUBPASS_CONTENTS_INLINE);
+}
+
+void DeviceContextVkImpl::BeginRenderPassWithSecondaryCommandLists(const BeginRenderPassAttribs& Attribs)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Render passes with secondary command lists can only be begun by immediate contexts");
+    BeginRenderPass(Attribs, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+}
+
+void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs, VkSubpassContents Contents)
 {
     TDeviceContextBase::BeginRenderPass(Attribs);
 
@@ -1803,10 +2195,21 @@ void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
     }
 
     EnsureVkCmdBuffer();
-    m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight, Attribs.ClearValueCount, pVkClearValues);
+    m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight, Attribs.ClearValueCount, pVkClearValues, Contents);
+    m_vkSubpassContents = Contents;
 
-    // Set the viewport to match the framebuffer size
-    SetViewports(1, nullptr, 0, 0);
+    if (Contents == VK_SUBPASS_CONTENTS_INLINE)
+    {
+        // Set the viewport to match the framebuffer size
+        SetViewports(1, nullptr, 0, 0);
+    }
+    else
+    {
+        // vkCmdExecuteCommands is the only command allowed in the subpass, so only update the cached
+        // viewport. Resetting the pipeline makes SetPipelineState() commit all states after the pass ends.
+        TDeviceContextBase::SetViewports(1, nullptr, 0, 0);
+        m_pPipelineState = nullptr;
+    }
 
     m_State.ShadingRateIsSet = false;
 }
@@ -1815,7 +2218,7 @@ void DeviceContextVkImpl::NextSubpass()
 {
     TDeviceContextBase::NextSubpass();
     VERIFY_EXPR(m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE);
-    m_CommandBuffer.NextSubpass();
+    m_CommandBuffer.NextSubpass(m_vkSubpassContents);
 }
 
 void DeviceContextVkImpl::EndRenderPass()
@@ -2256,7 +2659,22 @@ void DeviceContextVkImpl::UpdateTextureRegion(const void*                    pSr
 void DeviceContextVkImpl::GenerateMips(ITextureView* pTexView)
 {
     TDeviceContextBase::GenerateMips(pTexView);
-    GenerateMipsVkHelper::GenerateMips(*ClassPtrCast<TextureViewVkImpl>(pTexView), *this);
+
+    RefCntAutoPtr<PipelineStateVkImpl> pCurrPSO;
+    if (m_pPipelineState && m_pPipelineState->GetDesc().IsComputePipeline())
+    {
+        // Mips generator may bind its own compute pipeline and descriptor set.
+        // We need to invalidate current PSO and reset it afterwards.
+        pCurrPSO = m_pPipelineState;
+        m_pPipelineState.Release();
+    }
+    GetBindInfo(PIPELINE_TYPE_COMPUTE).MakeAllStale();
+
+    m_pDevice->GetMipsGenerator().GenerateMips(*ClassPtrCast<TextureViewVkImpl>(pTexView), *this);
+    ++m_State.NumCommands;
+
+    if (pCurrPSO)
+        SetPipelineState(pCurrPSO);
 }
 
 static VkBufferImageCopy GetBufferImageCopyInfo(Uint64             BufferOffset,
@@ -2524,9 +2942,21 @@ void DeviceContextVkImpl::UnmapTextureSubresource(ITexture* pTexture,
 void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
 {
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
-    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr || m_RecordingSecondaryCmdList, "Finishing command list inside an active render pass.");
 
-    if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    VkRenderPass vkInheritedRenderPass = VK_NULL_HANDLE;
+    Uint32       InheritedSubpassIndex = 0;
+    if (m_RecordingSecondaryCmdList)
+    {
+        // The render pass continued by the secondary command buffer is ended by the immediate context
+        vkInheritedRenderPass = m_vkRenderPass;
+        InheritedSubpassIndex = m_SubpassIndex;
+        m_pActiveRenderPass.Release();
+        m_pBoundFramebuffer.Release();
+        m_SubpassIndex              = 0;
+        m_RecordingSecondaryCmdList = false;
+    }
+    else if (m_CommandBuffer.IsInsideRenderPass())
     {
         m_CommandBuffer.EndRenderPass();
     }
@@ -2536,7 +2966,22 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to end command buffer");
     (void)err;
 
-    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff)};
+    std::unique_ptr<CommandListVkImpl::ReusableResources> pReusableRes;
+    if (m_RecordingReusableCmdList)
+    {
+        // The command list may be executed after the end of the frame, so it takes over all dynamic
+        // memory and descriptor sets allocated by this context.
+        pReusableRes = std::make_unique<CommandListVkImpl::ReusableResources>();
+
+        pReusableRes->CmdQueue = GetCommandQueueId();
+        m_UploadHeap.ExtractAllocatedPages(pReusableRes->UploadPages);
+        m_DynamicHeap.ExtractMasterBlocks(pReusableRes->DynamicMasterBlocks);
+        m_DynamicDescrSetAllocator.ExtractPools(pReusableRes->DynamicDescriptorPools);
+
+        m_RecordingReusableCmdList = false;
+    }
+
+    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff, vkInheritedRenderPass, InheritedSubpassIndex, std::move(pReusableRes))};
     pCmdListVk->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
     m_CommandBuffer.Reset();
@@ -2558,11 +3003,58 @@ void DeviceContextVkImpl::ExecuteCommandLists(Uint32               NumCommandLis
         return;
     DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
 
+    const auto* pFirstCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[0]);
+    if (pFirstCmdListVk != nullptr && pFirstCmdListVk->IsSecondary())
+    {
+        ExecuteSecondaryCommandLists(NumCommandLists, ppCommandLists);
+        return;
+    }
+
     Flush(NumCommandLists, ppCommandLists);
 
     InvalidateState();
 }
 
+void DeviceContextVkImpl::ExecuteSecondaryCommandLists(Uint32               NumCommandLists,
+                                                       ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass != nullptr && m_vkSubpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS,
+                  "Secondary command lists can only be executed inside a render pass begun by BeginRenderPassWithSecondaryCommandLists()");
+
+    // TODO: replace with small_vector
+    std::vector<VkCommandBuffer> vkCmdBuffs(NumCommandLists);
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        auto* pCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListVk != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(pCmdListVk->IsSecondary(), "Primary and secondary command lists can't be executed by the same call");
+        DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+        DEV_CHECK_ERR(pCmdListVk->GetVkRenderPass() == m_vkRenderPass && pCmdListVk->GetSubpassIndex() == m_SubpassIndex,
+                      "Secondary command list was recorded for another render pass or subpass");
+
+        RefCntAutoPtr<IDeviceContext> pDeferredCtx;
+        pCmdListVk->Close(pDeferredCtx, vkCmdBuffs[i]);
+        VERIFY(vkCmdBuffs[i] != VK_NULL_HANDLE, "Trying to execute empty command buffer");
+        VERIFY_EXPR(pDeferredCtx != nullptr);
+
+        // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context
+        pDeferredCtx.RawPtr<DeviceContextVkImpl>()->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+        // The command buffer is submitted with the command buffer of this context and is disposed by Flush()
+        m_PendingSecondaryCmdBuffs.emplace_back(std::move(pDeferredCtx), vkCmdBuffs[i]);
+    }
+
+    EnsureVkCmdBuffer();
+    m_CommandBuffer.ExecuteCommands(NumCommandLists, vkCmdBuffs.data());
+    ++m_State.NumCommands;
+
+    // The state of the command buffer is undefined after vkCmdExecuteCommands
+    m_State.CommittedVBsUpToDate = false;
+    m_State.CommittedIBUpToDate  = false;
+    m_State.ShadingRateIsSet     = false;
+    m_BindInfo                   = {};
+    m_pPipelineState             = nullptr;
+}
+
 void DeviceContextVkImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
 {
     TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
@@ -2585,6 +3077,7 @@ void DeviceContextVkImpl::WaitForIdle()
 void DeviceContextVkImpl::BeginQuery(IQuery* pQuery)
 {
     TDeviceContextBase::BeginQuery(pQuery, 0);
+    DEV_CHECK_ERR(!m_RecordingReusableCmdList, "Queries can't be used in reusable command lists");
 
     VERIFY(m_pQueryMgr != nullptr || IsDeferred(), "Query manager should never be null for immediate contexts. This might be a bug.");
     DEV_CHECK_ERR(m_pQueryMgr != nullptr, "Query manager is null, which indicates that this deferred context is not in a recording state");
@@ -2633,6 +3126,7 @@ void DeviceContextVkImpl::BeginQuery(IQuery* pQuery)
 void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
 {
     TDeviceContextBase::EndQuery(pQuery, 0);
+    DEV_CHECK_ERR(!m_RecordingReusableCmdList, "Queries can't be used in reusable command lists");
 
     VERIFY(m_pQueryMgr != nullptr || IsDeferred(), "Query manager should never be null for immediate contexts. This might be a bug.");
     DEV_CHECK_ERR(m_pQueryMgr != nullptr, "Query manager is null, which indicates that this deferred context is not in a recording state");
@@ -2660,12 +3154,12 @@ void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
                "No query flag is set which indicates there was no matching BeginQuery call or there was an error while beginning the query.");
         if (CmdBuffState.OutsidePassQueries & (1 << QueryType))
         {
-            if (m_CommandBuffer.GetState().RenderPass)
+            if (m_CommandBuffer.IsInsideRenderPass())
                 m_CommandBuffer.EndRenderPass();
         }
         else
         {
-            if (!m_CommandBuffer.GetState().RenderPass)
+            if (!m_CommandBuffer.IsInsideRenderPass())
                 LOG_ERROR_MESSAGE("The query was started inside render pass, but is being ended oustside of render pass. "
                                   "Vulkan requires that a query must either begin and end inside the same "
                                   "subpass of a render pass instance, or must both begin and end outside of a render pass "
@@ -2852,6 +3346,100 @@ VkCommandBuffer DeviceContextVkImpl::GetVkCommandBuffer()
     return m_CommandBuffer.GetVkCmdBuffer();
 }
 
+void DeviceContextVkImpl::DefragmentMemory(Uint64 MaxBytesToMove, MemoryDefragmentationStatsVk* pStats)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Memory defragmentation is only supported by immediate contexts");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Memory defragmentation is not allowed inside a render pass");
+
+    MemoryDefragmentationStatsVk Stats;
+
+    auto&      MemoryMgr = m_pDevice->GetGlobalMemoryManager();
+    const auto CtxMask   = Uint64{1} << Uint64{GetContextId()};
+
+    m_pDevice->ProcessRelocatableBuffers([&](const std::unordered_set<BufferVkImpl*>& Buffers) {
+        struct RelocationCandidate
+        {
+            BufferVkImpl*                            pBuffer;
+            const VulkanUtilities::VulkanMemoryPage* pPage;
+            VkDeviceSize                             PageUsedSize;
+        };
+        std::vector<RelocationCandidate> Candidates;
+        for (auto* pBuffer : Buffers)
+        {
+            if (pBuffer->GetDesc().ImmediateContextMask != CtxMask || !pBuffer->IsInKnownState())
+                continue;
+
+            const auto* pPage = pBuffer->GetMemoryPage();
+            if (MemoryMgr.IsSparsePage(*pPage))
+                Candidates.push_back({pBuffer, pPage, pPage->GetUsedSize()});
+        }
+
+        // Evacuate the emptiest pages first and keep buffers from the same page together
+        std::sort(Candidates.begin(), Candidates.end(),
+                  [](const RelocationCandidate& lhs, const RelocationCandidate& rhs) {
+                      if (lhs.PageUsedSize != rhs.PageUsedSize)
+                          return lhs.PageUsedSize < rhs.PageUsedSize;
+                      return std::less<const VulkanUtilities::VulkanMemoryPage*>{}(lhs.pPage, rhs.pPage);
+                  });
+
+        for (const auto& Candidate : Candidates)
+        {
+            const auto Size = Candidate.pBuffer->GetDesc().Size;
+            if (Stats.BytesMoved + Size <= MaxBytesToMove && RelocateBuffer(*Candidate.pBuffer))
+            {
+                ++Stats.NumBuffersMoved;
+                Stats.BytesMoved += Size;
+            }
+            else
+            {
+                ++Stats.NumBuffersRemaining;
+            }
+        }
+    });
+
+    // Index buffer and indirect arguments are bound by every draw command, but
+    // vertex buffers need to be rebound as their Vulkan handles may have changed.
+    if (Stats.NumBuffersMoved > 0)
+        m_State.CommittedVBsUpToDate = false;
+
+    Stats.TotalReleasedMemorySize = MemoryMgr.GetReleasedMemorySize();
+    if (pStats != nullptr)
+        *pStats = Stats;
+}
+
+bool DeviceContextVkImpl::RelocateBuffer(BufferVkImpl& BufferVk)
+{
+    VulkanUtilities::BufferWrapper          NewBuffer;
+    VulkanUtilities::VulkanMemoryAllocation NewAllocation;
+    VkDeviceSize                            NewAlignedOffset = 0;
+    if (!BufferVk.CreateRelocatedBuffer(NewBuffer, NewAllocation, NewAlignedOffset))
+        return false;
+
+    // Only buffers in a known state are relocated
+    VERIFY_EXPR(BufferVk.IsInKnownState());
+    const auto OriginalState = BufferVk.GetState();
+
+    EnsureVkCmdBuffer();
+    TransitionOrVerifyBufferState(BufferVk, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_COPY_SOURCE, VK_ACCESS_TRANSFER_READ_BIT,
+                                  "Moving buffer to another memory page (DeviceContextVkImpl::DefragmentMemory)");
+
+    // The new memory is either fresh or was released through the release queue,
+    // so no barrier is required before the copy.
+    VkBufferCopy CopyRegion;
+    CopyRegion.srcOffset = 0;
+    CopyRegion.dstOffset = 0;
+    CopyRegion.size      = BufferVk.GetDesc().Size;
+    m_CommandBuffer.CopyBuffer(BufferVk.GetVkBuffer(), NewBuffer, 1, &CopyRegion);
+    ++m_State.NumCommands;
+
+    BufferVk.CompleteRelocation(std::move(NewBuffer), std::move(NewAllocation), NewAlignedOffset);
+
+    // The move must be transparent to the application, so make the copy visible and
+    // return the new buffer to the state the original buffer was in.
+    TransitionBufferState(BufferVk, RESOURCE_STATE_COPY_DEST, OriginalState, true);
+    return true;
+}
+
 void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateBufferState)
 {
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
@@ -2905,6 +3493,12 @@ void DeviceContextVkImpl::TransitionOrVerifyBufferState(BufferVkImpl&
                                                         VkAccessFlagBits               ExpectedAccessFlags,
                                                         const char*                    OperationName)
 {
+    // Every command that uses a buffer goes through this method. Command lists recorded by deferred
+    // contexts may be executed or replayed after the defragmentation pass has moved the buffer and
+    // released its old Vulkan handle, so buffers referenced by deferred contexts are never moved.
+    if (IsDeferred())
+        Buffer.DisableRelocation();
+
     if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
         VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
@@ -3108,6 +3702,9 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
         }
         else if (RefCntAutoPtr<BufferVkImpl> pBuffer{Barrier.pResource, IID_BufferVk})
         {
+            // See TransitionOrVerifyBufferState()
+            if (IsDeferred())
+                pBuffer->DisableRelocation();
             TransitionBufferState(*pBuffer, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
         }
         else if (RefCntAutoPtr<BottomLevelASVkImpl> pBottomLevelAS{Barrier.pResource, IID_BottomLevelAS})
@@ -3370,47 +3967,71 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
 
     if (Attribs.Update)
     {
-        if (!pTLASVk->UpdateInstances(Attribs.pInstances, Attribs.InstanceCount, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
+        if (!pTLASVk->UpdateInstances(Attribs))
             return;
     }
     else
     {
-        if (!pTLASVk->SetInstanceData(Attribs.pInstances, Attribs.InstanceCount, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
+        if (!pTLASVk->SetInstanceData(Attribs))
             return;
     }
 
-    // copy instance data into instance buffer
+    if (Attribs.BLASTransitionMode != RESOURCE_STATE_TRANSITION_MODE_NONE)
+    {
+        pTLASVk->ProcessBLASes([&](BottomLevelASVkImpl& BLAS) {
+            TransitionOrVerifyBLASState(BLAS, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+        });
+    }
+
+    // Copy the data of dirty instances into the instance buffer. The data of other instances is left intact.
+    if (const auto DirtyInstanceCount = pTLASVk->GetDirtyInstanceCount())
     {
-        size_t Size     = Attribs.InstanceCount * sizeof(VkAccelerationStructureInstanceKHR);
-        auto   TmpSpace = m_UploadHeap.Allocate(Size, 16);
+        const size_t Size     = size_t{DirtyInstanceCount} * sizeof(VkAccelerationStructureInstanceKHR);
+        auto         TmpSpace = m_UploadHeap.Allocate(Size, 16);
+        auto* const  pDstInst = static_cast<VkAccelerationStructureInstanceKHR*>(TmpSpace.CPUAddress);
 
-        for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
+        pTLASVk->ProcessDirtyInstances(
+            [&](Uint32 InstIndex, Uint32 DstIndex) //
+            {
+                const auto& Inst     = Attribs.pInstances[pTLASVk->GetSrcInstanceIndex(InstIndex)];
+                const auto& InstDesc = pTLASVk->GetInstance(InstIndex);
+                auto&       vkASInst = pDstInst[DstIndex];
+
+                static_assert(sizeof(vkASInst.transform) == sizeof(Inst.Transform), "size mismatch");
+                std::memcpy(&vkASInst.transform, Inst.Transform.data, sizeof(vkASInst.transform));
+
+                vkASInst.instanceCustomIndex                    = Inst.CustomId;
+                vkASInst.instanceShaderBindingTableRecordOffset = InstDesc.ContributionToHitGroupIndex;
+                vkASInst.mask                                   = Inst.Mask;
+                vkASInst.flags                                  = InstanceFlagsToVkGeometryInstanceFlags(Inst.Flags);
+                vkASInst.accelerationStructureReference         = InstDesc.pBLAS->GetVkDeviceAddress();
+            });
+
+        const auto& DirtyRanges = pTLASVk->GetDirtyInstanceRanges();
+        if (DirtyRanges.size() == 1)
         {
-            const auto& Inst     = Attribs.pInstances[i];
-            const auto  InstDesc = pTLASVk->GetInstanceDesc(Inst.InstanceName);
+            const auto DstOffset = Attribs.InstanceBufferOffset + Uint64{DirtyRanges[0].First} * sizeof(VkAccelerationStructureInstanceKHR);
+            UpdateBufferRegion(pInstancesVk, DstOffset, Size, TmpSpace.vkBuffer, TmpSpace.AlignedOffset, Attribs.InstanceBufferTransitionMode);
+        }
+        else
+        {
+            // Copy all ranges with a single command
+            TransitionOrVerifyBufferState(*pInstancesVk, Attribs.InstanceBufferTransitionMode, RESOURCE_STATE_COPY_DEST, VK_ACCESS_TRANSFER_WRITE_BIT, OpName);
 
-            if (InstDesc.InstanceIndex >= Attribs.InstanceCount)
+            std::vector<VkBufferCopy> CopyRegions(DirtyRanges.size());
+            VkDeviceSize              SrcOffset = TmpSpace.AlignedOffset;
+            for (size_t i = 0; i < DirtyRanges.size(); ++i)
             {
-                UNEXPECTED("Failed to find instance by name");
-                return;
+                auto& Region     = CopyRegions[i];
+                Region.srcOffset = SrcOffset;
+                Region.dstOffset = Attribs.InstanceBufferOffset + Uint64{DirtyRanges[i].First} * sizeof(VkAccelerationStructureInstanceKHR);
+                Region.size      = Uint64{DirtyRanges[i].Count} * sizeof(VkAccelerationStructureInstanceKHR);
+                SrcOffset += Region.size;
             }
-
-            auto& vkASInst = static_cast<VkAccelerationStructureInstanceKHR*>(TmpSpace.CPUAddress)[InstDesc.InstanceIndex];
-            auto* pBLASVk  = ClassPtrCast<BottomLevelASVkImpl>(Inst.pBLAS);
-
-            static_assert(sizeof(vkASInst.transform) == sizeof(Inst.Transform), "size mismatch");
-            std::memcpy(&vkASInst.transform, Inst.Transform.data, sizeof(vkASInst.transform));
-
-            vkASInst.instanceCustomIndex                    = Inst.CustomId;
-            vkASInst.instanceShaderBindingTableRecordOffset = InstDesc.ContributionToHitGroupIndex;
-            vkASInst.mask                                   = Inst.Mask;
-            vkASInst.flags                                  = InstanceFlagsToVkGeometryInstanceFlags(Inst.Flags);
-            vkASInst.accelerationStructureReference         = pBLASVk->GetVkDeviceAddress();
-
-            TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
+            VERIFY(pInstancesVk->m_VulkanBuffer != VK_NULL_HANDLE, "Copy destination buffer must not be suballocated");
+            m_CommandBuffer.CopyBuffer(TmpSpace.vkBuffer, pInstancesVk->GetVkBuffer(), static_cast<uint32_t>(CopyRegions.size()), CopyRegions.data());
+            ++m_State.NumCommands;
         }
-
-        UpdateBufferRegion(pInstancesVk, Attribs.InstanceBufferOffset, Size, TmpSpace.vkBuffer, TmpSpace.AlignedOffset, Attribs.InstanceBufferTransitionMode);
     }
     TransitionOrVerifyBufferState(*pInstancesVk, Attribs.InstanceBufferTransitionMode, RESOURCE_STATE_BUILD_AS_READ, VK_ACCESS_SHADER_READ_BIT, OpName);
 
@@ -30,6 +30,8 @@
 
 #include "pch.h"
 #include <array>
+#include <algorithm>
+#include <cstring>
 #include "EngineFactoryVk.h"
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
@@ -831,7 +833,7 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
             // clang-format on
             {
                 VERIFY(PhysicalDevice->IsExtensionSupported(VK_KHR_MAINTENANCE3_EXTENSION_NAME), "VK_KHR_maintenance3 extension must be supported");
-                VERIFY(PhysicalDevice->IsExtensionSupported(VK_KHR_MAINTENANCE3_EXTENSION_NAME), "VK_EXT_descriptor_indexing extension must be supported");
+                VERIFY(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME), "VK_EXT_descriptor_indexing extension must be supported");
                 DeviceExtensions.push_back(VK_KHR_MAINTENANCE3_EXTENSION_NAME); // required for VK_EXT_descriptor_indexing
                 DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
 
@@ -956,6 +958,28 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.HostQueryReset.pNext;
             }
 
+            if (EnabledFeatures.NativeMultiDraw != DEVICE_FEATURE_STATE_DISABLED)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_MULTI_DRAW_EXTENSION_NAME);
+
+                EnabledExtFeats.MultiDraw = DeviceExtFeatures.MultiDraw;
+
+                *NextExt = &EnabledExtFeats.MultiDraw;
+                NextExt  = &EnabledExtFeats.MultiDraw.pNext;
+            }
+
+            if (EnabledFeatures.ExtendedDynamicState != DEVICE_FEATURE_STATE_DISABLED)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+
+                EnabledExtFeats.ExtendedDynamicState = DeviceExtFeatures.ExtendedDynamicState;
+
+                *NextExt = &EnabledExtFeats.ExtendedDynamicState;
+                NextExt  = &EnabledExtFeats.ExtendedDynamicState.pNext;
+            }
+
             if (EnabledFeatures.VariableRateShading != DEVICE_FEATURE_STATE_DISABLED)
             {
                 if (DeviceExtFeatures.ShadingRate.pipelineFragmentShadingRate != VK_FALSE ||
@@ -1008,6 +1032,77 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 }
             }
 
+            // Dynamic rendering is used in place of implicit render passes and framebuffers
+            if (DeviceExtFeatures.DynamicRendering.dynamicRendering != VK_FALSE)
+            {
+                // Some of the dependencies may have already been enabled for the shading rate
+                const char* RequiredExtensions[] = {
+                    VK_KHR_MAINTENANCE2_EXTENSION_NAME,
+                    VK_KHR_MULTIVIEW_EXTENSION_NAME,
+                    VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+                    VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME,
+                    VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME //
+                };
+                for (const char* ExtName : RequiredExtensions)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(ExtName));
+                    auto it = std::find_if(DeviceExtensions.begin(), DeviceExtensions.end(),
+                                           [ExtName](const char* Name) { return strcmp(Name, ExtName) == 0; });
+                    if (it == DeviceExtensions.end())
+                        DeviceExtensions.push_back(ExtName);
+                }
+
+                EnabledExtFeats.DynamicRendering = DeviceExtFeatures.DynamicRendering;
+
+                *NextExt = &EnabledExtFeats.DynamicRendering;
+                NextExt  = &EnabledExtFeats.DynamicRendering.pNext;
+            }
+
+            // Graphics pipeline libraries are used by pipelines created with PSO_CREATE_FLAG_FAST_LINK flag
+            if (DeviceExtFeatures.GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+                DeviceExtensions.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+                EnabledExtFeats.GraphicsPipelineLibrary = DeviceExtFeatures.GraphicsPipelineLibrary;
+
+                *NextExt = &EnabledExtFeats.GraphicsPipelineLibrary;
+                NextExt  = &EnabledExtFeats.GraphicsPipelineLibrary.pNext;
+            }
+
+            // Push descriptors are used by resource signatures with PIPELINE_RESOURCE_SIGNATURE_FLAG_PUSH_DYNAMIC_RESOURCES flag
+            if (DeviceExtFeatures.PushDescriptor)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+                EnabledExtFeats.PushDescriptor = true;
+            }
+
+            // Dedicated allocations are used by the memory manager for large images and
+            // images for which the implementation prefers a separate memory object
+            if (DeviceExtFeatures.DedicatedAllocation)
+            {
+                for (const char* ExtName : {VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME, VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME})
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(ExtName));
+                    auto it = std::find_if(DeviceExtensions.begin(), DeviceExtensions.end(),
+                                           [ExtName](const char* Name) { return strcmp(Name, ExtName) == 0; });
+                    if (it == DeviceExtensions.end())
+                        DeviceExtensions.push_back(ExtName);
+                }
+                EnabledExtFeats.DedicatedAllocation = true;
+            }
+
+            // Memory budget is used by the memory manager to track heap usage
+            if (DeviceExtFeatures.MemoryBudget)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+                EnabledExtFeats.MemoryBudget = true;
+            }
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
@@ -1018,7 +1113,7 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
         }
 
 #if defined(_MSC_VER) && defined(_WIN64)
-        static_assert(sizeof(Diligent::DeviceFeatures) == 38, "Did you add a new feature to DeviceFeatures? Please handle its satus here.");
+        static_assert(sizeof(Diligent::DeviceFeatures) == 40, "Did you add a new feature to DeviceFeatures? Please handle its satus here.");
 #endif
 
         for (Uint32 i = 0; i < EngineCI.DeviceExtensionCount; ++i)
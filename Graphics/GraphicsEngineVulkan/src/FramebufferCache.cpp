@@ -76,10 +76,13 @@ VkFramebuffer FramebufferCache::GetFramebuffer(const FramebufferCacheKey& Key, u
     auto it = m_Cache.find(Key);
     if (it != m_Cache.end())
     {
+        ++m_Stats.HitCount;
         return it->second;
     }
     else
     {
+        ++m_Stats.CreationCount;
+
         VkFramebufferCreateInfo FramebufferCI{};
         FramebufferCI.sType      = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
         FramebufferCI.pNext      = nullptr;
@@ -125,6 +128,12 @@ VkFramebuffer FramebufferCache::GetFramebuffer(const FramebufferCacheKey& Key, u
     }
 }
 
+FramebufferCache::Statistics FramebufferCache::GetStatistics()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    return m_Stats;
+}
+
 FramebufferCache::~FramebufferCache()
 {
     VERIFY(m_Cache.empty(), "All framebuffers must be released");
@@ -29,19 +29,367 @@
 
 #include "GenerateMipsVkHelper.hpp"
 
+#include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
 #include "TextureViewVkImpl.hpp"
 #include "TextureVkImpl.hpp"
 
 #include "VulkanTypeConversions.hpp"
 
+#if !DILIGENT_NO_GLSLANG
+#    include "GLSLangUtils.hpp"
+#endif
+
 namespace Diligent
 {
 
-namespace GenerateMipsVkHelper
+namespace
 {
 
-void GenerateMips(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx)
+// The shader binds the source mip level and all mip levels it generates
+constexpr Uint32 NumMipViews = GenerateMipsVkHelper::MaxMipsPerDispatch + 1;
+
+// Every work group processes a 64x64 tile of the source mip level with 256 threads
+constexpr Uint32 TileSize        = 64;
+constexpr Uint32 ThreadGroupSize = 256;
+
+// The last work group of the slice reduces the 6th mip level, which must fit into a single tile.
+// Larger mip levels are reduced by at most 6 levels per dispatch.
+constexpr Uint32 MaxSinglePassSize = TileSize * TileSize;
+
+// clang-format off
+constexpr char GenerateMipsCS[] = R"(
+#version 450
+
+layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+// g_Mips[0] is the source mip level, g_Mips[i] is the i-th generated mip level.
+layout(set = 0, binding = 0, IMAGE_FORMAT) uniform coherent image2DArray g_Mips[13];
+
+layout(set = 0, binding = 1, std430) coherent buffer GenerateMipsGlobals
+{
+    uint NumMips;       // The number of mip levels to generate
+    uint NumWorkGroups; // The number of work groups that process one slice
+    uint Padding0;
+    uint Padding1;
+    uint Counters[];    // The number of work groups that have finished the 6th mip level of every slice
+} g_Globals;
+
+shared vec4 g_Tile[256];
+shared uint g_IsLastWorkGroup;
+
+vec4 LoadSrcMip(uint SrcMip, ivec2 Coord, int Slice)
+{
+    // Image array elements must be indexed with constant expressions
+    if (SrcMip == 0u)
+        return imageLoad(g_Mips[0], ivec3(min(Coord, imageSize(g_Mips[0]).xy - 1), Slice));
+    else
+        return imageLoad(g_Mips[6], ivec3(min(Coord, imageSize(g_Mips[6]).xy - 1), Slice));
+}
+
+// Returns the size of the mip level Mip of the pass that starts with the source mip level SrcMip
+ivec2 GetMipSize(uint SrcMip, uint Mip)
+{
+    ivec2 SrcSize = SrcMip == 0u ? imageSize(g_Mips[0]).xy : imageSize(g_Mips[6]).xy;
+    return max(SrcSize >> int(Mip - SrcMip), ivec2(1, 1));
+}
+
+#define STORE_MIP(i)                                           \
+    case i:                                                    \
+        if (all(lessThan(Coord, imageSize(g_Mips[i]).xy)))     \
+            imageStore(g_Mips[i], ivec3(Coord, Slice), Value); \
+        break
+
+void StoreMip(uint Mip, ivec2 Coord, int Slice, vec4 Value)
+{
+    if (Mip > g_Globals.NumMips)
+        return;
+
+    switch (Mip)
+    {
+        STORE_MIP(1);
+        STORE_MIP(2);
+        STORE_MIP(3);
+        STORE_MIP(4);
+        STORE_MIP(5);
+        STORE_MIP(6);
+        STORE_MIP(7);
+        STORE_MIP(8);
+        STORE_MIP(9);
+        STORE_MIP(10);
+        STORE_MIP(11);
+        STORE_MIP(12);
+    }
+}
+
+// Reduces the 64x64 tile of the source mip level to a single texel, writing mip levels SrcMip+1 ... SrcMip+6.
+// Every texel is the average of the 2x2 texels of the previous mip level. Texels that are outside of the
+// previous mip level (the last row or column of odd-sized levels is skipped) replicate its edge texels.
+void DownsampleTile(uint SrcMip, ivec2 TileId, int Slice, uint LocalIndex)
+{
+    // Every thread reduces 4x4 source texels to 2x2 texels of the first mip level and one texel of the second
+    ivec2 Mip1Size = GetMipSize(SrcMip, SrcMip + 1u);
+    ivec2 Coord2   = TileId * 16 + ivec2(LocalIndex % 16u, LocalIndex / 16u);
+    vec4  Sum2     = vec4(0.0);
+    for (int y = 0; y < 2; ++y)
+    {
+        for (int x = 0; x < 2; ++x)
+        {
+            // Texels outside of the first mip level are only used by the second mip level
+            // and replicate the edge texels
+            ivec2 Coord1 = Coord2 * 2 + ivec2(x, y);
+            ivec2 Coord0 = min(Coord1, Mip1Size - 1) * 2;
+            vec4  Texel1 = 0.25 * (LoadSrcMip(SrcMip, Coord0, Slice) +
+                                   LoadSrcMip(SrcMip, Coord0 + ivec2(1, 0), Slice) +
+                                   LoadSrcMip(SrcMip, Coord0 + ivec2(0, 1), Slice) +
+                                   LoadSrcMip(SrcMip, Coord0 + ivec2(1, 1), Slice));
+            StoreMip(SrcMip + 1u, Coord1, Slice, Texel1);
+            Sum2 += Texel1;
+        }
+    }
+    vec4 Texel2 = 0.25 * Sum2;
+    StoreMip(SrcMip + 2u, Coord2, Slice, Texel2);
+    g_Tile[LocalIndex] = Texel2;
+
+    // The remaining 16x16 texels are reduced in shared memory
+    uint Dim = 8u;
+    for (uint Mip = SrcMip + 3u; Mip <= SrcMip + 6u; ++Mip, Dim /= 2u)
+    {
+        // The condition is uniform across the work group
+        if (Mip > g_Globals.NumMips)
+            return;
+
+        memoryBarrierShared();
+        barrier();
+
+        bool  IsActive   = LocalIndex < Dim * Dim;
+        ivec2 LocalCoord = ivec2(LocalIndex % Dim, LocalIndex / Dim);
+        vec4  Texel      = vec4(0.0);
+        if (IsActive)
+        {
+            // The previous mip level is stored in the tile row by row with the stride of 2*Dim.
+            // Source coordinates are clamped to the previous mip level to replicate its edge texels.
+            int   Stride   = int(2u * Dim);
+            ivec2 MaxCoord = clamp(GetMipSize(SrcMip, Mip - 1u) - 1 - TileId * Stride, ivec2(0, 0), ivec2(Stride - 1, Stride - 1));
+            ivec2 Src0     = min(LocalCoord * 2, MaxCoord);
+            ivec2 Src1     = min(LocalCoord * 2 + 1, MaxCoord);
+            Texel          = 0.25 * (g_Tile[Src0.y * Stride + Src0.x] + g_Tile[Src0.y * Stride + Src1.x] +
+                                     g_Tile[Src1.y * Stride + Src0.x] + g_Tile[Src1.y * Stride + Src1.x]);
+        }
+
+        memoryBarrierShared();
+        barrier();
+
+        if (IsActive)
+        {
+            g_Tile[LocalIndex] = Texel;
+            StoreMip(Mip, TileId * int(Dim) + LocalCoord, Slice, Texel);
+        }
+    }
+}
+
+void main()
+{
+    int  Slice      = int(gl_WorkGroupID.z);
+    uint LocalIndex = gl_LocalInvocationIndex;
+
+    DownsampleTile(0u, ivec2(gl_WorkGroupID.xy), Slice, LocalIndex);
+    if (g_Globals.NumMips <= 6u)
+        return;
+
+    // The last work group that finishes the 6th mip level of the slice continues with the remaining mip levels
+    if (LocalIndex == 0u)
+    {
+        memoryBarrierImage();
+        uint NumFinished  = atomicAdd(g_Globals.Counters[Slice], 1u) + 1u;
+        g_IsLastWorkGroup = NumFinished == g_Globals.NumWorkGroups ? 1u : 0u;
+    }
+    memoryBarrierShared();
+    barrier();
+
+    if (g_IsLastWorkGroup == 0u)
+        return;
+
+    memoryBarrierImage();
+    DownsampleTile(6u, ivec2(0, 0), Slice, LocalIndex);
+}
+)";
+// clang-format on
+
+struct ImageFormatQualifier
+{
+    const char* Name       = nullptr;
+    bool        IsExtended = false; // Requires shaderStorageImageExtendedFormats feature
+};
+
+ImageFormatQualifier GetImageFormatQualifier(TEXTURE_FORMAT Format)
+{
+    // sRGB formats can't be used as storage images, and typed loads of
+    // integer formats would require a different shader.
+    // clang-format off
+    switch (Format)
+    {
+        case TEX_FORMAT_RGBA32_FLOAT:    return {"rgba32f",        false};
+        case TEX_FORMAT_RGBA16_FLOAT:    return {"rgba16f",        false};
+        case TEX_FORMAT_R32_FLOAT:       return {"r32f",           false};
+        case TEX_FORMAT_RGBA8_UNORM:     return {"rgba8",          false};
+        case TEX_FORMAT_RGBA8_SNORM:     return {"rgba8_snorm",    false};
+
+        case TEX_FORMAT_RG32_FLOAT:      return {"rg32f",          true};
+        case TEX_FORMAT_RG16_FLOAT:      return {"rg16f",          true};
+        case TEX_FORMAT_R16_FLOAT:       return {"r16f",           true};
+        case TEX_FORMAT_R11G11B10_FLOAT: return {"r11f_g11f_b10f", true};
+        case TEX_FORMAT_RGBA16_UNORM:    return {"rgba16",         true};
+        case TEX_FORMAT_RG16_UNORM:      return {"rg16",           true};
+        case TEX_FORMAT_R16_UNORM:       return {"r16",            true};
+        case TEX_FORMAT_RGB10A2_UNORM:   return {"rgb10_a2",       true};
+        case TEX_FORMAT_RG8_UNORM:       return {"rg8",            true};
+        case TEX_FORMAT_R8_UNORM:        return {"r8",             true};
+        case TEX_FORMAT_RGBA16_SNORM:    return {"rgba16_snorm",   true};
+        case TEX_FORMAT_RG16_SNORM:      return {"rg16_snorm",     true};
+        case TEX_FORMAT_R16_SNORM:       return {"r16_snorm",      true};
+        case TEX_FORMAT_RG8_SNORM:       return {"rg8_snorm",      true};
+        case TEX_FORMAT_R8_SNORM:        return {"r8_snorm",       true};
+
+        default:
+            return {};
+    }
+    // clang-format on
+}
+
+} // namespace
+
+GenerateMipsVkHelper::GenerateMipsVkHelper(RenderDeviceVkImpl& DeviceVk) :
+    m_DeviceVk{DeviceVk}
+{
+}
+
+bool GenerateMipsVkHelper::IsComputeSupported(const TextureDesc& TexDesc)
+{
+    if (TexDesc.Type != RESOURCE_DIM_TEX_2D &&
+        TexDesc.Type != RESOURCE_DIM_TEX_2D_ARRAY &&
+        TexDesc.Type != RESOURCE_DIM_TEX_CUBE &&
+        TexDesc.Type != RESOURCE_DIM_TEX_CUBE_ARRAY)
+        return false;
+
+    if (TexDesc.SampleCount != 1)
+        return false;
+
+    const auto Qualifier = GetImageFormatQualifier(TexDesc.Format);
+    if (Qualifier.Name == nullptr)
+        return false;
+
+    const auto& LogicalDevice = m_DeviceVk.GetLogicalDevice();
+    if (Qualifier.IsExtended && LogicalDevice.GetEnabledFeatures().shaderStorageImageExtendedFormats == VK_FALSE)
+        return false;
+
+    const auto& PhysicalDevice = m_DeviceVk.GetPhysicalDevice();
+    const auto& Limits         = PhysicalDevice.GetProperties().limits;
+    if (Limits.maxComputeWorkGroupInvocations < ThreadGroupSize ||
+        Limits.maxComputeWorkGroupSize[0] < ThreadGroupSize ||
+        Limits.maxPerStageDescriptorStorageImages < NumMipViews)
+        return false;
+
+    const auto FmtProperties = PhysicalDevice.GetPhysicalDeviceFormatProperties(TexFormatToVkFormat(TexDesc.Format));
+    if ((FmtProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) == 0)
+        return false;
+
+    return GetComputePipeline(TexDesc.Format) != VK_NULL_HANDLE;
+}
+
+VkPipeline GenerateMipsVkHelper::GetComputePipeline(TEXTURE_FORMAT Format)
+{
+    std::lock_guard<std::mutex> Lock{m_PipelinesMtx};
+
+    if (m_PipelineInitialized[Format])
+        return m_Pipelines[Format];
+    m_PipelineInitialized[Format] = true;
+
+#if DILIGENT_NO_GLSLANG
+    return VK_NULL_HANDLE;
+#else
+    const auto Qualifier = GetImageFormatQualifier(Format);
+    VERIFY_EXPR(Qualifier.Name != nullptr);
+
+    const ShaderMacro Macros[] = {{"IMAGE_FORMAT", Qualifier.Name}, {nullptr, nullptr}};
+
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+    Attribs.ShaderType     = SHADER_TYPE_COMPUTE;
+    Attribs.ShaderSource   = GenerateMipsCS;
+    Attribs.SourceCodeLen  = static_cast<int>(sizeof(GenerateMipsCS) - 1);
+    Attribs.Macros         = Macros;
+    Attribs.AssignBindings = false;
+
+    const auto SPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+    if (SPIRV.empty())
+    {
+        LOG_ERROR_MESSAGE("Failed to compile mipmap generation shader for ", GetTextureFormatAttribs(Format).Name,
+                          " format. Mipmaps will be generated by blit commands.");
+        return VK_NULL_HANDLE;
+    }
+
+    try
+    {
+        const auto& LogicalDevice = m_DeviceVk.GetLogicalDevice();
+
+        if (!m_PipelineLayout)
+        {
+            VkDescriptorSetLayoutBinding Bindings[2]{};
+            Bindings[0].binding         = 0;
+            Bindings[0].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            Bindings[0].descriptorCount = NumMipViews;
+            Bindings[0].stageFlags      = VK_SHADER_STAGE_COMPUTE_BIT;
+
+            Bindings[1].binding         = 1;
+            Bindings[1].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            Bindings[1].descriptorCount = 1;
+            Bindings[1].stageFlags      = VK_SHADER_STAGE_COMPUTE_BIT;
+
+            VkDescriptorSetLayoutCreateInfo SetLayoutCI{};
+            SetLayoutCI.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+            SetLayoutCI.bindingCount = _countof(Bindings);
+            SetLayoutCI.pBindings    = Bindings;
+            m_SetLayout              = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI, "Generate mips descriptor set layout");
+
+            const VkDescriptorSetLayout vkSetLayout = m_SetLayout;
+
+            VkPipelineLayoutCreateInfo PipelineLayoutCI{};
+            PipelineLayoutCI.sType          = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+            PipelineLayoutCI.setLayoutCount = 1;
+            PipelineLayoutCI.pSetLayouts    = &vkSetLayout;
+            m_PipelineLayout                = LogicalDevice.CreatePipelineLayout(PipelineLayoutCI, "Generate mips pipeline layout");
+        }
+
+        VkShaderModuleCreateInfo ShaderModuleCI{};
+        ShaderModuleCI.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        ShaderModuleCI.codeSize = SPIRV.size() * sizeof(SPIRV[0]);
+        ShaderModuleCI.pCode    = SPIRV.data();
+
+        const auto ShaderModule = LogicalDevice.CreateShaderModule(ShaderModuleCI, "Generate mips CS");
+
+        VkComputePipelineCreateInfo PipelineCI{};
+        PipelineCI.sType              = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        PipelineCI.stage.sType        = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        PipelineCI.stage.stage        = VK_SHADER_STAGE_COMPUTE_BIT;
+        PipelineCI.stage.module       = ShaderModule;
+        PipelineCI.stage.pName        = "main";
+        PipelineCI.layout             = m_PipelineLayout;
+        PipelineCI.basePipelineHandle = VK_NULL_HANDLE;
+        PipelineCI.basePipelineIndex  = -1;
+
+        m_Pipelines[Format] = LogicalDevice.CreateComputePipeline(PipelineCI, VK_NULL_HANDLE, "Generate mips PSO");
+    }
+    catch (const std::runtime_error&)
+    {
+        LOG_ERROR_MESSAGE("Failed to create mipmap generation pipeline for ", GetTextureFormatAttribs(Format).Name,
+                          " format. Mipmaps will be generated by blit commands.");
+    }
+
+    return m_Pipelines[Format];
+#endif
+}
+
+void GenerateMipsVkHelper::GenerateMips(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx)
 {
     auto* pTexVk = TexView.GetTexture<TextureVkImpl>();
     if (!pTexVk->IsInKnownState())
@@ -50,6 +398,151 @@ void GenerateMips(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx)
         return;
     }
 
+    // Mip level views are only created when the compute shader is supported for the texture format
+    if (TexView.HasMipLevelViews())
+    {
+        if (auto vkPipeline = GetComputePipeline(TexView.GetDesc().Format))
+        {
+            GenerateMipsCS(TexView, Ctx, vkPipeline);
+            return;
+        }
+    }
+
+    GenerateMipsBlit(TexView, Ctx);
+}
+
+void GenerateMipsVkHelper::GenerateMipsCS(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx, VkPipeline vkPipeline)
+{
+    auto*       pTexVk         = TexView.GetTexture<TextureVkImpl>();
+    const auto  OriginalState  = pTexVk->GetState();
+    const auto  OriginalLayout = pTexVk->GetLayout();
+    const auto& TexDesc        = pTexVk->GetDesc();
+    const auto& ViewDesc       = TexView.GetDesc();
+
+    DEV_CHECK_ERR(ViewDesc.NumMipLevels > 1, "Number of mip levels in the view must be greater than 1");
+    DEV_CHECK_ERR(OriginalState != RESOURCE_STATE_UNDEFINED,
+                  "Attempting to generate mipmaps for texture '", TexDesc.Name,
+                  "' which is in RESOURCE_STATE_UNDEFINED state ."
+                  "This is not expected in Vulkan backend as textures are transition to a defined state when created.");
+
+    VkImageSubresourceRange SubresRange{};
+    SubresRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    SubresRange.baseArrayLayer = ViewDesc.FirstArraySlice;
+    SubresRange.layerCount     = ViewDesc.NumArraySlices;
+    SubresRange.baseMipLevel   = ViewDesc.MostDetailedMip;
+    SubresRange.levelCount     = ViewDesc.NumMipLevels;
+
+    // All affected mip levels are accessed as storage images, so a single barrier is required
+    // for the entire range, as opposed to two barriers per mip level in the blit path.
+    Ctx.TransitionTextureState(*pTexVk, OriginalState, RESOURCE_STATE_UNORDERED_ACCESS, STATE_TRANSITION_FLAG_NONE, &SubresRange);
+
+    const auto& LogicalDevice = m_DeviceVk.GetLogicalDevice();
+    const auto& Limits        = m_DeviceVk.GetPhysicalDevice().GetProperties().limits;
+    const auto  vkImage       = pTexVk->GetVkImage();
+
+    auto& CmdBuffer = Ctx.GetCommandBuffer();
+    if (CmdBuffer.IsInsideRenderPass())
+        CmdBuffer.EndRenderPass();
+
+    VkDescriptorImageInfo ImageInfos[NumMipViews]{};
+    for (Uint32 SrcMip = 0; SrcMip + 1 < ViewDesc.NumMipLevels;)
+    {
+        // Source mip level is relative to the view
+        const auto SrcWidth  = std::max(TexDesc.Width >> (ViewDesc.MostDetailedMip + SrcMip), 1u);
+        const auto SrcHeight = std::max(TexDesc.Height >> (ViewDesc.MostDetailedMip + SrcMip), 1u);
+
+        auto NumMips = std::min(ViewDesc.NumMipLevels - 1 - SrcMip, Uint32{MaxMipsPerDispatch});
+        if (std::max(SrcWidth, SrcHeight) > MaxSinglePassSize)
+            NumMips = std::min(NumMips, 6u);
+
+        if (SrcMip > 0)
+        {
+            // Make the mip levels written by the previous dispatch visible to the next one
+            CmdBuffer.TransitionImageLayout(vkImage, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL, SubresRange,
+                                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        }
+
+        const auto NumWorkGroupsX = (SrcWidth + TileSize - 1) / TileSize;
+        const auto NumWorkGroupsY = (SrcHeight + TileSize - 1) / TileSize;
+
+        // Shader globals and per-slice work group counters
+        const size_t GlobalsSize = sizeof(Uint32) * (4 + ViewDesc.NumArraySlices);
+
+        auto Allocation = Ctx.AllocateDynamicSpace(GlobalsSize, static_cast<Uint32>(std::max(Limits.minStorageBufferOffsetAlignment, VkDeviceSize{4})));
+
+        auto* pGlobals = reinterpret_cast<Uint32*>(Allocation.pDynamicMemMgr->GetCPUAddress() + Allocation.AlignedOffset);
+        pGlobals[0]    = NumMips;
+        pGlobals[1]    = NumWorkGroupsX * NumWorkGroupsY;
+        pGlobals[2]    = 0;
+        pGlobals[3]    = 0;
+        std::fill(pGlobals + 4, pGlobals + 4 + ViewDesc.NumArraySlices, 0u);
+
+        // Unused array elements reference the last generated mip level
+        for (Uint32 i = 0; i < NumMipViews; ++i)
+        {
+            ImageInfos[i].sampler     = VK_NULL_HANDLE;
+            ImageInfos[i].imageView   = TexView.GetMipLevelView(SrcMip + std::min(i, NumMips));
+            ImageInfos[i].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+        }
+
+        VkDescriptorBufferInfo BufferInfo{};
+        BufferInfo.buffer = Allocation.pDynamicMemMgr->GetVkBuffer();
+        BufferInfo.offset = Allocation.AlignedOffset;
+        BufferInfo.range  = GlobalsSize;
+
+        const auto vkDescrSet = Ctx.AllocateDynamicDescriptorSet(m_SetLayout, "Generate mips descriptor set");
+
+        VkWriteDescriptorSet DescrWrites[2]{};
+        DescrWrites[0].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        DescrWrites[0].dstSet          = vkDescrSet;
+        DescrWrites[0].dstBinding      = 0;
+        DescrWrites[0].descriptorCount = NumMipViews;
+        DescrWrites[0].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        DescrWrites[0].pImageInfo      = ImageInfos;
+
+        DescrWrites[1].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        DescrWrites[1].dstSet          = vkDescrSet;
+        DescrWrites[1].dstBinding      = 1;
+        DescrWrites[1].descriptorCount = 1;
+        DescrWrites[1].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        DescrWrites[1].pBufferInfo     = &BufferInfo;
+
+        LogicalDevice.UpdateDescriptorSets(_countof(DescrWrites), DescrWrites, 0, nullptr);
+
+        CmdBuffer.BindComputePipeline(vkPipeline);
+        CmdBuffer.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout, 0, 1, &vkDescrSet, 0, nullptr);
+        CmdBuffer.Dispatch(NumWorkGroupsX, NumWorkGroupsY, ViewDesc.NumArraySlices);
+
+        SrcMip += NumMips;
+    }
+
+    // All affected mip levels are now in VK_IMAGE_LAYOUT_GENERAL layout
+    bool IsAllSlices = (TexDesc.Type != RESOURCE_DIM_TEX_2D_ARRAY &&
+                        TexDesc.Type != RESOURCE_DIM_TEX_CUBE_ARRAY) ||
+        TexDesc.ArraySize == ViewDesc.NumArraySlices;
+    bool IsAllMips = ViewDesc.NumMipLevels == TexDesc.MipLevels;
+    if (IsAllSlices && IsAllMips)
+    {
+        pTexVk->SetState(RESOURCE_STATE_UNORDERED_ACCESS);
+    }
+    else if (OriginalLayout != VK_IMAGE_LAYOUT_GENERAL)
+    {
+        VERIFY(OriginalLayout != VK_IMAGE_LAYOUT_UNDEFINED, "Original layout must not be undefined");
+        // Transition all affected subresources back to original layout
+        Ctx.TransitionImageLayout(*pTexVk, VK_IMAGE_LAYOUT_GENERAL, OriginalLayout, SubresRange);
+        VERIFY_EXPR(pTexVk->GetLayout() == OriginalLayout);
+    }
+    else
+    {
+        // Make the writes visible to subsequent commands that access the texture in its original state
+        CmdBuffer.TransitionImageLayout(vkImage, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL, SubresRange);
+    }
+}
+
+void GenerateMipsVkHelper::GenerateMipsBlit(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx)
+{
+    auto* pTexVk = TexView.GetTexture<TextureVkImpl>();
+
     const auto  OriginalState  = pTexVk->GetState();
     const auto  OriginalLayout = pTexVk->GetLayout();
     const auto& TexDesc        = pTexVk->GetDesc();
@@ -163,6 +656,4 @@ void GenerateMips(TextureViewVkImpl& TexView, DeviceContextVkImpl& Ctx)
     }
 }
 
-} // namespace GenerateMipsVkHelper
-
 } // namespace Diligent
@@ -0,0 +1,206 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+
+#include "pch.h"
+
+#include "GraphicsPipelineLibraryCache.hpp"
+
+#include <vector>
+
+#include "RenderDeviceVkImpl.hpp"
+
+namespace Diligent
+{
+
+bool GraphicsPipelineLibraryCache::PartKey::operator==(const PartKey& rhs) const
+{
+    // clang-format off
+    return Hash              == rhs.Hash              &&
+           CreateFlags       == rhs.CreateFlags       &&
+           PrimitiveTopology == rhs.PrimitiveTopology &&
+           NumViewports      == rhs.NumViewports      &&
+           ShadingRateFlags  == rhs.ShadingRateFlags  &&
+           SampleMask        == rhs.SampleMask        &&
+           vkRenderPass      == rhs.vkRenderPass      &&
+           SubpassIndex      == rhs.SubpassIndex      &&
+           NumRenderTargets  == rhs.NumRenderTargets  &&
+           RTVFormats        == rhs.RTVFormats        &&
+           DSVFormat         == rhs.DSVFormat         &&
+           SampleCount       == rhs.SampleCount       &&
+           SampleQuality     == rhs.SampleQuality     &&
+           RasterizerDesc    == rhs.RasterizerDesc    &&
+           DepthStencilDesc  == rhs.DepthStencilDesc  &&
+           BlendDesc         == rhs.BlendDesc         &&
+           LayoutElements    == rhs.LayoutElements    &&
+           Signatures        == rhs.Signatures        &&
+           Shaders           == rhs.Shaders;
+    // clang-format on
+}
+
+GraphicsPipelineLibraryCache::LibraryPtr GraphicsPipelineLibraryCache::GetLibrary(PIPELINE_PART Part, const PartKey& Key, const VkGraphicsPipelineCreateInfo& PipelineCI)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+
+        auto it = m_Libraries[Part].find(Key);
+        if (it != m_Libraries[Part].end())
+        {
+            ++m_Stats.HitCount;
+            // Move the library to the front of the LRU list
+            m_LRULists[Part].splice(m_LRULists[Part].begin(), m_LRULists[Part], it->second.LRUPos);
+            return it->second.pLibrary;
+        }
+    }
+
+    // Compile the library outside of the lock so that other threads are not blocked
+    VkGraphicsPipelineLibraryCreateInfoEXT LibraryCI{};
+    LibraryCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    LibraryCI.pNext = PipelineCI.pNext;
+
+    std::vector<VkPipelineShaderStageCreateInfo> Stages;
+    switch (Part)
+    {
+        case PIPELINE_PART_VERTEX_INPUT_INTERFACE:
+            LibraryCI.flags = VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+            break;
+
+        case PIPELINE_PART_PRE_RASTERIZATION_SHADERS:
+            LibraryCI.flags = VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+            for (Uint32 s = 0; s < PipelineCI.stageCount; ++s)
+            {
+                if (PipelineCI.pStages[s].stage != VK_SHADER_STAGE_FRAGMENT_BIT)
+                    Stages.push_back(PipelineCI.pStages[s]);
+            }
+            break;
+
+        case PIPELINE_PART_FRAGMENT_SHADER:
+            LibraryCI.flags = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+            for (Uint32 s = 0; s < PipelineCI.stageCount; ++s)
+            {
+                if (PipelineCI.pStages[s].stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+                    Stages.push_back(PipelineCI.pStages[s]);
+            }
+            break;
+
+        case PIPELINE_PART_FRAGMENT_OUTPUT_INTERFACE:
+            LibraryCI.flags = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected pipeline part");
+    }
+
+    // States that are not used by the library part are ignored
+    auto LibPipelineCI       = PipelineCI;
+    LibPipelineCI.pNext      = &LibraryCI;
+    LibPipelineCI.flags      = PipelineCI.flags | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+    LibPipelineCI.stageCount = static_cast<uint32_t>(Stages.size());
+    LibPipelineCI.pStages    = !Stages.empty() ? Stages.data() : nullptr;
+
+    auto pLibrary = std::make_shared<VulkanUtilities::PipelineWrapper>(
+        m_DeviceVk.GetLogicalDevice().CreateGraphicsPipeline(LibPipelineCI, VK_NULL_HANDLE, "Graphics pipeline library"));
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    ++m_Stats.CreationCount;
+
+    auto it_inserted = m_Libraries[Part].emplace(Key, LibraryEntry{pLibrary, {}});
+    auto it          = it_inserted.first;
+    if (!it_inserted.second)
+    {
+        // Another thread has created the same library in the meantime, so the new
+        // library is released as it has never been used.
+        return it->second.pLibrary;
+    }
+
+    m_LRULists[Part].push_front(&it->first);
+    it->second.LRUPos = m_LRULists[Part].begin();
+
+    EvictLibraries(Part);
+
+    return pLibrary;
+}
+
+void GraphicsPipelineLibraryCache::EvictLibraries(PIPELINE_PART Part)
+{
+    auto& LRUList = m_LRULists[Part];
+    while (LRUList.size() > m_MaxLibrariesPerPart)
+    {
+        // Pipelines that have already been linked from the library remain valid
+        auto it = m_Libraries[Part].find(*LRUList.back());
+        VERIFY_EXPR(it != m_Libraries[Part].end());
+        LRUList.pop_back();
+        m_Libraries[Part].erase(it);
+        ++m_Stats.EvictionCount;
+    }
+}
+
+VulkanUtilities::PipelineWrapper GraphicsPipelineLibraryCache::LinkPipeline(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                                                            const PartKeys&                     Keys,
+                                                                            const char*                         Name)
+{
+    // Keep the libraries alive until the pipeline is linked even if they are evicted by another thread
+    std::array<LibraryPtr, PIPELINE_PART_COUNT> pLibraries;
+    std::array<VkPipeline, PIPELINE_PART_COUNT> Libraries;
+    for (Uint32 Part = 0; Part < PIPELINE_PART_COUNT; ++Part)
+    {
+        pLibraries[Part] = GetLibrary(static_cast<PIPELINE_PART>(Part), Keys[Part], PipelineCI);
+        Libraries[Part]  = *pLibraries[Part];
+    }
+
+    VkPipelineLibraryCreateInfoKHR LinkCI{};
+    LinkCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LinkCI.pNext        = nullptr;
+    LinkCI.libraryCount = static_cast<uint32_t>(Libraries.size());
+    LinkCI.pLibraries   = Libraries.data();
+
+    // Without VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT, the libraries are linked
+    // without any additional compilation.
+    VkGraphicsPipelineCreateInfo LinkedPipelineCI{};
+    LinkedPipelineCI.sType              = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    LinkedPipelineCI.pNext              = &LinkCI;
+    LinkedPipelineCI.flags              = PipelineCI.flags;
+    LinkedPipelineCI.layout             = PipelineCI.layout;
+    LinkedPipelineCI.renderPass         = VK_NULL_HANDLE;
+    LinkedPipelineCI.basePipelineHandle = VK_NULL_HANDLE;
+    LinkedPipelineCI.basePipelineIndex  = -1;
+
+    auto Pipeline = m_DeviceVk.GetLogicalDevice().CreateGraphicsPipeline(LinkedPipelineCI, VK_NULL_HANDLE, Name);
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        ++m_Stats.LinkCount;
+    }
+
+    return Pipeline;
+}
+
+GraphicsPipelineLibraryCache::Statistics GraphicsPipelineLibraryCache::GetStatistics()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    return m_Stats;
+}
+
+} // namespace Diligent
@@ -68,6 +68,7 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
     Uint32 DescSetLayoutCount        = 0;
     Uint32 DynamicUniformBufferCount = 0;
     Uint32 DynamicStorageBufferCount = 0;
+    Uint32 PushDescriptorSetCount    = 0;
 
     for (Uint32 i = 0; i < SignatureCount; ++i)
     {
@@ -87,6 +88,8 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
 
         DynamicUniformBufferCount += pSignature->GetDynamicUniformBufferCount();
         DynamicStorageBufferCount += pSignature->GetDynamicStorageBufferCount();
+        if (pSignature->UsesPushDescriptors())
+            ++PushDescriptorSetCount;
 #ifdef DILIGENT_DEBUG
         m_DbgMaxBindIndex = std::max(m_DbgMaxBindIndex, Uint32{pSignature->GetDesc().BindingIndex});
 #endif
@@ -100,6 +103,13 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
                             ") used by the pipeline layout exceeds device limit (", Limits.maxBoundDescriptorSets, ")");
     }
 
+    if (PushDescriptorSetCount > 1)
+    {
+        // Only one descriptor set in a pipeline layout may be a push descriptor set
+        LOG_ERROR_AND_THROW("At most one resource signature in a pipeline may use push descriptors (PIPELINE_RESOURCE_SIGNATURE_FLAG_PUSH_DYNAMIC_RESOURCES), "
+                            "but ", PushDescriptorSetCount, " signatures use them");
+    }
+
     if (DynamicUniformBufferCount > Limits.maxDescriptorSetUniformBuffersDynamic)
     {
         LOG_ERROR_AND_THROW("The number of dynamic uniform buffers  (", DynamicUniformBufferCount,
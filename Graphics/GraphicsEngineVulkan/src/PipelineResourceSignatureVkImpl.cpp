@@ -34,6 +34,7 @@
 #include "TextureViewVkImpl.hpp"
 
 #include "VulkanTypeConversions.hpp"
+#include "VulkanUtilities/VulkanCommandBuffer.hpp"
 #include "DynamicLinearAllocator.hpp"
 #include "SPIRVShaderResources.hpp"
 
@@ -87,6 +88,35 @@ DescriptorType GetDescriptorType(const PipelineResourceDesc& Res)
     }
 }
 
+// Push descriptor set layouts must not contain descriptors with dynamic offsets,
+// so such descriptors are replaced with their regular counterparts.
+DescriptorType GetPushDescriptorType(DescriptorType Type)
+{
+    switch (Type)
+    {
+        case DescriptorType::UniformBufferDynamic: return DescriptorType::UniformBuffer;
+        case DescriptorType::StorageBufferDynamic: return DescriptorType::StorageBuffer;
+        case DescriptorType::StorageBufferDynamic_ReadOnly: return DescriptorType::StorageBuffer_ReadOnly;
+        default: return Type;
+    }
+}
+
+// The dynamic offset is applied directly to the buffer descriptor that is pushed to the command buffer
+void ApplyPushDescriptorDynamicOffset(VkDescriptorBufferInfo& DescrBuffInfo, const ShaderResourceCacheVk::Resource& Res, DeviceContextIndex CtxId)
+{
+    if (Res.Type == DescriptorType::UniformBufferDynamic ||
+        Res.Type == DescriptorType::StorageBufferDynamic ||
+        Res.Type == DescriptorType::StorageBufferDynamic_ReadOnly)
+    {
+        DescrBuffInfo.offset += Res.GetDynamicBufferOffset(CtxId);
+    }
+}
+
+template <typename DescriptorInfoType>
+void ApplyPushDescriptorDynamicOffset(DescriptorInfoType&, const ShaderResourceCacheVk::Resource&, DeviceContextIndex)
+{
+}
+
 Uint32 FindImmutableSamplerVk(const PipelineResourceDesc&          Res,
                               DescriptorType                       DescType,
                               const PipelineResourceSignatureDesc& Desc,
@@ -192,6 +222,63 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts()
         CacheGroupSizes[CacheGroup] += ResDesc.ArraySize;
     }
 
+    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const auto& ResDesc = m_Desc.Resources[i];
+        if ((ResDesc.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0)
+        {
+            VerifyBindlessResource(ResDesc);
+            m_HasBindlessResources = true;
+        }
+    }
+
+    if (m_HasBindlessResources && (CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR] != 0 || CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR] != 0))
+    {
+        // Bindless resources are mutable, so the static/mutable set must be update-after-bind. (VUID-VkDescriptorSetLayoutCreateInfo-descriptorType-03001)
+        LOG_ERROR_AND_THROW("Pipeline resource signature '", m_Desc.Name,
+                            "' contains bindless resources as well as static or mutable buffers that may use dynamic offsets. "
+                            "Descriptor sets with bindless resources can't contain dynamic buffers in Vulkan. "
+                            "Label all static and mutable buffers with PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS flag.");
+    }
+
+    if ((m_Desc.Flags & PIPELINE_RESOURCE_SIGNATURE_FLAG_PUSH_DYNAMIC_RESOURCES) != 0)
+    {
+        const auto TotalStaticDescriptors =
+            CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR] +
+            CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR] +
+            CacheGroupSizes[CACHE_GROUP_OTHER_STAT_VAR];
+        // Immutable samplers that are not defined as resources are added to the dynamic set when there is no static/mutable set
+        const auto TotalDynamicDescriptors =
+            CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR] +
+            CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR] +
+            CacheGroupSizes[CACHE_GROUP_OTHER_DYN_VAR] +
+            (TotalStaticDescriptors == 0 ? m_Desc.NumImmutableSamplers : 0);
+        const Uint32 DeviceMaxPushDescriptors = GetDevice()->GetPhysicalDevice().GetExtProperties().PushDescriptor.maxPushDescriptors;
+
+        if (TotalDynamicDescriptors == 0)
+        {
+            // There are no dynamic resources in this signature
+        }
+        else if (!LogicalDevice.GetEnabledExtFeatures().PushDescriptor)
+        {
+            LOG_INFO_MESSAGE("Pipeline resource signature '", m_Desc.Name,
+                             "' requests push descriptors, but VK_KHR_push_descriptor extension is not supported by the device. "
+                             "Dynamic resources will use regular descriptor sets.");
+        }
+        else if (TotalDynamicDescriptors > std::min(DeviceMaxPushDescriptors, Uint32{MaxPushDescriptors}))
+        {
+            LOG_WARNING_MESSAGE("The number of dynamic descriptors (", TotalDynamicDescriptors, ") in pipeline resource signature '", m_Desc.Name,
+                                "' exceeds the maximum number of push descriptors (", std::min(DeviceMaxPushDescriptors, Uint32{MaxPushDescriptors}), "). "
+                                "Dynamic resources will use regular descriptor sets.");
+        }
+        else
+        {
+            m_UsePushDescriptors = true;
+        }
+    }
+
     // Descriptor set mapping (static/mutable (0) or dynamic (1) -> set index)
     std::array<Uint32, DESCRIPTOR_SET_ID_NUM_SETS> DSMapping = {};
     {
@@ -244,6 +331,8 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts()
     Uint32 StaticCacheOffset = 0;
 
     std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS> vkSetLayoutBindings;
+    // Binding flags are only used by the static/mutable set when it contains bindless resources
+    std::vector<VkDescriptorBindingFlagsEXT> vkStaticMutableBindingFlags;
 
     DynamicLinearAllocator TempAllocator{GetRawAllocator()};
 
@@ -309,7 +398,17 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts()
         vkSetLayoutBinding.descriptorCount    = ResDesc.ArraySize;
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
-        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(m_UsePushDescriptors && SetId == DESCRIPTOR_SET_ID_DYNAMIC ?
+                                                                                     GetPushDescriptorType(pAttribs->GetDescriptorType()) :
+                                                                                     pAttribs->GetDescriptorType());
+
+        if (SetId == DESCRIPTOR_SET_ID_STATIC_MUTABLE)
+        {
+            vkStaticMutableBindingFlags.emplace_back(
+                (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0 ?
+                    VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT :
+                    0);
+        }
 
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
         {
@@ -327,10 +426,19 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts()
     }
 #endif
 
-    m_DynamicUniformBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR]);
-    m_DynamicStorageBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR]);
-    VERIFY_EXPR(m_DynamicUniformBufferCount == CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR]);
-    VERIFY_EXPR(m_DynamicStorageBufferCount == CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR]);
+    if (m_UsePushDescriptors)
+    {
+        // Buffers in the push descriptor set do not use dynamic offsets
+        m_DynamicUniformBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR]);
+        m_DynamicStorageBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR]);
+    }
+    else
+    {
+        m_DynamicUniformBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR]);
+        m_DynamicStorageBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR]);
+        VERIFY_EXPR(m_DynamicUniformBufferCount == CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR]);
+        VERIFY_EXPR(m_DynamicStorageBufferCount == CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR] + CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR]);
+    }
 
     VERIFY_EXPR(m_pStaticResCache == nullptr || const_cast<const ShaderResourceCacheVk*>(m_pStaticResCache)->GetDescriptorSet(0).GetSize() == StaticCacheOffset);
     VERIFY_EXPR(CacheGroupOffsets[CACHE_GROUP_DYN_UB_STAT_VAR] == CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR]);
@@ -390,6 +498,9 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts()
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(SamplerDesc.ShaderStages);
         vkSetLayoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_SAMPLER;
         vkSetLayoutBinding.pImmutableSamplers = TempAllocator.Construct<VkSampler>(ImmutableSampler.Ptr.RawPtr<SamplerVkImpl>()->GetVkSampler());
+
+        if (SetId == DESCRIPTOR_SET_ID_STATIC_MUTABLE)
+            vkStaticMutableBindingFlags.emplace_back(0);
     }
 
     Uint32 NumSets = 0;
@@ -419,9 +530,6 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts()
 
     SetLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     SetLayoutCI.pNext = nullptr;
-    SetLayoutCI.flags = 0;
-
-    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
 
     for (size_t i = 0; i < vkSetLayoutBindings.size(); ++i)
     {
@@ -429,6 +537,24 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts()
         if (vkSetLayoutBinding.empty())
             continue;
 
+        SetLayoutCI.flags = (m_UsePushDescriptors && i == DESCRIPTOR_SET_ID_DYNAMIC) ?
+            VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+            0;
+        SetLayoutCI.pNext = nullptr;
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfoEXT BindingFlagsCI = {};
+        if (m_HasBindlessResources && i == DESCRIPTOR_SET_ID_STATIC_MUTABLE)
+        {
+            VERIFY_EXPR(vkStaticMutableBindingFlags.size() == vkSetLayoutBinding.size());
+
+            BindingFlagsCI.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+            BindingFlagsCI.bindingCount  = static_cast<Uint32>(vkStaticMutableBindingFlags.size());
+            BindingFlagsCI.pBindingFlags = vkStaticMutableBindingFlags.data();
+
+            SetLayoutCI.pNext = &BindingFlagsCI;
+            SetLayoutCI.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+        }
+
         SetLayoutCI.bindingCount = static_cast<Uint32>(vkSetLayoutBinding.size());
         SetLayoutCI.pBindings    = vkSetLayoutBinding.data();
         m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
@@ -437,6 +563,65 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts()
     VERIFY_EXPR(NumSets == GetNumDescriptorSets());
 }
 
+void PipelineResourceSignatureVkImpl::VerifyBindlessResource(const PipelineResourceDesc& ResDesc) const
+{
+    const auto& PhysicalDevice = GetDevice()->GetPhysicalDevice();
+    const auto& ExtFeatures    = GetDevice()->GetLogicalDevice().GetEnabledExtFeatures();
+    const auto& DescIndFeats   = ExtFeatures.DescriptorIndexing;
+    const auto& DescIndProps   = PhysicalDevice.GetExtProperties().DescriptorIndexing;
+
+    if (DescIndFeats.descriptorBindingPartiallyBound == VK_FALSE)
+    {
+        LOG_ERROR_AND_THROW("Resource '", ResDesc.Name, "' in pipeline resource signature '", m_Desc.Name,
+                            "' is defined with BINDLESS flag, but descriptorBindingPartiallyBound feature is not supported by this device.");
+    }
+
+    bool UpdateAfterBindSupported = false;
+    switch (GetDescriptorType(ResDesc))
+    {
+        case DescriptorType::Sampler:
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+            UpdateAfterBindSupported = DescIndFeats.descriptorBindingSampledImageUpdateAfterBind != VK_FALSE;
+            break;
+        case DescriptorType::StorageImage:
+            UpdateAfterBindSupported = DescIndFeats.descriptorBindingStorageImageUpdateAfterBind != VK_FALSE;
+            break;
+        case DescriptorType::UniformTexelBuffer:
+            UpdateAfterBindSupported = DescIndFeats.descriptorBindingUniformTexelBufferUpdateAfterBind != VK_FALSE;
+            break;
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            UpdateAfterBindSupported = DescIndFeats.descriptorBindingStorageTexelBufferUpdateAfterBind != VK_FALSE;
+            break;
+        case DescriptorType::UniformBuffer:
+            UpdateAfterBindSupported = DescIndFeats.descriptorBindingUniformBufferUpdateAfterBind != VK_FALSE;
+            break;
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+            UpdateAfterBindSupported = DescIndFeats.descriptorBindingStorageBufferUpdateAfterBind != VK_FALSE;
+            break;
+        case DescriptorType::AccelerationStructure:
+            UpdateAfterBindSupported = ExtFeatures.AccelStruct.descriptorBindingAccelerationStructureUpdateAfterBind != VK_FALSE;
+            break;
+        default:
+            UNEXPECTED("Bindless resources with dynamic offsets and input attachments must have been rejected by ValidatePipelineResourceSignatureDesc()");
+    }
+
+    if (!UpdateAfterBindSupported)
+    {
+        LOG_ERROR_AND_THROW("Resource '", ResDesc.Name, "' in pipeline resource signature '", m_Desc.Name,
+                            "' is defined with BINDLESS flag, but this device does not support update-after-bind descriptors of type ",
+                            GetShaderResourceTypeLiteralName(ResDesc.ResourceType), ".");
+    }
+
+    if (ResDesc.ArraySize > DescIndProps.maxPerStageUpdateAfterBindResources)
+    {
+        LOG_ERROR_AND_THROW("Array size (", ResDesc.ArraySize, ") of bindless resource '", ResDesc.Name, "' in pipeline resource signature '", m_Desc.Name,
+                            "' exceeds the maximum number of update-after-bind resources per stage (", DescIndProps.maxPerStageUpdateAfterBindResources, ").");
+    }
+}
+
 PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 {
     Destruct();
@@ -495,7 +680,10 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
         _DescrSetName.append(" - static/mutable set");
         DescrSetName = _DescrSetName.c_str();
 #endif
-        DescriptorSetAllocation SetAllocation = GetDevice()->AllocateDescriptorSet(~Uint64{0}, vkLayout, DescrSetName);
+        // Descriptor sets with bindless resources are allocated from a separate update-after-bind pool
+        DescriptorSetAllocation SetAllocation = m_HasBindlessResources ?
+            GetDevice()->AllocateBindlessDescriptorSet(~Uint64{0}, vkLayout, DescrSetName) :
+            GetDevice()->AllocateDescriptorSet(~Uint64{0}, vkLayout, DescrSetName);
         ResourceCache.AssignDescriptorSetAllocation(GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>(), std::move(SetAllocation));
     }
 }
@@ -540,8 +728,7 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
             if (pCachedResource != pObject)
             {
                 VERIFY(pCachedResource == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
-                DstResourceCache.SetResource(&GetDevice()->GetLogicalDevice(),
-                                             StaticSetIdx,
+                DstResourceCache.SetResource(StaticSetIdx,
                                              DstCacheOffset,
                                              {
                                                  Attr.BindingIndex,
@@ -573,25 +760,31 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
-void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+template <bool PushDescriptors, typename FlushWritesType>
+void PipelineResourceSignatureVkImpl::WriteDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                            VkDescriptorSet              vkDynamicDescriptorSet,
+                                                            DeviceContextIndex           CtxId,
+                                                            FlushWritesType              FlushWrites) const
 {
     VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
-    VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
+    VERIFY_EXPR(PushDescriptors || vkDynamicDescriptorSet != VK_NULL_HANDLE);
+    VERIFY_EXPR(PushDescriptors == m_UsePushDescriptors);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    // All push descriptors must be written by a single command, so the arrays must be large
+    // enough to hold all descriptors of the push descriptor set.
 #ifdef DILIGENT_DEBUG
-    static constexpr size_t ImgUpdateBatchSize          = 4;
-    static constexpr size_t BuffUpdateBatchSize         = 2;
-    static constexpr size_t TexelBuffUpdateBatchSize    = 2;
-    static constexpr size_t AccelStructBatchSize        = 2;
-    static constexpr size_t WriteDescriptorSetBatchSize = 2;
+    static constexpr size_t ImgUpdateBatchSize          = PushDescriptors ? MaxPushDescriptors : 4;
+    static constexpr size_t BuffUpdateBatchSize         = PushDescriptors ? MaxPushDescriptors : 2;
+    static constexpr size_t TexelBuffUpdateBatchSize    = PushDescriptors ? MaxPushDescriptors : 2;
+    static constexpr size_t AccelStructBatchSize        = PushDescriptors ? MaxPushDescriptors : 2;
+    static constexpr size_t WriteDescriptorSetBatchSize = PushDescriptors ? MaxPushDescriptors : 2;
 #else
-    static constexpr size_t ImgUpdateBatchSize          = 64;
-    static constexpr size_t BuffUpdateBatchSize         = 32;
-    static constexpr size_t TexelBuffUpdateBatchSize    = 16;
-    static constexpr size_t AccelStructBatchSize        = 16;
-    static constexpr size_t WriteDescriptorSetBatchSize = 32;
+    static constexpr size_t ImgUpdateBatchSize          = PushDescriptors ? MaxPushDescriptors : 64;
+    static constexpr size_t BuffUpdateBatchSize         = PushDescriptors ? MaxPushDescriptors : 32;
+    static constexpr size_t TexelBuffUpdateBatchSize    = PushDescriptors ? MaxPushDescriptors : 16;
+    static constexpr size_t AccelStructBatchSize        = PushDescriptors ? MaxPushDescriptors : 16;
+    static constexpr size_t WriteDescriptorSetBatchSize = PushDescriptors ? MaxPushDescriptors : 32;
 #endif
 
     // Do not zero-initialize arrays!
@@ -609,7 +802,6 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     const auto  DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
     const auto& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const auto& LogicalDevice  = GetDevice()->GetLogicalDevice();
     const auto  DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
 
     constexpr auto CacheType = ResourceCacheContentType::SRB;
@@ -632,13 +824,14 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         WriteDescrSetIt->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         WriteDescrSetIt->pNext = nullptr;
         VERIFY(SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
+        // dstSet is ignored for push descriptors
         WriteDescrSetIt->dstSet = vkDynamicDescriptorSet;
-        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
+        VERIFY(PushDescriptors || WriteDescrSetIt->dstSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
         WriteDescrSetIt->dstBinding      = Attr.BindingIndex;
         WriteDescrSetIt->dstArrayElement = ArrElem;
         // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
         // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
-        WriteDescrSetIt->descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
+        WriteDescrSetIt->descriptorType  = DescriptorTypeToVkDescriptorType(PushDescriptors ? GetPushDescriptorType(DescrType) : DescrType);
         WriteDescrSetIt->descriptorCount = 0;
 
         auto WriteArrayElements = [&](auto DescrType, auto& DescrIt, const auto& DescrArr) //
@@ -648,6 +841,8 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
                 if (const auto& CachedRes = SetResources.GetResource(CacheOffset + (ArrElem++)))
                 {
                     *DescrIt = CachedRes.GetDescriptorWriteInfo<DescrType>();
+                    if (PushDescriptors)
+                        ApplyPushDescriptorDynamicOffset(*DescrIt, CachedRes, CtxId);
                     ++DescrIt;
                     ++WriteDescrSetIt->descriptorCount;
                 }
@@ -739,7 +934,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         {
             auto DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
             if (DescrWriteCount > 0)
-                LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+                FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
 
             DescrImgIt      = DescrImgInfoArr.begin();
             DescrBuffIt     = DescrBuffInfoArr.begin();
@@ -751,7 +946,39 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     auto DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
     if (DescrWriteCount > 0)
-        LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+        FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
+}
+
+void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+{
+    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+    WriteDynamicResources<false>(ResourceCache, vkDynamicDescriptorSet, DeviceContextIndex{0} /*unused*/,
+                                 [&LogicalDevice](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescrWrites) //
+                                 {
+                                     LogicalDevice.UpdateDescriptorSets(DescrWriteCount, pDescrWrites, 0, nullptr);
+                                 });
+}
+
+void PipelineResourceSignatureVkImpl::PushDynamicResources(const ShaderResourceCacheVk&          ResourceCache,
+                                                           VulkanUtilities::VulkanCommandBuffer& CmdBuffer,
+                                                           VkPipelineBindPoint                   vkBindPoint,
+                                                           VkPipelineLayout                      vkPipelineLayout,
+                                                           Uint32                                SetIndex,
+                                                           DeviceContextIndex                    CtxId) const
+{
+#ifdef DILIGENT_DEBUG
+    Uint32 DbgPushCount = 0;
+#endif
+    WriteDynamicResources<true>(ResourceCache, VK_NULL_HANDLE, CtxId,
+                                [&](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescrWrites) //
+                                {
+                                    CmdBuffer.PushDescriptorSet(vkBindPoint, vkPipelineLayout, SetIndex, DescrWriteCount, pDescrWrites);
+#ifdef DILIGENT_DEBUG
+                                    ++DbgPushCount;
+#endif
+                                });
+    VERIFY(DbgPushCount <= 1, "All push descriptors must be written by a single command");
 }
 
 
@@ -783,6 +1010,10 @@ bool PipelineResourceSignatureVkImpl::DvpValidateCommittedResource(const DeviceC
         const auto& Res = DescrSetResources.GetResource(CacheOffset + ArrIndex);
         if (Res.IsNull())
         {
+            // Bindless arrays are partially bound
+            if ((ResDesc.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0)
+                continue;
+
             LOG_ERROR_MESSAGE("No resource is bound to variable '", GetShaderResourcePrintName(SPIRVAttribs, ArrIndex),
                               "' in shader '", ShaderName, "' of PSO '", PSOName, "'");
             BindingsOK = false;
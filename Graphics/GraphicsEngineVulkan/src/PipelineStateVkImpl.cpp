@@ -161,19 +161,192 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 }
 
 
-void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
-                            std::vector<VkPipelineShaderStageCreateInfo>& Stages,
-                            const PipelineLayoutVk&                       Layout,
-                            const PipelineStateDesc&                      PSODesc,
-                            const GraphicsPipelineDesc&                   GraphicsPipeline,
-                            VulkanUtilities::PipelineWrapper&             Pipeline,
-                            RefCntAutoPtr<IRenderPass>&                   pRenderPass)
+// Initializes the keys of the states that define every part of the graphics pipeline
+// when the pipeline is created from pipeline libraries.
+GraphicsPipelineLibraryCache::PartKeys GetPipelineLibraryKeys(const PipelineStateVkImpl::TShaderStages&                     ShaderStages,
+                                                              const GraphicsPipelineDesc&                                    GraphicsPipeline,
+                                                              PSO_CREATE_FLAGS                                               CreateFlags,
+                                                              const std::vector<GraphicsPipelineLibraryCache::SignatureKey>& SignatureKeys,
+                                                              VkRenderPass                                                   vkRenderPass)
+{
+    using PartKey = GraphicsPipelineLibraryCache::PartKey;
+
+    GraphicsPipelineLibraryCache::PartKeys Keys;
+
+    // Render pass (or attachment formats when dynamic rendering is used) is part of all states except for the vertex input
+    size_t RenderPassHash = ComputeHash(vkRenderPass, GraphicsPipeline.SubpassIndex, GraphicsPipeline.NumRenderTargets, GraphicsPipeline.DSVFormat,
+                                        GraphicsPipeline.SmplDesc.Count, GraphicsPipeline.SmplDesc.Quality);
+    for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+        HashCombine(RenderPassHash, GraphicsPipeline.RTVFormats[rt]);
+
+    const auto InitRenderPass = [&](PartKey& Key) {
+        Key.vkRenderPass     = vkRenderPass;
+        Key.SubpassIndex     = GraphicsPipeline.SubpassIndex;
+        Key.NumRenderTargets = GraphicsPipeline.NumRenderTargets;
+        for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+            Key.RTVFormats[rt] = GraphicsPipeline.RTVFormats[rt];
+        Key.DSVFormat     = GraphicsPipeline.DSVFormat;
+        Key.SampleCount   = GraphicsPipeline.SmplDesc.Count;
+        Key.SampleQuality = GraphicsPipeline.SmplDesc.Quality;
+    };
+
+    size_t LayoutHash = 0;
+    for (const auto& Signature : SignatureKeys)
+        HashCombine(LayoutHash, Signature.Hash);
+
+    {
+        auto& Key = Keys[GraphicsPipelineLibraryCache::PIPELINE_PART_VERTEX_INPUT_INTERFACE];
+
+        Key.CreateFlags       = CreateFlags;
+        Key.PrimitiveTopology = GraphicsPipeline.PrimitiveTopology;
+        Key.Hash              = ComputeHash(GraphicsPipeline.PrimitiveTopology, Uint32{CreateFlags}, GraphicsPipeline.InputLayout.NumElements);
+
+        const auto& InputLayout = GraphicsPipeline.InputLayout;
+        Key.LayoutElements.assign(InputLayout.LayoutElements, InputLayout.LayoutElements + InputLayout.NumElements);
+        for (auto& Elem : Key.LayoutElements)
+        {
+            // Semantic names are not used by Vulkan, and the key must not reference the application's strings
+            Elem.HLSLSemantic = LayoutElement{}.HLSLSemantic;
+            HashCombine(Key.Hash, Elem.InputIndex, Elem.BufferSlot, Elem.NumComponents, Elem.ValueType, Elem.IsNormalized,
+                        Elem.RelativeOffset, Elem.Stride, Elem.Frequency, Elem.InstanceDataStepRate);
+        }
+    }
+
+    for (auto Part : {GraphicsPipelineLibraryCache::PIPELINE_PART_PRE_RASTERIZATION_SHADERS, GraphicsPipelineLibraryCache::PIPELINE_PART_FRAGMENT_SHADER})
+    {
+        auto& Key = Keys[Part];
+
+        Key.CreateFlags      = CreateFlags;
+        Key.Signatures       = SignatureKeys;
+        Key.ShadingRateFlags = GraphicsPipeline.ShadingRateFlags;
+        InitRenderPass(Key);
+
+        const bool IsFragmentShader = Part == GraphicsPipelineLibraryCache::PIPELINE_PART_FRAGMENT_SHADER;
+
+        size_t ShadersHash = 0;
+        for (const auto& Stage : ShaderStages)
+        {
+            if ((Stage.Type == SHADER_TYPE_PIXEL) != IsFragmentShader)
+                continue;
+
+            for (size_t i = 0; i < Stage.Shaders.size(); ++i)
+            {
+                GraphicsPipelineLibraryCache::ShaderKey Shader;
+                Shader.Type       = Stage.Type;
+                Shader.SPIRV      = Stage.SPIRVs[i];
+                Shader.EntryPoint = Stage.Shaders[i]->GetEntryPoint();
+                HashCombine(ShadersHash, Shader.Type, ComputeHashRaw(Shader.SPIRV.data(), Shader.SPIRV.size() * sizeof(uint32_t)),
+                            CStringHash<Char>{}(Shader.EntryPoint.c_str()));
+                Key.Shaders.emplace_back(std::move(Shader));
+            }
+        }
+
+        if (IsFragmentShader)
+        {
+            Key.DepthStencilDesc = GraphicsPipeline.DepthStencilDesc;
+            Key.SampleMask       = GraphicsPipeline.SampleMask;
+            Key.Hash             = ComputeHash(ShadersHash, LayoutHash, RenderPassHash, GraphicsPipeline.DepthStencilDesc, GraphicsPipeline.SampleMask,
+                                               GraphicsPipeline.ShadingRateFlags, Uint32{CreateFlags});
+        }
+        else
+        {
+            // Patch control point count is part of the tessellation state that belongs to pre-rasterization shaders
+            Key.RasterizerDesc    = GraphicsPipeline.RasterizerDesc;
+            Key.NumViewports      = GraphicsPipeline.NumViewports;
+            Key.PrimitiveTopology = GraphicsPipeline.PrimitiveTopology;
+            Key.Hash              = ComputeHash(ShadersHash, LayoutHash, RenderPassHash, GraphicsPipeline.RasterizerDesc, GraphicsPipeline.NumViewports,
+                                                GraphicsPipeline.PrimitiveTopology, GraphicsPipeline.ShadingRateFlags, Uint32{CreateFlags});
+        }
+    }
+
+    {
+        auto& Key = Keys[GraphicsPipelineLibraryCache::PIPELINE_PART_FRAGMENT_OUTPUT_INTERFACE];
+
+        Key.BlendDesc  = GraphicsPipeline.BlendDesc;
+        Key.SampleMask = GraphicsPipeline.SampleMask;
+        InitRenderPass(Key);
+        Key.Hash = ComputeHash(RenderPassHash, GraphicsPipeline.BlendDesc, GraphicsPipeline.SampleMask);
+    }
+
+    return Keys;
+}
+
+// Returns the states of the resource signatures that define the pipeline layout
+std::vector<GraphicsPipelineLibraryCache::SignatureKey> GetPipelineLibrarySignatureKeys(const PipelineStateVkImpl& PSO)
+{
+    std::vector<GraphicsPipelineLibraryCache::SignatureKey> SignatureKeys;
+    for (Uint32 s = 0; s < PSO.GetResourceSignatureCount(); ++s)
+    {
+        const auto* pSignature = PSO.GetResourceSignature(s);
+        if (pSignature == nullptr)
+            continue;
+
+        const auto& Desc = pSignature->GetDesc();
+
+        GraphicsPipelineLibraryCache::SignatureKey Key;
+        Key.BindingIndex = Desc.BindingIndex;
+        Key.Flags        = Desc.Flags;
+        Key.Hash         = pSignature->GetHash();
+
+        Key.Resources.resize(pSignature->GetTotalResourceCount());
+        for (Uint32 r = 0; r < pSignature->GetTotalResourceCount(); ++r)
+        {
+            const auto& ResDesc = pSignature->GetResourceDesc(r);
+            const auto& Attribs = pSignature->GetResourceAttribs(r);
+
+            auto& Res                = Key.Resources[r];
+            Res.ShaderStages         = ResDesc.ShaderStages;
+            Res.ArraySize            = ResDesc.ArraySize;
+            Res.ResourceType         = ResDesc.ResourceType;
+            Res.VarType              = ResDesc.VarType;
+            Res.Flags                = ResDesc.Flags;
+            Res.BindingIndex         = Attribs.BindingIndex;
+            Res.DescrArraySize       = Attribs.ArraySize;
+            Res.DescrType            = Attribs.DescrType;
+            Res.DescrSet             = Attribs.DescrSet;
+            Res.ImtblSamplerAssigned = Attribs.IsImmutableSamplerAssigned();
+        }
+
+        Key.ImmutableSamplers.resize(pSignature->GetImmutableSamplerCount());
+        for (Uint32 i = 0; i < pSignature->GetImmutableSamplerCount(); ++i)
+        {
+            auto& Sampler        = Key.ImmutableSamplers[i];
+            Sampler.ShaderStages = Desc.ImmutableSamplers[i].ShaderStages;
+            Sampler.Desc         = Desc.ImmutableSamplers[i].Desc;
+            // The name does not affect the sampler, and the key must not reference the signature's strings
+            Sampler.Desc.Name = nullptr;
+        }
+
+        SignatureKeys.emplace_back(std::move(Key));
+    }
+    return SignatureKeys;
+}
+
+
+void CreateGraphicsPipeline(RenderDeviceVkImpl*                                            pDeviceVk,
+                            std::vector<VkPipelineShaderStageCreateInfo>&                  Stages,
+                            const PipelineStateVkImpl::TShaderStages&                      ShaderStages,
+                            const PipelineLayoutVk&                                        Layout,
+                            const std::vector<GraphicsPipelineLibraryCache::SignatureKey>& SignatureKeys,
+                            const PipelineStateDesc&                                       PSODesc,
+                            const GraphicsPipelineDesc&                                    GraphicsPipeline,
+                            PSO_CREATE_FLAGS                                               CreateFlags,
+                            VulkanUtilities::PipelineWrapper&                              Pipeline,
+                            RefCntAutoPtr<IRenderPass>&                                    pRenderPass)
 {
     const auto& LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const auto& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
     auto&       RPCache        = pDeviceVk->GetImplicitRenderPassCache();
 
-    if (pRenderPass == nullptr)
+    // When dynamic rendering is enabled, implicit render passes are not needed.
+    // Texture-based shading rate requires the fragment shading rate attachment in the render pass,
+    // so such pipelines always use the render pass cache.
+    const bool UseDynamicRendering =
+        pRenderPass == nullptr &&
+        LogicalDevice.GetEnabledExtFeatures().DynamicRendering.dynamicRendering != VK_FALSE &&
+        (GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) == 0;
+
+    if (pRenderPass == nullptr && !UseDynamicRendering)
     {
         RenderPassCache::RenderPassCacheKey Key{
             GraphicsPipeline.NumRenderTargets,
@@ -295,8 +468,9 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
         DepthStencilStateDesc_To_VkDepthStencilStateCI(GraphicsPipeline.DepthStencilDesc);
     PipelineCI.pDepthStencilState = &DepthStencilStateCI;
 
-    const auto& RPDesc           = pRenderPass->GetDesc();
-    const auto  NumRTAttachments = RPDesc.pSubpasses[GraphicsPipeline.SubpassIndex].RenderTargetAttachmentCount;
+    const auto NumRTAttachments = UseDynamicRendering ?
+        Uint32{GraphicsPipeline.NumRenderTargets} :
+        pRenderPass->GetDesc().pSubpasses[GraphicsPipeline.SubpassIndex].RenderTargetAttachmentCount;
     VERIFY_EXPR(GraphicsPipeline.pRenderPass != nullptr || GraphicsPipeline.NumRenderTargets == NumRTAttachments);
     std::vector<VkPipelineColorBlendAttachmentState> ColorBlendAttachmentStates(NumRTAttachments);
 
@@ -344,17 +518,84 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
         DynamicStates.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
     }
 
+    if ((CreateFlags & PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE) != 0)
+    {
+        VERIFY_EXPR(LogicalDevice.GetEnabledExtFeatures().ExtendedDynamicState.extendedDynamicState != VK_FALSE);
+
+        // Cull mode, front face and depth-stencil states in VkPipelineRasterizationStateCreateInfo and
+        // VkPipelineDepthStencilStateCreateInfo will be ignored and must be set dynamically before any draw commands.
+        // The values from the pipeline description are set by the device context every time the pipeline is bound.
+        DynamicStates.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_FRONT_FACE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_OP_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_WRITE_MASK);
+
+        // Mesh pipelines have no input assembly state.
+        if (PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS)
+        {
+            // Only the topology class specified by VkPipelineInputAssemblyStateCreateInfo::topology
+            // is used by the pipeline, the actual topology must be set dynamically.
+            DynamicStates.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+        }
+    }
+
     DynamicStateCI.dynamicStateCount = static_cast<uint32_t>(DynamicStates.size());
     DynamicStateCI.pDynamicStates    = DynamicStates.data();
     PipelineCI.pDynamicState         = &DynamicStateCI;
 
 
-    PipelineCI.renderPass         = pRenderPass.RawPtr<IRenderPassVk>()->GetVkRenderPass();
-    PipelineCI.subpass            = GraphicsPipeline.SubpassIndex;
+    VkPipelineRenderingCreateInfoKHR         RenderingCI{};
+    std::array<VkFormat, MAX_RENDER_TARGETS> ColorAttachmentFormats{};
+    if (UseDynamicRendering)
+    {
+        for (Uint32 rt = 0; rt < NumRTAttachments; ++rt)
+            ColorAttachmentFormats[rt] = TexFormatToVkFormat(GraphicsPipeline.RTVFormats[rt]);
+
+        RenderingCI.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        RenderingCI.pNext                   = nullptr;
+        RenderingCI.viewMask                = 0;
+        RenderingCI.colorAttachmentCount    = NumRTAttachments;
+        RenderingCI.pColorAttachmentFormats = ColorAttachmentFormats.data();
+        RenderingCI.depthAttachmentFormat   = TexFormatToVkFormat(GraphicsPipeline.DSVFormat);
+        RenderingCI.stencilAttachmentFormat =
+            GetTextureFormatAttribs(GraphicsPipeline.DSVFormat).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL ?
+            RenderingCI.depthAttachmentFormat :
+            VK_FORMAT_UNDEFINED;
+
+        PipelineCI.pNext      = &RenderingCI;
+        PipelineCI.renderPass = VK_NULL_HANDLE;
+        PipelineCI.subpass    = 0;
+    }
+    else
+    {
+        PipelineCI.renderPass = pRenderPass.RawPtr<IRenderPassVk>()->GetVkRenderPass();
+        PipelineCI.subpass    = GraphicsPipeline.SubpassIndex;
+    }
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, VK_NULL_HANDLE, PSODesc.Name);
+    // Explicit render passes may be destroyed and their handles reused, so pipeline
+    // libraries are only used with implicit render passes and dynamic rendering.
+    const bool UsePipelineLibraries =
+        (CreateFlags & PSO_CREATE_FLAG_FAST_LINK) != 0 &&
+        PSODesc.PipelineType == PIPELINE_TYPE_GRAPHICS &&
+        GraphicsPipeline.pRenderPass == nullptr &&
+        LogicalDevice.GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE;
+
+    if (UsePipelineLibraries)
+    {
+        const auto Keys = GetPipelineLibraryKeys(ShaderStages, GraphicsPipeline, CreateFlags, SignatureKeys, PipelineCI.renderPass);
+        Pipeline        = pDeviceVk->GetPipelineLibraryCache().LinkPipeline(PipelineCI, Keys, PSODesc.Name);
+    }
+    else
+    {
+        Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, VK_NULL_HANDLE, PSODesc.Name);
+    }
 }
 
 
@@ -778,12 +1019,7 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, Rende
 {
     try
     {
-        std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
-        std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
-
-        InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
-
-        CreateGraphicsPipeline(pDeviceVk, vkShaderStages, m_PipelineLayout, m_Desc, GetGraphicsPipelineDesc(), m_Pipeline, GetRenderPassPtr());
+        Construct(CreateInfo);
     }
     catch (...)
     {
@@ -797,12 +1033,7 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, Rende
 {
     try
     {
-        std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
-        std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
-
-        InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
-
-        CreateComputePipeline(pDeviceVk, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline);
+        Construct(CreateInfo);
     }
     catch (...)
     {
@@ -816,23 +1047,7 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, Rende
 {
     try
     {
-        const auto& LogicalDevice = pDeviceVk->GetLogicalDevice();
-
-        std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
-        std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
-
-        const auto ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
-
-        const auto vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
-
-        CreateRayTracingPipeline(pDeviceVk, vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, GetRayTracingPipelineDesc(), m_Pipeline);
-
-        VERIFY(m_pRayTracingPipelineData->NameToGroupIndex.size() == vkShaderGroups.size(),
-               "The size of NameToGroupIndex map does not match the actual number of groups in the pipeline. This is a bug.");
-        // Get shader group handles from the PSO.
-        auto err = LogicalDevice.GetRayTracingShaderGroupHandles(m_Pipeline, 0, static_cast<uint32_t>(vkShaderGroups.size()), m_pRayTracingPipelineData->ShaderDataSize, m_pRayTracingPipelineData->ShaderHandles);
-        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get shader group handles");
-        (void)err;
+        Construct(CreateInfo);
     }
     catch (...)
     {
@@ -841,8 +1056,56 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, Rende
     }
 }
 
+void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
+{
+    std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+    std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+
+    const auto ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+
+    // Resource signature states are only needed to look up pipeline libraries
+    std::vector<GraphicsPipelineLibraryCache::SignatureKey> SignatureKeys;
+    if ((GetCreateFlags() & PSO_CREATE_FLAG_FAST_LINK) != 0)
+        SignatureKeys = GetPipelineLibrarySignatureKeys(*this);
+
+    CreateGraphicsPipeline(GetDevice(), vkShaderStages, ShaderStages, m_PipelineLayout, SignatureKeys, m_Desc, GetGraphicsPipelineDesc(),
+                           GetCreateFlags(), m_Pipeline, GetRenderPassPtr());
+}
+
+void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
+{
+    std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+    std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+
+    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+
+    CreateComputePipeline(GetDevice(), vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline);
+}
+
+void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo)
+{
+    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+    std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+
+    const auto ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+
+    const auto vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
+
+    CreateRayTracingPipeline(GetDevice(), vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, GetRayTracingPipelineDesc(), m_Pipeline);
+
+    VERIFY(m_pRayTracingPipelineData->NameToGroupIndex.size() == vkShaderGroups.size(),
+           "The size of NameToGroupIndex map does not match the actual number of groups in the pipeline. This is a bug.");
+    // Get shader group handles from the PSO.
+    auto err = LogicalDevice.GetRayTracingShaderGroupHandles(m_Pipeline, 0, static_cast<uint32_t>(vkShaderGroups.size()), m_pRayTracingPipelineData->ShaderDataSize, m_pRayTracingPipelineData->ShaderHandles);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get shader group handles");
+    (void)err;
+}
+
 PipelineStateVkImpl::~PipelineStateVkImpl()
 {
+    WaitForAsyncInitialization();
     Destruct();
 }
 
@@ -903,12 +1166,15 @@ void PipelineStateVkImpl::DvpValidateResourceLimits() const
             const auto& ResAttr   = pSignature->GetResourceAttribs(r);
             const auto  DescIndex = static_cast<Uint32>(ResAttr.DescrType);
 
-            DescriptorCount[DescIndex] += ResAttr.ArraySize;
+            // Bindless resources are verified against update-after-bind limits when the signature is created
+            const auto ResCount = (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) == 0 ? ResAttr.ArraySize : 0u;
+
+            DescriptorCount[DescIndex] += ResCount;
 
             for (auto ShaderStages = ResDesc.ShaderStages; ShaderStages != 0;)
             {
                 const auto ShaderInd = GetShaderTypePipelineIndex(ExtractLSB(ShaderStages), m_Desc.PipelineType);
-                PerStageDescriptorCount[ShaderInd][DescIndex] += ResAttr.ArraySize;
+                PerStageDescriptorCount[ShaderInd][DescIndex] += ResCount;
                 ShaderStagePresented[ShaderInd] = true;
             }
 
@@ -80,6 +80,7 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     m_LogicalVkDevice        {std::move(LogicalDevice) },
     m_FramebufferCache       {*this                    },
     m_ImplicitRenderPassCache{*this                    },
+    m_PipelineLibraryCache   {*this                    },
     m_DescriptorSetAllocator
     {
         *this,
@@ -124,6 +125,28 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DynamicDescriptorPoolSize.MaxDescriptorSets,
         false // Pools can only be reset
     },
+    m_BindlessDescriptorSetAllocator
+    {
+        *this,
+        "Bindless descriptor pool",
+        // Update-after-bind sets can't contain dynamic buffers
+        std::vector<VkDescriptorPoolSize>
+        {
+            {VK_DESCRIPTOR_TYPE_SAMPLER,                    EngineCI.BindlessDescriptorPoolSize.NumSeparateSamplerDescriptors},
+            {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,     EngineCI.BindlessDescriptorPoolSize.NumCombinedSamplerDescriptors},
+            {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,              EngineCI.BindlessDescriptorPoolSize.NumSampledImageDescriptors},
+            {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,              EngineCI.BindlessDescriptorPoolSize.NumStorageImageDescriptors},
+            {VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER,       EngineCI.BindlessDescriptorPoolSize.NumUniformTexelBufferDescriptors},
+            {VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER,       EngineCI.BindlessDescriptorPoolSize.NumStorageTexelBufferDescriptors},
+            {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,             EngineCI.BindlessDescriptorPoolSize.NumUniformBufferDescriptors},
+            {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,             EngineCI.BindlessDescriptorPoolSize.NumStorageBufferDescriptors},
+            {VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,           EngineCI.BindlessDescriptorPoolSize.NumInputAttachmentDescriptors},
+            {VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, EngineCI.BindlessDescriptorPoolSize.NumAccelStructDescriptors}
+        },
+        EngineCI.BindlessDescriptorPoolSize.MaxDescriptorSets,
+        true,
+        true // Update after bind
+    },
     m_MemoryMgr
     {
         "Global resource memory manager",
@@ -142,10 +165,12 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DynamicHeapSize,
         ~Uint64{0}
     },
-    m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Vulkan, m_PhysicalDevice->GetVkVersion(), EngineCI.pDxCompilerPath)}
+    m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Vulkan, m_PhysicalDevice->GetVkVersion(), EngineCI.pDxCompilerPath)},
+    m_BatchQueueSubmissions{EngineCI.BatchQueueSubmissions != False},
+    m_MipsGenerator{*this}
 // clang-format on
 {
-    static_assert(sizeof(VulkanDescriptorPoolSize) == sizeof(Uint32) * 11, "Please add new descriptors to m_DescriptorSetAllocator and m_DynamicDescriptorPool constructors");
+    static_assert(sizeof(VulkanDescriptorPoolSize) == sizeof(Uint32) * 11, "Please add new descriptors to m_DescriptorSetAllocator, m_DynamicDescriptorPool and m_BindlessDescriptorSetAllocator constructors");
 
     const auto vkVersion    = m_PhysicalDevice->GetVkVersion();
     m_DeviceInfo.Type       = RENDER_DEVICE_TYPE_VULKAN;
@@ -205,6 +230,7 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
     ReleaseStaleResources(true);
 
     DEV_CHECK_ERR(m_DescriptorSetAllocator.GetAllocatedDescriptorSetCounter() == 0, "All allocated descriptor sets must have been released now.");
+    DEV_CHECK_ERR(m_BindlessDescriptorSetAllocator.GetAllocatedDescriptorSetCounter() == 0, "All allocated bindless descriptor sets must have been released now.");
     DEV_CHECK_ERR(m_DynamicDescriptorPool.GetAllocatedPoolCounter() == 0, "All allocated dynamic descriptor pools must have been released now.");
     DEV_CHECK_ERR(m_DynamicMemoryManager.GetMasterBlockCounter() == 0, "All allocated dynamic master blocks must have been returned to the pool.");
 
@@ -383,11 +409,22 @@ void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex
                                              const VkSubmitInfo&                                         SubmitInfo,
                                              Uint64&                                                     SubmittedCmdBuffNumber, // Number of the submitted command buffer
                                              Uint64&                                                     SubmittedFenceValue,    // Fence value associated with the submitted command buffer
-                                             std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences           // List of fences to signal
+                                             std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences,          // List of fences to signal
+                                             bool                                                        DeferSubmission         // Whether to add the work to the pending batch
 )
 {
+    VERIFY(!DeferSubmission || pSignalFences == nullptr || pSignalFences->empty(),
+           "Fences are signaled by the sync point of the last submission and require immediate submission");
+
     // Submit the command list to the queue
-    auto CmbBuffInfo       = TRenderDeviceBase::SubmitCommandBuffer(CommandQueueId, true, SubmitInfo);
+    auto CmbBuffInfo = DeferSubmission ?
+        TRenderDeviceBase::SubmitCommandBufferWithFunc(CommandQueueId, true,
+                                                       [&SubmitInfo](ICommandQueueVk& CmdQueue) //
+                                                       {
+                                                           return CmdQueue.EnqueueSubmit(SubmitInfo);
+                                                       }) :
+        TRenderDeviceBase::SubmitCommandBuffer(CommandQueueId, true, SubmitInfo);
+
     SubmittedFenceValue    = CmbBuffInfo.FenceValue;
     SubmittedCmdBuffNumber = CmbBuffInfo.CmdBufferNumber;
 
@@ -405,11 +442,14 @@ void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex
     }
 }
 
-Uint64 RenderDeviceVkImpl::ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueId, const VkSubmitInfo& SubmitInfo, std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences)
+Uint64 RenderDeviceVkImpl::ExecuteCommandBuffer(SoftwareQueueIndex                                          CommandQueueId,
+                                                const VkSubmitInfo&                                         SubmitInfo,
+                                                std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences,
+                                                bool                                                        DeferSubmission)
 {
     Uint64 SubmittedFenceValue    = 0;
     Uint64 SubmittedCmdBuffNumber = 0;
-    SubmitCommandBuffer(CommandQueueId, SubmitInfo, SubmittedCmdBuffNumber, SubmittedFenceValue, pSignalFences);
+    SubmitCommandBuffer(CommandQueueId, SubmitInfo, SubmittedCmdBuffNumber, SubmittedFenceValue, pSignalFences, DeferSubmission);
 
     m_MemoryMgr.ShrinkMemory();
     PurgeReleaseQueue(CommandQueueId);
@@ -436,8 +476,9 @@ void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
 
 void RenderDeviceVkImpl::ReleaseStaleResources(bool ForceRelease)
 {
-    m_MemoryMgr.ShrinkMemory();
+    // Purge the release queues first so that the pages emptied by the released allocations can be destroyed
     PurgeReleaseQueues(ForceRelease);
+    m_MemoryMgr.ShrinkMemory();
 }
 
 
@@ -670,6 +711,70 @@ void RenderDeviceVkImpl::CreateFenceFromVulkanResource(VkSemaphore      vkTimeli
     CreateFenceImpl(ppFence, Desc, vkTimelineSemaphore);
 }
 
+RenderPassCacheStatsVk RenderDeviceVkImpl::GetRenderPassCacheStats()
+{
+    const auto RenderPassStats  = m_ImplicitRenderPassCache.GetStatistics();
+    const auto FramebufferStats = m_FramebufferCache.GetStatistics();
+
+    RenderPassCacheStatsVk Stats;
+    Stats.RenderPassHitCount       = RenderPassStats.HitCount;
+    Stats.RenderPassCreationCount  = RenderPassStats.CreationCount;
+    Stats.FramebufferHitCount      = FramebufferStats.HitCount;
+    Stats.FramebufferCreationCount = FramebufferStats.CreationCount;
+    return Stats;
+}
+
+PipelineLibraryCacheStatsVk RenderDeviceVkImpl::GetPipelineLibraryCacheStats()
+{
+    const auto LibraryStats = m_PipelineLibraryCache.GetStatistics();
+
+    PipelineLibraryCacheStatsVk Stats;
+    Stats.HitCount      = LibraryStats.HitCount;
+    Stats.CreationCount = LibraryStats.CreationCount;
+    Stats.LinkCount     = LibraryStats.LinkCount;
+    Stats.EvictionCount = LibraryStats.EvictionCount;
+    return Stats;
+}
+
+static MemoryHeapStatsVk HeapStatisticsToMemoryHeapStatsVk(const VulkanUtilities::VulkanMemoryManager::HeapStatistics& HeapStats)
+{
+    MemoryHeapStatsVk Stats;
+    Stats.Budget                     = HeapStats.Budget;
+    Stats.Usage                      = HeapStats.Usage;
+    Stats.AllocatedSize              = HeapStats.AllocatedSize;
+    Stats.UsedSize                   = HeapStats.UsedSize;
+    Stats.MemoryObjectCount          = HeapStats.MemoryObjectCount;
+    Stats.DedicatedMemoryObjectCount = HeapStats.DedicatedMemoryObjectCount;
+    return Stats;
+}
+
+MemoryHeapStatsVk RenderDeviceVkImpl::GetMemoryHeapStats(Uint32 HeapIndex) const
+{
+    const auto HeapCount = m_PhysicalDevice->GetMemoryProperties().memoryHeapCount;
+    if (HeapIndex >= HeapCount)
+    {
+        DEV_ERROR("Heap index (", HeapIndex, ") is out of range. The device has ", HeapCount, " memory heaps.");
+        return MemoryHeapStatsVk{};
+    }
+
+    return HeapStatisticsToMemoryHeapStatsVk(m_MemoryMgr.GetHeapStatistics(HeapIndex));
+}
+
+void RenderDeviceVkImpl::SetMemoryBudgetCallback(MemoryBudgetCallbackVkType Callback, void* pUserData)
+{
+    if (Callback == nullptr)
+    {
+        m_MemoryMgr.SetBudgetCallback(nullptr);
+        return;
+    }
+
+    m_MemoryMgr.SetBudgetCallback(
+        [Callback, pUserData](uint32_t HeapIndex, const VulkanUtilities::VulkanMemoryManager::HeapStatistics& HeapStats) {
+            const auto Stats = HeapStatisticsToMemoryHeapStatsVk(HeapStats);
+            Callback(HeapIndex, &Stats, pUserData);
+        });
+}
+
 void RenderDeviceVkImpl::CreateTLAS(const TopLevelASDesc& Desc,
                                     ITopLevelAS**         ppTLAS)
 {
@@ -51,6 +51,12 @@ RenderPassCache::~RenderPassCache()
     VERIFY(m_Cache.empty(), "Render pass cache is not empty. Did you call Destroy?");
 }
 
+RenderPassCache::Statistics RenderPassCache::GetStatistics()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    return m_Stats;
+}
+
 void RenderPassCache::Destroy()
 {
     auto& FBCache = m_DeviceVkImpl.GetFramebufferCache();
@@ -186,6 +192,8 @@ RenderPassVkImpl* RenderPassCache::GetRenderPass(const RenderPassCacheKey& Key)
     auto                        it = m_Cache.find(Key);
     if (it == m_Cache.end())
     {
+        ++m_Stats.CreationCount;
+
         // Do not zero-initialize arrays
         std::array<RenderPassAttachmentDesc, MAX_RENDER_TARGETS + 2> Attachments;
         std::array<AttachmentReference, MAX_RENDER_TARGETS + 2>      AttachmentReferences;
@@ -233,6 +241,10 @@ RenderPassVkImpl* RenderPassCache::GetRenderPass(const RenderPassCacheKey& Key)
         VERIFY_EXPR(pRenderPass != nullptr);
         it = m_Cache.emplace(Key, std::move(pRenderPass)).first;
     }
+    else
+    {
+        ++m_Stats.HitCount;
+    }
 
     return it->second;
 }
@@ -289,10 +289,9 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
 }
 
 const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
-    const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice,
-    Uint32                                      DescrSetIndex,
-    Uint32                                      CacheOffset,
-    SetResourceInfo&&                           SrcRes)
+    Uint32            DescrSetIndex,
+    Uint32            CacheOffset,
+    SetResourceInfo&& SrcRes)
 {
     auto& DescrSet = GetDescriptorSet(DescrSetIndex);
     auto& DstRes   = DescrSet.GetResource(CacheOffset);
@@ -327,90 +326,142 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         ++m_NumDynamicBuffers;
     }
 
-    auto vkSet = DescrSet.GetVkDescriptorSet();
-    if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
+    if (DescrSet.GetVkDescriptorSet() != VK_NULL_HANDLE && DstRes.pObject)
     {
-        VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
+        // Do not write the descriptor now, but record the write so that all descriptors
+        // set between two commits are written by a few vkUpdateDescriptorSets calls.
+        ThreadingTools::LockHelper Lock{m_PendingWritesLockFlag};
+
+        PendingDescriptorWrite PendingWrite;
+        PendingWrite.SetIndex     = static_cast<Uint16>(DescrSetIndex);
+        PendingWrite.BindingIndex = static_cast<Uint16>(SrcRes.BindingIndex);
+        PendingWrite.CacheOffset  = CacheOffset;
+        PendingWrite.ArrayIndex   = SrcRes.ArrayIndex;
+        VERIFY_EXPR(PendingWrite.SetIndex == DescrSetIndex && PendingWrite.BindingIndex == SrcRes.BindingIndex);
+        m_PendingWrites.push_back(PendingWrite);
+        m_HasPendingWrites.store(true, std::memory_order_release);
+    }
+
+    UpdateRevision(DescrSetIndex);
+
+    return DstRes;
+}
+
+void ShaderResourceCacheVk::FlushDescriptorWrites(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice)
+{
+    if (!m_HasPendingWrites.load(std::memory_order_acquire))
+        return;
+
+    // The same resource binding may be committed in multiple contexts simultaneously
+    ThreadingTools::LockHelper Lock{m_PendingWritesLockFlag};
+    if (!m_HasPendingWrites.load(std::memory_order_relaxed))
+        return;
+
+#ifdef DILIGENT_DEBUG
+    static constexpr size_t WriteBatchSize = 2;
+#else
+    static constexpr size_t WriteBatchSize = 32;
+#endif
+
+    // Do not zero-initialize arrays!
+    union DescriptorWriteInfo
+    {
+        VkDescriptorImageInfo                        vkDescrImageInfo;
+        VkDescriptorBufferInfo                       vkDescrBufferInfo;
+        VkBufferView                                 vkDescrBufferView;
+        VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
+    };
+    std::array<DescriptorWriteInfo, WriteBatchSize>  WriteInfoArr;
+    std::array<VkWriteDescriptorSet, WriteBatchSize> WriteDescrSetArr;
+
+    Uint32 NumWrites = 0;
+    for (const auto& PendingWrite : m_PendingWrites)
+    {
+        const auto& DescrSet = const_cast<const ShaderResourceCacheVk*>(this)->GetDescriptorSet(PendingWrite.SetIndex);
+        const auto& Res      = DescrSet.GetResource(PendingWrite.CacheOffset);
+        // The resource may have been reset after the write was recorded
+        if (!Res)
+            continue;
+
+        auto& WriteInfo     = WriteInfoArr[NumWrites];
+        auto& WriteDescrSet = WriteDescrSetArr[NumWrites];
 
-        VkWriteDescriptorSet WriteDescrSet;
         WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         WriteDescrSet.pNext           = nullptr;
-        WriteDescrSet.dstSet          = vkSet;
-        WriteDescrSet.dstBinding      = SrcRes.BindingIndex;
-        WriteDescrSet.dstArrayElement = SrcRes.ArrayIndex;
+        WriteDescrSet.dstSet          = DescrSet.GetVkDescriptorSet();
+        WriteDescrSet.dstBinding      = PendingWrite.BindingIndex;
+        WriteDescrSet.dstArrayElement = PendingWrite.ArrayIndex;
         WriteDescrSet.descriptorCount = 1;
         // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
         // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
-        WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(DstRes.Type);
+        WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(Res.Type);
         WriteDescrSet.pImageInfo       = nullptr;
         WriteDescrSet.pBufferInfo      = nullptr;
         WriteDescrSet.pTexelBufferView = nullptr;
-
-        // Do not zero-initialize!
-        union
-        {
-            VkDescriptorImageInfo                        vkDescrImageInfo;
-            VkDescriptorBufferInfo                       vkDescrBufferInfo;
-            VkBufferView                                 vkDescrBufferView;
-            VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
-        };
+        VERIFY_EXPR(WriteDescrSet.dstSet != VK_NULL_HANDLE);
 
         static_assert(static_cast<Uint32>(DescriptorType::Count) == 15, "Please update the switch below to handle the new descriptor type");
-        switch (DstRes.Type)
+        switch (Res.Type)
         {
             case DescriptorType::Sampler:
-                vkDescrImageInfo         = DstRes.GetSamplerDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+                WriteInfo.vkDescrImageInfo = Res.GetSamplerDescriptorWriteInfo();
+                WriteDescrSet.pImageInfo   = &WriteInfo.vkDescrImageInfo;
                 break;
 
             case DescriptorType::CombinedImageSampler:
             case DescriptorType::SeparateImage:
             case DescriptorType::StorageImage:
-                vkDescrImageInfo         = DstRes.GetImageDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+                WriteInfo.vkDescrImageInfo = Res.GetImageDescriptorWriteInfo();
+                WriteDescrSet.pImageInfo   = &WriteInfo.vkDescrImageInfo;
                 break;
 
             case DescriptorType::UniformTexelBuffer:
             case DescriptorType::StorageTexelBuffer:
             case DescriptorType::StorageTexelBuffer_ReadOnly:
-                vkDescrBufferView              = DstRes.GetBufferViewWriteInfo();
-                WriteDescrSet.pTexelBufferView = &vkDescrBufferView;
+                WriteInfo.vkDescrBufferView    = Res.GetBufferViewWriteInfo();
+                WriteDescrSet.pTexelBufferView = &WriteInfo.vkDescrBufferView;
                 break;
 
             case DescriptorType::UniformBuffer:
             case DescriptorType::UniformBufferDynamic:
-                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
+                WriteInfo.vkDescrBufferInfo = Res.GetUniformBufferDescriptorWriteInfo();
+                WriteDescrSet.pBufferInfo   = &WriteInfo.vkDescrBufferInfo;
                 break;
 
             case DescriptorType::StorageBuffer:
             case DescriptorType::StorageBuffer_ReadOnly:
             case DescriptorType::StorageBufferDynamic:
             case DescriptorType::StorageBufferDynamic_ReadOnly:
-                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
+                WriteInfo.vkDescrBufferInfo = Res.GetStorageBufferDescriptorWriteInfo();
+                WriteDescrSet.pBufferInfo   = &WriteInfo.vkDescrBufferInfo;
                 break;
 
             case DescriptorType::InputAttachment:
-                vkDescrImageInfo         = DstRes.GetInputAttachmentDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+                WriteInfo.vkDescrImageInfo = Res.GetInputAttachmentDescriptorWriteInfo();
+                WriteDescrSet.pImageInfo   = &WriteInfo.vkDescrImageInfo;
                 break;
 
             case DescriptorType::AccelerationStructure:
-                vkDescrAccelStructInfo = DstRes.GetAccelerationStructureWriteInfo();
-                WriteDescrSet.pNext    = &vkDescrAccelStructInfo;
+                WriteInfo.vkDescrAccelStructInfo = Res.GetAccelerationStructureWriteInfo();
+                WriteDescrSet.pNext              = &WriteInfo.vkDescrAccelStructInfo;
                 break;
 
             default:
                 UNEXPECTED("Unexpected descriptor type");
         }
 
-        pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+        if (++NumWrites == WriteBatchSize)
+        {
+            LogicalDevice.UpdateDescriptorSets(NumWrites, WriteDescrSetArr.data(), 0, nullptr);
+            NumWrites = 0;
+        }
     }
 
-    UpdateRevision();
+    if (NumWrites > 0)
+        LogicalDevice.UpdateDescriptorSets(NumWrites, WriteDescrSetArr.data(), 0, nullptr);
 
-    return DstRes;
+    m_PendingWrites.clear();
+    m_HasPendingWrites.store(false, std::memory_order_release);
 }
 
 void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
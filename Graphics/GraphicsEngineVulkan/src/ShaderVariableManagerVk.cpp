@@ -172,6 +172,16 @@ const ShaderVariableManagerVk::ResourceAttribs& ShaderVariableManagerVk::GetReso
 void ShaderVariableManagerVk::BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
 {
     TBase::BindResources(pResourceMapping, Flags);
+
+    // Bindless descriptors recorded for all variables are written at once
+    for (Uint32 v = 0; v < m_NumVariables; ++v)
+    {
+        if ((m_pVariables[v].GetDesc().Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0)
+        {
+            m_ResourceCache.FlushDescriptorWrites(m_pSignature->GetDevice()->GetLogicalDevice());
+            break;
+        }
+    }
 }
 
 void ShaderVariableManagerVk::CheckResources(IResourceMapping*                    pResourceMapping,
@@ -373,10 +383,12 @@ void BindResourceHelper::operator()(const BindResourceInfo& BindInfo) const
     }
     else
     {
-        DEV_CHECK_ERR(m_DstRes.pObject == nullptr || m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC,
+        DEV_CHECK_ERR(m_DstRes.pObject == nullptr || IsResourceRebindable(m_ResDesc),
                       "Shader variable '", m_ResDesc.Name, "' is not dynamic, but is being reset to null. This is an error and may cause unpredicted behavior. ",
                       "Use another shader resource binding instance or label the variable as dynamic if you need to bind another resource.");
 
+        // Bindless arrays are partially bound, so the stale descriptor is left in the set
+        // and must not be accessed by the shader.
         m_ResourceCache.ResetResource(m_Attribs.DescrSet, m_DstResCacheOffset);
     }
 }
@@ -388,16 +400,16 @@ bool BindResourceHelper::UpdateCachedResource(RefCntAutoPtr<ObjectType>&& pObjec
 {
     if (pObject)
     {
-        if (m_ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC && m_DstRes.pObject != nullptr)
+        if (!IsResourceRebindable(m_ResDesc) && m_DstRes.pObject != nullptr)
         {
             DEV_CHECK_ERR(m_DstRes.pObject == pObject, "Binding another object to a non-dynamic variable is not allowed");
-            // Do not update resource if one is already bound unless it is dynamic. This may be
-            // dangerous as writing descriptors while they are used by the GPU is an undefined behavior
+            // Do not update resource if one is already bound unless it is dynamic or bindless. This may be
+            // dangerous as writing descriptors while they are used by the GPU is an undefined behavior.
+            // Bindless descriptors are update-after-bind and may be written while the set is in use.
             return false;
         }
 
-        m_ResourceCache.SetResource(&m_Signature.GetDevice()->GetLogicalDevice(),
-                                    m_Attribs.DescrSet,
+        m_ResourceCache.SetResource(m_Attribs.DescrSet,
                                     m_DstResCacheOffset,
                                     {
                                         m_Attribs.BindingIndex,
@@ -620,9 +632,23 @@ void ShaderVariableManagerVk::BindResource(Uint32 ResIndex, const BindResourceIn
         ResIndex,
         BindInfo.ArrayIndex};
 
+    ShaderResourceCacheBase::BindlessUpdateScope BindlessScope{
+        m_ResourceCache,
+        (GetResourceDesc(ResIndex).Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0,
+        GetResourceAttribs(ResIndex).DescrSet};
     BindHelper(BindInfo);
 }
 
+void ShaderVariableManagerVk::FlushBindlessWrites(Uint32 ResIndex)
+{
+    if ((GetResourceDesc(ResIndex).Flags & PIPELINE_RESOURCE_FLAG_BINDLESS) != 0)
+    {
+        // Bindless array elements may be set after the SRB has been committed, so
+        // the descriptors can't wait for the next commit to be written.
+        m_ResourceCache.FlushDescriptorWrites(m_pSignature->GetDevice()->GetLogicalDevice());
+    }
+}
+
 void ShaderVariableManagerVk::SetBufferDynamicOffset(Uint32 ResIndex,
                                                      Uint32 ArrayIndex,
                                                      Uint32 BufferDynamicOffset)
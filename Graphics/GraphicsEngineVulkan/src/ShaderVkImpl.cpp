@@ -143,6 +143,8 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
                     Attribs.AssignBindings             = true;
                     Attribs.pShaderSourceStreamFactory = ShaderCI.pShaderSourceStreamFactory;
                     Attribs.ppCompilerOutput           = ShaderCI.ppCompilerOutput;
+                    Attribs.OptimizationProfile        = ShaderCI.OptimizationProfile;
+                    Attribs.OptimizationPasses         = ShaderCI.OptimizationPasses;
 
                     if (VkVersion >= VK_API_VERSION_1_2)
                         Attribs.Version = GLSLangUtils::SpirvVersion::Vk120;
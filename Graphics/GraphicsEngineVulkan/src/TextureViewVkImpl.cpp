@@ -33,12 +33,13 @@
 namespace Diligent
 {
 
-TextureViewVkImpl::TextureViewVkImpl(IReferenceCounters*                 pRefCounters,
-                                     RenderDeviceVkImpl*                 pDevice,
-                                     const TextureViewDesc&              ViewDesc,
-                                     ITexture*                           pTexture,
-                                     VulkanUtilities::ImageViewWrapper&& ImgView,
-                                     bool                                bIsDefaultView) :
+TextureViewVkImpl::TextureViewVkImpl(IReferenceCounters*                              pRefCounters,
+                                     RenderDeviceVkImpl*                              pDevice,
+                                     const TextureViewDesc&                           ViewDesc,
+                                     ITexture*                                        pTexture,
+                                     VulkanUtilities::ImageViewWrapper&&              ImgView,
+                                     std::vector<VulkanUtilities::ImageViewWrapper>&& MipLevelViews,
+                                     bool                                             bIsDefaultView) :
     // clang-format off
     TTextureViewBase
     {
@@ -48,7 +49,8 @@ TextureViewVkImpl::TextureViewVkImpl(IReferenceCounters*                 pRefCou
         pTexture,
         bIsDefaultView
     },
-    m_ImageView{std::move(ImgView)}
+    m_ImageView{std::move(ImgView)},
+    m_MipLevelViews{std::move(MipLevelViews)}
 // clang-format on
 {
 }
@@ -62,6 +64,8 @@ TextureViewVkImpl::~TextureViewVkImpl()
         m_pDevice->GetFramebufferCache().OnDestroyImageView(m_ImageView);
     }
     m_pDevice->SafeReleaseDeviceObject(std::move(m_ImageView), m_pTexture->GetDesc().ImmediateContextMask);
+    for (auto& MipLevelView : m_MipLevelViews)
+        m_pDevice->SafeReleaseDeviceObject(std::move(MipLevelView), m_pTexture->GetDesc().ImmediateContextMask);
 }
 
 } // namespace Diligent
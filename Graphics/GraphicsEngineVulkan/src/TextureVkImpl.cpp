@@ -176,7 +176,14 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         if (m_Desc.MiscFlags & MISC_TEXTURE_FLAG_GENERATE_MIPS)
         {
             VERIFY_EXPR(!IsMemoryless);
+            // The compute shader is only used when the application requested storage image access, as
+            // VK_IMAGE_USAGE_STORAGE_BIT may disable framebuffer compression of the texture on some hardware.
+            m_GenerateMipsInCS =
+                (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0 &&
+                !FmtAttribs.IsTypeless &&
+                pRenderDeviceVk->GetMipsGenerator().IsComputeSupported(m_Desc);
 #ifdef DILIGENT_DEVELOPMENT
+            if (!m_GenerateMipsInCS)
             {
                 const auto& PhysicalDevice = pRenderDeviceVk->GetPhysicalDevice();
                 const auto  FmtProperties  = PhysicalDevice.GetPhysicalDeviceFormatProperties(ImageCI.format);
@@ -221,11 +228,12 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
 
         m_VulkanImage = LogicalDevice.CreateImage(ImageCI, m_Desc.Name);
 
-        VkMemoryRequirements MemReqs = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage);
+        bool                 PrefersDedicatedAllocation = false;
+        VkMemoryRequirements MemReqs                    = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage, PrefersDedicatedAllocation);
 
         const auto ImageMemoryFlags = IsMemoryless ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
         VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
-        m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+        m_MemoryAllocation = pRenderDeviceVk->AllocateImageMemory(m_VulkanImage, MemReqs, PrefersDedicatedAllocation, ImageMemoryFlags);
         auto AlignedOffset = AlignUp(m_MemoryAllocation.UnalignedOffset, MemReqs.alignment);
         VERIFY_EXPR(m_MemoryAllocation.Size >= MemReqs.size + (AlignedOffset - m_MemoryAllocation.UnalignedOffset));
         auto Memory = m_MemoryAllocation.Page->GetVkMemory();
@@ -546,7 +554,25 @@ void TextureVkImpl::CreateViewInternal(const TextureViewDesc& ViewDesc, ITexture
         ValidatedAndCorrectTextureViewDesc(m_Desc, UpdatedViewDesc);
 
         VulkanUtilities::ImageViewWrapper ImgView = CreateImageView(UpdatedViewDesc);
-        auto                              pViewVk = NEW_RC_OBJ(TexViewAllocator, "TextureViewVkImpl instance", TextureViewVkImpl, bIsDefaultView ? this : nullptr)(GetDevice(), UpdatedViewDesc, this, std::move(ImgView), bIsDefaultView);
+
+        std::vector<VulkanUtilities::ImageViewWrapper> MipLevelViews;
+        if (m_GenerateMipsInCS && (UpdatedViewDesc.Flags & TEXTURE_VIEW_FLAG_ALLOW_MIP_MAP_GENERATION) != 0 && UpdatedViewDesc.Format == m_Desc.Format)
+        {
+            // The mipmap generation shader accesses every mip level through a separate storage image view
+            MipLevelViews.reserve(UpdatedViewDesc.NumMipLevels);
+            for (Uint32 MipLevel = 0; MipLevel < UpdatedViewDesc.NumMipLevels; ++MipLevel)
+            {
+                TextureViewDesc MipViewDesc{UpdatedViewDesc.Name, TEXTURE_VIEW_UNORDERED_ACCESS, RESOURCE_DIM_TEX_2D_ARRAY};
+                MipViewDesc.Format          = UpdatedViewDesc.Format;
+                MipViewDesc.MostDetailedMip = UpdatedViewDesc.MostDetailedMip + MipLevel;
+                MipViewDesc.NumMipLevels    = 1;
+                MipViewDesc.FirstArraySlice = UpdatedViewDesc.FirstArraySlice;
+                MipViewDesc.NumArraySlices  = UpdatedViewDesc.NumArraySlices;
+                MipLevelViews.emplace_back(CreateImageView(MipViewDesc));
+            }
+        }
+
+        auto pViewVk = NEW_RC_OBJ(TexViewAllocator, "TextureViewVkImpl instance", TextureViewVkImpl, bIsDefaultView ? this : nullptr)(GetDevice(), UpdatedViewDesc, this, std::move(ImgView), std::move(MipLevelViews), bIsDefaultView);
         VERIFY(pViewVk->GetDesc().ViewType == ViewDesc.ViewType, "Incorrect view type");
 
         if (bIsDefaultView)
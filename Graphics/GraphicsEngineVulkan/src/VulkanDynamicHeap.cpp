@@ -297,6 +297,20 @@ void VulkanDynamicHeap::ReleaseMasterBlocks(RenderDeviceVkImpl& DeviceVkImpl, Ui
     m_CurrAllocatedSize = 0;
 }
 
+void VulkanDynamicHeap::ExtractMasterBlocks(std::vector<MasterBlock>& Blocks)
+{
+    for (auto& Block : m_MasterBlocks)
+        Blocks.emplace_back(std::move(Block));
+    m_MasterBlocks.clear();
+
+    m_CurrOffset    = InvalidOffset;
+    m_AvailableSize = 0;
+
+    m_CurrUsedSize      = 0;
+    m_CurrAlignedSize   = 0;
+    m_CurrAllocatedSize = 0;
+}
+
 VulkanDynamicHeap::~VulkanDynamicHeap()
 {
     DEV_CHECK_ERR(m_MasterBlocks.empty(), m_MasterBlocks.size(), " master block(s) have not been returned to dynamic memory manager");
@@ -2002,6 +2002,12 @@ DeviceFeatures VkFeaturesToDeviceFeatures(uint32_t
                   ExtFeatures.ShadingRate.attachmentFragmentShadingRate != VK_FALSE ||
                   ExtFeatures.FragmentDensityMap.fragmentDensityMap != VK_FALSE));
 
+    INIT_FEATURE(NativeMultiDraw,
+                 ExtFeatures.MultiDraw.multiDraw != VK_FALSE);
+
+    INIT_FEATURE(ExtendedDynamicState,
+                 ExtFeatures.ExtendedDynamicState.extendedDynamicState != VK_FALSE);
+
 #undef INIT_FEATURE
 
     // Not supported in Vulkan on top of Metal.
@@ -2012,7 +2018,7 @@ DeviceFeatures VkFeaturesToDeviceFeatures(uint32_t
 #endif
 
 #if defined(_MSC_VER) && defined(_WIN64)
-    static_assert(sizeof(DeviceFeatures) == 38, "Did you add a new feature to DeviceFeatures? Please handle its satus here (if necessary).");
+    static_assert(sizeof(DeviceFeatures) == 40, "Did you add a new feature to DeviceFeatures? Please handle its satus here (if necessary).");
 #endif
 
     return Features;
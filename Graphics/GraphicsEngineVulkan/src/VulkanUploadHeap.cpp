@@ -153,4 +153,16 @@ void VulkanUploadHeap::ReleaseAllocatedPages(Uint64 CmdQueueMask)
     m_CurrAllocatedSize = 0;
 }
 
+void VulkanUploadHeap::ExtractAllocatedPages(std::vector<UploadPageInfo>& Pages)
+{
+    for (auto& Page : m_Pages)
+        Pages.emplace_back(std::move(Page));
+
+    m_Pages.clear();
+
+    m_CurrPage          = CurrPageInfo{};
+    m_CurrFrameSize     = 0;
+    m_CurrAllocatedSize = 0;
+}
+
 } // namespace Diligent
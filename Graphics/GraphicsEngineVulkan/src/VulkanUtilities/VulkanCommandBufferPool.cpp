@@ -40,93 +40,244 @@ VulkanCommandBufferPool::VulkanCommandBufferPool(std::shared_ptr<const VulkanLog
                                                  HardwareQueueIndex                         queueFamilyIndex,
                                                  VkCommandPoolCreateFlags                   flags) :
     m_LogicalDevice{std::move(LogicalDevice)},
+    m_QueueFamilyIndex{queueFamilyIndex},
+    m_Flags{flags},
     m_SupportedStagesMask{m_LogicalDevice->GetSupportedStagesMask(queueFamilyIndex)}
 {
+}
+
+VulkanCommandBufferPool::~VulkanCommandBufferPool()
+{
+    for (auto& pPool : m_FramePools)
+    {
+        DEV_CHECK_ERR(pPool->NumOutstandingBuffers == 0, pPool->NumOutstandingBuffers,
+                      " command buffer(s) have not been returned to the pool. If there are outstanding references to these "
+                      "buffers in release queues, VulkanCommandBufferPool::RecycleCommandBuffer() will crash when attempting to "
+                      "return the buffer to the pool.");
+
+        for (const auto& CmdBuffers : pPool->CmdBuffers)
+        {
+            for (auto CmdBuff : CmdBuffers)
+                m_LogicalDevice->FreeCommandBuffer(pPool->CmdPool, CmdBuff);
+        }
+        pPool->CmdPool.Release();
+    }
+
+    DEV_CHECK_ERR(m_ReusablePool.NumOutstandingBuffers == 0, m_ReusablePool.NumOutstandingBuffers,
+                  " reusable command buffer(s) have not been returned to the pool.");
+    for (const auto& CmdBuffers : m_ReusablePool.FreeCmdBuffers)
+    {
+        for (auto CmdBuff : CmdBuffers)
+            m_LogicalDevice->FreeCommandBuffer(m_ReusablePool.CmdPool, CmdBuff);
+    }
+    m_ReusablePool.CmdPool.Release();
+}
+
+VulkanCommandBufferPool::FramePool* VulkanCommandBufferPool::AcquireFramePool()
+{
+    if (!m_FreePools.empty())
+    {
+        auto* pPool = m_FreePools.back();
+        m_FreePools.pop_back();
+        VERIFY_EXPR(pPool->IsUnused() && pPool->NumOutstandingBuffers == 0);
+        return pPool;
+    }
+
     VkCommandPoolCreateInfo CmdPoolCI{};
     CmdPoolCI.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
     CmdPoolCI.pNext            = nullptr;
-    CmdPoolCI.queueFamilyIndex = queueFamilyIndex;
-    CmdPoolCI.flags            = flags;
+    CmdPoolCI.queueFamilyIndex = m_QueueFamilyIndex;
+    CmdPoolCI.flags            = m_Flags;
+
+    std::unique_ptr<FramePool> pPool{new FramePool{}};
+    pPool->CmdPool = m_LogicalDevice->CreateCommandPool(CmdPoolCI);
+    DEV_CHECK_ERR(pPool->CmdPool != VK_NULL_HANDLE, "Failed to create vulkan command pool");
 
-    m_CmdPool = m_LogicalDevice->CreateCommandPool(CmdPoolCI);
-    DEV_CHECK_ERR(m_CmdPool != VK_NULL_HANDLE, "Failed to create vulkan command pool");
+    m_FramePools.emplace_back(std::move(pPool));
+    return m_FramePools.back().get();
 }
 
-VulkanCommandBufferPool::~VulkanCommandBufferPool()
+void VulkanCommandBufferPool::ResetFramePool(FramePool& Pool) const
 {
-    DEV_CHECK_ERR(m_BuffCounter == 0, m_BuffCounter,
-                  " command buffer(s) have not been returned to the pool. If there are outstanding references to these "
-                  "buffers in release queues, VulkanCommandBufferPool::RecycleCommandBuffer() will crash when attempting to "
-                  "return the buffer to the pool.");
-
-    for (auto CmdBuff : m_CmdBuffers)
-        m_LogicalDevice->FreeCommandBuffer(m_CmdPool, CmdBuff);
-    m_CmdPool.Release();
+    VERIFY(Pool.NumOutstandingBuffers == 0, "Command pool must not be reset while its command buffers are in use");
+
+    // None of the command buffers is pending execution or being recorded. Resetting the pool recycles
+    // the memory of all buffers at once and puts them into the initial state.
+    auto err = m_LogicalDevice->ResetCommandPool(Pool.CmdPool);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command pool");
+    (void)err;
+
+    Pool.NumUsedBuffers = {};
 }
 
-VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
+VkCommandBuffer VulkanCommandBufferPool::AllocateCommandBuffer(VkCommandPool vkCmdPool, VkCommandBufferLevel Level) const
 {
-    VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
+    // Command buffers must be allocated while the pool is externally synchronized
+    VkCommandBufferAllocateInfo BuffAllocInfo = {};
 
+    BuffAllocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    BuffAllocInfo.pNext              = nullptr;
+    BuffAllocInfo.commandPool        = vkCmdPool;
+    BuffAllocInfo.level              = Level;
+    BuffAllocInfo.commandBufferCount = 1;
+
+    auto CmdBuffer = m_LogicalDevice->AllocateVkCommandBuffer(BuffAllocInfo);
+    DEV_CHECK_ERR(CmdBuffer != VK_NULL_HANDLE, "Failed to allocate vulkan command buffer");
+    return CmdBuffer;
+}
+
+VkCommandBuffer VulkanCommandBufferPool::GetReusableCommandBuffer(VkCommandBufferLevel Level)
+{
+    auto& Pool = m_ReusablePool;
+    if (Pool.CmdPool == VK_NULL_HANDLE)
     {
-        std::lock_guard<std::mutex> Lock{m_Mutex};
+        VkCommandPoolCreateInfo CmdPoolCI{};
+        CmdPoolCI.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        CmdPoolCI.pNext            = nullptr;
+        CmdPoolCI.queueFamilyIndex = m_QueueFamilyIndex;
+        // Reusable command buffers are long-lived and are reset individually by vkBeginCommandBuffer
+        CmdPoolCI.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 
-        if (!m_CmdBuffers.empty())
-        {
-            CmdBuffer = m_CmdBuffers.front();
-            
-            auto err  = DILIGENT_VK_CALL(ResetCommandBuffer(
-                CmdBuffer,
-                0 // VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT -  specifies that most or all memory resources currently
-                  // owned by the command buffer should be returned to the parent command pool.
-            ));
-            DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command buffer");
-            (void)err;
-            m_CmdBuffers.pop_front();
-        }
+        Pool.CmdPool = m_LogicalDevice->CreateCommandPool(CmdPoolCI);
+        DEV_CHECK_ERR(Pool.CmdPool != VK_NULL_HANDLE, "Failed to create vulkan command pool");
+    }
+
+    VkCommandBuffer CmdBuffer   = VK_NULL_HANDLE;
+    auto&           FreeBuffers = Pool.FreeCmdBuffers[Level];
+    if (!FreeBuffers.empty())
+    {
+        // The buffer is not reset when it is returned as this may happen on another thread while the
+        // pool is in use. It is implicitly reset when it is begun.
+        CmdBuffer = FreeBuffers.back();
+        FreeBuffers.pop_back();
+    }
+    else
+    {
+        CmdBuffer = AllocateCommandBuffer(Pool.CmdPool, Level);
+        m_CmdBufferPools.emplace(CmdBuffer, nullptr);
     }
+    ++Pool.NumOutstandingBuffers;
+    return CmdBuffer;
+}
+
+VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char*                           DebugName,
+                                                          const VkCommandBufferInheritanceInfo* pInheritanceInfo,
+                                                          VkCommandBufferUsageFlags             UsageFlags)
+{
+    const auto Level = pInheritanceInfo != nullptr ? VK_COMMAND_BUFFER_LEVEL_SECONDARY : VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+    VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
 
-    // If no cmd buffers were ready to be reused, create a new one
-    if (CmdBuffer == VK_NULL_HANDLE)
     {
-        VkCommandBufferAllocateInfo BuffAllocInfo = {};
+        std::lock_guard<std::mutex> Lock{m_Mutex};
 
-        BuffAllocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        BuffAllocInfo.pNext              = nullptr;
-        BuffAllocInfo.commandPool        = m_CmdPool;
-        BuffAllocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        BuffAllocInfo.commandBufferCount = 1;
+        if ((UsageFlags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT) != 0)
+        {
+            CmdBuffer = GetReusableCommandBuffer(Level);
+        }
+        else
+        {
+            if (m_pCurrPool == nullptr)
+            {
+                m_pCurrPool = AcquireFramePool();
+            }
+            else if (m_pCurrPool->NumOutstandingBuffers == 0 && !m_pCurrPool->IsUnused())
+            {
+                // All command buffers of the current pool have been returned. This happens when the context
+                // does not finish frames (e.g. a deferred context), so reset the pool without retiring it.
+                ResetFramePool(*m_pCurrPool);
+            }
 
-        CmdBuffer = m_LogicalDevice->AllocateVkCommandBuffer(BuffAllocInfo);
-        DEV_CHECK_ERR(CmdBuffer != VK_NULL_HANDLE, "Failed to allocate vulkan command buffer");
+            auto& Pool           = *m_pCurrPool;
+            auto& CmdBuffers     = Pool.CmdBuffers[Level];
+            auto& NumUsedBuffers = Pool.NumUsedBuffers[Level];
+            if (NumUsedBuffers < CmdBuffers.size())
+            {
+                // The buffer has been reset with the pool and is in the initial state
+                CmdBuffer = CmdBuffers[NumUsedBuffers];
+            }
+            else
+            {
+                CmdBuffer = AllocateCommandBuffer(Pool.CmdPool, Level);
+                CmdBuffers.push_back(CmdBuffer);
+                m_CmdBufferPools.emplace(CmdBuffer, &Pool);
+            }
+            ++NumUsedBuffers;
+            ++Pool.NumOutstandingBuffers;
+        }
     }
 
     VkCommandBufferBeginInfo CmdBuffBeginInfo = {};
 
     CmdBuffBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     CmdBuffBeginInfo.pNext = nullptr;
-    CmdBuffBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; // Each recording of the command buffer will only be
-                                                                          // submitted once, and the command buffer will be reset
-                                                                          // and recorded again between each submission.
-    CmdBuffBeginInfo.pInheritanceInfo = nullptr;                          // Ignored for a primary command buffer
+    // VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT specifies that each recording of the command buffer will only be
+    // submitted once, and the command buffer will be reset and recorded again between each submission.
+    // VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT allows resubmitting the buffer while it is pending execution.
+    CmdBuffBeginInfo.flags = UsageFlags;
+    if (pInheritanceInfo != nullptr)
+    {
+        // The secondary command buffer is entirely inside the render pass specified by the inheritance info
+        CmdBuffBeginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    }
+    CmdBuffBeginInfo.pInheritanceInfo = pInheritanceInfo; // Ignored for a primary command buffer
 
     auto err = DILIGENT_VK_CALL(BeginCommandBuffer(CmdBuffer, &CmdBuffBeginInfo));
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to begin command buffer");
     (void)err;
-#ifdef DILIGENT_DEVELOPMENT
-    ++m_BuffCounter;
-#endif
     return CmdBuffer;
 }
 
-void VulkanCommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer)
+void VulkanCommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer, VkCommandBufferLevel Level)
+{
+    VERIFY_EXPR(Level == VK_COMMAND_BUFFER_LEVEL_PRIMARY || Level == VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    auto it = m_CmdBufferPools.find(CmdBuffer);
+    VERIFY(it != m_CmdBufferPools.end(), "Returning a command buffer that was not allocated from this pool");
+    auto* pPool = it->second;
+    if (pPool == nullptr)
+    {
+        // Reusable command buffer
+        VERIFY(m_ReusablePool.NumOutstandingBuffers > 0, "Returning a command buffer that has already been returned to the pool");
+        --m_ReusablePool.NumOutstandingBuffers;
+        m_ReusablePool.FreeCmdBuffers[Level].push_back(CmdBuffer);
+        CmdBuffer = VK_NULL_HANDLE;
+        return;
+    }
+
+    auto& Pool = *pPool;
+    CmdBuffer  = VK_NULL_HANDLE;
+
+    VERIFY(Pool.NumOutstandingBuffers > 0, "Returning a command buffer that has already been returned to the pool");
+    --Pool.NumOutstandingBuffers;
+    if (Pool.NumOutstandingBuffers == 0 && &Pool != m_pCurrPool)
+    {
+        // The last command buffer of a retired pool has been returned, which means that the
+        // GPU is done with the frame the pool was used for.
+        ResetFramePool(Pool);
+        m_FreePools.push_back(&Pool);
+    }
+}
+
+void VulkanCommandBufferPool::FinishFrame()
 {
     std::lock_guard<std::mutex> Lock{m_Mutex};
-    m_CmdBuffers.emplace_back(CmdBuffer);
-    CmdBuffer = VK_NULL_HANDLE;
-#ifdef DILIGENT_DEVELOPMENT
-    --m_BuffCounter;
-#endif
+
+    if (m_pCurrPool == nullptr || m_pCurrPool->IsUnused())
+        return;
+
+    if (m_pCurrPool->NumOutstandingBuffers == 0)
+    {
+        // All command buffers have already been returned, so the pool can be reused right away
+        ResetFramePool(*m_pCurrPool);
+    }
+    else
+    {
+        // The pool is reset when its last command buffer is returned by the release queue
+        m_pCurrPool = nullptr;
+    }
 }
 
 } // namespace VulkanUtilities
@@ -547,6 +547,32 @@ VkMemoryRequirements VulkanLogicalDevice::GetImageMemoryRequirements(VkImage vkI
     return MemReqs;
 }
 
+VkMemoryRequirements VulkanLogicalDevice::GetImageMemoryRequirements(VkImage vkImage, bool& PrefersDedicatedAllocation) const
+{
+    PrefersDedicatedAllocation = false;
+#if DILIGENT_USE_VOLK
+    if (m_EnabledExtFeatures.DedicatedAllocation)
+    {
+        VkImageMemoryRequirementsInfo2 MemReqsInfo{};
+        MemReqsInfo.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2;
+        MemReqsInfo.image = vkImage;
+
+        VkMemoryDedicatedRequirements DedicatedReqs{};
+        DedicatedReqs.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+        VkMemoryRequirements2 MemReqs2{};
+        MemReqs2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+        MemReqs2.pNext = &DedicatedReqs;
+
+        DILIGENT_VK_CALL(GetImageMemoryRequirements2KHR(m_VkDevice, &MemReqsInfo, &MemReqs2));
+
+        PrefersDedicatedAllocation = DedicatedReqs.prefersDedicatedAllocation != VK_FALSE || DedicatedReqs.requiresDedicatedAllocation != VK_FALSE;
+        return MemReqs2.memoryRequirements;
+    }
+#endif
+    return GetImageMemoryRequirements(vkImage);
+}
+
 VkResult VulkanLogicalDevice::BindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
 {
     return DILIGENT_VK_CALL(BindBufferMemory(m_VkDevice, buffer, memory, memoryOffset));
@@ -32,6 +32,20 @@
 namespace VulkanUtilities
 {
 
+namespace
+{
+
+template <typename T>
+void UpdatePeakValue(std::atomic<T>& Peak, T Value)
+{
+    auto CurrPeak = Peak.load();
+    while (CurrPeak < Value && !Peak.compare_exchange_weak(CurrPeak, Value))
+    {
+    }
+}
+
+} // namespace
+
 VulkanMemoryAllocation::~VulkanMemoryAllocation()
 {
     if (Page != nullptr)
@@ -40,37 +54,60 @@ VulkanMemoryAllocation::~VulkanMemoryAllocation()
     }
 }
 
-VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                                   VkDeviceSize          PageSize,
-                                   uint32_t              MemoryTypeIndex,
-                                   bool                  IsHostVisible,
-                                   VkMemoryAllocateFlags AllocateFlags) noexcept :
+VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&                    ParentMemoryMgr,
+                                   VkDeviceSize                            PageSize,
+                                   uint32_t                                MemoryTypeIndex,
+                                   bool                                    IsHostVisible,
+                                   VkMemoryAllocateFlags                   AllocateFlags,
+                                   bool                                    IsStandalone,
+                                   const VkMemoryDedicatedAllocateInfoKHR* pDedicatedInfo) :
     // clang-format off
-    m_ParentMemoryMgr{ParentMemoryMgr},
-    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
+    m_ParentMemoryMgr {ParentMemoryMgr},
+    m_AllocationMgr   {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator},
+    m_MaxFreeBlockSize{PageSize       },
+    m_MemoryTypeIndex {MemoryTypeIndex},
+    m_AllocateFlags   {AllocateFlags  },
+    m_IsStandalone    {IsStandalone   },
+    m_IsDedicated     {pDedicatedInfo != nullptr}
 // clang-format on
 {
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "PageSize (", PageSize, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
+    VERIFY(pDedicatedInfo == nullptr || IsStandalone, "Dedicated allocations must be standalone");
 
-    VkMemoryAllocateInfo      MemAlloc    = {};
-    VkMemoryAllocateFlagsInfo MemFlagInfo = {};
+    VkMemoryAllocateInfo             MemAlloc      = {};
+    VkMemoryAllocateFlagsInfo        MemFlagInfo   = {};
+    VkMemoryDedicatedAllocateInfoKHR DedicatedInfo = {};
 
     MemAlloc.pNext           = nullptr;
     MemAlloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize  = PageSize;
     MemAlloc.memoryTypeIndex = MemoryTypeIndex;
 
+    const void** ppNext = &MemAlloc.pNext;
     if (AllocateFlags)
     {
-        MemAlloc.pNext    = &MemFlagInfo;
         MemFlagInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
         MemFlagInfo.pNext = nullptr;
         MemFlagInfo.flags = AllocateFlags;
+
+        *ppNext = &MemFlagInfo;
+        ppNext  = &MemFlagInfo.pNext;
+    }
+
+    if (pDedicatedInfo != nullptr)
+    {
+        DedicatedInfo       = *pDedicatedInfo;
+        DedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+        DedicatedInfo.pNext = nullptr;
+
+        *ppNext = &DedicatedInfo;
+        ppNext  = &DedicatedInfo.pNext;
     }
 
-    auto MemoryName = Diligent::FormatString("Device memory page. Size: ", Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
+    auto MemoryName = Diligent::FormatString(pDedicatedInfo != nullptr ? "Dedicated device memory" : "Device memory page",
+                                             ". Size: ", Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
     m_VkMemory      = ParentMemoryMgr.m_LogicalDevice.AllocateDeviceMemory(MemAlloc, MemoryName.c_str());
 
     if (IsHostVisible)
@@ -105,6 +142,9 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
     auto Allocation = m_AllocationMgr.Allocate(static_cast<AllocationsMgrOffsetType>(size), static_cast<AllocationsMgrOffsetType>(alignment));
     if (Allocation.IsValid())
     {
+        m_UsedSize.store(m_AllocationMgr.GetUsedSize());
+        m_MaxFreeBlockSize.store(m_AllocationMgr.GetMaxFreeBlockSize());
+        m_IsEvacuated.store(false);
         // Offset may not necessarily be aligned, but the allocation is guaranteed to be large enough
         // to accommodate requested alignment
         VERIFY_EXPR(Diligent::AlignUp(VkDeviceSize{Allocation.UnalignedOffset}, alignment) - Allocation.UnalignedOffset + size <= Allocation.Size);
@@ -118,15 +158,27 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
 
 void VulkanMemoryPage::Free(VulkanMemoryAllocation&& Allocation)
 {
-    m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_CPUMemory != nullptr);
-    std::lock_guard<std::mutex> Lock{m_Mutex};
-    VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
-    VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
-    m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+    m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_MemoryTypeIndex, m_CPUMemory != nullptr);
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
+        VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
+        m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+        m_UsedSize.store(m_AllocationMgr.GetUsedSize());
+        m_MaxFreeBlockSize.store(m_AllocationMgr.GetMaxFreeBlockSize());
+    }
     Allocation = VulkanMemoryAllocation{};
+
+    if (m_IsStandalone)
+    {
+        // Standalone page only contains one allocation and is destroyed as soon as it is released.
+        // Do not access any members after this call.
+        m_ParentMemoryMgr.OnStandalonePageReleased(*this);
+    }
 }
 
-VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags)
+
+uint32_t VulkanMemoryManager::FindMemoryTypeIndex(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps) const
 {
     // memoryTypeBits is a bitmask and contains one bit set for every supported memory type for the resource.
     // Bit i is set if and only if the memory type i in the VkPhysicalDeviceMemoryProperties structure for the
@@ -153,14 +205,70 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements&
     {
         LOG_ERROR_AND_THROW("Failed to find suitable device memory type for a buffer");
     }
+    return MemoryTypeIndex;
+}
 
-    bool HostVisible = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags)
+{
+    const auto MemoryTypeIndex = FindMemoryTypeIndex(MemReqs, MemoryProps);
+    const bool HostVisible     = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
     return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags);
 }
 
+VulkanMemoryAllocation VulkanMemoryManager::AllocateImageMemory(VkImage vkImage, const VkMemoryRequirements& MemReqs, bool PrefersDedicatedAllocation, VkMemoryPropertyFlags MemoryProps)
+{
+    const auto MemoryTypeIndex = FindMemoryTypeIndex(MemReqs, MemoryProps);
+    const bool HostVisible     = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+
+    // Lazily allocated memory is not backed by physical pages in most cases, so there is no
+    // reason to give it its own memory object unless it is too large to be suballocated.
+    const bool IsLazilyAllocated = (MemoryProps & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0;
+    if (!IsLazilyAllocated && (PrefersDedicatedAllocation || GetSizeClass(MemReqs.size, HostVisible) == SIZE_CLASS_LARGE))
+    {
+        VkMemoryDedicatedAllocateInfoKHR DedicatedInfo = {};
+
+        DedicatedInfo.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+        DedicatedInfo.pNext  = nullptr;
+        DedicatedInfo.image  = vkImage;
+        DedicatedInfo.buffer = VK_NULL_HANDLE;
+
+        const bool UseDedicatedInfo = m_LogicalDevice.GetEnabledExtFeatures().DedicatedAllocation;
+        return AllocateStandalone(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, 0, UseDedicatedInfo ? &DedicatedInfo : nullptr);
+    }
+
+    return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, 0);
+}
+
+VulkanMemoryManager::SIZE_CLASS VulkanMemoryManager::GetSizeClass(VkDeviceSize Size, bool HostVisible) const
+{
+    const auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+    if (Size <= PageSize / SmallAllocationRatio)
+        return SIZE_CLASS_SMALL;
+    else if (Size <= PageSize / 2)
+        return SIZE_CLASS_MEDIUM;
+    else
+        return SIZE_CLASS_LARGE;
+}
+
+VulkanMemoryManager::PageBucket& VulkanMemoryManager::GetBucket(const MemoryPageIndex& PageIdx)
+{
+    std::lock_guard<std::mutex> Lock{m_BucketsMtx};
+
+    auto it = m_Buckets.find(PageIdx);
+    if (it == m_Buckets.end())
+        it = m_Buckets.emplace(PageIdx, std::unique_ptr<PageBucket>{new PageBucket}).first;
+    return *it->second;
+}
+
 VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags)
 {
-    VulkanMemoryAllocation Allocation;
+    const auto SizeClass = GetSizeClass(Size, HostVisible);
+    if (SizeClass == SIZE_CLASS_LARGE)
+    {
+        // Large allocations are not suballocated: they would either require a page of the same size
+        // or leave a large unusable tail in a regular page.
+        return AllocateStandalone(Size, Alignment, MemoryTypeIndex, HostVisible, AllocateFlags, nullptr);
+    }
 
     // On integrated GPUs, there is no difference between host-visible and GPU-only
     // memory, so MemoryTypeIndex is the same. As GPU-only pages do not have CPU address,
@@ -169,96 +277,360 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    // Small allocations are kept in separate smaller pages so that they do not fragment
+    // pages used by medium-sized resources.
+    auto& Bucket = GetBucket(MemoryPageIndex{MemoryTypeIndex, HostVisible, AllocateFlags, SizeClass});
+
+    VulkanMemoryAllocation Allocation;
 
-    auto range = m_Pages.equal_range(PageIdx);
-    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    bool ExceedsBudget = false;
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
-        if (Allocation.Page != nullptr)
-            break;
+        std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+
+        const auto NumPages = Bucket.Pages.size();
+        for (size_t i = 0; i < NumPages && Allocation.Page == nullptr; ++i)
+        {
+            const auto PageIdx = (Bucket.LastUsedPage + i) % NumPages;
+
+            auto& Page = *Bucket.Pages[PageIdx];
+            // Skip the page without locking it if it definitely does not have enough space
+            if (Page.GetMaxFreeBlockSize() < Size)
+                continue;
+
+            Allocation = Page.Allocate(Size, Alignment);
+            if (Allocation.Page != nullptr)
+                Bucket.LastUsedPage = PageIdx;
+        }
+
+        if (Allocation.Page == nullptr)
+        {
+            auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+            if (SizeClass == SIZE_CLASS_SMALL)
+                PageSize /= SmallPageRatio;
+            while (PageSize < Size)
+                PageSize *= 2;
+
+            auto pNewPage = CreatePage(PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, false, nullptr, ExceedsBudget);
+            Allocation    = pNewPage->Allocate(Size, Alignment);
+            DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+
+            Bucket.LastUsedPage = Bucket.Pages.size();
+            Bucket.Pages.emplace_back(std::move(pNewPage));
+        }
     }
 
-    size_t stat_ind = HostVisible ? 1 : 0;
-    if (Allocation.Page == nullptr)
+    if (Allocation.Page != nullptr)
     {
-        auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
-        while (PageSize < Size)
-            PageSize *= 2;
+        VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
+        OnNewAllocation(Allocation, HostVisible);
+    }
 
-        m_CurrAllocatedSize[stat_ind] += PageSize;
-        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+    if (ExceedsBudget)
+        NotifyBudgetExceeded(GetHeapIndex(MemoryTypeIndex));
 
-        auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
-        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
-                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
-                         "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
-        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+    return Allocation;
+}
+
+bool VulkanMemoryManager::IsSparsePage(const VulkanMemoryPage& Page) const
+{
+    return !Page.IsStandalone() && Page.GetUsedSize() * 100 < Page.GetPageSize() * SparsePageMaxUsedPercent;
+}
+
+VulkanMemoryAllocation VulkanMemoryManager::AllocateForRelocation(VulkanMemoryPage& SrcPage, VkDeviceSize Size, VkDeviceSize Alignment)
+{
+    VERIFY(!SrcPage.IsStandalone(), "Allocations from standalone pages are never relocated");
+
+    const bool HostVisible = SrcPage.GetCPUMemory() != nullptr;
+    const auto SizeClass   = GetSizeClass(Size, HostVisible);
+    if (SizeClass == SIZE_CLASS_LARGE)
+        return VulkanMemoryAllocation{};
+
+    auto& Bucket = GetBucket(MemoryPageIndex{SrcPage.GetMemoryTypeIndex(), HostVisible, SrcPage.GetAllocateFlags(), SizeClass});
+
+    VulkanMemoryAllocation Allocation;
+    {
+        std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+
+        const auto SrcUsedSize = SrcPage.GetUsedSize();
+        for (auto& pPage : Bucket.Pages)
+        {
+            // Only move allocations to denser pages, so that sparse pages are eventually released
+            if (pPage.get() == &SrcPage || pPage->GetUsedSize() <= SrcUsedSize || pPage->GetMaxFreeBlockSize() < Size)
+                continue;
+
+            Allocation = pPage->Allocate(Size, Alignment);
+            if (Allocation.Page != nullptr)
+                break;
+        }
     }
 
     if (Allocation.Page != nullptr)
     {
-        VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
+        OnNewAllocation(Allocation, HostVisible);
+
+        SrcPage.m_IsEvacuated.store(true);
+        m_HasEvacuatedPages.store(true);
+    }
+
+    return Allocation;
+}
+
+VulkanMemoryAllocation VulkanMemoryManager::AllocateStandalone(VkDeviceSize                            Size,
+                                                               VkDeviceSize                            Alignment,
+                                                               uint32_t                                MemoryTypeIndex,
+                                                               bool                                    HostVisible,
+                                                               VkMemoryAllocateFlags                   AllocateFlags,
+                                                               const VkMemoryDedicatedAllocateInfoKHR* pDedicatedInfo)
+{
+    // Dedicated allocation size must be exactly equal to the size of the resource.
+    // The allocation always starts at offset 0, so alignment is satisfied.
+    const auto PageSize = pDedicatedInfo != nullptr ? Size : Diligent::AlignUp(Size, Alignment);
+
+    bool ExceedsBudget = false;
+
+    auto pPage      = CreatePage(PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, true, pDedicatedInfo, ExceedsBudget);
+    auto Allocation = pPage->Allocate(PageSize, 1);
+    DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate memory from a standalone page");
+    VERIFY_EXPR(Allocation.UnalignedOffset == 0);
+
+    {
+        std::lock_guard<std::mutex> Lock{m_StandalonePagesMtx};
+        m_StandalonePages.emplace(pPage.get(), std::move(pPage));
     }
 
-    m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
-    m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
+    OnNewAllocation(Allocation, HostVisible);
+
+    if (ExceedsBudget)
+        NotifyBudgetExceeded(GetHeapIndex(MemoryTypeIndex));
 
     return Allocation;
 }
 
+std::unique_ptr<VulkanMemoryPage> VulkanMemoryManager::CreatePage(VkDeviceSize                            PageSize,
+                                                                  uint32_t                                MemoryTypeIndex,
+                                                                  bool                                    HostVisible,
+                                                                  VkMemoryAllocateFlags                   AllocateFlags,
+                                                                  bool                                    IsStandalone,
+                                                                  const VkMemoryDedicatedAllocateInfoKHR* pDedicatedInfo,
+                                                                  bool&                                   ExceedsBudget)
+{
+    std::unique_ptr<VulkanMemoryPage> pPage{new VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, IsStandalone, pDedicatedInfo}};
+
+    const auto stat_ind  = HostVisible ? 1 : 0;
+    const auto HeapIndex = GetHeapIndex(MemoryTypeIndex);
+
+    const auto CurrAllocatedSize = m_CurrAllocatedSize[stat_ind].fetch_add(PageSize) + PageSize;
+    UpdatePeakValue(m_PeakAllocatedSize[stat_ind], CurrAllocatedSize);
+    m_HeapAllocatedSize[HeapIndex].fetch_add(PageSize);
+    m_HeapMemoryObjectCount[HeapIndex].fetch_add(1);
+    if (pPage->IsDedicated())
+        m_HeapDedicatedCount[HeapIndex].fetch_add(1);
+
+    if (!IsStandalone)
+    {
+        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
+                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
+                         "). Current allocated size: ", Diligent::FormatMemorySize(CurrAllocatedSize, 2));
+    }
+
+    OnNewPageCreated(*pPage);
+
+    const auto HeapStats = GetHeapStatistics(HeapIndex);
+    ExceedsBudget        = HeapStats.Usage > HeapStats.Budget;
+
+    return pPage;
+}
+
+void VulkanMemoryManager::DestroyPage(std::unique_ptr<VulkanMemoryPage> pPage)
+{
+    const auto stat_ind  = pPage->GetCPUMemory() != nullptr ? 1 : 0;
+    const auto HeapIndex = GetHeapIndex(pPage->GetMemoryTypeIndex());
+    const auto PageSize  = pPage->GetPageSize();
+
+    m_CurrAllocatedSize[stat_ind].fetch_sub(PageSize);
+    m_HeapAllocatedSize[HeapIndex].fetch_sub(PageSize);
+    m_HeapMemoryObjectCount[HeapIndex].fetch_sub(1);
+    if (pPage->IsDedicated())
+        m_HeapDedicatedCount[HeapIndex].fetch_sub(1);
+
+    OnPageDestroy(*pPage);
+    pPage.reset();
+}
+
+void VulkanMemoryManager::OnStandalonePageReleased(VulkanMemoryPage& Page)
+{
+    std::unique_ptr<VulkanMemoryPage> pPage;
+    {
+        std::lock_guard<std::mutex> Lock{m_StandalonePagesMtx};
+
+        auto it = m_StandalonePages.find(&Page);
+        if (it == m_StandalonePages.end())
+        {
+            UNEXPECTED("Standalone page is not found in the map. This is unexpected and indicates that the page has already been released.");
+            return;
+        }
+        pPage = std::move(it->second);
+        m_StandalonePages.erase(it);
+    }
+    DestroyPage(std::move(pPage));
+}
+
 void VulkanMemoryManager::ShrinkMemory()
 {
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
-    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
+    // Pages evacuated by the defragmentation pass are released even if the allocated size does not exceed the reserve
+    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize && !m_HasEvacuatedPages.load())
         return;
 
-    auto it = m_Pages.begin();
-    while (it != m_Pages.end())
+    m_HasEvacuatedPages.store(false);
+
+    // Standalone pages are released immediately, so only regular pages need to be checked
+    std::lock_guard<std::mutex> BucketsLock{m_BucketsMtx};
+    for (auto& it : m_Buckets)
     {
-        auto curr_it = it;
-        ++it;
-        auto& Page          = curr_it->second;
-        bool  IsHostVisible = Page.GetCPUMemory() != nullptr;
-        auto  ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
-        if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
+        const bool IsHostVisible = it.first.IsHostVisible;
+        const auto stat_ind      = IsHostVisible ? 1 : 0;
+        const auto ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
+
+        auto&                       Bucket = *it.second;
+        std::lock_guard<std::mutex> Lock{Bucket.Mtx};
+        for (size_t i = 0; i < Bucket.Pages.size();)
         {
-            auto PageSize = Page.GetPageSize();
-            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
-            LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
-                             " page (", Diligent::FormatMemorySize(PageSize, 2),
-                             "). Current allocated size: ",
-                             Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
-            OnPageDestroy(Page);
-            m_Pages.erase(curr_it);
+            auto& pPage = Bucket.Pages[i];
+
+            bool IsEmpty = false;
+            {
+                // Pages are only allocated from under the bucket lock, but may be released at any time
+                std::lock_guard<std::mutex> PageLock{pPage->m_Mutex};
+                IsEmpty = pPage->IsEmpty();
+            }
+
+            const bool IsEvacuated = pPage->m_IsEvacuated.load();
+            if (IsEmpty && (IsEvacuated || m_CurrAllocatedSize[stat_ind] > ReserveSize))
+            {
+                const auto PageSize = pPage->GetPageSize();
+                DestroyPage(std::move(pPage));
+                m_ReleasedMemorySize.fetch_add(PageSize);
+                LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
+                                 " page (", Diligent::FormatMemorySize(PageSize, 2),
+                                 "). Current allocated size: ",
+                                 Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind].load(), 2));
+
+                // Page order does not matter, so move the last page into the released slot
+                Bucket.Pages[i] = std::move(Bucket.Pages.back());
+                Bucket.Pages.pop_back();
+            }
+            else
+            {
+                // Evacuated page still contains allocations that wait in the release queue
+                if (IsEvacuated)
+                    m_HasEvacuatedPages.store(true);
+                ++i;
+            }
         }
+
+        if (Bucket.LastUsedPage >= Bucket.Pages.size())
+            Bucket.LastUsedPage = 0;
     }
 }
 
-void VulkanMemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisble)
+void VulkanMemoryManager::OnNewAllocation(const VulkanMemoryAllocation& Allocation, bool HostVisible)
+{
+    const auto stat_ind = HostVisible ? 1 : 0;
+    const auto Size     = static_cast<int64_t>(Allocation.Size);
+
+    const auto CurrUsedSize = m_CurrUsedSize[stat_ind].fetch_add(Size) + Size;
+    UpdatePeakValue(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(CurrUsedSize));
+    m_HeapUsedSize[GetHeapIndex(Allocation.Page->GetMemoryTypeIndex())].fetch_add(Size);
+}
+
+void VulkanMemoryManager::OnFreeAllocation(VkDeviceSize Size, uint32_t MemoryTypeIndex, bool IsHostVisble)
 {
     m_CurrUsedSize[IsHostVisble ? 1 : 0].fetch_add(-static_cast<int64_t>(Size));
+    m_HeapUsedSize[GetHeapIndex(MemoryTypeIndex)].fetch_add(-static_cast<int64_t>(Size));
+}
+
+VulkanMemoryManager::HeapStatistics VulkanMemoryManager::GetHeapStatistics(uint32_t HeapIndex) const
+{
+    const auto& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+    VERIFY(HeapIndex < MemoryProps.memoryHeapCount, "Heap index (", HeapIndex, ") is out of range");
+
+    HeapStatistics Stats;
+    Stats.AllocatedSize              = m_HeapAllocatedSize[HeapIndex].load();
+    Stats.UsedSize                   = static_cast<VkDeviceSize>(std::max(m_HeapUsedSize[HeapIndex].load(), int64_t{0}));
+    Stats.MemoryObjectCount          = m_HeapMemoryObjectCount[HeapIndex].load();
+    Stats.DedicatedMemoryObjectCount = m_HeapDedicatedCount[HeapIndex].load();
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT MemoryBudget = {};
+    if (m_PhysicalDevice.GetMemoryBudget(MemoryBudget))
+    {
+        Stats.Budget = MemoryBudget.heapBudget[HeapIndex];
+        Stats.Usage  = MemoryBudget.heapUsage[HeapIndex];
+    }
+    else
+    {
+        // Without VK_EXT_memory_budget, use a conservative estimate similar to the one
+        // that implementations typically report.
+        Stats.Budget = MemoryProps.memoryHeaps[HeapIndex].size / 10 * 8;
+        Stats.Usage  = Stats.AllocatedSize;
+    }
+
+    return Stats;
+}
+
+void VulkanMemoryManager::SetBudgetCallback(BudgetCallbackType Callback)
+{
+    std::lock_guard<std::mutex> Lock{m_BudgetCallbackMtx};
+    m_BudgetCallback = std::move(Callback);
+}
+
+void VulkanMemoryManager::NotifyBudgetExceeded(uint32_t HeapIndex)
+{
+    const auto Stats = GetHeapStatistics(HeapIndex);
+
+    BudgetCallbackType Callback;
+    {
+        std::lock_guard<std::mutex> Lock{m_BudgetCallbackMtx};
+        Callback = m_BudgetCallback;
+    }
+
+    if (Callback)
+    {
+        Callback(HeapIndex, Stats);
+    }
+    else
+    {
+        LOG_WARNING_MESSAGE("VulkanMemoryManager '", m_MgrName, "': memory usage of heap ", HeapIndex, " (",
+                            Diligent::FormatMemorySize(Stats.Usage, 2, Stats.Budget), ") exceeds the budget (",
+                            Diligent::FormatMemorySize(Stats.Budget, 2, Stats.Budget), ")");
+    }
 }
 
 VulkanMemoryManager::~VulkanMemoryManager()
 {
-    auto PeakDeviceLocalPages  = m_PeakAllocatedSize[0] / m_DeviceLocalPageSize;
-    auto PeakHostVisisblePages = m_PeakAllocatedSize[1] / m_HostVisiblePageSize;
+    const VkDeviceSize PeakAllocatedSize[] = {m_PeakAllocatedSize[0].load(), m_PeakAllocatedSize[1].load()};
+    const VkDeviceSize PeakUsedSize[]      = {m_PeakUsedSize[0].load(), m_PeakUsedSize[1].load()};
+
+    auto PeakDeviceLocalPages  = PeakAllocatedSize[0] / m_DeviceLocalPageSize;
+    auto PeakHostVisisblePages = PeakAllocatedSize[1] / m_HostVisiblePageSize;
     LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "' stats:\n"
                                                          "                       Peak used/allocated device-local memory size: ",
-                     Diligent::FormatMemorySize(m_PeakUsedSize[0], 2, m_PeakAllocatedSize[0]), " / ",
-                     Diligent::FormatMemorySize(m_PeakAllocatedSize[0], 2, m_PeakAllocatedSize[0]),
+                     Diligent::FormatMemorySize(PeakUsedSize[0], 2, PeakAllocatedSize[0]), " / ",
+                     Diligent::FormatMemorySize(PeakAllocatedSize[0], 2, PeakAllocatedSize[0]),
                      " (", PeakDeviceLocalPages, (PeakDeviceLocalPages == 1 ? " page)" : " pages)"),
                      "\n                       Peak used/allocated host-visible memory size: ",
-                     Diligent::FormatMemorySize(m_PeakUsedSize[1], 2, m_PeakAllocatedSize[1]), " / ",
-                     Diligent::FormatMemorySize(m_PeakAllocatedSize[1], 2, m_PeakAllocatedSize[1]),
+                     Diligent::FormatMemorySize(PeakUsedSize[1], 2, PeakAllocatedSize[1]), " / ",
+                     Diligent::FormatMemorySize(PeakAllocatedSize[1], 2, PeakAllocatedSize[1]),
                      " (", PeakHostVisisblePages, (PeakHostVisisblePages == 1 ? " page)" : " pages)"));
 
-    for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
-        VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
+    for (auto& it : m_Buckets)
+    {
+        for (auto& pPage : it.second->Pages)
+        {
+            VERIFY(pPage->IsEmpty(), "The page contains outstanding allocations");
+            DestroyPage(std::move(pPage));
+        }
+    }
+    VERIFY(m_StandalonePages.empty(), "Not all standalone allocations have been released");
     VERIFY(m_CurrUsedSize[0] == 0 && m_CurrUsedSize[1] == 0, "Not all allocations have been released");
 }
 
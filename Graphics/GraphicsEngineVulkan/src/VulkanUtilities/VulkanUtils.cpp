@@ -1161,6 +1161,10 @@ void VulkanInterface::loadDeviceLevel(DiligentGetProc getProc, VkDevice device)
     ACQUIRE_PROC_SUFFIX(CmdDrawIndexedIndirectCount, KHR, VK_NULL_HANDLE, device);
     ACQUIRE_PROC_SUFFIX(CmdDrawIndirectCount, KHR, VK_NULL_HANDLE, device);
 #endif /* defined(VK_KHR_draw_indirect_count) */
+#if defined(VK_KHR_dynamic_rendering)
+    ACQUIRE_PROC_SUFFIX(CmdBeginRendering, KHR, VK_NULL_HANDLE, device);
+    ACQUIRE_PROC_SUFFIX(CmdEndRendering, KHR, VK_NULL_HANDLE, device);
+#endif /* defined(VK_KHR_dynamic_rendering) */
 #if defined(VK_KHR_external_fence_fd)
     ACQUIRE_PROC_SUFFIX(GetFenceFd, KHR, VK_NULL_HANDLE, device);
     ACQUIRE_PROC_SUFFIX(ImportFenceFd, KHR, VK_NULL_HANDLE, device);
@@ -1953,6 +1957,15 @@ bool VulkanInterface::validateDeviceFunctions(uint32_t instanceVersion, uint32_t
     };
 #endif /* defined(VK_KHR_draw_indirect_count) */
 
+#if defined(VK_KHR_dynamic_rendering)
+    if (extensions->hasExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME, physicalDeviceVersion))
+    {
+        if (nullptr == fFunctions.fCmdBeginRenderingKHR ||
+            nullptr == fFunctions.fCmdEndRenderingKHR)
+            return false;
+    };
+#endif /* defined(VK_KHR_dynamic_rendering) */
+
 #if defined(VK_KHR_external_fence_fd)
     if (extensions->hasExtension(VK_KHR_EXTERNAL_FENCE_FD_EXTENSION_NAME, physicalDeviceVersion))
     {
@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of a BindlessResourceTable class
+
+#include <mutex>
+#include <deque>
+
+#include "../../GraphicsEngine/interface/ShaderResourceVariable.h"
+#include "../../GraphicsAccessories/interface/VariableSizeAllocationsManager.hpp"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Manages slots in a bindless resource array.
+
+/// The table wraps a shader resource variable that was defined with Diligent::PIPELINE_RESOURCE_FLAG_BINDLESS
+/// flag. An application registers every resource once and then uses the returned slot index to access the
+/// resource in the shader, so that a single SRB can be used for all draw calls.
+///
+/// \remarks    The class is thread-safe: slots may be allocated and released from multiple threads simultaneously.
+///             Released slots are not reused until the GPU has finished all commands that may reference them
+///             (see Release() and ReleaseStaleSlots()).
+class BindlessResourceTable
+{
+public:
+    /// Slot index that is returned when allocation fails.
+    static constexpr Uint32 InvalidSlot = ~0u;
+
+    /// Initializes the table.
+
+    /// \param[in] pVariable - Bindless shader resource variable obtained from the SRB.
+    ///                        The table size is defined by the variable array size.
+    explicit BindlessResourceTable(IShaderResourceVariable* pVariable);
+
+    // clang-format off
+    BindlessResourceTable           (const BindlessResourceTable&)  = delete;
+    BindlessResourceTable& operator=(const BindlessResourceTable&)  = delete;
+    BindlessResourceTable           (      BindlessResourceTable&&) = delete;
+    BindlessResourceTable& operator=(      BindlessResourceTable&&) = delete;
+    // clang-format on
+
+
+    /// Allocates a range of consecutive slots.
+
+    /// \param[in] Count - The number of slots to allocate.
+    /// \return      The index of the first slot, or InvalidSlot if there is not enough space in the table.
+    ///
+    /// \remarks    The slots are not initialized. Use SetResources() to bind resources to the slots.
+    Uint32 Allocate(Uint32 Count);
+
+
+    /// Allocates a slot and binds the object to it.
+
+    /// \param[in] pObject - Object to bind.
+    /// \return      The slot index, or InvalidSlot if the table is full.
+    Uint32 Register(IDeviceObject* pObject);
+
+
+    /// Binds objects to the previously allocated slots.
+
+    /// \param[in] FirstSlot  - The first slot to set.
+    /// \param[in] ppObjects  - Objects to bind. Null objects reset the slots.
+    /// \param[in] NumObjects - The number of objects in ppObjects array.
+    ///
+    /// \remarks    The slots being replaced must not be accessed by the commands that are executed by the GPU.
+    void SetResources(Uint32 FirstSlot, IDeviceObject* const* ppObjects, Uint32 NumObjects);
+
+
+    /// Releases the range of slots.
+
+    /// \param[in] FirstSlot  - The first slot to release.
+    /// \param[in] Count      - The number of slots to release. Must be the same as the number
+    ///                         of slots passed to Allocate().
+    /// \param[in] FenceValue - The fence value that will be signaled when the GPU has finished
+    ///                         all commands that may reference the slots.
+    ///
+    /// \remarks    The slots are returned to the table by ReleaseStaleSlots() when the
+    ///             completed fence value reaches FenceValue.
+    void Release(Uint32 FirstSlot, Uint32 Count, Uint64 FenceValue);
+
+
+    /// Returns all released slots whose fence value is less than or equal to CompletedFenceValue
+    /// to the table and resets the resources bound to them.
+    void ReleaseStaleSlots(Uint64 CompletedFenceValue);
+
+
+    /// Returns the total number of slots in the table.
+    Uint32 GetSize() const
+    {
+        return m_Size;
+    }
+
+    /// Returns the number of slots that are currently allocated, including the slots
+    /// that have been released, but are not yet available for reuse.
+    Uint32 GetAllocatedSlotCount() const;
+
+    /// Returns the bindless shader resource variable.
+    IShaderResourceVariable* GetVariable()
+    {
+        return m_pVariable;
+    }
+
+private:
+    RefCntAutoPtr<IShaderResourceVariable> m_pVariable;
+
+    Uint32 m_Size = 0;
+
+    struct StaleSlots
+    {
+        Uint32 FirstSlot;
+        Uint32 Count;
+        Uint64 FenceValue;
+    };
+
+    mutable std::mutex             m_Mtx;
+    VariableSizeAllocationsManager m_Mgr;
+    std::deque<StaleSlots>         m_StaleSlots;
+};
+
+} // namespace Diligent
@@ -53,6 +53,9 @@ static const INTERFACE_ID IID_BufferSuballocator =
 struct IBufferSuballocation : public IObject
 {
     /// Returns the start offset of the suballocation.
+
+    /// \remarks    The offset may change when the parent allocator is defragmented
+    ///             (see IBufferSuballocator::Defragment()).
     virtual Uint32 GetOffset() const = 0;
 
     /// Returns the suballocation size.
@@ -81,6 +84,9 @@ struct IBufferSuballocation : public IObject
 /// Buffer suballocator usage stats.
 struct BufferSuballocatorUsageStats
 {
+    /// The number of bins in the free block size histogram.
+    static constexpr Uint32 FreeChunkSizeHistogramSize = 32;
+
     /// The size of the internal buffer, in bytes.
     Uint32 Size = 0;
 
@@ -92,8 +98,22 @@ struct BufferSuballocatorUsageStats
 
     /// The current number of allocations.
     Uint32 AllocationCount = 0;
+
+    /// The number of free chunks in the buffer.
+    Uint32 FreeChunkCount = 0;
+
+    /// Histogram of free chunk sizes. Bin i contains the number of free chunks
+    /// whose size is in the range [2^i, 2^(i+1)) bytes.
+    Uint32 FreeChunkSizeHistogram[FreeChunkSizeHistogramSize] = {};
 };
 
+/// Callback that is called by IBufferSuballocator::Defragment() for every suballocation that has been moved.
+
+/// \param[in] pSuballocation - Suballocation that has been moved. GetOffset() returns the new offset.
+/// \param[in] OldOffset      - The previous offset of the suballocation.
+/// \param[in] pUserData      - User data that was passed to Defragment().
+typedef void (*BufferSuballocationMovedCallbackType)(IBufferSuballocation* pSuballocation, Uint32 OldOffset, void* pUserData);
+
 /// Buffer suballocator.
 struct IBufferSuballocator : public IObject
 {
@@ -129,8 +149,35 @@ struct IBufferSuballocator : public IObject
 
 
     /// Returns internal buffer version. The version is incremented every time
-    /// the buffer is expanded.
+    /// the buffer is expanded or defragmented.
     virtual Uint32 GetVersion() const = 0;
+
+
+    /// Compacts live suballocations to the beginning of the buffer.
+
+    /// \param[in]  pDevice   - Pointer to the render device that will be used to create
+    ///                         a temporary buffer and expand the internal buffer, if necessary.
+    /// \param[in]  pContext  - Pointer to the device context that will be used to move the data.
+    /// \param[in]  Callback  - Optional callback that is called for every suballocation that has been moved.
+    /// \param[in]  pUserData - User data that is passed to the callback.
+    ///
+    /// \return     The number of suballocations that have been moved.
+    ///
+    /// \remarks    The suballocator must have been created with
+    ///             BufferSuballocatorCreateInfo::AllowDefragmentation flag.
+    ///
+    ///             The data is moved on the GPU through a temporary buffer, so the internal buffer
+    ///             object does not change. If any suballocation has been moved, the version is
+    ///             incremented (see GetVersion()), and applications must re-query the offsets of
+    ///             their suballocations before they are used in new commands.
+    ///
+    ///             The method is not thread-safe with respect to GetBuffer() and GetOffset() of
+    ///             suballocations. The callback is called while the allocator is locked and
+    ///             must not allocate or release suballocations.
+    virtual Uint32 Defragment(IRenderDevice*                       pDevice,
+                              IDeviceContext*                      pContext,
+                              BufferSuballocationMovedCallbackType Callback  = nullptr,
+                              void*                                pUserData = nullptr) = 0;
 };
 
 /// Buffer suballocator create information.
@@ -154,6 +201,12 @@ struct BufferSuballocatorCreateInfo
     /// of IBufferSuballocation implementation class. This member defines
     /// the number of objects in one page.
     Uint32 SuballocationObjAllocationGranularity = 64;
+
+
+    /// Whether the suballocator may be defragmented with IBufferSuballocator::Defragment().
+
+    /// When this flag is set, the suballocator keeps track of all live suballocations.
+    bool AllowDefragmentation = false;
 };
 
 /// Creates a new buffer suballocator.
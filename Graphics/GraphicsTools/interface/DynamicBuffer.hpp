@@ -30,6 +30,9 @@
 /// \file
 /// Declaration of a DynamicBuffer class
 
+#include <string>
+#include <vector>
+
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
 #include "../../GraphicsEngine/interface/Buffer.h"
@@ -38,6 +41,33 @@
 namespace Diligent
 {
 
+/// Dynamic buffer growth mode
+enum DYNAMIC_BUFFER_GROWTH_MODE : Uint8
+{
+    /// When the buffer is resized, a new internal buffer is created and
+    /// the existing contents is copied to it.
+    DYNAMIC_BUFFER_GROWTH_MODE_REALLOCATE = 0,
+
+    /// The buffer consists of fixed-size chunks. When the buffer grows, new chunks
+    /// are appended, and existing chunks and their contents are never moved or copied.
+    /// Data must not cross chunk boundaries.
+    DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED
+};
+
+/// Dynamic buffer create information
+struct DynamicBufferCreateInfo
+{
+    /// Buffer description. In chunked mode, every chunk uses this description
+    /// with the size set to ChunkSize, and enough chunks are created to cover Desc.Size.
+    BufferDesc Desc;
+
+    /// Growth mode, see Diligent::DYNAMIC_BUFFER_GROWTH_MODE.
+    DYNAMIC_BUFFER_GROWTH_MODE GrowthMode = DYNAMIC_BUFFER_GROWTH_MODE_REALLOCATE;
+
+    /// Chunk size when GrowthMode is DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED.
+    Uint64 ChunkSize = 0;
+};
+
 /// Dynamically resizable buffer
 class DynamicBuffer
 {
@@ -52,6 +82,16 @@ public:
     ///                     until GetBuffer() or Resize() is called.
     DynamicBuffer(IRenderDevice* pDevice, const BufferDesc& Desc);
 
+    /// Initialies the dynamic buffer with the specified growth mode.
+
+    /// \param[in] pDevice - Render device that will be used to create the buffer.
+    ///                      This parameter may be null (see remarks).
+    /// \param[in] CI      - Create information.
+    ///
+    /// \remarks            If pDevice is null, internal buffer creation will be postponed
+    ///                     until GetBuffer() or Resize() is called.
+    DynamicBuffer(IRenderDevice* pDevice, const DynamicBufferCreateInfo& CI);
+
     // clang-format off
     DynamicBuffer           (const DynamicBuffer&)  = delete;
     DynamicBuffer& operator=(const DynamicBuffer&)  = delete;
@@ -86,6 +126,10 @@ public:
     ///             Typically pDevice and pContext should be null when the method is called from a worker thread.
     ///
     ///             If NewSize is zero, internal buffer will be released.
+    ///
+    ///             In chunked mode, new chunks are created for the added space, and chunks that are
+    ///             past the new size are released. Existing contents is never copied, so pContext
+    ///             is not used and DiscardContent is ignored. The method returns the first chunk.
     IBuffer* Resize(IRenderDevice*  pDevice,
                     IDeviceContext* pContext,
                     Uint64          NewSize,
@@ -102,6 +146,7 @@ public:
     ///
     /// \remarks    If the buffer has been resized, but internal buffer object has not been
     ///             initialized, pDevice and pContext must not be null.
+    ///             In chunked mode, only pDevice is required, and the method returns the first chunk.
     ///
     ///             If buffer does not need to be updated (PendingUpdate() returns false),
     ///             both pDevice and pContext may be null.
@@ -114,6 +159,9 @@ public:
     /// When update is not pending, GetBuffer() may be called with null device and context.
     bool PendingUpdate() const
     {
+        if (m_GrowthMode == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED)
+            return m_Chunks.size() < GetRequiredChunkCount();
+
         return (m_Desc.Size > 0) && (!m_pBuffer || m_pStaleBuffer);
     }
 
@@ -127,19 +175,70 @@ public:
 
     /// Returns dynamic buffer version.
     /// The version is incremented every time a new internal buffer is created.
+    /// In chunked mode, it is also incremented when chunks are released.
     Uint32 GetVersion() const
     {
         return m_Version;
     }
 
+
+    /// Returns the buffer growth mode.
+    DYNAMIC_BUFFER_GROWTH_MODE GetGrowthMode() const
+    {
+        return m_GrowthMode;
+    }
+
+
+    /// Returns the chunk size in chunked mode, and the buffer size otherwise.
+    Uint64 GetChunkSize() const
+    {
+        return m_GrowthMode == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED ? m_ChunkSize : m_Desc.Size;
+    }
+
+
+    /// Returns the number of chunks that have been created.
+    /// In reallocate mode, the buffer is a single chunk.
+    Uint32 GetChunkCount() const
+    {
+        if (m_GrowthMode == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED)
+            return static_cast<Uint32>(m_Chunks.size());
+
+        return m_pBuffer ? 1 : 0;
+    }
+
+
+    /// Returns the chunk with the given index, or null if the chunk has not been created.
+
+    /// \remarks    Chunks are never moved, so an application may keep the pointer
+    ///             until the buffer is shrunk below the chunk offset.
+    IBuffer* GetChunk(Uint32 Index)
+    {
+        if (m_GrowthMode == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED)
+            return Index < m_Chunks.size() ? m_Chunks[Index].RawPtr() : nullptr;
+
+        return Index == 0 ? m_pBuffer.RawPtr() : nullptr;
+    }
+
 private:
     void CommitResize(IRenderDevice*  pDevice,
                       IDeviceContext* pContext);
 
+    void CommitChunkedResize(IRenderDevice* pDevice);
+
+    size_t GetRequiredChunkCount() const
+    {
+        return static_cast<size_t>((m_Desc.Size + m_ChunkSize - 1) / m_ChunkSize);
+    }
+
     BufferDesc        m_Desc;
     const std::string m_Name;
     Uint32            m_Version = 0;
 
+    const DYNAMIC_BUFFER_GROWTH_MODE m_GrowthMode;
+    const Uint64                     m_ChunkSize;
+
+    std::vector<RefCntAutoPtr<IBuffer>> m_Chunks;
+
     RefCntAutoPtr<IBuffer> m_pBuffer;
     RefCntAutoPtr<IBuffer> m_pStaleBuffer;
 };
@@ -0,0 +1,254 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of a ScreenCaptureRing class
+
+#include <functional>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/SwapChain.h"
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/Timer.hpp"
+
+namespace Diligent
+{
+
+/// Pixel format of the captured frames.
+enum SCREEN_CAPTURE_FORMAT : Uint8
+{
+    /// Frames are copied as is and keep the format of the source texture.
+    SCREEN_CAPTURE_FORMAT_NATIVE = 0,
+
+    /// Frames are converted on the GPU to 8-bit RGBA with sRGB-encoded color components.
+    SCREEN_CAPTURE_FORMAT_RGBA8,
+
+    /// Frames are converted on the GPU to NV12 (BT.709, limited range):
+    /// a full-resolution 8-bit luma plane followed by a half-resolution
+    /// plane of interleaved 8-bit U and V samples.
+    SCREEN_CAPTURE_FORMAT_NV12
+};
+
+/// Frame that is passed to the ScreenCaptureRing completion callback.
+struct ScreenCaptureFrame
+{
+    /// Frame id that was passed to ScreenCaptureRing::Capture().
+    Uint32 Id = 0;
+
+    /// Frame width, in pixels. For NV12 frames, the width is rounded up to a multiple of 2.
+    Uint32 Width = 0;
+
+    /// Frame height, in pixels. For NV12 frames, the height is rounded up to a multiple of 2.
+    Uint32 Height = 0;
+
+    /// Format of the frame data.
+    SCREEN_CAPTURE_FORMAT Format = SCREEN_CAPTURE_FORMAT_NATIVE;
+
+    /// Texture format of the frame data when Format is SCREEN_CAPTURE_FORMAT_NATIVE.
+    TEXTURE_FORMAT TexFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Pointer to the first row of the frame (the luma plane for NV12 frames).
+    const void* pData = nullptr;
+
+    /// Pointer to the first row of the interleaved chroma plane of an NV12 frame, or null.
+    const void* pChromaData = nullptr;
+
+    /// Row stride, in bytes. For NV12 frames, both planes use the same stride.
+    Uint64 Stride = 0;
+
+    /// Time, in seconds, between the Capture() call and the moment the frame was delivered.
+    double Latency = 0;
+};
+
+/// Capture throughput statistics.
+struct ScreenCaptureStats
+{
+    /// The number of frames enqueued for capture.
+    Uint64 NumCaptured = 0;
+
+    /// The number of frames delivered to the callback.
+    Uint64 NumDelivered = 0;
+
+    /// The number of frames dropped because all ring slots were busy.
+    Uint64 NumDropped = 0;
+
+    /// The total size of the frame data delivered to the callback, in bytes.
+    Uint64 BytesDelivered = 0;
+
+    /// Average time, in seconds, between the Capture() call and the frame delivery.
+    double AvgLatency = 0;
+
+    /// The number of frames delivered per second.
+    double FramesPerSecond = 0;
+
+    /// The number of bytes delivered per second.
+    double BytesPerSecond = 0;
+};
+
+/// ScreenCaptureRing initialization parameters.
+struct ScreenCaptureRingCreateInfo
+{
+    /// Render device that will be used to create staging textures and conversion pipelines.
+    IRenderDevice* pDevice = nullptr;
+
+    /// The number of staging textures in the ring, which is the maximum
+    /// number of captures that may be in flight at the same time.
+    Uint32 RingDepth = 3;
+
+    /// Format of the captured frames. Formats other than SCREEN_CAPTURE_FORMAT_NATIVE
+    /// require compute shader support.
+    SCREEN_CAPTURE_FORMAT Format = SCREEN_CAPTURE_FORMAT_NATIVE;
+
+    /// Whether Capture() should wait for the oldest capture to complete when all
+    /// ring slots are busy. If false, the new frame is dropped instead.
+    bool WaitForFreeSlot = false;
+
+    /// Callback that is invoked for every completed capture, in capture order.
+    /// The frame data points directly to the mapped staging texture
+    /// and is only valid until the callback returns.
+    std::function<void(const ScreenCaptureFrame&)> OnFrameReady = nullptr;
+};
+
+/// Reads back rendered frames through a fixed-depth ring of staging textures.
+
+/// Every Capture() call copies the source texture (optionally converting it on the GPU)
+/// into the next free staging texture and signals a fence. Poll() checks the fence and
+/// hands the mapped staging memory of every completed capture to the callback without
+/// copying it, then returns the slot to the ring.
+///
+/// \remarks    The class is not thread-safe. All methods must be called from the thread
+///             that owns the immediate device context that is used for capturing.
+///
+///             When the frames are converted on the GPU, Capture() sets the conversion compute
+///             pipeline and commits its shader resources in the device context. The previously
+///             bound pipeline state and shader resources are not restored, so the application
+///             must set them again before issuing further draw or dispatch commands.
+class ScreenCaptureRing
+{
+public:
+    explicit ScreenCaptureRing(const ScreenCaptureRingCreateInfo& CI);
+
+    // clang-format off
+    ScreenCaptureRing           (const ScreenCaptureRing&)  = delete;
+    ScreenCaptureRing& operator=(const ScreenCaptureRing&)  = delete;
+    ScreenCaptureRing           (      ScreenCaptureRing&&) = delete;
+    ScreenCaptureRing& operator=(      ScreenCaptureRing&&) = delete;
+    // clang-format on
+
+    ~ScreenCaptureRing();
+
+    /// Enqueues the capture of the current back buffer of the swap chain.
+
+    /// \param[in] pSwapChain - Swap chain to capture.
+    /// \param[in] pContext   - Immediate device context.
+    /// \param[in] FrameId    - Frame id that will be passed to the callback.
+    ///
+    /// \return     true if the capture was enqueued, and false if the frame was dropped
+    ///             or the resources required for the capture could not be created.
+    bool Capture(ISwapChain* pSwapChain, IDeviceContext* pContext, Uint32 FrameId);
+
+    /// Enqueues the capture of the first mip level and array slice of a 2D texture.
+
+    /// \param[in] pTexture - Texture to capture. The texture must not be multisampled.
+    /// \param[in] pContext - Immediate device context.
+    /// \param[in] FrameId  - Frame id that will be passed to the callback.
+    ///
+    /// \return     true if the capture was enqueued, and false if the frame was dropped
+    ///             or the resources required for the capture could not be created.
+    bool Capture(ITexture* pTexture, IDeviceContext* pContext, Uint32 FrameId);
+
+    /// Delivers all captures that have been completed by the GPU to the callback.
+
+    /// \return     The number of delivered frames.
+    Uint32 Poll(IDeviceContext* pContext);
+
+    /// Waits for all pending captures and delivers them to the callback.
+    void Flush(IDeviceContext* pContext);
+
+    /// Returns the number of captures that have not been delivered yet.
+    Uint32 GetNumPendingCaptures() const
+    {
+        return m_NumPending;
+    }
+
+    /// Returns the capture statistics collected since the ring was created or the last ResetStats() call.
+    ScreenCaptureStats GetStats() const;
+
+    /// Resets the capture statistics.
+    void ResetStats();
+
+private:
+    struct Slot
+    {
+        RefCntAutoPtr<ITexture> pStagingTex;
+
+        Uint64 FenceValue  = 0;
+        Uint32 FrameId     = 0;
+        double CaptureTime = 0;
+    };
+
+    ITexture* PrepareStagingTexture(Slot& S, const TextureDesc& SrcDesc);
+    bool      ConvertTexture(ITexture* pSrcTex, IDeviceContext* pContext);
+    ITexture* PrepareConvertedTexture(const TextureDesc& SrcDesc);
+    void      WaitForOldestCapture(IDeviceContext* pContext);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+    RefCntAutoPtr<IFence>        m_pFence;
+
+    const SCREEN_CAPTURE_FORMAT                          m_Format;
+    const bool                                           m_WaitForFreeSlot;
+    const std::function<void(const ScreenCaptureFrame&)> m_OnFrameReady;
+
+    std::vector<Slot> m_Slots;
+
+    // Index of the oldest pending capture
+    Uint32 m_FirstPending = 0;
+    Uint32 m_NumPending   = 0;
+
+    Uint64 m_NextFenceValue = 1;
+
+    // Conversion resources. PSOs are indexed by whether the source texture uses an sRGB format.
+    RefCntAutoPtr<IPipelineResourceSignature> m_pConvertSignature;
+    RefCntAutoPtr<IShaderResourceBinding>     m_pConvertSRB;
+    RefCntAutoPtr<IPipelineState>             m_pConvertPSO[2];
+    RefCntAutoPtr<ITexture>                   m_pConvertedTex;
+    // Intermediate copy of the source texture that is used when the source can't be bound as a shader resource
+    RefCntAutoPtr<ITexture> m_pSourceCopy;
+
+    Timer  m_Timer;
+    double m_StatsStartTime = 0;
+
+    ScreenCaptureStats m_Stats;
+    double             m_TotalLatency = 0;
+};
+
+} // namespace Diligent
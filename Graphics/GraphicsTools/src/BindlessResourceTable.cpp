@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BindlessResourceTable.hpp"
+
+#include <vector>
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+Uint32 GetVariableArraySize(IShaderResourceVariable* pVariable)
+{
+    DEV_CHECK_ERR(pVariable != nullptr, "Bindless shader resource variable must not be null");
+    if (pVariable == nullptr)
+        return 0;
+
+    ShaderResourceDesc ResDesc;
+    pVariable->GetResourceDesc(ResDesc);
+    DEV_CHECK_ERR(pVariable->GetType() == SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE,
+                  "Bindless resource variable '", ResDesc.Name, "' must be mutable");
+    return ResDesc.ArraySize;
+}
+
+} // namespace
+
+BindlessResourceTable::BindlessResourceTable(IShaderResourceVariable* pVariable) :
+    // clang-format off
+    m_pVariable{pVariable},
+    m_Size     {GetVariableArraySize(pVariable)},
+    m_Mgr      {m_Size, DefaultRawMemoryAllocator::GetAllocator()}
+// clang-format on
+{
+}
+
+Uint32 BindlessResourceTable::Allocate(Uint32 Count)
+{
+    VERIFY(Count > 0, "The number of slots must not be zero");
+    if (Count == 0)
+        return InvalidSlot;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto Allocation = m_Mgr.Allocate(Count, 1);
+    if (!Allocation.IsValid())
+    {
+        LOG_ERROR_MESSAGE("Failed to allocate ", Count, " slot(s) in the bindless resource table of size ", m_Size,
+                          ": ", m_Mgr.GetFreeSize(), " slot(s) are free, but there is no contiguous range large enough. "
+                                                      "Increase the array size of the bindless resource or release unused slots.");
+        return InvalidSlot;
+    }
+    VERIFY_EXPR(Allocation.Size == Count);
+
+    return static_cast<Uint32>(Allocation.UnalignedOffset);
+}
+
+Uint32 BindlessResourceTable::Register(IDeviceObject* pObject)
+{
+    const auto Slot = Allocate(1);
+    if (Slot != InvalidSlot)
+        SetResources(Slot, &pObject, 1);
+    return Slot;
+}
+
+void BindlessResourceTable::SetResources(Uint32 FirstSlot, IDeviceObject* const* ppObjects, Uint32 NumObjects)
+{
+    DEV_CHECK_ERR(FirstSlot != InvalidSlot && FirstSlot + NumObjects <= m_Size,
+                  "Slot range [", FirstSlot, ", ", FirstSlot + NumObjects, ") is out of the table bounds [0, ", m_Size, ")");
+    if (m_pVariable && NumObjects > 0)
+    {
+        // Binding resources to the same SRB from multiple threads is not safe
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_pVariable->SetArray(ppObjects, FirstSlot, NumObjects);
+    }
+}
+
+void BindlessResourceTable::Release(Uint32 FirstSlot, Uint32 Count, Uint64 FenceValue)
+{
+    VERIFY_EXPR(FirstSlot != InvalidSlot && FirstSlot + Count <= m_Size);
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    DEV_CHECK_ERR(m_StaleSlots.empty() || m_StaleSlots.back().FenceValue <= FenceValue,
+                  "Fence values of the released slots must not decrease");
+    m_StaleSlots.push_back({FirstSlot, Count, FenceValue});
+}
+
+void BindlessResourceTable::ReleaseStaleSlots(Uint64 CompletedFenceValue)
+{
+    std::vector<StaleSlots> ReleasedSlots;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        while (!m_StaleSlots.empty() && m_StaleSlots.front().FenceValue <= CompletedFenceValue)
+        {
+            ReleasedSlots.push_back(m_StaleSlots.front());
+            m_StaleSlots.pop_front();
+        }
+    }
+
+    if (ReleasedSlots.empty())
+        return;
+
+    // Release references to the resources before returning the slots to the allocator
+    std::vector<IDeviceObject*> NullObjects;
+    for (const auto& Slots : ReleasedSlots)
+    {
+        NullObjects.resize(std::max(NullObjects.size(), size_t{Slots.Count}));
+        SetResources(Slots.FirstSlot, NullObjects.data(), Slots.Count);
+    }
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    for (const auto& Slots : ReleasedSlots)
+        m_Mgr.Free(Slots.FirstSlot, Slots.Count);
+}
+
+Uint32 BindlessResourceTable::GetAllocatedSlotCount() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return static_cast<Uint32>(m_Mgr.GetUsedSize());
+}
+
+} // namespace Diligent
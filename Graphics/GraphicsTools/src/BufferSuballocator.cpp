@@ -29,6 +29,9 @@
 
 #include <mutex>
 #include <atomic>
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -38,6 +41,7 @@
 #include "Align.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
+#include "PlatformMisc.hpp"
 
 namespace Diligent
 {
@@ -52,13 +56,15 @@ public:
                             BufferSuballocatorImpl*                      pParentAllocator,
                             Uint32                                       Offset,
                             Uint32                                       Size,
+                            Uint32                                       Alignment,
                             VariableSizeAllocationsManager::Allocation&& Subregion) :
         // clang-format off
         TBase             {pRefCounters},
         m_pParentAllocator{pParentAllocator},
         m_Subregion       {std::move(Subregion)},
         m_Offset          {Offset},
-        m_Size            {Size}
+        m_Size            {Size},
+        m_Alignment       {Alignment}
     // clang-format on
     {
         VERIFY_EXPR(m_pParentAllocator);
@@ -83,7 +89,7 @@ public:
 
     virtual Uint32 GetOffset() const override final
     {
-        return m_Offset;
+        return m_Offset.load(std::memory_order_relaxed);
     }
 
     virtual Uint32 GetSize() const override final
@@ -103,13 +109,37 @@ public:
         return m_pUserData.RawPtr<IObject>();
     }
 
+    Uint32 GetAlignment() const
+    {
+        return m_Alignment;
+    }
+
+    const VariableSizeAllocationsManager::Allocation& GetSubregion() const
+    {
+        return m_Subregion;
+    }
+
+    VariableSizeAllocationsManager::Allocation ReleaseSubregion()
+    {
+        return std::move(m_Subregion);
+    }
+
+    // Must only be called by the parent allocator while it is locked
+    void Move(VariableSizeAllocationsManager::Allocation&& NewSubregion)
+    {
+        m_Subregion = std::move(NewSubregion);
+        m_Offset.store(AlignUp(static_cast<Uint32>(m_Subregion.UnalignedOffset), m_Alignment), std::memory_order_relaxed);
+    }
+
 private:
     RefCntAutoPtr<BufferSuballocatorImpl> m_pParentAllocator;
 
     VariableSizeAllocationsManager::Allocation m_Subregion;
 
-    const Uint32 m_Offset;
-    const Uint32 m_Size;
+    // The offset changes when the allocator is defragmented
+    std::atomic<Uint32> m_Offset;
+    const Uint32        m_Size;
+    const Uint32        m_Alignment;
 
     RefCntAutoPtr<IObject> m_pUserData;
 };
@@ -129,6 +159,7 @@ public:
         m_Mgr                    {StaticCast<size_t>(CreateInfo.Desc.Size), DefaultRawMemoryAllocator::GetAllocator()},
         m_Buffer                 {pDevice, CreateInfo.Desc},
         m_ExpansionSize          {CreateInfo.ExpansionSize},
+        m_AllowDefragmentation   {CreateInfo.AllowDefragmentation},
         m_SuballocationsAllocator
         {
             DefaultRawMemoryAllocator::GetAllocator(),
@@ -175,6 +206,7 @@ public:
         }
 
         VariableSizeAllocationsManager::Allocation Subregion;
+        BufferSuballocationImpl*                   pSuballocation = nullptr;
         {
             std::lock_guard<std::mutex> Lock{m_MgrMtx};
             Subregion = m_Mgr.Allocate(Size, Alignment);
@@ -188,34 +220,187 @@ public:
                 m_Mgr.Extend(ExtraSize);
                 Subregion = m_Mgr.Allocate(Size, Alignment);
             }
-        }
 
-        // clang-format off
-        BufferSuballocationImpl* pSuballocation{
-            NEW_RC_OBJ(m_SuballocationsAllocator, "BufferSuballocationImpl instance", BufferSuballocationImpl)
-            (
-                this,
-                AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment),
-                Size,
-                std::move(Subregion)
-            )
-        };
-        // clang-format on
+            // clang-format off
+            pSuballocation =
+                NEW_RC_OBJ(m_SuballocationsAllocator, "BufferSuballocationImpl instance", BufferSuballocationImpl)
+                (
+                    this,
+                    AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment),
+                    Size,
+                    Alignment,
+                    std::move(Subregion)
+                );
+            // clang-format on
+
+            // The suballocation must be registered while the allocator is locked so that
+            // Defragment() never sees a subregion that does not belong to a live suballocation.
+            if (m_AllowDefragmentation)
+                m_LiveSuballocations.insert(pSuballocation);
+        }
 
         pSuballocation->QueryInterface(IID_BufferSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
         m_AllocationCount.fetch_add(1);
     }
 
-    void Free(VariableSizeAllocationsManager::Allocation&& Subregion)
+    void Free(BufferSuballocationImpl* pSuballocation)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
-        m_Mgr.Free(std::move(Subregion));
+        // The subregion must be released while the allocator is locked as
+        // Defragment() may be moving the suballocation at the same time.
+        m_Mgr.Free(pSuballocation->ReleaseSubregion());
+        if (m_AllowDefragmentation)
+            m_LiveSuballocations.erase(pSuballocation);
         m_AllocationCount.fetch_add(-1);
     }
 
     virtual Uint32 GetVersion() const override final
     {
-        return m_Buffer.GetVersion();
+        return m_Buffer.GetVersion() + m_DefragmentationCount.load();
+    }
+
+    virtual Uint32 Defragment(IRenderDevice*                       pDevice,
+                              IDeviceContext*                      pContext,
+                              BufferSuballocationMovedCallbackType Callback,
+                              void*                                pUserData) override final
+    {
+        if (!m_AllowDefragmentation)
+        {
+            LOG_ERROR_MESSAGE("Buffer suballocator '", m_Buffer.GetDesc().Name, "' was not created with AllowDefragmentation flag");
+            return 0;
+        }
+        VERIFY_EXPR(pDevice != nullptr && pContext != nullptr);
+
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        // Suballocations are already packed if the only free chunk is at the end of the buffer
+        size_t FirstFreeOffset = m_Mgr.GetMaxSize();
+        m_Mgr.ProcessFreeBlocks([&FirstFreeOffset](size_t Offset, size_t /*Size*/) {
+            FirstFreeOffset = std::min(FirstFreeOffset, Offset);
+        });
+        if (FirstFreeOffset + m_Mgr.GetFreeSize() == m_Mgr.GetMaxSize())
+            return 0;
+
+        std::vector<BufferSuballocationImpl*> Suballocations{m_LiveSuballocations.begin(), m_LiveSuballocations.end()};
+        std::sort(Suballocations.begin(), Suballocations.end(),
+                  [](const BufferSuballocationImpl* pLHS, const BufferSuballocationImpl* pRHS) {
+                      return pLHS->GetSubregion().UnalignedOffset < pRHS->GetSubregion().UnalignedOffset;
+                  });
+
+        // Suballocations are packed in the order of increasing offsets, so the packed size
+        // can be computed before any of them is moved.
+        Uint32 PackedSize = 0;
+        for (const auto* pSuballocation : Suballocations)
+        {
+            const auto Alignment = pSuballocation->GetAlignment();
+            PackedSize           = AlignUp(PackedSize, Alignment) + AlignUp(pSuballocation->GetSize(), Alignment);
+        }
+
+        // Source and destination ranges may overlap, so the data is copied through a temporary buffer.
+        // The buffer is created before any suballocation is moved so that the suballocator remains
+        // intact if the creation fails.
+        RefCntAutoPtr<IBuffer> pTmpBuffer;
+        if (PackedSize > 0)
+        {
+            BufferDesc TmpBuffDesc;
+            TmpBuffDesc.Name      = "Buffer suballocator defragmentation buffer";
+            TmpBuffDesc.Size      = PackedSize;
+            TmpBuffDesc.BindFlags = BIND_NONE;
+            TmpBuffDesc.Usage     = USAGE_DEFAULT;
+            TmpBuffDesc.Mode      = BUFFER_MODE_UNDEFINED;
+
+            pDevice->CreateBuffer(TmpBuffDesc, nullptr, &pTmpBuffer);
+            if (!pTmpBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to defragment buffer suballocator '", m_Buffer.GetDesc().Name, "': failed to create temporary buffer");
+                return 0;
+            }
+        }
+
+        // Make sure that the buffer covers all suballocations
+        m_Buffer.Resize(pDevice, pContext, m_Mgr.GetMaxSize());
+        auto* pBuffer = m_Buffer.GetBuffer(pDevice, pContext);
+        if (pBuffer == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Failed to defragment buffer suballocator '", m_Buffer.GetDesc().Name, "': internal buffer is null");
+            return 0;
+        }
+
+        struct MoveInfo
+        {
+            BufferSuballocationImpl* pSuballocation;
+            Uint32                   OldOffset;
+        };
+        std::vector<MoveInfo> Moves;
+        Moves.reserve(Suballocations.size());
+
+        // Release all subregions and allocate them again in the order of increasing offsets,
+        // which packs them at the beginning of the buffer.
+        for (auto* pSuballocation : Suballocations)
+        {
+            Moves.push_back({pSuballocation, pSuballocation->GetOffset()});
+            m_Mgr.Free(pSuballocation->ReleaseSubregion());
+        }
+        VERIFY_EXPR(m_Mgr.IsEmpty());
+
+        for (auto* pSuballocation : Suballocations)
+        {
+            auto NewSubregion = m_Mgr.Allocate(pSuballocation->GetSize(), pSuballocation->GetAlignment());
+            VERIFY(NewSubregion.IsValid(), "Packed suballocations must always fit into the buffer");
+            pSuballocation->Move(std::move(NewSubregion));
+        }
+
+        // Consecutive suballocations that stay adjacent are copied with a single command.
+        if (pTmpBuffer)
+        {
+            Uint32 CopiedSize = 0;
+
+            size_t RangeStart = 0;
+            while (RangeStart < Moves.size())
+            {
+                const auto& FirstMove = Moves[RangeStart];
+
+                auto   SrcOffset = FirstMove.OldOffset;
+                auto   DstOffset = FirstMove.pSuballocation->GetOffset();
+                Uint32 CopySize  = FirstMove.pSuballocation->GetSize();
+
+                size_t RangeEnd = RangeStart + 1;
+                for (; RangeEnd < Moves.size(); ++RangeEnd)
+                {
+                    const auto& Move = Moves[RangeEnd];
+                    if (Move.OldOffset - SrcOffset != Move.pSuballocation->GetOffset() - DstOffset)
+                        break;
+                    CopySize = Move.pSuballocation->GetOffset() + Move.pSuballocation->GetSize() - DstOffset;
+                }
+
+                pContext->CopyBuffer(pBuffer, SrcOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                     pTmpBuffer, DstOffset, CopySize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                CopiedSize = std::max(CopiedSize, DstOffset + CopySize);
+                RangeStart = RangeEnd;
+            }
+            VERIFY_EXPR(CopiedSize <= PackedSize);
+
+            pContext->CopyBuffer(pTmpBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                 pBuffer, 0, CopiedSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+
+        Uint32 NumMoved = 0;
+        for (const auto& Move : Moves)
+        {
+            if (Move.pSuballocation->GetOffset() == Move.OldOffset)
+                continue;
+
+            ++NumMoved;
+            // Suballocations whose last reference has been released are waiting for the lock
+            // in Free() and must not be passed to the application.
+            if (Callback != nullptr && Move.pSuballocation->GetReferenceCounters()->GetNumStrongRefs() > 0)
+                Callback(Move.pSuballocation, Move.OldOffset, pUserData);
+        }
+
+        if (NumMoved > 0)
+            m_DefragmentationCount.fetch_add(1);
+
+        return NumMoved;
     }
 
     virtual void GetUsageStats(BufferSuballocatorUsageStats& UsageStats) override final
@@ -225,6 +410,14 @@ public:
         UsageStats.UsedSize         = static_cast<Uint32>(m_Mgr.GetUsedSize());
         UsageStats.MaxFreeChunkSize = static_cast<Uint32>(m_Mgr.GetMaxFreeBlockSize());
         UsageStats.AllocationCount  = m_AllocationCount.load();
+        UsageStats.FreeChunkCount   = static_cast<Uint32>(m_Mgr.GetNumFreeBlocks());
+
+        std::fill(std::begin(UsageStats.FreeChunkSizeHistogram), std::end(UsageStats.FreeChunkSizeHistogram), 0);
+        m_Mgr.ProcessFreeBlocks([&UsageStats](size_t /*Offset*/, size_t Size) {
+            VERIFY_EXPR(Size > 0);
+            const auto Bin = std::min(PlatformMisc::GetMSB(Size), BufferSuballocatorUsageStats::FreeChunkSizeHistogramSize - 1);
+            ++UsageStats.FreeChunkSizeHistogram[Bin];
+        });
     }
 
 private:
@@ -234,16 +427,21 @@ private:
     DynamicBuffer m_Buffer;
 
     const Uint32 m_ExpansionSize;
+    const bool   m_AllowDefragmentation;
 
     std::atomic<Int32> m_AllocationCount{0};
 
+    // Live suballocations are only tracked when defragmentation is allowed
+    std::unordered_set<BufferSuballocationImpl*> m_LiveSuballocations;
+    std::atomic<Uint32>                          m_DefragmentationCount{0};
+
     FixedBlockMemoryAllocator m_SuballocationsAllocator;
 };
 
 
 BufferSuballocationImpl::~BufferSuballocationImpl()
 {
-    m_pParentAllocator->Free(std::move(m_Subregion));
+    m_pParentAllocator->Free(this);
 }
 
 IBufferSuballocator* BufferSuballocationImpl::GetAllocator()
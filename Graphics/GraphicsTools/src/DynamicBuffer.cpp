@@ -34,18 +34,94 @@
 namespace Diligent
 {
 
+namespace
+{
+
+DynamicBufferCreateInfo GetReallocateCreateInfo(const BufferDesc& Desc)
+{
+    DynamicBufferCreateInfo CI;
+    CI.Desc = Desc;
+    return CI;
+}
+
+} // namespace
+
 DynamicBuffer::DynamicBuffer(IRenderDevice* pDevice, const BufferDesc& Desc) :
-    m_Desc{Desc},
-    m_Name{Desc.Name != nullptr ? Desc.Name : "Dynamic buffer"}
+    DynamicBuffer{pDevice, GetReallocateCreateInfo(Desc)}
+{
+}
+
+DynamicBuffer::DynamicBuffer(IRenderDevice* pDevice, const DynamicBufferCreateInfo& CI) :
+    m_Desc{CI.Desc},
+    m_Name{CI.Desc.Name != nullptr ? CI.Desc.Name : "Dynamic buffer"},
+    m_GrowthMode{CI.GrowthMode},
+    m_ChunkSize{CI.GrowthMode == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED ? CI.ChunkSize : 0}
 {
     m_Desc.Name = m_Name.c_str();
+
+    if (m_GrowthMode == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED)
+    {
+        if (m_ChunkSize == 0)
+            LOG_ERROR_AND_THROW("Chunk size of dynamic buffer '", m_Name, "' must not be zero");
+
+        CommitChunkedResize(pDevice);
+        return;
+    }
+
     if (m_Desc.Size > 0 && pDevice != nullptr)
     {
-        pDevice->CreateBuffer(Desc, nullptr, &m_pBuffer);
+        pDevice->CreateBuffer(m_Desc, nullptr, &m_pBuffer);
         VERIFY_EXPR(m_pBuffer);
     }
 }
 
+void DynamicBuffer::CommitChunkedResize(IRenderDevice* pDevice)
+{
+    const auto RequiredChunkCount = GetRequiredChunkCount();
+    if (m_Chunks.size() > RequiredChunkCount)
+    {
+        // Chunks past the new size are released, other chunks are not affected.
+        // The version still changes as the released chunks must not be used anymore.
+        const auto NumReleasedChunks = m_Chunks.size() - RequiredChunkCount;
+        m_Chunks.resize(RequiredChunkCount);
+        ++m_Version;
+
+        LOG_INFO_MESSAGE("Dynamic buffer: released ", NumReleasedChunks, " chunk(s) of dynamic buffer '", m_Name,
+                         "'. Total size: ", FormatMemorySize(m_ChunkSize * m_Chunks.size(), 1), ". Version: ", GetVersion());
+    }
+
+    if (m_Chunks.size() < RequiredChunkCount && pDevice != nullptr)
+    {
+        const auto FirstNewChunk = m_Chunks.size();
+        m_Chunks.reserve(RequiredChunkCount);
+        while (m_Chunks.size() < RequiredChunkCount)
+        {
+            const auto ChunkName = m_Name + " - chunk " + std::to_string(m_Chunks.size());
+
+            auto ChunkDesc = m_Desc;
+            ChunkDesc.Name = ChunkName.c_str();
+            ChunkDesc.Size = m_ChunkSize;
+
+            RefCntAutoPtr<IBuffer> pChunk;
+            pDevice->CreateBuffer(ChunkDesc, nullptr, &pChunk);
+            if (!pChunk)
+            {
+                LOG_ERROR_MESSAGE("Failed to create chunk ", m_Chunks.size(), " of dynamic buffer '", m_Name, "'");
+                break;
+            }
+            m_Chunks.emplace_back(std::move(pChunk));
+        }
+
+        if (m_Chunks.size() > FirstNewChunk)
+        {
+            ++m_Version;
+
+            LOG_INFO_MESSAGE("Dynamic buffer: added ", m_Chunks.size() - FirstNewChunk, " chunk(s) to dynamic buffer '", m_Name,
+                             "'. Total size: ", FormatMemorySize(m_ChunkSize * m_Chunks.size(), 1), ". Version: ", GetVersion());
+        }
+    }
+}
+
 void DynamicBuffer::CommitResize(IRenderDevice*  pDevice,
                                  IDeviceContext* pContext)
 {
@@ -73,6 +149,13 @@ IBuffer* DynamicBuffer::Resize(IRenderDevice*  pDevice,
                                Uint64          NewSize,
                                bool            DiscardContent)
 {
+    if (m_GrowthMode == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED)
+    {
+        m_Desc.Size = NewSize;
+        CommitChunkedResize(pDevice);
+        return GetChunk(0);
+    }
+
     if (m_Desc.Size != NewSize)
     {
         if (!m_pStaleBuffer)
@@ -106,6 +189,14 @@ IBuffer* DynamicBuffer::Resize(IRenderDevice*  pDevice,
 IBuffer* DynamicBuffer::GetBuffer(IRenderDevice*  pDevice,
                                   IDeviceContext* pContext)
 {
+    if (m_GrowthMode == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED)
+    {
+        DEV_CHECK_ERR(!PendingUpdate() || pDevice != nullptr,
+                      "New chunks must be created, but pDevice is null. Use PendingUpdate() to check if the buffer must be updated.");
+        CommitChunkedResize(pDevice);
+        return GetChunk(0);
+    }
+
     DEV_CHECK_ERR(m_pBuffer || m_Desc.Size == 0 || pDevice != nullptr,
                   "A new buffer must be created, but pDevice is null. Use PendingUpdate() to check if the buffer must be updated.");
     DEV_CHECK_ERR(!m_pStaleBuffer || pContext != nullptr,
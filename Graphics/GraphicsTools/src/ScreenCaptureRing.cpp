@@ -0,0 +1,513 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ScreenCaptureRing.hpp"
+
+#include "GraphicsAccessories.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// clang-format off
+const char* const ConvertCS = R"(
+Texture2D<float4> g_Source;
+#if CAPTURE_FORMAT_NV12
+RWTexture2D<unorm float /*format=r8*/> g_Output;
+#else
+RWTexture2D<unorm float4 /*format=rgba8*/> g_Output;
+#endif
+
+float3 LinearToSRGB(float3 RGB)
+{
+    float3 Lo = RGB * 12.92;
+    float3 Hi = 1.055 * pow(max(RGB, float3(0.0, 0.0, 0.0)), float3(1.0 / 2.4, 1.0 / 2.4, 1.0 / 2.4)) - 0.055;
+    return float3(RGB.r <= 0.0031308 ? Lo.r : Hi.r,
+                  RGB.g <= 0.0031308 ? Lo.g : Hi.g,
+                  RGB.b <= 0.0031308 ? Lo.b : Hi.b);
+}
+
+float4 LoadSource(int2 Pos, int2 Dim)
+{
+    float4 Color = g_Source.Load(int3(clamp(Pos, int2(0, 0), Dim - int2(1, 1)), 0));
+#if CONVERT_TO_SRGB
+    Color.rgb = LinearToSRGB(saturate(Color.rgb));
+#endif
+    return saturate(Color);
+}
+
+#if CAPTURE_FORMAT_NV12
+// BT.709 limited range
+float RGBToLuma(float3 RGB)
+{
+    return dot(RGB, float3(0.2126, 0.7152, 0.0722)) * (219.0 / 255.0) + 16.0 / 255.0;
+}
+#endif
+
+[numthreads(8, 8, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    uint Width, Height;
+    g_Source.GetDimensions(Width, Height);
+    int2 Dim = int2(Width, Height);
+
+#if CAPTURE_FORMAT_NV12
+    // Every thread writes a 2x2 block of luma samples and one UV pair
+    if (DTid.x * 2u >= Width || DTid.y * 2u >= Height)
+        return;
+
+    int2   Pos  = int2(DTid.xy) * 2;
+    float3 RGB0 = LoadSource(Pos + int2(0, 0), Dim).rgb;
+    float3 RGB1 = LoadSource(Pos + int2(1, 0), Dim).rgb;
+    float3 RGB2 = LoadSource(Pos + int2(0, 1), Dim).rgb;
+    float3 RGB3 = LoadSource(Pos + int2(1, 1), Dim).rgb;
+
+    g_Output[uint2(Pos + int2(0, 0))] = RGBToLuma(RGB0);
+    g_Output[uint2(Pos + int2(1, 0))] = RGBToLuma(RGB1);
+    g_Output[uint2(Pos + int2(0, 1))] = RGBToLuma(RGB2);
+    g_Output[uint2(Pos + int2(1, 1))] = RGBToLuma(RGB3);
+
+    float3 AvgRGB = (RGB0 + RGB1 + RGB2 + RGB3) * 0.25;
+    float  Y      = dot(AvgRGB, float3(0.2126, 0.7152, 0.0722));
+    float  U      = (AvgRGB.b - Y) / 1.8556 * (224.0 / 255.0) + 128.0 / 255.0;
+    float  V      = (AvgRGB.r - Y) / 1.5748 * (224.0 / 255.0) + 128.0 / 255.0;
+
+    // The chroma plane starts right after the luma plane
+    uint LumaHeight = (Height + 1u) & ~1u;
+    g_Output[uint2(Pos.x + 0, LumaHeight + DTid.y)] = U;
+    g_Output[uint2(Pos.x + 1, LumaHeight + DTid.y)] = V;
+#else
+    if (DTid.x >= Width || DTid.y >= Height)
+        return;
+
+    g_Output[DTid.xy] = LoadSource(int2(DTid.xy), Dim);
+#endif
+}
+)";
+// clang-format on
+
+constexpr Uint32 ConvertGroupSize = 8;
+
+bool IsSRGBFormat(TEXTURE_FORMAT Format)
+{
+    return GetTextureFormatAttribs(Format).ComponentType == COMPONENT_TYPE_UNORM_SRGB;
+}
+
+// Returns the description of the texture that receives the frame in the given capture format
+TextureDesc GetFrameTextureDesc(const TextureDesc& SrcDesc, SCREEN_CAPTURE_FORMAT Format)
+{
+    TextureDesc Desc;
+    Desc.Type = RESOURCE_DIM_TEX_2D;
+    switch (Format)
+    {
+        case SCREEN_CAPTURE_FORMAT_NATIVE:
+            Desc.Width  = SrcDesc.Width;
+            Desc.Height = SrcDesc.Height;
+            Desc.Format = SrcDesc.Format;
+            break;
+
+        case SCREEN_CAPTURE_FORMAT_RGBA8:
+            Desc.Width  = SrcDesc.Width;
+            Desc.Height = SrcDesc.Height;
+            Desc.Format = TEX_FORMAT_RGBA8_UNORM;
+            break;
+
+        case SCREEN_CAPTURE_FORMAT_NV12:
+            // Luma plane followed by the half-height chroma plane
+            Desc.Width  = AlignUp(SrcDesc.Width, 2u);
+            Desc.Height = AlignUp(SrcDesc.Height, 2u) / 2 * 3;
+            Desc.Format = TEX_FORMAT_R8_UNORM;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected screen capture format");
+    }
+    return Desc;
+}
+
+bool IsCompatible(const TextureDesc& Desc1, const TextureDesc& Desc2)
+{
+    return Desc1.Width == Desc2.Width && Desc1.Height == Desc2.Height && Desc1.Format == Desc2.Format;
+}
+
+} // namespace
+
+ScreenCaptureRing::ScreenCaptureRing(const ScreenCaptureRingCreateInfo& CI) :
+    // clang-format off
+    m_pDevice        {CI.pDevice        },
+    m_Format         {CI.Format         },
+    m_WaitForFreeSlot{CI.WaitForFreeSlot},
+    m_OnFrameReady   {CI.OnFrameReady   },
+    m_Slots          (CI.RingDepth      )
+// clang-format on
+{
+    if (CI.pDevice == nullptr)
+        LOG_ERROR_AND_THROW("Render device must not be null");
+    if (CI.RingDepth == 0)
+        LOG_ERROR_AND_THROW("Ring depth must not be zero");
+    if (!CI.OnFrameReady)
+        LOG_ERROR_AND_THROW("Frame ready callback must not be null");
+
+    FenceDesc fenceDesc;
+    fenceDesc.Name = "Screen capture ring fence";
+    m_pDevice->CreateFence(fenceDesc, &m_pFence);
+    if (!m_pFence)
+        LOG_ERROR_AND_THROW("Failed to create screen capture ring fence");
+
+    if (m_Format == SCREEN_CAPTURE_FORMAT_NATIVE)
+        return;
+
+    if (!m_pDevice->GetDeviceInfo().Features.ComputeShaders)
+        LOG_ERROR_AND_THROW("Screen capture format conversion requires compute shaders");
+
+    // The conversion shader writes the frame through a storage image
+    const auto FrameFormat = m_Format == SCREEN_CAPTURE_FORMAT_NV12 ? TEX_FORMAT_R8_UNORM : TEX_FORMAT_RGBA8_UNORM;
+    if ((m_pDevice->GetTextureFormatInfoExt(FrameFormat).BindFlags & BIND_UNORDERED_ACCESS) == 0)
+    {
+        LOG_ERROR_AND_THROW("Screen capture format conversion requires unordered access support for ",
+                            GetTextureFormatAttribs(FrameFormat).Name, " format");
+    }
+
+    PipelineResourceDesc Resources[] =
+        {
+            {SHADER_TYPE_COMPUTE, "g_Source", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "g_Output", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE} //
+        };
+
+    PipelineResourceSignatureDesc SignDesc;
+    SignDesc.Name         = "Screen capture conversion signature";
+    SignDesc.Resources    = Resources;
+    SignDesc.NumResources = _countof(Resources);
+    m_pDevice->CreatePipelineResourceSignature(SignDesc, &m_pConvertSignature);
+    if (!m_pConvertSignature)
+        LOG_ERROR_AND_THROW("Failed to create screen capture conversion signature");
+
+    m_pConvertSignature->CreateShaderResourceBinding(&m_pConvertSRB, true);
+
+    for (Uint32 ConvertToSRGB = 0; ConvertToSRGB < 2; ++ConvertToSRGB)
+    {
+        ShaderMacroHelper Macros;
+        Macros.AddShaderMacro("CAPTURE_FORMAT_NV12", m_Format == SCREEN_CAPTURE_FORMAT_NV12);
+        Macros.AddShaderMacro("CONVERT_TO_SRGB", ConvertToSRGB != 0);
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.Desc.Name       = "Screen capture conversion CS";
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+        ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.Source          = ConvertCS;
+        ShaderCI.Macros          = Macros;
+
+        RefCntAutoPtr<IShader> pCS;
+        m_pDevice->CreateShader(ShaderCI, &pCS);
+        if (!pCS)
+            LOG_ERROR_AND_THROW("Failed to create screen capture conversion shader");
+
+        IPipelineResourceSignature* ppSignatures[] = {m_pConvertSignature};
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name            = ConvertToSRGB ? "Screen capture conversion PSO (sRGB source)" : "Screen capture conversion PSO";
+        PSOCreateInfo.PSODesc.PipelineType    = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.ppResourceSignatures    = ppSignatures;
+        PSOCreateInfo.ResourceSignaturesCount = _countof(ppSignatures);
+        PSOCreateInfo.pCS                     = pCS;
+        m_pDevice->CreateComputePipelineState(PSOCreateInfo, &m_pConvertPSO[ConvertToSRGB]);
+        if (!m_pConvertPSO[ConvertToSRGB])
+            LOG_ERROR_AND_THROW("Failed to create screen capture conversion PSO");
+    }
+}
+
+ScreenCaptureRing::~ScreenCaptureRing()
+{
+    if (m_NumPending > 0)
+    {
+        LOG_WARNING_MESSAGE("Destroying screen capture ring with ", m_NumPending,
+                            " pending capture(s). Call Flush() to deliver all captured frames.");
+    }
+}
+
+bool ScreenCaptureRing::Capture(ISwapChain* pSwapChain, IDeviceContext* pContext, Uint32 FrameId)
+{
+    VERIFY_EXPR(pSwapChain != nullptr);
+    auto* pCurrentRTV = pSwapChain->GetCurrentBackBufferRTV();
+    return Capture(pCurrentRTV->GetTexture(), pContext, FrameId);
+}
+
+bool ScreenCaptureRing::Capture(ITexture* pTexture, IDeviceContext* pContext, Uint32 FrameId)
+{
+    VERIFY_EXPR(pTexture != nullptr && pContext != nullptr);
+    DEV_CHECK_ERR(pTexture->GetDesc().SampleCount == 1, "Multisampled textures can't be captured");
+
+    // Return completed slots to the ring first
+    Poll(pContext);
+
+    if (m_NumPending == m_Slots.size())
+    {
+        if (!m_WaitForFreeSlot)
+        {
+            ++m_Stats.NumDropped;
+            return false;
+        }
+        WaitForOldestCapture(pContext);
+    }
+    VERIFY_EXPR(m_NumPending < m_Slots.size());
+
+    auto& S = m_Slots[(m_FirstPending + m_NumPending) % m_Slots.size()];
+
+    auto* pStagingTex = PrepareStagingTexture(S, pTexture->GetDesc());
+    if (pStagingTex == nullptr)
+        return false;
+
+    ITexture* pFrameTex = pTexture;
+    if (m_Format != SCREEN_CAPTURE_FORMAT_NATIVE)
+    {
+        if (!ConvertTexture(pTexture, pContext))
+            return false;
+        pFrameTex = m_pConvertedTex;
+    }
+
+    CopyTextureAttribs CopyAttribs{pFrameTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+    pContext->CopyTexture(CopyAttribs);
+    pContext->EnqueueSignal(m_pFence, m_NextFenceValue);
+
+    S.FenceValue  = m_NextFenceValue++;
+    S.FrameId     = FrameId;
+    S.CaptureTime = m_Timer.GetElapsedTime();
+
+    ++m_NumPending;
+    ++m_Stats.NumCaptured;
+
+    return true;
+}
+
+ITexture* ScreenCaptureRing::PrepareStagingTexture(Slot& S, const TextureDesc& SrcDesc)
+{
+    const auto FrameDesc = GetFrameTextureDesc(SrcDesc, m_Format);
+    if (S.pStagingTex && IsCompatible(S.pStagingTex->GetDesc(), FrameDesc))
+        return S.pStagingTex;
+
+    S.pStagingTex.Release();
+
+    auto TexDesc           = FrameDesc;
+    TexDesc.Name           = "Screen capture ring staging texture";
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    m_pDevice->CreateTexture(TexDesc, nullptr, &S.pStagingTex);
+    if (!S.pStagingTex)
+        LOG_ERROR_MESSAGE("Failed to create screen capture staging texture");
+
+    return S.pStagingTex;
+}
+
+ITexture* ScreenCaptureRing::PrepareConvertedTexture(const TextureDesc& SrcDesc)
+{
+    const auto FrameDesc = GetFrameTextureDesc(SrcDesc, m_Format);
+    if (m_pConvertedTex && IsCompatible(m_pConvertedTex->GetDesc(), FrameDesc))
+        return m_pConvertedTex;
+
+    m_pConvertedTex.Release();
+
+    auto TexDesc      = FrameDesc;
+    TexDesc.Name      = "Screen capture ring converted texture";
+    TexDesc.BindFlags = BIND_UNORDERED_ACCESS;
+    m_pDevice->CreateTexture(TexDesc, nullptr, &m_pConvertedTex);
+    if (!m_pConvertedTex)
+        LOG_ERROR_MESSAGE("Failed to create screen capture converted texture");
+
+    return m_pConvertedTex;
+}
+
+bool ScreenCaptureRing::ConvertTexture(ITexture* pSrcTex, IDeviceContext* pContext)
+{
+    const auto& SrcDesc = pSrcTex->GetDesc();
+
+    auto* pConvertedTex = PrepareConvertedTexture(SrcDesc);
+    if (pConvertedTex == nullptr)
+        return false;
+
+    auto* pSrcSRV = (SrcDesc.BindFlags & BIND_SHADER_RESOURCE) != 0 ?
+        pSrcTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE) :
+        nullptr;
+    if (pSrcSRV == nullptr)
+    {
+        // Swap chain back buffers are often not created with the shader resource bind flag,
+        // so copy the source into an intermediate texture that can be read by the shader.
+        if (!m_pSourceCopy || !IsCompatible(m_pSourceCopy->GetDesc(), SrcDesc))
+        {
+            m_pSourceCopy.Release();
+
+            TextureDesc TexDesc;
+            TexDesc.Name      = "Screen capture ring source copy";
+            TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+            TexDesc.Width     = SrcDesc.Width;
+            TexDesc.Height    = SrcDesc.Height;
+            TexDesc.Format    = SrcDesc.Format;
+            TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+            m_pDevice->CreateTexture(TexDesc, nullptr, &m_pSourceCopy);
+            if (!m_pSourceCopy)
+            {
+                LOG_ERROR_MESSAGE("Failed to create screen capture source copy texture");
+                return false;
+            }
+        }
+
+        CopyTextureAttribs CopyAttribs{pSrcTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, m_pSourceCopy, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        pContext->CopyTexture(CopyAttribs);
+        pSrcSRV = m_pSourceCopy->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    }
+
+    VERIFY_EXPR(pSrcSRV != nullptr);
+
+    m_pConvertSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Source")->Set(pSrcSRV);
+    m_pConvertSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->Set(pConvertedTex->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
+
+    pContext->SetPipelineState(m_pConvertPSO[IsSRGBFormat(SrcDesc.Format) ? 1 : 0]);
+    pContext->CommitShaderResources(m_pConvertSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    // Every NV12 thread processes a 2x2 pixel block
+    const auto ThreadsX = m_Format == SCREEN_CAPTURE_FORMAT_NV12 ? (SrcDesc.Width + 1) / 2 : SrcDesc.Width;
+    const auto ThreadsY = m_Format == SCREEN_CAPTURE_FORMAT_NV12 ? (SrcDesc.Height + 1) / 2 : SrcDesc.Height;
+
+    DispatchComputeAttribs DispatchAttribs{
+        (ThreadsX + ConvertGroupSize - 1) / ConvertGroupSize,
+        (ThreadsY + ConvertGroupSize - 1) / ConvertGroupSize,
+    };
+    pContext->DispatchCompute(DispatchAttribs);
+
+    return true;
+}
+
+Uint32 ScreenCaptureRing::Poll(IDeviceContext* pContext)
+{
+    VERIFY_EXPR(pContext != nullptr);
+
+    Uint32 NumDelivered = 0;
+    if (m_NumPending == 0)
+        return NumDelivered;
+
+    const auto CompletedFenceValue = m_pFence->GetCompletedValue();
+    while (m_NumPending > 0)
+    {
+        auto& S = m_Slots[m_FirstPending];
+        if (S.FenceValue > CompletedFenceValue)
+            break;
+
+        // The GPU is done with the texture, so the staging memory is mapped directly
+        // and handed to the callback without copying.
+        MappedTextureSubresource MappedData;
+        pContext->MapTextureSubresource(S.pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+        if (MappedData.pData == nullptr)
+        {
+            // D3D11 may still report the texture as busy
+            break;
+        }
+
+        const auto& TexDesc = S.pStagingTex->GetDesc();
+
+        ScreenCaptureFrame Frame;
+        Frame.Id        = S.FrameId;
+        Frame.Width     = TexDesc.Width;
+        Frame.Height    = TexDesc.Height;
+        Frame.Format    = m_Format;
+        Frame.TexFormat = TexDesc.Format;
+        Frame.pData     = MappedData.pData;
+        Frame.Stride    = MappedData.Stride;
+        Frame.Latency   = m_Timer.GetElapsedTime() - S.CaptureTime;
+        if (m_Format == SCREEN_CAPTURE_FORMAT_NV12)
+        {
+            Frame.Height      = TexDesc.Height / 3 * 2;
+            Frame.pChromaData = static_cast<const Uint8*>(MappedData.pData) + MappedData.Stride * Frame.Height;
+        }
+
+        m_OnFrameReady(Frame);
+
+        pContext->UnmapTextureSubresource(S.pStagingTex, 0, 0);
+
+        ++m_Stats.NumDelivered;
+        m_Stats.BytesDelivered += Uint64{TexDesc.Width} * TexDesc.Height * GetTextureFormatAttribs(TexDesc.Format).GetElementSize();
+        m_TotalLatency += Frame.Latency;
+
+        m_FirstPending = (m_FirstPending + 1) % static_cast<Uint32>(m_Slots.size());
+        --m_NumPending;
+        ++NumDelivered;
+    }
+
+    return NumDelivered;
+}
+
+void ScreenCaptureRing::WaitForOldestCapture(IDeviceContext* pContext)
+{
+    VERIFY_EXPR(m_NumPending > 0);
+    const auto& S = m_Slots[m_FirstPending];
+
+    // Signal commands are only submitted to the GPU when the context is flushed
+    pContext->Flush();
+    m_pFence->Wait(S.FenceValue);
+    Poll(pContext);
+}
+
+void ScreenCaptureRing::Flush(IDeviceContext* pContext)
+{
+    while (m_NumPending > 0)
+    {
+        const auto NumPending = m_NumPending;
+        WaitForOldestCapture(pContext);
+        if (m_NumPending == NumPending)
+        {
+            LOG_ERROR_MESSAGE("Failed to map screen capture staging texture");
+            break;
+        }
+    }
+}
+
+ScreenCaptureStats ScreenCaptureRing::GetStats() const
+{
+    auto Stats = m_Stats;
+    if (Stats.NumDelivered > 0)
+        Stats.AvgLatency = m_TotalLatency / static_cast<double>(Stats.NumDelivered);
+
+    const auto ElapsedTime = m_Timer.GetElapsedTime() - m_StatsStartTime;
+    if (ElapsedTime > 0)
+    {
+        Stats.FramesPerSecond = static_cast<double>(Stats.NumDelivered) / ElapsedTime;
+        Stats.BytesPerSecond  = static_cast<double>(Stats.BytesDelivered) / ElapsedTime;
+    }
+    return Stats;
+}
+
+void ScreenCaptureRing::ResetStats()
+{
+    m_Stats          = {};
+    m_TotalLatency   = 0;
+    m_StatsStartTime = m_Timer.GetElapsedTime();
+}
+
+} // namespace Diligent
@@ -32,6 +32,9 @@
 #include <unordered_map>
 #include <vector>
 #include <array>
+#include <memory>
+#include <mutex>
+#include <atomic>
 
 #include "HLSL2GLSLConverter.h"
 #include "ObjectBase.hpp"
@@ -40,6 +43,7 @@
 #include "HashUtils.hpp"
 #include "HLSLKeywords.h"
 #include "Constants.h"
+#include "STDAllocator.hpp"
 
 namespace Diligent
 {
@@ -135,6 +139,10 @@ public:
         /// This requires separate shader objects extension:
         /// https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_separate_shader_objects.txt
         bool                                UseInOutLocationQualifiers = true;
+
+        /// Whether to allocate token list nodes from the node pool. Disabling the pool
+        /// is only intended for testing. Ignored when ppConversionStream is not null.
+        bool                                UseTokenPool               = true;
     };
 
     // clang-format on
@@ -163,9 +171,110 @@ public:
                       size_t                           NumSymbols,
                       IHLSL2GLSLConversionStream**     ppStream) const;
 
+    /// Sets the maximum size of the conversion cache, see IHLSL2GLSLConverter::SetConversionCacheSize.
+    void SetConversionCacheSize(size_t MaxSize) const;
+
+    /// Removes all entries from the conversion cache.
+    void ClearConversionCache() const;
+
+    /// Returns the conversion cache statistics.
+    void GetConversionCacheStats(HLSL2GLSLConversionCacheStats& Stats) const;
+
 private:
     HLSL2GLSLConverterImpl();
 
+    // Thread-safe LRU cache of the converted GLSL sources.
+    // The GLSL definitions are not stored in the cache and are added when the source is retrieved.
+    class ConversionCache
+    {
+    public:
+        struct Key
+        {
+            // HLSL source with all includes expanded. The source is compared
+            // on lookup, so hash collisions never return a wrong result.
+            std::shared_ptr<const String> pSource;
+
+            // Hash of the source
+            size_t      SourceHash;
+            String      EntryPoint;
+            String      SamplerSuffix;
+            SHADER_TYPE ShaderType;
+            bool        UseInOutLocationQualifiers;
+
+            Key(std::shared_ptr<const String> _pSource,
+                size_t                        _SourceHash,
+                const Char*                   _EntryPoint,
+                const Char*                   _SamplerSuffix,
+                SHADER_TYPE                   _ShaderType,
+                bool                          _UseInOutLocationQualifiers);
+
+            bool operator==(const Key& rhs) const;
+
+            struct Hasher
+            {
+                size_t operator()(const Key& CacheKey) const;
+            };
+        };
+
+        using GLSLSourcePtrType = std::shared_ptr<const String>;
+
+        bool IsEnabled() const
+        {
+            return m_MaxSize.load() != 0;
+        }
+
+        // Returns null if the key is not found
+        GLSLSourcePtrType Find(const Key& CacheKey);
+
+        // If another thread has already added the same key, returns the existing entry
+        GLSLSourcePtrType Add(Key&& CacheKey, String&& GLSLSource);
+
+        void SetMaxSize(size_t MaxSize);
+        void Clear();
+        void GetStats(HLSL2GLSLConversionCacheStats& Stats);
+
+    private:
+        // m_Mtx must be locked
+        void EvictEntries();
+
+        static constexpr size_t DefaultMaxSize = size_t{32} << 20;
+
+        using LRUListType = std::list<const Key*>;
+        struct CacheEntry
+        {
+            GLSLSourcePtrType     pGLSLSource;
+            size_t                Size;
+            LRUListType::iterator LRUPos;
+        };
+
+        std::mutex m_Mtx;
+
+        std::unordered_map<Key, CacheEntry, Key::Hasher> m_Entries;
+
+        // Most recently used entries are in the front of the list
+        LRUListType m_LRUList;
+
+        std::atomic<size_t> m_MaxSize{DefaultMaxSize};
+
+        size_t m_Size         = 0;
+        Uint32 m_NumHits      = 0;
+        Uint32 m_NumMisses    = 0;
+        Uint32 m_NumEvictions = 0;
+    };
+
+    // Converts the source using the conversion cache. The handler is only called
+    // when the result is not found in the cache, and must return the converted
+    // GLSL source with or without the GLSL definitions, as requested by its argument.
+    template <typename TConversionHandler>
+    String ConvertWithCache(const std::shared_ptr<const String>& pSource,
+                            size_t                               SourceHash,
+                            const Char*                          EntryPoint,
+                            SHADER_TYPE                          ShaderType,
+                            bool                                 IncludeDefintions,
+                            const char*                          SamplerSuffix,
+                            bool                                 UseInOutLocationQualifiers,
+                            TConversionHandler                   ConversionHandler) const;
+
     struct HLSLObjectInfo
     {
         const String GLSLType; // sampler2D, sampler2DShadow, image2D, etc.
@@ -276,7 +385,55 @@ private:
             Delimiter{_Delimiter}
         {}
     };
-    typedef std::list<TokenInfo> TokenListType;
+
+    // Token list nodes are allocated from a pool owned by the conversion stream rather than
+    // from the heap: converting a large shader creates and destroys hundreds of thousands of nodes.
+    // The pool serves fixed-size blocks from large pages and recycles released blocks through
+    // a free list. It is not thread-safe and must outlive all lists that use it.
+    // Requests larger than the block size are served from the heap. The pool created with
+    // zero block size allocates all nodes from the heap.
+    class TokenNodePool
+    {
+    public:
+        explicit TokenNodePool(size_t BlockSize) noexcept;
+
+        // clang-format off
+        TokenNodePool           (const TokenNodePool&)  = delete;
+        TokenNodePool           (TokenNodePool&&)       = delete;
+        TokenNodePool& operator=(const TokenNodePool&)  = delete;
+        TokenNodePool& operator=(TokenNodePool&&)       = delete;
+        // clang-format on
+
+        void* Allocate(size_t Size, const Char* dbgDescription, const Char* dbgFileName, const Int32 dbgLineNumber);
+        void  Free(void* Ptr);
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* pNext;
+        };
+
+        static constexpr size_t MinBlocksPerPage = 256;
+        static constexpr size_t MaxBlocksPerPage = 8192;
+
+        const size_t m_BlockSize;
+
+        size_t     m_BlocksPerPage = MinBlocksPerPage;
+        FreeBlock* m_pFreeList     = nullptr;
+        Uint8*     m_pCurrPos      = nullptr;
+        Uint8*     m_pPageEnd      = nullptr;
+
+        std::vector<std::unique_ptr<Uint8[]>> m_Pages;
+
+        // Blocks that did not fit into the pool and were allocated from the heap
+        std::unordered_set<void*> m_HeapAllocations;
+    };
+    typedef std::list<TokenInfo, STDAllocator<TokenInfo, TokenNodePool>> TokenListType;
+
+    // The size of the list node: the token and two links. The pool block size is derived from
+    // this value rather than from the first allocation as the list may also allocate smaller
+    // helper objects through the same allocator (e.g. container proxies in MSVC debug builds).
+    static constexpr size_t TokenListNodeSize = sizeof(TokenInfo) + 2 * sizeof(void*);
 
 
     class ConversionStream : public ObjectBase<IHLSL2GLSLConversionStream>
@@ -307,12 +464,39 @@ private:
                          size_t                           NumSymbols,
                          bool                             bPreserveTokens);
 
+        /// Creates a conversion stream from the source that has all includes expanded by LoadSource().
+        ConversionStream(IReferenceCounters*           pRefCounters,
+                         const HLSL2GLSLConverterImpl& Converter,
+                         const char*                   InputFileName,
+                         std::shared_ptr<const String> pSource,
+                         bool                          bPreserveTokens,
+                         bool                          UseTokenPool = true);
+
+        /// Creates a single-use copy of the stream that preserves tokens.
+        ConversionStream(IReferenceCounters* pRefCounters, const ConversionStream& Stream);
+
+        /// Loads the shader source and expands all includes.
+        static String LoadSource(const char*                      InputFileName,
+                                 IShaderSourceInputStreamFactory* pInputStreamFactory,
+                                 const Char*                      HLSLSource,
+                                 size_t                           NumSymbols);
+
+        /// Converts the stream using the conversion cache. Streams that preserve tokens
+        /// may be used by multiple threads simultaneously.
         String Convert(const Char* EntryPoint,
                        SHADER_TYPE ShaderType,
                        bool        IncludeDefintions,
                        const char* SamplerSuffix,
                        bool        UseInOutLocationQualifiers);
 
+        /// Converts the tokens without using the cache. If the stream does not preserve
+        /// tokens, it can only be converted once.
+        String ConvertTokens(const Char* EntryPoint,
+                             SHADER_TYPE ShaderType,
+                             bool        IncludeDefintions,
+                             const char* SamplerSuffix,
+                             bool        UseInOutLocationQualifiers);
+
         virtual void DILIGENT_CALL_TYPE Convert(const Char* EntryPoint,
                                                 SHADER_TYPE ShaderType,
                                                 bool        IncludeDefintions,
@@ -325,8 +509,14 @@ private:
         const String& GetInputFileName() const { return m_InputFileName; }
 
     private:
-        void InsertIncludes(String& GLSLSource, IShaderSourceInputStreamFactory* pSourceStreamFactory);
-        void Tokenize(const String& Source);
+        String ConvertImpl(const Char* EntryPoint,
+                           SHADER_TYPE ShaderType,
+                           bool        IncludeDefintions,
+                           const char* SamplerSuffix,
+                           bool        UseInOutLocationQualifiers);
+
+        static void InsertIncludes(String& GLSLSource, IShaderSourceInputStreamFactory* pSourceStreamFactory);
+        void        Tokenize(const String& Source);
 
         typedef std::unordered_map<String, bool> SamplerHashType;
 
@@ -508,11 +698,22 @@ private:
                                           const String&            OutStreamName,
                                           const char*              EntryPoint);
 
-        String BuildGLSLSource();
+        String BuildGLSLSource(bool IncludeDefintions);
+
+        // Pool that allocates token list nodes. Must be declared before
+        // the lists so that it is destroyed after them.
+        TokenNodePool m_TokenPool;
 
         // Tokenized source code
         TokenListType m_Tokens;
 
+        // Original tokens of the stream that preserves tokens. This list is never
+        // modified after the stream is created; every conversion works on a copy.
+        TokenListType m_OriginalTokens;
+
+        // Protects m_Tokens and other conversion state of the stream that preserves tokens
+        std::mutex m_ConversionMtx;
+
         // List of tokens defining structs
         std::unordered_map<HashMapStringKey, TokenListType::iterator, HashMapStringKey::Hasher> m_StructDefinitions;
 
@@ -532,6 +733,10 @@ private:
         // This member is only used to compare input name
         // when subsequent shaders are converted from already tokenized source
         const String m_InputFileName;
+
+        // Source with all includes expanded and its hash, used as the conversion cache key
+        const std::shared_ptr<const String> m_pSource;
+        const size_t                        m_SourceHash;
     };
 
     // HLSL keyword->token info hash map
@@ -552,6 +757,10 @@ private:
     static constexpr int MaxShaderStages = 6; // Maximum supported shader stages: VS, GS, PS, DS, HS, CS
 
     std::array<std::array<std::unordered_map<HashMapStringKey, String, HashMapStringKey::Hasher>, 2>, MaxShaderStages> m_HLSLSemanticToGLSLVar;
+
+    // The cache is internally synchronized and does not affect the conversion results,
+    // so it may be modified through the const converter instance.
+    mutable ConversionCache m_ConversionCache;
 };
 
 } // namespace Diligent
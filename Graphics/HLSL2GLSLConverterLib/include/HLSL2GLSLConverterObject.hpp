@@ -50,6 +50,12 @@ public:
                                                  const Char*                      HLSLSource,
                                                  size_t                           NumSymbols,
                                                  IHLSL2GLSLConversionStream**     ppStream) const override;
+
+    virtual void DILIGENT_CALL_TYPE SetConversionCacheSize(size_t MaxSize) override;
+
+    virtual void DILIGENT_CALL_TYPE ClearConversionCache() override;
+
+    virtual void DILIGENT_CALL_TYPE GetConversionCacheStats(HLSL2GLSLConversionCacheStats& Stats) const override;
 };
 
 } // namespace Diligent
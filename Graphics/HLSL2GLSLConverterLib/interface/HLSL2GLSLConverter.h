@@ -74,6 +74,34 @@ DILIGENT_END_INTERFACE
 #endif
 
 
+/// HLSL to GLSL conversion cache statistics
+struct HLSL2GLSLConversionCacheStats
+{
+    // clang-format off
+
+    /// The number of conversions whose result was found in the cache.
+    Uint32 NumHits      DEFAULT_INITIALIZER(0);
+
+    /// The number of conversions whose result was not found in the cache.
+    Uint32 NumMisses    DEFAULT_INITIALIZER(0);
+
+    /// The number of entries that were evicted to keep the cache size within the limit.
+    Uint32 NumEvictions DEFAULT_INITIALIZER(0);
+
+    /// The number of entries currently in the cache.
+    Uint32 NumEntries   DEFAULT_INITIALIZER(0);
+
+    /// The total size of the cached data, in bytes.
+    Uint64 Size         DEFAULT_INITIALIZER(0);
+
+    /// The maximum cache size, in bytes.
+    Uint64 MaxSize      DEFAULT_INITIALIZER(0);
+
+    // clang-format on
+};
+typedef struct HLSL2GLSLConversionCacheStats HLSL2GLSLConversionCacheStats;
+
+
 // {44A21160-77E0-4DDC-A57E-B8B8B65B5342}
 static const INTERFACE_ID IID_HLSL2GLSLConverter =
     {0x44a21160, 0x77e0, 0x4ddc, {0xa5, 0x7e, 0xb8, 0xb8, 0xb6, 0x5b, 0x53, 0x42}};
@@ -96,6 +124,29 @@ DILIGENT_BEGIN_INTERFACE(IHLSL2GLSLConverter, IObject)
                                       const Char*                      HLSLSource,
                                       size_t                           NumSymbols,
                                       IHLSL2GLSLConversionStream**     ppStream) CONST PURE;
+
+    /// Sets the maximum size of the conversion cache
+
+    /// \param [in] MaxSize - Maximum total size of the cached data, in bytes.
+    ///                       Zero disables the cache.
+    ///
+    /// \remarks   The converter keeps the results of recent conversions in a process-wide
+    ///            cache shared by all converter objects and shaders created by the OpenGL
+    ///            backend. The results are keyed by the HLSL source with all includes expanded,
+    ///            the entry point, the shader type and the conversion options. Shader macros are
+    ///            not part of the key as they are not processed by the converter, so
+    ///            permutations that only differ by macros share the same entry.
+    ///            When the size limit is exceeded, least recently used entries are evicted.
+    ///            The cache is thread-safe.
+    VIRTUAL void METHOD(SetConversionCacheSize)(THIS_
+                                                size_t MaxSize) PURE;
+
+    /// Removes all entries from the conversion cache
+    VIRTUAL void METHOD(ClearConversionCache)(THIS) PURE;
+
+    /// Returns the conversion cache statistics
+    VIRTUAL void METHOD(GetConversionCacheStats)(THIS_
+                                                 HLSL2GLSLConversionCacheStats REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -105,7 +156,10 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IHLSL2GLSLConverter_CreateStream(This, ...) CALL_IFACE_METHOD(HLSL2GLSLConverter, CreateStream, This, __VA_ARGS__)
+#    define IHLSL2GLSLConverter_CreateStream(This, ...)            CALL_IFACE_METHOD(HLSL2GLSLConverter, CreateStream,            This, __VA_ARGS__)
+#    define IHLSL2GLSLConverter_SetConversionCacheSize(This, ...)  CALL_IFACE_METHOD(HLSL2GLSLConverter, SetConversionCacheSize,  This, __VA_ARGS__)
+#    define IHLSL2GLSLConverter_ClearConversionCache(This)         CALL_IFACE_METHOD(HLSL2GLSLConverter, ClearConversionCache,    This)
+#    define IHLSL2GLSLConverter_GetConversionCacheStats(This, ...) CALL_IFACE_METHOD(HLSL2GLSLConverter, GetConversionCacheStats, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -363,6 +363,7 @@
 #include "StringDataBlobImpl.hpp"
 #include "StringTools.hpp"
 #include "EngineMemory.h"
+#include "Align.hpp"
 
 using namespace std;
 
@@ -1133,7 +1134,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::Tokenize(const String& Source)
 
     // Push empty node in the beginning of the list to facilitate
     // backwards searching
-    m_Tokens.push_back(TokenInfo());
+    m_Tokens.emplace_back();
 
     // https://msdn.microsoft.com/en-us/library/windows/desktop/bb509638(v=vs.85).aspx
 
@@ -1366,7 +1367,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::Tokenize(const String& Source)
             }
         }
 
-        m_Tokens.push_back(NewToken);
+        m_Tokens.push_back(std::move(NewToken));
     }
 #undef CHECK_END
 }
@@ -4791,17 +4792,80 @@ void HLSL2GLSLConverterImpl::ConversionStream::RemoveSpecialShaderAttributes()
     );
 }
 
-String HLSL2GLSLConverterImpl::ConversionStream::BuildGLSLSource()
+String HLSL2GLSLConverterImpl::ConversionStream::BuildGLSLSource(bool IncludeDefintions)
 {
+    // Compute the exact output size first to build the source in a single allocation
+    const size_t DefinitionsLen = IncludeDefintions ? strlen(g_GLSLDefinitions) : 0;
+
+    size_t OutputSize = DefinitionsLen;
+    for (const auto& Token : m_Tokens)
+        OutputSize += Token.Delimiter.length() + Token.Literal.length();
+
     String Output;
+    Output.reserve(OutputSize);
+    if (IncludeDefintions)
+        Output.append(g_GLSLDefinitions, DefinitionsLen);
     for (const auto& Token : m_Tokens)
     {
         Output.append(Token.Delimiter);
         Output.append(Token.Literal);
     }
+    VERIFY_EXPR(Output.length() == OutputSize);
     return Output;
 }
 
+HLSL2GLSLConverterImpl::TokenNodePool::TokenNodePool(size_t BlockSize) noexcept :
+    m_BlockSize{BlockSize != 0 ? AlignUp(std::max(BlockSize, sizeof(FreeBlock)), alignof(std::max_align_t)) : 0}
+{
+}
+
+void* HLSL2GLSLConverterImpl::TokenNodePool::Allocate(size_t Size, const Char* dbgDescription, const Char* dbgFileName, const Int32 dbgLineNumber)
+{
+    if (Size > m_BlockSize)
+    {
+        // The pool is disabled, or the standard library allocates a node that is larger than expected
+        auto* Ptr = GetRawAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+        if (m_BlockSize != 0)
+            m_HeapAllocations.insert(Ptr);
+        return Ptr;
+    }
+
+    if (m_pFreeList != nullptr)
+    {
+        auto* pBlock = m_pFreeList;
+        m_pFreeList  = m_pFreeList->pNext;
+        return pBlock;
+    }
+
+    if (m_pCurrPos == m_pPageEnd)
+    {
+        const auto PageSize = m_BlockSize * m_BlocksPerPage;
+        m_Pages.emplace_back(new Uint8[PageSize]);
+        m_pCurrPos      = m_Pages.back().get();
+        m_pPageEnd      = m_pCurrPos + PageSize;
+        if (m_BlocksPerPage < MaxBlocksPerPage)
+            m_BlocksPerPage *= 2;
+    }
+
+    auto* pBlock = m_pCurrPos;
+    m_pCurrPos += m_BlockSize;
+    return pBlock;
+}
+
+void HLSL2GLSLConverterImpl::TokenNodePool::Free(void* Ptr)
+{
+    if (m_BlockSize == 0 || (!m_HeapAllocations.empty() && m_HeapAllocations.erase(Ptr) != 0))
+    {
+        GetRawAllocator().Free(Ptr);
+        return;
+    }
+
+    // Pool memory is only released when the pool is destroyed
+    auto* pBlock = reinterpret_cast<FreeBlock*>(Ptr);
+    pBlock->pNext = m_pFreeList;
+    m_pFreeList   = pBlock;
+}
+
 HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*              pRefCounters,
                                                            const HLSL2GLSLConverterImpl&    Converter,
                                                            const char*                      InputFileName,
@@ -4809,12 +4873,62 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
                                                            const Char*                      HLSLSource,
                                                            size_t                           NumSymbols,
                                                            bool                             bPreserveTokens) :
+    ConversionStream{pRefCounters, Converter, InputFileName, std::make_shared<const String>(LoadSource(InputFileName, pInputStreamFactory, HLSLSource, NumSymbols)), bPreserveTokens}
+{
+}
+
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*           pRefCounters,
+                                                           const HLSL2GLSLConverterImpl& Converter,
+                                                           const char*                   InputFileName,
+                                                           std::shared_ptr<const String> pSource,
+                                                           bool                          bPreserveTokens,
+                                                           bool                          UseTokenPool) :
     // clang-format off
     TBase            {pRefCounters   },
+    m_TokenPool      {UseTokenPool ? TokenListNodeSize : 0},
+    m_Tokens         {STD_ALLOCATOR(TokenInfo, TokenNodePool, m_TokenPool, "Allocator for TokenListType")},
+    m_OriginalTokens {m_Tokens.get_allocator()},
     m_bPreserveTokens{bPreserveTokens},
     m_Converter      {Converter      },
-    m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"}
+    m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"},
+    m_pSource        {std::move(pSource)},
+    m_SourceHash     {ComputeHashRaw(m_pSource->data(), m_pSource->size())}
 // clang-format on
+{
+    Tokenize(*m_pSource);
+
+    if (m_bPreserveTokens)
+    {
+        // Both lists use the same pool, so swapping them does not allocate
+        m_OriginalTokens.swap(m_Tokens);
+    }
+}
+
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters* pRefCounters, const ConversionStream& Stream) :
+    // clang-format off
+    TBase            {pRefCounters},
+    m_TokenPool      {TokenListNodeSize},
+    m_Tokens
+    {
+        Stream.m_OriginalTokens.begin(),
+        Stream.m_OriginalTokens.end(),
+        STD_ALLOCATOR(TokenInfo, TokenNodePool, m_TokenPool, "Allocator for TokenListType")
+    },
+    m_OriginalTokens {m_Tokens.get_allocator()},
+    m_bPreserveTokens{false                   },
+    m_Converter      {Stream.m_Converter      },
+    m_InputFileName  {Stream.m_InputFileName  },
+    m_pSource        {Stream.m_pSource        },
+    m_SourceHash     {Stream.m_SourceHash     }
+// clang-format on
+{
+    VERIFY(Stream.m_bPreserveTokens, "Only streams that preserve tokens can be copied");
+}
+
+String HLSL2GLSLConverterImpl::ConversionStream::LoadSource(const char*                      InputFileName,
+                                                            IShaderSourceInputStreamFactory* pInputStreamFactory,
+                                                            const Char*                      HLSLSource,
+                                                            size_t                           NumSymbols)
 {
     RefCntAutoPtr<IDataBlob> pFileData;
     if (HLSLSource == nullptr)
@@ -4840,7 +4954,171 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
 
     InsertIncludes(Source, pInputStreamFactory);
 
-    Tokenize(Source);
+    return Source;
+}
+
+
+HLSL2GLSLConverterImpl::ConversionCache::Key::Key(std::shared_ptr<const String> _pSource,
+                                                  size_t                        _SourceHash,
+                                                  const Char*                   _EntryPoint,
+                                                  const Char*                   _SamplerSuffix,
+                                                  SHADER_TYPE                   _ShaderType,
+                                                  bool                          _UseInOutLocationQualifiers) :
+    // clang-format off
+    pSource                   {std::move(_pSource)},
+    SourceHash                {_SourceHash},
+    EntryPoint                {_EntryPoint    != nullptr ? _EntryPoint    : ""},
+    SamplerSuffix             {_SamplerSuffix != nullptr ? _SamplerSuffix : ""},
+    ShaderType                {_ShaderType                },
+    UseInOutLocationQualifiers{_UseInOutLocationQualifiers}
+// clang-format on
+{
+}
+
+bool HLSL2GLSLConverterImpl::ConversionCache::Key::operator==(const Key& rhs) const
+{
+    // clang-format off
+    return SourceHash                 == rhs.SourceHash    &&
+           ShaderType                 == rhs.ShaderType    &&
+           UseInOutLocationQualifiers == rhs.UseInOutLocationQualifiers &&
+           EntryPoint                 == rhs.EntryPoint    &&
+           SamplerSuffix              == rhs.SamplerSuffix &&
+           (pSource == rhs.pSource || *pSource == *rhs.pSource);
+    // clang-format on
+}
+
+size_t HLSL2GLSLConverterImpl::ConversionCache::Key::Hasher::operator()(const Key& CacheKey) const
+{
+    return ComputeHash(CacheKey.SourceHash, CacheKey.EntryPoint, CacheKey.SamplerSuffix, static_cast<Uint32>(CacheKey.ShaderType), CacheKey.UseInOutLocationQualifiers);
+}
+
+HLSL2GLSLConverterImpl::ConversionCache::GLSLSourcePtrType HLSL2GLSLConverterImpl::ConversionCache::Find(const Key& CacheKey)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto it = m_Entries.find(CacheKey);
+    if (it == m_Entries.end())
+    {
+        ++m_NumMisses;
+        return nullptr;
+    }
+
+    ++m_NumHits;
+    // Move the entry to the front of the LRU list
+    m_LRUList.splice(m_LRUList.begin(), m_LRUList, it->second.LRUPos);
+    return it->second.pGLSLSource;
+}
+
+HLSL2GLSLConverterImpl::ConversionCache::GLSLSourcePtrType HLSL2GLSLConverterImpl::ConversionCache::Add(Key&& CacheKey, String&& GLSLSource)
+{
+    // The source may be shared with the conversion stream, but is counted as if it was owned by the cache
+    const auto EntrySize = sizeof(CacheEntry) + CacheKey.pSource->length() + CacheKey.EntryPoint.length() + CacheKey.SamplerSuffix.length() + GLSLSource.length();
+
+    auto pGLSLSource = std::make_shared<const String>(std::move(GLSLSource));
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto it_inserted = m_Entries.emplace(std::move(CacheKey), CacheEntry{pGLSLSource, EntrySize, {}});
+    auto it          = it_inserted.first;
+    if (!it_inserted.second)
+    {
+        // The same source has been converted by another thread
+        return it->second.pGLSLSource;
+    }
+
+    m_LRUList.push_front(&it->first);
+    it->second.LRUPos = m_LRUList.begin();
+    m_Size += EntrySize;
+
+    EvictEntries();
+
+    return pGLSLSource;
+}
+
+void HLSL2GLSLConverterImpl::ConversionCache::EvictEntries()
+{
+    const auto MaxSize = m_MaxSize.load();
+    while (m_Size > MaxSize && !m_LRUList.empty())
+    {
+        auto it = m_Entries.find(*m_LRUList.back());
+        VERIFY_EXPR(it != m_Entries.end());
+        m_Size -= it->second.Size;
+        m_LRUList.pop_back();
+        m_Entries.erase(it);
+        ++m_NumEvictions;
+    }
+}
+
+void HLSL2GLSLConverterImpl::ConversionCache::SetMaxSize(size_t MaxSize)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_MaxSize.store(MaxSize);
+    EvictEntries();
+}
+
+void HLSL2GLSLConverterImpl::ConversionCache::Clear()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_LRUList.clear();
+    m_Entries.clear();
+    m_Size = 0;
+}
+
+void HLSL2GLSLConverterImpl::ConversionCache::GetStats(HLSL2GLSLConversionCacheStats& Stats)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    Stats.NumHits      = m_NumHits;
+    Stats.NumMisses    = m_NumMisses;
+    Stats.NumEvictions = m_NumEvictions;
+    Stats.NumEntries   = static_cast<Uint32>(m_Entries.size());
+    Stats.Size         = m_Size;
+    Stats.MaxSize      = m_MaxSize.load();
+}
+
+void HLSL2GLSLConverterImpl::SetConversionCacheSize(size_t MaxSize) const
+{
+    m_ConversionCache.SetMaxSize(MaxSize);
+}
+
+void HLSL2GLSLConverterImpl::ClearConversionCache() const
+{
+    m_ConversionCache.Clear();
+}
+
+void HLSL2GLSLConverterImpl::GetConversionCacheStats(HLSL2GLSLConversionCacheStats& Stats) const
+{
+    m_ConversionCache.GetStats(Stats);
+}
+
+template <typename TConversionHandler>
+String HLSL2GLSLConverterImpl::ConvertWithCache(const std::shared_ptr<const String>& pSource,
+                                                size_t                               SourceHash,
+                                                const Char*                          EntryPoint,
+                                                SHADER_TYPE                          ShaderType,
+                                                bool                                 IncludeDefintions,
+                                                const char*                          SamplerSuffix,
+                                                bool                                 UseInOutLocationQualifiers,
+                                                TConversionHandler                   ConversionHandler) const
+{
+    if (!m_ConversionCache.IsEnabled())
+        return ConversionHandler(IncludeDefintions);
+
+    ConversionCache::Key CacheKey{pSource, SourceHash, EntryPoint, SamplerSuffix, ShaderType, UseInOutLocationQualifiers};
+
+    auto pGLSLSource = m_ConversionCache.Find(CacheKey);
+    if (!pGLSLSource)
+        pGLSLSource = m_ConversionCache.Add(std::move(CacheKey), ConversionHandler(false));
+
+    if (!IncludeDefintions)
+        return *pGLSLSource;
+
+    const size_t DefinitionsLen = strlen(g_GLSLDefinitions);
+
+    String GLSLSource;
+    GLSLSource.reserve(DefinitionsLen + pGLSLSource->length());
+    GLSLSource.append(g_GLSLDefinitions, DefinitionsLen);
+    GLSLSource.append(*pGLSLSource);
+    return GLSLSource;
 }
 
 
@@ -4850,8 +5128,15 @@ String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
     {
         try
         {
-            ConversionStream Stream(nullptr, *this, Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols, false);
-            return Stream.Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions, Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers);
+            // Expand includes before the source is tokenized so that the
+            // conversion cache can be queried without parsing the shader.
+            auto       pSource    = std::make_shared<const String>(ConversionStream::LoadSource(Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols));
+            const auto SourceHash = ComputeHashRaw(pSource->data(), pSource->size());
+            return ConvertWithCache(pSource, SourceHash, Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions, Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
+                                    [&](bool IncludeDefintions) {
+                                        ConversionStream Stream(nullptr, *this, Attribs.InputFileName, pSource, false, Attribs.UseTokenPool);
+                                        return Stream.ConvertTokens(Attribs.EntryPoint, Attribs.ShaderType, IncludeDefintions, Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers);
+                                    });
         }
         catch (std::runtime_error&)
         {
@@ -4925,9 +5210,56 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
                                                          bool        IncludeDefintions,
                                                          const char* SamplerSuffix,
                                                          bool        UseInOutLocationQualifiers)
+{
+    return m_Converter.ConvertWithCache(m_pSource, m_SourceHash, EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers,
+                                        [&](bool _IncludeDefintions) {
+                                            return ConvertTokens(EntryPoint, ShaderType, _IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers);
+                                        });
+}
+
+String HLSL2GLSLConverterImpl::ConversionStream::ConvertTokens(const Char* EntryPoint,
+                                                               SHADER_TYPE ShaderType,
+                                                               bool        IncludeDefintions,
+                                                               const char* SamplerSuffix,
+                                                               bool        UseInOutLocationQualifiers)
+{
+    if (!m_bPreserveTokens)
+        return ConvertImpl(EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers);
+
+    std::unique_lock<std::mutex> Lock{m_ConversionMtx, std::try_to_lock};
+    if (Lock.owns_lock())
+    {
+        // Every conversion works on a copy of the original tokens. This also restores the stream
+        // after the previous conversion failed. Both lists use the same pool, so the copy reuses
+        // the nodes released by the previous conversion.
+        m_Tokens = m_OriginalTokens;
+        m_StructDefinitions.clear();
+        m_Objects.clear();
+
+        auto GLSLSource = ConvertImpl(EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers);
+
+        m_Tokens.clear();
+        m_StructDefinitions.clear();
+        m_Objects.clear();
+
+        return GLSLSource;
+    }
+    else
+    {
+        // The stream is being converted by another thread. Rather than waiting, convert
+        // a private copy of the original tokens, which are never modified.
+        ConversionStream StreamCopy{nullptr, *this};
+        return StreamCopy.ConvertImpl(EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers);
+    }
+}
+
+String HLSL2GLSLConverterImpl::ConversionStream::ConvertImpl(const Char* EntryPoint,
+                                                             SHADER_TYPE ShaderType,
+                                                             bool        IncludeDefintions,
+                                                             const char* SamplerSuffix,
+                                                             bool        UseInOutLocationQualifiers)
 {
     m_bUseInOutLocationQualifiers = UseInOutLocationQualifiers;
-    TokenListType TokensCopy(m_bPreserveTokens ? m_Tokens : TokenListType());
 
     Uint32 ShaderStorageBlockBinding = 0;
     Uint32 ImageBinding              = 0;
@@ -5156,19 +5488,7 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
 
     RemoveSpecialShaderAttributes();
 
-    auto GLSLSource = BuildGLSLSource();
-
-    if (m_bPreserveTokens)
-    {
-        m_Tokens.swap(TokensCopy);
-        m_StructDefinitions.clear();
-        m_Objects.clear();
-    }
-
-    if (IncludeDefintions)
-        GLSLSource.insert(0, g_GLSLDefinitions);
-
-    return GLSLSource;
+    return BuildGLSLSource(IncludeDefintions);
 }
 
 } // namespace Diligent
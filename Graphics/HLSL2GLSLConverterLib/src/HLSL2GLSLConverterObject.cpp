@@ -43,4 +43,19 @@ void HLSL2GLSLConverterObject::CreateStream(const Char*                      Inp
     Converter.CreateStream(InputFileName, pSourceStreamFactory, HLSLSource, NumSymbols, ppStream);
 }
 
+void HLSL2GLSLConverterObject::SetConversionCacheSize(size_t MaxSize)
+{
+    HLSL2GLSLConverterImpl::GetInstance().SetConversionCacheSize(MaxSize);
+}
+
+void HLSL2GLSLConverterObject::ClearConversionCache()
+{
+    HLSL2GLSLConverterImpl::GetInstance().ClearConversionCache();
+}
+
+void HLSL2GLSLConverterObject::GetConversionCacheStats(HLSL2GLSLConversionCacheStats& Stats) const
+{
+    HLSL2GLSLConverterImpl::GetInstance().GetConversionCacheStats(Stats);
+}
+
 } // namespace Diligent
@@ -58,6 +58,8 @@ struct GLSLtoSPIRVAttribs
     SpirvVersion                     Version                    = SpirvVersion::Vk100;
     IDataBlob**                      ppCompilerOutput           = nullptr;
     bool                             AssignBindings             = true;
+    SHADER_OPTIMIZATION_PROFILE      OptimizationProfile        = SHADER_OPTIMIZATION_PROFILE_DEFAULT;
+    const char*                      OptimizationPasses         = nullptr;
 };
 
 std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs);
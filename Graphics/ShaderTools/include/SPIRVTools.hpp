@@ -26,8 +26,13 @@
 
 #pragma once
 
+#include <vector>
+#include <cstdint>
+
 #include "spirv-tools/libspirv.h"
 
+#include "Shader.h"
+
 namespace Diligent
 {
 
@@ -37,4 +42,20 @@ void SpvOptimizerMessageConsumer(
     const spv_position_t& position,
     const char*           message);
 
+/// Runs SPIR-V optimizer passes that correspond to the optimization profile.
+
+/// \param [in] SrcSPIRV     - Source SPIR-V bytecode.
+/// \param [in] TargetEnv    - SPIR-V target environment.
+/// \param [in] Profile      - Optimization profile, see Diligent::SHADER_OPTIMIZATION_PROFILE.
+/// \param [in] CustomPasses - Space-separated list of spirv-opt flags that is used
+///                            with SHADER_OPTIMIZATION_PROFILE_CUSTOM.
+/// \param [in] Legalize     - Whether to run legalization passes (required for SPIR-V generated from HLSL).
+///
+/// \return     Optimized SPIR-V bytecode, or empty vector if the optimization failed.
+std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV,
+                                    spv_target_env               TargetEnv,
+                                    SHADER_OPTIMIZATION_PROFILE  Profile,
+                                    const char*                  CustomPasses,
+                                    bool                         Legalize);
+
 } // namespace Diligent
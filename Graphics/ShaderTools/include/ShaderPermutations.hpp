@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+
+#include "BasicTypes.h"
+#include "Shader.h"
+#include "DataBlob.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Shader permutation preprocessing attributes.
+struct ShaderPermutationsAttribs
+{
+    /// Shader source code. If null, the source is loaded from FilePath
+    /// using pShaderSourceStreamFactory.
+    const char* Source = nullptr;
+
+    /// Length of the source code. If zero, the source is expected to be null-terminated.
+    size_t SourceLength = 0;
+
+    /// Path to the shader source file. Must be null when Source is not null.
+    const char* FilePath = nullptr;
+
+    /// Stream factory that is used to load the source file and to resolve #include directives.
+    IShaderSourceInputStreamFactory* pShaderSourceStreamFactory = nullptr;
+
+    /// Array of NumPermutations macro arrays. Every array must be terminated by {nullptr, nullptr}.
+    /// Null entry means that the permutation does not define any macros.
+    const ShaderMacro* const* ppPermutations = nullptr;
+
+    /// The number of permutations.
+    Uint32 NumPermutations = 0;
+};
+
+
+/// The result of shader permutation preprocessing.
+struct ShaderPermutationsInfo
+{
+    /// Shader source with all #include directives expanded, shared by all permutations.
+    std::string SharedSource;
+
+    /// Offset in the shared source where macro definitions are inserted
+    /// (right after the #version directive, if there is one).
+    size_t DefinitionsOffset = 0;
+
+    /// Macro definitions of every unique permutation. Only macros that are referenced
+    /// by the shared source are included, sorted by name. If any #include directive
+    /// could not be expanded, all macros are included.
+    std::vector<std::string> UniqueDefinitions;
+
+    /// For every permutation, index of the unique permutation in UniqueDefinitions.
+    std::vector<Uint32> PermutationToUnique;
+
+    /// Returns the full source code of the unique permutation.
+    std::string GetUniqueSource(Uint32 UniqueIdx) const;
+};
+
+
+/// Expands #include directives in the source and finds unique shader permutations.
+
+/// The source and all include files are read and expanded once. Macros that are not referenced by
+/// any identifier in the expanded source can't affect the preprocessed text, so they are excluded
+/// from the permutation definitions. Permutations with identical resulting definitions are merged.
+///
+/// \remarks    Include files that can't be loaded are left as #include directives, so that
+///             the compiler reports an error only if the directive is in an active branch.
+///             If the source uses token pasting (##), all macros are treated as referenced.
+ShaderPermutationsInfo PreprocessShaderPermutations(const ShaderPermutationsAttribs& Attribs) noexcept(false);
+
+
+/// Shader permutation compile function.
+
+/// \param [in] Source    - Full source code of the unique permutation.
+/// \param [in] UniqueIdx - Index of the unique permutation in ShaderPermutationsInfo::UniqueDefinitions.
+///
+/// \return     Compiled bytecode, or null if compilation failed.
+///
+/// \remarks    The function is called simultaneously from multiple threads and must be thread-safe.
+using ShaderPermutationCompileFuncType = std::function<RefCntAutoPtr<IDataBlob>(const std::string& Source, Uint32 UniqueIdx)>;
+
+
+/// Preprocesses shader permutations with PreprocessShaderPermutations() and compiles
+/// the unique ones in parallel.
+
+/// \param [in]  Attribs     - Permutation attributes.
+/// \param [in]  CompileFunc - Function that compiles the source of a single permutation.
+/// \param [in]  NumThreads  - The maximum number of threads to use. If zero, the number
+///                            of hardware threads is used.
+/// \param [out] pInfo       - Optional pointer to the structure that receives the preprocessing results.
+///
+/// \return     Array of NumPermutations bytecode blobs. Permutations that produce identical preprocessed
+///             text share the same blob. If compilation of a permutation fails, its blob is null.
+std::vector<RefCntAutoPtr<IDataBlob>> CompileShaderPermutations(const ShaderPermutationsAttribs&        Attribs,
+                                                                const ShaderPermutationCompileFuncType& CompileFunc,
+                                                                Uint32                                  NumThreads = 0,
+                                                                ShaderPermutationsInfo*                 pInfo      = nullptr) noexcept(false);
+
+} // namespace Diligent
@@ -68,6 +68,15 @@ void AppendShaderMacros(std::string& Source, const ShaderMacro* Macros);
 void AppendShaderTypeDefinitions(std::string& Source, SHADER_TYPE Type);
 
 
+/// Loads the contents of the shader source or include file using the stream factory.
+
+/// If the factory implements IShaderSourceFileCache, the shared cached contents are returned
+/// without copying. Otherwise, the file is read into a new data blob.
+///
+/// \return     Pointer to the data blob with the file contents, or null if the file could not be opened.
+RefCntAutoPtr<IDataBlob> LoadShaderSourceFile(IShaderSourceInputStreamFactory* pShaderSourceStreamFactory,
+                                              const char*                      FilePath);
+
 /// Reads shader source code from a file or uses the one from the shader create info
 const char* ReadShaderSourceFile(const char*                      SourceCode,
                                  IShaderSourceInputStreamFactory* pShaderSourceStreamFactory,
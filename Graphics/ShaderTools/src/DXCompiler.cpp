@@ -47,6 +47,7 @@
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "SPIRVUtils.hpp"
 
 #if D3D12_SUPPORTED
 #    include <d3d12shader.h>
@@ -232,20 +233,17 @@ public:
         if (fileName.size() > 2 && fileName[0] == '.' && (fileName[1] == '\\' || fileName[1] == '/'))
             fileName.erase(0, 2);
 
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pStreamFactory->CreateInputStream(fileName.c_str(), &pSourceStream);
-        if (pSourceStream == nullptr)
+        auto pFileData = LoadShaderSourceFile(m_pStreamFactory, fileName.c_str());
+        if (pFileData == nullptr)
         {
             LOG_ERROR("Failed to open shader include file ", fileName, ". Check that the file exists");
             return E_FAIL;
         }
 
-        RefCntAutoPtr<IDataBlob> pFileData{MakeNewRCObj<DataBlobImpl>()(0)};
-        pSourceStream->ReadBlob(pFileData);
-
         CComPtr<IDxcBlobEncoding> sourceBlob;
 
-        HRESULT hr = m_pLibrary->CreateBlobWithEncodingFromPinned(pFileData->GetDataPtr(), static_cast<UINT32>(pFileData->GetSize()), CP_UTF8, &sourceBlob);
+        // The blob is pinned, so the contents (possibly shared by the file cache) are not copied
+        HRESULT hr = m_pLibrary->CreateBlobWithEncodingFromPinned(pFileData->GetConstDataPtr(), static_cast<UINT32>(pFileData->GetSize()), CP_UTF8, &sourceBlob);
         if (FAILED(hr))
         {
             LOG_ERROR("Failed to allocate space for shader include file ", fileName, ".");
@@ -726,6 +724,7 @@ void DXCompilerImpl::Compile(const ShaderCreateInfo& ShaderCI,
     const std::wstring wstrEntryPoint{ShaderCI.EntryPoint, ShaderCI.EntryPoint + strlen(ShaderCI.EntryPoint)};
 
     std::vector<const wchar_t*> DxilArgs;
+    std::wstring                OptConfig;
     if (m_Target == DXCompilerTarget::Direct3D12)
     {
         DxilArgs.push_back(L"-Zpc"); // Matrices in column-major order
@@ -754,12 +753,62 @@ void DXCompilerImpl::Compile(const ShaderCreateInfo& ShaderCI,
                 L"-spirv",
                 L"-fspv-reflect",
                 L"-Zpc", // Matrices in column-major order
+            });
+
+        // DXC always legalizes SPIR-V, the profile only selects the optimization passes
+        switch (ShaderCI.OptimizationProfile)
+        {
+            case SHADER_OPTIMIZATION_PROFILE_DEFAULT:
 #ifdef DILIGENT_DEBUG
-                L"-Od",
+                DxilArgs.push_back(L"-Od");
 #else
-                L"-O3"
+                DxilArgs.push_back(L"-O3");
 #endif
-            });
+                break;
+
+            case SHADER_OPTIMIZATION_PROFILE_NONE:
+                DxilArgs.push_back(L"-O0");
+                break;
+
+            case SHADER_OPTIMIZATION_PROFILE_PERFORMANCE:
+                DxilArgs.push_back(L"-O3");
+                break;
+
+            case SHADER_OPTIMIZATION_PROFILE_SIZE:
+                DxilArgs.push_back(L"-Oconfig=-Os");
+                break;
+
+            case SHADER_OPTIMIZATION_PROFILE_CUSTOM:
+                if (ShaderCI.OptimizationPasses != nullptr && *ShaderCI.OptimizationPasses != '\0')
+                {
+                    // -Oconfig expects a comma-separated list of spirv-opt flags
+                    OptConfig = L"-Oconfig=";
+                    for (const auto* c = ShaderCI.OptimizationPasses; *c != '\0'; ++c)
+                    {
+                        if (*c == ' ' || *c == '\t')
+                        {
+                            if (OptConfig.back() != L',' && OptConfig.back() != L'=')
+                                OptConfig.push_back(L',');
+                        }
+                        else
+                        {
+                            OptConfig.push_back(static_cast<wchar_t>(*c));
+                        }
+                    }
+                    if (OptConfig.back() == L',')
+                        OptConfig.pop_back();
+                    DxilArgs.push_back(OptConfig.c_str());
+                }
+                else
+                {
+                    LOG_WARNING_MESSAGE("SHADER_OPTIMIZATION_PROFILE_CUSTOM is used, but no optimization passes are provided");
+                    DxilArgs.push_back(L"-O0");
+                }
+                break;
+
+            default:
+                UNEXPECTED("Unexpected optimization profile");
+        }
 
         if (m_APIVersion >= VK_API_VERSION_1_2 && ShaderModel >= ShaderVersion{6, 3})
         {
@@ -805,9 +854,35 @@ void DXCompilerImpl::Compile(const ShaderCreateInfo& ShaderCI,
 
     if (result && pDXIL && pDXIL->GetBufferSize() > 0)
     {
-        if (pByteCode != nullptr)
+        if (m_Target == DXCompilerTarget::Vulkan && ShaderCI.OptimizationProfile == SHADER_OPTIMIZATION_PROFILE_SIZE)
+        {
+            std::vector<uint32_t> SPIRV{static_cast<uint32_t*>(pDXIL->GetBufferPointer()),
+                                        static_cast<uint32_t*>(pDXIL->GetBufferPointer()) + pDXIL->GetBufferSize() / sizeof(uint32_t)};
+            if (StripSPIRVSourceDebugInfo(SPIRV) > 0 && ppByteCodeBlob != nullptr)
+            {
+                // Replace the blob with the stripped bytecode so that both outputs are identical
+                CComPtr<IDxcLibrary>      library;
+                CComPtr<IDxcBlobEncoding> pStrippedBlob;
+                if (SUCCEEDED(GetCreateInstaceProc()(CLSID_DxcLibrary, IID_PPV_ARGS(&library))) &&
+                    SUCCEEDED(library->CreateBlobWithEncodingOnHeapCopy(SPIRV.data(), static_cast<UINT32>(SPIRV.size() * sizeof(uint32_t)), 0, &pStrippedBlob)))
+                {
+                    pDXIL = pStrippedBlob.p;
+                }
+                else
+                {
+                    LOG_ERROR("Failed to create DXC blob for the stripped bytecode");
+                    return;
+                }
+            }
+
+            if (pByteCode != nullptr)
+                *pByteCode = std::move(SPIRV);
+        }
+        else if (pByteCode != nullptr)
+        {
             pByteCode->assign(static_cast<uint32_t*>(pDXIL->GetBufferPointer()),
                               static_cast<uint32_t*>(pDXIL->GetBufferPointer()) + pDXIL->GetBufferSize() / sizeof(uint32_t));
+        }
 
         if (ppByteCodeBlob != nullptr)
             *ppByteCodeBlob = pDXIL.Detach();
@@ -44,8 +44,6 @@
 #include "ShaderToolsCommon.hpp"
 #include "SPIRVTools.hpp"
 
-#include "spirv-tools/optimizer.hpp"
-
 // clang-format off
 static const char g_HLSLDefinitions[] =
 {
@@ -289,20 +287,17 @@ public:
                                          size_t /*inclusionDepth*/)
     {
         DEV_CHECK_ERR(m_pInputStreamFactory != nullptr, "The shader source contains #include directives, but no input stream factory was provided");
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pInputStreamFactory->CreateInputStream(headerName, &pSourceStream);
-        if (pSourceStream == nullptr)
+        auto pFileData = LoadShaderSourceFile(m_pInputStreamFactory, headerName);
+        if (pFileData == nullptr)
         {
             LOG_ERROR("Failed to open shader include file '", headerName, "'. Check that the file exists");
             return nullptr;
         }
 
-        RefCntAutoPtr<IDataBlob> pFileData(MakeNewRCObj<DataBlobImpl>()(0));
-        pSourceStream->ReadBlob(pFileData);
         auto* pNewInclude =
             new IncludeResult{
                 headerName,
-                reinterpret_cast<const char*>(pFileData->GetDataPtr()),
+                reinterpret_cast<const char*>(pFileData->GetConstDataPtr()),
                 pFileData->GetSize(),
                 nullptr};
 
@@ -390,12 +385,8 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
 
     // SPIR-V bytecode generated from HLSL must be legalized to
     // turn it into a valid vulkan SPIR-V shader
-    spvtools::Optimizer SpirvOptimizer{SPV_ENV_VULKAN_1_0};
-    SpirvOptimizer.SetMessageConsumer(SpvOptimizerMessageConsumer);
-    SpirvOptimizer.RegisterLegalizationPasses();
-    SpirvOptimizer.RegisterPerformancePasses();
-    std::vector<uint32_t> LegalizedSPIRV;
-    if (SpirvOptimizer.Run(SPIRV.data(), SPIRV.size(), &LegalizedSPIRV))
+    auto LegalizedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_VULKAN_1_0, ShaderCI.OptimizationProfile, ShaderCI.OptimizationPasses, true);
+    if (!LegalizedSPIRV.empty())
     {
         return LegalizedSPIRV;
     }
@@ -460,11 +451,8 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
     if (SPIRV.empty())
         return SPIRV;
 
-    spvtools::Optimizer SpirvOptimizer(spvTarget);
-    SpirvOptimizer.SetMessageConsumer(SpvOptimizerMessageConsumer);
-    SpirvOptimizer.RegisterPerformancePasses();
-    std::vector<uint32_t> OptimizedSPIRV;
-    if (SpirvOptimizer.Run(SPIRV.data(), SPIRV.size(), &OptimizedSPIRV))
+    auto OptimizedSPIRV = OptimizeSPIRV(SPIRV, spvTarget, Attribs.OptimizationProfile, Attribs.OptimizationPasses, false);
+    if (!OptimizedSPIRV.empty())
     {
         return OptimizedSPIRV;
     }
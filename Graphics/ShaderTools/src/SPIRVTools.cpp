@@ -24,9 +24,15 @@
  *  of the possibility of such damages.
  */
 
+#include <sstream>
+#include <string>
+
 #include "SPIRVTools.hpp"
+#include "SPIRVUtils.hpp"
 #include "DebugUtilities.hpp"
 
+#include "spirv-tools/optimizer.hpp"
+
 namespace Diligent
 {
 
@@ -78,4 +84,75 @@ void SpvOptimizerMessageConsumer(
         LOG_DEBUG_MESSAGE(MsgSeverity, "Spirv optimizer ", LevelText, ": ", message);
 }
 
+std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV,
+                                    spv_target_env               TargetEnv,
+                                    SHADER_OPTIMIZATION_PROFILE  Profile,
+                                    const char*                  CustomPasses,
+                                    bool                         Legalize)
+{
+    VERIFY_EXPR(Profile <= SHADER_OPTIMIZATION_PROFILE_LAST);
+
+    if (Profile == SHADER_OPTIMIZATION_PROFILE_DEFAULT)
+        Profile = SHADER_OPTIMIZATION_PROFILE_PERFORMANCE;
+
+    if (Profile == SHADER_OPTIMIZATION_PROFILE_CUSTOM && (CustomPasses == nullptr || *CustomPasses == '\0'))
+    {
+        LOG_WARNING_MESSAGE("SHADER_OPTIMIZATION_PROFILE_CUSTOM is used, but no optimization passes are provided");
+        Profile = SHADER_OPTIMIZATION_PROFILE_NONE;
+    }
+
+    if (Profile == SHADER_OPTIMIZATION_PROFILE_NONE && !Legalize)
+        return SrcSPIRV;
+
+    spvtools::Optimizer SpirvOptimizer{TargetEnv};
+    SpirvOptimizer.SetMessageConsumer(SpvOptimizerMessageConsumer);
+
+    // SPIR-V bytecode generated from HLSL must be legalized to
+    // turn it into a valid vulkan SPIR-V shader
+    if (Legalize)
+        SpirvOptimizer.RegisterLegalizationPasses();
+
+    switch (Profile)
+    {
+        case SHADER_OPTIMIZATION_PROFILE_NONE:
+            break;
+
+        case SHADER_OPTIMIZATION_PROFILE_PERFORMANCE:
+            SpirvOptimizer.RegisterPerformancePasses();
+            break;
+
+        case SHADER_OPTIMIZATION_PROFILE_SIZE:
+            SpirvOptimizer.RegisterSizePasses();
+            break;
+
+        case SHADER_OPTIMIZATION_PROFILE_CUSTOM:
+        {
+            std::vector<std::string> Flags;
+
+            std::istringstream ss{CustomPasses};
+            for (std::string Flag; ss >> Flag;)
+                Flags.emplace_back(std::move(Flag));
+
+            if (!SpirvOptimizer.RegisterPassesFromFlags(Flags))
+            {
+                LOG_ERROR_MESSAGE("Failed to parse SPIR-V optimization passes '", CustomPasses, "'");
+                return {};
+            }
+            break;
+        }
+
+        default:
+            UNEXPECTED("Unexpected optimization profile");
+    }
+
+    std::vector<uint32_t> OptimizedSPIRV;
+    if (!SpirvOptimizer.Run(SrcSPIRV.data(), SrcSPIRV.size(), &OptimizedSPIRV))
+        return {};
+
+    if (Profile == SHADER_OPTIMIZATION_PROFILE_SIZE)
+        StripSPIRVSourceDebugInfo(OptimizedSPIRV);
+
+    return OptimizedSPIRV;
+}
+
 } // namespace Diligent
@@ -0,0 +1,136 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVUtils.hpp"
+
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Values from the SPIR-V specification, so that the function does not depend on SPIRV-Headers
+constexpr uint32_t SpvMagicNumber          = 0x07230203;
+constexpr uint32_t SpvHeaderWordCount      = 5;
+constexpr uint32_t SpvWordCountShift       = 16;
+constexpr uint32_t SpvOpCodeMask           = 0xFFFF;
+constexpr uint32_t SpvOpSourceContinued    = 2;
+constexpr uint32_t SpvOpSource             = 3;
+constexpr uint32_t SpvOpSourceExtension    = 4;
+constexpr uint32_t SpvOpString             = 7;
+constexpr uint32_t SpvOpLine               = 8;
+constexpr uint32_t SpvOpExtInstImport      = 11;
+constexpr uint32_t SpvOpNoLine             = 317;
+constexpr uint32_t SpvOpModuleProcessed    = 330;
+constexpr uint32_t SpvOpSourceWordCountMin = 3; // OpSource SourceLanguage Version
+
+} // namespace
+
+size_t StripSPIRVSourceDebugInfo(std::vector<uint32_t>& SPIRV)
+{
+    if (SPIRV.size() < SpvHeaderWordCount || SPIRV[0] != SpvMagicNumber)
+    {
+        LOG_ERROR_MESSAGE("Invalid SPIR-V bytecode");
+        return 0;
+    }
+
+    // Strings may be referenced by non-semantic instructions (e.g. NonSemantic.Shader.DebugInfo),
+    // so they can only be removed when no such instruction set is imported.
+    bool KeepStrings = false;
+    for (size_t Pos = SpvHeaderWordCount; Pos < SPIRV.size();)
+    {
+        const auto WordCount = SPIRV[Pos] >> SpvWordCountShift;
+        const auto OpCode    = SPIRV[Pos] & SpvOpCodeMask;
+        if (WordCount == 0 || Pos + WordCount > SPIRV.size())
+        {
+            LOG_ERROR_MESSAGE("Invalid SPIR-V instruction at word ", Pos);
+            return 0;
+        }
+
+        if (OpCode == SpvOpExtInstImport && WordCount > 2)
+        {
+            const auto* Name = reinterpret_cast<const char*>(&SPIRV[Pos + 2]);
+            if (strncmp(Name, "NonSemantic.", 12) == 0)
+                KeepStrings = true;
+        }
+
+        Pos += WordCount;
+    }
+
+    size_t DstPos = SpvHeaderWordCount;
+    for (size_t SrcPos = SpvHeaderWordCount; SrcPos < SPIRV.size();)
+    {
+        auto       WordCount = SPIRV[SrcPos] >> SpvWordCountShift;
+        const auto OpCode    = SPIRV[SrcPos] & SpvOpCodeMask;
+
+        const auto NextPos = SrcPos + WordCount;
+
+        bool Remove = false;
+        switch (OpCode)
+        {
+            case SpvOpSourceContinued:
+            case SpvOpSourceExtension:
+            case SpvOpLine:
+            case SpvOpNoLine:
+            case SpvOpModuleProcessed:
+                Remove = true;
+                break;
+
+            case SpvOpString:
+                Remove = !KeepStrings;
+                break;
+
+            case SpvOpSource:
+                // Source language is used by the reflection, but the file and source text are not
+                if (!KeepStrings && WordCount > SpvOpSourceWordCountMin)
+                    WordCount = SpvOpSourceWordCountMin;
+                break;
+        }
+
+        if (!Remove)
+        {
+            if (DstPos != SrcPos)
+                memmove(&SPIRV[DstPos], &SPIRV[SrcPos], WordCount * sizeof(uint32_t));
+            if (WordCount != SPIRV[DstPos] >> SpvWordCountShift)
+                SPIRV[DstPos] = (WordCount << SpvWordCountShift) | OpCode;
+            DstPos += WordCount;
+        }
+
+        SrcPos = NextPos;
+    }
+
+    const auto NumRemovedWords = SPIRV.size() - DstPos;
+    SPIRV.resize(DstPos);
+    return NumRemovedWords;
+}
+
+} // namespace Diligent
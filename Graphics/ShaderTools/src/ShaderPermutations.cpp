@@ -0,0 +1,416 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ShaderPermutations.hpp"
+
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ShaderToolsCommon.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+inline bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool IsIdentifierStart(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+inline bool IsIdentifierChar(char c)
+{
+    return IsIdentifierStart(c) || (c >= '0' && c <= '9');
+}
+
+// Checks if the line [Pos, End) is the preprocessor directive with the given name,
+// and returns the pointer to the first character after the directive name.
+const char* MatchDirective(const char* Pos, const char* End, const char* Name)
+{
+    while (Pos < End && IsSpace(*Pos))
+        ++Pos;
+    if (Pos == End || *Pos != '#')
+        return nullptr;
+    ++Pos;
+    while (Pos < End && IsSpace(*Pos))
+        ++Pos;
+
+    const auto NameLen = strlen(Name);
+    if (static_cast<size_t>(End - Pos) < NameLen || strncmp(Pos, Name, NameLen) != 0)
+        return nullptr;
+    Pos += NameLen;
+    if (Pos < End && IsIdentifierChar(*Pos))
+        return nullptr;
+
+    return Pos;
+}
+
+// Parses the #include directive in the line [Pos, End).
+bool ParseIncludeDirective(const char* Pos, const char* End, std::string& FileName)
+{
+    Pos = MatchDirective(Pos, End, "include");
+    if (Pos == nullptr)
+        return false;
+
+    while (Pos < End && IsSpace(*Pos))
+        ++Pos;
+    if (Pos == End || (*Pos != '"' && *Pos != '<'))
+        return false;
+
+    const char  ClosingQuote = *Pos == '"' ? '"' : '>';
+    const char* NameStart    = ++Pos;
+    while (Pos < End && *Pos != ClosingQuote)
+        ++Pos;
+    if (Pos == End || Pos == NameStart)
+        return false;
+
+    FileName.assign(NameStart, Pos);
+    return true;
+}
+
+// Returns true if the line [Pos, End) ends inside a block comment.
+bool UpdateBlockCommentState(const char* Pos, const char* End, bool InBlockComment)
+{
+    while (Pos < End)
+    {
+        if (InBlockComment)
+        {
+            if (Pos[0] == '*' && Pos + 1 < End && Pos[1] == '/')
+            {
+                InBlockComment = false;
+                ++Pos;
+            }
+        }
+        else if (Pos[0] == '/' && Pos + 1 < End && Pos[1] == '/')
+        {
+            break;
+        }
+        else if (Pos[0] == '/' && Pos + 1 < End && Pos[1] == '*')
+        {
+            InBlockComment = true;
+            ++Pos;
+        }
+        else if (Pos[0] == '"')
+        {
+            ++Pos;
+            while (Pos < End && *Pos != '"')
+                ++Pos;
+        }
+        ++Pos;
+    }
+    return InBlockComment;
+}
+
+class IncludeExpander
+{
+public:
+    IncludeExpander(IShaderSourceInputStreamFactory* pShaderSourceStreamFactory, const char* FilePath) :
+        m_pShaderSourceStreamFactory{pShaderSourceStreamFactory}
+    {
+        if (FilePath != nullptr)
+            m_IncludeStack.emplace_back(FilePath);
+    }
+
+    // Returns true if any include directive could not be expanded because there is no
+    // shader source stream factory or the file could not be loaded.
+    bool HasUnexpandedIncludes() const
+    {
+        return m_HasUnexpandedIncludes;
+    }
+
+    void Expand(const char* Source, size_t SourceLength, std::string& Output) noexcept(false)
+    {
+        const char* const End = Source + SourceLength;
+
+        bool        InBlockComment = false;
+        std::string FileName;
+        for (const char* Pos = Source; Pos < End;)
+        {
+            const char* LineEnd  = std::find(Pos, End, '\n');
+            const char* NextLine = LineEnd < End ? LineEnd + 1 : End;
+
+            const bool LineEndsInComment = UpdateBlockCommentState(Pos, LineEnd, InBlockComment);
+            if (!InBlockComment && !LineEndsInComment && ExpandInclude(Pos, LineEnd, FileName, Output))
+            {
+                if (!Output.empty() && Output.back() != '\n')
+                    Output += '\n';
+            }
+            else
+            {
+                Output.append(Pos, NextLine);
+            }
+
+            InBlockComment = LineEndsInComment;
+            Pos            = NextLine;
+        }
+    }
+
+private:
+    bool ExpandInclude(const char* Pos, const char* End, std::string& FileName, std::string& Output) noexcept(false)
+    {
+        if (!ParseIncludeDirective(Pos, End, FileName))
+            return false;
+
+        if (m_pShaderSourceStreamFactory == nullptr)
+        {
+            m_HasUnexpandedIncludes = true;
+            return false;
+        }
+
+        // Recursive includes are left to the compiler, which will either skip them
+        // because of include guards or report an error.
+        if (std::find(m_IncludeStack.begin(), m_IncludeStack.end(), FileName) != m_IncludeStack.end())
+            return false;
+
+        auto pFileData = LoadShaderSourceFile(m_pShaderSourceStreamFactory, FileName.c_str());
+        if (pFileData == nullptr)
+        {
+            m_HasUnexpandedIncludes = true;
+            return false;
+        }
+
+        m_IncludeStack.emplace_back(std::move(FileName));
+        Expand(reinterpret_cast<const char*>(pFileData->GetConstDataPtr()), pFileData->GetSize(), Output);
+        m_IncludeStack.pop_back();
+
+        return true;
+    }
+
+    IShaderSourceInputStreamFactory* const m_pShaderSourceStreamFactory;
+    std::vector<std::string>               m_IncludeStack;
+    bool                                   m_HasUnexpandedIncludes = false;
+};
+
+// Adds the names of the macros that are referenced by the text to ReferencedMacros.
+void FindReferencedMacros(const char*                            Text,
+                          size_t                                 Length,
+                          const std::unordered_set<std::string>& MacroNames,
+                          std::unordered_set<std::string>&       ReferencedMacros)
+{
+    std::string Identifier;
+
+    const auto* Pos = Text;
+    const auto* End = Text + Length;
+    while (Pos < End)
+    {
+        if (IsIdentifierStart(*Pos))
+        {
+            const auto* IdentifierStart = Pos;
+            while (Pos < End && IsIdentifierChar(*Pos))
+                ++Pos;
+
+            Identifier.assign(IdentifierStart, Pos);
+            if (MacroNames.find(Identifier) != MacroNames.end())
+                ReferencedMacros.emplace(Identifier);
+        }
+        else if (*Pos >= '0' && *Pos <= '9')
+        {
+            // Skip numeric literals such as 0x1F or 1e-5f
+            while (Pos < End && (IsIdentifierChar(*Pos) || *Pos == '.'))
+                ++Pos;
+        }
+        else
+        {
+            ++Pos;
+        }
+    }
+}
+
+} // namespace
+
+std::string ShaderPermutationsInfo::GetUniqueSource(Uint32 UniqueIdx) const
+{
+    VERIFY_EXPR(UniqueIdx < UniqueDefinitions.size());
+    const auto& Definitions = UniqueDefinitions[UniqueIdx];
+
+    std::string Source;
+    Source.reserve(SharedSource.length() + Definitions.length());
+    Source.append(SharedSource, 0, DefinitionsOffset);
+    Source.append(Definitions);
+    Source.append(SharedSource, DefinitionsOffset, std::string::npos);
+    return Source;
+}
+
+ShaderPermutationsInfo PreprocessShaderPermutations(const ShaderPermutationsAttribs& Attribs) noexcept(false)
+{
+    DEV_CHECK_ERR(Attribs.NumPermutations == 0 || Attribs.ppPermutations != nullptr, "ppPermutations must not be null when NumPermutations is not zero");
+
+    ShaderPermutationsInfo Info;
+
+    bool HasUnexpandedIncludes = false;
+    {
+        RefCntAutoPtr<IDataBlob> pFileData;
+
+        const char* SourceCode    = Attribs.Source;
+        size_t      SourceCodeLen = Attribs.SourceLength;
+        if (SourceCode == nullptr || SourceCodeLen == 0)
+            SourceCode = ReadShaderSourceFile(Attribs.Source, Attribs.pShaderSourceStreamFactory, Attribs.FilePath, pFileData, SourceCodeLen);
+
+        IncludeExpander Expander{Attribs.pShaderSourceStreamFactory, Attribs.FilePath};
+        Info.SharedSource.reserve(SourceCodeLen);
+        Expander.Expand(SourceCode, SourceCodeLen, Info.SharedSource);
+        HasUnexpandedIncludes = Expander.HasUnexpandedIncludes();
+    }
+
+    // Macro definitions must follow the #version directive
+    {
+        const auto* Start = Info.SharedSource.c_str();
+        const auto* End   = Start + Info.SharedSource.length();
+        const auto* Pos   = Start;
+        while (Pos < End && (IsSpace(*Pos) || *Pos == '\n'))
+            ++Pos;
+        const auto* LineEnd = std::find(Pos, End, '\n');
+        if (MatchDirective(Pos, LineEnd, "version") != nullptr)
+            Info.DefinitionsOffset = (LineEnd < End ? LineEnd + 1 : End) - Start;
+    }
+
+    std::unordered_set<std::string> MacroNames;
+    for (Uint32 i = 0; i < Attribs.NumPermutations; ++i)
+    {
+        for (const auto* pMacro = Attribs.ppPermutations[i]; pMacro != nullptr && pMacro->Name != nullptr && pMacro->Definition != nullptr; ++pMacro)
+            MacroNames.emplace(pMacro->Name);
+    }
+
+    std::unordered_set<std::string> ReferencedMacros;
+    if (!HasUnexpandedIncludes && Info.SharedSource.find("##") == std::string::npos)
+    {
+        FindReferencedMacros(Info.SharedSource.c_str(), Info.SharedSource.length(), MacroNames, ReferencedMacros);
+        // A macro may only be referenced by the definition of another macro
+        for (Uint32 i = 0; i < Attribs.NumPermutations; ++i)
+        {
+            for (const auto* pMacro = Attribs.ppPermutations[i]; pMacro != nullptr && pMacro->Name != nullptr && pMacro->Definition != nullptr; ++pMacro)
+                FindReferencedMacros(pMacro->Definition, strlen(pMacro->Definition), MacroNames, ReferencedMacros);
+        }
+    }
+    else
+    {
+        // Token pasting may produce any identifier, and the includes that are left to the compiler
+        // may reference any macro, so every macro has to be treated as referenced
+        ReferencedMacros = MacroNames;
+    }
+
+    std::unordered_map<std::string, Uint32> DefinitionsToUniqueIdx;
+
+    std::vector<ShaderMacro> Macros;
+    Info.PermutationToUnique.resize(Attribs.NumPermutations);
+    for (Uint32 i = 0; i < Attribs.NumPermutations; ++i)
+    {
+        Macros.clear();
+        for (const auto* pMacro = Attribs.ppPermutations[i]; pMacro != nullptr && pMacro->Name != nullptr && pMacro->Definition != nullptr; ++pMacro)
+        {
+            if (ReferencedMacros.find(pMacro->Name) != ReferencedMacros.end())
+                Macros.emplace_back(*pMacro);
+        }
+        // Stable sort preserves the order of redefinitions of the same macro
+        std::stable_sort(Macros.begin(), Macros.end(),
+                         [](const ShaderMacro& M1, const ShaderMacro& M2) {
+                             return strcmp(M1.Name, M2.Name) < 0;
+                         });
+        Macros.emplace_back();
+
+        std::string Definitions;
+        AppendShaderMacros(Definitions, Macros.data());
+
+        auto it = DefinitionsToUniqueIdx.find(Definitions);
+        if (it == DefinitionsToUniqueIdx.end())
+        {
+            it = DefinitionsToUniqueIdx.emplace(Definitions, static_cast<Uint32>(Info.UniqueDefinitions.size())).first;
+            Info.UniqueDefinitions.emplace_back(std::move(Definitions));
+        }
+        Info.PermutationToUnique[i] = it->second;
+    }
+
+    return Info;
+}
+
+std::vector<RefCntAutoPtr<IDataBlob>> CompileShaderPermutations(const ShaderPermutationsAttribs&        Attribs,
+                                                                const ShaderPermutationCompileFuncType& CompileFunc,
+                                                                Uint32                                  NumThreads,
+                                                                ShaderPermutationsInfo*                 pInfo) noexcept(false)
+{
+    VERIFY_EXPR(CompileFunc);
+
+    auto Info = PreprocessShaderPermutations(Attribs);
+
+    const auto NumUnique = static_cast<Uint32>(Info.UniqueDefinitions.size());
+
+    std::vector<RefCntAutoPtr<IDataBlob>> UniqueBytecode(NumUnique);
+
+    std::atomic<Uint32> NextUniqueIdx{0};
+
+    auto CompileWorker = [&]() {
+        for (auto UniqueIdx = NextUniqueIdx.fetch_add(1); UniqueIdx < NumUnique; UniqueIdx = NextUniqueIdx.fetch_add(1))
+        {
+            try
+            {
+                UniqueBytecode[UniqueIdx] = CompileFunc(Info.GetUniqueSource(UniqueIdx), UniqueIdx);
+            }
+            catch (...)
+            {
+                LOG_ERROR_MESSAGE("Failed to compile shader permutation with the following definitions:\n", Info.UniqueDefinitions[UniqueIdx]);
+            }
+        }
+    };
+
+    if (NumThreads == 0)
+        NumThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    NumThreads = std::min(NumThreads, NumUnique);
+
+    std::vector<std::thread> Workers;
+    if (NumThreads > 1)
+    {
+        Workers.reserve(NumThreads - 1);
+        for (Uint32 i = 0; i < NumThreads - 1; ++i)
+            Workers.emplace_back(CompileWorker);
+    }
+    CompileWorker();
+    for (auto& Worker : Workers)
+        Worker.join();
+
+    std::vector<RefCntAutoPtr<IDataBlob>> Bytecode(Attribs.NumPermutations);
+    for (Uint32 i = 0; i < Attribs.NumPermutations; ++i)
+        Bytecode[i] = UniqueBytecode[Info.PermutationToUnique[i]];
+
+    if (pInfo != nullptr)
+        *pInfo = std::move(Info);
+
+    return Bytecode;
+}
+
+} // namespace Diligent
@@ -28,6 +28,7 @@
 #include "ShaderToolsCommon.hpp"
 #include "DebugUtilities.hpp"
 #include "DataBlobImpl.hpp"
+#include "ShaderSourceFileCache.hpp"
 
 namespace Diligent
 {
@@ -103,6 +104,30 @@ void AppendShaderTypeDefinitions(std::string& Source, SHADER_TYPE Type)
 }
 
 
+RefCntAutoPtr<IDataBlob> LoadShaderSourceFile(IShaderSourceInputStreamFactory* pShaderSourceStreamFactory,
+                                              const char*                      FilePath)
+{
+    VERIFY_EXPR(pShaderSourceStreamFactory != nullptr && FilePath != nullptr);
+
+    RefCntAutoPtr<IDataBlob> pFileData;
+
+    RefCntAutoPtr<IShaderSourceFileCache> pFileCache{pShaderSourceStreamFactory, IID_ShaderSourceFileCache};
+    if (pFileCache)
+    {
+        pFileCache->GetFileContents(FilePath, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pFileData);
+        return pFileData;
+    }
+
+    RefCntAutoPtr<IFileStream> pSourceStream;
+    pShaderSourceStreamFactory->CreateInputStream2(FilePath, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pSourceStream);
+    if (pSourceStream == nullptr)
+        return pFileData;
+
+    pFileData = MakeNewRCObj<DataBlobImpl>{}(0);
+    pSourceStream->ReadBlob(pFileData);
+    return pFileData;
+}
+
 const char* ReadShaderSourceFile(const char*                      SourceCode,
                                  IShaderSourceInputStreamFactory* pShaderSourceStreamFactory,
                                  const char*                      FilePath,
@@ -121,14 +146,11 @@ const char* ReadShaderSourceFile(const char*                      SourceCode,
         {
             if (FilePath != nullptr)
             {
-                RefCntAutoPtr<IFileStream> pSourceStream;
-                pShaderSourceStreamFactory->CreateInputStream(FilePath, &pSourceStream);
-                if (pSourceStream == nullptr)
+                pFileData = LoadShaderSourceFile(pShaderSourceStreamFactory, FilePath);
+                if (pFileData == nullptr)
                     LOG_ERROR_AND_THROW("Failed to load shader source file '", FilePath, '\'');
 
-                pFileData = MakeNewRCObj<DataBlobImpl>{}(0);
-                pSourceStream->ReadBlob(pFileData);
-                SourceCode    = reinterpret_cast<char*>(pFileData->GetDataPtr());
+                SourceCode    = reinterpret_cast<const char*>(pFileData->GetConstDataPtr());
                 SourceCodeLen = pFileData->GetSize();
             }
             else
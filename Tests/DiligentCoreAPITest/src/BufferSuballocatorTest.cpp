@@ -149,4 +149,121 @@ TEST(BufferSuballocatorTest, Allocate)
     }
 }
 
+TEST(BufferSuballocatorTest, Defragment)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumSuballocations = 16;
+    constexpr Uint32 SuballocationSize = 64;
+
+    BufferSuballocatorCreateInfo CI;
+    CI.Desc.Name            = "Buffer Suballocator Defragmentation Test";
+    CI.Desc.BindFlags       = BIND_VERTEX_BUFFER;
+    CI.Desc.Size            = NumSuballocations * SuballocationSize;
+    CI.AllowDefragmentation = true;
+
+    RefCntAutoPtr<IBufferSuballocator> pAllocator;
+    CreateBufferSuballocator(pDevice, CI, &pAllocator);
+    ASSERT_TRUE(pAllocator);
+
+    auto* pBuffer = pAllocator->GetBuffer(pDevice, pContext);
+    ASSERT_NE(pBuffer, nullptr);
+
+    std::vector<RefCntAutoPtr<IBufferSuballocation>> Suballocations(NumSuballocations);
+    for (Uint32 i = 0; i < NumSuballocations; ++i)
+    {
+        pAllocator->Allocate(SuballocationSize, 16, &Suballocations[i]);
+        ASSERT_TRUE(Suballocations[i]);
+        EXPECT_EQ(Suballocations[i]->GetOffset(), i * SuballocationSize);
+
+        // Fill every suballocation with its index
+        std::vector<Uint8> Data(SuballocationSize, static_cast<Uint8>(i));
+        pContext->UpdateBuffer(pBuffer, Suballocations[i]->GetOffset(), SuballocationSize, Data.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    // Release every other suballocation
+    for (Uint32 i = 1; i < NumSuballocations; i += 2)
+        Suballocations[i].Release();
+
+    BufferSuballocatorUsageStats Stats;
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, NumSuballocations / 2);
+    EXPECT_EQ(Stats.FreeChunkCount, NumSuballocations / 2);
+    EXPECT_EQ(Stats.MaxFreeChunkSize, SuballocationSize);
+    EXPECT_EQ(Stats.FreeChunkSizeHistogram[6], NumSuballocations / 2);
+
+    const auto Version = pAllocator->GetVersion();
+
+    struct MoveData
+    {
+        Uint32 NumCallbacks = 0;
+        bool   OffsetsValid = true;
+    } Moves;
+
+    auto NumMoved = pAllocator->Defragment(
+        pDevice, pContext,
+        [](IBufferSuballocation* pSuballocation, Uint32 OldOffset, void* pUserData) {
+            auto& Moves = *static_cast<MoveData*>(pUserData);
+            ++Moves.NumCallbacks;
+            // Live suballocations have even indices and are packed in the same order
+            Moves.OffsetsValid = Moves.OffsetsValid && (pSuballocation->GetOffset() == OldOffset / 2);
+        },
+        &Moves);
+    EXPECT_EQ(NumMoved, NumSuballocations / 2 - 1);
+    EXPECT_EQ(Moves.NumCallbacks, NumMoved);
+    EXPECT_TRUE(Moves.OffsetsValid);
+    EXPECT_EQ(pAllocator->GetVersion(), Version + 1);
+    EXPECT_EQ(pAllocator->GetBuffer(pDevice, pContext), pBuffer);
+
+    for (Uint32 i = 0; i < NumSuballocations; i += 2)
+        EXPECT_EQ(Suballocations[i]->GetOffset(), i / 2 * SuballocationSize);
+
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, NumSuballocations / 2);
+    EXPECT_EQ(Stats.FreeChunkCount, 1u);
+    EXPECT_EQ(Stats.MaxFreeChunkSize, NumSuballocations / 2 * SuballocationSize);
+    EXPECT_EQ(Stats.FreeChunkSizeHistogram[6], 0u);
+    EXPECT_EQ(Stats.FreeChunkSizeHistogram[9], 1u);
+
+    // Suballocations are already packed
+    EXPECT_EQ(pAllocator->Defragment(pDevice, pContext), 0u);
+    EXPECT_EQ(pAllocator->GetVersion(), Version + 1);
+
+    // Verify that the data has been moved along with the suballocations
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Buffer Suballocator Defragmentation Test staging buffer";
+    StagingDesc.Size           = CI.Desc.Size;
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, StagingDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    for (Uint32 i = 0; i < NumSuballocations; i += 2)
+    {
+        const auto* pSuballocData = static_cast<const Uint8*>(pData) + Suballocations[i]->GetOffset();
+        for (Uint32 b = 0; b < SuballocationSize; ++b)
+        {
+            if (pSuballocData[b] != i)
+            {
+                ADD_FAILURE() << "Byte " << b << " of suballocation " << i << " is " << Uint32{pSuballocData[b]} << " while " << i << " is expected";
+                break;
+            }
+        }
+    }
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+}
+
 } // namespace
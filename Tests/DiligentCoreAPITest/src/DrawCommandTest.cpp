@@ -986,6 +986,148 @@ TEST_F(DrawCommandTest, DrawIndexed_IBOffset_BaseVertex)
 }
 
 
+// Multi-draw commands
+
+TEST_F(DrawCommandTest, MultiDraw)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawPSO);
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {},
+        Vert[0], Vert[1], Vert[2],
+        {},
+        Vert[3], Vert[4], Vert[5]
+    };
+    // clang-format on
+
+    auto         pVB       = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    IBuffer*     pVBs[]    = {pVB};
+    const Uint64 Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+    const MultiDrawItem DrawItems[] = {{3, 2}, {3, 6}};
+
+    MultiDrawAttribs drawAttrs{_countof(DrawItems), DrawItems, DRAW_FLAG_VERIFY_ALL};
+    pContext->MultiDraw(drawAttrs);
+
+    Present();
+}
+
+TEST_F(DrawCommandTest, MultiDrawIndexed)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawPSO);
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {},
+        Vert[0], {}, Vert[1], {}, {}, Vert[2],
+        Vert[3], {}, {}, Vert[5], Vert[4]
+    };
+    const Uint32 Indices[] = {2,4,7, 0,0, 8,12,11};
+    // clang-format on
+
+    auto pVB = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    auto pIB = CreateIndexBuffer(Indices, _countof(Indices));
+
+    IBuffer*     pVBs[]    = {pVB};
+    const Uint64 Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    pContext->SetIndexBuffer(pIB, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const MultiDrawIndexedItem DrawItems[] = {{3, 0}, {3, 5}};
+
+    MultiDrawIndexedAttribs drawAttrs{_countof(DrawItems), DrawItems, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+    pContext->MultiDrawIndexed(drawAttrs);
+
+    Present();
+}
+
+TEST_F(DrawCommandTest, MultiDrawIndexed_IBOffset_BaseVertex)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawPSO);
+
+    // Every draw range uses its own base vertex
+    Uint32 bv0 = 2;
+    Uint32 bv1 = 8;
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {},
+        Vert[0], {}, Vert[1], {}, {}, Vert[2],
+        Vert[3], {}, {}, Vert[5], Vert[4]
+    };
+    const Uint32 Indices[] = {0,0,0,0, 2-bv0,4-bv0,7-bv0, 8-bv1,12-bv1,11-bv1};
+    // clang-format on
+
+    auto pVB = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    auto pIB = CreateIndexBuffer(Indices, _countof(Indices));
+
+    IBuffer*     pVBs[]    = {pVB};
+    const Uint64 Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    pContext->SetIndexBuffer(pIB, sizeof(Uint32) * 4, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const MultiDrawIndexedItem DrawItems[] = {{3, 0, bv0}, {3, 3, bv1}};
+
+    MultiDrawIndexedAttribs drawAttrs{_countof(DrawItems), DrawItems, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+    pContext->MultiDrawIndexed(drawAttrs);
+
+    Present();
+}
+
+TEST_F(DrawCommandTest, MultiDrawIndexedInstanced)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawInstancedPSO);
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {},
+        VertInst[1], {}, VertInst[0], {}, {}, VertInst[2]
+    };
+    // Both draw ranges draw the same triangle
+    const Uint32 Indices[] = {4, 2, 7, 0, 7, 4, 2};
+    const float4 InstancedData[] =
+    {
+        float4{0.5f,  0.5f,  -0.5f, -0.5f},
+        float4{0.5f,  0.5f,  +0.5f, -0.5f}
+    };
+    // clang-format on
+
+    auto pVB     = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    auto pInstVB = CreateVertexBuffer(InstancedData, sizeof(InstancedData));
+    auto pIB     = CreateIndexBuffer(Indices, _countof(Indices));
+
+    IBuffer*     pVBs[]    = {pVB, pInstVB};
+    const Uint64 Offsets[] = {0, 0};
+    pContext->SetVertexBuffers(0, _countof(pVBs), pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    pContext->SetIndexBuffer(pIB, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const MultiDrawIndexedItem DrawItems[] = {{3, 0}, {3, 4}};
+
+    MultiDrawIndexedAttribs drawAttrs{_countof(DrawItems), DrawItems, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+    drawAttrs.NumInstances = 2;
+    pContext->MultiDrawIndexed(drawAttrs);
+
+    Present();
+}
+
+
 // Instanced non-indexed draw calls (glDrawArraysInstanced/DrawInstanced)
 
 TEST_F(DrawCommandTest, DrawInstanced)
@@ -219,4 +219,70 @@ TEST(DynamicBufferTest, Resize)
     }
 }
 
+TEST(DynamicBufferTest, ChunkedResize)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    DynamicBufferCreateInfo CI;
+    CI.Desc.Name      = "Dynamic buffer chunked resize test";
+    CI.Desc.BindFlags = BIND_VERTEX_BUFFER;
+    CI.Desc.Size      = 300;
+    CI.GrowthMode     = DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED;
+    CI.ChunkSize      = 256;
+
+    DynamicBuffer DynBuff{nullptr, CI};
+    EXPECT_EQ(DynBuff.GetGrowthMode(), DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED);
+    EXPECT_EQ(DynBuff.GetChunkSize(), Uint64{256});
+    EXPECT_TRUE(DynBuff.PendingUpdate());
+    EXPECT_EQ(DynBuff.GetChunkCount(), Uint32{0});
+
+    auto* pChunk0 = DynBuff.GetBuffer(pDevice, nullptr);
+    ASSERT_NE(pChunk0, nullptr);
+    EXPECT_FALSE(DynBuff.PendingUpdate());
+    EXPECT_EQ(DynBuff.GetChunkCount(), Uint32{2});
+    EXPECT_EQ(DynBuff.GetVersion(), Uint32{1});
+    EXPECT_EQ(pChunk0->GetDesc().Size, Uint64{256});
+    EXPECT_EQ(DynBuff.GetDesc().Size, Uint64{300});
+
+    auto* pChunk1 = DynBuff.GetChunk(1);
+    ASSERT_NE(pChunk1, nullptr);
+
+    // Growing the buffer appends chunks and does not replace the existing ones
+    DynBuff.Resize(nullptr, nullptr, 1000);
+    EXPECT_TRUE(DynBuff.PendingUpdate());
+    EXPECT_EQ(DynBuff.GetBuffer(pDevice, nullptr), pChunk0);
+    EXPECT_FALSE(DynBuff.PendingUpdate());
+    EXPECT_EQ(DynBuff.GetChunkCount(), Uint32{4});
+    EXPECT_EQ(DynBuff.GetChunk(1), pChunk1);
+    EXPECT_EQ(DynBuff.GetVersion(), Uint32{2});
+
+    // The device context is not required
+    EXPECT_EQ(DynBuff.Resize(pDevice, nullptr, 2048), pChunk0);
+    EXPECT_EQ(DynBuff.GetChunkCount(), Uint32{8});
+    EXPECT_EQ(DynBuff.GetChunk(8), nullptr);
+
+    EXPECT_EQ(DynBuff.GetVersion(), Uint32{3});
+
+    // Shrinking releases the trailing chunks only, but still changes the version
+    EXPECT_EQ(DynBuff.Resize(nullptr, pContext, 512), pChunk0);
+    EXPECT_FALSE(DynBuff.PendingUpdate());
+    EXPECT_EQ(DynBuff.GetChunkCount(), Uint32{2});
+    EXPECT_EQ(DynBuff.GetChunk(1), pChunk1);
+    EXPECT_EQ(DynBuff.GetVersion(), Uint32{4});
+
+    // Shrinking within the last chunk does not release any chunks
+    EXPECT_EQ(DynBuff.Resize(nullptr, pContext, 400), pChunk0);
+    EXPECT_EQ(DynBuff.GetChunkCount(), Uint32{2});
+    EXPECT_EQ(DynBuff.GetVersion(), Uint32{4});
+
+    EXPECT_EQ(DynBuff.Resize(nullptr, nullptr, 0), nullptr);
+    EXPECT_FALSE(DynBuff.PendingUpdate());
+    EXPECT_EQ(DynBuff.GetChunkCount(), Uint32{0});
+    EXPECT_EQ(DynBuff.GetVersion(), Uint32{5});
+}
+
 } // namespace
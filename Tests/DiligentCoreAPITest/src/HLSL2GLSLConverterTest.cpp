@@ -25,8 +25,19 @@
  *  of the possibility of such damages.
  */
 
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <iostream>
+
 #include "TestingEnvironment.hpp"
 #include "HLSL2GLSLConverter.h"
+#include "Timer.hpp"
+#if GL_SUPPORTED || GLES_SUPPORTED
+#    include "EngineFactoryOpenGL.h"
+#endif
 
 #include "gtest/gtest.h"
 
@@ -146,4 +157,136 @@ TEST(HLSL2GLSLConverterTest, GS)
     EXPECT_NE(pGS, nullptr);
 }
 
+#if GL_SUPPORTED || GLES_SUPPORTED
+// Converts all test shaders from multiple threads using shared conversion streams,
+// with and without the conversion cache, and reports the conversion throughput.
+TEST(HLSL2GLSLConverterTest, MultithreadedConversion)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+    {
+        GTEST_SKIP() << "HLSL2GLSL converter object is only available in OpenGL backend";
+    }
+
+    RefCntAutoPtr<IEngineFactoryOpenGL> pFactoryGL{pDevice->GetEngineFactory(), IID_EngineFactoryOpenGL};
+    ASSERT_NE(pFactoryGL, nullptr);
+
+    RefCntAutoPtr<IHLSL2GLSLConverter> pConverter;
+    pFactoryGL->CreateHLSL2GLSLConverter(&pConverter);
+    ASSERT_NE(pConverter, nullptr);
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    struct ConversionInfo
+    {
+        const char* FileName;
+        const char* EntryPoint;
+        SHADER_TYPE ShaderType;
+    };
+    // clang-format off
+    static const ConversionInfo Conversions[] =
+    {
+        {"VS_PS.hlsl",        "TestVS", SHADER_TYPE_VERTEX  },
+        {"VS_PS.hlsl",        "TestPS", SHADER_TYPE_PIXEL   },
+        {"CS_RWTex1D.hlsl",   "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWTex2D_1.hlsl", "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWTex2D_2.hlsl", "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWBuff.hlsl",    "TestCS", SHADER_TYPE_COMPUTE },
+        {"GS.hlsl",           "main",   SHADER_TYPE_GEOMETRY}
+    };
+    // clang-format on
+    constexpr size_t NumConversions = _countof(Conversions);
+
+    auto Convert = [](IHLSL2GLSLConversionStream* pStream, const ConversionInfo& Info) {
+        RefCntAutoPtr<IDataBlob> pGLSLSource;
+        pStream->Convert(Info.EntryPoint, Info.ShaderType, true, "_sampler", true, &pGLSLSource);
+        return pGLSLSource ?
+            std::string{static_cast<const char*>(pGLSLSource->GetConstDataPtr()), pGLSLSource->GetSize()} :
+            std::string{};
+    };
+
+    HLSL2GLSLConversionCacheStats DefaultStats;
+    pConverter->GetConversionCacheStats(DefaultStats);
+    const auto DefaultCacheSize = static_cast<size_t>(DefaultStats.MaxSize);
+
+    // Reference sources are converted by a single thread without the cache
+    pConverter->SetConversionCacheSize(0);
+
+    std::vector<RefCntAutoPtr<IHLSL2GLSLConversionStream>> Streams(NumConversions);
+    std::vector<std::string>                               RefSources(NumConversions);
+    for (size_t i = 0; i < NumConversions; ++i)
+    {
+        pConverter->CreateStream(Conversions[i].FileName, pShaderSourceFactory, nullptr, 0, &Streams[i]);
+        ASSERT_NE(Streams[i], nullptr);
+        RefSources[i] = Convert(Streams[i], Conversions[i]);
+        ASSERT_FALSE(RefSources[i].empty());
+    }
+
+#    ifdef DILIGENT_DEBUG
+    constexpr size_t NumIterations = 2;
+#    else
+    constexpr size_t NumIterations = 8;
+#    endif
+    const size_t MaxThreads = std::max(4u, std::thread::hardware_concurrency());
+
+    for (bool UseCache : {false, true})
+    {
+        for (size_t NumThreads : {size_t{1}, MaxThreads})
+        {
+            pConverter->ClearConversionCache();
+            pConverter->SetConversionCacheSize(UseCache ? DefaultCacheSize : 0);
+
+            std::atomic<size_t> NumMismatches{0};
+
+            Timer ConversionTimer;
+            {
+                std::vector<std::thread> Threads(NumThreads);
+                for (size_t t = 0; t < Threads.size(); ++t)
+                {
+                    Threads[t] = std::thread{
+                        [&](size_t thread_id) //
+                        {
+                            for (size_t iter = 0; iter < NumIterations; ++iter)
+                            {
+                                for (size_t i = 0; i < NumConversions; ++i)
+                                {
+                                    // Start from different shaders to make threads use the same streams simultaneously
+                                    const auto idx = (i + thread_id) % NumConversions;
+                                    if (Convert(Streams[idx], Conversions[idx]) != RefSources[idx])
+                                        ++NumMismatches;
+                                }
+                            }
+                        },
+                        t //
+                    };
+                }
+
+                for (auto& Thread : Threads)
+                    Thread.join();
+            }
+            const auto ElapsedTime = ConversionTimer.GetElapsedTime();
+
+            EXPECT_EQ(NumMismatches, size_t{0});
+
+            const auto NumConverted = NumThreads * NumIterations * NumConversions;
+            std::cout << TestingEnvironment::GetCurrentTestStatusString() << ' '
+                      << (UseCache ? " Cache on, " : " Cache off,") << ' ' << NumThreads << " thread(s): "
+                      << NumConverted << " conversions in " << ElapsedTime * 1000.0 << " ms ("
+                      << static_cast<double>(NumConverted) / ElapsedTime << " conversions/s)" << std::endl;
+        }
+    }
+
+    HLSL2GLSLConversionCacheStats Stats;
+    pConverter->GetConversionCacheStats(Stats);
+    EXPECT_EQ(Stats.NumEntries, NumConversions);
+    EXPECT_LE(Stats.Size, Stats.MaxSize);
+
+    pConverter->ClearConversionCache();
+    pConverter->SetConversionCacheSize(DefaultCacheSize);
+}
+#endif
+
 } // namespace
@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <random>
 #include <unordered_map>
+#include <string>
+#include <vector>
 
 #include "TestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
@@ -2620,6 +2622,245 @@ static void RayTracingPRSTest(const int Mode)
 }
 
 
+TEST(RayTracingTest, TLASIndexAddressedUpdate)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().Features.RayTracing)
+    {
+        GTEST_SKIP() << "Ray tracing is not supported by this device";
+    }
+
+    TestingEnvironment::ScopedReleaseResources EnvironmentAutoReset;
+
+    const float3 Vertices[] = {float3{0, 0, 0}, float3{1, 0, 0}, float3{0, 1, 0}};
+
+    RefCntAutoPtr<IBuffer> pVertexBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Vertices";
+        BuffDesc.Usage     = USAGE_IMMUTABLE;
+        BuffDesc.BindFlags = BIND_RAY_TRACING;
+        BuffDesc.Size      = sizeof(Vertices);
+
+        BufferData BuffData{Vertices, sizeof(Vertices)};
+        pDevice->CreateBuffer(BuffDesc, &BuffData, &pVertexBuffer);
+        ASSERT_NE(pVertexBuffer, nullptr);
+    }
+
+    // BLASes with one and three geometries
+    RefCntAutoPtr<IBottomLevelAS> pBLASes[2];
+    for (Uint32 b = 0; b < _countof(pBLASes); ++b)
+    {
+        const char* GeometryNames[] = {"Geom 1", "Geom 2", "Geom 3"};
+
+        BLASBuildTriangleData Triangles[3] = {};
+        const Uint32          GeomCount    = b == 0 ? 1 : 3;
+        for (Uint32 i = 0; i < GeomCount; ++i)
+        {
+            Triangles[i].GeometryName         = GeometryNames[i];
+            Triangles[i].pVertexBuffer        = pVertexBuffer;
+            Triangles[i].VertexStride         = sizeof(Vertices[0]);
+            Triangles[i].VertexCount          = _countof(Vertices);
+            Triangles[i].VertexValueType      = VT_FLOAT32;
+            Triangles[i].VertexComponentCount = 3;
+            Triangles[i].Flags                = RAYTRACING_GEOMETRY_FLAG_OPAQUE;
+        }
+        CreateBLAS(pDevice, pContext, Triangles, GeomCount, RAYTRACING_BUILD_AS_NONE, pBLASes[b]);
+        ASSERT_NE(pBLASes[b], nullptr);
+        ASSERT_EQ(pBLASes[b]->GetActualGeometryCount(), GeomCount);
+    }
+
+    constexpr Uint32 InstanceCount  = 8;
+    constexpr Uint32 HitGroupStride = 2;
+
+    std::vector<std::string>           InstanceNames(InstanceCount);
+    std::vector<TLASBuildInstanceData> Instances(InstanceCount);
+    for (Uint32 i = 0; i < InstanceCount; ++i)
+    {
+        InstanceNames[i] = "Instance " + std::to_string(i);
+
+        Instances[i].InstanceName = InstanceNames[i].c_str();
+        Instances[i].pBLAS        = pBLASes[i % 2];
+        Instances[i].CustomId     = i;
+        Instances[i].Transform.SetTranslation(static_cast<float>(i), 0, 0);
+    }
+
+    TopLevelASDesc TLASDesc;
+    TLASDesc.Name             = "TLAS";
+    TLASDesc.MaxInstanceCount = InstanceCount;
+    TLASDesc.Flags            = RAYTRACING_BUILD_AS_ALLOW_UPDATE;
+
+    RefCntAutoPtr<ITopLevelAS> pTLAS;
+    pDevice->CreateTLAS(TLASDesc, &pTLAS);
+    ASSERT_NE(pTLAS, nullptr);
+
+    RefCntAutoPtr<IBuffer> pScratchBuffer;
+    RefCntAutoPtr<IBuffer> pInstanceBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "TLAS Scratch Buffer";
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        BuffDesc.BindFlags = BIND_RAY_TRACING;
+        BuffDesc.Size      = std::max(pTLAS->GetScratchBufferSizes().Build, pTLAS->GetScratchBufferSizes().Update);
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pScratchBuffer);
+        ASSERT_NE(pScratchBuffer, nullptr);
+
+        BuffDesc.Name = "TLAS Instance Buffer";
+        BuffDesc.Size = TLAS_INSTANCE_DATA_SIZE * InstanceCount;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pInstanceBuffer);
+        ASSERT_NE(pInstanceBuffer, nullptr);
+    }
+
+    BuildTLASAttribs Attribs;
+    Attribs.pTLAS                        = pTLAS;
+    Attribs.pInstances                   = Instances.data();
+    Attribs.InstanceCount                = InstanceCount;
+    Attribs.HitGroupStride               = HitGroupStride;
+    Attribs.BindingMode                  = HIT_GROUP_BINDING_MODE_PER_GEOMETRY;
+    Attribs.TLASTransitionMode           = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    Attribs.BLASTransitionMode           = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    Attribs.pInstanceBuffer              = pInstanceBuffer;
+    Attribs.InstanceBufferTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    Attribs.pScratchBuffer               = pScratchBuffer;
+    Attribs.ScratchBufferTransitionMode  = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+
+    // Hit group indices must be the same as if the TLAS was built from scratch
+    const auto CheckHitGroupIndices = [&]() //
+    {
+        Uint32 HitGroupIndex = 0;
+        for (Uint32 i = 0; i < InstanceCount; ++i)
+        {
+            const auto InstDesc = pTLAS->GetInstanceDesc(Instances[i].InstanceName);
+            EXPECT_EQ(InstDesc.InstanceIndex, i);
+            EXPECT_EQ(InstDesc.pBLAS, Instances[i].pBLAS);
+            EXPECT_EQ(InstDesc.ContributionToHitGroupIndex, HitGroupIndex) << "instance " << i;
+            HitGroupIndex += Instances[i].pBLAS->GetActualGeometryCount() * HitGroupStride;
+        }
+        EXPECT_EQ(pTLAS->GetBuildInfo().LastContributionToHitGroupIndex, HitGroupIndex - 1);
+    };
+
+    // The instance data written to the instance buffer has the same layout in Vulkan (VkAccelerationStructureInstanceKHR)
+    // and Direct3D12 (D3D12_RAYTRACING_INSTANCE_DESC).
+    struct InstanceData
+    {
+        float  Transform[3][4];
+        Uint32 CustomIdAndMask;
+        Uint32 HitGroupIndexAndFlags;
+        Uint64 BLASAddress;
+    };
+    static_assert(sizeof(InstanceData) == TLAS_INSTANCE_DATA_SIZE, "Unexpected instance data size");
+
+    const auto DeviceType = pDevice->GetDeviceInfo().Type;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    if (DeviceType == RENDER_DEVICE_TYPE_VULKAN || DeviceType == RENDER_DEVICE_TYPE_D3D12)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "TLAS Instance Staging Buffer";
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        BuffDesc.Size           = pInstanceBuffer->GetDesc().Size;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+        ASSERT_NE(pStagingBuffer, nullptr);
+    }
+
+    // Every instance in the instance buffer, including the ones that were not written by
+    // an index-addressed update, must match the instance data of the last build.
+    Uint64     BLASAddresses[_countof(pBLASes)] = {};
+    const auto CheckInstanceBuffer              = [&]() //
+    {
+        if (pStagingBuffer == nullptr)
+            return;
+
+        pContext->CopyBuffer(pInstanceBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, 0, pStagingBuffer->GetDesc().Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->WaitForIdle();
+
+        void* pMappedData = nullptr;
+        pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pMappedData);
+        ASSERT_NE(pMappedData, nullptr);
+
+        const auto* pInstData = static_cast<const InstanceData*>(pMappedData);
+        for (Uint32 i = 0; i < InstanceCount; ++i)
+        {
+            const auto& Inst = Instances[i];
+            const auto& Data = pInstData[i];
+
+            EXPECT_EQ(memcmp(Data.Transform, Inst.Transform.data, sizeof(Data.Transform)), 0) << "instance " << i;
+            EXPECT_EQ(Data.CustomIdAndMask & 0xFFFFFFu, Inst.CustomId) << "instance " << i;
+            EXPECT_EQ(Data.CustomIdAndMask >> 24u, Uint32{Inst.Mask}) << "instance " << i;
+            EXPECT_EQ(Data.HitGroupIndexAndFlags & 0xFFFFFFu, pTLAS->GetInstanceDesc(Inst.InstanceName).ContributionToHitGroupIndex) << "instance " << i;
+
+            const size_t BLASIdx = Inst.pBLAS == pBLASes[0] ? 0 : 1;
+            EXPECT_NE(Data.BLASAddress, Uint64{0}) << "instance " << i;
+            if (BLASAddresses[BLASIdx] == 0)
+                BLASAddresses[BLASIdx] = Data.BLASAddress;
+            else
+                EXPECT_EQ(Data.BLASAddress, BLASAddresses[BLASIdx]) << "instance " << i;
+        }
+        pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+
+        if (BLASAddresses[0] != 0 && BLASAddresses[1] != 0)
+            EXPECT_NE(BLASAddresses[0], BLASAddresses[1]);
+    };
+
+    pContext->BuildTLAS(Attribs);
+    CheckHitGroupIndices();
+    CheckInstanceBuffer();
+
+    Attribs.Update = true;
+
+    // Replace the BLAS of one instance, which shifts the hit group indices of all subsequent instances
+    {
+        const Uint32 DirtyIndices[] = {2};
+        Instances[2].pBLAS          = pBLASes[1];
+
+        Attribs.pDirtyInstanceIndices = DirtyIndices;
+        Attribs.DirtyInstanceCount    = _countof(DirtyIndices);
+        pContext->BuildTLAS(Attribs);
+        CheckHitGroupIndices();
+        CheckInstanceBuffer();
+    }
+
+    // Only move an instance
+    {
+        const Uint32 DirtyIndices[] = {5};
+        Instances[5].Transform.SetTranslation(0, 5, 0);
+
+        Attribs.pDirtyInstanceIndices = DirtyIndices;
+        Attribs.DirtyInstanceCount    = _countof(DirtyIndices);
+        pContext->BuildTLAS(Attribs);
+        CheckHitGroupIndices();
+        CheckInstanceBuffer();
+    }
+
+    // Unsorted dirty indices with duplicates, the changes of the first and the last instance cancel out
+    {
+        const Uint32 DirtyIndices[] = {7, 0, 7};
+        Instances[0].pBLAS          = pBLASes[1];
+        Instances[7].pBLAS          = pBLASes[0];
+
+        Attribs.pDirtyInstanceIndices = DirtyIndices;
+        Attribs.DirtyInstanceCount    = _countof(DirtyIndices);
+        pContext->BuildTLAS(Attribs);
+        CheckHitGroupIndices();
+        CheckInstanceBuffer();
+    }
+
+    // Name-addressed update after the index-addressed ones
+    {
+        Instances[4].pBLAS = pBLASes[1];
+
+        Attribs.pDirtyInstanceIndices = nullptr;
+        Attribs.DirtyInstanceCount    = 0;
+        pContext->BuildTLAS(Attribs);
+        CheckHitGroupIndices();
+        CheckInstanceBuffer();
+    }
+}
+
 TEST(RayTracingTest, Mtl_RayTracingWithoutPRS)
 {
     RayTracingPRSTest(0);
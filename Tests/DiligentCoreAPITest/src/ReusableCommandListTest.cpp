@@ -0,0 +1,154 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(ReusableCommandListTest, ExecuteMultipleTimes)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    const auto DeviceType = pDevice->GetDeviceInfo().Type;
+    if (DeviceType != RENDER_DEVICE_TYPE_D3D11 && DeviceType != RENDER_DEVICE_TYPE_D3D12 && DeviceType != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Reusable command lists are not supported by this device";
+    if (pEnv->GetNumDeferredContexts() == 0)
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+
+    auto* pDeferredCtx = pEnv->GetDeferredContext(0);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumElements = 1024;
+    constexpr Uint64 RegionSize  = NumElements * sizeof(Uint32);
+
+    std::vector<Uint32> RefData(NumElements * 2);
+    for (Uint32 i = 0; i < NumElements * 2; ++i)
+        RefData[i] = 0x01000000 + i;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Reusable command list test buffer";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.Size      = RegionSize * 2;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pDstBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pDstBuffer);
+    ASSERT_NE(pDstBuffer, nullptr);
+
+    BuffDesc.Name           = "Reusable command list test dynamic buffer";
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.Size           = RegionSize;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    RefCntAutoPtr<IBuffer> pDynamicBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pDynamicBuffer);
+    ASSERT_NE(pDynamicBuffer, nullptr);
+
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Reusable command list test staging buffer";
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    StagingDesc.Size           = RegionSize * 2;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    // The command list expects the destination buffer in COPY_SOURCE state
+    StateTransitionDesc Barrier{pDstBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pContext->TransitionResourceStates(1, &Barrier);
+    pContext->Flush();
+
+    // The deferred context must not have dynamic allocations from the current frame
+    pDeferredCtx->FinishFrame();
+
+    RefCntAutoPtr<ICommandList> pCmdList;
+    {
+        pDeferredCtx->Begin(pContext->GetDesc().ContextId, COMMAND_LIST_FLAG_REUSABLE);
+
+        // The first half is copied from the dynamic memory, the second half is written through the upload heap
+        void* pData = nullptr;
+        pDeferredCtx->MapBuffer(pDynamicBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+        ASSERT_NE(pData, nullptr);
+        memcpy(pData, RefData.data(), RegionSize);
+        pDeferredCtx->UnmapBuffer(pDynamicBuffer, MAP_WRITE);
+
+        pDeferredCtx->CopyBuffer(pDynamicBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                 pDstBuffer, 0, RegionSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pDeferredCtx->UpdateBuffer(pDstBuffer, RegionSize, RegionSize, &RefData[NumElements], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        pDeferredCtx->FinishCommandList(&pCmdList);
+        ASSERT_NE(pCmdList, nullptr);
+    }
+    // The command list owns the memory it references, so it remains valid after the end of the frame
+    pDeferredCtx->FinishFrame();
+    // States are updated when the command list is recorded, but the buffer remains in COPY_SOURCE state until the list is executed
+    pDstBuffer->SetState(RESOURCE_STATE_COPY_SOURCE);
+
+    const std::vector<Uint32> Zeros(NumElements * 2);
+    for (Uint32 iter = 0; iter < 3; ++iter)
+    {
+        pContext->UpdateBuffer(pDstBuffer, 0, RegionSize * 2, Zeros.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->TransitionResourceStates(1, &Barrier);
+
+        ICommandList* pCmdLists[] = {pCmdList};
+        pContext->ExecuteCommandLists(1, pCmdLists);
+        // Resource states are not tracked when the command list is executed
+        pDstBuffer->SetState(RESOURCE_STATE_COPY_DEST);
+
+        pContext->CopyBuffer(pDstBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, 0, RegionSize * 2, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->WaitForIdle();
+
+        void* pData = nullptr;
+        pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_EQ(memcmp(pData, RefData.data(), RegionSize * 2), 0) << "Buffer contents do not match the reference data after execution " << iter;
+        pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+
+        pContext->FinishFrame();
+    }
+
+    pCmdList.Release();
+    pContext->Flush();
+    pContext->FinishFrame();
+    pContext->WaitForIdle();
+}
+
+} // namespace
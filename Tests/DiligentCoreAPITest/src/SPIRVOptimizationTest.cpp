@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <vector>
+#include <iostream>
+
+#include "TestingEnvironment.hpp"
+#include "ShaderVk.h"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(SPIRVOptimizationTest, Profiles)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "SPIR-V optimization profiles are only supported in Vulkan";
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders;shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    struct ShaderInfo
+    {
+        const char* FilePath;
+        const char* EntryPoint;
+        SHADER_TYPE ShaderType;
+    };
+    // clang-format off
+    static const ShaderInfo Shaders[] =
+    {
+        {"SamplerCorrectness.hlsl",         "VSMain", SHADER_TYPE_VERTEX  },
+        {"SamplerCorrectness.hlsl",         "PSMain", SHADER_TYPE_PIXEL   },
+        {"ShaderResourceArrayTest.vsh",     "main",   SHADER_TYPE_VERTEX  },
+        {"ShaderResourceArrayTest.psh",     "main",   SHADER_TYPE_PIXEL   },
+        {"ShaderVariableAccessTestDX.vsh",  "main",   SHADER_TYPE_VERTEX  },
+        {"ShaderVariableAccessTestDX.psh",  "main",   SHADER_TYPE_PIXEL   },
+        {"VS_PS.hlsl",                      "TestVS", SHADER_TYPE_VERTEX  },
+        {"VS_PS.hlsl",                      "TestPS", SHADER_TYPE_PIXEL   },
+        {"CS_RWTex1D.hlsl",                 "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWTex2D_1.hlsl",               "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWTex2D_2.hlsl",               "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWBuff.hlsl",                  "TestCS", SHADER_TYPE_COMPUTE },
+        {"GS.hlsl",                         "main",   SHADER_TYPE_GEOMETRY}
+    };
+
+    struct ProfileInfo
+    {
+        const char*                 Name;
+        SHADER_OPTIMIZATION_PROFILE Profile;
+        const char*                 Passes;
+    };
+    static const ProfileInfo Profiles[] =
+    {
+        {"None",        SHADER_OPTIMIZATION_PROFILE_NONE,        nullptr},
+        {"Performance", SHADER_OPTIMIZATION_PROFILE_PERFORMANCE, nullptr},
+        {"Size",        SHADER_OPTIMIZATION_PROFILE_SIZE,        nullptr},
+        {"Custom",      SHADER_OPTIMIZATION_PROFILE_CUSTOM,      "--eliminate-dead-functions --eliminate-dead-code-aggressive --merge-blocks"}
+    };
+    // clang-format on
+
+    for (const auto& Profile : Profiles)
+    {
+        size_t TotalSize = 0;
+
+        Timer CompileTimer;
+        for (const auto& Info : Shaders)
+        {
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.FilePath                   = Info.FilePath;
+            ShaderCI.EntryPoint                 = Info.EntryPoint;
+            ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+            ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+            ShaderCI.Desc.Name                  = Info.FilePath;
+            ShaderCI.Desc.ShaderType            = Info.ShaderType;
+            ShaderCI.OptimizationProfile        = Profile.Profile;
+            ShaderCI.OptimizationPasses         = Profile.Passes;
+
+            RefCntAutoPtr<IShader> pShader;
+            pDevice->CreateShader(ShaderCI, &pShader);
+            ASSERT_NE(pShader, nullptr) << Info.FilePath << " (" << Info.EntryPoint << "), profile: " << Profile.Name;
+
+            RefCntAutoPtr<IShaderVk> pShaderVk{pShader, IID_ShaderVk};
+            ASSERT_NE(pShaderVk, nullptr);
+            TotalSize += pShaderVk->GetSPIRV().size() * sizeof(uint32_t);
+        }
+        const auto ElapsedTime = CompileTimer.GetElapsedTime();
+
+        std::cout << TestingEnvironment::GetCurrentTestStatusString() << ' '
+                  << Profile.Name << " profile: " << _countof(Shaders) << " shaders compiled in "
+                  << ElapsedTime * 1000.0 << " ms, total SPIR-V size: " << TotalSize << " bytes" << std::endl;
+    }
+}
+
+} // namespace
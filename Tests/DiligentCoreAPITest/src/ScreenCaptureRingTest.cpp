@@ -0,0 +1,232 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "ScreenCaptureRing.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<ITexture> CreateSourceTexture(IRenderDevice* pDevice, Uint32 Width, Uint32 Height)
+{
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Screen capture ring test source";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = Width;
+    TexDesc.Height    = Height;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_RENDER_TARGET;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    return pTexture;
+}
+
+void ClearTexture(IDeviceContext* pContext, ITexture* pTexture, const float* Color)
+{
+    ITextureView* pRTV = pTexture->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTV, Color, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+}
+
+TEST(ScreenCaptureRingTest, Native)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 Width  = 64;
+    constexpr Uint32 Height = 32;
+
+    auto pSrcTex = CreateSourceTexture(pDevice, Width, Height);
+    ASSERT_NE(pSrcTex, nullptr);
+
+    const bool CheckContents = pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_NULL;
+
+    std::vector<Uint32> DeliveredIds;
+
+    ScreenCaptureRingCreateInfo CI;
+    CI.pDevice      = pDevice;
+    CI.RingDepth    = 2;
+    CI.OnFrameReady = [&](const ScreenCaptureFrame& Frame) {
+        DeliveredIds.push_back(Frame.Id);
+        EXPECT_EQ(Frame.Width, Width);
+        EXPECT_EQ(Frame.Height, Height);
+        EXPECT_EQ(Frame.Format, SCREEN_CAPTURE_FORMAT_NATIVE);
+        EXPECT_EQ(Frame.TexFormat, TEX_FORMAT_RGBA8_UNORM);
+        EXPECT_EQ(Frame.pChromaData, nullptr);
+        ASSERT_NE(Frame.pData, nullptr);
+        EXPECT_GE(Frame.Stride, Uint64{Width} * 4);
+
+        if (CheckContents)
+        {
+            // Frame N is cleared to (N/4, 0, 0, 1)
+            const auto* pRow = static_cast<const Uint8*>(Frame.pData) + Frame.Stride * (Height / 2);
+            EXPECT_EQ(pRow[0], Frame.Id * 255 / 4);
+            EXPECT_EQ(pRow[1], 0);
+            EXPECT_EQ(pRow[3], 255);
+        }
+    };
+
+    ScreenCaptureRing Ring{CI};
+
+    for (Uint32 FrameId = 0; FrameId < 2; ++FrameId)
+    {
+        const float ClearColor[] = {static_cast<float>(FrameId) / 4.f, 0, 0, 1};
+        ClearTexture(pContext, pSrcTex, ClearColor);
+        EXPECT_TRUE(Ring.Capture(pSrcTex, pContext, FrameId));
+    }
+    EXPECT_EQ(Ring.GetNumPendingCaptures(), 2u);
+
+    // Both slots are busy until the context is flushed, so the frame must be dropped,
+    // unless the GPU has already finished the first capture.
+    if (!Ring.Capture(pSrcTex, pContext, 2))
+        EXPECT_EQ(Ring.GetStats().NumDropped, 1u);
+
+    Ring.Flush(pContext);
+    EXPECT_EQ(Ring.GetNumPendingCaptures(), 0u);
+    ASSERT_GE(DeliveredIds.size(), size_t{2});
+    for (size_t i = 0; i < DeliveredIds.size(); ++i)
+        EXPECT_EQ(DeliveredIds[i], static_cast<Uint32>(i));
+
+    const auto Stats = Ring.GetStats();
+    EXPECT_EQ(Stats.NumCaptured, DeliveredIds.size());
+    EXPECT_EQ(Stats.NumDelivered, DeliveredIds.size());
+    EXPECT_EQ(Stats.NumCaptured + Stats.NumDropped, 3u);
+    EXPECT_EQ(Stats.BytesDelivered, Uint64{Width} * Height * 4 * DeliveredIds.size());
+
+    Ring.ResetStats();
+    EXPECT_EQ(Ring.GetStats().NumDelivered, 0u);
+}
+
+TEST(ScreenCaptureRingTest, WaitForFreeSlot)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pSrcTex = CreateSourceTexture(pDevice, 16, 16);
+    ASSERT_NE(pSrcTex, nullptr);
+
+    Uint32 NumDelivered = 0;
+
+    ScreenCaptureRingCreateInfo CI;
+    CI.pDevice         = pDevice;
+    CI.RingDepth       = 2;
+    CI.WaitForFreeSlot = true;
+    CI.OnFrameReady    = [&](const ScreenCaptureFrame& Frame) {
+        EXPECT_EQ(Frame.Id, NumDelivered);
+        ++NumDelivered;
+    };
+
+    ScreenCaptureRing Ring{CI};
+    for (Uint32 FrameId = 0; FrameId < 5; ++FrameId)
+    {
+        EXPECT_TRUE(Ring.Capture(pSrcTex, pContext, FrameId));
+        EXPECT_LE(Ring.GetNumPendingCaptures(), 2u);
+    }
+    Ring.Flush(pContext);
+
+    EXPECT_EQ(NumDelivered, 5u);
+    EXPECT_EQ(Ring.GetStats().NumDropped, 0u);
+}
+
+TEST(ScreenCaptureRingTest, NV12)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+    if ((pDevice->GetTextureFormatInfoExt(TEX_FORMAT_R8_UNORM).BindFlags & BIND_UNORDERED_ACCESS) == 0)
+    {
+        GTEST_SKIP() << "R8_UNORM format does not support unordered access on this device";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // Odd dimensions are rounded up to a multiple of 2
+    constexpr Uint32 Width  = 33;
+    constexpr Uint32 Height = 17;
+
+    auto pSrcTex = CreateSourceTexture(pDevice, Width, Height);
+    ASSERT_NE(pSrcTex, nullptr);
+
+    const bool CheckContents = pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_NULL;
+
+    Uint32 NumDelivered = 0;
+
+    ScreenCaptureRingCreateInfo CI;
+    CI.pDevice      = pDevice;
+    CI.Format       = SCREEN_CAPTURE_FORMAT_NV12;
+    CI.OnFrameReady = [&](const ScreenCaptureFrame& Frame) {
+        ++NumDelivered;
+        EXPECT_EQ(Frame.Width, Width + 1);
+        EXPECT_EQ(Frame.Height, Height + 1);
+        EXPECT_EQ(Frame.Format, SCREEN_CAPTURE_FORMAT_NV12);
+        ASSERT_NE(Frame.pData, nullptr);
+        ASSERT_NE(Frame.pChromaData, nullptr);
+        EXPECT_EQ(static_cast<const Uint8*>(Frame.pChromaData), static_cast<const Uint8*>(Frame.pData) + Frame.Stride * Frame.Height);
+
+        if (CheckContents)
+        {
+            // White is (235, 128, 128) in BT.709 limited range
+            const auto* pLuma   = static_cast<const Uint8*>(Frame.pData);
+            const auto* pChroma = static_cast<const Uint8*>(Frame.pChromaData);
+            EXPECT_NEAR(pLuma[0], 235, 1);
+            EXPECT_NEAR(pChroma[0], 128, 1);
+            EXPECT_NEAR(pChroma[1], 128, 1);
+        }
+    };
+
+    ScreenCaptureRing Ring{CI};
+
+    const float ClearColor[] = {1, 1, 1, 1};
+    ClearTexture(pContext, pSrcTex, ClearColor);
+    EXPECT_TRUE(Ring.Capture(pSrcTex, pContext, 0));
+    Ring.Flush(pContext);
+
+    EXPECT_EQ(NumDelivered, 1u);
+    EXPECT_EQ(Ring.GetStats().BytesDelivered, Uint64{Width + 1} * (Height + 1) * 3 / 2);
+}
+
+} // namespace
@@ -0,0 +1,248 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <unordered_set>
+
+#if VULKAN_SUPPORTED
+#    define VK_NO_PROTOTYPES
+#    include "vulkan/vulkan.h"
+#endif
+
+#include "DeviceContextVk.h"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Command buffers are allocated from per-frame command pools that are reset when the GPU is done with
+// the frame. Buffers are never reset individually, so a buffer can only be reused after its pool has been
+// reset. This test checks that command buffers of completed frames are reused and that the commands
+// recorded into the reused buffers are executed correctly.
+TEST(CommandBufferPoolTestVk, ReuseAfterPoolReset)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is Vulkan-specific";
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_NE(pContextVk, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumFrames          = 4;
+    constexpr Uint32 NumCmdBuffPerFrame = 3;
+    constexpr Uint32 NumElements        = NumFrames * NumCmdBuffPerFrame;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Command buffer pool test buffer";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.Size      = NumElements * sizeof(Uint32);
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Command buffer pool test staging buffer";
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    StagingDesc.Size           = BuffDesc.Size;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    // Retire the command pool that has been used so far
+    pContext->Flush();
+    pContext->FinishFrame();
+    pContext->WaitForIdle();
+
+    std::unordered_set<VkCommandBuffer> FirstFrameCmdBuffers;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        std::unordered_set<VkCommandBuffer> FrameCmdBuffers;
+        for (Uint32 i = 0; i < NumCmdBuffPerFrame; ++i)
+        {
+            const Uint32 Idx   = frame * NumCmdBuffPerFrame + i;
+            const Uint32 Value = 0x01000000 + Idx;
+            pContext->UpdateBuffer(pBuffer, Idx * sizeof(Uint32), sizeof(Uint32), &Value, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+            auto vkCmdBuff = pContextVk->GetVkCommandBuffer();
+            ASSERT_NE(vkCmdBuff, VK_NULL_HANDLE);
+            EXPECT_TRUE(FrameCmdBuffers.insert(vkCmdBuff).second) << "Command buffer is used twice in frame " << frame;
+
+            pContext->Flush();
+        }
+
+        if (frame == 0)
+        {
+            FirstFrameCmdBuffers = FrameCmdBuffers;
+        }
+        else
+        {
+            // The pool of the previous frame has been reset when its command buffers were returned
+            // after the GPU finished the frame, so the same command buffers must be reused.
+            EXPECT_EQ(FrameCmdBuffers, FirstFrameCmdBuffers) << "Command buffers of frame " << frame << " have not been reused";
+        }
+
+        pContext->FinishFrame();
+        // Make sure the GPU is done with the frame so that its command buffers are returned to the pool
+        pContext->WaitForIdle();
+    }
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, BuffDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    const auto* pValues = static_cast<const Uint32*>(pData);
+    for (Uint32 i = 0; i < NumElements; ++i)
+        EXPECT_EQ(pValues[i], 0x01000000 + i) << "Commands recorded into command buffer " << i << " have not been executed";
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+
+    pContext->FinishFrame();
+}
+
+// Command buffers of reusable command lists may be kept for any number of frames. This test checks that
+// such a buffer does not prevent the frame pool of the deferred context from being reset.
+TEST(CommandBufferPoolTestVk, ReusableCommandListDoesNotBlockPoolReset)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is Vulkan-specific";
+    if (pEnv->GetNumDeferredContexts() == 0)
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+
+    auto* pDeferredCtx = pEnv->GetDeferredContext(0);
+
+    RefCntAutoPtr<IDeviceContextVk> pDeferredCtxVk{pDeferredCtx, IID_DeviceContextVk};
+    ASSERT_NE(pDeferredCtxVk, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumFrames   = 4;
+    constexpr Uint32 NumElements = NumFrames + 1;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Command buffer pool test buffer";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.Size      = NumElements * sizeof(Uint32);
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Command buffer pool test staging buffer";
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    StagingDesc.Size           = BuffDesc.Size;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    const auto ContextId = pContext->GetDesc().ContextId;
+
+    pDeferredCtx->FinishFrame();
+
+    // The reusable command list writes the last element and is kept alive during all frames
+    RefCntAutoPtr<ICommandList> pReusableCmdList;
+    {
+        pDeferredCtx->Begin(ContextId, COMMAND_LIST_FLAG_REUSABLE);
+        const Uint32 Value = 0x01000000 + NumFrames;
+        pDeferredCtx->UpdateBuffer(pBuffer, NumFrames * sizeof(Uint32), sizeof(Uint32), &Value, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pDeferredCtx->FinishCommandList(&pReusableCmdList);
+        ASSERT_NE(pReusableCmdList, nullptr);
+    }
+    pDeferredCtx->FinishFrame();
+
+    VkCommandBuffer FirstFrameCmdBuffer = VK_NULL_HANDLE;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        pDeferredCtx->Begin(ContextId);
+        const Uint32 Value = 0x01000000 + frame;
+        pDeferredCtx->UpdateBuffer(pBuffer, frame * sizeof(Uint32), sizeof(Uint32), &Value, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        auto vkCmdBuff = pDeferredCtxVk->GetVkCommandBuffer();
+        ASSERT_NE(vkCmdBuff, VK_NULL_HANDLE);
+        if (frame == 0)
+            FirstFrameCmdBuffer = vkCmdBuff;
+        else
+            EXPECT_EQ(vkCmdBuff, FirstFrameCmdBuffer) << "Command buffer of frame " << frame << " has not been reused";
+
+        RefCntAutoPtr<ICommandList> pCmdList;
+        pDeferredCtx->FinishCommandList(&pCmdList);
+        ASSERT_NE(pCmdList, nullptr);
+
+        ICommandList* pCmdLists[] = {pCmdList};
+        pContext->ExecuteCommandLists(1, pCmdLists);
+        pCmdList.Release();
+
+        pDeferredCtx->FinishFrame();
+        pContext->FinishFrame();
+        // Make sure the GPU is done with the frame so that its command buffers are returned to the pool
+        pContext->WaitForIdle();
+    }
+
+    {
+        ICommandList* pCmdLists[] = {pReusableCmdList};
+        pContext->ExecuteCommandLists(1, pCmdLists);
+        pBuffer->SetState(RESOURCE_STATE_COPY_DEST);
+    }
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, BuffDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    const auto* pValues = static_cast<const Uint32*>(pData);
+    for (Uint32 i = 0; i < NumElements; ++i)
+        EXPECT_EQ(pValues[i], 0x01000000 + i);
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+
+    pReusableCmdList.Release();
+    pContext->FinishFrame();
+    pContext->WaitForIdle();
+}
+
+} // namespace
@@ -0,0 +1,295 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+#include "PipelineStateVk.h"
+#include "RenderPassVk.h"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor);
+
+} // namespace Testing
+
+} // namespace Diligent
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class DynamicRenderingTestVk : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+        if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+            return;
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.UseCombinedTextureSamplers = true;
+        ShaderCI.EntryPoint                 = "main";
+
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.Desc.Name       = "Dynamic rendering test vertex shader";
+        ShaderCI.Source          = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &sm_pVS);
+
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.Desc.Name       = "Dynamic rendering test pixel shader";
+        ShaderCI.Source          = HLSL::DrawTest_PS.c_str();
+        pDevice->CreateShader(ShaderCI, &sm_pPS);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_pVS.Release();
+        sm_pPS.Release();
+        TestingEnvironment::GetInstance()->Reset();
+    }
+
+    static RefCntAutoPtr<IPipelineState> CreatePSO(IRenderPass* pRenderPass)
+    {
+        auto* pEnv       = TestingEnvironment::GetInstance();
+        auto* pDevice    = pEnv->GetDevice();
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+        auto& PSODesc          = PSOCreateInfo.PSODesc;
+        auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+        PSODesc.Name = "Dynamic rendering test PSO";
+
+        PSODesc.PipelineType                          = PIPELINE_TYPE_GRAPHICS;
+        GraphicsPipeline.pRenderPass                  = pRenderPass;
+        GraphicsPipeline.NumRenderTargets             = pRenderPass == nullptr ? 1 : 0;
+        GraphicsPipeline.RTVFormats[0]                = pRenderPass == nullptr ? pSwapChain->GetDesc().ColorBufferFormat : TEX_FORMAT_UNKNOWN;
+        GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+        PSOCreateInfo.pVS = sm_pVS;
+        PSOCreateInfo.pPS = sm_pPS;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        return pPSO;
+    }
+
+    static RefCntAutoPtr<IShader> sm_pVS;
+    static RefCntAutoPtr<IShader> sm_pPS;
+};
+
+RefCntAutoPtr<IShader> DynamicRenderingTestVk::sm_pVS;
+RefCntAutoPtr<IShader> DynamicRenderingTestVk::sm_pPS;
+
+// Pipelines without an explicit render pass do not have an internal render pass when
+// dynamic rendering is supported, but must still render correctly.
+TEST_F(DynamicRenderingTestVk, ImplicitRenderPass)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is specific to Vulkan";
+
+    ASSERT_NE(sm_pVS, nullptr);
+    ASSERT_NE(sm_pPS, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pPSO = CreatePSO(nullptr);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IPipelineStateVk> pPSOVk{pPSO, IID_PipelineStateVk};
+    ASSERT_NE(pPSOVk, nullptr);
+
+    const bool DynamicRenderingSupported = TestingEnvironmentVk::GetInstance()->DynamicRendering.dynamicRendering != VK_FALSE;
+    if (DynamicRenderingSupported)
+    {
+        EXPECT_EQ(pPSOVk->GetRenderPass(), nullptr);
+    }
+    else
+    {
+        ASSERT_NE(pPSOVk->GetRenderPass(), nullptr);
+        EXPECT_NE(pPSOVk->GetRenderPass()->GetVkRenderPass(), VK_NULL_HANDLE);
+    }
+
+    constexpr float ClearColor[] = {0.25f, 0.5f, 0.75f, 1.0f};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->Draw(DrawAttribs{6, DRAW_FLAG_VERIFY_ALL});
+
+    pSwapChain->Present();
+
+    pContext->Flush();
+    pContext->InvalidateState();
+}
+
+// When dynamic rendering is supported, SetRenderTargets must not use the implicit
+// render pass and framebuffer caches.
+TEST_F(DynamicRenderingTestVk, SetRenderTargetsBypassesCaches)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is specific to Vulkan";
+
+    ASSERT_NE(sm_pVS, nullptr);
+    ASSERT_NE(sm_pPS, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    auto pPSO = CreatePSO(nullptr);
+    ASSERT_NE(pPSO, nullptr);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Dynamic rendering test render target";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Format    = pSwapChain->GetDesc().ColorBufferFormat;
+    TexDesc.Width     = 256;
+    TexDesc.Height    = 256;
+    TexDesc.BindFlags = BIND_RENDER_TARGET;
+
+    // Use a new texture so that no framebuffer for its view can be in the cache
+    RefCntAutoPtr<ITexture> pRenderTarget;
+    pDevice->CreateTexture(TexDesc, nullptr, &pRenderTarget);
+    ASSERT_NE(pRenderTarget, nullptr);
+
+    // Pipeline creation may use the render pass cache when dynamic rendering is not supported
+    const auto StatsBefore = pDeviceVk->GetRenderPassCacheStats();
+
+    constexpr float ClearColor[] = {0.25f, 0.5f, 0.75f, 1.0f};
+
+    ITextureView* pRTVs[] = {pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->Draw(DrawAttribs{6, DRAW_FLAG_VERIFY_ALL});
+    pContext->Flush();
+
+    const auto StatsAfter = pDeviceVk->GetRenderPassCacheStats();
+
+    const bool DynamicRenderingSupported = TestingEnvironmentVk::GetInstance()->DynamicRendering.dynamicRendering != VK_FALSE;
+    if (DynamicRenderingSupported)
+    {
+        EXPECT_EQ(StatsAfter.RenderPassCreationCount, StatsBefore.RenderPassCreationCount);
+        EXPECT_EQ(StatsAfter.RenderPassHitCount, StatsBefore.RenderPassHitCount);
+        EXPECT_EQ(StatsAfter.FramebufferCreationCount, StatsBefore.FramebufferCreationCount);
+        EXPECT_EQ(StatsAfter.FramebufferHitCount, StatsBefore.FramebufferHitCount);
+    }
+    else
+    {
+        // There is no framebuffer for the view of the new texture in the cache
+        EXPECT_EQ(StatsAfter.FramebufferCreationCount, StatsBefore.FramebufferCreationCount + 1);
+        EXPECT_GT(StatsAfter.RenderPassHitCount + StatsAfter.RenderPassCreationCount,
+                  StatsBefore.RenderPassHitCount + StatsBefore.RenderPassCreationCount);
+    }
+
+    pContext->InvalidateState();
+}
+
+// Pipelines created with an explicit render pass always return it.
+TEST_F(DynamicRenderingTestVk, ExplicitRenderPass)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is specific to Vulkan";
+
+    ASSERT_NE(sm_pVS, nullptr);
+    ASSERT_NE(sm_pPS, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RenderPassAttachmentDesc Attachments[1];
+    Attachments[0].Format       = pSwapChain->GetDesc().ColorBufferFormat;
+    Attachments[0].InitialState = RESOURCE_STATE_RENDER_TARGET;
+    Attachments[0].FinalState   = RESOURCE_STATE_RENDER_TARGET;
+    Attachments[0].LoadOp       = ATTACHMENT_LOAD_OP_CLEAR;
+    Attachments[0].StoreOp      = ATTACHMENT_STORE_OP_STORE;
+
+    AttachmentReference RTAttachmentRefs[] = {{0, RESOURCE_STATE_RENDER_TARGET}};
+
+    SubpassDesc Subpasses[1];
+    Subpasses[0].RenderTargetAttachmentCount = _countof(RTAttachmentRefs);
+    Subpasses[0].pRenderTargetAttachments    = RTAttachmentRefs;
+
+    RenderPassDesc RPDesc;
+    RPDesc.Name            = "Dynamic rendering test render pass";
+    RPDesc.AttachmentCount = _countof(Attachments);
+    RPDesc.pAttachments    = Attachments;
+    RPDesc.SubpassCount    = _countof(Subpasses);
+    RPDesc.pSubpasses      = Subpasses;
+
+    RefCntAutoPtr<IRenderPass> pRenderPass;
+    pDevice->CreateRenderPass(RPDesc, &pRenderPass);
+    ASSERT_NE(pRenderPass, nullptr);
+
+    auto pPSO = CreatePSO(pRenderPass);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IPipelineStateVk> pPSOVk{pPSO, IID_PipelineStateVk};
+    ASSERT_NE(pPSOVk, nullptr);
+
+    RefCntAutoPtr<IRenderPassVk> pRenderPassVk{pRenderPass, IID_RenderPassVk};
+    ASSERT_NE(pRenderPassVk, nullptr);
+
+    ASSERT_NE(pPSOVk->GetRenderPass(), nullptr);
+    EXPECT_EQ(pPSOVk->GetRenderPass()->GetVkRenderPass(), pRenderPassVk->GetVkRenderPass());
+}
+
+} // namespace
@@ -0,0 +1,250 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BasicMath.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Checks the mip levels generated by the compute shader against the CPU implementation of the same filter:
+// every texel is the average of the 2x2 texels of the previous mip level, and the texels that are outside
+// of the previous mip level replicate its edge texels. Float textures are used so that the intermediate
+// mip levels that the shader keeps in registers and shared memory match the stored ones.
+class GenerateMipsTestVk : public testing::Test
+{
+protected:
+    static constexpr TEXTURE_FORMAT Format = TEX_FORMAT_RGBA32_FLOAT;
+
+    struct MipLevelData
+    {
+        Uint32              Width  = 0;
+        Uint32              Height = 0;
+        std::vector<float4> Texels;
+
+        const float4& GetClamped(Uint32 x, Uint32 y) const
+        {
+            return Texels[size_t{std::min(y, Height - 1)} * Width + std::min(x, Width - 1)];
+        }
+    };
+
+    void SetUp() override
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+        if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+            GTEST_SKIP() << "This test is specific to Vulkan";
+        if ((pDevice->GetTextureFormatInfoExt(Format).BindFlags & BIND_UNORDERED_ACCESS) == 0)
+            GTEST_SKIP() << "Storage images of RGBA32_FLOAT format are not supported by this device";
+    }
+
+    static MipLevelData CreateSourceMip(Uint32 Width, Uint32 Height, Uint32 Slice)
+    {
+        MipLevelData Mip;
+        Mip.Width  = Width;
+        Mip.Height = Height;
+        Mip.Texels.resize(size_t{Width} * Height);
+        for (Uint32 y = 0; y < Height; ++y)
+        {
+            for (Uint32 x = 0; x < Width; ++x)
+            {
+                // Pseudo-random values make any error in the sampling positions visible
+                Mip.Texels[size_t{y} * Width + x] = float4{
+                    static_cast<float>((x * 73u + y * 151u + Slice * 19u) % 256u) / 255.f,
+                    static_cast<float>(x) / static_cast<float>(Width),
+                    static_cast<float>(y) / static_cast<float>(Height),
+                    static_cast<float>(Slice + 1u) * 0.125f,
+                };
+            }
+        }
+        return Mip;
+    }
+
+    static MipLevelData ComputeNextMip(const MipLevelData& Src)
+    {
+        MipLevelData Dst;
+        Dst.Width  = std::max(Src.Width / 2u, 1u);
+        Dst.Height = std::max(Src.Height / 2u, 1u);
+        Dst.Texels.resize(size_t{Dst.Width} * Dst.Height);
+        for (Uint32 y = 0; y < Dst.Height; ++y)
+        {
+            for (Uint32 x = 0; x < Dst.Width; ++x)
+            {
+                Dst.Texels[size_t{y} * Dst.Width + x] =
+                    (Src.GetClamped(x * 2, y * 2) + Src.GetClamped(x * 2 + 1, y * 2) +
+                     Src.GetClamped(x * 2, y * 2 + 1) + Src.GetClamped(x * 2 + 1, y * 2 + 1)) *
+                    0.25f;
+            }
+        }
+        return Dst;
+    }
+
+    static void Test(RESOURCE_DIMENSION Type, Uint32 Width, Uint32 Height, Uint32 ArraySize, Uint32 MipLevels)
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pDevice  = pEnv->GetDevice();
+        auto* pContext = pEnv->GetDeviceContext();
+
+        TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Generate mips test texture";
+        TexDesc.Type      = Type;
+        TexDesc.Format    = Format;
+        TexDesc.Width     = Width;
+        TexDesc.Height    = Height;
+        TexDesc.ArraySize = ArraySize;
+        TexDesc.MipLevels = MipLevels;
+        // BIND_UNORDERED_ACCESS enables the compute shader path
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+        TexDesc.Usage     = USAGE_DEFAULT;
+        TexDesc.MiscFlags = MISC_TEXTURE_FLAG_GENERATE_MIPS;
+
+        RefCntAutoPtr<ITexture> pTex;
+        pDevice->CreateTexture(TexDesc, nullptr, &pTex);
+        ASSERT_NE(pTex, nullptr) << "Failed to create texture: " << TexDesc;
+        // Full mip chain
+        MipLevels = pTex->GetDesc().MipLevels;
+
+        std::vector<MipLevelData> SrcMips(ArraySize);
+        for (Uint32 Slice = 0; Slice < ArraySize; ++Slice)
+        {
+            SrcMips[Slice] = CreateSourceMip(Width, Height, Slice);
+
+            TextureSubResData SubresData{SrcMips[Slice].Texels.data(), Uint64{Width} * sizeof(float4)};
+            Box               Region{0, Width, 0, Height};
+            pContext->UpdateTexture(pTex, 0, Slice, Region, SubresData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+
+        pContext->GenerateMips(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+
+        auto StagingDesc           = pTex->GetDesc();
+        StagingDesc.Name           = "Generate mips test staging texture";
+        StagingDesc.Type           = RESOURCE_DIM_TEX_2D_ARRAY;
+        StagingDesc.BindFlags      = BIND_NONE;
+        StagingDesc.Usage          = USAGE_STAGING;
+        StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        StagingDesc.MiscFlags      = MISC_TEXTURE_FLAG_NONE;
+
+        RefCntAutoPtr<ITexture> pStagingTex;
+        pDevice->CreateTexture(StagingDesc, nullptr, &pStagingTex);
+        ASSERT_NE(pStagingTex, nullptr) << "Failed to create staging texture: " << StagingDesc;
+
+        for (Uint32 Slice = 0; Slice < ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 1; Mip < MipLevels; ++Mip)
+            {
+                CopyTextureAttribs CopyAttribs{pTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+                CopyAttribs.SrcMipLevel = Mip;
+                CopyAttribs.SrcSlice    = Slice;
+                CopyAttribs.DstMipLevel = Mip;
+                CopyAttribs.DstSlice    = Slice;
+                pContext->CopyTexture(CopyAttribs);
+            }
+        }
+        pContext->WaitForIdle();
+
+        for (Uint32 Slice = 0; Slice < ArraySize; ++Slice)
+        {
+            auto RefMip = SrcMips[Slice];
+            for (Uint32 Mip = 1; Mip < MipLevels; ++Mip)
+            {
+                RefMip = ComputeNextMip(RefMip);
+
+                MappedTextureSubresource MappedData;
+                pContext->MapTextureSubresource(pStagingTex, Mip, Slice, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+                ASSERT_NE(MappedData.pData, nullptr);
+
+                Uint32 NumMismatches = 0;
+                for (Uint32 y = 0; y < RefMip.Height && NumMismatches == 0; ++y)
+                {
+                    const auto* pRow = reinterpret_cast<const float4*>(static_cast<const Uint8*>(MappedData.pData) + MappedData.Stride * y);
+                    for (Uint32 x = 0; x < RefMip.Width; ++x)
+                    {
+                        const auto& Ref = RefMip.Texels[size_t{y} * RefMip.Width + x];
+                        const auto  Val = pRow[x];
+                        if (std::abs(Val.x - Ref.x) > 1e-5f || std::abs(Val.y - Ref.y) > 1e-5f ||
+                            std::abs(Val.z - Ref.z) > 1e-5f || std::abs(Val.w - Ref.w) > 1e-5f)
+                        {
+                            ++NumMismatches;
+                            ADD_FAILURE() << "Mip " << Mip << " (" << RefMip.Width << "x" << RefMip.Height << "), slice " << Slice
+                                          << ", texel (" << x << ", " << y << "): expected (" << Ref.x << ", " << Ref.y << ", " << Ref.z << ", " << Ref.w
+                                          << "), got (" << Val.x << ", " << Val.y << ", " << Val.z << ", " << Val.w << ")";
+                            break;
+                        }
+                    }
+                }
+
+                pContext->UnmapTextureSubresource(pStagingTex, Mip, Slice);
+            }
+        }
+    }
+};
+
+TEST_F(GenerateMipsTestVk, NonPowerOfTwo)
+{
+    // Odd sizes of several mip levels skip the last row and column
+    Test(RESOURCE_DIM_TEX_2D, 133, 75, 1, 0);
+}
+
+TEST_F(GenerateMipsTestVk, NonPowerOfTwoArray)
+{
+    // Only a part of the mip chain is generated
+    Test(RESOURCE_DIM_TEX_2D_ARRAY, 97, 130, 3, 5);
+}
+
+TEST_F(GenerateMipsTestVk, Cube)
+{
+    Test(RESOURCE_DIM_TEX_CUBE, 64, 64, 6, 0);
+}
+
+TEST_F(GenerateMipsTestVk, TwelveMipsInOneDispatch)
+{
+    // The 4096-texel source produces 12 mip levels in a single dispatch,
+    // the last 6 of which are computed by the last work group of the slice.
+    Test(RESOURCE_DIM_TEX_2D, 4096, 8, 1, 0);
+}
+
+TEST_F(GenerateMipsTestVk, MultipleDispatches)
+{
+    // Sources larger than 4096 texels are reduced by at most 6 mip levels per dispatch
+    const auto& TexProps = TestingEnvironment::GetInstance()->GetDevice()->GetAdapterInfo().Texture;
+    if (TexProps.MaxTexture2DDimension < 4104)
+        GTEST_SKIP() << "4104x40 textures are not supported by this device";
+
+    Test(RESOURCE_DIM_TEX_2D, 4104, 40, 1, 0);
+}
+
+} // namespace
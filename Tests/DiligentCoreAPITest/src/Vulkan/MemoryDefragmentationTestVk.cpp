@@ -0,0 +1,318 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#if VULKAN_SUPPORTED
+#    define VK_NO_PROTOTYPES
+#    include "vulkan/vulkan.h"
+#endif
+
+#include "DeviceContextVk.h"
+#include "BufferVk.h"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+std::vector<Uint32> GetBufferData(Uint32 BufferIdx, Uint32 NumElements)
+{
+    std::vector<Uint32> Data(NumElements);
+    for (Uint32 i = 0; i < NumElements; ++i)
+        Data[i] = BufferIdx * 65536 + i;
+    return Data;
+}
+
+// Creates vertex buffers, then releases most buffers from the first half and fewer buffers
+// from the second half so that the pages become sparse with different occupancy.
+void CreateSparseVertexBuffers(Uint32 NumBuffers, Uint32 NumElements, std::vector<RefCntAutoPtr<IBuffer>>& pBuffers)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    const Uint64 BufferSize = NumElements * sizeof(Uint32);
+
+    pBuffers.resize(NumBuffers);
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Defragmentation test vertex buffer";
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        BuffDesc.Size      = BufferSize;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+        const auto Data = GetBufferData(i, NumElements);
+
+        BufferData InitData;
+        InitData.pData    = Data.data();
+        InitData.DataSize = BufferSize;
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pBuffers[i]);
+        ASSERT_NE(pBuffers[i], nullptr);
+    }
+
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        if (i < NumBuffers / 2 ? (i % 8 != 0) : (i % 8 >= 3))
+            pBuffers[i].Release();
+    }
+    pContext->Flush();
+    pContext->FinishFrame();
+    pContext->WaitForIdle();
+}
+
+// Records a command list that copies the buffers from the sparsest pages to another buffer, runs
+// the defragmentation pass before every execution of the list and checks that the buffers used by
+// the list have not been moved and the list reads their original contents.
+void TestBuffersUsedByCommandList(COMMAND_LIST_FLAGS Flags, Uint32 NumExecutions)
+{
+    auto* pEnv         = TestingEnvironment::GetInstance();
+    auto* pDevice      = pEnv->GetDevice();
+    auto* pContext     = pEnv->GetDeviceContext();
+    auto* pDeferredCtx = pEnv->GetDeferredContext(0);
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_NE(pContextVk, nullptr);
+
+    constexpr Uint32 NumBuffers  = 128;
+    constexpr Uint32 NumElements = 16384;
+    constexpr Uint64 BufferSize  = NumElements * sizeof(Uint32);
+
+    std::vector<RefCntAutoPtr<IBuffer>> pBuffers;
+    ASSERT_NO_FATAL_FAILURE(CreateSparseVertexBuffers(NumBuffers, NumElements, pBuffers));
+
+    std::vector<Uint32> UsedBuffers;
+    for (Uint32 i = 0; i < NumBuffers / 2; ++i)
+    {
+        if (pBuffers[i])
+            UsedBuffers.push_back(i);
+    }
+    const auto NumUsedBuffers = static_cast<Uint32>(UsedBuffers.size());
+    ASSERT_GT(NumUsedBuffers, 0u);
+
+    BufferDesc DstDesc;
+    DstDesc.Name      = "Defragmentation test destination buffer";
+    DstDesc.Usage     = USAGE_DEFAULT;
+    DstDesc.Size      = BufferSize * NumUsedBuffers;
+    DstDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pDstBuffer;
+    pDevice->CreateBuffer(DstDesc, nullptr, &pDstBuffer);
+    ASSERT_NE(pDstBuffer, nullptr);
+
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Defragmentation test staging buffer";
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    StagingDesc.Size           = DstDesc.Size;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    // The command list expects the source buffers in COPY_SOURCE state and the destination buffer in COPY_DEST state
+    std::vector<StateTransitionDesc> Barriers;
+    for (auto i : UsedBuffers)
+        Barriers.emplace_back(pBuffers[i], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE);
+    Barriers.emplace_back(pDstBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE);
+    pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+    pContext->Flush();
+
+    // The deferred context must not have dynamic allocations from the current frame
+    pDeferredCtx->FinishFrame();
+
+    RefCntAutoPtr<ICommandList> pCmdList;
+    pDeferredCtx->Begin(pContext->GetDesc().ContextId, Flags);
+    for (Uint32 i = 0; i < NumUsedBuffers; ++i)
+    {
+        pDeferredCtx->CopyBuffer(pBuffers[UsedBuffers[i]], 0, RESOURCE_STATE_TRANSITION_MODE_VERIFY,
+                                 pDstBuffer, BufferSize * i, BufferSize, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+    }
+    pDeferredCtx->FinishCommandList(&pCmdList);
+    ASSERT_NE(pCmdList, nullptr);
+    pDeferredCtx->FinishFrame();
+
+    std::vector<VkBuffer> vkBuffers;
+    for (auto i : UsedBuffers)
+        vkBuffers.push_back(RefCntAutoPtr<IBufferVk>{pBuffers[i], IID_BufferVk}->GetVkBuffer());
+
+    for (Uint32 iter = 0; iter < NumExecutions; ++iter)
+    {
+        // Move as many buffers as possible before the command list is executed
+        pContextVk->DefragmentMemory(~Uint64{0});
+        for (Uint32 i = 0; i < NumUsedBuffers; ++i)
+        {
+            EXPECT_EQ(RefCntAutoPtr<IBufferVk>(pBuffers[UsedBuffers[i]], IID_BufferVk)->GetVkBuffer(), vkBuffers[i])
+                << "Buffer " << UsedBuffers[i] << " used by the command list has been moved";
+        }
+
+        StateTransitionDesc DstBarrier{pDstBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        pContext->TransitionResourceStates(1, &DstBarrier);
+
+        ICommandList* pCmdLists[] = {pCmdList};
+        pContext->ExecuteCommandLists(1, pCmdLists);
+
+        pContext->CopyBuffer(pDstBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, 0, DstDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->WaitForIdle();
+
+        void* pData = nullptr;
+        pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        ASSERT_NE(pData, nullptr);
+        for (Uint32 i = 0; i < NumUsedBuffers; ++i)
+        {
+            const auto RefData = GetBufferData(UsedBuffers[i], NumElements);
+            EXPECT_EQ(memcmp(reinterpret_cast<const Uint8*>(pData) + BufferSize * i, RefData.data(), BufferSize), 0)
+                << "Contents of buffer " << UsedBuffers[i] << " read by the command list do not match the reference data";
+        }
+        pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+    }
+    pContext->FinishFrame();
+}
+
+TEST(MemoryDefragmentationTestVk, MoveVertexBuffers)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Memory defragmentation is only supported in Vulkan";
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_NE(pContextVk, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumBuffers  = 128;
+    constexpr Uint32 NumElements = 16384;
+    constexpr Uint64 BufferSize  = NumElements * sizeof(Uint32);
+
+    std::vector<RefCntAutoPtr<IBuffer>> pBuffers;
+    ASSERT_NO_FATAL_FAILURE(CreateSparseVertexBuffers(NumBuffers, NumElements, pBuffers));
+
+    std::vector<RESOURCE_STATE> OrigStates(NumBuffers, RESOURCE_STATE_UNKNOWN);
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        if (pBuffers[i])
+            OrigStates[i] = pBuffers[i]->GetState();
+    }
+
+    MemoryDefragmentationStatsVk Stats;
+    pContextVk->DefragmentMemory(0, &Stats);
+    EXPECT_EQ(Stats.NumBuffersMoved, 0u);
+    const auto ReleasedSizeBeforeMove = Stats.TotalReleasedMemorySize;
+
+    pContextVk->DefragmentMemory(BufferSize, &Stats);
+    EXPECT_LE(Stats.NumBuffersMoved, 1u);
+    EXPECT_LE(Stats.BytesMoved, BufferSize);
+    auto NumBuffersMoved = Stats.NumBuffersMoved;
+
+    pContextVk->DefragmentMemory(~Uint64{0}, &Stats);
+    EXPECT_EQ(Stats.BytesMoved, Stats.NumBuffersMoved * BufferSize);
+    NumBuffersMoved += Stats.NumBuffersMoved;
+    // Buffers from the sparsest pages must have been moved to the denser ones
+    EXPECT_GT(NumBuffersMoved, 0u);
+
+    // Moved buffers must be returned to their original states
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        if (pBuffers[i])
+            EXPECT_EQ(pBuffers[i]->GetState(), OrigStates[i]) << "State of buffer " << i << " has changed";
+    }
+
+    // Old buffers are released when the GPU is done with them, after which evacuated pages are destroyed
+    pContext->Flush();
+    pContext->FinishFrame();
+    pDevice->IdleGPU();
+
+    pContextVk->DefragmentMemory(0, &Stats);
+    EXPECT_GT(Stats.TotalReleasedMemorySize, ReleasedSizeBeforeMove) << "Evacuated memory pages have not been released";
+
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Defragmentation test staging buffer";
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    StagingDesc.Size           = BufferSize;
+
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        if (!pBuffers[i])
+            continue;
+
+        RefCntAutoPtr<IBuffer> pStagingBuffer;
+        pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+        ASSERT_NE(pStagingBuffer, nullptr);
+
+        pContext->CopyBuffer(pBuffers[i], 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, 0, BufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->WaitForIdle();
+
+        void* pData = nullptr;
+        pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        ASSERT_NE(pData, nullptr);
+        const auto RefData = GetBufferData(i, NumElements);
+        EXPECT_EQ(memcmp(pData, RefData.data(), BufferSize), 0) << "Contents of buffer " << i << " do not match the reference data";
+        pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+    }
+}
+
+TEST(MemoryDefragmentationTestVk, BuffersUsedByDeferredContext)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Memory defragmentation is only supported in Vulkan";
+    if (pEnv->GetNumDeferredContexts() == 0)
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    TestBuffersUsedByCommandList(COMMAND_LIST_FLAG_NONE, 1);
+}
+
+TEST(MemoryDefragmentationTestVk, BuffersUsedByReusableCommandList)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Memory defragmentation is only supported in Vulkan";
+    if (pEnv->GetNumDeferredContexts() == 0)
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // The list is replayed after every defragmentation pass
+    TestBuffersUsedByCommandList(COMMAND_LIST_FLAG_REUSABLE, 3);
+}
+
+} // namespace
@@ -0,0 +1,281 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+
+#include "volk/volk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// The testing environment uses the default memory page sizes
+const Uint64 DeviceLocalPageSize = EngineVkCreateInfo{}.DeviceLocalMemoryPageSize;
+
+Uint32 GetMemoryHeapCount(IRenderDeviceVk* pDeviceVk)
+{
+    VkPhysicalDeviceMemoryProperties MemoryProps{};
+    vkGetPhysicalDeviceMemoryProperties(pDeviceVk->GetVkPhysicalDevice(), &MemoryProps);
+    return MemoryProps.memoryHeapCount;
+}
+
+// Returns the statistics summed over all memory heaps
+MemoryHeapStatsVk GetTotalHeapStats(IRenderDeviceVk* pDeviceVk)
+{
+    MemoryHeapStatsVk TotalStats;
+    for (Uint32 HeapIndex = 0; HeapIndex < GetMemoryHeapCount(pDeviceVk); ++HeapIndex)
+    {
+        const auto Stats = pDeviceVk->GetMemoryHeapStats(HeapIndex);
+        TotalStats.AllocatedSize += Stats.AllocatedSize;
+        TotalStats.UsedSize += Stats.UsedSize;
+        TotalStats.MemoryObjectCount += Stats.MemoryObjectCount;
+        TotalStats.DedicatedMemoryObjectCount += Stats.DedicatedMemoryObjectCount;
+    }
+    return TotalStats;
+}
+
+bool IsDeviceExtensionSupported(const char* ExtensionName)
+{
+    auto* pEnvVk = TestingEnvironmentVk::GetInstance();
+
+    uint32_t ExtensionCount = 0;
+    vkEnumerateDeviceExtensionProperties(pEnvVk->GetVkPhysicalDevice(), nullptr, &ExtensionCount, nullptr);
+    std::vector<VkExtensionProperties> Extensions(ExtensionCount);
+    vkEnumerateDeviceExtensionProperties(pEnvVk->GetVkPhysicalDevice(), nullptr, &ExtensionCount, Extensions.data());
+    for (const auto& Ext : Extensions)
+    {
+        if (strcmp(Ext.extensionName, ExtensionName) == 0)
+            return true;
+    }
+    return false;
+}
+
+RefCntAutoPtr<IBuffer> CreateVertexBuffer(IRenderDevice* pDevice, Uint64 Size)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Memory manager test buffer";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.Size      = Size;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    return pBuffer;
+}
+
+// Creates buffers of the given size until a new memory object is allocated and
+// returns the size of that memory object.
+Uint64 GetNewPageSize(IRenderDevice* pDevice, IRenderDeviceVk* pDeviceVk, Uint64 BufferSize, Uint32 MaxBuffers, std::vector<RefCntAutoPtr<IBuffer>>& Buffers)
+{
+    for (Uint32 i = 0; i < MaxBuffers; ++i)
+    {
+        const auto StatsBefore = GetTotalHeapStats(pDeviceVk);
+
+        auto pBuffer = CreateVertexBuffer(pDevice, BufferSize);
+        if (pBuffer == nullptr)
+            return 0;
+        Buffers.emplace_back(std::move(pBuffer));
+
+        const auto StatsAfter = GetTotalHeapStats(pDeviceVk);
+        if (StatsAfter.MemoryObjectCount != StatsBefore.MemoryObjectCount)
+        {
+            EXPECT_EQ(StatsAfter.MemoryObjectCount, StatsBefore.MemoryObjectCount + 1);
+            return StatsAfter.AllocatedSize - StatsBefore.AllocatedSize;
+        }
+    }
+    return 0;
+}
+
+void ReleaseResources(IRenderDevice* pDevice, IDeviceContext* pContext)
+{
+    pContext->Flush();
+    pContext->FinishFrame();
+    pDevice->IdleGPU();
+}
+
+// Small resources are suballocated from quarter-size pages, medium resources from full-size pages,
+// and large resources get their own memory objects.
+TEST(MemoryManagerTestVk, SizeClasses)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is specific to Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    {
+        // Small size class: Size <= PageSize / 64
+        std::vector<RefCntAutoPtr<IBuffer>> Buffers;
+        EXPECT_EQ(GetNewPageSize(pDevice, pDeviceVk, DeviceLocalPageSize / 128, 1024, Buffers), DeviceLocalPageSize / 4)
+            << "Small resources must be suballocated from quarter-size pages";
+    }
+
+    {
+        // Medium size class: PageSize / 64 < Size <= PageSize / 2
+        std::vector<RefCntAutoPtr<IBuffer>> Buffers;
+        EXPECT_EQ(GetNewPageSize(pDevice, pDeviceVk, DeviceLocalPageSize / 4, 32, Buffers), DeviceLocalPageSize)
+            << "Medium resources must be suballocated from full-size pages";
+    }
+    ReleaseResources(pDevice, pContext);
+
+    {
+        // Large size class: Size > PageSize / 2
+        const Uint64 LargeBufferSize = DeviceLocalPageSize / 4 * 3;
+
+        const auto StatsBefore = GetTotalHeapStats(pDeviceVk);
+
+        auto pBuffer = CreateVertexBuffer(pDevice, LargeBufferSize);
+        ASSERT_NE(pBuffer, nullptr);
+
+        const auto StatsAfter = GetTotalHeapStats(pDeviceVk);
+        EXPECT_EQ(StatsAfter.MemoryObjectCount, StatsBefore.MemoryObjectCount + 1);
+        // The memory object is as large as the buffer, which is not a multiple of the page size
+        EXPECT_GE(StatsAfter.AllocatedSize - StatsBefore.AllocatedSize, LargeBufferSize);
+        EXPECT_LT(StatsAfter.AllocatedSize - StatsBefore.AllocatedSize, DeviceLocalPageSize);
+        // Buffers never use dedicated allocations
+        EXPECT_EQ(StatsAfter.DedicatedMemoryObjectCount, StatsBefore.DedicatedMemoryObjectCount);
+
+        // The memory object is released together with the buffer
+        pBuffer.Release();
+        ReleaseResources(pDevice, pContext);
+
+        const auto StatsReleased = GetTotalHeapStats(pDeviceVk);
+        EXPECT_EQ(StatsReleased.MemoryObjectCount, StatsBefore.MemoryObjectCount);
+        EXPECT_EQ(StatsReleased.AllocatedSize, StatsBefore.AllocatedSize);
+    }
+}
+
+// Large images are placed in dedicated allocations when VK_KHR_dedicated_allocation is supported.
+TEST(MemoryManagerTestVk, DedicatedAllocation)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is specific to Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const bool DedicatedAllocationSupported =
+        IsDeviceExtensionSupported(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME) &&
+        IsDeviceExtensionSupported(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Memory manager test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.Width     = 2048;
+    TexDesc.Height    = 2048;
+    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    // 16 MB texture is larger than half of the page
+    ASSERT_GT(Uint64{TexDesc.Width} * TexDesc.Height * 4, DeviceLocalPageSize / 2);
+
+    const auto StatsBefore = GetTotalHeapStats(pDeviceVk);
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    const auto StatsAfter = GetTotalHeapStats(pDeviceVk);
+    EXPECT_EQ(StatsAfter.MemoryObjectCount, StatsBefore.MemoryObjectCount + 1);
+    EXPECT_EQ(StatsAfter.DedicatedMemoryObjectCount, StatsBefore.DedicatedMemoryObjectCount + (DedicatedAllocationSupported ? 1 : 0));
+
+    pTexture.Release();
+    ReleaseResources(pDevice, pContext);
+
+    const auto StatsReleased = GetTotalHeapStats(pDeviceVk);
+    EXPECT_EQ(StatsReleased.MemoryObjectCount, StatsBefore.MemoryObjectCount);
+    EXPECT_EQ(StatsReleased.DedicatedMemoryObjectCount, StatsBefore.DedicatedMemoryObjectCount);
+}
+
+// The budget callback can be set and reset through the device interface.
+TEST(MemoryManagerTestVk, BudgetCallback)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is specific to Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    bool BudgetExceeded = false;
+    for (Uint32 HeapIndex = 0; HeapIndex < GetMemoryHeapCount(pDeviceVk); ++HeapIndex)
+    {
+        const auto HeapStats = pDeviceVk->GetMemoryHeapStats(HeapIndex);
+        EXPECT_GT(HeapStats.Budget, 0u);
+        EXPECT_LE(HeapStats.UsedSize, HeapStats.AllocatedSize);
+        if (HeapStats.Usage + DeviceLocalPageSize >= HeapStats.Budget)
+            BudgetExceeded = true;
+    }
+
+    struct CallbackData
+    {
+        Uint32 NumCalls = 0;
+    } Data;
+
+    pDeviceVk->SetMemoryBudgetCallback(
+        [](Uint32, const MemoryHeapStatsVk* pStats, void* pUserData) {
+            EXPECT_NE(pStats, nullptr);
+            if (pStats != nullptr)
+                EXPECT_GT(pStats->Usage, pStats->Budget);
+            ++static_cast<CallbackData*>(pUserData)->NumCalls;
+        },
+        &Data);
+
+    {
+        auto pBuffer = CreateVertexBuffer(pDevice, DeviceLocalPageSize);
+        ASSERT_NE(pBuffer, nullptr);
+    }
+    // The callback must only be called when the budget is exceeded
+    if (!BudgetExceeded)
+        EXPECT_EQ(Data.NumCalls, 0u);
+
+    pDeviceVk->SetMemoryBudgetCallback(nullptr, nullptr);
+}
+
+} // namespace
@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// clang-format off
+const std::string InvertedColorPS{
+R"(
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float3 Color : COLOR;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return float4(float3(1.0, 1.0, 1.0) - PSIn.Color.rgb, 1.0);
+}
+)"
+};
+// clang-format on
+
+RefCntAutoPtr<IPipelineState> CreateFastLinkPSO(IShader* pVS, IShader* pPS)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& PSODesc          = PSOCreateInfo.PSODesc;
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.Name        = "Pipeline library cache test PSO";
+    PSOCreateInfo.Flags = PSO_CREATE_FLAG_FAST_LINK;
+
+    PSODesc.PipelineType                          = PIPELINE_TYPE_GRAPHICS;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    return pPSO;
+}
+
+// A pipeline that only differs from an existing one by the pixel shader must reuse
+// the vertex input, pre-rasterization and fragment output libraries.
+TEST(PipelineLibraryCacheTestVk, SharedVertexShader)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "This test is specific to Vulkan";
+
+    if (TestingEnvironmentVk::GetInstance()->GraphicsPipelineLibrary.graphicsPipelineLibrary == VK_FALSE)
+        GTEST_SKIP() << "Graphics pipeline libraries are not supported by this device";
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.EntryPoint                 = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+    ShaderCI.Desc.Name       = "Pipeline library cache test vertex shader";
+    ShaderCI.Source          = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+    pDevice->CreateShader(ShaderCI, &pVS);
+    ASSERT_NE(pVS, nullptr);
+
+    RefCntAutoPtr<IShader> pPS1;
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+    ShaderCI.Desc.Name       = "Pipeline library cache test pixel shader 1";
+    ShaderCI.Source          = HLSL::DrawTest_PS.c_str();
+    pDevice->CreateShader(ShaderCI, &pPS1);
+    ASSERT_NE(pPS1, nullptr);
+
+    RefCntAutoPtr<IShader> pPS2;
+    ShaderCI.Desc.Name = "Pipeline library cache test pixel shader 2";
+    ShaderCI.Source    = InvertedColorPS.c_str();
+    pDevice->CreateShader(ShaderCI, &pPS2);
+    ASSERT_NE(pPS2, nullptr);
+
+    const auto Stats0 = pDeviceVk->GetPipelineLibraryCacheStats();
+
+    auto pPSO1 = CreateFastLinkPSO(pVS, pPS1);
+    ASSERT_NE(pPSO1, nullptr);
+
+    const auto Stats1 = pDeviceVk->GetPipelineLibraryCacheStats();
+    EXPECT_EQ(Stats1.LinkCount, Stats0.LinkCount + 1);
+    // One library is looked up for every part of the pipeline
+    EXPECT_EQ((Stats1.HitCount - Stats0.HitCount) + (Stats1.CreationCount - Stats0.CreationCount), 4u);
+
+    auto pPSO2 = CreateFastLinkPSO(pVS, pPS2);
+    ASSERT_NE(pPSO2, nullptr);
+
+    const auto Stats2 = pDeviceVk->GetPipelineLibraryCacheStats();
+    EXPECT_EQ(Stats2.LinkCount, Stats1.LinkCount + 1);
+    // Only the fragment shader library may be created. It may already be in the cache
+    // if the test is repeated.
+    EXPECT_GE(Stats2.HitCount - Stats1.HitCount, 3u);
+    EXPECT_LE(Stats2.CreationCount - Stats1.CreationCount, 1u);
+    EXPECT_EQ((Stats2.HitCount - Stats1.HitCount) + (Stats2.CreationCount - Stats1.CreationCount), 4u);
+}
+
+} // namespace
@@ -0,0 +1,231 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if VULKAN_SUPPORTED
+#    define VK_NO_PROTOTYPES
+#    include "vulkan/vulkan.h"
+#endif
+
+#include "DeviceContextVk.h"
+#include "CommandQueueVk.h"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(QueueSubmitBatchingTestVk, EnqueueAndFlush)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Submit batching is only supported in Vulkan";
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    pContext->WaitForIdle();
+
+    VkSubmitInfo EmptySubmitInfo{};
+    EmptySubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+
+    Uint64 LastFenceValue = 0;
+    {
+        RefCntAutoPtr<ICommandQueueVk> pQueueVk{pContext->LockCommandQueue(), IID_CommandQueueVk};
+        ASSERT_NE(pQueueVk, nullptr);
+
+        const auto Stats0 = pQueueVk->GetSubmitStats();
+
+        const auto FenceValue0 = pQueueVk->EnqueueSubmit(EmptySubmitInfo);
+        const auto FenceValue1 = pQueueVk->EnqueueSubmit(EmptySubmitInfo);
+        EXPECT_LT(FenceValue0, FenceValue1);
+        EXPECT_LT(pQueueVk->GetCompletedFenceValue(), FenceValue0) << "Pending work batches must not be signaled before they are submitted";
+
+        const auto Stats1 = pQueueVk->GetSubmitStats();
+        EXPECT_EQ(Stats1.NumSubmissions, Stats0.NumSubmissions + 2);
+        EXPECT_EQ(Stats1.NumBatchedSubmissions, Stats0.NumBatchedSubmissions + 2);
+        EXPECT_EQ(Stats1.NumQueueSubmitCalls, Stats0.NumQueueSubmitCalls);
+
+        pQueueVk->FlushPendingSubmits();
+
+        const auto Stats2 = pQueueVk->GetSubmitStats();
+        EXPECT_EQ(Stats2.NumSubmissions, Stats1.NumSubmissions);
+        EXPECT_EQ(Stats2.NumQueueSubmitCalls, Stats1.NumQueueSubmitCalls + 1);
+
+        // The pending batch is submitted together with the next work batch
+        pQueueVk->EnqueueSubmit(EmptySubmitInfo);
+        LastFenceValue = pQueueVk->SubmitCmdBuffer(VK_NULL_HANDLE);
+
+        const auto Stats3 = pQueueVk->GetSubmitStats();
+        EXPECT_EQ(Stats3.NumSubmissions, Stats2.NumSubmissions + 2);
+        EXPECT_EQ(Stats3.NumBatchedSubmissions, Stats2.NumBatchedSubmissions + 1);
+        EXPECT_EQ(Stats3.NumQueueSubmitCalls, Stats2.NumQueueSubmitCalls + 1);
+
+        pContext->UnlockCommandQueue();
+    }
+
+    pContext->WaitForIdle();
+
+    RefCntAutoPtr<ICommandQueueVk> pQueueVk{pContext->LockCommandQueue(), IID_CommandQueueVk};
+    EXPECT_GE(pQueueVk->GetCompletedFenceValue(), LastFenceValue);
+    pContext->UnlockCommandQueue();
+}
+
+// Command lists executed by ExecuteCommandLists() are added to the pending batch of the queue when
+// submit batching is enabled (run the tests with --vk_batch_submits), and must be submitted by FinishFrame().
+TEST(QueueSubmitBatchingTestVk, ExecuteCommandLists)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Submit batching is only supported in Vulkan";
+    if (pEnv->GetNumDeferredContexts() == 0)
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const Uint32     NumCmdLists = static_cast<Uint32>(std::min(pEnv->GetNumDeferredContexts(), size_t{4}));
+    constexpr Uint32 NumElements = 256;
+    constexpr Uint64 RegionSize  = NumElements * sizeof(Uint32);
+
+    std::vector<Uint32> RefData(NumElements * NumCmdLists);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = 0x02000000 + static_cast<Uint32>(i);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Queue submit batching test buffer";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.Size      = RegionSize * NumCmdLists;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pDstBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pDstBuffer);
+    ASSERT_NE(pDstBuffer, nullptr);
+
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Queue submit batching test staging buffer";
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    StagingDesc.Size           = BuffDesc.Size;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    // Deferred contexts write to the buffer in COPY_DEST state without transitions
+    StateTransitionDesc Barrier{pDstBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pContext->TransitionResourceStates(1, &Barrier);
+    pContext->WaitForIdle();
+
+    std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumCmdLists);
+    std::vector<ICommandList*>               pCmdLists(NumCmdLists);
+    for (Uint32 i = 0; i < NumCmdLists; ++i)
+    {
+        auto* pDeferredCtx = pEnv->GetDeferredContext(i);
+        pDeferredCtx->Begin(pContext->GetDesc().ContextId);
+        pDeferredCtx->UpdateBuffer(pDstBuffer, RegionSize * i, RegionSize, &RefData[NumElements * i], RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        pDeferredCtx->FinishCommandList(&CmdLists[i]);
+        ASSERT_NE(CmdLists[i], nullptr);
+        pCmdLists[i] = CmdLists[i];
+    }
+
+    auto GetSubmitStats = [pContext]() {
+        RefCntAutoPtr<ICommandQueueVk> pQueueVk{pContext->LockCommandQueue(), IID_CommandQueueVk};
+        const auto                     Stats = pQueueVk->GetSubmitStats();
+        pContext->UnlockCommandQueue();
+        return Stats;
+    };
+    auto GetCompletedFenceValue = [pContext]() {
+        auto*      pQueue     = pContext->LockCommandQueue();
+        const auto FenceValue = pQueue->GetCompletedFenceValue();
+        pContext->UnlockCommandQueue();
+        return FenceValue;
+    };
+
+    const auto Stats0 = GetSubmitStats();
+
+    pContext->ExecuteCommandLists(NumCmdLists, pCmdLists.data());
+
+    const auto Stats1       = GetSubmitStats();
+    const bool Batched      = Stats1.NumBatchedSubmissions != Stats0.NumBatchedSubmissions;
+    Uint64     LastFenceVal = 0;
+    {
+        auto* pQueue = pContext->LockCommandQueue();
+        LastFenceVal = pQueue->GetNextFenceValue() - 1;
+        pContext->UnlockCommandQueue();
+    }
+
+    if (Batched)
+    {
+        // All command lists are submitted as a single work batch
+        EXPECT_EQ(Stats1.NumBatchedSubmissions, Stats0.NumBatchedSubmissions + 1);
+        EXPECT_EQ(Stats1.NumQueueSubmitCalls, Stats0.NumQueueSubmitCalls);
+        EXPECT_LT(GetCompletedFenceValue(), LastFenceVal) << "Command lists must not be executed before the pending batch is submitted";
+    }
+
+    for (Uint32 i = 0; i < NumCmdLists; ++i)
+        pEnv->GetDeferredContext(i)->FinishFrame();
+    pContext->FinishFrame();
+
+    if (Batched)
+    {
+        const auto Stats2 = GetSubmitStats();
+        EXPECT_EQ(Stats2.NumQueueSubmitCalls, Stats1.NumQueueSubmitCalls + 1) << "FinishFrame() must submit the pending batch";
+    }
+
+    // Do not idle the queue as it submits the pending batch; the work must complete on its own
+    const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (GetCompletedFenceValue() < LastFenceVal && std::chrono::steady_clock::now() < Deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    ASSERT_GE(GetCompletedFenceValue(), LastFenceVal) << "Executed command lists have not been completed by the GPU";
+
+    pContext->CopyBuffer(pDstBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, BuffDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    EXPECT_EQ(memcmp(pData, RefData.data(), static_cast<size_t>(BuffDesc.Size)), 0) << "Buffer contents do not match the data written by the command lists";
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+
+    if (!Batched)
+        GTEST_SKIP() << "Queue submit batching is disabled. Run the tests with --vk_batch_submits to test batched submissions";
+}
+
+} // namespace
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include "RenderDevice.h"
+#include "DeviceContext.h"
+#include "PipelineState.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+/// Benchmark settings that can be overridden from the command line.
+struct BenchmarkSettings
+{
+    /// Minimum total time, in seconds, spent in the timed sections of every benchmark.
+    static double MinTime;
+
+    /// Minimum number of timed samples taken by every benchmark.
+    static Uint32 MinSamples;
+
+    /// Parses --benchmark_min_time=<seconds> and --benchmark_min_samples=<count> arguments.
+    static void ParseCommandLine(int argc, char** argv);
+};
+
+/// Accumulates the time spent in timed sections and the number of operations performed in them.
+///
+/// The results are printed to stdout and are recorded as test properties, so that they are
+/// written to the machine-readable report when the benchmark is run with --gtest_output=json
+/// or --gtest_output=xml.
+class BenchmarkCounter
+{
+public:
+    /// OpName is the singular name of the measured operation, e.g. "draw".
+    explicit BenchmarkCounter(const char* OpName) :
+        m_OpName{OpName}
+    {}
+
+    /// Runs the function and adds its execution time and the number of operations
+    /// it performed to the total.
+    template <typename FuncType>
+    void Measure(Uint64 NumOps, FuncType&& Func)
+    {
+        const auto StartTime = GetTime();
+        Func();
+        m_TotalTime += GetTime() - StartTime;
+        m_NumOps += NumOps;
+        ++m_NumSamples;
+    }
+
+    /// Returns true when the benchmark has run long enough.
+    bool IsComplete() const
+    {
+        return m_TotalTime >= BenchmarkSettings::MinTime && m_NumSamples >= BenchmarkSettings::MinSamples;
+    }
+
+    double GetOpsPerSecond() const
+    {
+        return m_TotalTime > 0 ? static_cast<double>(m_NumOps) / m_TotalTime : 0;
+    }
+
+    double GetNanosecondsPerOp() const
+    {
+        return m_NumOps > 0 ? m_TotalTime * 1e+9 / static_cast<double>(m_NumOps) : 0;
+    }
+
+    /// Prints the result and records it as test properties.
+    /// Property names are prefixed with the optional name of the measurement.
+    /// If BytesPerOp is not zero, the data throughput is reported as well.
+    void Report(const char* Name = nullptr, Uint64 BytesPerOp = 0) const;
+
+private:
+    static double GetTime();
+
+    const char* const m_OpName;
+
+    double m_TotalTime  = 0;
+    Uint64 m_NumOps     = 0;
+    Uint32 m_NumSamples = 0;
+};
+
+/// Ends the benchmark frame: flushes the immediate context, finishes the frame and waits for
+/// the GPU to become idle to keep the memory usage bounded. This should be called outside
+/// of the timed sections.
+void EndBenchmarkFrame();
+
+/// Creates a shader from HLSL source using the default compiler of the testing environment.
+RefCntAutoPtr<IShader> CreateBenchmarkShader(const char* Name, SHADER_TYPE ShaderType, const char* Source);
+
+/// Initializes graphics pipeline state create info that renders into the testing swap chain
+/// with the given shaders. Vertex shader is expected to take float4 position at ATTRIB0.
+void InitBenchmarkPSOCreateInfo(GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                const char*                      Name,
+                                IShader*                         pVS,
+                                IShader*                         pPS);
+
+/// Creates a vertex buffer with NumVertices zero float4 positions. All triangles rendered from this
+/// buffer are degenerate and do not produce any pixels.
+RefCntAutoPtr<IBuffer> CreateBenchmarkVertexBuffer(Uint32 NumVertices);
+
+/// Binds the testing swap chain render targets to the context.
+void SetBenchmarkRenderTargets(IDeviceContext* pCtx, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+
+} // namespace Testing
+
+} // namespace Diligent
@@ -0,0 +1,204 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BenchmarkBase.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+double BenchmarkSettings::MinTime    = 0.5;
+Uint32 BenchmarkSettings::MinSamples = 4;
+
+void BenchmarkSettings::ParseCommandLine(int argc, char** argv)
+{
+    static constexpr char MinTimeArg[]    = "--benchmark_min_time=";
+    static constexpr char MinSamplesArg[] = "--benchmark_min_samples=";
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto* arg = argv[i];
+        if (strncmp(arg, MinTimeArg, sizeof(MinTimeArg) - 1) == 0)
+        {
+            MinTime = atof(arg + sizeof(MinTimeArg) - 1);
+        }
+        else if (strncmp(arg, MinSamplesArg, sizeof(MinSamplesArg) - 1) == 0)
+        {
+            MinSamples = static_cast<Uint32>(std::max(atoi(arg + sizeof(MinSamplesArg) - 1), 1));
+        }
+    }
+}
+
+double BenchmarkCounter::GetTime()
+{
+    using namespace std::chrono;
+    return duration_cast<duration<double>>(steady_clock::now().time_since_epoch()).count();
+}
+
+void BenchmarkCounter::Report(const char* Name, Uint64 BytesPerOp) const
+{
+    std::string Prefix;
+    if (Name != nullptr && *Name != '\0')
+    {
+        Prefix = Name;
+        Prefix += '_';
+    }
+
+    const auto OpsPerSecond = GetOpsPerSecond();
+    const auto NsPerOp      = GetNanosecondsPerOp();
+    const auto MBPerSecond  = OpsPerSecond * static_cast<double>(BytesPerOp) / double{1 << 20};
+
+    auto ToString = [](double Value) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << Value;
+        return ss.str();
+    };
+
+    // Properties are written to the JSON/XML report produced with --gtest_output
+    ::testing::Test::RecordProperty(Prefix + m_OpName + "s_per_second", ToString(OpsPerSecond));
+    ::testing::Test::RecordProperty(Prefix + "ns_per_" + m_OpName, ToString(NsPerOp));
+    ::testing::Test::RecordProperty(Prefix + m_OpName + "_count", std::to_string(m_NumOps));
+    if (BytesPerOp != 0)
+        ::testing::Test::RecordProperty(Prefix + "megabytes_per_second", ToString(MBPerSecond));
+
+    std::stringstream ss;
+    ss << "[ BENCHMRK ] ";
+    if (!Prefix.empty())
+        ss << Name << ": ";
+    ss << std::fixed << std::setprecision(0) << OpsPerSecond << ' ' << m_OpName << "s/s, "
+       << std::setprecision(1) << NsPerOp << " ns/" << m_OpName;
+    if (BytesPerOp != 0)
+        ss << ", " << MBPerSecond << " MB/s";
+    ss << " (" << m_NumOps << ' ' << m_OpName << "s in " << std::setprecision(3) << m_TotalTime << " s)";
+    std::cout << ss.str() << std::endl;
+}
+
+void EndBenchmarkFrame()
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+    pCtx->Flush();
+    pCtx->FinishFrame();
+    pCtx->WaitForIdle();
+    pEnv->GetDevice()->ReleaseStaleResources();
+}
+
+RefCntAutoPtr<IShader> CreateBenchmarkShader(const char* Name, SHADER_TYPE ShaderType, const char* Source)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.Desc.ShaderType            = ShaderType;
+    ShaderCI.Desc.Name                  = Name;
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Source                     = Source;
+
+    RefCntAutoPtr<IShader> pShader;
+    pEnv->GetDevice()->CreateShader(ShaderCI, &pShader);
+    return pShader;
+}
+
+void InitBenchmarkPSOCreateInfo(GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                const char*                      Name,
+                                IShader*                         pVS,
+                                IShader*                         pPS)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    const auto& SCDesc = pSwapChain->GetDesc();
+
+    PSOCreateInfo.PSODesc.Name         = Name;
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_GRAPHICS;
+
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = SCDesc.ColorBufferFormat;
+    GraphicsPipeline.DSVFormat                    = SCDesc.DepthBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    static const LayoutElement LayoutElems[] = {LayoutElement{0, 0, 4, VT_FLOAT32}};
+
+    GraphicsPipeline.InputLayout.LayoutElements = LayoutElems;
+    GraphicsPipeline.InputLayout.NumElements    = _countof(LayoutElems);
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+}
+
+RefCntAutoPtr<IBuffer> CreateBenchmarkVertexBuffer(Uint32 NumVertices)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    std::vector<float> Vertices(size_t{NumVertices} * 4);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Benchmark vertex buffer";
+    BuffDesc.Size      = Vertices.size() * sizeof(Vertices[0]);
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+    BuffDesc.Usage     = USAGE_IMMUTABLE;
+
+    BufferData InitData{Vertices.data(), BuffDesc.Size};
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pEnv->GetDevice()->CreateBuffer(BuffDesc, &InitData, &pBuffer);
+    return pBuffer;
+}
+
+void SetBenchmarkRenderTargets(IDeviceContext* pCtx, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    auto* pSwapChain = TestingEnvironment::GetInstance()->GetSwapChain();
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pCtx->SetRenderTargets(1, pRTVs, pSwapChain->GetDepthBufferDSV(), StateTransitionMode);
+}
+
+} // namespace Testing
+
+} // namespace Diligent
@@ -0,0 +1,418 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+#include "GraphicsAccessories.hpp"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* CommitShaderResourcesBenchmark_VS = R"(
+cbuffer cb0 { float4 g_Data0; };
+cbuffer cb1 { float4 g_Data1; };
+cbuffer cb2 { float4 g_Data2; };
+cbuffer cb3 { float4 g_Data3; };
+
+Texture2D<float4> g_Tex0;
+Texture2D<float4> g_Tex1;
+Texture2D<float4> g_Tex2;
+Texture2D<float4> g_Tex3;
+
+void main(in  float4 Pos    : ATTRIB0,
+          out float4 PosOut : SV_Position)
+{
+    PosOut = Pos * (g_Data0 + g_Data1 + g_Data2 + g_Data3) +
+        g_Tex0.Load(int3(0, 0, 0)) +
+        g_Tex1.Load(int3(0, 0, 0)) +
+        g_Tex2.Load(int3(0, 0, 0)) +
+        g_Tex3.Load(int3(0, 0, 0));
+}
+)";
+
+const char* CommitShaderResourcesBenchmark_PS = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(0.0, 1.0, 0.0, 1.0);
+}
+)";
+
+// Parameters: variable type, use dynamic buffers
+class CommitShaderResourcesBenchmark : public testing::TestWithParam<std::tuple<SHADER_RESOURCE_VARIABLE_TYPE, bool>>
+{
+protected:
+    static constexpr Uint32 NumBuffers      = 4;
+    static constexpr Uint32 NumTextures     = 4;
+    static constexpr Uint32 NumSRBs         = 2;
+    static constexpr Uint32 NumResourceSets = 2;
+    static constexpr Uint32 DrawsPerFrame   = 2048;
+    static constexpr Uint32 ConstBuffSize   = 256;
+    static constexpr Uint32 TextureSize     = 4;
+
+    static void TearDownTestSuite()
+    {
+        TestingEnvironment::GetInstance()->Reset();
+    }
+
+    // Creates a signature with the given flags and a pipeline that uses it
+    void CreatePipeline(PIPELINE_RESOURCE_SIGNATURE_FLAGS          Flags,
+                        RefCntAutoPtr<IPipelineResourceSignature>& pSignature,
+                        RefCntAutoPtr<IPipelineState>&             pPipeline)
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+        const auto VarType = std::get<0>(GetParam());
+
+        std::vector<PipelineResourceDesc> Resources;
+        for (Uint32 i = 0; i < NumBuffers; ++i)
+            Resources.emplace_back(SHADER_TYPE_VERTEX, Names[i].c_str(), 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, VarType);
+        for (Uint32 i = 0; i < NumTextures; ++i)
+            Resources.emplace_back(SHADER_TYPE_VERTEX, Names[NumBuffers + i].c_str(), 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, VarType);
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name                       = "Commit shader resources benchmark signature";
+        PRSDesc.Resources                  = Resources.data();
+        PRSDesc.NumResources               = static_cast<Uint32>(Resources.size());
+        PRSDesc.UseCombinedTextureSamplers = true;
+        PRSDesc.Flags                      = Flags;
+
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+        ASSERT_NE(pSignature, nullptr);
+
+        auto pVS = CreateBenchmarkShader("Commit shader resources benchmark VS", SHADER_TYPE_VERTEX, CommitShaderResourcesBenchmark_VS);
+        ASSERT_NE(pVS, nullptr);
+        auto pPS = CreateBenchmarkShader("Commit shader resources benchmark PS", SHADER_TYPE_PIXEL, CommitShaderResourcesBenchmark_PS);
+        ASSERT_NE(pPS, nullptr);
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        InitBenchmarkPSOCreateInfo(PSOCreateInfo, "Commit shader resources benchmark PSO", pVS, pPS);
+
+        IPipelineResourceSignature* ppSignatures[] = {pSignature};
+        PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+        PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPipeline);
+        ASSERT_NE(pPipeline, nullptr);
+    }
+
+    // Creates the signature, the pipeline and the resources that are shared by all tests
+    void CreateResources()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+
+        const auto UseDynamicBuffers = std::get<1>(GetParam());
+
+        Names.reserve(NumBuffers + NumTextures);
+        for (Uint32 i = 0; i < NumBuffers; ++i)
+            Names.emplace_back("cb" + std::to_string(i));
+        for (Uint32 i = 0; i < NumTextures; ++i)
+            Names.emplace_back("g_Tex" + std::to_string(i));
+
+        CreatePipeline(PIPELINE_RESOURCE_SIGNATURE_FLAG_NONE, pPRS, pPSO);
+        if (HasFatalFailure())
+            return;
+
+        for (Uint32 set = 0; set < NumResourceSets; ++set)
+        {
+            for (auto& pBuffer : pBuffers[set])
+            {
+                BufferDesc BuffDesc;
+                BuffDesc.Name           = "Commit shader resources benchmark constant buffer";
+                BuffDesc.Size           = ConstBuffSize;
+                BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+                BuffDesc.Usage          = UseDynamicBuffers ? USAGE_DYNAMIC : USAGE_DEFAULT;
+                BuffDesc.CPUAccessFlags = UseDynamicBuffers ? CPU_ACCESS_WRITE : CPU_ACCESS_NONE;
+                pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+                ASSERT_NE(pBuffer, nullptr);
+            }
+
+            for (auto& pTexture : pTextures[set])
+            {
+                pTexture = pEnv->CreateTexture("Commit shader resources benchmark texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, TextureSize, TextureSize);
+                ASSERT_NE(pTexture, nullptr);
+            }
+        }
+    }
+
+    template <typename GetVariableType>
+    void BindResources(Uint32 set, GetVariableType GetVariable)
+    {
+        for (Uint32 i = 0; i < NumBuffers; ++i)
+            GetVariable(Names[i].c_str())->Set(pBuffers[set][i]);
+        for (Uint32 i = 0; i < NumTextures; ++i)
+            GetVariable(Names[NumBuffers + i].c_str())->Set(pTextures[set][i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    }
+
+    std::vector<std::string>                  Names;
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    RefCntAutoPtr<IPipelineState>             pPSO;
+
+    // Every SRB references its own set of resources unless the variables are static
+    std::array<std::array<RefCntAutoPtr<IBuffer>, NumBuffers>, NumResourceSets>   pBuffers;
+    std::array<std::array<RefCntAutoPtr<ITexture>, NumTextures>, NumResourceSets> pTextures;
+};
+
+TEST_P(CommitShaderResourcesBenchmark, CommitAndDraw)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    const auto VarType           = std::get<0>(GetParam());
+    const auto UseDynamicBuffers = std::get<1>(GetParam());
+
+    CreateResources();
+    if (HasFatalFailure())
+        return;
+
+    if (VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+    {
+        BindResources(0, [&](const char* Name) { return pPRS->GetStaticVariableByName(SHADER_TYPE_VERTEX, Name); });
+    }
+
+    std::array<RefCntAutoPtr<IShaderResourceBinding>, NumSRBs> pSRBs;
+    for (Uint32 srb = 0; srb < NumSRBs; ++srb)
+    {
+        pPRS->CreateShaderResourceBinding(&pSRBs[srb], true);
+        ASSERT_NE(pSRBs[srb], nullptr);
+        if (VarType != SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+        {
+            BindResources(srb % NumResourceSets, [&](const char* Name) { return pSRBs[srb]->GetVariableByName(SHADER_TYPE_VERTEX, Name); });
+        }
+    }
+
+    auto pVB = CreateBenchmarkVertexBuffer(3);
+    ASSERT_NE(pVB, nullptr);
+
+    BenchmarkCounter Counter{"commit"};
+    while (!Counter.IsComplete())
+    {
+        SetBenchmarkRenderTargets(pCtx, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        if (UseDynamicBuffers)
+        {
+            // Dynamic buffers must be mapped every frame before they are used
+            for (auto& Buffers : pBuffers)
+            {
+                for (auto& pBuffer : Buffers)
+                {
+                    MapHelper<float> Data{pCtx, pBuffer, MAP_WRITE, MAP_FLAG_DISCARD};
+                    Data[0] = 0;
+                }
+            }
+        }
+
+        IBuffer* pVBs[] = {pVB};
+        pCtx->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pCtx->SetPipelineState(pPSO);
+
+        Counter.Measure(DrawsPerFrame, [&]() {
+            const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+            for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+            {
+                pCtx->CommitShaderResources(pSRBs[i % NumSRBs], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                pCtx->Draw(DrawAttrs);
+            }
+        });
+
+        EndBenchmarkFrame();
+    }
+    Counter.Report();
+}
+
+// Measures the cost of populating a new SRB and committing it for the first time,
+// which is when static and mutable descriptors are written.
+// The null backend does not write descriptors, so only the results of GPU backends
+// reflect the cost of descriptor updates.
+TEST_P(CommitShaderResourcesBenchmark, PopulateAndCommit)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    const auto VarType = std::get<0>(GetParam());
+
+    CreateResources();
+    if (HasFatalFailure())
+        return;
+
+    if (VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+    {
+        BindResources(0, [&](const char* Name) { return pPRS->GetStaticVariableByName(SHADER_TYPE_VERTEX, Name); });
+    }
+
+    static constexpr Uint32 SRBsPerFrame = 256;
+
+    BenchmarkCounter Counter{"srb"};
+    while (!Counter.IsComplete())
+    {
+        Counter.Measure(SRBsPerFrame, [&]() {
+            for (Uint32 i = 0; i < SRBsPerFrame; ++i)
+            {
+                RefCntAutoPtr<IShaderResourceBinding> pSRB;
+                pPRS->CreateShaderResourceBinding(&pSRB, true);
+                if (VarType != SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+                {
+                    BindResources(i % NumResourceSets, [&](const char* Name) { return pSRB->GetVariableByName(SHADER_TYPE_VERTEX, Name); });
+                }
+                pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+        });
+
+        EndBenchmarkFrame();
+    }
+    Counter.Report();
+}
+
+// Compares the cost of committing dynamic resources that are written into a new descriptor set
+// with the cost of pushing them into the command buffer (PIPELINE_RESOURCE_SIGNATURE_FLAG_PUSH_DYNAMIC_RESOURCES).
+// Both modes are measured in alternating frames with the same resources.
+TEST_P(CommitShaderResourcesBenchmark, PushDynamicResources)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+
+    const auto VarType           = std::get<0>(GetParam());
+    const auto UseDynamicBuffers = std::get<1>(GetParam());
+    if (VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC)
+    {
+        GTEST_SKIP() << "Push descriptors are only used for dynamic variables";
+    }
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+    {
+        GTEST_SKIP() << "Push descriptors are only supported in Vulkan";
+    }
+
+    CreateResources();
+    if (HasFatalFailure())
+        return;
+
+    struct CommitMode
+    {
+        const char* const                                          Name;
+        RefCntAutoPtr<IPipelineResourceSignature>                  pSignature;
+        RefCntAutoPtr<IPipelineState>                              pPipeline;
+        std::array<RefCntAutoPtr<IShaderResourceBinding>, NumSRBs> pSRBs;
+        BenchmarkCounter                                           Counter{"commit"};
+    };
+    std::array<CommitMode, 2> Modes = {CommitMode{"DescriptorSets"}, CommitMode{"PushDescriptors"}};
+    Modes[0].pSignature             = pPRS;
+    Modes[0].pPipeline              = pPSO;
+    CreatePipeline(PIPELINE_RESOURCE_SIGNATURE_FLAG_PUSH_DYNAMIC_RESOURCES, Modes[1].pSignature, Modes[1].pPipeline);
+    if (HasFatalFailure())
+        return;
+
+    for (auto& Mode : Modes)
+    {
+        for (Uint32 srb = 0; srb < NumSRBs; ++srb)
+        {
+            Mode.pSignature->CreateShaderResourceBinding(&Mode.pSRBs[srb], true);
+            ASSERT_NE(Mode.pSRBs[srb], nullptr);
+            BindResources(srb % NumResourceSets, [&](const char* Name) { return Mode.pSRBs[srb]->GetVariableByName(SHADER_TYPE_VERTEX, Name); });
+        }
+    }
+
+    auto pVB = CreateBenchmarkVertexBuffer(3);
+    ASSERT_NE(pVB, nullptr);
+
+    for (Uint32 Frame = 0; !Modes[0].Counter.IsComplete() || !Modes[1].Counter.IsComplete(); ++Frame)
+    {
+        auto& Mode = Modes[Frame % Modes.size()];
+
+        SetBenchmarkRenderTargets(pCtx, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        if (UseDynamicBuffers)
+        {
+            for (auto& Buffers : pBuffers)
+            {
+                for (auto& pBuffer : Buffers)
+                {
+                    MapHelper<float> Data{pCtx, pBuffer, MAP_WRITE, MAP_FLAG_DISCARD};
+                    Data[0] = 0;
+                }
+            }
+        }
+
+        IBuffer* pVBs[] = {pVB};
+        pCtx->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pCtx->SetPipelineState(Mode.pPipeline);
+
+        // Dynamic descriptors are written when the draw command is issued, so draws are part of the timed section
+        Mode.Counter.Measure(DrawsPerFrame, [&]() {
+            const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+            for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+            {
+                pCtx->CommitShaderResources(Mode.pSRBs[i % NumSRBs], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                pCtx->Draw(DrawAttrs);
+            }
+        });
+
+        EndBenchmarkFrame();
+    }
+
+    for (const auto& Mode : Modes)
+        Mode.Counter.Report(Mode.Name);
+
+    const auto SetNs  = Modes[0].Counter.GetNanosecondsPerOp();
+    const auto PushNs = Modes[1].Counter.GetNanosecondsPerOp();
+    if (PushNs > 0)
+    {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << SetNs / PushNs;
+        RecordProperty("push_descriptors_speedup", ss.str());
+        std::cout << "[ BENCHMRK ] Push descriptors speedup: " << ss.str() << "x\n";
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(VariableTypes,
+                         CommitShaderResourcesBenchmark,
+                         testing::Combine(
+                             testing::Values(SHADER_RESOURCE_VARIABLE_TYPE_STATIC, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC),
+                             testing::Values(false, true)),
+                         [](const testing::TestParamInfo<std::tuple<SHADER_RESOURCE_VARIABLE_TYPE, bool>>& info) //
+                         {
+                             std::stringstream name_ss;
+                             name_ss << GetShaderVariableTypeLiteralName(std::get<0>(info.param))
+                                     << (std::get<1>(info.param) ? "_DynamicBuffers" : "_DefaultBuffers");
+                             return name_ss.str();
+                         });
+
+} // namespace
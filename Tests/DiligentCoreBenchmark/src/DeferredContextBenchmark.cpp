@@ -0,0 +1,250 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+#include "ThreadSignal.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* DeferredContextBenchmark_VS = R"(
+cbuffer Constants
+{
+    float4 g_Scale;
+};
+
+void main(in  float4 Pos    : ATTRIB0,
+          out float4 PosOut : SV_Position)
+{
+    PosOut = Pos * g_Scale;
+}
+)";
+
+const char* DeferredContextBenchmark_PS = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(0.0, 0.0, 1.0, 1.0);
+}
+)";
+
+class DeferredContextBenchmark : public ::testing::Test
+{
+protected:
+    static constexpr Uint32 DrawsPerThread = 4096;
+
+    static void SetUpTestSuite()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+
+        const PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_VERTEX, "Constants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE} //
+        };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "Deferred context benchmark signature";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+        ASSERT_NE(pPRS, nullptr);
+
+        auto pVS = CreateBenchmarkShader("Deferred context benchmark VS", SHADER_TYPE_VERTEX, DeferredContextBenchmark_VS);
+        ASSERT_NE(pVS, nullptr);
+        auto pPS = CreateBenchmarkShader("Deferred context benchmark PS", SHADER_TYPE_PIXEL, DeferredContextBenchmark_PS);
+        ASSERT_NE(pPS, nullptr);
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        InitBenchmarkPSOCreateInfo(PSOCreateInfo, "Deferred context benchmark PSO", pVS, pPS);
+
+        IPipelineResourceSignature* ppSignatures[] = {pPRS};
+        PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+        PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &sm_pPSO);
+        ASSERT_NE(sm_pPSO, nullptr);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Deferred context benchmark constant buffer";
+        BuffDesc.Size      = 256;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+
+        RefCntAutoPtr<IBuffer> pCB;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pCB);
+        ASSERT_NE(pCB, nullptr);
+
+        pPRS->CreateShaderResourceBinding(&sm_pSRB, true);
+        ASSERT_NE(sm_pSRB, nullptr);
+        sm_pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "Constants")->Set(pCB);
+
+        sm_pVB = CreateBenchmarkVertexBuffer(3);
+        ASSERT_NE(sm_pVB, nullptr);
+
+        // Deferred contexts can't transition resource states, so do this once in the immediate context
+        auto* pCtx = pEnv->GetDeviceContext();
+
+        const StateTransitionDesc Barriers[] = {
+            {pCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {sm_pVB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_VERTEX_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE} //
+        };
+        pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
+        SetBenchmarkRenderTargets(pCtx, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->Flush();
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_pPSO.Release();
+        sm_pSRB.Release();
+        sm_pVB.Release();
+
+        TestingEnvironment::GetInstance()->Reset();
+    }
+
+    static void RecordDraws(IDeviceContext* pCtx)
+    {
+        pCtx->Begin(0);
+        SetBenchmarkRenderTargets(pCtx, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        IBuffer* pVBs[] = {sm_pVB};
+        pCtx->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pCtx->SetPipelineState(sm_pPSO);
+        pCtx->CommitShaderResources(sm_pSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+        for (Uint32 i = 0; i < DrawsPerThread; ++i)
+            pCtx->Draw(DrawAttrs);
+    }
+
+    static RefCntAutoPtr<IPipelineState>         sm_pPSO;
+    static RefCntAutoPtr<IShaderResourceBinding> sm_pSRB;
+    static RefCntAutoPtr<IBuffer>                sm_pVB;
+};
+
+RefCntAutoPtr<IPipelineState>         DeferredContextBenchmark::sm_pPSO;
+RefCntAutoPtr<IShaderResourceBinding> DeferredContextBenchmark::sm_pSRB;
+RefCntAutoPtr<IBuffer>                DeferredContextBenchmark::sm_pVB;
+
+// Measures how the total draw recording throughput scales with the number of
+// threads that record commands into deferred contexts in parallel.
+TEST_F(DeferredContextBenchmark, RecordingScaling)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    if (pEnv->GetNumDeferredContexts() == 0)
+    {
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+    }
+
+    auto* pImmediateCtx = pEnv->GetDeviceContext();
+
+    const auto MaxThreads = static_cast<Uint32>(pEnv->GetNumDeferredContexts());
+
+    double SingleThreadDrawsPerSecond = 0;
+    for (Uint32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumThreads);
+        std::vector<ICommandList*>               CmdListPtrs(NumThreads);
+
+        BenchmarkCounter Counter{"draw"};
+        while (!Counter.IsComplete())
+        {
+            std::vector<std::thread> WorkerThreads(NumThreads);
+
+            std::atomic<Uint32>    NumCmdListsReady{0};
+            ThreadingTools::Signal FinishFrameSignal;
+            ThreadingTools::Signal ExecuteCommandListsSignal;
+
+            // Thread start-up time is included in the measurement, but it is negligible compared to
+            // the time it takes to record the draw commands.
+            Counter.Measure(Uint64{DrawsPerThread} * NumThreads, [&]() {
+                for (Uint32 i = 0; i < NumThreads; ++i)
+                {
+                    WorkerThreads[i] = std::thread(
+                        [&](Uint32 thread_id) //
+                        {
+                            auto* pCtx = pEnv->GetDeferredContext(thread_id);
+
+                            RecordDraws(pCtx);
+
+                            pCtx->FinishCommandList(&CmdLists[thread_id]);
+                            CmdListPtrs[thread_id] = CmdLists[thread_id];
+
+                            // Atomically increment the number of completed threads
+                            const auto NumReadyLists = NumCmdListsReady.fetch_add(1) + 1;
+                            if (NumReadyLists == NumThreads)
+                                ExecuteCommandListsSignal.Trigger();
+
+                            FinishFrameSignal.Wait(true, NumThreads);
+
+                            // IMPORTANT: In Metal backend FinishFrame must be called from the same
+                            //            thread that issued rendering commands.
+                            pCtx->FinishFrame();
+                        },
+                        i);
+                }
+
+                // Wait for the worker threads
+                ExecuteCommandListsSignal.Wait(true, 1);
+            });
+
+            pImmediateCtx->ExecuteCommandLists(NumThreads, CmdListPtrs.data());
+
+            FinishFrameSignal.Trigger(true);
+            for (auto& t : WorkerThreads)
+                t.join();
+
+            for (auto& pCmdList : CmdLists)
+                pCmdList.Release();
+
+            EndBenchmarkFrame();
+        }
+
+        const auto Name = std::to_string(NumThreads) + "_threads";
+        Counter.Report(Name.c_str());
+
+        if (NumThreads == 1)
+            SingleThreadDrawsPerSecond = Counter.GetOpsPerSecond();
+        else if (SingleThreadDrawsPerSecond > 0)
+            RecordProperty(Name + "_scaling", std::to_string(Counter.GetOpsPerSecond() / SingleThreadDrawsPerSecond));
+    }
+}
+
+} // namespace
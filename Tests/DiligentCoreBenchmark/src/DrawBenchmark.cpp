@@ -0,0 +1,223 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* DrawBenchmark_VS = R"(
+void main(in  float4 Pos    : ATTRIB0,
+          out float4 PosOut : SV_Position)
+{
+    PosOut = Pos;
+}
+)";
+
+const char* DrawBenchmark_PS = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(1.0, 0.0, 0.0, 1.0);
+}
+)";
+
+class DrawBenchmark : public ::testing::Test
+{
+protected:
+    static constexpr Uint32 NumPSOs          = 2;
+    static constexpr Uint32 NumVertexBuffers = 4;
+    static constexpr Uint32 DrawsPerFrame    = 4096;
+
+    static void SetUpTestSuite()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+
+        auto pVS = CreateBenchmarkShader("Draw benchmark VS", SHADER_TYPE_VERTEX, DrawBenchmark_VS);
+        ASSERT_NE(pVS, nullptr);
+        auto pPS = CreateBenchmarkShader("Draw benchmark PS", SHADER_TYPE_PIXEL, DrawBenchmark_PS);
+        ASSERT_NE(pPS, nullptr);
+
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+        {
+            GraphicsPipelineStateCreateInfo PSOCreateInfo;
+            InitBenchmarkPSOCreateInfo(PSOCreateInfo, "Draw benchmark PSO", pVS, pPS);
+            // Make the pipelines different
+            PSOCreateInfo.GraphicsPipeline.RasterizerDesc.FrontCounterClockwise = (i & 0x01) != 0;
+            pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &sm_pPSOs[i]);
+            ASSERT_NE(sm_pPSOs[i], nullptr);
+        }
+
+        for (auto& pVB : sm_pVBs)
+        {
+            pVB = CreateBenchmarkVertexBuffer(3);
+            ASSERT_NE(pVB, nullptr);
+
+            // Transition the buffers once so that the benchmarks only verify the states
+            const StateTransitionDesc Barrier{pVB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_VERTEX_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE};
+            pEnv->GetDeviceContext()->TransitionResourceStates(1, &Barrier);
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        for (auto& pPSO : sm_pPSOs)
+            pPSO.Release();
+        for (auto& pVB : sm_pVBs)
+            pVB.Release();
+
+        auto* pEnv = TestingEnvironment::GetInstance();
+        pEnv->Reset();
+    }
+
+    static void BeginFrame(IDeviceContext* pCtx)
+    {
+        SetBenchmarkRenderTargets(pCtx, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    static std::array<RefCntAutoPtr<IPipelineState>, NumPSOs>    sm_pPSOs;
+    static std::array<RefCntAutoPtr<IBuffer>, NumVertexBuffers> sm_pVBs;
+};
+
+std::array<RefCntAutoPtr<IPipelineState>, DrawBenchmark::NumPSOs>    DrawBenchmark::sm_pPSOs;
+std::array<RefCntAutoPtr<IBuffer>, DrawBenchmark::NumVertexBuffers> DrawBenchmark::sm_pVBs;
+
+// Measures the cost of a draw command when no state changes between draws
+TEST_F(DrawBenchmark, Draw)
+{
+    auto* pCtx = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+    BenchmarkCounter Counter{"draw"};
+    while (!Counter.IsComplete())
+    {
+        BeginFrame(pCtx);
+
+        IBuffer* pVBs[] = {sm_pVBs[0]};
+        pCtx->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pCtx->SetPipelineState(sm_pPSOs[0]);
+
+        Counter.Measure(DrawsPerFrame, [&]() {
+            const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+            for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+                pCtx->Draw(DrawAttrs);
+        });
+
+        EndBenchmarkFrame();
+    }
+    Counter.Report();
+}
+
+// Measures the cost of a draw range submitted through a single multi-draw command
+TEST_F(DrawBenchmark, MultiDraw)
+{
+    auto* pCtx = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+    std::vector<MultiDrawItem> DrawItems(DrawsPerFrame, MultiDrawItem{3});
+
+    BenchmarkCounter Counter{"draw"};
+    while (!Counter.IsComplete())
+    {
+        BeginFrame(pCtx);
+
+        IBuffer* pVBs[] = {sm_pVBs[0]};
+        pCtx->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pCtx->SetPipelineState(sm_pPSOs[0]);
+
+        Counter.Measure(DrawsPerFrame, [&]() {
+            const MultiDrawAttribs DrawAttrs{DrawsPerFrame, DrawItems.data(), DRAW_FLAG_NONE};
+            pCtx->MultiDraw(DrawAttrs);
+        });
+
+        EndBenchmarkFrame();
+    }
+    Counter.Report();
+}
+
+// Measures the cost of a draw command when a vertex buffer changes before every draw
+TEST_F(DrawBenchmark, SetVertexBuffers)
+{
+    auto* pCtx = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+    BenchmarkCounter Counter{"draw"};
+    while (!Counter.IsComplete())
+    {
+        BeginFrame(pCtx);
+        pCtx->SetPipelineState(sm_pPSOs[0]);
+
+        Counter.Measure(DrawsPerFrame, [&]() {
+            const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+            for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+            {
+                IBuffer* pVBs[] = {sm_pVBs[i % NumVertexBuffers]};
+                pCtx->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+                pCtx->Draw(DrawAttrs);
+            }
+        });
+
+        EndBenchmarkFrame();
+    }
+    Counter.Report();
+}
+
+// Measures the cost of a draw command when both the pipeline state and
+// the vertex buffer change before every draw
+TEST_F(DrawBenchmark, SetPipelineState)
+{
+    auto* pCtx = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+    BenchmarkCounter Counter{"draw"};
+    while (!Counter.IsComplete())
+    {
+        BeginFrame(pCtx);
+
+        Counter.Measure(DrawsPerFrame, [&]() {
+            const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+            for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+            {
+                pCtx->SetPipelineState(sm_pPSOs[i % NumPSOs]);
+                IBuffer* pVBs[] = {sm_pVBs[i % NumVertexBuffers]};
+                pCtx->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+                pCtx->Draw(DrawAttrs);
+            }
+        });
+
+        EndBenchmarkFrame();
+    }
+    Counter.Report();
+}
+
+} // namespace
@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+#include "DynamicBuffer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Parameter: dynamic buffer growth mode
+class DynamicBufferBenchmark : public testing::TestWithParam<DYNAMIC_BUFFER_GROWTH_MODE>
+{
+protected:
+    static constexpr Uint64 GrowthStep = Uint64{4} << 20;
+    static constexpr Uint32 NumSteps   = 64;
+
+    static void TearDownTestSuite()
+    {
+        TestingEnvironment::GetInstance()->Reset();
+    }
+};
+
+// Grows a buffer from 4 MB to 256 MB in 4 MB steps and measures the latency of every resize,
+// including the time the GPU needs to finish the copy of the existing contents, if any.
+TEST_P(DynamicBufferBenchmark, Grow)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+
+    const auto GrowthMode = GetParam();
+
+    BenchmarkCounter Counter{"resize"};
+    while (!Counter.IsComplete())
+    {
+        DynamicBufferCreateInfo CI;
+        CI.Desc.Name      = "Dynamic buffer benchmark";
+        CI.Desc.Size      = GrowthStep;
+        CI.Desc.BindFlags = BIND_VERTEX_BUFFER;
+        CI.Desc.Usage     = USAGE_DEFAULT;
+        CI.GrowthMode     = GrowthMode;
+        CI.ChunkSize      = GrowthStep;
+
+        DynamicBuffer DynBuff{pDevice, CI};
+        ASSERT_NE(DynBuff.GetBuffer(nullptr, nullptr), nullptr);
+
+        for (Uint32 Step = 1; Step < NumSteps; ++Step)
+        {
+            Counter.Measure(1, [&]() {
+                DynBuff.Resize(pDevice, pCtx, GrowthStep * (Step + 1));
+                pCtx->Flush();
+                pCtx->WaitForIdle();
+            });
+        }
+        EXPECT_EQ(DynBuff.GetDesc().Size, GrowthStep * NumSteps);
+
+        EndBenchmarkFrame();
+    }
+    Counter.Report();
+}
+
+INSTANTIATE_TEST_SUITE_P(GrowthModes,
+                         DynamicBufferBenchmark,
+                         testing::Values(DYNAMIC_BUFFER_GROWTH_MODE_REALLOCATE, DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED),
+                         [](const testing::TestParamInfo<DYNAMIC_BUFFER_GROWTH_MODE>& info) //
+                         {
+                             return std::string{info.param == DYNAMIC_BUFFER_GROWTH_MODE_CHUNKED ? "Chunked" : "Reallocate"};
+                         });
+
+} // namespace
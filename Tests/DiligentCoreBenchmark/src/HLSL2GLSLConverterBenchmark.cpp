@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+#include "HLSL2GLSLConverterImpl.hpp"
+#include "FileSystem.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Measures the HLSL-to-GLSL conversion throughput on the HLSL2GLSLConverter shaders of the API test.
+// The shaders are loaded from shaders/HLSL2GLSLConverter relative to the working directory,
+// so the benchmark must be run from the DiligentCoreAPITest/assets folder.
+class HLSL2GLSLConverterBenchmark : public testing::Test
+{
+protected:
+    struct ShaderInfo
+    {
+        const char* FileName;
+        const char* EntryPoint;
+        SHADER_TYPE Type;
+    };
+
+    // clang-format off
+    static constexpr ShaderInfo Shaders[] =
+    {
+        {"VS_PS.hlsl",        "TestVS", SHADER_TYPE_VERTEX  },
+        {"VS_PS.hlsl",        "TestPS", SHADER_TYPE_PIXEL   },
+        {"CS_RWTex1D.hlsl",   "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWTex2D_1.hlsl", "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWTex2D_2.hlsl", "TestCS", SHADER_TYPE_COMPUTE },
+        {"CS_RWBuff.hlsl",    "TestCS", SHADER_TYPE_COMPUTE },
+        {"GS.hlsl",           "main",   SHADER_TYPE_GEOMETRY}
+    };
+    // clang-format on
+
+    static void SetUpTestSuite()
+    {
+        auto* pEnv = TestingEnvironment::GetInstance();
+        pEnv->GetDevice()->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &m_pShaderSourceFactory);
+
+        // Disable the conversion cache so that every shader is actually converted
+        HLSL2GLSLConverterImpl::GetInstance().SetConversionCacheSize(0);
+    }
+
+    static void TearDownTestSuite()
+    {
+        m_pShaderSourceFactory.Release();
+        // Restore the default cache size
+        HLSL2GLSLConverterImpl::GetInstance().SetConversionCacheSize(size_t{32} << 20);
+    }
+
+    void SetUp() override
+    {
+        if (!FileSystem::FileExists("shaders/HLSL2GLSLConverter/VS_PS.hlsl"))
+        {
+            GTEST_SKIP() << "HLSL2GLSLConverter test shaders are not found. Run the benchmark from the DiligentCoreAPITest/assets folder.";
+        }
+    }
+
+    // Converts all shaders in every timed section
+    static void Run(const char* Name, bool UseTokenPool, bool UseConversionStream)
+    {
+        const auto& Converter = HLSL2GLSLConverterImpl::GetInstance();
+
+        RefCntAutoPtr<IHLSL2GLSLConversionStream> pStreams[_countof(Shaders)];
+
+        BenchmarkCounter Counter{"conversion"};
+        while (!Counter.IsComplete())
+        {
+            Counter.Measure(_countof(Shaders), [&]() {
+                for (size_t i = 0; i < _countof(Shaders); ++i)
+                {
+                    const auto& Shader = Shaders[i];
+
+                    HLSL2GLSLConverterImpl::ConversionAttribs Attribs;
+                    Attribs.pSourceStreamFactory = m_pShaderSourceFactory;
+                    Attribs.InputFileName        = Shader.FileName;
+                    Attribs.EntryPoint           = Shader.EntryPoint;
+                    Attribs.ShaderType           = Shader.Type;
+                    Attribs.IncludeDefinitions   = true;
+                    Attribs.UseTokenPool         = UseTokenPool;
+                    // Conversion streams preserve the tokens of the source and copy them for every conversion
+                    if (UseConversionStream)
+                        Attribs.ppConversionStream = pStreams[i].RawDblPtr();
+
+                    const auto GLSL = Converter.Convert(Attribs);
+                    if (GLSL.empty())
+                        ADD_FAILURE() << "Failed to convert " << Shader.FileName << " (" << Shader.EntryPoint << ")";
+                }
+            });
+        }
+        Counter.Report(Name);
+    }
+
+    static RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pShaderSourceFactory;
+};
+
+constexpr HLSL2GLSLConverterBenchmark::ShaderInfo HLSL2GLSLConverterBenchmark::Shaders[];
+RefCntAutoPtr<IShaderSourceInputStreamFactory>   HLSL2GLSLConverterBenchmark::m_pShaderSourceFactory;
+
+TEST_F(HLSL2GLSLConverterBenchmark, Convert)
+{
+    Run("no_token_pool", false, false);
+    Run("token_pool", true, false);
+}
+
+TEST_F(HLSL2GLSLConverterBenchmark, ConvertFromStream)
+{
+    Run("stream", true, true);
+}
+
+} // namespace
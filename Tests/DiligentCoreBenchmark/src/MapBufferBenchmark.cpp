@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Parameter: the size of the data written to the buffer every time it is mapped
+class MapBufferBenchmark : public testing::TestWithParam<Uint32>
+{
+protected:
+    static constexpr Uint32 NumBuffers    = 8;
+    static constexpr Uint32 MapsPerBuffer = 64;
+
+    static void TearDownTestSuite()
+    {
+        TestingEnvironment::GetInstance()->Reset();
+    }
+};
+
+// Measures the throughput of MapBuffer(MAP_WRITE, MAP_FLAG_DISCARD) + memcpy + UnmapBuffer on dynamic buffers
+TEST_P(MapBufferBenchmark, MapDiscard)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+
+    const auto DataSize = GetParam();
+
+    std::vector<RefCntAutoPtr<IBuffer>> pBuffers(NumBuffers);
+    for (auto& pBuffer : pBuffers)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Map buffer benchmark dynamic buffer";
+        BuffDesc.Size           = DataSize;
+        BuffDesc.BindFlags      = BIND_VERTEX_BUFFER;
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+    }
+
+    const std::vector<Uint8> SrcData(DataSize, 0xAB);
+
+    BenchmarkCounter Counter{"map"};
+    while (!Counter.IsComplete())
+    {
+        Counter.Measure(Uint64{NumBuffers} * MapsPerBuffer, [&]() {
+            for (Uint32 i = 0; i < MapsPerBuffer; ++i)
+            {
+                for (auto& pBuffer : pBuffers)
+                {
+                    void* pData = nullptr;
+                    pCtx->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+                    memcpy(pData, SrcData.data(), DataSize);
+                    pCtx->UnmapBuffer(pBuffer, MAP_WRITE);
+                }
+            }
+        });
+
+        EndBenchmarkFrame();
+    }
+    Counter.Report(nullptr, DataSize);
+}
+
+INSTANTIATE_TEST_SUITE_P(DataSizes,
+                         MapBufferBenchmark,
+                         testing::Values<Uint32>(256, 4096, 65536),
+                         [](const testing::TestParamInfo<Uint32>& info) //
+                         {
+                             return std::to_string(info.param) + "Bytes";
+                         });
+
+} // namespace
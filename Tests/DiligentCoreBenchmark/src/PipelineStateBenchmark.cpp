@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <string>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* PipelineStateBenchmark_VS = R"(
+void main(in  float4 Pos    : ATTRIB0,
+          out float4 PosOut : SV_Position)
+{
+    PosOut = Pos;
+}
+)";
+
+const char* PipelineStateBenchmark_PS = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(PS_INDEX, 0.0, 0.0, 1.0);
+}
+)";
+
+class PipelineStateBenchmark : public ::testing::Test
+{
+protected:
+    // Every pipeline uses the same vertex shader and one of the pixel shaders, which is the
+    // typical case when many materials are rendered with the same vertex processing.
+    static constexpr Uint32 NumPixelShaders = 16;
+
+    static void SetUpTestSuite()
+    {
+        sm_pVS = CreateBenchmarkShader("PSO benchmark VS", SHADER_TYPE_VERTEX, PipelineStateBenchmark_VS);
+        ASSERT_NE(sm_pVS, nullptr);
+
+        for (Uint32 i = 0; i < NumPixelShaders; ++i)
+        {
+            std::string Source = std::string{"#define PS_INDEX "} + std::to_string(i) + ".0\n" + PipelineStateBenchmark_PS;
+
+            sm_pPSs[i] = CreateBenchmarkShader("PSO benchmark PS", SHADER_TYPE_PIXEL, Source.c_str());
+            ASSERT_NE(sm_pPSs[i], nullptr);
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_pVS.Release();
+        for (auto& pPS : sm_pPSs)
+            pPS.Release();
+
+        auto* pEnv = TestingEnvironment::GetInstance();
+        pEnv->Reset();
+    }
+
+    // Creates a pipeline for every pixel shader and measures the total time
+    static void CreatePipelines(PSO_CREATE_FLAGS Flags)
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+        BenchmarkCounter Counter{"pipeline"};
+        while (!Counter.IsComplete())
+        {
+            std::array<RefCntAutoPtr<IPipelineState>, NumPixelShaders> pPSOs;
+
+            Counter.Measure(NumPixelShaders, [&]() {
+                for (Uint32 i = 0; i < NumPixelShaders; ++i)
+                {
+                    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+                    InitBenchmarkPSOCreateInfo(PSOCreateInfo, "PSO benchmark PSO", sm_pVS, sm_pPSs[i]);
+                    PSOCreateInfo.Flags = Flags;
+                    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSOs[i]);
+                }
+
+                // Asynchronous pipelines are only counted when they are ready to be used
+                for (auto& pPSO : pPSOs)
+                {
+                    if (pPSO)
+                        pPSO->GetStatus(/*WaitForCompletion = */ true);
+                }
+            });
+
+            for (const auto& pPSO : pPSOs)
+                ASSERT_NE(pPSO, nullptr);
+
+            for (auto& pPSO : pPSOs)
+                pPSO.Release();
+
+            EndBenchmarkFrame();
+        }
+        Counter.Report();
+    }
+
+    static RefCntAutoPtr<IShader>                              sm_pVS;
+    static std::array<RefCntAutoPtr<IShader>, NumPixelShaders> sm_pPSs;
+};
+
+RefCntAutoPtr<IShader>                                                      PipelineStateBenchmark::sm_pVS;
+std::array<RefCntAutoPtr<IShader>, PipelineStateBenchmark::NumPixelShaders> PipelineStateBenchmark::sm_pPSs;
+
+// Measures the cost of creating monolithic graphics pipelines
+TEST_F(PipelineStateBenchmark, CreateMonolithic)
+{
+    CreatePipelines(PSO_CREATE_FLAG_NONE);
+}
+
+// Measures the cost of creating graphics pipelines by linking separately compiled parts.
+// After the first iteration, all parts are found in the pipeline library cache.
+TEST_F(PipelineStateBenchmark, CreateFastLink)
+{
+    CreatePipelines(PSO_CREATE_FLAG_FAST_LINK);
+}
+
+// Measures the cost of creating graphics pipelines in the device thread pool,
+// including the time spent waiting for all pipelines to become ready.
+TEST_F(PipelineStateBenchmark, CreateAsynchronous)
+{
+    CreatePipelines(PSO_CREATE_FLAG_ASYNCHRONOUS);
+}
+
+} // namespace
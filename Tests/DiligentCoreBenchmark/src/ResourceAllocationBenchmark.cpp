@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Keeps a fixed number of live resources and replaces a random one with a new resource of
+// random size on every operation. The mix of small and large resources exercises all size
+// classes of the device memory allocator, and large textures use dedicated allocations where
+// supported.
+class ResourceAllocationBenchmark : public testing::Test
+{
+protected:
+    static constexpr Uint32 NumLiveResources   = 256;
+    static constexpr Uint32 ReplacementsPerRun = 64;
+
+    static void TearDownTestSuite()
+    {
+        TestingEnvironment::GetInstance()->Reset();
+    }
+
+    template <typename ResourceType, typename CreateResourceType>
+    static void RunChurn(const char* OpName, CreateResourceType&& CreateResource)
+    {
+        FastRand Rnd{0};
+
+        std::vector<RefCntAutoPtr<ResourceType>> Resources(NumLiveResources);
+        for (auto& pResource : Resources)
+        {
+            pResource = CreateResource(Rnd);
+            ASSERT_NE(pResource, nullptr);
+        }
+        EndBenchmarkFrame();
+
+        BenchmarkCounter Counter{OpName};
+        while (!Counter.IsComplete())
+        {
+            Counter.Measure(ReplacementsPerRun, [&]() {
+                for (Uint32 i = 0; i < ReplacementsPerRun; ++i)
+                {
+                    auto& pResource = Resources[Rnd() % NumLiveResources];
+                    pResource.Release();
+                    pResource = CreateResource(Rnd);
+                }
+            });
+
+            // Resources are released when the frame is finished
+            EndBenchmarkFrame();
+        }
+        Counter.Report();
+    }
+};
+
+// Measures the cost of creating and releasing default-usage buffers from 256 bytes to 4 MB
+TEST_F(ResourceAllocationBenchmark, Buffers)
+{
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+    RunChurn<IBuffer>("buffer", [pDevice](FastRand& Rnd) {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Resource allocation benchmark buffer";
+        BuffDesc.Size      = Uint64{256} << (Rnd() % 15);
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        return pBuffer;
+    });
+}
+
+// Measures the cost of creating and releasing RGBA8 textures from 16x16 to 2048x2048
+TEST_F(ResourceAllocationBenchmark, Textures)
+{
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+    RunChurn<ITexture>("texture", [pDevice](FastRand& Rnd) {
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Resource allocation benchmark texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 16u << (Rnd() % 8);
+        TexDesc.Height    = TexDesc.Width;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+        TexDesc.Usage     = USAGE_DEFAULT;
+
+        RefCntAutoPtr<ITexture> pTexture;
+        pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+        return pTexture;
+    });
+}
+
+} // namespace
@@ -0,0 +1,282 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+#include "FastRand.hpp"
+#include "BasicMath.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Parameter: the number of instances in the TLAS
+class TLASBuildBenchmark : public testing::TestWithParam<Uint32>
+{
+protected:
+    // The fraction of instances that move every frame in the partial update benchmark
+    static constexpr Uint32 DirtyInstanceFraction = 100;
+
+    static void SetUpTestSuite()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+        auto* pCtx    = pEnv->GetDeviceContext();
+
+        if (!pDevice->GetDeviceInfo().Features.RayTracing)
+            return;
+
+        // A single triangle is enough: the benchmark measures the CPU cost of IDeviceContext::BuildTLAS()
+        const float3 Vertices[] = {float3{0, 0, 0}, float3{1, 0, 0}, float3{0, 1, 0}};
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "TLAS build benchmark vertex buffer";
+        BuffDesc.Size      = sizeof(Vertices);
+        BuffDesc.BindFlags = BIND_RAY_TRACING;
+        BuffDesc.Usage     = USAGE_IMMUTABLE;
+
+        BufferData             VBData{Vertices, sizeof(Vertices)};
+        RefCntAutoPtr<IBuffer> pVertexBuffer;
+        pDevice->CreateBuffer(BuffDesc, &VBData, &pVertexBuffer);
+        ASSERT_NE(pVertexBuffer, nullptr);
+
+        BLASTriangleDesc TriangleDesc;
+        TriangleDesc.GeometryName         = "Triangle";
+        TriangleDesc.MaxVertexCount       = 3;
+        TriangleDesc.VertexValueType      = VT_FLOAT32;
+        TriangleDesc.VertexComponentCount = 3;
+        TriangleDesc.MaxPrimitiveCount    = 1;
+
+        BottomLevelASDesc BLASDesc;
+        BLASDesc.Name          = "TLAS build benchmark BLAS";
+        BLASDesc.pTriangles    = &TriangleDesc;
+        BLASDesc.TriangleCount = 1;
+        pDevice->CreateBLAS(BLASDesc, &sm_pBLAS);
+        ASSERT_NE(sm_pBLAS, nullptr);
+
+        BuffDesc.Name  = "TLAS build benchmark BLAS scratch buffer";
+        BuffDesc.Size  = sm_pBLAS->GetScratchBufferSizes().Build;
+        BuffDesc.Usage = USAGE_DEFAULT;
+        RefCntAutoPtr<IBuffer> pScratchBuffer;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pScratchBuffer);
+        ASSERT_NE(pScratchBuffer, nullptr);
+
+        BLASBuildTriangleData TriangleData;
+        TriangleData.GeometryName         = TriangleDesc.GeometryName;
+        TriangleData.pVertexBuffer        = pVertexBuffer;
+        TriangleData.VertexStride         = sizeof(float3);
+        TriangleData.VertexCount          = 3;
+        TriangleData.VertexValueType      = VT_FLOAT32;
+        TriangleData.VertexComponentCount = 3;
+        TriangleData.PrimitiveCount       = 1;
+        TriangleData.Flags                = RAYTRACING_GEOMETRY_FLAG_OPAQUE;
+
+        BuildBLASAttribs BuildAttribs;
+        BuildAttribs.pBLAS                       = sm_pBLAS;
+        BuildAttribs.BLASTransitionMode          = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        BuildAttribs.GeometryTransitionMode      = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        BuildAttribs.pTriangleData               = &TriangleData;
+        BuildAttribs.TriangleDataCount           = 1;
+        BuildAttribs.pScratchBuffer              = pScratchBuffer;
+        BuildAttribs.ScratchBufferTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        pCtx->BuildBLAS(BuildAttribs);
+        EndBenchmarkFrame();
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_pBLAS.Release();
+        TestingEnvironment::GetInstance()->Reset();
+    }
+
+    void SetUp() override
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+        if (!pDevice->GetDeviceInfo().Features.RayTracing)
+            GTEST_SKIP() << "Ray tracing is not supported by this device";
+
+        const auto InstanceCount = GetParam();
+
+        TopLevelASDesc TLASDesc;
+        TLASDesc.Name             = "TLAS build benchmark TLAS";
+        TLASDesc.MaxInstanceCount = InstanceCount;
+        TLASDesc.Flags            = RAYTRACING_BUILD_AS_ALLOW_UPDATE | RAYTRACING_BUILD_AS_PREFER_FAST_BUILD;
+        pDevice->CreateTLAS(TLASDesc, &m_pTLAS);
+        ASSERT_NE(m_pTLAS, nullptr);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "TLAS build benchmark scratch buffer";
+        BuffDesc.Size      = std::max(m_pTLAS->GetScratchBufferSizes().Build, m_pTLAS->GetScratchBufferSizes().Update);
+        BuffDesc.BindFlags = BIND_RAY_TRACING;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &m_pScratchBuffer);
+        ASSERT_NE(m_pScratchBuffer, nullptr);
+
+        BuffDesc.Name = "TLAS build benchmark instance buffer";
+        BuffDesc.Size = Uint64{TLAS_INSTANCE_DATA_SIZE} * InstanceCount;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &m_pInstanceBuffer);
+        ASSERT_NE(m_pInstanceBuffer, nullptr);
+
+        m_InstanceNames.resize(InstanceCount);
+        m_Instances.resize(InstanceCount);
+        for (Uint32 i = 0; i < InstanceCount; ++i)
+        {
+            m_InstanceNames[i] = "Instance " + std::to_string(i);
+
+            auto& Inst        = m_Instances[i];
+            Inst.InstanceName = m_InstanceNames[i].c_str();
+            Inst.pBLAS        = sm_pBLAS;
+            Inst.CustomId     = i;
+            Inst.Transform.SetTranslation(static_cast<float>(i % 256), static_cast<float>(i / 256), 0);
+        }
+    }
+
+    void TearDown() override
+    {
+        m_pTLAS.Release();
+        m_pScratchBuffer.Release();
+        m_pInstanceBuffer.Release();
+    }
+
+    BuildTLASAttribs GetBuildAttribs()
+    {
+        BuildTLASAttribs Attribs;
+        Attribs.pTLAS                        = m_pTLAS;
+        Attribs.pInstances                   = m_Instances.data();
+        Attribs.InstanceCount                = static_cast<Uint32>(m_Instances.size());
+        Attribs.HitGroupStride               = 1;
+        Attribs.BindingMode                  = HIT_GROUP_BINDING_MODE_PER_INSTANCE;
+        Attribs.pInstanceBuffer              = m_pInstanceBuffer;
+        Attribs.pScratchBuffer               = m_pScratchBuffer;
+        Attribs.TLASTransitionMode           = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        Attribs.BLASTransitionMode           = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        Attribs.InstanceBufferTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        Attribs.ScratchBufferTransitionMode  = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        return Attribs;
+    }
+
+    // Runs the build until the benchmark is complete. UpdateInstances is called before every build
+    // outside of the timed section and moves the instances that must be updated.
+    template <typename UpdateInstancesType>
+    void RunBuilds(BuildTLASAttribs& Attribs, UpdateInstancesType&& UpdateInstances)
+    {
+        auto* pCtx = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+        BenchmarkCounter Counter{"build"};
+        while (!Counter.IsComplete())
+        {
+            UpdateInstances();
+            Counter.Measure(1, [&]() {
+                pCtx->BuildTLAS(Attribs);
+            });
+
+            EndBenchmarkFrame();
+        }
+        Counter.Report(nullptr);
+    }
+
+    // FastRand only produces 15-bit values
+    Uint32 GetRandomInstanceIndex()
+    {
+        return (m_Rnd() * (FastRand::Max + 1) + m_Rnd()) % static_cast<Uint32>(m_Instances.size());
+    }
+
+    static RefCntAutoPtr<IBottomLevelAS> sm_pBLAS;
+
+    RefCntAutoPtr<ITopLevelAS> m_pTLAS;
+    RefCntAutoPtr<IBuffer>     m_pScratchBuffer;
+    RefCntAutoPtr<IBuffer>     m_pInstanceBuffer;
+
+    std::vector<std::string>           m_InstanceNames;
+    std::vector<TLASBuildInstanceData> m_Instances;
+
+    FastRand m_Rnd{0};
+};
+
+RefCntAutoPtr<IBottomLevelAS> TLASBuildBenchmark::sm_pBLAS;
+
+// Measures BuildTLAS() that builds the TLAS from scratch every time
+TEST_P(TLASBuildBenchmark, FullBuild)
+{
+    auto Attribs = GetBuildAttribs();
+    RunBuilds(Attribs, []() {});
+}
+
+// Measures BuildTLAS() that updates all instances, which are looked up by name
+TEST_P(TLASBuildBenchmark, UpdateByName)
+{
+    auto* pCtx    = TestingEnvironment::GetInstance()->GetDeviceContext();
+    auto  Attribs = GetBuildAttribs();
+    pCtx->BuildTLAS(Attribs);
+
+    Attribs.Update = true;
+
+    RunBuilds(Attribs, [&]() {
+        const auto NumDirty = std::max(GetParam() / DirtyInstanceFraction, 1u);
+        for (Uint32 i = 0; i < NumDirty; ++i)
+            m_Instances[GetRandomInstanceIndex()].Transform.data[2][3] += 1.f;
+    });
+}
+
+// Measures BuildTLAS() that only updates the instances that moved, which are addressed by index
+TEST_P(TLASBuildBenchmark, UpdateDirty)
+{
+    auto* pCtx    = TestingEnvironment::GetInstance()->GetDeviceContext();
+    auto  Attribs = GetBuildAttribs();
+    pCtx->BuildTLAS(Attribs);
+
+    std::vector<Uint32> DirtyIndices(std::max(GetParam() / DirtyInstanceFraction, 1u));
+    Attribs.Update                = true;
+    Attribs.pDirtyInstanceIndices = DirtyIndices.data();
+    Attribs.DirtyInstanceCount    = static_cast<Uint32>(DirtyIndices.size());
+
+    RunBuilds(Attribs, [&]() {
+        for (auto& Idx : DirtyIndices)
+        {
+            Idx = GetRandomInstanceIndex();
+            m_Instances[Idx].Transform.data[2][3] += 1.f;
+        }
+    });
+}
+
+INSTANTIATE_TEST_SUITE_P(InstanceCounts,
+                         TLASBuildBenchmark,
+                         testing::Values<Uint32>(1000, 100000),
+                         [](const testing::TestParamInfo<Uint32>& info) //
+                         {
+                             return std::to_string(info.param) + "Instances";
+                         });
+
+} // namespace
@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <memory>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+#include "DurationQueryHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Compares mipmap generation by the compute shader with the blit chain for the same RGBA8_UNORM
+// texture. The compute path is used when the texture is created with BIND_UNORDERED_ACCESS and
+// computes up to 12 mip levels in a single dispatch, while the blit path issues one blit and two
+// layout transitions per mip level.
+class GenerateMipsBenchmarkVk : public testing::Test
+{
+protected:
+    static constexpr Uint32 TextureSize = 2048;
+
+    static void TearDownTestSuite()
+    {
+        TestingEnvironment::GetInstance()->Reset();
+    }
+
+    // The engine does not expose barrier statistics, so the number of vkCmdPipelineBarrier
+    // calls per mip chain is derived from the code path taken by GenerateMipsVkHelper
+    // when the entire texture is processed in its steady state.
+    static Uint32 GetNumBarriersPerMipChain(bool UseCompute, Uint32 MipLevels)
+    {
+        if (UseCompute)
+        {
+            // One UAV barrier before the first dispatch and one between consecutive dispatches.
+            // Every dispatch computes up to 12 mip levels when the source size does not exceed 4096.
+            constexpr Uint32 MaxMipsPerDispatch = 12;
+            return (MipLevels - 1 + MaxMipsPerDispatch - 1) / MaxMipsPerDispatch;
+        }
+        else
+        {
+            // Every generated mip level is transitioned to TRANSFER_DST before the blit
+            // and to TRANSFER_SRC after it.
+            return 2 * (MipLevels - 1);
+        }
+    }
+
+    static double Run(bool UseCompute, const char* Name)
+    {
+        auto* pEnv     = TestingEnvironment::GetInstance();
+        auto* pDevice  = pEnv->GetDevice();
+        auto* pContext = pEnv->GetDeviceContext();
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Generate mips benchmark texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.Width     = TextureSize;
+        TexDesc.Height    = TextureSize;
+        TexDesc.MipLevels = 0;
+        TexDesc.BindFlags = UseCompute ? BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS : BIND_SHADER_RESOURCE;
+        TexDesc.Usage     = USAGE_DEFAULT;
+        TexDesc.MiscFlags = MISC_TEXTURE_FLAG_GENERATE_MIPS;
+
+        RefCntAutoPtr<ITexture> pTex;
+        pDevice->CreateTexture(TexDesc, nullptr, &pTex);
+        if (pTex == nullptr)
+        {
+            ADD_FAILURE() << "Failed to create texture: " << TexDesc;
+            return 0;
+        }
+        auto* pSRV = pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+        std::unique_ptr<DurationQueryHelper> pDurationQuery;
+        if (pDevice->GetDeviceInfo().Features.TimestampQueries)
+            pDurationQuery.reset(new DurationQueryHelper{pDevice, 2});
+
+        // Warm up: compile the pipeline and transition the texture to its steady state
+        pContext->GenerateMips(pSRV);
+        EndBenchmarkFrame();
+
+        double GPUTime       = 0;
+        Uint32 NumGPUSamples = 0;
+
+        BenchmarkCounter Counter{"mip_chain"};
+        while (!Counter.IsComplete())
+        {
+            // The measurement includes the GPU time as the context waits for the commands to complete
+            Counter.Measure(1, [&]() {
+                if (pDurationQuery)
+                    pDurationQuery->Begin(pContext);
+                pContext->GenerateMips(pSRV);
+                if (pDurationQuery)
+                {
+                    double Duration = 0;
+                    if (pDurationQuery->End(pContext, Duration))
+                    {
+                        GPUTime += Duration;
+                        ++NumGPUSamples;
+                    }
+                }
+                pContext->Flush();
+                pContext->WaitForIdle();
+            });
+            EndBenchmarkFrame();
+        }
+        Counter.Report(Name);
+
+        const std::string Prefix      = Name;
+        const auto        NumBarriers = GetNumBarriersPerMipChain(UseCompute, pTex->GetDesc().MipLevels);
+        RecordProperty(Prefix + "_barriers_per_mip_chain", std::to_string(NumBarriers));
+
+        std::stringstream ss;
+        ss << "[ BENCHMRK ] " << Name << ": " << NumBarriers << " barriers/mip_chain";
+        if (NumGPUSamples > 0)
+        {
+            const auto GPUTimeUs = GPUTime / NumGPUSamples * 1e+6;
+            RecordProperty(Prefix + "_gpu_us_per_mip_chain", std::to_string(GPUTimeUs));
+            ss << ", " << std::fixed << std::setprecision(1) << GPUTimeUs << " GPU us/mip_chain";
+        }
+        std::cout << ss.str() << std::endl;
+
+        return Counter.GetOpsPerSecond();
+    }
+};
+
+TEST_F(GenerateMipsBenchmarkVk, ComputeVsBlit)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+    {
+        GTEST_SKIP() << "This benchmark is specific to Vulkan";
+    }
+    if ((pDevice->GetTextureFormatInfoExt(TEX_FORMAT_RGBA8_UNORM).BindFlags & BIND_UNORDERED_ACCESS) == 0)
+    {
+        GTEST_SKIP() << "RGBA8_UNORM format can't be used as a storage image on this device";
+    }
+
+    const auto BlitOpsPerSecond    = Run(false, "blit");
+    const auto ComputeOpsPerSecond = Run(true, "compute");
+    if (BlitOpsPerSecond > 0)
+        RecordProperty("compute_speedup", std::to_string(ComputeOpsPerSecond / BlitOpsPerSecond));
+}
+
+} // namespace
@@ -0,0 +1,322 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define VK_NO_PROTOTYPES
+#include "vulkan/vulkan.h"
+
+#include "DeviceContextVk.h"
+#include "TestingEnvironment.hpp"
+#include "BenchmarkBase.hpp"
+#include "ThreadSignal.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* SecondaryCommandListBenchmark_VS = R"(
+cbuffer Constants
+{
+    float4 g_Scale;
+};
+
+void main(in  float4 Pos    : ATTRIB0,
+          out float4 PosOut : SV_Position)
+{
+    PosOut = Pos * g_Scale;
+}
+)";
+
+const char* SecondaryCommandListBenchmark_PS = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float4(0.0, 0.0, 1.0, 1.0);
+}
+)";
+
+class SecondaryCommandListBenchmarkVk : public ::testing::Test
+{
+protected:
+    static constexpr Uint32 DrawsPerThread = 4096;
+
+    static void SetUpTestSuite()
+    {
+        auto* pEnv       = TestingEnvironment::GetInstance();
+        auto* pDevice    = pEnv->GetDevice();
+        auto* pSwapChain = pEnv->GetSwapChain();
+        if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+            return;
+
+        RenderPassAttachmentDesc Attachments[1];
+        Attachments[0].Format       = pSwapChain->GetDesc().ColorBufferFormat;
+        Attachments[0].SampleCount  = 1;
+        Attachments[0].LoadOp       = ATTACHMENT_LOAD_OP_LOAD;
+        Attachments[0].StoreOp      = ATTACHMENT_STORE_OP_STORE;
+        Attachments[0].InitialState = RESOURCE_STATE_RENDER_TARGET;
+        Attachments[0].FinalState   = RESOURCE_STATE_RENDER_TARGET;
+
+        AttachmentReference RTAttachmentRefs[] = {{0, RESOURCE_STATE_RENDER_TARGET}};
+
+        SubpassDesc Subpasses[1];
+        Subpasses[0].RenderTargetAttachmentCount = _countof(RTAttachmentRefs);
+        Subpasses[0].pRenderTargetAttachments    = RTAttachmentRefs;
+
+        RenderPassDesc RPDesc;
+        RPDesc.Name            = "Secondary command list benchmark render pass";
+        RPDesc.AttachmentCount = _countof(Attachments);
+        RPDesc.pAttachments    = Attachments;
+        RPDesc.SubpassCount    = _countof(Subpasses);
+        RPDesc.pSubpasses      = Subpasses;
+
+        pDevice->CreateRenderPass(RPDesc, &sm_pRenderPass);
+        ASSERT_NE(sm_pRenderPass, nullptr);
+
+        const PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_VERTEX, "Constants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE} //
+        };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "Secondary command list benchmark signature";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+        ASSERT_NE(pPRS, nullptr);
+
+        auto pVS = CreateBenchmarkShader("Secondary command list benchmark VS", SHADER_TYPE_VERTEX, SecondaryCommandListBenchmark_VS);
+        ASSERT_NE(pVS, nullptr);
+        auto pPS = CreateBenchmarkShader("Secondary command list benchmark PS", SHADER_TYPE_PIXEL, SecondaryCommandListBenchmark_PS);
+        ASSERT_NE(pPS, nullptr);
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        InitBenchmarkPSOCreateInfo(PSOCreateInfo, "Secondary command list benchmark PSO", pVS, pPS);
+
+        // Render target formats are defined by the render pass
+        auto& GraphicsPipeline            = PSOCreateInfo.GraphicsPipeline;
+        GraphicsPipeline.NumRenderTargets = 0;
+        GraphicsPipeline.RTVFormats[0]    = TEX_FORMAT_UNKNOWN;
+        GraphicsPipeline.DSVFormat        = TEX_FORMAT_UNKNOWN;
+        GraphicsPipeline.pRenderPass      = sm_pRenderPass;
+        GraphicsPipeline.SubpassIndex     = 0;
+
+        IPipelineResourceSignature* ppSignatures[] = {pPRS};
+        PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+        PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &sm_pPSO);
+        ASSERT_NE(sm_pPSO, nullptr);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Secondary command list benchmark constant buffer";
+        BuffDesc.Size      = 256;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+
+        RefCntAutoPtr<IBuffer> pCB;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pCB);
+        ASSERT_NE(pCB, nullptr);
+
+        pPRS->CreateShaderResourceBinding(&sm_pSRB, true);
+        ASSERT_NE(sm_pSRB, nullptr);
+        sm_pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "Constants")->Set(pCB);
+
+        sm_pVB = CreateBenchmarkVertexBuffer(3);
+        ASSERT_NE(sm_pVB, nullptr);
+
+        // Deferred contexts can't transition resource states, so do this once in the immediate context
+        auto* pCtx = pEnv->GetDeviceContext();
+
+        const StateTransitionDesc Barriers[] = {
+            {pCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE},
+            {sm_pVB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_VERTEX_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE} //
+        };
+        pCtx->TransitionResourceStates(_countof(Barriers), Barriers);
+        pCtx->Flush();
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_pRenderPass.Release();
+        sm_pPSO.Release();
+        sm_pSRB.Release();
+        sm_pVB.Release();
+
+        TestingEnvironment::GetInstance()->Reset();
+    }
+
+    static RefCntAutoPtr<IFramebuffer> CreateFramebuffer()
+    {
+        auto* pEnv       = TestingEnvironment::GetInstance();
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        ITextureView* pAttachments[] = {pSwapChain->GetCurrentBackBufferRTV()};
+
+        FramebufferDesc FBDesc;
+        FBDesc.Name            = "Secondary command list benchmark framebuffer";
+        FBDesc.pRenderPass     = sm_pRenderPass;
+        FBDesc.AttachmentCount = _countof(pAttachments);
+        FBDesc.ppAttachments   = pAttachments;
+
+        RefCntAutoPtr<IFramebuffer> pFramebuffer;
+        pEnv->GetDevice()->CreateFramebuffer(FBDesc, &pFramebuffer);
+        return pFramebuffer;
+    }
+
+    static void RecordDraws(IDeviceContextVk* pCtxVk, IDeviceContext* pImmediateCtx)
+    {
+        pCtxVk->BeginSecondaryCommandList(pImmediateCtx);
+
+        IBuffer* pVBs[] = {sm_pVB};
+        pCtxVk->SetVertexBuffers(0, 1, pVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pCtxVk->SetPipelineState(sm_pPSO);
+        pCtxVk->CommitShaderResources(sm_pSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+        for (Uint32 i = 0; i < DrawsPerThread; ++i)
+            pCtxVk->Draw(DrawAttrs);
+    }
+
+    static RefCntAutoPtr<IRenderPass>            sm_pRenderPass;
+    static RefCntAutoPtr<IPipelineState>         sm_pPSO;
+    static RefCntAutoPtr<IShaderResourceBinding> sm_pSRB;
+    static RefCntAutoPtr<IBuffer>                sm_pVB;
+};
+
+RefCntAutoPtr<IRenderPass>            SecondaryCommandListBenchmarkVk::sm_pRenderPass;
+RefCntAutoPtr<IPipelineState>         SecondaryCommandListBenchmarkVk::sm_pPSO;
+RefCntAutoPtr<IShaderResourceBinding> SecondaryCommandListBenchmarkVk::sm_pSRB;
+RefCntAutoPtr<IBuffer>                SecondaryCommandListBenchmarkVk::sm_pVB;
+
+// Measures how the total draw recording throughput scales with the number of threads
+// that record secondary command lists for the same subpass in parallel.
+TEST_F(SecondaryCommandListBenchmarkVk, RecordingScaling)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+    {
+        GTEST_SKIP() << "Secondary command lists are only supported in Vulkan";
+    }
+    if (pEnv->GetNumDeferredContexts() == 0)
+    {
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+    }
+
+    auto* pImmediateCtx = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IDeviceContextVk> pImmediateCtxVk{pImmediateCtx, IID_DeviceContextVk};
+    ASSERT_NE(pImmediateCtxVk, nullptr);
+
+    const auto MaxThreads = static_cast<Uint32>(pEnv->GetNumDeferredContexts());
+
+    double SingleThreadDrawsPerSecond = 0;
+    for (Uint32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumThreads);
+        std::vector<ICommandList*>               CmdListPtrs(NumThreads);
+
+        BenchmarkCounter Counter{"draw"};
+        while (!Counter.IsComplete())
+        {
+            auto pFramebuffer = CreateFramebuffer();
+            ASSERT_NE(pFramebuffer, nullptr);
+
+            BeginRenderPassAttribs RPBeginInfo;
+            RPBeginInfo.pRenderPass         = sm_pRenderPass;
+            RPBeginInfo.pFramebuffer        = pFramebuffer;
+            RPBeginInfo.StateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+            pImmediateCtxVk->BeginRenderPassWithSecondaryCommandLists(RPBeginInfo);
+
+            std::vector<std::thread> WorkerThreads(NumThreads);
+
+            std::atomic<Uint32>    NumCmdListsReady{0};
+            ThreadingTools::Signal FinishFrameSignal;
+            ThreadingTools::Signal ExecuteCommandListsSignal;
+
+            // Thread start-up time is included in the measurement, but it is negligible compared to
+            // the time it takes to record the draw commands.
+            Counter.Measure(Uint64{DrawsPerThread} * NumThreads, [&]() {
+                for (Uint32 i = 0; i < NumThreads; ++i)
+                {
+                    WorkerThreads[i] = std::thread(
+                        [&](Uint32 thread_id) //
+                        {
+                            RefCntAutoPtr<IDeviceContextVk> pCtxVk{pEnv->GetDeferredContext(thread_id), IID_DeviceContextVk};
+
+                            RecordDraws(pCtxVk, pImmediateCtx);
+
+                            pCtxVk->FinishCommandList(&CmdLists[thread_id]);
+                            CmdListPtrs[thread_id] = CmdLists[thread_id];
+
+                            // Atomically increment the number of completed threads
+                            const auto NumReadyLists = NumCmdListsReady.fetch_add(1) + 1;
+                            if (NumReadyLists == NumThreads)
+                                ExecuteCommandListsSignal.Trigger();
+
+                            FinishFrameSignal.Wait(true, NumThreads);
+
+                            pCtxVk->FinishFrame();
+                        },
+                        i);
+                }
+
+                // Wait for the worker threads
+                ExecuteCommandListsSignal.Wait(true, 1);
+            });
+
+            pImmediateCtx->ExecuteCommandLists(NumThreads, CmdListPtrs.data());
+            pImmediateCtx->EndRenderPass();
+
+            FinishFrameSignal.Trigger(true);
+            for (auto& t : WorkerThreads)
+                t.join();
+
+            for (auto& pCmdList : CmdLists)
+                pCmdList.Release();
+
+            EndBenchmarkFrame();
+        }
+
+        const auto Name = std::to_string(NumThreads) + "_threads";
+        Counter.Report(Name.c_str());
+
+        if (NumThreads == 1)
+            SingleThreadDrawsPerSecond = Counter.GetOpsPerSecond();
+        else if (SingleThreadDrawsPerSecond > 0)
+            RecordProperty(Name + "_scaling", std::to_string(Counter.GetOpsPerSecond() / SingleThreadDrawsPerSecond));
+    }
+}
+
+} // namespace
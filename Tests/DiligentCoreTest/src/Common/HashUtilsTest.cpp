@@ -116,4 +116,16 @@ TEST(Common_HashUtils, HashMapStringKey)
     }
 }
 
+TEST(Common_HashUtils, ComputeHashRaw)
+{
+    const char Data1[] = "Some test data that is longer than a machine word";
+    const char Data2[] = "Some test data that is longer than a machine word";
+    const char Data3[] = "Some test data that is longer than a machine wore";
+
+    EXPECT_EQ(ComputeHashRaw(Data1, sizeof(Data1)), ComputeHashRaw(Data2, sizeof(Data2)));
+    EXPECT_NE(ComputeHashRaw(Data1, sizeof(Data1)), ComputeHashRaw(Data3, sizeof(Data3)));
+    EXPECT_NE(ComputeHashRaw(Data1, sizeof(Data1)), ComputeHashRaw(Data1, sizeof(Data1) - 1));
+    EXPECT_NE(ComputeHashRaw(Data1, 3), ComputeHashRaw(Data1, 2));
+}
+
 } // namespace
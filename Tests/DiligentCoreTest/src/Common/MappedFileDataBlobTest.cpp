@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+
+#include "MappedFileDataBlob.hpp"
+#include "FileWrapper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+void WriteTestFile(const char* Path, const char* Contents)
+{
+    FileWrapper File{Path, EFileAccessMode::Overwrite};
+    ASSERT_TRUE(File != nullptr);
+    File->Write(Contents, strlen(Contents));
+}
+
+TEST(Common_MappedFileDataBlob, ReadContents)
+{
+    const char* Path     = "MappedFileDataBlobTest.txt";
+    const char* Contents = "Mapped file data blob test";
+    WriteTestFile(Path, Contents);
+
+    for (bool UseMemoryMapping : {true, false})
+    {
+        auto pBlob = MappedFileDataBlob::Create(Path, UseMemoryMapping);
+        ASSERT_TRUE(pBlob);
+        ASSERT_EQ(pBlob->GetSize(), strlen(Contents));
+        EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Contents, pBlob->GetSize()), 0);
+        if (!UseMemoryMapping)
+        {
+            EXPECT_FALSE(pBlob->IsMapped());
+        }
+
+        FileTimeStamp TimeStamp;
+        if (MappedFileDataBlob::GetFileTimeStamp(Path, TimeStamp))
+        {
+            EXPECT_EQ(TimeStamp.Size, strlen(Contents));
+            EXPECT_EQ(TimeStamp, pBlob->GetTimeStamp());
+        }
+    }
+
+    FileSystem::DeleteFile(Path);
+}
+
+TEST(Common_MappedFileDataBlob, EmptyFile)
+{
+    const char* Path = "MappedFileDataBlobTest_Empty.txt";
+    WriteTestFile(Path, "");
+
+    auto pBlob = MappedFileDataBlob::Create(Path);
+    ASSERT_TRUE(pBlob);
+    EXPECT_EQ(pBlob->GetSize(), size_t{0});
+    EXPECT_FALSE(pBlob->IsMapped());
+
+    FileSystem::DeleteFile(Path);
+}
+
+} // namespace
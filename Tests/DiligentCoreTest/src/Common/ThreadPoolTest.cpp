@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_ThreadPool, ExecuteTasks)
+{
+    constexpr int NumTasks = 1024;
+
+    std::atomic<int> Counter{0};
+    {
+        ThreadPool Pool{4};
+        EXPECT_EQ(Pool.GetNumThreads(), size_t{4});
+        for (int i = 0; i < NumTasks; ++i)
+        {
+            Pool.EnqueueTask([&Counter]() {
+                Counter.fetch_add(1);
+            });
+        }
+        // Pending tasks must be executed before the pool is destroyed
+    }
+    EXPECT_EQ(Counter.load(), NumTasks);
+}
+
+TEST(Common_ThreadPool, FIFOOrder)
+{
+    // With a single thread, the tasks must be executed in the order they were enqueued
+    std::vector<int> Order;
+    {
+        ThreadPool Pool{1};
+        for (int i = 0; i < 64; ++i)
+        {
+            Pool.EnqueueTask([&Order, i]() {
+                Order.push_back(i);
+            });
+        }
+    }
+    ASSERT_EQ(Order.size(), size_t{64});
+    for (int i = 0; i < 64; ++i)
+        EXPECT_EQ(Order[i], i);
+}
+
+TEST(Common_ThreadPool, ParallelFor)
+{
+    constexpr size_t Count = 10000;
+
+    ThreadPool Pool{4};
+    for (size_t ChunkSize : {size_t{1}, size_t{7}, size_t{1000}, Count, Count * 2})
+    {
+        // Every element must be processed exactly once
+        std::vector<std::atomic<int>> Visits(Count);
+        for (auto& Visit : Visits)
+            Visit.store(0);
+
+        ParallelFor(&Pool, Count, ChunkSize, [&](size_t First, size_t Last) {
+            EXPECT_LT(First, Last);
+            EXPECT_LE(Last - First, ChunkSize);
+            for (size_t i = First; i < Last; ++i)
+                Visits[i].fetch_add(1);
+        });
+
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Visits[i].load(), 1) << "ChunkSize: " << ChunkSize << ", element: " << i;
+    }
+}
+
+TEST(Common_ThreadPool, ParallelForBusyPool)
+{
+    // ParallelFor must complete even when all worker threads are blocked
+    std::mutex Mtx;
+    std::unique_lock<std::mutex> Lock{Mtx};
+
+    ThreadPool Pool{2};
+    for (size_t i = 0; i < Pool.GetNumThreads(); ++i)
+    {
+        Pool.EnqueueTask([&Mtx]() {
+            std::lock_guard<std::mutex> Guard{Mtx};
+        });
+    }
+
+    std::atomic<size_t> Sum{0};
+    ParallelFor(&Pool, 1000, 10, [&](size_t First, size_t Last) {
+        for (size_t i = First; i < Last; ++i)
+            Sum.fetch_add(i);
+    });
+    EXPECT_EQ(Sum.load(), size_t{999 * 1000 / 2});
+
+    Lock.unlock();
+}
+
+TEST(Common_ThreadPool, ParallelForNoPool)
+{
+    size_t NumChunks = 0;
+    ParallelFor(nullptr, 100, 30, [&](size_t First, size_t Last) {
+        EXPECT_EQ(First, NumChunks * 30);
+        EXPECT_EQ(Last, std::min(First + 30, size_t{100}));
+        ++NumChunks;
+    });
+    EXPECT_EQ(NumChunks, size_t{4});
+}
+
+} // namespace
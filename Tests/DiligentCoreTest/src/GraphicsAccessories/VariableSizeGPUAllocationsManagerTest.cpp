@@ -25,6 +25,9 @@
  *  of the possibility of such damages.
  */
 
+#include <vector>
+#include <utility>
+
 #include "VariableSizeGPUAllocationsManager.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 #include "PlatformDefinitions.h"
@@ -249,4 +252,34 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
     }
 }
 
+TEST(GraphicsAccessories_VariableSizeAllocationsManager, ProcessFreeBlocks)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    VariableSizeAllocationsManager ListMgr(128, Allocator);
+
+    VariableSizeAllocationsManager::Allocation al[8];
+    for (size_t o = 0; o < _countof(al); ++o)
+        al[o] = ListMgr.Allocate(16, 1);
+    EXPECT_TRUE(ListMgr.IsFull());
+
+    ListMgr.Free(std::move(al[1]));
+    ListMgr.Free(std::move(al[4]));
+    ListMgr.Free(std::move(al[5]));
+    ListMgr.Free(std::move(al[7]));
+
+    std::vector<std::pair<size_t, size_t>> FreeBlocks;
+    ListMgr.ProcessFreeBlocks([&](size_t Offset, size_t Size) {
+        FreeBlocks.emplace_back(Offset, Size);
+    });
+
+    const std::vector<std::pair<size_t, size_t>> RefFreeBlocks = {{16, 16}, {64, 32}, {112, 16}};
+    EXPECT_EQ(FreeBlocks, RefFreeBlocks);
+
+    ListMgr.Free(std::move(al[0]));
+    ListMgr.Free(std::move(al[2]));
+    ListMgr.Free(std::move(al[3]));
+    ListMgr.Free(std::move(al[6]));
+}
+
 } // namespace
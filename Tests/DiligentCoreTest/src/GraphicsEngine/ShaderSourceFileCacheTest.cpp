@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+
+#include "DefaultShaderSourceStreamFactory.h"
+#include "ShaderSourceFileCache.hpp"
+#include "FileWrapper.hpp"
+#include "RefCntAutoPtr.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+void WriteTestFile(const char* Path, const char* Contents)
+{
+    FileWrapper File{Path, EFileAccessMode::Overwrite};
+    ASSERT_TRUE(File != nullptr);
+    File->Write(Contents, strlen(Contents));
+}
+
+RefCntAutoPtr<IShaderSourceFileCache> CreateFileCache()
+{
+    DefaultShaderSourceStreamFactoryCreateInfo CI;
+    CI.SearchDirectories = ".";
+    CI.EnableCache       = True;
+    // Mapped files can't be overwritten on some platforms
+    CI.UseMemoryMapping = False;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory;
+    CreateDefaultShaderSourceStreamFactory2(CI, &pFactory);
+    return RefCntAutoPtr<IShaderSourceFileCache>{pFactory, IID_ShaderSourceFileCache};
+}
+
+void ExpectContents(IDataBlob* pBlob, const char* Contents)
+{
+    ASSERT_NE(pBlob, nullptr);
+    ASSERT_EQ(pBlob->GetSize(), strlen(Contents));
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Contents, pBlob->GetSize()), 0);
+}
+
+TEST(GraphicsEngine_ShaderSourceFileCache, HitAndMiss)
+{
+    const char* Path     = "ShaderSourceFileCacheTest_Hit.fxh";
+    const char* Contents = "float4 Color;";
+    WriteTestFile(Path, Contents);
+
+    auto pCache = CreateFileCache();
+    ASSERT_TRUE(pCache);
+
+    RefCntAutoPtr<IDataBlob> pData0;
+    size_t                   Hash0 = 0;
+    pCache->GetFileContents(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, &pData0, &Hash0);
+    ExpectContents(pData0, Contents);
+
+    RefCntAutoPtr<IDataBlob> pData1;
+    size_t                   Hash1 = 0;
+    pCache->GetFileContents(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, &pData1, &Hash1);
+    // The cached data must be shared
+    EXPECT_EQ(pData0, pData1);
+    EXPECT_EQ(Hash0, Hash1);
+
+    RefCntAutoPtr<IDataBlob> pMissing;
+    pCache->GetFileContents("ShaderSourceFileCacheTest_Missing.fxh", CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pMissing);
+    EXPECT_FALSE(pMissing);
+
+    ShaderSourceFileCacheStats Stats;
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.NumFileLoads, 1u);
+    EXPECT_EQ(Stats.NumCacheHits, 1u);
+    EXPECT_EQ(Stats.NumInvalidations, 0u);
+    EXPECT_EQ(Stats.NumPathResolutions, 1u);
+    EXPECT_EQ(Stats.NumResolvedPathHits, 1u);
+    EXPECT_EQ(Stats.BytesRead, strlen(Contents));
+    EXPECT_EQ(Stats.BytesServedFromCache, strlen(Contents));
+
+    pCache->Clear();
+
+    RefCntAutoPtr<IDataBlob> pData2;
+    pCache->GetFileContents(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, &pData2);
+    ExpectContents(pData2, Contents);
+    // Data blobs that were returned before the cache was cleared must remain valid
+    ExpectContents(pData0, Contents);
+
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.NumFileLoads, 2u);
+
+    FileSystem::DeleteFile(Path);
+}
+
+TEST(GraphicsEngine_ShaderSourceFileCache, Invalidation)
+{
+    const char* Path      = "ShaderSourceFileCacheTest_Invalidation.fxh";
+    const char* Contents0 = "float4 Color;";
+    const char* Contents1 = "float4 Color; float Alpha;";
+    WriteTestFile(Path, Contents0);
+
+    auto pCache = CreateFileCache();
+    ASSERT_TRUE(pCache);
+
+    RefCntAutoPtr<IDataBlob> pData0;
+    size_t                   Hash0 = 0;
+    pCache->GetFileContents(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, &pData0, &Hash0);
+    ExpectContents(pData0, Contents0);
+
+    // Rewrite the file with the same contents. Whether or not the time stamp changes,
+    // the cached data must be kept as the contents hash has not changed.
+    WriteTestFile(Path, Contents0);
+
+    RefCntAutoPtr<IDataBlob> pData1;
+    pCache->GetFileContents(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, &pData1);
+    EXPECT_EQ(pData0, pData1);
+
+    ShaderSourceFileCacheStats Stats;
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.NumInvalidations, 0u);
+
+    // Modify the file. The size changes, so the time stamp is guaranteed to change too.
+    WriteTestFile(Path, Contents1);
+
+    RefCntAutoPtr<IDataBlob> pData2;
+    size_t                   Hash2 = 0;
+    pCache->GetFileContents(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, &pData2, &Hash2);
+    ExpectContents(pData2, Contents1);
+    EXPECT_NE(pData0, pData2);
+    EXPECT_NE(Hash0, Hash2);
+
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.NumInvalidations, 1u);
+
+    RefCntAutoPtr<IDataBlob> pData3;
+    pCache->GetFileContents(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, &pData3);
+    EXPECT_EQ(pData2, pData3);
+
+    // Remove the file
+    pData0.Release();
+    pData1.Release();
+    pData2.Release();
+    pData3.Release();
+    FileSystem::DeleteFile(Path);
+
+    RefCntAutoPtr<IDataBlob> pData4;
+    pCache->GetFileContents(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pData4);
+    EXPECT_FALSE(pData4);
+}
+
+} // namespace
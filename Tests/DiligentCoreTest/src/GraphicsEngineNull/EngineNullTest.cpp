@@ -0,0 +1,637 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "EngineFactoryNull.h"
+#include "RefCntAutoPtr.hpp"
+#include "BindlessResourceTable.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class EngineNullTest : public ::testing::Test
+{
+protected:
+    static constexpr Uint32 NumDeferredContexts = 2;
+
+    void SetUp() override
+    {
+        auto* pFactory = GetEngineFactoryNull();
+        ASSERT_NE(pFactory, nullptr);
+
+        EngineNullCreateInfo EngineCI;
+        EngineCI.NumDeferredContexts = NumDeferredContexts;
+
+        IDeviceContext* ppContexts[1 + NumDeferredContexts] = {};
+        pFactory->CreateDeviceAndContextsNull(EngineCI, &pDevice, ppContexts);
+        ASSERT_NE(pDevice, nullptr);
+        for (Uint32 i = 0; i < 1 + NumDeferredContexts; ++i)
+        {
+            ASSERT_NE(ppContexts[i], nullptr);
+            pContexts[i].Attach(ppContexts[i]);
+        }
+    }
+
+    // The null backend does not reflect shaders, so all resources must be declared in explicit signatures
+    RefCntAutoPtr<IPipelineState> CreatePSO(IPipelineResourceSignature* pSignature, PSO_CREATE_FLAGS Flags = PSO_CREATE_FLAG_NONE)
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.Source         = "void main() {}";
+
+        RefCntAutoPtr<IShader> pVS;
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.Desc.Name       = "Null test VS";
+        pDevice->CreateShader(ShaderCI, &pVS);
+
+        RefCntAutoPtr<IShader> pPS;
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.Desc.Name       = "Null test PS";
+        pDevice->CreateShader(ShaderCI, &pPS);
+
+        if (!pVS || !pPS)
+            return {};
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name            = "Null test PSO";
+        PSOCreateInfo.pVS                     = pVS;
+        PSOCreateInfo.pPS                     = pPS;
+        PSOCreateInfo.ppResourceSignatures    = &pSignature;
+        PSOCreateInfo.ResourceSignaturesCount = 1;
+        PSOCreateInfo.Flags                   = Flags;
+
+        PSOCreateInfo.GraphicsPipeline.NumRenderTargets = 1;
+        PSOCreateInfo.GraphicsPipeline.RTVFormats[0]    = TEX_FORMAT_RGBA8_UNORM;
+        PSOCreateInfo.GraphicsPipeline.DSVFormat        = TEX_FORMAT_D32_FLOAT;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        return pPSO;
+    }
+
+    RefCntAutoPtr<IRenderDevice>  pDevice;
+    RefCntAutoPtr<IDeviceContext> pContexts[1 + NumDeferredContexts];
+};
+
+TEST_F(EngineNullTest, CreateDevice)
+{
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+    EXPECT_EQ(DeviceInfo.Type, RENDER_DEVICE_TYPE_NULL);
+    EXPECT_TRUE(DeviceInfo.IsNullDevice());
+    EXPECT_EQ(pDevice->GetAdapterInfo().Type, ADAPTER_TYPE_SOFTWARE);
+
+    EXPECT_FALSE(pContexts[0]->GetDesc().IsDeferred);
+    for (Uint32 i = 1; i < 1 + NumDeferredContexts; ++i)
+        EXPECT_TRUE(pContexts[i]->GetDesc().IsDeferred);
+
+    SwapChainDesc SCDesc;
+    SCDesc.Width  = 256;
+    SCDesc.Height = 128;
+
+    RefCntAutoPtr<ISwapChain> pSwapChain;
+    GetEngineFactoryNull()->CreateSwapChainNull(pDevice, pContexts[0], SCDesc, &pSwapChain);
+    ASSERT_NE(pSwapChain, nullptr);
+    ASSERT_NE(pSwapChain->GetCurrentBackBufferRTV(), nullptr);
+    EXPECT_EQ(pSwapChain->GetCurrentBackBufferRTV()->GetTexture()->GetDesc().Width, 256u);
+
+    pSwapChain->Resize(64, 32);
+    EXPECT_EQ(pSwapChain->GetDesc().Width, 64u);
+    EXPECT_EQ(pSwapChain->GetCurrentBackBufferRTV()->GetTexture()->GetDesc().Height, 32u);
+    pSwapChain->Present();
+}
+
+TEST_F(EngineNullTest, BufferData)
+{
+    auto* pCtx = pContexts[0].RawPtr();
+
+    const std::array<Uint32, 4> InitData = {1, 2, 3, 4};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Null test buffer";
+    BuffDesc.Size      = sizeof(InitData);
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    BufferData BuffData{InitData.data(), sizeof(InitData)};
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, &BuffData, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    const Uint32 Update[] = {7, 8};
+    pCtx->UpdateBuffer(pBuffer, sizeof(Uint32), sizeof(Update), Update, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    EXPECT_EQ(pBuffer->GetState(), RESOURCE_STATE_COPY_DEST);
+
+    BuffDesc.Name           = "Null test staging buffer";
+    BuffDesc.BindFlags      = BIND_NONE;
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    pCtx->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                     pStagingBuffer, 0, sizeof(InitData), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    EXPECT_EQ(pBuffer->GetState(), RESOURCE_STATE_COPY_SOURCE);
+
+    void* pData = nullptr;
+    pCtx->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    const auto* pValues = static_cast<const Uint32*>(pData);
+    EXPECT_EQ(pValues[0], 1u);
+    EXPECT_EQ(pValues[1], 7u);
+    EXPECT_EQ(pValues[2], 8u);
+    EXPECT_EQ(pValues[3], 4u);
+    pCtx->UnmapBuffer(pStagingBuffer, MAP_READ);
+
+    BuffDesc.Name           = "Null test dynamic buffer";
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    RefCntAutoPtr<IBuffer> pDynamicBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pDynamicBuffer);
+    ASSERT_NE(pDynamicBuffer, nullptr);
+    for (int i = 0; i < 3; ++i)
+    {
+        pData = nullptr;
+        pCtx->MapBuffer(pDynamicBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+        ASSERT_NE(pData, nullptr);
+        memcpy(pData, InitData.data(), sizeof(InitData));
+        pCtx->UnmapBuffer(pDynamicBuffer, MAP_WRITE);
+    }
+    pCtx->Flush();
+}
+
+TEST_F(EngineNullTest, CommitShaderResources)
+{
+    auto* pCtx = pContexts[0].RawPtr();
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbStatic",  1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbMutable", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbDynamic", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}
+    };
+    // clang-format on
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Null test signature";
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+    ASSERT_NE(pSignature, nullptr);
+
+    std::array<RefCntAutoPtr<IBuffer>, 3> pBuffers;
+    for (auto& pBuffer : pBuffers)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Null test constant buffer";
+        BuffDesc.Size      = 256;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+        pBuffer->SetState(RESOURCE_STATE_COPY_DEST);
+    }
+
+    pSignature->GetStaticVariableByName(SHADER_TYPE_VERTEX, "cbStatic")->Set(pBuffers[0]);
+
+    auto pPSO = CreatePSO(pSignature);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    auto* pMutableVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbMutable");
+    auto* pDynamicVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbDynamic");
+    ASSERT_NE(pMutableVar, nullptr);
+    ASSERT_NE(pDynamicVar, nullptr);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbStatic"), nullptr);
+
+    pMutableVar->Set(pBuffers[1]);
+    pDynamicVar->Set(pBuffers[2]);
+    EXPECT_EQ(pDynamicVar->Get(), pBuffers[2]);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Null test render target";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_RENDER_TARGET;
+
+    RefCntAutoPtr<ITexture> pRenderTarget;
+    pDevice->CreateTexture(TexDesc, nullptr, &pRenderTarget);
+    ASSERT_NE(pRenderTarget, nullptr);
+
+    TexDesc.Name      = "Null test depth buffer";
+    TexDesc.Format    = TEX_FORMAT_D32_FLOAT;
+    TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+
+    RefCntAutoPtr<ITexture> pDepthBuffer;
+    pDevice->CreateTexture(TexDesc, nullptr, &pDepthBuffer);
+    ASSERT_NE(pDepthBuffer, nullptr);
+
+    ITextureView* pRTVs[] = {pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+    pCtx->SetRenderTargets(1, pRTVs, pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    EXPECT_EQ(pRenderTarget->GetState(), RESOURCE_STATE_RENDER_TARGET);
+    EXPECT_EQ(pDepthBuffer->GetState(), RESOURCE_STATE_DEPTH_WRITE);
+
+    pCtx->SetPipelineState(pPSO);
+    pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    for (const auto& pBuffer : pBuffers)
+        EXPECT_EQ(pBuffer->GetState(), RESOURCE_STATE_CONSTANT_BUFFER);
+
+    pDynamicVar->Set(pBuffers[0]);
+    pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+    DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+    pCtx->Draw(DrawAttrs);
+    pCtx->Flush();
+}
+
+TEST_F(EngineNullTest, BindlessResources)
+{
+    auto* pCtx = pContexts[0].RawPtr();
+
+    constexpr Uint32 TableSize = 8;
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_Buffers", TableSize, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE,
+            PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS | PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY | PIPELINE_RESOURCE_FLAG_BINDLESS}
+    };
+    // clang-format on
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Null test bindless signature";
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+    ASSERT_NE(pSignature, nullptr);
+
+    auto pPSO = CreatePSO(pSignature);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    BindlessResourceTable Table{pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffers")};
+    EXPECT_EQ(Table.GetSize(), TableSize);
+
+    std::vector<RefCntAutoPtr<IBuffer>> pBuffers(TableSize);
+    for (auto& pBuffer : pBuffers)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Null test bindless buffer";
+        BuffDesc.Size      = 256;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+    }
+
+    // The array is partially bound
+    EXPECT_EQ(Table.Register(pBuffers[0]), 0u);
+    EXPECT_EQ(Table.Register(pBuffers[1]), 1u);
+    EXPECT_EQ(Table.GetAllocatedSlotCount(), 2u);
+
+    pCtx->SetPipelineState(pPSO);
+    pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    // Resources may be registered after the SRB has been committed
+    const auto Slot2 = Table.Register(pBuffers[2]);
+    EXPECT_EQ(Slot2, 2u);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffers")->Get(Slot2), pBuffers[2]);
+
+    // Bound slots may be replaced
+    IDeviceObject* pNewObject = pBuffers[3];
+    Table.SetResources(Slot2, &pNewObject, 1);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffers")->Get(Slot2), pBuffers[3]);
+
+    // Released slots must not be reused until the fence is completed
+    Table.Release(1, 1, 1);
+    EXPECT_EQ(Table.Register(pBuffers[4]), 3u);
+    Table.ReleaseStaleSlots(0);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffers")->Get(1), pBuffers[1]);
+    Table.ReleaseStaleSlots(1);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffers")->Get(1), nullptr);
+    EXPECT_EQ(Table.Register(pBuffers[5]), 1u);
+
+    const auto FirstSlot = Table.Allocate(TableSize - Table.GetAllocatedSlotCount());
+    EXPECT_EQ(FirstSlot, 4u);
+    EXPECT_EQ(Table.GetAllocatedSlotCount(), TableSize);
+
+    DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+    pCtx->Draw(DrawAttrs);
+    pCtx->Flush();
+}
+
+TEST_F(EngineNullTest, MultiDraw)
+{
+    auto* pCtx = pContexts[0].RawPtr();
+
+    EXPECT_TRUE(pDevice->GetDeviceInfo().Features.NativeMultiDraw);
+
+    const PipelineResourceDesc Resource{SHADER_TYPE_VERTEX, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC};
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Null test signature";
+    PRSDesc.Resources    = &Resource;
+    PRSDesc.NumResources = 1;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+    ASSERT_NE(pSignature, nullptr);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Null test constant buffer";
+    BuffDesc.Size      = 256;
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pConstants;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pConstants);
+    ASSERT_NE(pConstants, nullptr);
+    pSignature->GetStaticVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pConstants);
+
+    BuffDesc.Name      = "Null test index buffer";
+    BuffDesc.Size      = 64;
+    BuffDesc.BindFlags = BIND_INDEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pIndexBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pIndexBuffer);
+    ASSERT_NE(pIndexBuffer, nullptr);
+
+    auto pPSO = CreatePSO(pSignature);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Null test render target";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_RENDER_TARGET;
+
+    RefCntAutoPtr<ITexture> pRenderTarget;
+    pDevice->CreateTexture(TexDesc, nullptr, &pRenderTarget);
+    ASSERT_NE(pRenderTarget, nullptr);
+
+    TexDesc.Name      = "Null test depth buffer";
+    TexDesc.Format    = TEX_FORMAT_D32_FLOAT;
+    TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+
+    RefCntAutoPtr<ITexture> pDepthBuffer;
+    pDevice->CreateTexture(TexDesc, nullptr, &pDepthBuffer);
+    ASSERT_NE(pDepthBuffer, nullptr);
+
+    ITextureView* pRTVs[] = {pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+    pCtx->SetRenderTargets(1, pRTVs, pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->SetPipelineState(pPSO);
+    pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->SetIndexBuffer(pIndexBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    EXPECT_EQ(pIndexBuffer->GetState(), RESOURCE_STATE_INDEX_BUFFER);
+
+    const MultiDrawItem DrawItems[] = {{3, 0}, {0, 3}, {6, 3}};
+    pCtx->MultiDraw({_countof(DrawItems), DrawItems, DRAW_FLAG_VERIFY_ALL});
+    pCtx->MultiDraw({0, nullptr, DRAW_FLAG_VERIFY_ALL});
+
+    const MultiDrawIndexedItem IndexedDrawItems[] = {{3, 0, 0}, {3, 3, 4}};
+    pCtx->MultiDrawIndexed({_countof(IndexedDrawItems), IndexedDrawItems, VT_UINT16, DRAW_FLAG_VERIFY_ALL, 2});
+    pCtx->Flush();
+}
+
+TEST_F(EngineNullTest, ExtendedDynamicState)
+{
+    auto* pCtx = pContexts[0].RawPtr();
+
+    EXPECT_TRUE(pDevice->GetDeviceInfo().Features.ExtendedDynamicState);
+
+    const PipelineResourceDesc Resource{SHADER_TYPE_VERTEX, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC};
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Null test signature";
+    PRSDesc.Resources    = &Resource;
+    PRSDesc.NumResources = 1;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+    ASSERT_NE(pSignature, nullptr);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Null test constant buffer";
+    BuffDesc.Size      = 256;
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pConstants;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pConstants);
+    ASSERT_NE(pConstants, nullptr);
+    pSignature->GetStaticVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pConstants);
+
+    auto pPSO = CreatePSO(pSignature, PSO_CREATE_FLAG_EXTENDED_DYNAMIC_STATE);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Null test render target";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_RENDER_TARGET;
+
+    RefCntAutoPtr<ITexture> pRenderTarget;
+    pDevice->CreateTexture(TexDesc, nullptr, &pRenderTarget);
+    ASSERT_NE(pRenderTarget, nullptr);
+
+    TexDesc.Name      = "Null test depth buffer";
+    TexDesc.Format    = TEX_FORMAT_D32_FLOAT;
+    TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+
+    RefCntAutoPtr<ITexture> pDepthBuffer;
+    pDevice->CreateTexture(TexDesc, nullptr, &pDepthBuffer);
+    ASSERT_NE(pDepthBuffer, nullptr);
+
+    ITextureView* pRTVs[] = {pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+    pCtx->SetRenderTargets(1, pRTVs, pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pCtx->SetPipelineState(pPSO);
+    pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DepthStencilStateDesc DSSDesc;
+    DSSDesc.DepthWriteEnable = False;
+    DSSDesc.DepthFunc        = COMPARISON_FUNC_GREATER_EQUAL;
+
+    for (Uint32 i = 0; i < 2; ++i)
+    {
+        pCtx->SetCullMode(CULL_MODE_NONE, True);
+        pCtx->SetDepthStencilState(DSSDesc);
+        pCtx->SetPrimitiveTopology(PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP);
+        pCtx->Draw({4, DRAW_FLAG_VERIFY_ALL});
+
+        pCtx->SetCullMode(CULL_MODE_FRONT, False);
+        pCtx->SetDepthStencilState(DepthStencilStateDesc{});
+        pCtx->SetPrimitiveTopology(PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+        pCtx->Draw({3, DRAW_FLAG_VERIFY_ALL});
+    }
+    pCtx->Flush();
+}
+
+TEST_F(EngineNullTest, AsynchronousPipelines)
+{
+    auto* pCtx = pContexts[0].RawPtr();
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "Null test signature";
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+    ASSERT_NE(pSignature, nullptr);
+
+    // Shaders, the signature and the create info go out of scope in CreatePSO() while
+    // the pipelines are still being initialized.
+    constexpr Uint32              NumPSOs = 32;
+    RefCntAutoPtr<IPipelineState> pPSOs[NumPSOs];
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        pPSOs[i] = CreatePSO(pSignature, PSO_CREATE_FLAG_ASYNCHRONOUS);
+        ASSERT_NE(pPSOs[i], nullptr);
+        const auto Status = pPSOs[i]->GetStatus();
+        EXPECT_TRUE(Status == PIPELINE_STATE_STATUS_COMPILING || Status == PIPELINE_STATE_STATUS_READY);
+    }
+    pSignature.Release();
+
+    // Pipelines that are still compiling must wait for completion when destroyed
+    for (Uint32 i = 0; i < NumPSOs; i += 2)
+        pPSOs[i].Release();
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Null test render target";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_RENDER_TARGET;
+
+    RefCntAutoPtr<ITexture> pRenderTarget;
+    pDevice->CreateTexture(TexDesc, nullptr, &pRenderTarget);
+    ASSERT_NE(pRenderTarget, nullptr);
+
+    TexDesc.Name      = "Null test depth buffer";
+    TexDesc.Format    = TEX_FORMAT_D32_FLOAT;
+    TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+
+    RefCntAutoPtr<ITexture> pDepthBuffer;
+    pDevice->CreateTexture(TexDesc, nullptr, &pDepthBuffer);
+    ASSERT_NE(pDepthBuffer, nullptr);
+
+    ITextureView* pRTVs[] = {pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+    pCtx->SetRenderTargets(1, pRTVs, pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    for (Uint32 i = 1; i < NumPSOs; i += 2)
+    {
+        ASSERT_EQ(pPSOs[i]->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+        EXPECT_EQ(pPSOs[i]->GetStatus(), PIPELINE_STATE_STATUS_READY);
+        EXPECT_NE(pPSOs[i]->GetResourceSignature(0), nullptr);
+
+        pCtx->SetPipelineState(pPSOs[i]);
+        pCtx->Draw({3, DRAW_FLAG_VERIFY_ALL});
+    }
+    pCtx->Flush();
+}
+
+TEST_F(EngineNullTest, DeferredContexts)
+{
+    FenceDesc FenceCI;
+    FenceCI.Name = "Null test fence";
+    FenceCI.Type = FENCE_TYPE_GENERAL;
+
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(FenceCI, &pFence);
+    ASSERT_NE(pFence, nullptr);
+
+    std::vector<RefCntAutoPtr<ICommandList>> CmdLists;
+    for (Uint32 i = 1; i < 1 + NumDeferredContexts; ++i)
+    {
+        auto* pDeferredCtx = pContexts[i].RawPtr();
+        pDeferredCtx->Begin(0);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Null test buffer";
+        BuffDesc.Size      = 64;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+
+        IBuffer* ppBuffers[] = {pBuffer};
+        pDeferredCtx->SetVertexBuffers(0, 1, ppBuffers, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+        RefCntAutoPtr<ICommandList> pCmdList;
+        pDeferredCtx->FinishCommandList(&pCmdList);
+        ASSERT_NE(pCmdList, nullptr);
+        CmdLists.emplace_back(std::move(pCmdList));
+        pDeferredCtx->FinishFrame();
+    }
+
+    std::vector<ICommandList*> ppCmdLists;
+    for (auto& pCmdList : CmdLists)
+        ppCmdLists.push_back(pCmdList);
+
+    auto* pImmediateCtx = pContexts[0].RawPtr();
+    pImmediateCtx->ExecuteCommandLists(static_cast<Uint32>(ppCmdLists.size()), ppCmdLists.data());
+    pImmediateCtx->EnqueueSignal(pFence, 1);
+    pImmediateCtx->Flush();
+    pImmediateCtx->DeviceWaitForFence(pFence, 1);
+    EXPECT_EQ(pFence->GetCompletedValue(), 1u);
+}
+
+} // namespace
@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+
+#include "HLSL2GLSLConverterImpl.hpp"
+#include "RefCntAutoPtr.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+static const char* const TestVSPS = R"(
+struct VSInput
+{
+    float3 Pos   : ATTRIB0;
+    float2 UV    : ATTRIB1;
+    float4 Color : ATTRIB2;
+};
+
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float2 UV    : TEX_COORD;
+    float4 Color : COLOR;
+};
+
+cbuffer Constants
+{
+    float4x4 g_WorldViewProj;
+    float4   g_Tint[4];
+};
+
+Texture2D    g_Texture;
+SamplerState g_Texture_sampler;
+
+float4 ApplyTint(float4 Color, uint Idx)
+{
+    return Color * g_Tint[Idx % 4u];
+}
+
+void TestVS(in  VSInput VSIn,
+            in  uint    VertId : SV_VertexID,
+            out PSInput PSIn)
+{
+    PSIn.Pos   = mul(float4(VSIn.Pos, 1.0), g_WorldViewProj);
+    PSIn.UV    = VSIn.UV;
+    PSIn.Color = ApplyTint(VSIn.Color, VertId);
+}
+
+float4 TestPS(in PSInput PSIn) : SV_Target
+{
+    float4 Color = g_Texture.Sample(g_Texture_sampler, PSIn.UV) * PSIn.Color;
+    [unroll]
+    for (int i = 0; i < 4; ++i)
+        Color.rgb += g_Texture.SampleLevel(g_Texture_sampler, PSIn.UV, float(i)).rgb * 0.25;
+    return Color;
+}
+)";
+
+static const char* const TestCS = R"(
+RWTexture2D<float4 /*format=rgba8*/> g_RWTex;
+struct CounterData
+{
+    uint4 Count;
+};
+RWStructuredBuffer<CounterData>      g_Counters;
+Texture2D<float4>                    g_Input;
+
+groupshared float4 g_Cache[64];
+
+[numthreads(8, 8, 1)]
+void TestCS(uint3 DTid : SV_DispatchThreadID, uint GI : SV_GroupIndex)
+{
+    uint2 Dim;
+    g_RWTex.GetDimensions(Dim.x, Dim.y);
+    g_Cache[GI] = g_Input.Load(int3(DTid.xy, 0));
+    GroupMemoryBarrierWithGroupSync();
+    if (DTid.x < Dim.x && DTid.y < Dim.y)
+    {
+        g_RWTex[DTid.xy] = (g_Cache[GI] + g_Cache[63u - GI]) * 0.5;
+        g_Counters[GI].Count += uint4(1u, DTid.xy, GI);
+    }
+}
+)";
+
+// Token list nodes are allocated from the pool owned by the conversion stream.
+// Checks that the pool does not affect the conversion results.
+TEST(HLSL2GLSLConverterTest, TokenPool)
+{
+    const auto& Converter = HLSL2GLSLConverterImpl::GetInstance();
+    // Disable the conversion cache so that every shader is actually converted
+    Converter.SetConversionCacheSize(0);
+
+    struct ShaderInfo
+    {
+        const char* Name;
+        const char* Source;
+        const char* EntryPoint;
+        SHADER_TYPE Type;
+    };
+    // clang-format off
+    const ShaderInfo Shaders[] =
+    {
+        {"VS_PS", TestVSPS, "TestVS", SHADER_TYPE_VERTEX },
+        {"VS_PS", TestVSPS, "TestPS", SHADER_TYPE_PIXEL  },
+        {"CS",    TestCS,   "TestCS", SHADER_TYPE_COMPUTE}
+    };
+    // clang-format on
+
+    for (const auto& Shader : Shaders)
+    {
+        for (bool IncludeDefinitions : {false, true})
+        {
+            HLSL2GLSLConverterImpl::ConversionAttribs Attribs;
+            Attribs.HLSLSource         = Shader.Source;
+            Attribs.NumSymbols         = strlen(Shader.Source);
+            Attribs.EntryPoint         = Shader.EntryPoint;
+            Attribs.ShaderType         = Shader.Type;
+            Attribs.InputFileName      = Shader.Name;
+            Attribs.IncludeDefinitions = IncludeDefinitions;
+
+            Attribs.UseTokenPool = false;
+            const auto RefGLSL   = Converter.Convert(Attribs);
+            ASSERT_FALSE(RefGLSL.empty()) << Shader.EntryPoint;
+
+            Attribs.UseTokenPool = true;
+            EXPECT_EQ(Converter.Convert(Attribs), RefGLSL) << Shader.EntryPoint;
+
+            // Streams that preserve tokens copy the original tokens for every conversion,
+            // so the second conversion reuses the nodes released by the first one.
+            RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+            Attribs.ppConversionStream = pStream.RawDblPtr();
+            for (int i = 0; i < 2; ++i)
+            {
+                EXPECT_EQ(Converter.Convert(Attribs), RefGLSL) << Shader.EntryPoint << " (stream, conversion " << i << ")";
+            }
+        }
+    }
+
+    // Restore the default cache size
+    Converter.SetConversionCacheSize(size_t{32} << 20);
+}
+
+TEST(HLSL2GLSLConverterTest, ConversionCache)
+{
+    const auto& Converter = HLSL2GLSLConverterImpl::GetInstance();
+
+    HLSL2GLSLConverterImpl::ConversionAttribs Attribs;
+    Attribs.EntryPoint    = "TestCS";
+    Attribs.ShaderType    = SHADER_TYPE_COMPUTE;
+    Attribs.InputFileName = "CS";
+
+    // Convert the shaders without the cache to get the reference results
+    Converter.SetConversionCacheSize(0);
+
+    const std::string Source0 = TestCS;
+    // Same length, different contents
+    std::string Source1 = Source0;
+    Source1.replace(Source1.find("0.5;"), 4, "0.2;");
+
+    Attribs.HLSLSource  = Source0.c_str();
+    Attribs.NumSymbols  = Source0.length();
+    const auto RefGLSL0 = Converter.Convert(Attribs);
+    ASSERT_FALSE(RefGLSL0.empty());
+
+    Attribs.HLSLSource  = Source1.c_str();
+    Attribs.NumSymbols  = Source1.length();
+    const auto RefGLSL1 = Converter.Convert(Attribs);
+    ASSERT_FALSE(RefGLSL1.empty());
+    ASSERT_NE(RefGLSL0, RefGLSL1);
+
+    Converter.SetConversionCacheSize(size_t{32} << 20);
+    Converter.ClearConversionCache();
+
+    HLSL2GLSLConversionCacheStats Stats0;
+    Converter.GetConversionCacheStats(Stats0);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        Attribs.HLSLSource = Source0.c_str();
+        Attribs.NumSymbols = Source0.length();
+        EXPECT_EQ(Converter.Convert(Attribs), RefGLSL0);
+
+        Attribs.HLSLSource = Source1.c_str();
+        Attribs.NumSymbols = Source1.length();
+        EXPECT_EQ(Converter.Convert(Attribs), RefGLSL1);
+    }
+
+    HLSL2GLSLConversionCacheStats Stats1;
+    Converter.GetConversionCacheStats(Stats1);
+    EXPECT_EQ(Stats1.NumMisses - Stats0.NumMisses, 2u);
+    EXPECT_EQ(Stats1.NumHits - Stats0.NumHits, 2u);
+    EXPECT_EQ(Stats1.NumEntries, 2u);
+
+    Converter.ClearConversionCache();
+}
+
+} // namespace
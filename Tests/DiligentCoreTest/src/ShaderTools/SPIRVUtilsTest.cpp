@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <vector>
+#include <cstring>
+#include <initializer_list>
+
+#include "SPIRVUtils.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class SPIRVBuilder
+{
+public:
+    SPIRVBuilder()
+    {
+        m_Words = {0x07230203, 0x00010000, 0, 16, 0};
+    }
+
+    SPIRVBuilder& Inst(uint32_t OpCode, std::initializer_list<uint32_t> Operands, const char* Str = nullptr)
+    {
+        const auto Start = m_Words.size();
+        m_Words.push_back(OpCode);
+        m_Words.insert(m_Words.end(), Operands.begin(), Operands.end());
+        if (Str != nullptr)
+        {
+            const auto Len      = strlen(Str) + 1;
+            const auto StrStart = m_Words.size();
+            m_Words.resize(StrStart + (Len + 3) / 4, 0);
+            memcpy(&m_Words[StrStart], Str, Len);
+        }
+        m_Words[Start] |= static_cast<uint32_t>(m_Words.size() - Start) << 16;
+        return *this;
+    }
+
+    const std::vector<uint32_t>& Get() const
+    {
+        return m_Words;
+    }
+
+private:
+    std::vector<uint32_t> m_Words;
+};
+
+constexpr uint32_t OpSourceContinued = 2;
+constexpr uint32_t OpSource          = 3;
+constexpr uint32_t OpSourceExtension = 4;
+constexpr uint32_t OpName            = 5;
+constexpr uint32_t OpString          = 7;
+constexpr uint32_t OpLine            = 8;
+constexpr uint32_t OpExtInstImport   = 11;
+constexpr uint32_t OpMemoryModel     = 14;
+constexpr uint32_t OpCapability      = 17;
+constexpr uint32_t OpNoLine          = 317;
+constexpr uint32_t OpModuleProcessed = 330;
+
+constexpr uint32_t SourceLanguageHLSL = 5;
+
+TEST(ShaderTools_SPIRVUtils, StripSourceDebugInfo)
+{
+    auto SPIRV = SPIRVBuilder{}
+                     .Inst(OpCapability, {1})
+                     .Inst(OpExtInstImport, {1}, "GLSL.std.450")
+                     .Inst(OpMemoryModel, {0, 1})
+                     .Inst(OpString, {2}, "shader.hlsl")
+                     .Inst(OpSource, {SourceLanguageHLSL, 500, 2}, "float4 main() : SV_Target { return 0; }")
+                     .Inst(OpSourceContinued, {}, "// continued source")
+                     .Inst(OpSourceExtension, {}, "GL_GOOGLE_include_directive")
+                     .Inst(OpName, {3}, "main")
+                     .Inst(OpModuleProcessed, {}, "client vulkan100")
+                     .Inst(OpLine, {2, 10, 0})
+                     .Inst(OpNoLine, {})
+                     .Get();
+
+    const auto RefSPIRV = SPIRVBuilder{}
+                              .Inst(OpCapability, {1})
+                              .Inst(OpExtInstImport, {1}, "GLSL.std.450")
+                              .Inst(OpMemoryModel, {0, 1})
+                              .Inst(OpSource, {SourceLanguageHLSL, 500})
+                              .Inst(OpName, {3}, "main")
+                              .Get();
+
+    const auto OrigSize = SPIRV.size();
+    EXPECT_EQ(StripSPIRVSourceDebugInfo(SPIRV), OrigSize - RefSPIRV.size());
+    EXPECT_EQ(SPIRV, RefSPIRV);
+
+    // Stripping is idempotent
+    EXPECT_EQ(StripSPIRVSourceDebugInfo(SPIRV), size_t{0});
+    EXPECT_EQ(SPIRV, RefSPIRV);
+}
+
+TEST(ShaderTools_SPIRVUtils, StripSourceDebugInfoNonSemantic)
+{
+    auto SPIRV = SPIRVBuilder{}
+                     .Inst(OpCapability, {1})
+                     .Inst(OpExtInstImport, {1}, "NonSemantic.Shader.DebugInfo.100")
+                     .Inst(OpMemoryModel, {0, 1})
+                     .Inst(OpString, {2}, "shader.hlsl")
+                     .Inst(OpSource, {SourceLanguageHLSL, 500, 2})
+                     .Inst(OpLine, {2, 10, 0})
+                     .Get();
+
+    // Strings may be used by non-semantic instructions and must be preserved
+    const auto RefSPIRV = SPIRVBuilder{}
+                              .Inst(OpCapability, {1})
+                              .Inst(OpExtInstImport, {1}, "NonSemantic.Shader.DebugInfo.100")
+                              .Inst(OpMemoryModel, {0, 1})
+                              .Inst(OpString, {2}, "shader.hlsl")
+                              .Inst(OpSource, {SourceLanguageHLSL, 500, 2})
+                              .Get();
+
+    StripSPIRVSourceDebugInfo(SPIRV);
+    EXPECT_EQ(SPIRV, RefSPIRV);
+}
+
+} // namespace
@@ -0,0 +1,355 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <unordered_map>
+
+#include "ShaderPermutations.hpp"
+#include "ObjectBase.hpp"
+#include "MemoryFileStream.hpp"
+#include "StringDataBlobImpl.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class MemoryShaderSourceFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceInputStreamFactory>;
+
+    MemoryShaderSourceFactory(IReferenceCounters* pRefCounters, std::unordered_map<std::string, std::string> Files) :
+        TBase{pRefCounters},
+        m_Files{std::move(Files)}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        *ppStream = nullptr;
+
+        auto it = m_Files.find(Name);
+        if (it == m_Files.end())
+            return;
+
+        ++m_NumFilesOpened;
+
+        RefCntAutoPtr<IDataBlob> pData{MakeNewRCObj<StringDataBlobImpl>{}(it->second)};
+        RefCntAutoPtr<IFileStream> pStream{MakeNewRCObj<MemoryFileStream>{}(pData)};
+        *ppStream = pStream.Detach();
+    }
+
+    Uint32 GetNumFilesOpened() const
+    {
+        return m_NumFilesOpened;
+    }
+
+private:
+    const std::unordered_map<std::string, std::string> m_Files;
+
+    std::atomic<Uint32> m_NumFilesOpened{0};
+};
+
+RefCntAutoPtr<IDataBlob> CompileToString(const std::string& Source, Uint32)
+{
+    return RefCntAutoPtr<IDataBlob>{MakeNewRCObj<StringDataBlobImpl>{}(Source)};
+}
+
+std::string BlobToString(const IDataBlob* pBlob)
+{
+    return pBlob != nullptr ?
+        std::string{static_cast<const char*>(pBlob->GetConstDataPtr()), pBlob->GetSize()} :
+        std::string{};
+}
+
+TEST(ShaderTools_ShaderPermutations, ExpandIncludes)
+{
+    RefCntAutoPtr<MemoryShaderSourceFactory> pFactory{
+        MakeNewRCObj<MemoryShaderSourceFactory>{}(
+            std::unordered_map<std::string, std::string>{
+                {"Main.fx", "#include \"Common.fxh\"\nfloat4 main() : SV_Target { return COLOR; }\n"},
+                {"Common.fxh", "#include \"Defs.fxh\"\n#include \"Common.fxh\"\n  #  include <Missing.fxh>\n/*\n#include \"Defs.fxh\"\n*/\n"},
+                {"Defs.fxh", "#define COLOR float4(1.0, 0.0, 0.0, 1.0)"},
+            })};
+
+    ShaderPermutationsAttribs Attribs;
+    Attribs.FilePath                   = "Main.fx";
+    Attribs.pShaderSourceStreamFactory = pFactory;
+
+    const auto Info = PreprocessShaderPermutations(Attribs);
+    EXPECT_EQ(Info.SharedSource,
+              "#define COLOR float4(1.0, 0.0, 0.0, 1.0)\n"
+              "#include \"Common.fxh\"\n"
+              "  #  include <Missing.fxh>\n"
+              "/*\n"
+              "#include \"Defs.fxh\"\n"
+              "*/\n"
+              "float4 main() : SV_Target { return COLOR; }\n");
+    EXPECT_EQ(Info.DefinitionsOffset, size_t{0});
+    EXPECT_TRUE(Info.UniqueDefinitions.empty());
+    EXPECT_TRUE(Info.PermutationToUnique.empty());
+}
+
+TEST(ShaderTools_ShaderPermutations, Deduplicate)
+{
+    static constexpr char Source[] = R"(#version 450 core
+#if USE_TEXTURE
+uniform sampler2D g_Texture;
+#endif
+#define SAMPLE_COUNT NUM_SAMPLES
+void main() {}
+)";
+
+    const ShaderMacro Perm0[] = {{"USE_TEXTURE", "1"}, {"NUM_SAMPLES", "4"}, {}};
+    const ShaderMacro Perm1[] = {{"NUM_SAMPLES", "4"}, {"UNUSED", "1"}, {"USE_TEXTURE", "1"}, {}};
+    const ShaderMacro Perm2[] = {{"USE_TEXTURE", "0"}, {"NUM_SAMPLES", "4"}, {}};
+    const ShaderMacro Perm3[] = {{"USE_TEXTURE", "1"}, {"NUM_SAMPLES", "COUNT"}, {"COUNT", "8"}, {}};
+    const ShaderMacro Perm4[] = {{"UNUSED", "2"}, {}};
+
+    const ShaderMacro* Permutations[] = {Perm0, Perm1, Perm2, Perm3, Perm4, nullptr};
+
+    ShaderPermutationsAttribs Attribs;
+    Attribs.Source          = Source;
+    Attribs.ppPermutations  = Permutations;
+    Attribs.NumPermutations = _countof(Permutations);
+
+    const auto Info = PreprocessShaderPermutations(Attribs);
+    EXPECT_EQ(Info.DefinitionsOffset, strlen("#version 450 core\n"));
+    ASSERT_EQ(Info.PermutationToUnique.size(), size_t{6});
+    ASSERT_EQ(Info.UniqueDefinitions.size(), size_t{4});
+
+    EXPECT_EQ(Info.PermutationToUnique[0], Info.PermutationToUnique[1]);
+    EXPECT_NE(Info.PermutationToUnique[0], Info.PermutationToUnique[2]);
+    EXPECT_NE(Info.PermutationToUnique[0], Info.PermutationToUnique[3]);
+    EXPECT_EQ(Info.PermutationToUnique[4], Info.PermutationToUnique[5]);
+
+    EXPECT_EQ(Info.UniqueDefinitions[Info.PermutationToUnique[0]], "#define NUM_SAMPLES 4\n#define USE_TEXTURE 1\n");
+    // COUNT is only referenced by the definition of NUM_SAMPLES
+    EXPECT_EQ(Info.UniqueDefinitions[Info.PermutationToUnique[3]], "#define COUNT 8\n#define NUM_SAMPLES COUNT\n#define USE_TEXTURE 1\n");
+    EXPECT_EQ(Info.UniqueDefinitions[Info.PermutationToUnique[4]], "");
+
+    EXPECT_EQ(Info.GetUniqueSource(Info.PermutationToUnique[2]),
+              "#version 450 core\n"
+              "#define NUM_SAMPLES 4\n"
+              "#define USE_TEXTURE 0\n"
+              "#if USE_TEXTURE\n"
+              "uniform sampler2D g_Texture;\n"
+              "#endif\n"
+              "#define SAMPLE_COUNT NUM_SAMPLES\n"
+              "void main() {}\n");
+}
+
+TEST(ShaderTools_ShaderPermutations, TokenPasting)
+{
+    static constexpr char Source[] = "#define CONCAT(a, b) a##b\nint x = CONCAT(VAL, UE);\n";
+
+    const ShaderMacro Perm0[] = {{"VALUE", "1"}, {}};
+    const ShaderMacro Perm1[] = {{"VALUE", "2"}, {}};
+
+    const ShaderMacro* Permutations[] = {Perm0, Perm1};
+
+    ShaderPermutationsAttribs Attribs;
+    Attribs.Source          = Source;
+    Attribs.ppPermutations  = Permutations;
+    Attribs.NumPermutations = _countof(Permutations);
+
+    const auto Info = PreprocessShaderPermutations(Attribs);
+    ASSERT_EQ(Info.UniqueDefinitions.size(), size_t{2});
+}
+
+TEST(ShaderTools_ShaderPermutations, UnexpandedIncludes)
+{
+    static constexpr char Source[] = "#include \"Defs.fxh\"\nfloat4 main() : SV_Target { return COLOR; }\n";
+
+    // Defs.fxh may reference any macro, e.g. USE_RED, and is resolved by the compiler
+    const ShaderMacro Perm0[] = {{"USE_RED", "1"}, {}};
+    const ShaderMacro Perm1[] = {{"USE_RED", "0"}, {}};
+
+    const ShaderMacro* Permutations[] = {Perm0, Perm1};
+
+    ShaderPermutationsAttribs Attribs;
+    Attribs.Source          = Source;
+    Attribs.ppPermutations  = Permutations;
+    Attribs.NumPermutations = _countof(Permutations);
+
+    // No stream factory
+    {
+        const auto Info = PreprocessShaderPermutations(Attribs);
+        ASSERT_EQ(Info.UniqueDefinitions.size(), size_t{2});
+        EXPECT_NE(Info.PermutationToUnique[0], Info.PermutationToUnique[1]);
+        EXPECT_EQ(Info.UniqueDefinitions[Info.PermutationToUnique[0]], "#define USE_RED 1\n");
+    }
+
+    // The include file can't be loaded
+    {
+        RefCntAutoPtr<MemoryShaderSourceFactory> pFactory{
+            MakeNewRCObj<MemoryShaderSourceFactory>{}(std::unordered_map<std::string, std::string>{})};
+        Attribs.pShaderSourceStreamFactory = pFactory;
+
+        const auto Info = PreprocessShaderPermutations(Attribs);
+        EXPECT_EQ(pFactory->GetNumFilesOpened(), 0u);
+        ASSERT_EQ(Info.UniqueDefinitions.size(), size_t{2});
+        EXPECT_NE(Info.PermutationToUnique[0], Info.PermutationToUnique[1]);
+    }
+
+    // When the include is expanded, the macro is not referenced
+    {
+        RefCntAutoPtr<MemoryShaderSourceFactory> pFactory{
+            MakeNewRCObj<MemoryShaderSourceFactory>{}(
+                std::unordered_map<std::string, std::string>{
+                    {"Defs.fxh", "#define COLOR float4(1.0, 0.0, 0.0, 1.0)\n"},
+                })};
+        Attribs.pShaderSourceStreamFactory = pFactory;
+
+        const auto Info = PreprocessShaderPermutations(Attribs);
+        ASSERT_EQ(Info.UniqueDefinitions.size(), size_t{1});
+        EXPECT_EQ(Info.UniqueDefinitions[0], "");
+    }
+}
+
+TEST(ShaderTools_ShaderPermutations, Compile)
+{
+    static constexpr char Source[] = "float4 main() : SV_Target { return float4(R, G, B, 1.0); }\n";
+
+    const char* Values[] = {"0.0", "0.5", "1.0"};
+
+    std::vector<std::array<ShaderMacro, 5>> Macros;
+    for (auto* R : Values)
+    {
+        for (auto* G : Values)
+        {
+            for (auto* B : Values)
+            {
+                // Every color is compiled twice: once with an unused macro
+                for (auto* Unused : {"0", "1"})
+                    Macros.push_back({ShaderMacro{"R", R}, ShaderMacro{"G", G}, ShaderMacro{"B", B}, ShaderMacro{"UNUSED", Unused}, ShaderMacro{}});
+            }
+        }
+    }
+
+    std::vector<const ShaderMacro*> Permutations;
+    for (const auto& PermMacros : Macros)
+        Permutations.push_back(PermMacros.data());
+
+    ShaderPermutationsAttribs Attribs;
+    Attribs.Source          = Source;
+    Attribs.ppPermutations  = Permutations.data();
+    Attribs.NumPermutations = static_cast<Uint32>(Permutations.size());
+
+    for (Uint32 NumThreads : {1u, 4u, 0u})
+    {
+        std::atomic<Uint32> NumCompiled{0};
+
+        ShaderPermutationsInfo Info;
+
+        const auto Bytecode = CompileShaderPermutations(
+            Attribs,
+            [&](const std::string& PermSource, Uint32 UniqueIdx) {
+                ++NumCompiled;
+                return UniqueIdx == 0 ? RefCntAutoPtr<IDataBlob>{} : CompileToString(PermSource, UniqueIdx);
+            },
+            NumThreads, &Info);
+
+        EXPECT_EQ(NumCompiled.load(), Uint32{27});
+        ASSERT_EQ(Bytecode.size(), Permutations.size());
+        ASSERT_EQ(Info.UniqueDefinitions.size(), size_t{27});
+
+        for (size_t i = 0; i < Bytecode.size(); ++i)
+        {
+            const auto UniqueIdx = Info.PermutationToUnique[i];
+            if (UniqueIdx == 0)
+            {
+                EXPECT_FALSE(Bytecode[i]);
+                continue;
+            }
+
+            EXPECT_EQ(Bytecode[i].RawPtr(), Bytecode[i ^ 1].RawPtr());
+
+            std::string RefSource;
+            RefSource += "#define B ";
+            RefSource += Macros[i][2].Definition;
+            RefSource += "\n#define G ";
+            RefSource += Macros[i][1].Definition;
+            RefSource += "\n#define R ";
+            RefSource += Macros[i][0].Definition;
+            RefSource += '\n';
+            RefSource += Source;
+            EXPECT_EQ(BlobToString(Bytecode[i]), RefSource);
+        }
+    }
+}
+
+TEST(ShaderTools_ShaderPermutations, ReadSourceOnce)
+{
+    RefCntAutoPtr<MemoryShaderSourceFactory> pFactory{
+        MakeNewRCObj<MemoryShaderSourceFactory>{}(
+            std::unordered_map<std::string, std::string>{
+                {"Main.fx", "#include \"Common.fxh\"\nint x = VALUE;\n"},
+                {"Common.fxh", "// Common"},
+            })};
+
+    std::vector<std::array<ShaderMacro, 2>> Macros;
+    std::vector<std::string>                Values;
+    for (Uint32 i = 0; i < 16; ++i)
+        Values.emplace_back(std::to_string(i));
+    for (const auto& Value : Values)
+        Macros.push_back({ShaderMacro{"VALUE", Value.c_str()}, ShaderMacro{}});
+
+    std::vector<const ShaderMacro*> Permutations;
+    for (const auto& PermMacros : Macros)
+        Permutations.push_back(PermMacros.data());
+
+    ShaderPermutationsAttribs Attribs;
+    Attribs.FilePath                   = "Main.fx";
+    Attribs.pShaderSourceStreamFactory = pFactory;
+    Attribs.ppPermutations             = Permutations.data();
+    Attribs.NumPermutations            = static_cast<Uint32>(Permutations.size());
+
+    const auto Bytecode = CompileShaderPermutations(Attribs, CompileToString);
+    ASSERT_EQ(Bytecode.size(), Permutations.size());
+    for (size_t i = 0; i < Bytecode.size(); ++i)
+    {
+        EXPECT_EQ(BlobToString(Bytecode[i]), "#define VALUE " + Values[i] + "\n// Common\nint x = VALUE;\n");
+    }
+    EXPECT_EQ(pFactory->GetNumFilesOpened(), Uint32{2});
+}
+
+} // namespace
@@ -59,6 +59,7 @@ public:
         Uint32             NumDeferredContexts       = 4;
         bool               ForceNonSeparablePrograms = false;
         bool               EnableDeviceSimulation    = false;
+        bool               BatchQueueSubmissions     = false;
     };
     TestingEnvironment(const CreateInfo& CI, const SwapChainDesc& SCDesc);
 
@@ -128,8 +128,10 @@ private:
     VkPhysicalDeviceMemoryProperties m_MemoryProperties = {};
 
 public:
-    VkPhysicalDeviceDescriptorIndexingFeaturesEXT DescriptorIndexing = {};
-    VkPhysicalDeviceProperties                    DeviceProps        = {};
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT      DescriptorIndexing      = {};
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR        DynamicRendering        = {};
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT GraphicsPipelineLibrary = {};
+    VkPhysicalDeviceProperties                         DeviceProps             = {};
 };
 
 } // namespace Testing
@@ -55,6 +55,10 @@
 #    include "EngineFactoryMtl.h"
 #endif
 
+#if NULL_SUPPORTED
+#    include "EngineFactoryNull.h"
+#endif
+
 
 namespace Diligent
 {
@@ -82,6 +86,10 @@ TestingEnvironment* CreateTestingEnvironmentVk(const TestingEnvironment::CreateI
 TestingEnvironment* CreateTestingEnvironmentMtl(const TestingEnvironment::CreateInfo& CI, const SwapChainDesc& SCDesc);
 #endif
 
+#if NULL_SUPPORTED
+TestingEnvironment* CreateTestingEnvironmentNull(const TestingEnvironment::CreateInfo& CI, const SwapChainDesc& SCDesc);
+#endif
+
 
 TestingEnvironment* TestingEnvironment::m_pTheEnvironment = nullptr;
 std::atomic_int     TestingEnvironment::m_NumAllowedErrors;
@@ -438,6 +446,8 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
             //CreateInfo.HostVisibleMemoryReserveSize = 48 << 20;
             CreateInfo.Features = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
 
+            CreateInfo.BatchQueueSubmissions = CI.BatchQueueSubmissions;
+
             NumDeferredCtx                 = CI.NumDeferredContexts;
             CreateInfo.NumDeferredContexts = NumDeferredCtx;
             ppContexts.resize(std::max(size_t{1}, ContextCI.size()) + NumDeferredCtx);
@@ -475,6 +485,36 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
         break;
 #endif
 
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+        {
+#    if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+            // Load the dll and import GetEngineFactoryNull() function
+            auto GetEngineFactoryNull = LoadGraphicsEngineNull();
+            if (GetEngineFactoryNull == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+
+            auto* pFactoryNull = GetEngineFactoryNull();
+            EnumerateAdapters(pFactoryNull, Version{});
+
+            EngineNullCreateInfo CreateInfo;
+
+            // Always enable validation
+            CreateInfo.SetValidationLevel(VALIDATION_LEVEL_1);
+
+            CreateInfo.DebugMessageCallback = MessageCallback;
+            CreateInfo.Features             = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
+            NumDeferredCtx                  = CI.NumDeferredContexts;
+            CreateInfo.NumDeferredContexts  = NumDeferredCtx;
+            ppContexts.resize(1 + NumDeferredCtx);
+            pFactoryNull->CreateDeviceAndContextsNull(CreateInfo, &m_pDevice, ppContexts.data());
+        }
+        break;
+#endif
+
         default:
             LOG_ERROR_AND_THROW("Unknown device type");
             break;
@@ -718,6 +758,11 @@ void TestingEnvironment::SetDefaultCompiler(SHADER_COMPILER compiler)
             }
             break;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // Shaders are never compiled by the null backend
+            m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            break;
+
         default:
             LOG_WARNING_MESSAGE("Unepxected device type");
             m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
@@ -793,6 +838,10 @@ TestingEnvironment* TestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.deviceType = RENDER_DEVICE_TYPE_METAL;
         }
+        else if (strcmp(arg, "--mode=null") == 0)
+        {
+            TestEnvCI.deviceType = RENDER_DEVICE_TYPE_NULL;
+        }
         else if (AdapterArgName.compare(0, AdapterArgName.length(), arg, AdapterArgName.length()) == 0)
         {
             TestEnvCI.AdapterId = static_cast<Uint32>(atoi(arg + AdapterArgName.length()));
@@ -809,6 +858,10 @@ TestingEnvironment* TestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.EnableDeviceSimulation = true;
         }
+        else if (strcmp(arg, "--vk_batch_submits") == 0)
+        {
+            TestEnvCI.BatchQueueSubmissions = true;
+        }
     }
 
     if (TestEnvCI.deviceType == RENDER_DEVICE_TYPE_UNDEFINED)
@@ -878,6 +931,13 @@ TestingEnvironment* TestingEnvironment::Initialize(int argc, char** argv)
                 break;
 #endif
 
+#if NULL_SUPPORTED
+            case RENDER_DEVICE_TYPE_NULL:
+                std::cout << "\n\n\n===================== Testing Diligent Core API in Null mode =====================\n\n";
+                pEnv = CreateTestingEnvironmentNull(TestEnvCI, SCDesc);
+                break;
+#endif
+
             default:
                 LOG_ERROR_AND_THROW("Unsupported device type");
         }
@@ -94,6 +94,25 @@ TestingEnvironmentVk::TestingEnvironmentVk(const CreateInfo&    CI,
                 HasDescriptorIndexing = true;
         }
 
+        std::vector<VkExtensionProperties> DeviceExtensions;
+
+        vkEnumerateDeviceExtensionProperties(m_vkPhysicalDevice, nullptr, &ExtensionCount, nullptr);
+        DeviceExtensions.resize(ExtensionCount);
+        vkEnumerateDeviceExtensionProperties(m_vkPhysicalDevice, nullptr, &ExtensionCount, DeviceExtensions.data());
+
+        bool HasDynamicRendering        = false;
+        bool HasGraphicsPipelineLibrary = false;
+        bool HasPipelineLibrary         = false;
+        for (uint32_t i = 0; i < ExtensionCount; ++i)
+        {
+            if (!HasDynamicRendering && strcmp(DeviceExtensions[i].extensionName, VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME) == 0)
+                HasDynamicRendering = true;
+            if (!HasGraphicsPipelineLibrary && strcmp(DeviceExtensions[i].extensionName, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) == 0)
+                HasGraphicsPipelineLibrary = true;
+            if (!HasPipelineLibrary && strcmp(DeviceExtensions[i].extensionName, VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) == 0)
+                HasPipelineLibrary = true;
+        }
+
         // Get extension features and properties.
         if (HasPhysicalDeviceProps2)
         {
@@ -110,6 +129,22 @@ TestingEnvironmentVk::TestingEnvironmentVk(const CreateInfo&    CI,
                 DescriptorIndexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
             }
 
+            if (HasDynamicRendering)
+            {
+                *NextFeat = &DynamicRendering;
+                NextFeat  = &DynamicRendering.pNext;
+
+                DynamicRendering.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+            }
+
+            if (HasGraphicsPipelineLibrary && HasPipelineLibrary)
+            {
+                *NextFeat = &GraphicsPipelineLibrary;
+                NextFeat  = &GraphicsPipelineLibrary.pNext;
+
+                GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+            }
+
             vkGetPhysicalDeviceFeatures2KHR(m_vkPhysicalDevice, &Feats2);
         }
     }
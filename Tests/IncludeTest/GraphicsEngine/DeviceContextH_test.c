@@ -35,7 +35,7 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     pDesc = IDeviceContext_GetDesc(pCtx);
     (void)(pDesc);
 
-    IDeviceContext_Begin(pCtx, 0u);
+    IDeviceContext_Begin(pCtx, 0u, COMMAND_LIST_FLAG_NONE);
 
     IDeviceContext_TransitionShaderResources(pCtx, (struct IPipelineState*)NULL, (struct IShaderResourceBinding*)NULL);
     IDeviceContext_TransitionResourceStates(pCtx, 1u, (const struct StateTransitionDesc*)NULL);
@@ -44,6 +44,9 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     IDeviceContext_CommitShaderResources(pCtx, (struct IShaderResourceBinding*)NULL, RESOURCE_STATE_TRANSITION_MODE_NONE);
     IDeviceContext_SetStencilRef(pCtx, 1u);
     IDeviceContext_SetBlendFactors(pCtx, (const float*)NULL);
+    IDeviceContext_SetCullMode(pCtx, CULL_MODE_BACK, False);
+    IDeviceContext_SetDepthStencilState(pCtx, (const struct DepthStencilStateDesc*)NULL);
+    IDeviceContext_SetPrimitiveTopology(pCtx, PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
     IDeviceContext_SetVertexBuffers(pCtx, 0u, 1u, (struct IBuffer**)NULL, (const Uint64*)NULL, RESOURCE_STATE_TRANSITION_MODE_NONE, SET_VERTEX_BUFFERS_FLAG_RESET);
     IDeviceContext_InvalidateState(pCtx);
     IDeviceContext_SetIndexBuffer(pCtx, (struct IBuffer*)NULL, (Uint64)0, RESOURCE_STATE_TRANSITION_MODE_NONE);
@@ -59,6 +62,8 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
 
     IDeviceContext_Draw(pCtx, (struct DrawAttribs*)NULL);
     IDeviceContext_DrawIndexed(pCtx, (struct DrawIndexedAttribs*)NULL);
+    IDeviceContext_MultiDraw(pCtx, (struct MultiDrawAttribs*)NULL);
+    IDeviceContext_MultiDrawIndexed(pCtx, (struct MultiDrawIndexedAttribs*)NULL);
     IDeviceContext_DrawIndirect(pCtx, (struct DrawIndirectAttribs*)NULL);
     IDeviceContext_DrawIndexedIndirect(pCtx, (struct DrawIndexedIndirectAttribs*)NULL);
     IDeviceContext_DrawMesh(pCtx, (struct DrawMeshAttribs*)NULL);
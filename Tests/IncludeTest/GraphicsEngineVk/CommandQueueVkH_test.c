@@ -47,4 +47,12 @@ void TestCommandQueueVk_CInterface(ICommandQueueVk* pQueue)
     ICommandQueueVk_EnqueueSignalFence(pQueue, (VkFence)NULL);
 
     ICommandQueueVk_EnqueueSignal(pQueue, (VkSemaphore)NULL, (Uint64)0);
+
+    FenceVal = ICommandQueueVk_EnqueueSubmit(pQueue, (VkSubmitInfo*)NULL);
+    (void)FenceVal;
+
+    ICommandQueueVk_FlushPendingSubmits(pQueue);
+
+    QueueSubmitStatsVk Stats = ICommandQueueVk_GetSubmitStats(pQueue);
+    (void)Stats;
 }
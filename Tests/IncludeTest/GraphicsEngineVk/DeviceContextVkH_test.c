@@ -32,4 +32,11 @@ void TestDeviceContextVk_CInterface(IDeviceContextVk* pCtx)
 {
     IDeviceContextVk_TransitionImageLayout(pCtx, (ITexture*)NULL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
     IDeviceContextVk_BufferMemoryBarrier(pCtx, (IBuffer*)NULL, VK_ACCESS_HOST_READ_BIT);
+
+    MemoryDefragmentationStatsVk Stats;
+    IDeviceContextVk_DefragmentMemory(pCtx, 1024, &Stats);
+
+    BeginRenderPassAttribs Attribs;
+    IDeviceContextVk_BeginRenderPassWithSecondaryCommandLists(pCtx, &Attribs);
+    IDeviceContextVk_BeginSecondaryCommandList(pCtx, (IDeviceContext*)NULL);
 }
@@ -44,4 +44,15 @@ void TestRenderDeviceVkCInterface(IRenderDeviceVk* pDevice)
     IRenderDeviceVk_CreateBLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (BottomLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (IBottomLevelAS**)NULL);
     IRenderDeviceVk_CreateTLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (TopLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (ITopLevelAS**)NULL);
     IRenderDeviceVk_CreateFenceFromVulkanResource(pDevice, (VkSemaphore)NULL, (const FenceDesc*)NULL, (IFence**)NULL);
+
+    RenderPassCacheStatsVk RenderPassStats = IRenderDeviceVk_GetRenderPassCacheStats(pDevice);
+    (void)RenderPassStats;
+
+    PipelineLibraryCacheStatsVk LibraryStats = IRenderDeviceVk_GetPipelineLibraryCacheStats(pDevice);
+    (void)LibraryStats;
+
+    MemoryHeapStatsVk HeapStats = IRenderDeviceVk_GetMemoryHeapStats(pDevice, 0);
+    (void)HeapStats;
+
+    IRenderDeviceVk_SetMemoryBudgetCallback(pDevice, (MemoryBudgetCallbackVkType)NULL, NULL);
 }